@@ -0,0 +1,61 @@
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "lvgl.h"
+
+/*Fonts and images in the "assets" partition. The partition is mapped into the address space once and the assets are
+used in place, so they take no heap and adding one doesn't grow the firmware image.
+
+A pack is a header, the table of the entries and the data of the assets, each aligned to ASSETS_ALIGN. All numbers
+are little endian. The packs are built on the host from assets/assets.txt by mkassets of the simulator (sim/)*/
+
+#define ASSETS_PARTITION_LABEL  "assets"
+#define ASSETS_MAGIC            0x54535341  // "ASST"
+#define ASSETS_VERSION          1
+#define ASSETS_NAME_LENGTH      24          // With the terminating zero
+#define ASSETS_ALIGN            4
+
+typedef enum
+{
+    ASSET_TYPE_RAW = 0,
+    ASSET_TYPE_TTF = 1,     // A TrueType font, Tiny TTF reads it in place
+    ASSET_TYPE_IMAGE = 2,   // An LVGL binary image: lv_img_header_t followed by the pixels
+} asset_type_t;
+
+typedef struct
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t entry_cnt;
+    uint32_t size;          // Of the whole pack
+} assets_header_t;
+
+typedef struct
+{
+    char name[ASSETS_NAME_LENGTH];
+    uint32_t type;
+    uint32_t offset;        // From the start of the pack
+    uint32_t size;
+} assets_entry_t;
+
+/*Map the pack of the asset partition. Return false if there is no partition or it doesn't hold a valid pack*/
+bool assets_init(void);
+
+/*Unmap the pack, e.g. before writing a new one. Nothing created from the assets may be used after it*/
+void assets_deinit(void);
+
+/*Return the data of an asset in the mapped partition and its size, or NULL if there is no such asset*/
+const void* assets_get(const char* name, asset_type_t type, size_t* size);
+
+/*Fill an image descriptor which points into the mapped partition. Return false if there is no such image*/
+bool assets_get_image(const char* name, lv_img_dsc_t* dsc);
+
+/*Create a Tiny TTF font from a mapped TrueType font. Only the font and its glyph cache are allocated. Destroy it with
+lv_tiny_ttf_destroy(). Return NULL if there is no such font or it couldn't be created*/
+lv_font_t* assets_ttf_create(const char* name, lv_coord_t font_size, size_t cache_size);
+
+#endif // ASSETS_H
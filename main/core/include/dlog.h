@@ -0,0 +1,88 @@
+#ifndef DLOG_H
+#define DLOG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "esp_attr.h"
+
+/*Deferred logging for the drivers. A log call only copies the format pointer and up to DLOG_ARGS_MAX integers into a
+lock-free RAM ring, so it is safe in an ISR and costs no UART time. The records are formatted later by a low-priority
+task, or read with dlog_read() and formatted offline.
+
+The levels are numbers so they work in #if. Set DLOG_LOCAL_LEVEL before including this header, the calls above it
+compile to nothing:
+    #define DLOG_LOCAL_LEVEL    MAX30102_LOG_LEVEL
+    #include "dlog.h"
+The tag and the format must be string literals, they are stored as pointers. Only integer arguments are supported*/
+
+#define DLOG_LEVEL_NONE     0 // Same values as esp_log_level_t
+#define DLOG_LEVEL_ERROR    1
+#define DLOG_LEVEL_WARN     2
+#define DLOG_LEVEL_INFO     3
+#define DLOG_LEVEL_DEBUG    4
+#define DLOG_LEVEL_VERBOSE  5
+
+#ifndef DLOG_LOCAL_LEVEL
+#define DLOG_LOCAL_LEVEL    DLOG_LEVEL_WARN
+#endif
+
+#ifndef DLOG_FORMAT_IN_TASK
+#define DLOG_FORMAT_IN_TASK 1 // 0 leaves the records in the ring for dlog_read()
+#endif
+
+#define DLOG_RING_LENGTH        64  // Must be a power of two. A full ring drops the new records
+#define DLOG_ARGS_MAX           4
+#define DLOG_FLUSH_PERIOD_MS    100 // Period of the task printing the records
+#define DLOG_LINE_LENGTH        128 // Longer messages are truncated
+
+typedef struct
+{
+    uint32_t timestamp_ms;
+    const char* tag;
+    const char* format;             // Also the id of the message, it points into flash
+    uint32_t args[DLOG_ARGS_MAX];
+    uint8_t level;
+    uint8_t arg_cnt;
+} dlog_record_t;
+
+/*Use the macros below instead, they check the arguments*/
+IRAM_ATTR void dlog_write(uint8_t level, const char* tag, const char* format, const uint32_t* args, int arg_cnt);
+
+/*Start the task printing the records, if DLOG_FORMAT_IN_TASK is set. dlog_write() works before it too*/
+bool dlog_init(void);
+
+/*Remove the oldest record from the ring. Return false if it is empty*/
+bool dlog_read(dlog_record_t* record);
+
+/*Number of records lost because the ring was full*/
+uint32_t dlog_get_dropped_cnt(void);
+
+/*Never called, it only lets the compiler check the format against the arguments*/
+static inline __attribute__((format(printf, 1, 2))) void dlog_check_format(const char* format, ...)
+{
+}
+
+#define DLOG_WRITE(level, tag, format, ...)                                                 \
+    do                                                                                      \
+    {                                                                                       \
+        if (DLOG_LOCAL_LEVEL >= (level))                                                    \
+        {                                                                                   \
+            const uint32_t dlog_args[] = {0, ##__VA_ARGS__}; /*The first one is a dummy*/   \
+            _Static_assert(sizeof(dlog_args) / sizeof(uint32_t) - 1 <= DLOG_ARGS_MAX,       \
+                           "Too many arguments for a deferred log");                        \
+            if (0)                                                                          \
+            {                                                                               \
+                dlog_check_format(format, ##__VA_ARGS__);                                   \
+            }                                                                               \
+            dlog_write(level, tag, format, dlog_args + 1, sizeof(dlog_args) / sizeof(uint32_t) - 1); \
+        }                                                                                   \
+    } while (0)
+
+#define DLOGE(tag, format, ...)     DLOG_WRITE(DLOG_LEVEL_ERROR, tag, format, ##__VA_ARGS__)
+#define DLOGW(tag, format, ...)     DLOG_WRITE(DLOG_LEVEL_WARN, tag, format, ##__VA_ARGS__)
+#define DLOGI(tag, format, ...)     DLOG_WRITE(DLOG_LEVEL_INFO, tag, format, ##__VA_ARGS__)
+#define DLOGD(tag, format, ...)     DLOG_WRITE(DLOG_LEVEL_DEBUG, tag, format, ##__VA_ARGS__)
+#define DLOGV(tag, format, ...)     DLOG_WRITE(DLOG_LEVEL_VERBOSE, tag, format, ##__VA_ARGS__)
+
+#endif // DLOG_H
@@ -0,0 +1,60 @@
+#ifndef I2C_SCHEDULER_H
+#define I2C_SCHEDULER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "driver/i2c_master.h"
+
+#define I2C_SCHED_QUEUE_LENGTH      32 // Max. number of transactions waiting for the bus
+#define I2C_SCHED_LOW_PRIO_SLOTS    24 // Low priority transactions leave the other slots free for the urgent ones
+#define I2C_SCHED_BATCH_MAX         8  // Max. number of transactions run back to back for one device while others wait
+#define I2C_SCHED_WAITERS_MAX       4  // Max. number of tasks waiting in i2c_sched_transfer() at the same time
+#define I2C_SCHED_TIMEOUT_MS        1000 // Timeout of a single transaction on the bus
+
+typedef enum
+{
+    I2C_SCHED_PRIORITY_HIGH,        // Time critical reads, e.g. the clock
+    I2C_SCHED_PRIORITY_NORMAL,      // Configuration
+    I2C_SCHED_PRIORITY_LOW,         // Bulk transfers like draining the PPG FIFO
+    I2C_SCHED_PRIORITY_CNT,
+} i2c_sched_priority_t;
+
+/*Called from the scheduler task once the transaction is done. Keep it short, the bus waits for it*/
+typedef void (*i2c_sched_callback_t)(esp_err_t result, void* arg);
+
+typedef struct
+{
+    i2c_master_dev_handle_t dev;
+    const uint8_t* write_buffer;    // Sent first, may be NULL if write_size is 0
+    size_t write_size;
+    uint8_t* read_buffer;           // Read after a repeated start, may be NULL if read_size is 0
+    size_t read_size;
+    i2c_sched_priority_t priority;
+    uint32_t deadline_ms;           // Fails with ESP_ERR_TIMEOUT if it didn't start within this time, 0 for no deadline
+    i2c_sched_callback_t callback;  // May be NULL
+    void* arg;
+} i2c_sched_transaction_t;
+
+/*Create the scheduler task. Call it once before any transaction is submitted*/
+bool i2c_sched_init(void);
+
+/*Queue `count` transactions without waiting for them, all of them or none.
+The buffers must stay valid until the callback was called.
+Transactions run by priority, then by deadline, then in the order they were submitted. Pending transactions of the
+device which used the bus last run first unless a more urgent one waits, at most I2C_SCHED_BATCH_MAX in a row.
+Return ESP_ERR_NO_MEM if there are not enough free slots*/
+esp_err_t i2c_sched_submit(const i2c_sched_transaction_t* transactions, int count);
+
+/*Queue `count` transactions and wait until all of them are done. The callbacks of `transactions` are not used.
+Return ESP_OK or the first error*/
+esp_err_t i2c_sched_transfer(const i2c_sched_transaction_t* transactions, int count);
+
+/*Single blocking transaction, like i2c_master_transmit_receive(). The read part is skipped if read_size is 0*/
+esp_err_t i2c_sched_transmit_receive(i2c_master_dev_handle_t dev, const uint8_t* write_buffer, size_t write_size,
+                                     uint8_t* read_buffer, size_t read_size, i2c_sched_priority_t priority,
+                                     uint32_t deadline_ms);
+
+#endif // I2C_SCHEDULER_H
@@ -0,0 +1,119 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "lvgl.h"
+
+#ifndef METRICS_ENABLED
+#define METRICS_ENABLED             1 // 0 compiles the metrics out, the macros below become empty
+#endif
+
+#define METRICS_DUMP_PERIOD_MS      1000 // Period of the snapshots written to the RAM ring
+#define METRICS_RING_LENGTH         16   // Number of snapshots kept in RAM
+#define METRICS_UART_NUM            -1   // UART which also gets each snapshot in binary, -1 for the RAM ring only
+#define METRICS_HISTOGRAM_BUCKETS   16   // Bucket 0 counts 0, bucket i counts [2^(i-1), 2^i), the last one also counts the rest
+#define METRICS_RECORD_MAGIC        0x4d54 // "TM" in the first two bytes of a record
+#define METRICS_RECORD_VERSION      1
+
+typedef enum
+{
+    METRIC_FRAMES,                  // LVGL refreshes which drew something
+    METRIC_FLUSH_AREAS,             // Areas handed to the display driver
+    METRIC_FLUSH_PIXELS,
+    METRIC_RTC_READS,
+    METRIC_RTC_I2C_TRANSACTIONS,
+    METRIC_RTC_I2C_ERRORS,
+    METRIC_PPG_INTERRUPTS,
+    METRIC_PPG_SAMPLES,
+    METRIC_PPG_I2C_TRANSACTIONS,    // Only the ones of the sample path
+    METRIC_UI_CMDS,                 // Commands applied in the LVGL task
+    METRIC_UI_CMDS_DROPPED,         // Commands lost because the queue was full
+    METRIC_COUNTER_CNT,
+} metric_counter_t;
+
+typedef enum
+{
+    METRIC_HEAP_FREE,               // Sampled for every snapshot
+    METRIC_HEAP_MIN_FREE,
+    METRIC_UI_CMD_QUEUE_DEPTH,      // Commands waiting the last time the LVGL task applied them
+    METRIC_GAUGE_CNT,
+} metric_gauge_t;
+
+typedef enum
+{
+    METRIC_FRAME_TIME_US,           // From the start of rendering until LVGL finished the refresh
+    METRIC_RTC_READ_TIME_US,        // Reading the date and time from the DS3231
+    METRIC_PPG_SERVICE_TIME_US,     // Handling one interrupt of the MAX30102 including the FIFO read
+    METRIC_HISTOGRAM_CNT,
+} metric_histogram_t;
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t sum;                   // Stops at UINT32_MAX
+    uint32_t buckets[METRICS_HISTOGRAM_BUCKETS];
+} metrics_histogram_values_t;
+
+/*One snapshot. The values count from the start, so the reader takes the differences and missing records don't matter.
+Only 32 bit fields after the header, so the layout has no padding and the record is dumped as it is (little endian)*/
+typedef struct
+{
+    uint16_t magic;
+    uint8_t version;
+    uint8_t sequence;               // Incremented with every record, wraps around
+    uint32_t timestamp_ms;
+    uint32_t counters[METRIC_COUNTER_CNT];
+    int32_t gauges[METRIC_GAUGE_CNT];
+    metrics_histogram_values_t histograms[METRIC_HISTOGRAM_CNT];
+} metrics_record_t;
+
+#if METRICS_ENABLED
+
+#include "esp_timer.h"
+
+/*The updates are lock-free and O(1), they can be called from any task or ISR*/
+extern uint32_t metrics_counters[METRIC_COUNTER_CNT];
+
+static inline void metrics_counter_add(metric_counter_t id, uint32_t value)
+{
+    __atomic_fetch_add(&metrics_counters[id], value, __ATOMIC_RELAXED);
+}
+
+void metrics_gauge_set(metric_gauge_t id, int32_t value);
+void metrics_histogram_add(metric_histogram_t id, uint32_t value);
+
+/*Start the task which writes the snapshots. The updates work before it too*/
+bool metrics_init(void);
+
+/*Measure the frames and the flushes of the display. Call it once, with lvgl_port_lock() taken*/
+void metrics_attach_display(lv_disp_t* disp);
+
+/*Take a snapshot now, it doesn't go into the ring. The sequence is 0*/
+void metrics_read(metrics_record_t* record);
+
+/*Copy the snapshots in the ring to `records`, the oldest first. Return the number of records copied*/
+int metrics_ring_read(metrics_record_t* records, int max_cnt);
+
+#define METRICS_INIT()                      metrics_init()
+#define METRICS_ATTACH_DISPLAY(disp)        metrics_attach_display(disp)
+#define METRICS_COUNTER_ADD(id, value)      metrics_counter_add(id, value)
+#define METRICS_GAUGE_SET(id, value)        metrics_gauge_set(id, value)
+#define METRICS_HISTOGRAM_ADD(id, value)    metrics_histogram_add(id, value)
+#define METRICS_TIME_START(var)             int64_t var = esp_timer_get_time()
+#define METRICS_TIME_END(id, var)           metrics_histogram_add(id, (uint32_t)(esp_timer_get_time() - (var)))
+
+#else
+
+#define METRICS_INIT()                      true
+#define METRICS_ATTACH_DISPLAY(disp)        do {} while (0)
+#define METRICS_COUNTER_ADD(id, value)      do {} while (0)
+#define METRICS_GAUGE_SET(id, value)        do {} while (0)
+#define METRICS_HISTOGRAM_ADD(id, value)    do {} while (0)
+#define METRICS_TIME_START(var)             do {} while (0)
+#define METRICS_TIME_END(id, var)           do {} while (0)
+
+#endif // METRICS_ENABLED
+
+#endif // METRICS_H
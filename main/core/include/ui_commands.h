@@ -0,0 +1,51 @@
+#ifndef UI_COMMANDS_H
+#define UI_COMMANDS_H
+
+#include <stdbool.h>
+
+#include "lvgl.h"
+
+#define UI_CMD_QUEUE_LENGTH     16 // Max. number of commands waiting for the LVGL task
+#define UI_CMD_TEXT_MAX_LENGTH  32 // Max. length of a label text including the terminating 0
+#define UI_CMD_PERIOD_MS        20 // Period of the lv_timer which applies the commands
+
+typedef void (*ui_cmd_callback_t)(void* arg);
+
+typedef enum{
+    UI_CMD_SET_TEXT,    // Set the text of a label
+    UI_CMD_CALL,        // Call a function in the LVGL task
+}ui_cmd_type_t;
+
+typedef struct
+{
+    ui_cmd_type_t type;
+    lv_obj_t* target;
+
+    union
+    {
+        char text[UI_CMD_TEXT_MAX_LENGTH];
+        struct
+        {
+            ui_cmd_callback_t callback;
+            void* arg;
+        } call;
+    } data;
+} ui_cmd_t; // A command is copied into a fixed-size queue slot so no memory is allocated per update
+
+/*Create the command queue and the lv_timer consuming it. Call it from the LVGL task or with lvgl_port_lock() taken*/
+bool ui_cmd_init(void);
+
+/*Apply the waiting commands right away. Call it from the LVGL task, e.g. before deleting objects which may be targeted*/
+void ui_cmd_flush(void);
+
+/*Apply only the commands targeting objects and leave the calls for the next period. Use it where a call could
+re-enter the caller, e.g. while switching widgets*/
+void ui_cmd_flush_objects(void);
+
+/*Functions below can be called from any task without taking lvgl_port_lock(). They return false if the queue is full.
+The target objects must not be deleted while commands to them are waiting in the queue*/
+bool ui_cmd_set_text(lv_obj_t* label, const char* text);
+bool ui_cmd_set_text_fmt(lv_obj_t* label, const char* fmt, ...) LV_FORMAT_ATTRIBUTE(2, 3);
+bool ui_cmd_call(ui_cmd_callback_t callback, void* arg);
+
+#endif // UI_COMMANDS_H
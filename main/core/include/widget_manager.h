@@ -1,11 +1,38 @@
 #ifndef WIDGET_MANAGER_H
 #define WIDGET_MANAGER_H
 
+#include <stdbool.h>
+
 #include "lvgl.h"
 
 #include "input_event_types.h"
 
+#define WIDGET_MANAGER_MAX_WIDGETS  8 // Max. number of registered widgets
+
+/*Description of a widget. The hooks are called from the LVGL task*/
+typedef struct
+{
+    const char* name;
+    bool uses_encoder;  // If false, scrolling switches to the neighbouring widget instead of moving the focus
+    bool keep_tree;     // If false, the objects of the widget are destroyed when it's suspended
+
+    bool (*init)(void* ctx, lv_obj_t* screen);  // Create the objects on `screen`. Called on the first activation
+    void (*activate)(void* ctx);                // Start updating the objects (e.g. resume polling the sensors)
+    void (*suspend)(void* ctx);                 // Stop updating and free what can be recreated (e.g. glyph caches)
+    void (*destroy)(void* ctx);                 // Called after the screen was deleted. Free what init created
+    void* ctx;
+} widget_t;
+
 void encoder_event_callback(lv_indev_drv_t* indev_drv, lv_indev_data_t* data);
 void input_events_handler_task(void* queue_ptr);
 
+/*Add a widget to the end of the list. Call it before widget_manager_start()*/
+bool widget_manager_register(const widget_t* widget);
+
+/*Load the first registered widget. Takes lvgl_port_lock(), so don't call it from the LVGL task*/
+void widget_manager_start(void);
+
+/*Switch to the widget `step` positions away from the active one (wraps around). Call it from the LVGL task*/
+void widget_manager_switch(int step);
+
 #endif // WIDGET_MANAGER_H
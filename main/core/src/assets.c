@@ -0,0 +1,145 @@
+#include <string.h>
+#include <inttypes.h>
+
+#include "assets.h"
+
+#include "esp_partition.h"
+#include "esp_log.h"
+
+static const char TAG[] = "assets";
+
+static const uint8_t* pack = NULL; // The mapped pack, NULL until assets_init() succeeded
+static esp_partition_mmap_handle_t pack_handle;
+
+static bool check_pack(const assets_header_t* header, const uint8_t* data)
+{
+    /*The header was checked already, now see if every asset is inside the pack*/
+    const assets_entry_t* entries = (const assets_entry_t*)(data + sizeof(assets_header_t));
+
+    for (int i = 0; i < header->entry_cnt; i++)
+    {
+        const assets_entry_t* entry = &entries[i];
+        if (memchr(entry->name, '\0', ASSETS_NAME_LENGTH) == NULL ||
+            entry->offset % ASSETS_ALIGN != 0 ||
+            entry->offset > header->size || entry->size > header->size - entry->offset)
+        {
+            ESP_LOGE(TAG, "Invalid entry %d", i);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool assets_init(void)
+{
+    if (pack != NULL)
+    {
+        return true;
+    }
+
+    const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                                                ASSETS_PARTITION_LABEL);
+    if (partition == NULL)
+    {
+        ESP_LOGE(TAG, "No \"%s\" partition", ASSETS_PARTITION_LABEL);
+        return false;
+    }
+
+    /*Read the header first, so only the pack is mapped and not the whole partition*/
+    assets_header_t header;
+    if (esp_partition_read(partition, 0, &header, sizeof(header)) != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to read the header");
+        return false;
+    }
+
+    if (header.magic != ASSETS_MAGIC || header.version != ASSETS_VERSION || header.size > partition->size ||
+        header.size < sizeof(assets_header_t) + header.entry_cnt * sizeof(assets_entry_t))
+    {
+        ESP_LOGE(TAG, "The partition doesn't hold a valid asset pack, flash one built by mkassets");
+        return false;
+    }
+
+    const void* data;
+    esp_err_t err = esp_partition_mmap(partition, 0, header.size, ESP_PARTITION_MMAP_DATA, &data, &pack_handle);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to map the partition: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    if (!check_pack(&header, data))
+    {
+        esp_partition_munmap(pack_handle);
+        return false;
+    }
+
+    pack = data;
+    ESP_LOGI(TAG, "%d assets, %" PRIu32 " bytes mapped", header.entry_cnt, header.size);
+    return true;
+}
+
+void assets_deinit(void)
+{
+    if (pack != NULL)
+    {
+        esp_partition_munmap(pack_handle);
+        pack = NULL;
+    }
+}
+
+const void* assets_get(const char* name, asset_type_t type, size_t* size)
+{
+    if (pack == NULL)
+    {
+        return NULL;
+    }
+
+    /*Only a handful of assets, no need for anything faster*/
+    const assets_header_t* header = (const assets_header_t*)pack;
+    const assets_entry_t* entries = (const assets_entry_t*)(pack + sizeof(assets_header_t));
+
+    for (int i = 0; i < header->entry_cnt; i++)
+    {
+        if (entries[i].type == type && strcmp(entries[i].name, name) == 0)
+        {
+            if (size != NULL)
+            {
+                *size = entries[i].size;
+            }
+            return pack + entries[i].offset;
+        }
+    }
+
+    ESP_LOGW(TAG, "No asset \"%s\" of type %d", name, type);
+    return NULL;
+}
+
+bool assets_get_image(const char* name, lv_img_dsc_t* dsc)
+{
+    size_t size;
+    const uint8_t* data = assets_get(name, ASSET_TYPE_IMAGE, &size);
+    if (data == NULL || size < sizeof(lv_img_header_t))
+    {
+        return false;
+    }
+
+    memset(dsc, 0, sizeof(*dsc));
+    memcpy(&dsc->header, data, sizeof(lv_img_header_t));
+    dsc->data = data + sizeof(lv_img_header_t);
+    dsc->data_size = size - sizeof(lv_img_header_t);
+    return true;
+}
+
+lv_font_t* assets_ttf_create(const char* name, lv_coord_t font_size, size_t cache_size)
+{
+    size_t size;
+    const void* data = assets_get(name, ASSET_TYPE_TTF, &size);
+    if (data == NULL)
+    {
+        return NULL;
+    }
+
+    return lv_tiny_ttf_create_data_ex(data, size, font_size, cache_size);
+}
@@ -0,0 +1,171 @@
+#include "dlog.h"
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#define DLOG_TASK_STACK_SIZE    3072
+#define DLOG_TASK_PRIORITY      1 // Below everything which does real work
+
+_Static_assert((DLOG_RING_LENGTH & (DLOG_RING_LENGTH - 1)) == 0, "DLOG_RING_LENGTH must be a power of two");
+
+/*A bounded queue for many writers and readers: a writer claims a position with a CAS on write_pos, fills the slot and
+then publishes it through the sequence of the slot, readers do the same with read_pos.
+The sequence is stored minus the index of the slot, so the zeroed ring is ready before dlog_init()*/
+typedef struct
+{
+    uint32_t sequence;
+    dlog_record_t record;
+} slot_t;
+
+static slot_t ring[DLOG_RING_LENGTH];
+static uint32_t write_pos = 0;
+static uint32_t read_pos = 0;
+static uint32_t dropped_cnt = 0;
+
+IRAM_ATTR void dlog_write(uint8_t level, const char* tag, const char* format, const uint32_t* args, int arg_cnt)
+{
+    /*Only pointers and integers are copied, nothing is dereferenced, so it also works while the flash cache is off*/
+    uint32_t pos = __atomic_load_n(&write_pos, __ATOMIC_RELAXED);
+    slot_t* slot;
+
+    while (1)
+    {
+        slot = &ring[pos % DLOG_RING_LENGTH];
+        uint32_t sequence = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) + pos % DLOG_RING_LENGTH;
+        int32_t diff = (int32_t)(sequence - pos);
+
+        if (diff == 0)
+        {
+            if (__atomic_compare_exchange_n(&write_pos, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break; // The slot is ours
+            }
+        }
+        else if (diff < 0)
+        {
+            __atomic_fetch_add(&dropped_cnt, 1, __ATOMIC_RELAXED); // Full, the reader is behind
+            return;
+        }
+        else
+        {
+            pos = __atomic_load_n(&write_pos, __ATOMIC_RELAXED); // Another writer took it
+        }
+    }
+
+    dlog_record_t* record = &slot->record;
+    record->timestamp_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    record->tag = tag;
+    record->format = format;
+    record->level = level;
+    record->arg_cnt = arg_cnt;
+    for (int i = 0; i < arg_cnt; i++)
+    {
+        record->args[i] = args[i];
+    }
+
+    __atomic_store_n(&slot->sequence, pos + 1 - pos % DLOG_RING_LENGTH, __ATOMIC_RELEASE);
+}
+
+bool dlog_read(dlog_record_t* record)
+{
+    uint32_t pos = __atomic_load_n(&read_pos, __ATOMIC_RELAXED);
+    slot_t* slot;
+
+    while (1)
+    {
+        slot = &ring[pos % DLOG_RING_LENGTH];
+        uint32_t sequence = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) + pos % DLOG_RING_LENGTH;
+        int32_t diff = (int32_t)(sequence - (pos + 1));
+
+        if (diff == 0)
+        {
+            if (__atomic_compare_exchange_n(&read_pos, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            return false; // Empty, or the next record is still being written
+        }
+        else
+        {
+            pos = __atomic_load_n(&read_pos, __ATOMIC_RELAXED);
+        }
+    }
+
+    *record = slot->record;
+    __atomic_store_n(&slot->sequence, pos + DLOG_RING_LENGTH - pos % DLOG_RING_LENGTH, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+uint32_t dlog_get_dropped_cnt(void)
+{
+    return __atomic_load_n(&dropped_cnt, __ATOMIC_RELAXED);
+}
+
+#if DLOG_FORMAT_IN_TASK
+static const char TAG[] = "dlog";
+static TaskHandle_t dlog_task_handle = NULL;
+
+static void print_record(const dlog_record_t* record)
+{
+    static const char LEVEL_LETTERS[] = "NEWIDV";
+    char message[DLOG_LINE_LENGTH];
+
+    /*The unused arguments are ignored by snprintf()*/
+    snprintf(message, sizeof(message), record->format, record->args[0], record->args[1], record->args[2],
+             record->args[3]);
+    esp_log_write((esp_log_level_t)record->level, record->tag, "%c (%" PRIu32 ") %s: %s\n",
+                  LEVEL_LETTERS[record->level], record->timestamp_ms, record->tag, message);
+}
+
+static void dlog_task(void* arg)
+{
+    TickType_t last_wake = xTaskGetTickCount();
+    uint32_t reported_dropped_cnt = 0;
+
+    while (1)
+    {
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(DLOG_FLUSH_PERIOD_MS));
+
+        dlog_record_t record;
+        while (dlog_read(&record))
+        {
+            print_record(&record);
+        }
+
+        uint32_t dropped = dlog_get_dropped_cnt();
+        if (dropped != reported_dropped_cnt)
+        {
+            ESP_LOGW(TAG, "%" PRIu32 " records dropped, the ring is too short", dropped - reported_dropped_cnt);
+            reported_dropped_cnt = dropped;
+        }
+    }
+}
+#endif
+
+bool dlog_init(void)
+{
+    #if DLOG_FORMAT_IN_TASK
+    if (dlog_task_handle != NULL)
+    {
+        return true; // Already initialized
+    }
+
+    if (xTaskCreate(dlog_task, "dlog", DLOG_TASK_STACK_SIZE, NULL, DLOG_TASK_PRIORITY, &dlog_task_handle) != pdPASS)
+    {
+        ESP_LOGE(TAG, "Failed to create the log task!");
+        dlog_task_handle = NULL;
+        return false;
+    }
+    #endif
+
+    return true;
+}
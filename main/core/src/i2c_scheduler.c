@@ -0,0 +1,351 @@
+#include "i2c_scheduler.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#define I2C_SCHED_TASK_STACK_SIZE   3072
+#define I2C_SCHED_TASK_PRIORITY     6 // Above every task using the bus, it spends most of its time waiting for the bus
+
+typedef struct
+{
+    i2c_sched_transaction_t transaction;
+    int64_t deadline_us;    // 0 for no deadline
+    uint32_t sequence;      // Order of submission
+    bool used;
+} slot_t;
+
+/*A task waiting in i2c_sched_transfer()*/
+typedef struct
+{
+    SemaphoreHandle_t done;
+    int remaining;          // Only touched by the scheduler task once the transactions are queued
+    esp_err_t result;
+    bool used;
+} waiter_t;
+
+static const char TAG[] = "i2c_scheduler";
+
+static TaskHandle_t scheduler_task_handle = NULL;
+static SemaphoreHandle_t lock = NULL; // Guards the slots and the waiters
+static slot_t slots[I2C_SCHED_QUEUE_LENGTH];
+static int used_slot_cnt = 0;
+static uint32_t next_sequence = 0;
+
+static waiter_t waiters[I2C_SCHED_WAITERS_MAX];
+static SemaphoreHandle_t free_waiters = NULL; // Counts the unused waiters
+
+static bool is_more_urgent(const slot_t* a, const slot_t* b)
+{
+    if (a->transaction.priority != b->transaction.priority)
+    {
+        return a->transaction.priority < b->transaction.priority;
+    }
+
+    if (a->deadline_us != b->deadline_us)
+    {
+        /*Any deadline comes before no deadline*/
+        if (a->deadline_us == 0 || b->deadline_us == 0)
+        {
+            return b->deadline_us == 0;
+        }
+        return a->deadline_us < b->deadline_us;
+    }
+
+    return (int32_t)(a->sequence - b->sequence) < 0; // The sequence wraps around
+}
+
+static bool take_next(i2c_master_dev_handle_t last_dev, int batch_cnt, i2c_sched_transaction_t* next, bool* expired)
+{
+    /*Remove the next transaction to run from the slots. Return false if there is none*/
+    int64_t now_us = esp_timer_get_time();
+    slot_t* best = NULL;
+    slot_t* same_dev = NULL; // The oldest transaction of the device which used the bus last
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for (int i = 0; i < I2C_SCHED_QUEUE_LENGTH; i++)
+    {
+        slot_t* slot = &slots[i];
+        if (!slot->used)
+        {
+            continue;
+        }
+
+        /*Transactions which missed their deadline are completed right away, they must not hold up the rest*/
+        if (slot->deadline_us != 0 && now_us > slot->deadline_us)
+        {
+            best = slot;
+            break;
+        }
+
+        if (best == NULL || is_more_urgent(slot, best))
+        {
+            best = slot;
+        }
+
+        if (slot->transaction.dev == last_dev &&
+            (same_dev == NULL || (int32_t)(slot->sequence - same_dev->sequence) < 0))
+        {
+            same_dev = slot;
+        }
+    }
+
+    if (best != NULL)
+    {
+        *expired = best->deadline_us != 0 && now_us > best->deadline_us;
+
+        /*Stay on the same device as long as nothing with a higher priority waits*/
+        if (!*expired && same_dev != NULL && batch_cnt < I2C_SCHED_BATCH_MAX &&
+            same_dev->transaction.priority <= best->transaction.priority)
+        {
+            best = same_dev;
+        }
+
+        *next = best->transaction;
+        best->used = false;
+        used_slot_cnt--;
+    }
+    xSemaphoreGive(lock);
+
+    return best != NULL;
+}
+
+static esp_err_t run_transaction(const i2c_sched_transaction_t* transaction)
+{
+    if (transaction->read_size == 0)
+    {
+        return i2c_master_transmit(transaction->dev, transaction->write_buffer, transaction->write_size,
+                                   I2C_SCHED_TIMEOUT_MS);
+    }
+
+    if (transaction->write_size == 0)
+    {
+        return i2c_master_receive(transaction->dev, transaction->read_buffer, transaction->read_size,
+                                  I2C_SCHED_TIMEOUT_MS);
+    }
+
+    return i2c_master_transmit_receive(transaction->dev, transaction->write_buffer, transaction->write_size,
+                                       transaction->read_buffer, transaction->read_size, I2C_SCHED_TIMEOUT_MS);
+}
+
+static void scheduler_task(void* arg)
+{
+    /*Owns the bus, runs the queued transactions one after the other and calls their callbacks*/
+    i2c_master_dev_handle_t last_dev = NULL;
+    int batch_cnt = 0; // Transactions in a row for last_dev
+
+    while (1)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY); // Wait for new transactions
+
+        i2c_sched_transaction_t transaction;
+        bool expired;
+        while (take_next(last_dev, batch_cnt, &transaction, &expired))
+        {
+            esp_err_t result = ESP_ERR_TIMEOUT;
+            if (!expired)
+            {
+                batch_cnt = transaction.dev == last_dev ? batch_cnt + 1 : 1;
+                last_dev = transaction.dev;
+                result = run_transaction(&transaction);
+            }
+
+            if (transaction.callback != NULL)
+            {
+                transaction.callback(result, transaction.arg);
+            }
+        }
+    }
+}
+
+static int get_slot_limit(const i2c_sched_transaction_t* transactions, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (transactions[i].priority == I2C_SCHED_PRIORITY_LOW)
+        {
+            return I2C_SCHED_LOW_PRIO_SLOTS;
+        }
+    }
+
+    return I2C_SCHED_QUEUE_LENGTH;
+}
+
+static void waiter_callback(esp_err_t result, void* arg)
+{
+    waiter_t* waiter = (waiter_t*)arg;
+
+    if (result != ESP_OK && waiter->result == ESP_OK)
+    {
+        waiter->result = result;
+    }
+
+    if (--waiter->remaining == 0)
+    {
+        xSemaphoreGive(waiter->done);
+    }
+}
+
+static esp_err_t queue_transactions(const i2c_sched_transaction_t* transactions, int count, waiter_t* waiter)
+{
+    /*The callbacks of the transactions are replaced by the one of the waiter if there is one*/
+    if (scheduler_task_handle == NULL)
+    {
+        ESP_LOGE(TAG, "i2c_sched_init() was not called");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (transactions == NULL || count <= 0 || count > get_slot_limit(transactions, count))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        const i2c_sched_transaction_t* transaction = &transactions[i];
+        if (transaction->dev == NULL || transaction->priority >= I2C_SCHED_PRIORITY_CNT ||
+            (transaction->write_size == 0 && transaction->read_size == 0) ||
+            (transaction->write_size > 0 && transaction->write_buffer == NULL) ||
+            (transaction->read_size > 0 && transaction->read_buffer == NULL))
+        {
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+
+    int64_t now_us = esp_timer_get_time();
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    if (used_slot_cnt + count > get_slot_limit(transactions, count))
+    {
+        xSemaphoreGive(lock);
+        return ESP_ERR_NO_MEM;
+    }
+
+    int queued_cnt = 0;
+    for (int i = 0; i < I2C_SCHED_QUEUE_LENGTH && queued_cnt < count; i++)
+    {
+        slot_t* slot = &slots[i];
+        if (slot->used)
+        {
+            continue;
+        }
+
+        const i2c_sched_transaction_t* transaction = &transactions[queued_cnt++];
+        slot->transaction = *transaction;
+        if (waiter != NULL)
+        {
+            slot->transaction.callback = waiter_callback;
+            slot->transaction.arg = waiter;
+        }
+        slot->deadline_us = transaction->deadline_ms != 0 ? now_us + (int64_t)transaction->deadline_ms * 1000 : 0;
+        slot->sequence = next_sequence++;
+        slot->used = true;
+    }
+    used_slot_cnt += count;
+    xSemaphoreGive(lock);
+
+    xTaskNotifyGive(scheduler_task_handle);
+    return ESP_OK;
+}
+
+bool i2c_sched_init(void)
+{
+    if (scheduler_task_handle != NULL)
+    {
+        return true; // Already initialized
+    }
+
+    lock = xSemaphoreCreateMutex();
+    free_waiters = xSemaphoreCreateCounting(I2C_SCHED_WAITERS_MAX, I2C_SCHED_WAITERS_MAX);
+    if (lock == NULL || free_waiters == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create the locks!");
+        return false;
+    }
+
+    for (int i = 0; i < I2C_SCHED_WAITERS_MAX; i++)
+    {
+        waiters[i].done = xSemaphoreCreateBinary();
+        if (waiters[i].done == NULL)
+        {
+            ESP_LOGE(TAG, "Failed to create the waiters!");
+            return false;
+        }
+    }
+
+    if (xTaskCreate(scheduler_task, "i2c_scheduler", I2C_SCHED_TASK_STACK_SIZE, NULL, I2C_SCHED_TASK_PRIORITY,
+                    &scheduler_task_handle) != pdPASS)
+    {
+        ESP_LOGE(TAG, "Failed to create the scheduler task!");
+        scheduler_task_handle = NULL;
+        return false;
+    }
+
+    return true;
+}
+
+esp_err_t i2c_sched_submit(const i2c_sched_transaction_t* transactions, int count)
+{
+    return queue_transactions(transactions, count, NULL);
+}
+
+esp_err_t i2c_sched_transfer(const i2c_sched_transaction_t* transactions, int count)
+{
+    if (scheduler_task_handle == NULL)
+    {
+        ESP_LOGE(TAG, "i2c_sched_init() was not called");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(free_waiters, portMAX_DELAY);
+    xSemaphoreTake(lock, portMAX_DELAY);
+    waiter_t* waiter = &waiters[0];
+    while (waiter->used)
+    {
+        waiter++; // One is free, the semaphore counts them
+    }
+    waiter->used = true;
+    waiter->remaining = count;
+    waiter->result = ESP_OK;
+    xSemaphoreGive(lock);
+
+    /*The slots free up as the scheduler works through them*/
+    esp_err_t err;
+    while ((err = queue_transactions(transactions, count, waiter)) == ESP_ERR_NO_MEM)
+    {
+        vTaskDelay(1);
+    }
+
+    if (err == ESP_OK)
+    {
+        xSemaphoreTake(waiter->done, portMAX_DELAY);
+        err = waiter->result;
+    }
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    waiter->used = false;
+    xSemaphoreGive(lock);
+    xSemaphoreGive(free_waiters);
+
+    return err;
+}
+
+esp_err_t i2c_sched_transmit_receive(i2c_master_dev_handle_t dev, const uint8_t* write_buffer, size_t write_size,
+                                     uint8_t* read_buffer, size_t read_size, i2c_sched_priority_t priority,
+                                     uint32_t deadline_ms)
+{
+    i2c_sched_transaction_t transaction =
+    {
+        .dev = dev,
+        .write_buffer = write_buffer,
+        .write_size = write_size,
+        .read_buffer = read_buffer,
+        .read_size = read_size,
+        .priority = priority,
+        .deadline_ms = deadline_ms,
+    };
+
+    return i2c_sched_transfer(&transaction, 1);
+}
@@ -0,0 +1,220 @@
+#include "metrics.h"
+
+#if METRICS_ENABLED
+
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_system.h"
+#include "esp_log.h"
+
+#if METRICS_UART_NUM >= 0
+#include "driver/uart.h"
+#endif
+
+#define METRICS_TASK_STACK_SIZE     3072
+#define METRICS_TASK_PRIORITY       1 // Below everything which does real work
+
+static const char TAG[] = "metrics";
+
+uint32_t metrics_counters[METRIC_COUNTER_CNT];
+static int32_t gauges[METRIC_GAUGE_CNT];
+static metrics_histogram_values_t histograms[METRIC_HISTOGRAM_CNT];
+
+static SemaphoreHandle_t ring_lock = NULL;
+static metrics_record_t ring[METRICS_RING_LENGTH];
+static int ring_start = 0; // Oldest record
+static int ring_count = 0;
+
+/*The display callbacks of the port, called from ours*/
+static void (*port_flush_cb)(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_map);
+static void (*port_render_start_cb)(lv_disp_drv_t* drv);
+static void (*port_monitor_cb)(lv_disp_drv_t* drv, uint32_t time, uint32_t px);
+static int64_t render_start_us;
+
+void metrics_gauge_set(metric_gauge_t id, int32_t value)
+{
+    __atomic_store_n(&gauges[id], value, __ATOMIC_RELAXED);
+}
+
+void metrics_histogram_add(metric_histogram_t id, uint32_t value)
+{
+    /*The bucket is the number of significant bits, so no search is needed*/
+    int bucket = value == 0 ? 0 : 32 - __builtin_clz(value);
+    if (bucket >= METRICS_HISTOGRAM_BUCKETS)
+    {
+        bucket = METRICS_HISTOGRAM_BUCKETS - 1;
+    }
+
+    metrics_histogram_values_t* histogram = &histograms[id];
+    __atomic_fetch_add(&histogram->count, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&histogram->buckets[bucket], 1, __ATOMIC_RELAXED);
+
+    uint32_t sum = __atomic_load_n(&histogram->sum, __ATOMIC_RELAXED);
+    uint32_t new_sum;
+    do
+    {
+        new_sum = sum > UINT32_MAX - value ? UINT32_MAX : sum + value;
+    } while (!__atomic_compare_exchange_n(&histogram->sum, &sum, new_sum, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+static void flush_callback(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_map)
+{
+    metrics_counter_add(METRIC_FLUSH_AREAS, 1);
+    metrics_counter_add(METRIC_FLUSH_PIXELS, lv_area_get_size(area));
+    port_flush_cb(drv, area, color_map);
+}
+
+static void render_start_callback(lv_disp_drv_t* drv)
+{
+    render_start_us = esp_timer_get_time();
+    if (port_render_start_cb != NULL)
+    {
+        port_render_start_cb(drv);
+    }
+}
+
+static void monitor_callback(lv_disp_drv_t* drv, uint32_t time, uint32_t px)
+{
+    /*LVGL passes the time in ticks, too coarse for short frames*/
+    metrics_counter_add(METRIC_FRAMES, 1);
+    metrics_histogram_add(METRIC_FRAME_TIME_US, (uint32_t)(esp_timer_get_time() - render_start_us));
+    if (port_monitor_cb != NULL)
+    {
+        port_monitor_cb(drv, time, px);
+    }
+}
+
+void metrics_attach_display(lv_disp_t* disp)
+{
+    if (disp == NULL)
+    {
+        return;
+    }
+
+    /*Chain the callbacks, the port may use them too*/
+    lv_disp_drv_t* drv = disp->driver;
+    port_flush_cb = drv->flush_cb;
+    port_render_start_cb = drv->render_start_cb;
+    port_monitor_cb = drv->monitor_cb;
+
+    drv->flush_cb = flush_callback;
+    drv->render_start_cb = render_start_callback;
+    drv->monitor_cb = monitor_callback;
+}
+
+void metrics_read(metrics_record_t* record)
+{
+    record->magic = METRICS_RECORD_MAGIC;
+    record->version = METRICS_RECORD_VERSION;
+    record->sequence = 0;
+    record->timestamp_ms = (uint32_t)(esp_timer_get_time() / 1000);
+
+    for (int i = 0; i < METRIC_COUNTER_CNT; i++)
+    {
+        record->counters[i] = __atomic_load_n(&metrics_counters[i], __ATOMIC_RELAXED);
+    }
+
+    for (int i = 0; i < METRIC_GAUGE_CNT; i++)
+    {
+        record->gauges[i] = __atomic_load_n(&gauges[i], __ATOMIC_RELAXED);
+    }
+
+    /*The fields of a histogram may be updated while they are copied, the reader can live with that*/
+    for (int i = 0; i < METRIC_HISTOGRAM_CNT; i++)
+    {
+        record->histograms[i].count = __atomic_load_n(&histograms[i].count, __ATOMIC_RELAXED);
+        record->histograms[i].sum = __atomic_load_n(&histograms[i].sum, __ATOMIC_RELAXED);
+        for (int j = 0; j < METRICS_HISTOGRAM_BUCKETS; j++)
+        {
+            record->histograms[i].buckets[j] = __atomic_load_n(&histograms[i].buckets[j], __ATOMIC_RELAXED);
+        }
+    }
+}
+
+static void metrics_task(void* arg)
+{
+    TickType_t last_wake = xTaskGetTickCount();
+
+    while (1)
+    {
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(METRICS_DUMP_PERIOD_MS));
+
+        metrics_gauge_set(METRIC_HEAP_FREE, (int32_t)esp_get_free_heap_size());
+        metrics_gauge_set(METRIC_HEAP_MIN_FREE, (int32_t)esp_get_minimum_free_heap_size());
+
+        xSemaphoreTake(ring_lock, portMAX_DELAY);
+        metrics_record_t* record;
+        if (ring_count < METRICS_RING_LENGTH)
+        {
+            record = &ring[(ring_start + ring_count) % METRICS_RING_LENGTH];
+            ring_count++;
+        }
+        else
+        {
+            record = &ring[ring_start]; // Overwrite the oldest
+            ring_start = (ring_start + 1) % METRICS_RING_LENGTH;
+        }
+        static uint8_t sequence = 0;
+        metrics_read(record);
+        record->sequence = sequence++;
+
+        #if METRICS_UART_NUM >= 0
+        uart_write_bytes(METRICS_UART_NUM, record, sizeof(metrics_record_t));
+        #endif
+        xSemaphoreGive(ring_lock);
+    }
+}
+
+bool metrics_init(void)
+{
+    if (ring_lock != NULL)
+    {
+        return true; // Already initialized
+    }
+
+    ring_lock = xSemaphoreCreateMutex();
+    if (ring_lock == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create the ring lock!");
+        return false;
+    }
+
+    #if METRICS_UART_NUM >= 0
+    if (uart_driver_install(METRICS_UART_NUM, 256, sizeof(metrics_record_t) * 2, 0, NULL, 0) != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to install the UART driver!");
+    }
+    #endif
+
+    if (xTaskCreate(metrics_task, "metrics", METRICS_TASK_STACK_SIZE, NULL, METRICS_TASK_PRIORITY, NULL) != pdPASS)
+    {
+        ESP_LOGE(TAG, "Failed to create the metrics task!");
+        return false;
+    }
+
+    return true;
+}
+
+int metrics_ring_read(metrics_record_t* records, int max_cnt)
+{
+    if (ring_lock == NULL)
+    {
+        return 0;
+    }
+
+    xSemaphoreTake(ring_lock, portMAX_DELAY);
+    int count = ring_count < max_cnt ? ring_count : max_cnt;
+    int first = ring_start + ring_count - count; // The newest ones if not all fit
+    for (int i = 0; i < count; i++)
+    {
+        records[i] = ring[(first + i) % METRICS_RING_LENGTH];
+    }
+    xSemaphoreGive(ring_lock);
+
+    return count;
+}
+
+#endif // METRICS_ENABLED
@@ -11,6 +11,9 @@
 #include "config.h"
 #include "setup.h"
 #include "widget_manager.h"
+#include "ui_commands.h"
+#include "metrics.h"
+#include "i2c_scheduler.h"
 
 #include "lvgl.h"
 #include "esp_lvgl_port.h"
@@ -128,6 +131,12 @@ void setup_i2c_master(i2c_master_bus_handle_t* bus_handle)
     i2c_master_conf.flags.enable_internal_pullup = true;
     
     ESP_ERROR_CHECK(i2c_new_master_bus(&i2c_master_conf, bus_handle));
+
+    /*The drivers queue their transactions, so a clock read doesn't wait for a whole PPG fifo drain*/
+    if (!i2c_sched_init())
+    {
+        ESP_LOGE(TAG, "Failed to start the i2c scheduler!");
+    }
 }
 
 void setup_display_spi_bus()
@@ -232,7 +241,7 @@ void setup_display()
 
     lv_init(); // Initialize lvgl library
 
-    lvgl_port_add_disp(&display_port_config);
+    lv_disp_t* disp = lvgl_port_add_disp(&display_port_config);
     
     /*Create encoder driver to handle inputs*/
     static lv_indev_drv_t encoder_driver;
@@ -240,7 +249,15 @@ void setup_display()
     encoder_driver.type = LV_INDEV_TYPE_ENCODER;
     encoder_driver.read_cb = encoder_event_callback;
     lv_indev_drv_register(&encoder_driver);
-    
+
+    /*Other tasks update the ui through the command queue instead of calling lvgl directly*/
+    lvgl_port_lock(0);
+    if (!ui_cmd_init())
+    {
+        ESP_LOGE(TAG, "Failed to initialize the ui command queue!");
+    }
+    METRICS_ATTACH_DISPLAY(disp);
+    lvgl_port_unlock();
 
     setup_lcd_ledc(); // Setup for the lcd led
 }
@@ -0,0 +1,197 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ui_commands.h"
+#include "metrics.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "esp_log.h"
+
+#include "lvgl.h"
+
+static const char TAG[] = "ui_commands";
+
+static QueueHandle_t ui_cmd_queue = NULL;
+
+/*Calls taken from the queue by ui_cmd_flush_objects(). They are kept here instead of being queued again, where a
+producer could take their slot, and the next ui_cmd_flush() applies them first*/
+static ui_cmd_t deferred_calls[UI_CMD_QUEUE_LENGTH];
+static int deferred_call_cnt = 0;
+
+static void apply_command(const ui_cmd_t* cmd)
+{
+    switch (cmd->type)
+    {
+    case UI_CMD_SET_TEXT:
+        /*Setting the same text would still invalidate the label, so skip it to avoid redundant redraws*/
+        if (strcmp(lv_label_get_text(cmd->target), cmd->data.text) != 0)
+        {
+            lv_label_set_text(cmd->target, cmd->data.text);
+        }
+        break;
+
+    case UI_CMD_CALL:
+        cmd->data.call.callback(cmd->data.call.arg);
+        break;
+
+    default:
+        ESP_LOGW(TAG, "Unknown command type: %d", cmd->type);
+        break;
+    }
+}
+
+static void ui_cmd_timer_cb(lv_timer_t* timer)
+{
+    /*Runs in the LVGL task, so the commands can safely touch LVGL objects*/
+    ui_cmd_flush();
+}
+
+static bool send_command(const ui_cmd_t* cmd)
+{
+    if (ui_cmd_queue == NULL)
+    {
+        ESP_LOGE(TAG, "ui_cmd_init() was not called");
+        return false;
+    }
+
+    if (xQueueSend(ui_cmd_queue, cmd, 0) != pdTRUE)
+    {
+        ESP_LOGW(TAG, "Command queue is full, dropping command");
+        METRICS_COUNTER_ADD(METRIC_UI_CMDS_DROPPED, 1);
+        return false;
+    }
+
+    return true;
+}
+
+bool ui_cmd_init(void)
+{
+    if (ui_cmd_queue != NULL)
+    {
+        return true; // Already initialized
+    }
+
+    ui_cmd_queue = xQueueCreate(UI_CMD_QUEUE_LENGTH, sizeof(ui_cmd_t));
+    if (ui_cmd_queue == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create the command queue!");
+        return false;
+    }
+
+    if (lv_timer_create(ui_cmd_timer_cb, UI_CMD_PERIOD_MS, NULL) == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create the command timer!");
+        vQueueDelete(ui_cmd_queue);
+        ui_cmd_queue = NULL;
+        return false;
+    }
+
+    return true;
+}
+
+static void defer_call(const ui_cmd_t* cmd)
+{
+    if (deferred_call_cnt == UI_CMD_QUEUE_LENGTH)
+    {
+        ESP_LOGW(TAG, "Too many deferred calls, dropping command");
+        METRICS_COUNTER_ADD(METRIC_UI_CMDS_DROPPED, 1);
+        return;
+    }
+
+    deferred_calls[deferred_call_cnt++] = *cmd;
+}
+
+static void apply_deferred_calls(void)
+{
+    /*Take them one by one, as a call may defer other calls while it runs*/
+    while (deferred_call_cnt > 0)
+    {
+        ui_cmd_t cmd = deferred_calls[0];
+        deferred_call_cnt--;
+        memmove(&deferred_calls[0], &deferred_calls[1], deferred_call_cnt * sizeof(ui_cmd_t));
+
+        apply_command(&cmd);
+        METRICS_COUNTER_ADD(METRIC_UI_CMDS, 1);
+    }
+}
+
+static void flush_commands(bool apply_calls)
+{
+    /*Only the commands already in the queue are applied to keep the time spent here bounded*/
+    if (ui_cmd_queue == NULL)
+    {
+        return;
+    }
+
+    if (apply_calls)
+    {
+        apply_deferred_calls(); // They were queued before the commands still waiting
+    }
+
+    ui_cmd_t cmd;
+    UBaseType_t waiting = uxQueueMessagesWaiting(ui_cmd_queue);
+    METRICS_GAUGE_SET(METRIC_UI_CMD_QUEUE_DEPTH, (int32_t)waiting);
+
+    while (waiting-- > 0 && xQueueReceive(ui_cmd_queue, &cmd, 0) == pdTRUE)
+    {
+        /*A call applied here may have deferred the calls behind it, so the later ones wait for them*/
+        if (cmd.type == UI_CMD_CALL && (!apply_calls || deferred_call_cnt > 0))
+        {
+            defer_call(&cmd);
+            continue;
+        }
+
+        apply_command(&cmd);
+        METRICS_COUNTER_ADD(METRIC_UI_CMDS, 1);
+    }
+}
+
+void ui_cmd_flush(void)
+{
+    flush_commands(true);
+}
+
+void ui_cmd_flush_objects(void)
+{
+    flush_commands(false);
+}
+
+bool ui_cmd_set_text(lv_obj_t* label, const char* text)
+{
+    ui_cmd_t cmd = {.type = UI_CMD_SET_TEXT, .target = label};
+
+    size_t length = strlen(text);
+    if (length >= UI_CMD_TEXT_MAX_LENGTH)
+    {
+        ESP_LOGW(TAG, "Text is too long, truncating it to %d characters", UI_CMD_TEXT_MAX_LENGTH - 1);
+        length = UI_CMD_TEXT_MAX_LENGTH - 1;
+    }
+    memcpy(cmd.data.text, text, length);
+    cmd.data.text[length] = '\0';
+
+    return send_command(&cmd);
+}
+
+bool ui_cmd_set_text_fmt(lv_obj_t* label, const char* fmt, ...)
+{
+    /*Format in the caller's task so the LVGL task only copies the finished text*/
+    ui_cmd_t cmd = {.type = UI_CMD_SET_TEXT, .target = label};
+
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(cmd.data.text, UI_CMD_TEXT_MAX_LENGTH, fmt, args);
+    va_end(args);
+
+    return send_command(&cmd);
+}
+
+bool ui_cmd_call(ui_cmd_callback_t callback, void* arg)
+{
+    ui_cmd_t cmd = {.type = UI_CMD_CALL, .target = NULL};
+    cmd.data.call.callback = callback;
+    cmd.data.call.arg = arg;
+
+    return send_command(&cmd);
+}
@@ -1,5 +1,8 @@
+#include <stdint.h>
+
 #include "widget_manager.h"
 #include "input_event_types.h"
+#include "ui_commands.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
@@ -9,9 +12,159 @@
 
 // #define CHECK_TASK_SIZES
 
+#define NO_ACTIVE_WIDGET    -1
+
+static const char TAG[] = "widget_manager";
+
+typedef struct
+{
+    widget_t widget;
+    lv_obj_t* screen; // NULL until the first activation or after the widget was destroyed
+} widget_entry_t;
+
+static widget_entry_t widgets[WIDGET_MANAGER_MAX_WIDGETS];
+static int widget_count = 0;
+static volatile int active_widget = NO_ACTIVE_WIDGET; // Written in the LVGL task, read by the input task
+static bool is_switching = false; // Set while activate_widget() runs, callbacks of the widgets must not switch
+
 static int16_t encoder_difference = 0;
 static bool is_button_pressed = 0;
 
+static bool create_widget(widget_entry_t* entry)
+{
+    /*Create the objects of a widget on its own screen*/
+    entry->screen = lv_obj_create(NULL);
+    if (entry->screen == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create the screen of %s!", entry->widget.name);
+        return false;
+    }
+
+    if (!entry->widget.init(entry->widget.ctx, entry->screen))
+    {
+        ESP_LOGE(TAG, "Failed to initialize %s!", entry->widget.name);
+        lv_obj_del(entry->screen);
+        entry->screen = NULL;
+        return false;
+    }
+
+    return true;
+}
+
+static void destroy_widget(widget_entry_t* entry)
+{
+    if (entry->screen == NULL)
+    {
+        return; // Already destroyed
+    }
+
+    /*Commands waiting in the queue may target the objects, so apply them while they still exist. Calls are left in
+    the queue as a queued switch would re-enter activate_widget()*/
+    ui_cmd_flush_objects();
+
+    lv_obj_del(entry->screen);
+    entry->screen = NULL;
+    entry->widget.destroy(entry->widget.ctx);
+}
+
+static void activate_widget(int index)
+{
+    /*Suspend the active widget and show the one at index. Runs in the LVGL task*/
+    if (is_switching)
+    {
+        ESP_LOGW(TAG, "Already switching widgets, ignoring the switch to %s", widgets[index].widget.name);
+        return;
+    }
+
+    widget_entry_t* next = &widgets[index];
+
+    if (next->screen == NULL && !create_widget(next))
+    {
+        return; // Stay on the current widget
+    }
+
+    is_switching = true;
+
+    if (active_widget != NO_ACTIVE_WIDGET)
+    {
+        widget_entry_t* prev = &widgets[active_widget];
+        prev->widget.suspend(prev->widget.ctx);
+
+        /*Load the new screen first as the active screen can't be deleted*/
+        lv_scr_load(next->screen);
+        if (!prev->widget.keep_tree)
+        {
+            destroy_widget(prev);
+        }
+    }
+
+    else
+    {
+        lv_scr_load(next->screen);
+    }
+
+    active_widget = index;
+    next->widget.activate(next->widget.ctx);
+    is_switching = false;
+    ESP_LOGI(TAG, "Switched to %s", next->widget.name);
+}
+
+static void switch_widget_cb(void* step)
+{
+    /*Called through the ui command queue, so the input task doesn't need the lvgl mutex*/
+    widget_manager_switch((int)(intptr_t)step);
+}
+
+static bool active_widget_uses_encoder(void)
+{
+    int index = active_widget;
+    return index != NO_ACTIVE_WIDGET && widgets[index].widget.uses_encoder;
+}
+
+bool widget_manager_register(const widget_t* widget)
+{
+    if (widget == NULL || widget_count >= WIDGET_MANAGER_MAX_WIDGETS)
+    {
+        ESP_LOGE(TAG, "Failed to register widget!");
+        return false;
+    }
+
+    widgets[widget_count].widget = *widget;
+    widgets[widget_count].screen = NULL;
+    widget_count++;
+
+    return true;
+}
+
+void widget_manager_start(void)
+{
+    if (widget_count == 0)
+    {
+        ESP_LOGW(TAG, "No widgets registered");
+        return;
+    }
+
+    lvgl_port_lock(0);
+    activate_widget(0);
+    lvgl_port_unlock();
+}
+
+void widget_manager_switch(int step)
+{
+    if (widget_count == 0)
+    {
+        return;
+    }
+
+    int current = active_widget == NO_ACTIVE_WIDGET ? 0 : active_widget;
+    int index = ((current + step) % widget_count + widget_count) % widget_count; // Wrap around in both directions
+
+    if (index != active_widget)
+    {
+        activate_widget(index);
+    }
+}
+
 void encoder_event_callback(lv_indev_drv_t* indev_drv, lv_indev_data_t* data)
 {
     if (encoder_difference != 0)
@@ -36,11 +189,31 @@ void input_events_handler_task(void* queue_ptr)
             switch (event)
             {
             case SCROLL_LEFT_EVENT:
-                encoder_difference--;
+                if (active_widget_uses_encoder())
+                {
+                    encoder_difference--;
+                }
+
+                else
+                {
+                    ui_cmd_call(switch_widget_cb, (void*)(intptr_t)-1); // Previous widget
+                }
                 break;
 
             case SCROLL_RIGHT_EVENT:
-                encoder_difference++;
+                if (active_widget_uses_encoder())
+                {
+                    encoder_difference++;
+                }
+
+                else
+                {
+                    ui_cmd_call(switch_widget_cb, (void*)(intptr_t)1); // Next widget
+                }
+                break;
+
+            case LONG_PRESS_EVENT:
+                ui_cmd_call(switch_widget_cb, (void*)(intptr_t)1); // Next widget
                 break;
 
             case SHORT_PRESS_EVENT:
@@ -1,17 +1,34 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
+#include "esp_log.h"
 #include "input_event_types.h"
 
 #include "ds3231.h"
 #include "setup.h"
 #include "clock.h"
+#include "analog_face.h"
 #include "widget_manager.h"
+#include "metrics.h"
+#include "dlog.h"
+#include "assets.h"
 
 #include "max30102.h"
 
 void app_main(void)
 {
+    // First, so the setup is measured too
+    if (!METRICS_INIT())
+    {
+        ESP_LOGE("main", "Failed to start the metrics!");
+    }
+
+    // Prints what the drivers log from their hot paths
+    if (!dlog_init())
+    {
+        ESP_LOGE("main", "Failed to start the deferred log!");
+    }
+
     static QueueHandle_t input_event_queue;
     input_event_queue = xQueueCreate(10, sizeof(input_event_t)); // Queue for input events (used in input isrs and input event task
 
@@ -36,8 +53,16 @@ void app_main(void)
     TaskHandle_t input_events_handler_task_handle;
     xTaskCreatePinnedToCore(input_events_handler_task, "input_events_handler_task", 2048, &input_event_queue, 5, &input_events_handler_task_handle, 0);
 
-    TaskHandle_t task;
-    xTaskCreate(run_clock_widget, "clock", 4096, &ds3231_dev_handle, 3, &task);
+    // Fonts and images are used in place from the asset partition
+    if (!assets_init())
+    {
+        ESP_LOGE("main", "Failed to map the assets, the widgets fall back on the built-in font!");
+    }
+
+    // Widgets are created when they are first shown
+    widget_manager_register(clock_widget_create(&ds3231_dev_handle));
+    widget_manager_register(analog_face_widget_create(&ds3231_dev_handle));
+    widget_manager_start();
 
     max30102_cfg_t sensor_config =
     {
@@ -3,6 +3,8 @@
 #include "string.h"
 #include "esp_log.h"
 #include "time.h"
+#include "metrics.h"
+#include "i2c_scheduler.h"
 
 #define DS3231_I2C_ADDRESS          0x68
 
@@ -14,6 +16,9 @@
 #define MONTH_REGISTER_ADDRESS      0x05
 #define YEAR_REGISTER_ADDRESS       0x06
 
+#define TIME_REGISTER_CNT           7
+#define READ_DEADLINE_MS            100 // A later read would show a stale second anyway
+
 static const char* TAG = "ds3231";
 
 /*TODO:
@@ -122,6 +127,8 @@ static esp_err_t validate_time(struct tm *time_struct)
 esp_err_t ds3231_get_datetime(ds3231_handle_t *ds3231_handle, struct tm *time_struct)
 {
     /*Get the date and time information from the ds3231*/
+    METRICS_TIME_START(read_start_us);
+    METRICS_COUNTER_ADD(METRIC_RTC_READS, 1);
 
     struct tm reference_time; // Creating internal tm struct to validate the ds3231 internal clock before rewriting the passed struct
     bool century_overflow = false;
@@ -137,25 +144,38 @@ esp_err_t ds3231_get_datetime(ds3231_handle_t *ds3231_handle, struct tm *time_st
         &reference_time.tm_year,
     }; // Put all relevant struct pointers into an array for sequential iteration
 
-    uint8_t data_buffer; // Buffer to store returned time byte
-    uint8_t register_address; // Data buffer to be sent (contains the register address to be read from)
+    /*The ds3231 time registers are ordered by ascending values (starting from 0 for seconds) and the register pointer
+    auto-increments, so all of them are read in one burst. The registers are latched at the start of the read, so the
+    time can't roll over between them*/
+    static const uint8_t start_register = SECONDS_REGISTER_ADDRESS;
+    uint8_t data_buffer[TIME_REGISTER_CNT]; // Buffer to store returned time bytes
+
+    /*A high priority, so the read isn't queued behind the PPG sensor being drained*/
+    i2c_sched_transaction_t transaction =
+    {
+        .dev = ds3231_handle->dev_handle,
+        .write_buffer = &start_register,
+        .write_size = 1,
+        .read_buffer = data_buffer,
+        .read_size = TIME_REGISTER_CNT,
+        .priority = I2C_SCHED_PRIORITY_HIGH,
+        .deadline_ms = READ_DEADLINE_MS,
+    };
+
+    METRICS_COUNTER_ADD(METRIC_RTC_I2C_TRANSACTIONS, 1);
+    if (i2c_sched_transfer(&transaction, 1) != ESP_OK) // Get relevant register info
+    {
+        METRICS_COUNTER_ADD(METRIC_RTC_I2C_ERRORS, 1);
+        ESP_LOGE(TAG, "Couldn't connect to rtc!");
+        return ESP_ERR_TIMEOUT;
+    }
 
     int time_addresses_len = sizeof(time_addresses)/sizeof(time_addresses[0]); // Calculate the size of the array
 
     for (uint8_t i = 0; i < time_addresses_len; i++)
     {
-        register_address = i; // The ds3231 time registers are ordered by ascending values (starting from 0 for seconds)
-        
-        if (i2c_master_transmit_receive(ds3231_handle->dev_handle, &register_address, 1, &data_buffer, 1, -1) == ESP_OK) // Get relevant register info
-        {
-            if (i == MONTH_REGISTER_ADDRESS && (data_buffer >> 7) == 1){data_buffer -= 0b10000000; century_overflow=true;} // Adjust value to remove century-overflow data
-            *time_addresses[i] = (int)bcd_to_decimal(data_buffer); // The data is stored in a bcd so it needs to be converted to decimal 
-        }
-        else
-        {
-            ESP_LOGE(TAG, "Couldn't connect to rtc!");
-            return ESP_ERR_TIMEOUT;
-        }
+        if (i == MONTH_REGISTER_ADDRESS && (data_buffer[i] >> 7) == 1){data_buffer[i] -= 0b10000000; century_overflow=true;} // Adjust value to remove century-overflow data
+        *time_addresses[i] = (int)bcd_to_decimal(data_buffer[i]); // The data is stored in a bcd so it needs to be converted to decimal 
     }
     // Check if the century bit is high or low and assign the year value accordingly
     if (century_overflow)
@@ -177,6 +197,7 @@ esp_err_t ds3231_get_datetime(ds3231_handle_t *ds3231_handle, struct tm *time_st
     reference_time.tm_yday = time_struct->tm_yday;
 
     *time_struct = reference_time; // Override the original time struct
+    METRICS_TIME_END(METRIC_RTC_READ_TIME_US, read_start_us);
 
     return ESP_OK;
 }
@@ -220,14 +241,17 @@ esp_err_t ds3231_set_datetime(ds3231_handle_t *ds3231_handle, struct tm time_str
         time_struct.tm_wday += 1;
         time_struct.tm_mon += 1;
 
+        uint8_t buffers[TIME_REGISTER_CNT][2];
+        i2c_sched_transaction_t transactions[TIME_REGISTER_CNT];
         for (uint8_t i = 0; i < time_addresses_len; i++)
         {
-            uint8_t buffer[2] = {i, decimal_to_bcd(*time_addresses[i])}; // Convert time to bcd format
-            if (i == MONTH_REGISTER_ADDRESS && century_overflow) {buffer[1] += 0b10000000;} // Set month's 8th bit to 1 if there is a century overflow
-            i2c_master_transmit(dev_handle, buffer, 2, -1); // Set registers
+            buffers[i][0] = i;
+            buffers[i][1] = decimal_to_bcd(*time_addresses[i]); // Convert time to bcd format
+            if (i == MONTH_REGISTER_ADDRESS && century_overflow) {buffers[i][1] += 0b10000000;} // Set month's 8th bit to 1 if there is a century overflow
+            transactions[i] = (i2c_sched_transaction_t){.dev = dev_handle, .write_buffer = buffers[i], .write_size = 2, .priority = I2C_SCHED_PRIORITY_NORMAL};
         }
 
-        return ESP_OK;
+        return i2c_sched_transfer(transactions, time_addresses_len); // Set registers
 
     }
     else
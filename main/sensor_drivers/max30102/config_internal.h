@@ -3,6 +3,10 @@
 
 #define MAX30102_I2C_ADDR   0x57
 
+#ifndef MAX30102_LOG_LEVEL
+#define MAX30102_LOG_LEVEL  DLOG_LEVEL_WARN // DLOG_LEVEL_DEBUG adds register read-backs, DLOG_LEVEL_VERBOSE every sample
+#endif
+
 /*Interupt bit masks*/
 #define POWER_READY_INTR_MASK   (1 << 0) // Power ready after brownout
 #define DIE_TEMP_READY_MASK     (1 << 1) // Sensor temperature ready
@@ -2,6 +2,8 @@
 #include "config_internal.h"
 #include "max30102_types.h"
 
+#include <inttypes.h>
+
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
@@ -9,10 +11,11 @@
 #include "driver/gpio.h"
 #include "esp_log.h"
 #include "driver/i2c_master.h"
+#include "metrics.h"
+#include "i2c_scheduler.h"
 
-#define DEBUG_MODE
-
-#define byte_to_binary(num, buff)   for (int i = 0; i < 8; i++) { ((char*)buff)[i] = ((uint8_t)(~((~num << i) | 0b01111111)) == 0b10000000) ? '1' : '0';}
+#define DLOG_LOCAL_LEVEL    MAX30102_LOG_LEVEL
+#include "dlog.h"
 
 static const char* TAG = "max30102";
 
@@ -32,8 +35,13 @@ static void read_samples(i2c_master_dev_handle_t* dev_handle)
         const uint8_t WRITE_PTR_ADDR[1] = {WRITE_PTR_REG}; // Pointer of fifo sample being written
         uint8_t write_ptr[1];
 
-        ESP_ERROR_CHECK(i2c_master_transmit_receive(*dev_handle, WRITE_PTR_ADDR, 1, write_ptr, 1, -1));
-        ESP_ERROR_CHECK(i2c_master_transmit_receive(*dev_handle, READ_PTR_ADDR, 1, read_ptr, 1, -1));
+        /*Draining the fifo is bulk work, the scheduler lets the clock read in between*/
+        const i2c_sched_transaction_t ptr_transactions[] =
+        {
+            {.dev = *dev_handle, .write_buffer = WRITE_PTR_ADDR, .write_size = 1, .read_buffer = write_ptr, .read_size = 1, .priority = I2C_SCHED_PRIORITY_LOW},
+            {.dev = *dev_handle, .write_buffer = READ_PTR_ADDR, .write_size = 1, .read_buffer = read_ptr, .read_size = 1, .priority = I2C_SCHED_PRIORITY_LOW},
+        };
+        ESP_ERROR_CHECK(i2c_sched_transfer(ptr_transactions, 2));
         READ_PTR_ADDR[1] = read_ptr[0];
         transmit_buff[1] = (read_ptr[0] + 1) % 32; // Update the fifo pointer to read from
 
@@ -42,16 +50,22 @@ static void read_samples(i2c_master_dev_handle_t* dev_handle)
         {
             samples_to_read += 32;
         }
+        METRICS_COUNTER_ADD(METRIC_PPG_SAMPLES, samples_to_read);
+        METRICS_COUNTER_ADD(METRIC_PPG_I2C_TRANSACTIONS, 2 + 3 * samples_to_read); // The pointers, then 3 per sample
         
         uint8_t test[1];
         for (int i = 0; i < samples_to_read; i++)
         {
             /*Break down sample data into the red and ir led readings*/
             transmit_buff[1] = read_ptr[0];
-            ESP_ERROR_CHECK(i2c_master_transmit_receive(*dev_handle, transmit_buff, 2, data_buff, 6, -1));
-            ESP_ERROR_CHECK(i2c_master_transmit(*dev_handle, READ_PTR_ADDR, 2, -1));
-            ESP_ERROR_CHECK(i2c_master_transmit_receive(*dev_handle, READ_PTR_ADDR, 1, test, 1, -1));
-            ESP_LOGI(TAG, "%i", test[0]);
+            const i2c_sched_transaction_t sample_transactions[] =
+            {
+                {.dev = *dev_handle, .write_buffer = transmit_buff, .write_size = 2, .read_buffer = data_buff, .read_size = 6, .priority = I2C_SCHED_PRIORITY_LOW},
+                {.dev = *dev_handle, .write_buffer = READ_PTR_ADDR, .write_size = 2, .priority = I2C_SCHED_PRIORITY_LOW},
+                {.dev = *dev_handle, .write_buffer = READ_PTR_ADDR, .write_size = 1, .read_buffer = test, .read_size = 1, .priority = I2C_SCHED_PRIORITY_LOW},
+            };
+            ESP_ERROR_CHECK(i2c_sched_transfer(sample_transactions, 3)); // One wakeup per sample instead of three
+            DLOGV(TAG, "Read ptr after sample: %u", test[0]);
 
             read_ptr[0] = (read_ptr[0] + 1)%32;
             READ_PTR_ADDR[1] = read_ptr[0];
@@ -60,12 +74,14 @@ static void read_samples(i2c_master_dev_handle_t* dev_handle)
             ir_data[i] = (uint32_t)data_buff[5] << 16 | (uint32_t)data_buff[4] << 8 | (uint32_t)data_buff[3];  
         }
         
-        ESP_LOGI(TAG, "Completed read of %d samples", samples_to_read);
+        DLOGD(TAG, "Completed read of %d samples", samples_to_read);
         
+        #if MAX30102_LOG_LEVEL >= DLOG_LEVEL_VERBOSE
         for (int i = 0; i < samples_to_read; i++)
         {
-            ESP_LOGI(TAG, "Sample No: %d - red led: %d | ir led: %d", i, red_data[i], ir_data[i]);
+            DLOGV(TAG, "Sample No: %d - red led: %" PRIu32 " | ir led: %" PRIu32, i, red_data[i], ir_data[i]);
         }
+        #endif
 }
 
 static void reset_fifo_state(i2c_master_dev_handle_t* dev_handle)
@@ -74,19 +90,19 @@ static void reset_fifo_state(i2c_master_dev_handle_t* dev_handle)
     static const uint8_t READ_REG_ADDRESS[2] = {READ_PTR_REG, 0};
     static const uint8_t OVERFLOW_REG_ADDRESS[2] = {FIFO_OVERFLOW_REG, 0};
 
-    ESP_ERROR_CHECK(i2c_master_transmit(*dev_handle, WRITE_REG_ADDRESS, 2, -1));
-    ESP_ERROR_CHECK(i2c_master_transmit(*dev_handle, READ_REG_ADDRESS, 2, -1));
-    ESP_ERROR_CHECK(i2c_master_transmit(*dev_handle, OVERFLOW_REG_ADDRESS, 2, -1));
+    ESP_ERROR_CHECK(i2c_sched_transmit_receive(*dev_handle, WRITE_REG_ADDRESS, 2, NULL, 0, I2C_SCHED_PRIORITY_NORMAL, 0));
+    ESP_ERROR_CHECK(i2c_sched_transmit_receive(*dev_handle, READ_REG_ADDRESS, 2, NULL, 0, I2C_SCHED_PRIORITY_NORMAL, 0));
+    ESP_ERROR_CHECK(i2c_sched_transmit_receive(*dev_handle, OVERFLOW_REG_ADDRESS, 2, NULL, 0, I2C_SCHED_PRIORITY_NORMAL, 0));
 
-    #ifdef DEBUG_MODE
+    #if MAX30102_LOG_LEVEL >= DLOG_LEVEL_DEBUG
     uint8_t returned_write[1];
     uint8_t returned_read[1];
     uint8_t returned_overflow[1];
 
-    ESP_ERROR_CHECK(i2c_master_transmit_receive(*dev_handle, READ_REG_ADDRESS, 1, returned_read, 1, -1));
-    ESP_ERROR_CHECK(i2c_master_transmit_receive(*dev_handle, WRITE_REG_ADDRESS, 1, returned_write, 1, -1));
-    ESP_ERROR_CHECK(i2c_master_transmit_receive(*dev_handle, OVERFLOW_REG_ADDRESS, 1, returned_overflow, 1, -1));
-    ESP_LOGI(TAG, "Read ptr: %d Write ptr: %d Overflow num: %d", returned_read[0], returned_write[0], returned_overflow[0]);
+    ESP_ERROR_CHECK(i2c_sched_transmit_receive(*dev_handle, READ_REG_ADDRESS, 1, returned_read, 1, I2C_SCHED_PRIORITY_NORMAL, 0));
+    ESP_ERROR_CHECK(i2c_sched_transmit_receive(*dev_handle, WRITE_REG_ADDRESS, 1, returned_write, 1, I2C_SCHED_PRIORITY_NORMAL, 0));
+    ESP_ERROR_CHECK(i2c_sched_transmit_receive(*dev_handle, OVERFLOW_REG_ADDRESS, 1, returned_overflow, 1, I2C_SCHED_PRIORITY_NORMAL, 0));
+    DLOGD(TAG, "Read ptr: %u Write ptr: %u Overflow num: %u", returned_read[0], returned_write[0], returned_overflow[0]);
     #endif
 
     // read_samples(dev_handle);
@@ -111,19 +127,18 @@ static void max30102_buff_service_task(void* max30102_dev_handle)
         /*Wait for sensor buffer to get full*/
         if (xSemaphoreTake(semaphore, portMAX_DELAY))
         {
-            ESP_ERROR_CHECK(i2c_master_transmit_receive(max30102_handle->sensor_dev_handle, INTERRUPT_REG_ADDRESS, 1, interrupt_mask, 1, -1));
+            METRICS_TIME_START(service_start_us);
+            METRICS_COUNTER_ADD(METRIC_PPG_INTERRUPTS, 1);
+            METRICS_COUNTER_ADD(METRIC_PPG_I2C_TRANSACTIONS, 1);
+            ESP_ERROR_CHECK(i2c_sched_transmit_receive(max30102_handle->sensor_dev_handle, INTERRUPT_REG_ADDRESS, 1, interrupt_mask, 1, I2C_SCHED_PRIORITY_LOW, 0));
             
-            #ifdef DEBUG_MODE
-            char interrupt_bin[9] = {"\0"};
-            byte_to_binary(interrupt_mask[0], interrupt_bin);
-            ESP_LOGI(TAG, "Received interrupt mask: %s", interrupt_bin);
-            #endif
+            DLOGD(TAG, "Received interrupt mask: 0x%02X", interrupt_mask[0]);
 
             if (interrupt_mask[0] >> 7 == 1)
             {
                 read_samples(&dev_handle);
             }
-            
+            METRICS_TIME_END(METRIC_PPG_SERVICE_TIME_US, service_start_us);
         }
     }
     
@@ -369,21 +384,13 @@ static void inline config_register(uint8_t reg_addr, uint8_t data, const i2c_mas
     buff[0] = reg_addr;
     buff[1] = data;
 
-    #ifdef DEBUG_MODE
+    i2c_sched_transmit_receive(dev_handle, buff, 2, NULL, 0, I2C_SCHED_PRIORITY_NORMAL, 0);
+
+    #if MAX30102_LOG_LEVEL >= DLOG_LEVEL_DEBUG
+    /*Read the register back to see if the sensor took the value*/
     uint8_t debug_received_data[1] = {0};
-    char debug_buff_before_transmit[9] = {'\0'};
-    char debug_buff_transmitted[9] = {'\0'};
-    char debug_buff_received[9] = {'\0'};
-    #endif
-    
-    i2c_master_transmit(dev_handle, buff, 2, -1);
-
-    #ifdef DEBUG_MODE
-    byte_to_binary(debug_received_data[0], debug_buff_before_transmit);
-    byte_to_binary(data, debug_buff_transmitted);
-    i2c_master_transmit_receive(dev_handle, buff, 1, debug_received_data, 1, -1);
-    byte_to_binary(debug_received_data[0], debug_buff_received);
-    ESP_LOGI(TAG, "Writing to: 0x%02X, before_transmit: %s, t: %s, r: %s", buff[0],debug_buff_before_transmit, debug_buff_transmitted, debug_buff_received);
+    i2c_sched_transmit_receive(dev_handle, buff, 1, debug_received_data, 1, I2C_SCHED_PRIORITY_NORMAL, 0);
+    DLOGD(TAG, "Writing to: 0x%02X, t: 0x%02X, r: 0x%02X", buff[0], data, debug_received_data[0]);
     #endif
 }
 
@@ -409,7 +416,7 @@ void max30102_config(const max30102_handle_t* sensor_handle, const max30102_cfg_
     /*Get reserved bit to apply to the new mask*/
     uint8_t transmit_buff[1] = {SPO2_CFG_REG};
     uint8_t receive_buff[1] = {0};
-    i2c_master_transmit_receive(dev_handle, transmit_buff, 1, receive_buff, 1, -1);
+    i2c_sched_transmit_receive(dev_handle, transmit_buff, 1, receive_buff, 1, I2C_SCHED_PRIORITY_NORMAL, 0);
     receive_buff[0] = (receive_buff[0] << 7) >>7;
     config_register(SPO2_CFG_REG, get_spo2_config_mask(sensor_config, receive_buff[0]), dev_handle);
 
@@ -0,0 +1,10 @@
+#ifndef ANALOG_FACE_H
+#define ANALOG_FACE_H
+
+#include "ds3231.h"
+#include "widget_manager.h"
+
+/*Create the analog watch face which shows the time read from `rtc`. Returns NULL on failure*/
+const widget_t* analog_face_widget_create(ds3231_handle_t* rtc);
+
+#endif // ANALOG_FACE_H
@@ -1,6 +1,10 @@
 #ifndef CLOCK_H
 #define CLOCK_H
 
-void run_clock_widget(void* rtc);
+#include "ds3231.h"
+#include "widget_manager.h"
+
+/*Create the clock widget which shows the time read from `rtc`. Returns NULL on failure*/
+const widget_t* clock_widget_create(ds3231_handle_t* rtc);
 
 #endif // CLOCK_H
\ No newline at end of file
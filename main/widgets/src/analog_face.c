@@ -0,0 +1,590 @@
+#include "analog_face.h"
+#include "ds3231.h"
+#include "config.h"
+#include "ui_commands.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_log.h"
+
+#include "lvgl.h"
+#include "src/draw/sw/lv_draw_sw.h" // The hands are blended straight into the draw buffer
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#define ANALOG_FACE_TASK_STACK_SIZE 3072
+#define ANALOG_FACE_TASK_PRIORITY   3
+
+/*Dial, drawn once into an RGB565 canvas when the face is created*/
+#define DIAL_SIZE               DISPLAY_SIZE_X  // Square, it covers the screen
+#define DIAL_RADIUS             (DIAL_SIZE / 2 - 4)
+#define DIAL_TICK_LENGTH        6
+#define DIAL_HOUR_TICK_LENGTH   14
+#define DIAL_NUMERAL_RADIUS     (DIAL_RADIUS - DIAL_HOUR_TICK_LENGTH - 14)
+#define DIAL_BG_COLOR           0x000000
+#define DIAL_RING_COLOR         0x404040
+#define DIAL_TICK_COLOR         0xc0c0c0
+#define DIAL_NUMERAL_COLOR      0xffffff
+#define DIAL_CAP_RADIUS         5       // Disc over the centre of the hands, in the color of the second hand
+
+/*The hands jump in 6° steps (the hour hand every 12 minutes). The sprites cover 0° to 90°, the other quadrants are
+drawn mirrored*/
+#define HAND_POSITIONS          60
+#define HAND_SPRITES            (HAND_POSITIONS / 4 + 1)
+#define HAND_NO_POSITION        0xff    // Not drawn until the first time arrives
+#define SECONDS_PER_HOUR_STEP   (12 * 3600 / HAND_POSITIONS)
+
+typedef enum
+{
+    HAND_HOUR,
+    HAND_MINUTE,
+    HAND_SECOND,
+    HAND_CNT,   // Also the drawing order
+} hand_id_t;
+
+typedef struct
+{
+    uint8_t length;     // From the centre to the tip (px)
+    uint8_t tail;       // Past the centre on the other side (px)
+    uint8_t width;
+    uint32_t color;
+} hand_style_t;
+
+static const hand_style_t HAND_STYLES[HAND_CNT] =
+{
+    [HAND_HOUR] = {.length = 56, .tail = 10, .width = 7, .color = 0xffffff},
+    [HAND_MINUTE] = {.length = 86, .tail = 10, .width = 5, .color = 0xffffff},
+    [HAND_SECOND] = {.length = 100, .tail = 22, .width = 2, .color = 0xff3b30},
+};
+
+/*A row of a sprite: the coverage of `len` pixels from `x`. The coordinates are relative to the centre of the dial*/
+typedef struct
+{
+    int8_t x;
+    uint8_t len;
+    uint16_t ofs;       // Index of the first coverage value in the sprite
+} sprite_row_t;
+
+/*A hand pre-rendered at one angle, stored as anti-aliased runs, so drawing it is one masked fill per row instead of
+rotating an image*/
+typedef struct
+{
+    int16_t x1;         // Bounding box, relative to the centre of the dial
+    int16_t x2;
+    int16_t y1;
+    uint16_t row_cnt;
+    const sprite_row_t* rows;
+    const lv_opa_t* coverage;
+} sprite_t;
+
+typedef struct
+{
+    sprite_t sprites[HAND_SPRITES];
+    sprite_row_t* rows;         // The rows and the coverage of all sprites, one allocation each
+    lv_opa_t* coverage;
+    lv_color_t color;
+    uint8_t position;           // 0 is 12 o'clock, HAND_NO_POSITION if hidden
+} hand_t;
+
+/*State of the analog face shared by its task and the hooks running in the LVGL task*/
+typedef struct
+{
+    ds3231_handle_t* rtc;
+    lv_obj_t* dial;             // Canvas with the dial, the hands are drawn on it
+    lv_color_t* dial_buf;
+    hand_t hands[HAND_CNT];
+    TaskHandle_t task;
+    SemaphoreHandle_t lock;     // Held while checking is_active and sending ui commands
+    bool is_active;
+} analog_face_t;
+
+static const char TAG[] = "analog_face";
+
+static analog_face_t face_state;
+
+static lv_opa_t hand_coverage(const hand_style_t* style, float dir_x, float dir_y, int x, int y)
+{
+    /*Distance of the centre of the pixel from the axis of the hand, the ends are rounded*/
+    float px = x + 0.5f;
+    float py = y + 0.5f;
+    float along = px * dir_x + py * dir_y;
+    along = fmaxf(-style->tail, fminf(style->length, along));
+
+    float coverage = style->width / 2.0f + 0.5f - hypotf(px - along * dir_x, py - along * dir_y);
+    if (coverage <= 0)
+    {
+        return LV_OPA_TRANSP;
+    }
+
+    return coverage >= 1 ? LV_OPA_COVER : (lv_opa_t)(coverage * LV_OPA_COVER);
+}
+
+static void build_sprite(const hand_style_t* style, int index, sprite_t* sprite, sprite_row_t* rows, lv_opa_t* coverage,
+                         uint32_t* row_cnt, uint32_t* coverage_cnt)
+{
+    /*Rasterize the hand at index * 6°. With `rows` and `coverage` NULL only count what the sprite needs*/
+    float angle = index * (360.0f / HAND_POSITIONS) * (float)M_PI / 180;
+    float dir_x = sinf(angle);
+    float dir_y = -cosf(angle);
+
+    float margin = style->width / 2.0f + 1;
+    int x_min = (int)floorf(fminf(style->length * dir_x, -style->tail * dir_x) - margin);
+    int x_max = (int)ceilf(fmaxf(style->length * dir_x, -style->tail * dir_x) + margin);
+    int y_min = (int)floorf(fminf(style->length * dir_y, -style->tail * dir_y) - margin);
+    int y_max = (int)ceilf(fmaxf(style->length * dir_y, -style->tail * dir_y) + margin);
+    x_min = LV_MAX(x_min, -DIAL_SIZE / 2);
+    x_max = LV_MIN(x_max, DIAL_SIZE / 2 - 1);
+
+    lv_opa_t line[DIAL_SIZE];
+    uint32_t first_coverage = *coverage_cnt;
+    uint16_t used_row_cnt = 0;
+
+    sprite->x1 = INT16_MAX;
+    sprite->x2 = INT16_MIN;
+    sprite->y1 = 0;
+    sprite->row_cnt = 0;
+    sprite->rows = rows != NULL ? rows + *row_cnt : NULL;
+    sprite->coverage = coverage != NULL ? coverage + first_coverage : NULL;
+
+    for (int y = y_min; y <= y_max; y++)
+    {
+        int first = INT16_MAX;
+        int last = INT16_MIN;
+        for (int x = x_min; x <= x_max; x++)
+        {
+            line[x - x_min] = hand_coverage(style, dir_x, dir_y, x, y);
+            if (line[x - x_min] != LV_OPA_TRANSP)
+            {
+                first = LV_MIN(first, x);
+                last = x;
+            }
+        }
+
+        bool is_empty = last < first;
+        if (is_empty && sprite->row_cnt == 0)
+        {
+            continue; // Skip the empty rows at the top
+        }
+
+        if (sprite->row_cnt == 0)
+        {
+            sprite->y1 = y;
+        }
+
+        int len = is_empty ? 0 : last - first + 1;
+        if (rows != NULL)
+        {
+            rows[*row_cnt].x = is_empty ? 0 : first;
+            rows[*row_cnt].len = len;
+            rows[*row_cnt].ofs = *coverage_cnt - first_coverage;
+            if (!is_empty)
+            {
+                memcpy(&coverage[*coverage_cnt], &line[first - x_min], len);
+            }
+        }
+
+        (*row_cnt)++;
+        *coverage_cnt += len;
+        sprite->row_cnt++;
+
+        if (!is_empty)
+        {
+            used_row_cnt = sprite->row_cnt; // The empty rows at the bottom are dropped
+            sprite->x1 = LV_MIN(sprite->x1, first);
+            sprite->x2 = LV_MAX(sprite->x2, last);
+        }
+    }
+
+    sprite->row_cnt = used_row_cnt;
+}
+
+static bool init_hand(hand_t* hand, const hand_style_t* style)
+{
+    /*Pre-render the sprites of a hand: count the memory they need, then rasterize them again into it*/
+    uint32_t row_cnt = 0;
+    uint32_t coverage_cnt = 0;
+    for (int i = 0; i < HAND_SPRITES; i++)
+    {
+        build_sprite(style, i, &hand->sprites[i], NULL, NULL, &row_cnt, &coverage_cnt);
+    }
+
+    hand->rows = malloc(row_cnt * sizeof(sprite_row_t));
+    hand->coverage = malloc(coverage_cnt);
+    if (hand->rows == NULL || hand->coverage == NULL)
+    {
+        return false;
+    }
+
+    ESP_LOGD(TAG, "Hand sprites: %u bytes", (unsigned)(row_cnt * sizeof(sprite_row_t) + coverage_cnt));
+
+    row_cnt = 0;
+    coverage_cnt = 0;
+    for (int i = 0; i < HAND_SPRITES; i++)
+    {
+        build_sprite(style, i, &hand->sprites[i], hand->rows, hand->coverage, &row_cnt, &coverage_cnt);
+    }
+
+    hand->color = lv_color_hex(style->color);
+    hand->position = HAND_NO_POSITION;
+
+    return true;
+}
+
+static const sprite_t* get_sprite(const hand_t* hand, bool* flip_x, bool* flip_y)
+{
+    /*Mirroring the sprite of a° gives 180° - a (vertically), 360° - a (horizontally) and 180° + a (both)*/
+    int quadrant = hand->position / (HAND_POSITIONS / 4);
+    int step = hand->position % (HAND_POSITIONS / 4);
+    bool is_mirrored = quadrant == 1 || quadrant == 3;
+
+    *flip_x = quadrant >= 2;
+    *flip_y = quadrant == 1 || quadrant == 2;
+
+    return &hand->sprites[is_mirrored ? HAND_POSITIONS / 4 - step : step];
+}
+
+static void get_hand_area(const analog_face_t* face, const hand_t* hand, lv_area_t* area)
+{
+    /*Bounding box of the hand on the screen. The centre of the dial is between its two middle pixels*/
+    bool flip_x;
+    bool flip_y;
+    const sprite_t* sprite = get_sprite(hand, &flip_x, &flip_y);
+    lv_coord_t cx = face->dial->coords.x1 + DIAL_SIZE / 2;
+    lv_coord_t cy = face->dial->coords.y1 + DIAL_SIZE / 2;
+    lv_coord_t y2 = sprite->y1 + sprite->row_cnt - 1;
+
+    area->x1 = cx + (flip_x ? -1 - sprite->x2 : sprite->x1);
+    area->x2 = cx + (flip_x ? -1 - sprite->x1 : sprite->x2);
+    area->y1 = cy + (flip_y ? -1 - y2 : sprite->y1);
+    area->y2 = cy + (flip_y ? -1 - sprite->y1 : y2);
+}
+
+static void draw_hand(const analog_face_t* face, const hand_t* hand, lv_draw_ctx_t* draw_ctx)
+{
+    /*Blend the rows of the sprite under the clip area with the color of the hand, mirrored if needed*/
+    lv_area_t hand_area;
+    lv_area_t clip_area;
+    get_hand_area(face, hand, &hand_area);
+    if (!_lv_area_intersect(&clip_area, &hand_area, draw_ctx->clip_area))
+    {
+        return;
+    }
+
+    bool flip_x;
+    bool flip_y;
+    const sprite_t* sprite = get_sprite(hand, &flip_x, &flip_y);
+    lv_coord_t cx = face->dial->coords.x1 + DIAL_SIZE / 2;
+    lv_coord_t cy = face->dial->coords.y1 + DIAL_SIZE / 2;
+
+    lv_opa_t mirrored[DIAL_SIZE];
+    lv_area_t row_area;
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memset_00(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.blend_area = &row_area;
+    blend_dsc.mask_area = &row_area;
+    blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+    blend_dsc.color = hand->color;
+    blend_dsc.opa = LV_OPA_COVER;
+
+    for (lv_coord_t y = clip_area.y1; y <= clip_area.y2; y++)
+    {
+        lv_coord_t sprite_y = flip_y ? -1 - (y - cy) : y - cy;
+        const sprite_row_t* row = &sprite->rows[sprite_y - sprite->y1];
+        if (row->len == 0)
+        {
+            continue;
+        }
+
+        row_area.x1 = cx + (flip_x ? -row->x - row->len : row->x);
+        row_area.x2 = row_area.x1 + row->len - 1;
+        row_area.y1 = y;
+        row_area.y2 = y;
+        if (row_area.x2 < clip_area.x1 || row_area.x1 > clip_area.x2)
+        {
+            continue;
+        }
+
+        const lv_opa_t* coverage = &sprite->coverage[row->ofs];
+        if (flip_x)
+        {
+            for (int i = 0; i < row->len; i++)
+            {
+                mirrored[i] = coverage[row->len - 1 - i];
+            }
+            coverage = mirrored;
+        }
+
+        blend_dsc.mask_buf = (lv_opa_t*)coverage; // Only read
+        lv_draw_sw_blend(draw_ctx, &blend_dsc);
+    }
+}
+
+static void draw_hands_event_cb(lv_event_t* e)
+{
+    /*Drawn after the dial image, only where the refreshed area touches the hands*/
+    analog_face_t* face = lv_event_get_user_data(e);
+    lv_draw_ctx_t* draw_ctx = lv_event_get_draw_ctx(e);
+
+    if (face->hands[HAND_SECOND].position == HAND_NO_POSITION)
+    {
+        return;
+    }
+
+    for (int i = 0; i < HAND_CNT; i++)
+    {
+        draw_hand(face, &face->hands[i], draw_ctx);
+    }
+
+    lv_coord_t cx = face->dial->coords.x1 + DIAL_SIZE / 2;
+    lv_coord_t cy = face->dial->coords.y1 + DIAL_SIZE / 2;
+    lv_area_t cap_area = {cx - DIAL_CAP_RADIUS, cy - DIAL_CAP_RADIUS, cx + DIAL_CAP_RADIUS - 1, cy + DIAL_CAP_RADIUS - 1};
+    lv_draw_rect_dsc_t cap_dsc;
+    lv_draw_rect_dsc_init(&cap_dsc);
+    cap_dsc.radius = LV_RADIUS_CIRCLE;
+    cap_dsc.bg_color = face->hands[HAND_SECOND].color;
+    lv_draw_rect(draw_ctx, &cap_dsc, &cap_area);
+}
+
+static void draw_dial(lv_obj_t* canvas)
+{
+    /*Ring, minute and hour ticks and the 12, 3, 6 and 9*/
+    static const char* const numerals[] = {"12", "3", "6", "9"};
+    const lv_coord_t center = DIAL_SIZE / 2;
+
+    lv_canvas_fill_bg(canvas, lv_color_hex(DIAL_BG_COLOR), LV_OPA_COVER);
+
+    lv_draw_arc_dsc_t ring_dsc;
+    lv_draw_arc_dsc_init(&ring_dsc);
+    ring_dsc.color = lv_color_hex(DIAL_RING_COLOR);
+    ring_dsc.width = 2;
+    lv_canvas_draw_arc(canvas, center, center, DIAL_RADIUS, 0, 360, &ring_dsc);
+
+    lv_draw_line_dsc_t tick_dsc;
+    lv_draw_line_dsc_init(&tick_dsc);
+    tick_dsc.color = lv_color_hex(DIAL_TICK_COLOR);
+
+    for (int i = 0; i < HAND_POSITIONS; i++)
+    {
+        bool is_hour = i % (HAND_POSITIONS / 12) == 0;
+        int16_t angle = i * 360 / HAND_POSITIONS;
+        lv_coord_t outer = DIAL_RADIUS - 4;
+        lv_coord_t inner = outer - (is_hour ? DIAL_HOUR_TICK_LENGTH : DIAL_TICK_LENGTH);
+        lv_point_t points[2] =
+        {
+            {center + inner * lv_trigo_sin(angle) / LV_TRIGO_SIN_MAX, center - inner * lv_trigo_cos(angle) / LV_TRIGO_SIN_MAX},
+            {center + outer * lv_trigo_sin(angle) / LV_TRIGO_SIN_MAX, center - outer * lv_trigo_cos(angle) / LV_TRIGO_SIN_MAX},
+        };
+
+        tick_dsc.width = is_hour ? 4 : 2;
+        lv_canvas_draw_line(canvas, points, 2, &tick_dsc);
+    }
+
+    lv_draw_label_dsc_t numeral_dsc;
+    lv_draw_label_dsc_init(&numeral_dsc);
+    numeral_dsc.color = lv_color_hex(DIAL_NUMERAL_COLOR);
+
+    for (int i = 0; i < 4; i++)
+    {
+        lv_point_t size;
+        lv_txt_get_size(&size, numerals[i], numeral_dsc.font, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+        lv_coord_t x = center + DIAL_NUMERAL_RADIUS * lv_trigo_sin(i * 90) / LV_TRIGO_SIN_MAX - size.x / 2;
+        lv_coord_t y = center - DIAL_NUMERAL_RADIUS * lv_trigo_cos(i * 90) / LV_TRIGO_SIN_MAX - size.y / 2;
+        lv_canvas_draw_text(canvas, x, y, size.x, &numeral_dsc, numerals[i]);
+    }
+}
+
+static bool init_dial(analog_face_t* face, lv_obj_t* screen)
+{
+    /*Render the dial once. Redrawing around the hands is then a copy from this image*/
+    face->dial_buf = malloc(LV_CANVAS_BUF_SIZE_TRUE_COLOR(DIAL_SIZE, DIAL_SIZE));
+    if (face->dial_buf == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to allocate the dial!");
+        return false;
+    }
+
+    face->dial = lv_canvas_create(screen);
+    if (face->dial == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create the dial!");
+        return false;
+    }
+
+    lv_canvas_set_buffer(face->dial, face->dial_buf, DIAL_SIZE, DIAL_SIZE, LV_IMG_CF_TRUE_COLOR);
+    lv_obj_center(face->dial);
+    draw_dial(face->dial);
+    lv_obj_add_event_cb(face->dial, draw_hands_event_cb, LV_EVENT_DRAW_MAIN, face);
+
+    return true;
+}
+
+static void deinit_face(analog_face_t* face)
+{
+    /*Free the sprites and the dial. The canvas is deleted with the screen before this is called*/
+    for (int i = 0; i < HAND_CNT; i++)
+    {
+        free(face->hands[i].rows);
+        free(face->hands[i].coverage);
+        face->hands[i].rows = NULL;
+        face->hands[i].coverage = NULL;
+    }
+
+    free(face->dial_buf);
+    face->dial_buf = NULL;
+    face->dial = NULL;
+}
+
+static void move_hand(analog_face_t* face, hand_t* hand, uint8_t position)
+{
+    /*Redraw only where the hand was and where it goes*/
+    if (hand->position == position)
+    {
+        return;
+    }
+
+    lv_area_t area;
+    if (hand->position != HAND_NO_POSITION)
+    {
+        get_hand_area(face, hand, &area);
+        lv_obj_invalidate_area(face->dial, &area);
+    }
+
+    hand->position = position;
+    get_hand_area(face, hand, &area);
+    lv_obj_invalidate_area(face->dial, &area);
+}
+
+static void show_time_cb(void* arg)
+{
+    /*Called through the ui command queue with the seconds since 12 o'clock*/
+    analog_face_t* face = &face_state;
+    uint32_t seconds = (uint32_t)(uintptr_t)arg;
+
+    if (face->dial == NULL)
+    {
+        return; // Destroyed while the command was waiting
+    }
+
+    move_hand(face, &face->hands[HAND_HOUR], seconds / SECONDS_PER_HOUR_STEP % HAND_POSITIONS);
+    move_hand(face, &face->hands[HAND_MINUTE], seconds / 60 % HAND_POSITIONS);
+    move_hand(face, &face->hands[HAND_SECOND], seconds % HAND_POSITIONS);
+}
+
+static void analog_face_task(void* arg)
+{
+    /*Reads the rtc every second while the face is active and sleeps while it's suspended*/
+    analog_face_t* face = (analog_face_t*)arg;
+    struct tm current_time;
+
+    while (1)
+    {
+        ulTaskNotifyTake(pdTRUE, face->is_active ? pdMS_TO_TICKS(1000) : portMAX_DELAY); // Wait 1 second or until activated
+        if (!face->is_active || ds3231_get_datetime(face->rtc, &current_time) != ESP_OK)
+        {
+            continue;
+        }
+
+        uint32_t seconds = (current_time.tm_hour % 12) * 3600 + current_time.tm_min * 60 + current_time.tm_sec;
+
+        /*The face may have been suspended during the read. Don't send commands to its objects then*/
+        xSemaphoreTake(face->lock, portMAX_DELAY);
+        if (face->is_active)
+        {
+            ui_cmd_call(show_time_cb, (void*)(uintptr_t)seconds);
+        }
+        xSemaphoreGive(face->lock);
+
+        #ifdef CHECK_TASK_SIZES
+            ESP_LOGI(TAG, "Task size: %i", uxTaskGetStackHighWaterMark(NULL));
+        #endif
+    }
+}
+
+static bool analog_face_init(void* ctx, lv_obj_t* screen)
+{
+    analog_face_t* face = (analog_face_t*)ctx;
+
+    for (int i = 0; i < HAND_CNT; i++)
+    {
+        if (!init_hand(&face->hands[i], &HAND_STYLES[i]))
+        {
+            ESP_LOGE(TAG, "Failed to allocate the hand sprites!");
+            deinit_face(face);
+            return false;
+        }
+    }
+
+    if (!init_dial(face, screen))
+    {
+        deinit_face(face); // The screen is deleted by the manager
+        return false;
+    }
+
+    return true;
+}
+
+static void analog_face_activate(void* ctx)
+{
+    analog_face_t* face = (analog_face_t*)ctx;
+
+    xSemaphoreTake(face->lock, portMAX_DELAY);
+    face->is_active = true;
+    xSemaphoreGive(face->lock);
+
+    xTaskNotifyGive(face->task); // Update right away
+}
+
+static void analog_face_suspend(void* ctx)
+{
+    analog_face_t* face = (analog_face_t*)ctx;
+
+    /*After this no new commands are sent and the task stops reading the rtc*/
+    xSemaphoreTake(face->lock, portMAX_DELAY);
+    face->is_active = false;
+    xSemaphoreGive(face->lock);
+}
+
+static void analog_face_destroy(void* ctx)
+{
+    deinit_face((analog_face_t*)ctx);
+}
+
+const widget_t* analog_face_widget_create(ds3231_handle_t* rtc)
+{
+    /*Create the analog face. Its objects and sprites are created by the widget manager when it's shown*/
+    static widget_t widget =
+    {
+        .name = "analog_face",
+        .uses_encoder = false,
+        .keep_tree = false, // The dial takes 112 KiB, don't keep it while another widget is shown
+        .init = analog_face_init,
+        .activate = analog_face_activate,
+        .suspend = analog_face_suspend,
+        .destroy = analog_face_destroy,
+        .ctx = &face_state,
+    };
+
+    face_state.rtc = rtc;
+    face_state.is_active = false;
+
+    face_state.lock = xSemaphoreCreateMutex();
+    if (face_state.lock == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create mutex!");
+        return NULL;
+    }
+
+    if (xTaskCreate(analog_face_task, "analog_face", ANALOG_FACE_TASK_STACK_SIZE, &face_state, ANALOG_FACE_TASK_PRIORITY,
+                    &face_state.task) != pdPASS)
+    {
+        ESP_LOGE(TAG, "Failed to create task!");
+        vSemaphoreDelete(face_state.lock);
+        return NULL;
+    }
+
+    return &widget;
+}
@@ -2,6 +2,8 @@
 #include "clock.h"
 #include "ds3231.h"
 #include "config.h"
+#include "ui_commands.h"
+#include "assets.h"
 
 #include"esp_log.h"
 
@@ -9,10 +11,16 @@
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 
 /*Pre-tested values for digits font*/
+#define DIGITS_FONT_ASSET    "digital_7_mono"
 #define DIGITS_FONT_SIZE     70
 #define DIGITS_CACHE_SIZE    6144
+#define SECONDS_CACHE_SIZE   4096
+
+#define CLOCK_TASK_STACK_SIZE   4096
+#define CLOCK_TASK_PRIORITY     3
 
 /*Struct to hold ui elements for ease of use*/
 typedef struct
@@ -30,6 +38,17 @@ typedef struct
     lv_obj_t* grid;
 } elements;
 
+/*State of the clock_state widget shared by its task and the hooks running in the LVGL task*/
+typedef struct
+{
+    ds3231_handle_t* rtc;
+    elements ui_elements;
+    TaskHandle_t task;
+    SemaphoreHandle_t lock; // Held while checking is_active and sending ui commands
+    bool is_active;
+    bool refresh_all;       // Set upon activation to rewrite every label
+} clock_widget_t;
+
 static void month_to_str(int month, char* buffer)
 {
     /*This function converts a month index intop a string and writes it to a buffer*/
@@ -46,21 +65,29 @@ static void weekday_to_str(int weekday, char* buffer)
 
 static void init_fonts(elements* ui_elements)
 {
-    /*Init fonts for the digits*/
-    extern const uint8_t digital_7_mono_font[];
-    extern const int digital_7_mono_font_size;
-    
-    ui_elements->digits_font = lv_tiny_ttf_create_data_ex(digital_7_mono_font, digital_7_mono_font_size, DIGITS_FONT_SIZE, DIGITS_CACHE_SIZE);
-    ui_elements->seconds_font = lv_tiny_ttf_create_data(digital_7_mono_font, digital_7_mono_font_size, 2*DIGITS_FONT_SIZE/3);
+    /*Init fonts for the digits, the TrueType font is read in place from the asset partition*/
+    ui_elements->digits_font = assets_ttf_create(DIGITS_FONT_ASSET, DIGITS_FONT_SIZE, DIGITS_CACHE_SIZE);
+    ui_elements->seconds_font = assets_ttf_create(DIGITS_FONT_ASSET, 2*DIGITS_FONT_SIZE/3, SECONDS_CACHE_SIZE);
+
+    /*Segment digits are mostly solid runs, so run-length encoded glyphs keep the whole digit set cached*/
+    if (ui_elements->digits_font != NULL)
+    {
+        lv_tiny_ttf_set_cache_rle(ui_elements->digits_font, true);
+    }
+
+    if (ui_elements->seconds_font != NULL)
+    {
+        lv_tiny_ttf_set_cache_rle(ui_elements->seconds_font, true);
+    }
 }
 
-static void init_grid(elements* ui_elements)
+static void init_grid(elements* ui_elements, lv_obj_t* screen)
 {
     /*Init grid for labels layout*/
     static lv_coord_t col_dsc[] = {LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
     static lv_coord_t row_dsc[] = {LV_GRID_FR(3), LV_GRID_FR(3), LV_GRID_FR(2), LV_GRID_FR(2), LV_GRID_TEMPLATE_LAST};
 
-    ui_elements->grid = lv_obj_create(lv_scr_act());
+    ui_elements->grid = lv_obj_create(screen);
     lv_obj_set_style_grid_column_dsc_array(ui_elements->grid, col_dsc, 0);
     lv_obj_set_style_grid_row_dsc_array(ui_elements->grid, row_dsc, 0);
     lv_obj_set_size(ui_elements->grid, DISPLAY_SIZE_X, DISPLAY_SIZE_Y);
@@ -82,20 +109,23 @@ static void init_styles(elements* ui_elements)
 
 static void init_labels(elements* ui_elements)
 {
-    /*Init text objects*/
+    /*Init text objects, the monospace digits keep their width*/
     ui_elements->hours_label = lv_label_create(ui_elements->grid);
     lv_obj_add_style(ui_elements->hours_label, &ui_elements->digits_style, 0);
     lv_obj_set_grid_cell(ui_elements->hours_label, LV_GRID_ALIGN_CENTER, 0, 1, LV_GRID_ALIGN_CENTER, 0, 1);
+    lv_label_set_fixed_width(ui_elements->hours_label, true);
 
     ui_elements->minutes_label = lv_label_create(ui_elements->grid);
     lv_obj_add_style(ui_elements->minutes_label, &ui_elements->digits_style, 0);
     lv_obj_set_grid_cell(ui_elements->minutes_label, LV_GRID_ALIGN_CENTER, 0, 1, LV_GRID_ALIGN_CENTER, 1, 1);
+    lv_label_set_fixed_width(ui_elements->minutes_label, true);
 
     ui_elements->seconds_label = lv_label_create(ui_elements->grid);
     lv_obj_add_style(ui_elements->seconds_label, &ui_elements->digits_style, 0);
     lv_obj_set_grid_cell(ui_elements->seconds_label, LV_GRID_ALIGN_CENTER, 0, 1, LV_GRID_ALIGN_CENTER, 2, 1);
+    lv_label_set_fixed_width(ui_elements->seconds_label, true);
 
-    if (ui_elements->seconds_label != NULL)
+    if (ui_elements->seconds_label != NULL && ui_elements->seconds_font != NULL)
     {
         lv_obj_set_style_text_font(ui_elements->seconds_label, ui_elements->seconds_font, 0);
     }
@@ -105,14 +135,15 @@ static void init_labels(elements* ui_elements)
     lv_obj_set_grid_cell(ui_elements->date_label, LV_GRID_ALIGN_CENTER, 0, 1, LV_GRID_ALIGN_CENTER, 3, 1);
 }
 
-static bool init_ui_elements(elements* ui_elements)
+static bool init_ui_elements(elements* ui_elements, lv_obj_t* screen)
 {
-    /*Initialize the ui elements for the clock. Return true upon success, return false on failed initialization*/
+    /*Initialize the ui elements for the clock_state. Return true upon success, return false on failed initialization*/
 
     static const char TAG[] = "clock_ui_init";
 
     /*Initialize pointers to objects as NULL for error handling*/
     ui_elements->digits_font = NULL;
+    ui_elements->seconds_font = NULL;
     ui_elements->hours_label = NULL;
     ui_elements->minutes_label = NULL;
     ui_elements->seconds_label = NULL;
@@ -120,7 +151,7 @@ static bool init_ui_elements(elements* ui_elements)
     ui_elements->grid = NULL;
 
     init_fonts(ui_elements);
-    init_grid(ui_elements);
+    init_grid(ui_elements, screen);
     init_styles(ui_elements);
 
     /*Assign font to digits style unless font memory allocation failed*/
@@ -149,17 +180,19 @@ static bool init_ui_elements(elements* ui_elements)
 
 static void deinit_ui_elements(elements* ui_elements)
 {
-    /*Destroy all created ui elements*/
+    /*Destroy all created ui elements. The objects are deleted with the screen before this is called*/
 
     /*delete fonts if they were created*/
     if (ui_elements->digits_font != NULL)
     {
         lv_tiny_ttf_destroy(ui_elements->digits_font);
+        ui_elements->digits_font = NULL;
     }
     
     if (ui_elements->seconds_font != NULL)
     {
         lv_tiny_ttf_destroy(ui_elements->seconds_font);
+        ui_elements->seconds_font = NULL;
     }
     
 
@@ -167,21 +200,25 @@ static void deinit_ui_elements(elements* ui_elements)
     lv_style_reset(&ui_elements->date_style);
     lv_style_reset(&ui_elements->digits_style);
 
-    /*Delete labels*/
-    lv_obj_del(ui_elements->grid);
+    ui_elements->hours_label = NULL;
+    ui_elements->minutes_label = NULL;
+    ui_elements->seconds_label = NULL;
+    ui_elements->date_label = NULL;
+    ui_elements->grid = NULL;
 }
 
-static void display_time_value(const int current_time_value, const int prev_time_value, lv_obj_t* label)
+static void display_time_value(const int current_time_value, int* reference_value, lv_obj_t* label)
 {
-    /*Function to update hours, minutes and seconds labels*/
+    /*Function to update hours, minutes and seconds labels. The reference is kept if the queue is full,
+    so the value is sent again on the next tick*/
 
-    if(current_time_value != prev_time_value)
+    if(current_time_value != *reference_value && ui_cmd_set_text_fmt(label, "%02d", current_time_value)) // Applied later by the lvgl task
     {
-        lv_label_set_text_fmt(label, "%02d", current_time_value);
+        *reference_value = current_time_value;
     }
 }
 
-static void display_date(const struct tm* current_time, const struct tm* reference_time, elements* ui_elements)
+static void display_date(const struct tm* current_time, struct tm* reference_time, elements* ui_elements)
 {
     /*Function to display the month, day of month, year and weekday*/
 
@@ -193,47 +230,148 @@ static void display_date(const struct tm* current_time, const struct tm* referen
     {
         month_to_str(current_time->tm_mon, month_buff);
         weekday_to_str(current_time->tm_wday, weekday_buff);
-        lv_label_set_text_fmt(ui_elements->date_label, "%s %02d %d\n%s", month_buff, current_time->tm_mday, current_time->tm_year + 1900, weekday_buff);
-
+        if (ui_cmd_set_text_fmt(ui_elements->date_label, "%s %02d %d\n%s", month_buff, current_time->tm_mday, current_time->tm_year + 1900, weekday_buff))
+        {
+            reference_time->tm_mday = current_time->tm_mday; // Sent again on the next tick if the queue was full
+        }
     }
 }
 
-void run_clock_widget(void* rtc)
+static void clock_task(void* arg)
 {
-    struct tm current_time;
-    struct tm reference_time = 
+    /*Reads the rtc every second while the widget is active and sleeps while it's suspended*/
+    clock_widget_t* clock_state = (clock_widget_t*)arg;
+
+    static const struct tm invalid_time = 
     {.tm_sec=-1,
      .tm_min=-1,
      .tm_hour=-1,
      .tm_mday=-1,
      .tm_mon=-1,
      .tm_year=-1,
-     .tm_wday=-1}; // Init all values to -1 to ensure labels being updated upon first run
-
-    elements ui_elements; // Struct to hold all ui elements
-    if(!init_ui_elements(&ui_elements))
-    {
-        abort();
-    } // Initialize ui elements. If this fails, crush the program
+     .tm_wday=-1}; // All values are -1 to ensure labels being updated upon first run
+    struct tm current_time;
+    struct tm reference_time = invalid_time;
 
-    ds3231_handle_t* rtc_handle = (ds3231_handle_t*)rtc; // Get rtc object
-    
     while (1)
     {
-        ds3231_get_datetime(rtc_handle, &current_time); // Get current time
-
-        display_time_value(current_time.tm_hour, reference_time.tm_hour, ui_elements.hours_label); // Display hours
-        display_time_value(current_time.tm_min, reference_time.tm_min, ui_elements.minutes_label); // Display minutes
-        display_time_value(current_time.tm_sec, reference_time.tm_sec, ui_elements.seconds_label); // Display seconds
-        display_date(&current_time, &reference_time, &ui_elements); // Display date
+        ulTaskNotifyTake(pdTRUE, clock_state->is_active ? pdMS_TO_TICKS(1000) : portMAX_DELAY); // Wait 1 second or until activated
+        if (!clock_state->is_active || ds3231_get_datetime(clock_state->rtc, &current_time) != ESP_OK)
+        {
+            continue; // Skip the tick if the time couldn't be read, the next one shows it
+        }
+
+        /*The widget may have been suspended during the read. Don't touch its labels then*/
+        xSemaphoreTake(clock_state->lock, portMAX_DELAY);
+        if (clock_state->is_active)
+        {
+            if (clock_state->refresh_all)
+            {
+                reference_time = invalid_time;
+                clock_state->refresh_all = false;
+            }
+
+            elements* ui_elements = &clock_state->ui_elements;
+            display_time_value(current_time.tm_hour, &reference_time.tm_hour, ui_elements->hours_label); // Display hours
+            display_time_value(current_time.tm_min, &reference_time.tm_min, ui_elements->minutes_label); // Display minutes
+            display_time_value(current_time.tm_sec, &reference_time.tm_sec, ui_elements->seconds_label); // Display seconds
+            display_date(&current_time, &reference_time, ui_elements); // Display date, each updates its reference when it's sent
+        }
+        xSemaphoreGive(clock_state->lock);
 
-        reference_time = current_time; // Update reference time
-        
         #ifdef CHECK_TASK_SIZES
             ESP_LOGI("clock_widget", "Task size: %i", uxTaskGetStackHighWaterMark(NULL));
         #endif
-        vTaskDelay(pdMS_TO_TICKS(1000)); // Delay for 1 second
+    }
+}
+
+static bool clock_init(void* ctx, lv_obj_t* screen)
+{
+    clock_widget_t* clock_state = (clock_widget_t*)ctx;
+
+    if (!init_ui_elements(&clock_state->ui_elements, screen))
+    {
+        deinit_ui_elements(&clock_state->ui_elements); // Free the fonts and styles, the screen is deleted by the manager
+        return false;
+    }
+
+    return true;
+}
+
+static void clock_activate(void* ctx)
+{
+    clock_widget_t* clock_state = (clock_widget_t*)ctx;
+
+    xSemaphoreTake(clock_state->lock, portMAX_DELAY);
+    clock_state->is_active = true;
+    clock_state->refresh_all = true; // Labels may be outdated after being suspended
+    xSemaphoreGive(clock_state->lock);
+
+    xTaskNotifyGive(clock_state->task); // Update right away
+}
+
+static void clock_suspend(void* ctx)
+{
+    clock_widget_t* clock_state = (clock_widget_t*)ctx;
+
+    /*After this no new commands are sent to the labels and the task stops reading the rtc*/
+    xSemaphoreTake(clock_state->lock, portMAX_DELAY);
+    clock_state->is_active = false;
+    xSemaphoreGive(clock_state->lock);
+
+    /*The glyphs are rendered again when the clock is shown*/
+    if (clock_state->ui_elements.digits_font != NULL)
+    {
+        lv_tiny_ttf_flush_cache(clock_state->ui_elements.digits_font);
+    }
+
+    if (clock_state->ui_elements.seconds_font != NULL)
+    {
+        lv_tiny_ttf_flush_cache(clock_state->ui_elements.seconds_font);
+    }
+}
+
+static void clock_destroy(void* ctx)
+{
+    clock_widget_t* clock_state = (clock_widget_t*)ctx;
+    deinit_ui_elements(&clock_state->ui_elements);
+}
+
+const widget_t* clock_widget_create(ds3231_handle_t* rtc)
+{
+    /*Create the clock widget. Its objects are created by the widget manager on the first activation*/
+    static const char TAG[] = "clock_widget";
+
+    static clock_widget_t clock_state;
+    static widget_t widget =
+    {
+        .name = "clock",
+        .uses_encoder = false,
+        .keep_tree = true, // Cheap to keep once the glyph caches are freed, and it's shown most of the time
+        .init = clock_init,
+        .activate = clock_activate,
+        .suspend = clock_suspend,
+        .destroy = clock_destroy,
+        .ctx = &clock_state,
+    };
+
+    clock_state.rtc = rtc;
+    clock_state.is_active = false;
+    clock_state.refresh_all = true;
+
+    clock_state.lock = xSemaphoreCreateMutex();
+    if (clock_state.lock == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create mutex!");
+        return NULL;
+    }
+
+    if (xTaskCreate(clock_task, "clock", CLOCK_TASK_STACK_SIZE, &clock_state, CLOCK_TASK_PRIORITY, &clock_state.task) != pdPASS)
+    {
+        ESP_LOGE(TAG, "Failed to create task!");
+        vSemaphoreDelete(clock_state.lock);
+        return NULL;
     }
 
-    deinit_ui_elements(&ui_elements); // Destroy ui elements
+    return &widget;
 }
@@ -1,2870 +0,0 @@
-unsigned char digital_7_mono_font[] = {
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0x04, 0x00, 0x20,
-  0x4c, 0x54, 0x53, 0x48, 0xf0, 0xa6, 0xa6, 0xbf, 0x00, 0x00, 0x03, 0xb4,
-  0x00, 0x00, 0x00, 0x6f, 0x4f, 0x53, 0x2f, 0x32, 0x67, 0x2a, 0xf0, 0x67,
-  0x00, 0x00, 0x01, 0xa8, 0x00, 0x00, 0x00, 0x60, 0x50, 0x43, 0x4c, 0x54,
-  0xcd, 0x96, 0xee, 0x4c, 0x00, 0x00, 0x86, 0x2c, 0x00, 0x00, 0x00, 0x36,
-  0x56, 0x44, 0x4d, 0x58, 0x6b, 0x6a, 0x73, 0x05, 0x00, 0x00, 0x04, 0x24,
-  0x00, 0x00, 0x05, 0xe0, 0x63, 0x6d, 0x61, 0x70, 0x90, 0x5b, 0xd5, 0x65,
-  0x00, 0x00, 0x14, 0x1c, 0x00, 0x00, 0x02, 0x50, 0x63, 0x76, 0x74, 0x20,
-  0x12, 0x75, 0x0c, 0x3d, 0x00, 0x00, 0x2a, 0x8c, 0x00, 0x00, 0x00, 0x66,
-  0x66, 0x70, 0x67, 0x6d, 0x34, 0x44, 0x16, 0x85, 0x00, 0x00, 0x16, 0x6c,
-  0x00, 0x00, 0x13, 0x3b, 0x67, 0x61, 0x73, 0x70, 0x00, 0x17, 0x00, 0x09,
-  0x00, 0x00, 0x86, 0x1c, 0x00, 0x00, 0x00, 0x10, 0x67, 0x6c, 0x79, 0x66,
-  0x2c, 0x92, 0xea, 0x19, 0x00, 0x00, 0x2a, 0xf4, 0x00, 0x00, 0x52, 0xc0,
-  0x68, 0x64, 0x6d, 0x78, 0x6c, 0x9f, 0xa0, 0x04, 0x00, 0x00, 0x0a, 0x04,
-  0x00, 0x00, 0x0a, 0x18, 0x68, 0x65, 0x61, 0x64, 0xef, 0xd2, 0xef, 0xb3,
-  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
-  0x05, 0x15, 0x03, 0x28, 0x00, 0x00, 0x01, 0x64, 0x00, 0x00, 0x00, 0x24,
-  0x68, 0x6d, 0x74, 0x78, 0xd0, 0xfc, 0x1b, 0xec, 0x00, 0x00, 0x02, 0x08,
-  0x00, 0x00, 0x01, 0xac, 0x6c, 0x6f, 0x63, 0x61, 0x4f, 0x6c, 0x66, 0x50,
-  0x00, 0x00, 0x7d, 0xb4, 0x00, 0x00, 0x00, 0xd8, 0x6d, 0x61, 0x78, 0x70,
-  0x03, 0x0e, 0x13, 0xd1, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x00, 0x20,
-  0x6e, 0x61, 0x6d, 0x65, 0xc8, 0xc5, 0xb2, 0xd1, 0x00, 0x00, 0x7e, 0x8c,
-  0x00, 0x00, 0x06, 0x8d, 0x70, 0x6f, 0x73, 0x74, 0x5d, 0x49, 0x62, 0x31,
-  0x00, 0x00, 0x85, 0x1c, 0x00, 0x00, 0x00, 0xfd, 0x70, 0x72, 0x65, 0x70,
-  0x56, 0xf2, 0x66, 0x80, 0x00, 0x00, 0x29, 0xa8, 0x00, 0x00, 0x00, 0xe1,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x7b, 0x6d, 0xc9, 0x57,
-  0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x10, 0x04, 0x4c, 0x00, 0x00, 0x00, 0x00,
-  0xc5, 0x0b, 0x4d, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xaf, 0x5d, 0xa7,
-  0x00, 0x00, 0xff, 0x88, 0x01, 0xf4, 0x03, 0x48, 0x00, 0x00, 0x00, 0x0b,
-  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x03, 0x20, 0x00, 0xc8, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0xf4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x6b, 0x00, 0x54, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x00, 0x08, 0x00, 0x40, 0x00, 0x8c, 0x00, 0x00, 0x02, 0x00, 0x13, 0x3b,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0xf4, 0x01, 0x90, 0x00, 0x05,
-  0x00, 0x00, 0x02, 0xbc, 0x02, 0x8a, 0x00, 0x00, 0x00, 0x8f, 0x02, 0xbc,
-  0x02, 0x8a, 0x00, 0x00, 0x01, 0xc5, 0x00, 0x32, 0x01, 0x03, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x41, 0x4c, 0x54, 0x53, 0x00, 0x40, 0x00, 0x20, 0x20, 0x30,
-  0x03, 0x20, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x84, 0x00, 0xbb, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbc, 0x02, 0xbc, 0x00, 0x00,
-  0x00, 0x20, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
-  0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0xd2,
-  0x01, 0xf4, 0x00, 0x8c, 0x01, 0xf4, 0x00, 0x1e, 0x01, 0xf4, 0x00, 0x28,
-  0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0xdc,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0xbe, 0x01, 0xf4, 0x00, 0x55,
-  0x01, 0xf4, 0x00, 0x50, 0x01, 0xf4, 0x00, 0xd2, 0x01, 0xf4, 0x00, 0x50,
-  0x01, 0xf4, 0x00, 0xd2, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28,
-  0x01, 0xf4, 0x01, 0x7c, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28,
-  0x01, 0xf4, 0x00, 0xd2, 0x01, 0xf4, 0x00, 0xd2, 0x01, 0xf4, 0x00, 0x64,
-  0x01, 0xf4, 0x00, 0x50, 0x01, 0xf4, 0x00, 0x64, 0x01, 0xf4, 0x00, 0x28,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28,
-  0x01, 0xf4, 0x00, 0xc8, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x29,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x29, 0x01, 0xf4, 0x00, 0xfa,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0xa0,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0xc8,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x29, 0x01, 0xf4, 0x00, 0x28,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x1e,
-  0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x50, 0x01, 0xf4, 0x00, 0x1e,
-  0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0xdc, 0x01, 0xf4, 0x00, 0xdc,
-  0x01, 0xf4, 0x00, 0x8c, 0x01, 0xf4, 0x00, 0x8c, 0x01, 0xf4, 0x00, 0x64,
-  0x01, 0xf4, 0x00, 0x1e, 0x01, 0xf4, 0x00, 0x0a, 0x01, 0xf4, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x6b, 0x4b, 0x01, 0x01, 0x01, 0x4b, 0x4b, 0x4b, 0x4b,
-  0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-  0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-  0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-  0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-  0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-  0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-  0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-  0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-  0x4b, 0x4b, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01,
-  0x01, 0x01, 0x00, 0x0c, 0x00, 0xf8, 0x08, 0xff, 0x00, 0x08, 0x00, 0x07,
-  0xff, 0xfe, 0x00, 0x09, 0x00, 0x08, 0xff, 0xfe, 0x00, 0x0a, 0x00, 0x09,
-  0xff, 0xfe, 0x00, 0x0b, 0x00, 0x09, 0xff, 0xfe, 0x00, 0x0c, 0x00, 0x0a,
-  0xff, 0xfd, 0x00, 0x0d, 0x00, 0x0b, 0xff, 0xfd, 0x00, 0x0e, 0x00, 0x0c,
-  0xff, 0xfd, 0x00, 0x0f, 0x00, 0x0d, 0xff, 0xfd, 0x00, 0x10, 0x00, 0x0e,
-  0xff, 0xfd, 0x00, 0x11, 0x00, 0x0e, 0xff, 0xfd, 0x00, 0x12, 0x00, 0x0f,
-  0xff, 0xfc, 0x00, 0x13, 0x00, 0x10, 0xff, 0xfc, 0x00, 0x14, 0x00, 0x11,
-  0xff, 0xfc, 0x00, 0x15, 0x00, 0x12, 0xff, 0xfc, 0x00, 0x16, 0x00, 0x12,
-  0xff, 0xfc, 0x00, 0x17, 0x00, 0x13, 0xff, 0xfc, 0x00, 0x18, 0x00, 0x14,
-  0xff, 0xfb, 0x00, 0x19, 0x00, 0x15, 0xff, 0xfb, 0x00, 0x1a, 0x00, 0x16,
-  0xff, 0xfb, 0x00, 0x1b, 0x00, 0x17, 0xff, 0xfb, 0x00, 0x1c, 0x00, 0x17,
-  0xff, 0xfb, 0x00, 0x1d, 0x00, 0x18, 0xff, 0xfb, 0x00, 0x1e, 0x00, 0x19,
-  0xff, 0xfa, 0x00, 0x1f, 0x00, 0x1a, 0xff, 0xfa, 0x00, 0x20, 0x00, 0x1b,
-  0xff, 0xfa, 0x00, 0x21, 0x00, 0x1b, 0xff, 0xfa, 0x00, 0x22, 0x00, 0x1c,
-  0xff, 0xfa, 0x00, 0x23, 0x00, 0x1d, 0xff, 0xfa, 0x00, 0x24, 0x00, 0x1e,
-  0xff, 0xf9, 0x00, 0x25, 0x00, 0x1f, 0xff, 0xf9, 0x00, 0x26, 0x00, 0x20,
-  0xff, 0xf9, 0x00, 0x27, 0x00, 0x20, 0xff, 0xf9, 0x00, 0x28, 0x00, 0x21,
-  0xff, 0xf9, 0x00, 0x29, 0x00, 0x22, 0xff, 0xf9, 0x00, 0x2a, 0x00, 0x23,
-  0xff, 0xf8, 0x00, 0x2b, 0x00, 0x24, 0xff, 0xf8, 0x00, 0x2c, 0x00, 0x24,
-  0xff, 0xf8, 0x00, 0x2d, 0x00, 0x25, 0xff, 0xf8, 0x00, 0x2e, 0x00, 0x26,
-  0xff, 0xf8, 0x00, 0x2f, 0x00, 0x27, 0xff, 0xf8, 0x00, 0x30, 0x00, 0x28,
-  0xff, 0xf7, 0x00, 0x31, 0x00, 0x29, 0xff, 0xf7, 0x00, 0x32, 0x00, 0x29,
-  0xff, 0xf7, 0x00, 0x33, 0x00, 0x2a, 0xff, 0xf7, 0x00, 0x34, 0x00, 0x2b,
-  0xff, 0xf7, 0x00, 0x35, 0x00, 0x2c, 0xff, 0xf6, 0x00, 0x36, 0x00, 0x2d,
-  0xff, 0xf6, 0x00, 0x37, 0x00, 0x2d, 0xff, 0xf6, 0x00, 0x38, 0x00, 0x2e,
-  0xff, 0xf6, 0x00, 0x39, 0x00, 0x2f, 0xff, 0xf6, 0x00, 0x3a, 0x00, 0x30,
-  0xff, 0xf6, 0x00, 0x3b, 0x00, 0x31, 0xff, 0xf5, 0x00, 0x3c, 0x00, 0x32,
-  0xff, 0xf5, 0x00, 0x3d, 0x00, 0x32, 0xff, 0xf5, 0x00, 0x3e, 0x00, 0x33,
-  0xff, 0xf5, 0x00, 0x3f, 0x00, 0x34, 0xff, 0xf5, 0x00, 0x40, 0x00, 0x35,
-  0xff, 0xf5, 0x00, 0x41, 0x00, 0x36, 0xff, 0xf4, 0x00, 0x42, 0x00, 0x36,
-  0xff, 0xf4, 0x00, 0x43, 0x00, 0x37, 0xff, 0xf4, 0x00, 0x44, 0x00, 0x38,
-  0xff, 0xf4, 0x00, 0x45, 0x00, 0x39, 0xff, 0xf4, 0x00, 0x46, 0x00, 0x3a,
-  0xff, 0xf4, 0x00, 0x47, 0x00, 0x3b, 0xff, 0xf3, 0x00, 0x48, 0x00, 0x3b,
-  0xff, 0xf3, 0x00, 0x49, 0x00, 0x3c, 0xff, 0xf3, 0x00, 0x4a, 0x00, 0x3d,
-  0xff, 0xf3, 0x00, 0x4b, 0x00, 0x3e, 0xff, 0xf3, 0x00, 0x4c, 0x00, 0x3f,
-  0xff, 0xf3, 0x00, 0x4d, 0x00, 0x3f, 0xff, 0xf2, 0x00, 0x4e, 0x00, 0x40,
-  0xff, 0xf2, 0x00, 0x4f, 0x00, 0x41, 0xff, 0xf2, 0x00, 0x50, 0x00, 0x42,
-  0xff, 0xf2, 0x00, 0x51, 0x00, 0x43, 0xff, 0xf2, 0x00, 0x52, 0x00, 0x44,
-  0xff, 0xf2, 0x00, 0x53, 0x00, 0x44, 0xff, 0xf1, 0x00, 0x54, 0x00, 0x45,
-  0xff, 0xf1, 0x00, 0x55, 0x00, 0x46, 0xff, 0xf1, 0x00, 0x56, 0x00, 0x47,
-  0xff, 0xf1, 0x00, 0x57, 0x00, 0x48, 0xff, 0xf1, 0x00, 0x58, 0x00, 0x48,
-  0xff, 0xf1, 0x00, 0x59, 0x00, 0x49, 0xff, 0xf0, 0x00, 0x5a, 0x00, 0x4a,
-  0xff, 0xf0, 0x00, 0x5b, 0x00, 0x4b, 0xff, 0xf0, 0x00, 0x5c, 0x00, 0x4c,
-  0xff, 0xf0, 0x00, 0x5d, 0x00, 0x4d, 0xff, 0xf0, 0x00, 0x5e, 0x00, 0x4d,
-  0xff, 0xf0, 0x00, 0x5f, 0x00, 0x4e, 0xff, 0xef, 0x00, 0x60, 0x00, 0x4f,
-  0xff, 0xef, 0x00, 0x61, 0x00, 0x50, 0xff, 0xef, 0x00, 0x62, 0x00, 0x51,
-  0xff, 0xef, 0x00, 0x63, 0x00, 0x51, 0xff, 0xef, 0x00, 0x64, 0x00, 0x52,
-  0xff, 0xef, 0x00, 0x65, 0x00, 0x53, 0xff, 0xee, 0x00, 0x66, 0x00, 0x54,
-  0xff, 0xee, 0x00, 0x67, 0x00, 0x55, 0xff, 0xee, 0x00, 0x68, 0x00, 0x56,
-  0xff, 0xee, 0x00, 0x69, 0x00, 0x56, 0xff, 0xee, 0x00, 0x6a, 0x00, 0x57,
-  0xff, 0xed, 0x00, 0x6b, 0x00, 0x58, 0xff, 0xed, 0x00, 0x6c, 0x00, 0x59,
-  0xff, 0xed, 0x00, 0x6d, 0x00, 0x5a, 0xff, 0xed, 0x00, 0x6e, 0x00, 0x5a,
-  0xff, 0xed, 0x00, 0x6f, 0x00, 0x5b, 0xff, 0xed, 0x00, 0x70, 0x00, 0x5c,
-  0xff, 0xec, 0x00, 0x71, 0x00, 0x5d, 0xff, 0xec, 0x00, 0x72, 0x00, 0x5e,
-  0xff, 0xec, 0x00, 0x73, 0x00, 0x5f, 0xff, 0xec, 0x00, 0x74, 0x00, 0x5f,
-  0xff, 0xec, 0x00, 0x75, 0x00, 0x60, 0xff, 0xec, 0x00, 0x76, 0x00, 0x61,
-  0xff, 0xeb, 0x00, 0x77, 0x00, 0x62, 0xff, 0xeb, 0x00, 0x78, 0x00, 0x63,
-  0xff, 0xeb, 0x00, 0x79, 0x00, 0x63, 0xff, 0xeb, 0x00, 0x7a, 0x00, 0x64,
-  0xff, 0xeb, 0x00, 0x7b, 0x00, 0x65, 0xff, 0xeb, 0x00, 0x7c, 0x00, 0x66,
-  0xff, 0xea, 0x00, 0x7d, 0x00, 0x67, 0xff, 0xea, 0x00, 0x7e, 0x00, 0x68,
-  0xff, 0xea, 0x00, 0x7f, 0x00, 0x68, 0xff, 0xea, 0x00, 0x80, 0x00, 0x69,
-  0xff, 0xea, 0x00, 0x81, 0x00, 0x6a, 0xff, 0xea, 0x00, 0x82, 0x00, 0x6b,
-  0xff, 0xe9, 0x00, 0x83, 0x00, 0x6c, 0xff, 0xe9, 0x00, 0x84, 0x00, 0x6c,
-  0xff, 0xe9, 0x00, 0x85, 0x00, 0x6d, 0xff, 0xe9, 0x00, 0x86, 0x00, 0x6e,
-  0xff, 0xe9, 0x00, 0x87, 0x00, 0x6f, 0xff, 0xe9, 0x00, 0x88, 0x00, 0x70,
-  0xff, 0xe8, 0x00, 0x89, 0x00, 0x71, 0xff, 0xe8, 0x00, 0x8a, 0x00, 0x71,
-  0xff, 0xe8, 0x00, 0x8b, 0x00, 0x72, 0xff, 0xe8, 0x00, 0x8c, 0x00, 0x73,
-  0xff, 0xe8, 0x00, 0x8d, 0x00, 0x74, 0xff, 0xe8, 0x00, 0x8e, 0x00, 0x75,
-  0xff, 0xe7, 0x00, 0x8f, 0x00, 0x75, 0xff, 0xe7, 0x00, 0x90, 0x00, 0x76,
-  0xff, 0xe7, 0x00, 0x91, 0x00, 0x77, 0xff, 0xe7, 0x00, 0x92, 0x00, 0x78,
-  0xff, 0xe7, 0x00, 0x93, 0x00, 0x79, 0xff, 0xe7, 0x00, 0x94, 0x00, 0x7a,
-  0xff, 0xe6, 0x00, 0x95, 0x00, 0x7a, 0xff, 0xe6, 0x00, 0x96, 0x00, 0x7b,
-  0xff, 0xe6, 0x00, 0x97, 0x00, 0x7c, 0xff, 0xe6, 0x00, 0x98, 0x00, 0x7d,
-  0xff, 0xe6, 0x00, 0x99, 0x00, 0x7e, 0xff, 0xe5, 0x00, 0x9a, 0x00, 0x7e,
-  0xff, 0xe5, 0x00, 0x9b, 0x00, 0x7f, 0xff, 0xe5, 0x00, 0x9c, 0x00, 0x80,
-  0xff, 0xe5, 0x00, 0x9d, 0x00, 0x81, 0xff, 0xe5, 0x00, 0x9e, 0x00, 0x82,
-  0xff, 0xe5, 0x00, 0x9f, 0x00, 0x83, 0xff, 0xe4, 0x00, 0xa0, 0x00, 0x83,
-  0xff, 0xe4, 0x00, 0xa1, 0x00, 0x84, 0xff, 0xe4, 0x00, 0xa2, 0x00, 0x85,
-  0xff, 0xe4, 0x00, 0xa3, 0x00, 0x86, 0xff, 0xe4, 0x00, 0xa4, 0x00, 0x87,
-  0xff, 0xe4, 0x00, 0xa5, 0x00, 0x87, 0xff, 0xe3, 0x00, 0xa6, 0x00, 0x88,
-  0xff, 0xe3, 0x00, 0xa7, 0x00, 0x89, 0xff, 0xe3, 0x00, 0xa8, 0x00, 0x8a,
-  0xff, 0xe3, 0x00, 0xa9, 0x00, 0x8b, 0xff, 0xe3, 0x00, 0xaa, 0x00, 0x8c,
-  0xff, 0xe3, 0x00, 0xab, 0x00, 0x8c, 0xff, 0xe2, 0x00, 0xac, 0x00, 0x8d,
-  0xff, 0xe2, 0x00, 0xad, 0x00, 0x8e, 0xff, 0xe2, 0x00, 0xae, 0x00, 0x8f,
-  0xff, 0xe2, 0x00, 0xaf, 0x00, 0x90, 0xff, 0xe2, 0x00, 0xb0, 0x00, 0x90,
-  0xff, 0xe2, 0x00, 0xb1, 0x00, 0x91, 0xff, 0xe1, 0x00, 0xb2, 0x00, 0x92,
-  0xff, 0xe1, 0x00, 0xb3, 0x00, 0x93, 0xff, 0xe1, 0x00, 0xb4, 0x00, 0x94,
-  0xff, 0xe1, 0x00, 0xb5, 0x00, 0x95, 0xff, 0xe1, 0x00, 0xb6, 0x00, 0x95,
-  0xff, 0xe1, 0x00, 0xb7, 0x00, 0x96, 0xff, 0xe0, 0x00, 0xb8, 0x00, 0x97,
-  0xff, 0xe0, 0x00, 0xb9, 0x00, 0x98, 0xff, 0xe0, 0x00, 0xba, 0x00, 0x99,
-  0xff, 0xe0, 0x00, 0xbb, 0x00, 0x99, 0xff, 0xe0, 0x00, 0xbc, 0x00, 0x9a,
-  0xff, 0xe0, 0x00, 0xbd, 0x00, 0x9b, 0xff, 0xdf, 0x00, 0xbe, 0x00, 0x9c,
-  0xff, 0xdf, 0x00, 0xbf, 0x00, 0x9d, 0xff, 0xdf, 0x00, 0xc0, 0x00, 0x9e,
-  0xff, 0xdf, 0x00, 0xc1, 0x00, 0x9e, 0xff, 0xdf, 0x00, 0xc2, 0x00, 0x9f,
-  0xff, 0xdf, 0x00, 0xc3, 0x00, 0xa0, 0xff, 0xde, 0x00, 0xc4, 0x00, 0xa1,
-  0xff, 0xde, 0x00, 0xc5, 0x00, 0xa2, 0xff, 0xde, 0x00, 0xc6, 0x00, 0xa2,
-  0xff, 0xde, 0x00, 0xc7, 0x00, 0xa3, 0xff, 0xde, 0x00, 0xc8, 0x00, 0xa4,
-  0xff, 0xde, 0x00, 0xc9, 0x00, 0xa5, 0xff, 0xdd, 0x00, 0xca, 0x00, 0xa6,
-  0xff, 0xdd, 0x00, 0xcb, 0x00, 0xa7, 0xff, 0xdd, 0x00, 0xcc, 0x00, 0xa7,
-  0xff, 0xdd, 0x00, 0xcd, 0x00, 0xa8, 0xff, 0xdd, 0x00, 0xce, 0x00, 0xa9,
-  0xff, 0xdc, 0x00, 0xcf, 0x00, 0xaa, 0xff, 0xdc, 0x00, 0xd0, 0x00, 0xab,
-  0xff, 0xdc, 0x00, 0xd1, 0x00, 0xab, 0xff, 0xdc, 0x00, 0xd2, 0x00, 0xac,
-  0xff, 0xdc, 0x00, 0xd3, 0x00, 0xad, 0xff, 0xdc, 0x00, 0xd4, 0x00, 0xae,
-  0xff, 0xdb, 0x00, 0xd5, 0x00, 0xaf, 0xff, 0xdb, 0x00, 0xd6, 0x00, 0xb0,
-  0xff, 0xdb, 0x00, 0xd7, 0x00, 0xb0, 0xff, 0xdb, 0x00, 0xd8, 0x00, 0xb1,
-  0xff, 0xdb, 0x00, 0xd9, 0x00, 0xb2, 0xff, 0xdb, 0x00, 0xda, 0x00, 0xb3,
-  0xff, 0xda, 0x00, 0xdb, 0x00, 0xb4, 0xff, 0xda, 0x00, 0xdc, 0x00, 0xb4,
-  0xff, 0xda, 0x00, 0xdd, 0x00, 0xb5, 0xff, 0xda, 0x00, 0xde, 0x00, 0xb6,
-  0xff, 0xda, 0x00, 0xdf, 0x00, 0xb7, 0xff, 0xda, 0x00, 0xe0, 0x00, 0xb8,
-  0xff, 0xd9, 0x00, 0xe1, 0x00, 0xb9, 0xff, 0xd9, 0x00, 0xe2, 0x00, 0xb9,
-  0xff, 0xd9, 0x00, 0xe3, 0x00, 0xba, 0xff, 0xd9, 0x00, 0xe4, 0x00, 0xbb,
-  0xff, 0xd9, 0x00, 0xe5, 0x00, 0xbc, 0xff, 0xd9, 0x00, 0xe6, 0x00, 0xbd,
-  0xff, 0xd8, 0x00, 0xe7, 0x00, 0xbd, 0xff, 0xd8, 0x00, 0xe8, 0x00, 0xbe,
-  0xff, 0xd8, 0x00, 0xe9, 0x00, 0xbf, 0xff, 0xd8, 0x00, 0xea, 0x00, 0xc0,
-  0xff, 0xd8, 0x00, 0xeb, 0x00, 0xc1, 0xff, 0xd8, 0x00, 0xec, 0x00, 0xc2,
-  0xff, 0xd7, 0x00, 0xed, 0x00, 0xc2, 0xff, 0xd7, 0x00, 0xee, 0x00, 0xc3,
-  0xff, 0xd7, 0x00, 0xef, 0x00, 0xc4, 0xff, 0xd7, 0x00, 0xf0, 0x00, 0xc5,
-  0xff, 0xd7, 0x00, 0xf1, 0x00, 0xc6, 0xff, 0xd7, 0x00, 0xf2, 0x00, 0xc6,
-  0xff, 0xd6, 0x00, 0xf3, 0x00, 0xc7, 0xff, 0xd6, 0x00, 0xf4, 0x00, 0xc8,
-  0xff, 0xd6, 0x00, 0xf5, 0x00, 0xc9, 0xff, 0xd6, 0x00, 0xf6, 0x00, 0xca,
-  0xff, 0xd6, 0x00, 0xf7, 0x00, 0xcb, 0xff, 0xd6, 0x00, 0xf8, 0x00, 0xcb,
-  0xff, 0xd5, 0x00, 0xf9, 0x00, 0xcc, 0xff, 0xd5, 0x00, 0xfa, 0x00, 0xcd,
-  0xff, 0xd5, 0x00, 0xfb, 0x00, 0xce, 0xff, 0xd5, 0x00, 0xfc, 0x00, 0xcf,
-  0xff, 0xd5, 0x00, 0xfd, 0x00, 0xcf, 0xff, 0xd4, 0x00, 0xfe, 0x00, 0xd0,
-  0xff, 0xd4, 0x00, 0xff, 0x00, 0xd1, 0xff, 0xd4, 0x00, 0x00, 0x00, 0x17,
-  0x00, 0x00, 0x00, 0x70, 0x09, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-  0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x0a, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00,
-  0x0b, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x00, 0x00, 0x00, 0x0c, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x0d, 0x06, 0x06, 0x06,
-  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00,
-  0x0f, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-  0x07, 0x00, 0x00, 0x00, 0x10, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x11, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00,
-  0x13, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x00, 0x00, 0x00, 0x15, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-  0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-  0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-  0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-  0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-  0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-  0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-  0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-  0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-  0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x18, 0x0b, 0x0b, 0x0b,
-  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x00, 0x00, 0x00,
-  0x1b, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-  0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-  0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-  0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-  0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-  0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-  0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-  0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-  0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-  0x0c, 0x00, 0x00, 0x00, 0x1d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x20, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00,
-  0x21, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x00, 0x00, 0x00, 0x25, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x2a, 0x13, 0x13, 0x13,
-  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x00,
-  0x2e, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
-  0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
-  0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
-  0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
-  0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
-  0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
-  0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
-  0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
-  0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
-  0x15, 0x00, 0x00, 0x00, 0x32, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-  0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x00, 0x36, 0x19, 0x19, 0x19,
-  0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-  0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-  0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-  0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-  0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-  0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-  0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-  0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-  0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x00, 0x00, 0x00,
-  0x3a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a,
-  0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a,
-  0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a,
-  0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a,
-  0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a,
-  0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a,
-  0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a,
-  0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a,
-  0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a,
-  0x1a, 0x00, 0x00, 0x00, 0x43, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-  0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-  0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-  0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-  0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-  0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-  0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-  0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-  0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-  0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x4b, 0x22, 0x22, 0x22,
-  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x03, 0x00, 0x01,
-  0x00, 0x00, 0x01, 0xb0, 0x00, 0x06, 0x01, 0x94, 0x00, 0x00, 0x00, 0x20,
-  0x00, 0xc5, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07,
-  0x00, 0x08, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0d,
-  0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13,
-  0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19,
-  0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f,
-  0x00, 0x20, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25,
-  0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x2b,
-  0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x30, 0x00, 0x31,
-  0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37,
-  0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d,
-  0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43,
-  0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49,
-  0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f,
-  0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55,
-  0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b,
-  0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x61,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x69, 0x00, 0x65,
-  0x00, 0x66, 0x00, 0x63, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62,
-  0x00, 0x04, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x03,
-  0x00, 0x00, 0x00, 0x7e, 0x00, 0xa9, 0x20, 0x14, 0x20, 0x19, 0x20, 0x1d,
-  0x20, 0x22, 0x20, 0x30, 0xff, 0xff, 0x00, 0x00, 0x00, 0x20, 0x00, 0xa9,
-  0x20, 0x13, 0x20, 0x18, 0x20, 0x1c, 0x20, 0x22, 0x20, 0x30, 0xff, 0xff,
-  0xff, 0xe3, 0xff, 0xc1, 0xe0, 0x55, 0xe0, 0x4b, 0xe0, 0x49, 0xe0, 0x45,
-  0xe0, 0x32, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x50,
-  0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x7e,
-  0x00, 0xa9, 0x20, 0x14, 0x20, 0x19, 0x20, 0x1d, 0x20, 0x22, 0x20, 0x30,
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x20, 0x00, 0xa9, 0x20, 0x13, 0x20, 0x18,
-  0x20, 0x1c, 0x20, 0x22, 0x20, 0x30, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xc1,
-  0xe0, 0x55, 0xe0, 0x4b, 0xe0, 0x49, 0xe0, 0x45, 0xe0, 0x32, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x05, 0x04, 0x03, 0x02, 0x00, 0x2c,
-  0x76, 0x45, 0x20, 0xb0, 0x03, 0x25, 0x45, 0x23, 0x61, 0x68, 0x18, 0x23,
-  0x68, 0x60, 0x44, 0x2d, 0x2c, 0x45, 0x20, 0xb0, 0x03, 0x25, 0x45, 0x23,
-  0x61, 0x68, 0x23, 0x68, 0x60, 0x44, 0x2d, 0x2c, 0x20, 0x20, 0xb8, 0xff,
-  0xc0, 0x38, 0x12, 0xb1, 0x40, 0x01, 0x36, 0x38, 0x2d, 0x2c, 0x20, 0x20,
-  0xb0, 0x40, 0x38, 0x12, 0xb0, 0x01, 0x36, 0xb8, 0xff, 0xc0, 0x38, 0x2d,
-  0x2c, 0x01, 0xb0, 0x46, 0x76, 0x20, 0x47, 0x68, 0x18, 0x23, 0x46, 0x61,
-  0x68, 0x20, 0x58, 0x20, 0xb0, 0x03, 0x25, 0x23, 0x38, 0xb0, 0x02, 0x25,
-  0x12, 0xb0, 0x01, 0x36, 0x65, 0x38, 0x59, 0x2d, 0xb8, 0x00, 0x0a, 0x2c,
-  0x4b, 0xb8, 0x00, 0x0b, 0x50, 0x58, 0xb1, 0x01, 0x01, 0x8e, 0x59, 0xb8,
-  0x01, 0xff, 0x85, 0xb8, 0x00, 0x44, 0x1d, 0xb9, 0x00, 0x0b, 0x00, 0x03,
-  0x5f, 0x5e, 0x2d, 0xb8, 0x00, 0x0b, 0x2c, 0x20, 0x20, 0x45, 0x69, 0x44,
-  0xb0, 0x01, 0x60, 0x2d, 0xb8, 0x00, 0x0c, 0x2c, 0xb8, 0x00, 0x0b, 0x2a,
-  0x21, 0x2d, 0xb8, 0x00, 0x0d, 0x2c, 0x20, 0x46, 0xb0, 0x03, 0x25, 0x46,
-  0x52, 0x58, 0x23, 0x59, 0x20, 0x8a, 0x20, 0x8a, 0x49, 0x64, 0x8a, 0x20,
-  0x46, 0x20, 0x68, 0x61, 0x64, 0xb0, 0x04, 0x25, 0x46, 0x20, 0x68, 0x61,
-  0x64, 0x52, 0x58, 0x23, 0x65, 0x8a, 0x59, 0x2f, 0x20, 0xb0, 0x00, 0x53,
-  0x58, 0x69, 0x20, 0xb0, 0x00, 0x54, 0x58, 0x21, 0xb0, 0x40, 0x59, 0x1b,
-  0x69, 0x20, 0xb0, 0x00, 0x54, 0x58, 0x21, 0xb0, 0x40, 0x65, 0x59, 0x59,
-  0x3a, 0x2d, 0xb8, 0x00, 0x0e, 0x2c, 0x20, 0x46, 0xb0, 0x04, 0x25, 0x46,
-  0x52, 0x58, 0x23, 0x8a, 0x59, 0x20, 0x46, 0x20, 0x6a, 0x61, 0x64, 0xb0,
-  0x04, 0x25, 0x46, 0x20, 0x6a, 0x61, 0x64, 0x52, 0x58, 0x23, 0x8a, 0x59,
-  0x2f, 0xfd, 0x2d, 0xb8, 0x00, 0x0f, 0x2c, 0x4b, 0x20, 0xb0, 0x03, 0x26,
-  0x50, 0x58, 0x51, 0x58, 0xb0, 0x80, 0x44, 0x1b, 0xb0, 0x40, 0x44, 0x59,
-  0x1b, 0x21, 0x21, 0x20, 0x45, 0xb0, 0xc0, 0x50, 0x58, 0xb0, 0xc0, 0x44,
-  0x1b, 0x21, 0x59, 0x59, 0x2d, 0xb8, 0x00, 0x10, 0x2c, 0x20, 0x20, 0x45,
-  0x69, 0x44, 0xb0, 0x01, 0x60, 0x20, 0x20, 0x45, 0x7d, 0x69, 0x18, 0x44,
-  0xb0, 0x01, 0x60, 0x2d, 0xb8, 0x00, 0x11, 0x2c, 0xb8, 0x00, 0x10, 0x2a,
-  0x2d, 0xb8, 0x00, 0x12, 0x2c, 0x4b, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58,
-  0xb0, 0x40, 0x1b, 0xb0, 0x00, 0x59, 0x8a, 0x8a, 0x20, 0xb0, 0x03, 0x26,
-  0x53, 0x58, 0x23, 0x21, 0xb0, 0x80, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59,
-  0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x00, 0xc0, 0x8a,
-  0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23,
-  0x21, 0xb8, 0x01, 0x00, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0,
-  0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x40, 0x8a, 0x8a, 0x1b,
-  0x8a, 0x23, 0x59, 0x20, 0xb8, 0x00, 0x03, 0x26, 0x53, 0x58, 0xb0, 0x03,
-  0x25, 0x45, 0xb8, 0x01, 0x80, 0x50, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x80,
-  0x23, 0x21, 0x1b, 0xb0, 0x03, 0x25, 0x45, 0x23, 0x21, 0x23, 0x21, 0x59,
-  0x1b, 0x21, 0x59, 0x44, 0x2d, 0xb8, 0x00, 0x13, 0x2c, 0x4b, 0x53, 0x58,
-  0x45, 0x44, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0xb8, 0x00, 0x14, 0x2c, 0x4b,
-  0xb8, 0x00, 0x0b, 0x50, 0x58, 0xb1, 0x01, 0x01, 0x8e, 0x59, 0xb8, 0x01,
-  0xff, 0x85, 0xb8, 0x00, 0x44, 0x1d, 0xb9, 0x00, 0x0b, 0x00, 0x03, 0x5f,
-  0x5e, 0x2d, 0xb8, 0x00, 0x15, 0x2c, 0x20, 0x20, 0x45, 0x69, 0x44, 0xb0,
-  0x01, 0x60, 0x2d, 0xb8, 0x00, 0x16, 0x2c, 0xb8, 0x00, 0x15, 0x2a, 0x21,
-  0x2d, 0xb8, 0x00, 0x17, 0x2c, 0x20, 0x46, 0xb0, 0x03, 0x25, 0x46, 0x52,
-  0x58, 0x23, 0x59, 0x20, 0x8a, 0x20, 0x8a, 0x49, 0x64, 0x8a, 0x20, 0x46,
-  0x20, 0x68, 0x61, 0x64, 0xb0, 0x04, 0x25, 0x46, 0x20, 0x68, 0x61, 0x64,
-  0x52, 0x58, 0x23, 0x65, 0x8a, 0x59, 0x2f, 0x20, 0xb0, 0x00, 0x53, 0x58,
-  0x69, 0x20, 0xb0, 0x00, 0x54, 0x58, 0x21, 0xb0, 0x40, 0x59, 0x1b, 0x69,
-  0x20, 0xb0, 0x00, 0x54, 0x58, 0x21, 0xb0, 0x40, 0x65, 0x59, 0x59, 0x3a,
-  0x2d, 0xb8, 0x00, 0x18, 0x2c, 0x20, 0x46, 0xb0, 0x04, 0x25, 0x46, 0x52,
-  0x58, 0x23, 0x8a, 0x59, 0x20, 0x46, 0x20, 0x6a, 0x61, 0x64, 0xb0, 0x04,
-  0x25, 0x46, 0x20, 0x6a, 0x61, 0x64, 0x52, 0x58, 0x23, 0x8a, 0x59, 0x2f,
-  0xfd, 0x2d, 0xb8, 0x00, 0x19, 0x2c, 0x4b, 0x20, 0xb0, 0x03, 0x26, 0x50,
-  0x58, 0x51, 0x58, 0xb0, 0x80, 0x44, 0x1b, 0xb0, 0x40, 0x44, 0x59, 0x1b,
-  0x21, 0x21, 0x20, 0x45, 0xb0, 0xc0, 0x50, 0x58, 0xb0, 0xc0, 0x44, 0x1b,
-  0x21, 0x59, 0x59, 0x2d, 0xb8, 0x00, 0x1a, 0x2c, 0x20, 0x20, 0x45, 0x69,
-  0x44, 0xb0, 0x01, 0x60, 0x20, 0x20, 0x45, 0x7d, 0x69, 0x18, 0x44, 0xb0,
-  0x01, 0x60, 0x2d, 0xb8, 0x00, 0x1b, 0x2c, 0xb8, 0x00, 0x1a, 0x2a, 0x2d,
-  0xb8, 0x00, 0x1c, 0x2c, 0x4b, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0xb0,
-  0x40, 0x1b, 0xb0, 0x00, 0x59, 0x8a, 0x8a, 0x20, 0xb0, 0x03, 0x26, 0x53,
-  0x58, 0x23, 0x21, 0xb0, 0x80, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20,
-  0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x00, 0xc0, 0x8a, 0x8a,
-  0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21,
-  0xb8, 0x01, 0x00, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03,
-  0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x40, 0x8a, 0x8a, 0x1b, 0x8a,
-  0x23, 0x59, 0x20, 0xb8, 0x00, 0x03, 0x26, 0x53, 0x58, 0xb0, 0x03, 0x25,
-  0x45, 0xb8, 0x01, 0x80, 0x50, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x80, 0x23,
-  0x21, 0x1b, 0xb0, 0x03, 0x25, 0x45, 0x23, 0x21, 0x23, 0x21, 0x59, 0x1b,
-  0x21, 0x59, 0x44, 0x2d, 0xb8, 0x00, 0x1d, 0x2c, 0x4b, 0x53, 0x58, 0x45,
-  0x44, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0xb8, 0x00, 0x1e, 0x2c, 0x4b, 0xb8,
-  0x00, 0x0b, 0x50, 0x58, 0xb1, 0x01, 0x01, 0x8e, 0x59, 0xb8, 0x01, 0xff,
-  0x85, 0xb8, 0x00, 0x44, 0x1d, 0xb9, 0x00, 0x0b, 0x00, 0x03, 0x5f, 0x5e,
-  0x2d, 0xb8, 0x00, 0x1f, 0x2c, 0x20, 0x20, 0x45, 0x69, 0x44, 0xb0, 0x01,
-  0x60, 0x2d, 0xb8, 0x00, 0x20, 0x2c, 0xb8, 0x00, 0x1f, 0x2a, 0x21, 0x2d,
-  0xb8, 0x00, 0x21, 0x2c, 0x20, 0x46, 0xb0, 0x03, 0x25, 0x46, 0x52, 0x58,
-  0x23, 0x59, 0x20, 0x8a, 0x20, 0x8a, 0x49, 0x64, 0x8a, 0x20, 0x46, 0x20,
-  0x68, 0x61, 0x64, 0xb0, 0x04, 0x25, 0x46, 0x20, 0x68, 0x61, 0x64, 0x52,
-  0x58, 0x23, 0x65, 0x8a, 0x59, 0x2f, 0x20, 0xb0, 0x00, 0x53, 0x58, 0x69,
-  0x20, 0xb0, 0x00, 0x54, 0x58, 0x21, 0xb0, 0x40, 0x59, 0x1b, 0x69, 0x20,
-  0xb0, 0x00, 0x54, 0x58, 0x21, 0xb0, 0x40, 0x65, 0x59, 0x59, 0x3a, 0x2d,
-  0xb8, 0x00, 0x22, 0x2c, 0x20, 0x46, 0xb0, 0x04, 0x25, 0x46, 0x52, 0x58,
-  0x23, 0x8a, 0x59, 0x20, 0x46, 0x20, 0x6a, 0x61, 0x64, 0xb0, 0x04, 0x25,
-  0x46, 0x20, 0x6a, 0x61, 0x64, 0x52, 0x58, 0x23, 0x8a, 0x59, 0x2f, 0xfd,
-  0x2d, 0xb8, 0x00, 0x23, 0x2c, 0x4b, 0x20, 0xb0, 0x03, 0x26, 0x50, 0x58,
-  0x51, 0x58, 0xb0, 0x80, 0x44, 0x1b, 0xb0, 0x40, 0x44, 0x59, 0x1b, 0x21,
-  0x21, 0x20, 0x45, 0xb0, 0xc0, 0x50, 0x58, 0xb0, 0xc0, 0x44, 0x1b, 0x21,
-  0x59, 0x59, 0x2d, 0xb8, 0x00, 0x24, 0x2c, 0x20, 0x20, 0x45, 0x69, 0x44,
-  0xb0, 0x01, 0x60, 0x20, 0x20, 0x45, 0x7d, 0x69, 0x18, 0x44, 0xb0, 0x01,
-  0x60, 0x2d, 0xb8, 0x00, 0x25, 0x2c, 0xb8, 0x00, 0x24, 0x2a, 0x2d, 0xb8,
-  0x00, 0x26, 0x2c, 0x4b, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0xb0, 0x40,
-  0x1b, 0xb0, 0x00, 0x59, 0x8a, 0x8a, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58,
-  0x23, 0x21, 0xb0, 0x80, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0,
-  0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x00, 0xc0, 0x8a, 0x8a, 0x1b,
-  0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8,
-  0x01, 0x00, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03, 0x26,
-  0x53, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x40, 0x8a, 0x8a, 0x1b, 0x8a, 0x23,
-  0x59, 0x20, 0xb8, 0x00, 0x03, 0x26, 0x53, 0x58, 0xb0, 0x03, 0x25, 0x45,
-  0xb8, 0x01, 0x80, 0x50, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x80, 0x23, 0x21,
-  0x1b, 0xb0, 0x03, 0x25, 0x45, 0x23, 0x21, 0x23, 0x21, 0x59, 0x1b, 0x21,
-  0x59, 0x44, 0x2d, 0xb8, 0x00, 0x27, 0x2c, 0x4b, 0x53, 0x58, 0x45, 0x44,
-  0x1b, 0x21, 0x21, 0x59, 0x2d, 0xb8, 0x00, 0x28, 0x2c, 0x4b, 0xb8, 0x00,
-  0x0b, 0x50, 0x58, 0xb1, 0x01, 0x01, 0x8e, 0x59, 0xb8, 0x01, 0xff, 0x85,
-  0xb8, 0x00, 0x44, 0x1d, 0xb9, 0x00, 0x0b, 0x00, 0x03, 0x5f, 0x5e, 0x2d,
-  0xb8, 0x00, 0x29, 0x2c, 0x20, 0x20, 0x45, 0x69, 0x44, 0xb0, 0x01, 0x60,
-  0x2d, 0xb8, 0x00, 0x2a, 0x2c, 0xb8, 0x00, 0x29, 0x2a, 0x21, 0x2d, 0xb8,
-  0x00, 0x2b, 0x2c, 0x20, 0x46, 0xb0, 0x03, 0x25, 0x46, 0x52, 0x58, 0x23,
-  0x59, 0x20, 0x8a, 0x20, 0x8a, 0x49, 0x64, 0x8a, 0x20, 0x46, 0x20, 0x68,
-  0x61, 0x64, 0xb0, 0x04, 0x25, 0x46, 0x20, 0x68, 0x61, 0x64, 0x52, 0x58,
-  0x23, 0x65, 0x8a, 0x59, 0x2f, 0x20, 0xb0, 0x00, 0x53, 0x58, 0x69, 0x20,
-  0xb0, 0x00, 0x54, 0x58, 0x21, 0xb0, 0x40, 0x59, 0x1b, 0x69, 0x20, 0xb0,
-  0x00, 0x54, 0x58, 0x21, 0xb0, 0x40, 0x65, 0x59, 0x59, 0x3a, 0x2d, 0xb8,
-  0x00, 0x2c, 0x2c, 0x20, 0x46, 0xb0, 0x04, 0x25, 0x46, 0x52, 0x58, 0x23,
-  0x8a, 0x59, 0x20, 0x46, 0x20, 0x6a, 0x61, 0x64, 0xb0, 0x04, 0x25, 0x46,
-  0x20, 0x6a, 0x61, 0x64, 0x52, 0x58, 0x23, 0x8a, 0x59, 0x2f, 0xfd, 0x2d,
-  0xb8, 0x00, 0x2d, 0x2c, 0x4b, 0x20, 0xb0, 0x03, 0x26, 0x50, 0x58, 0x51,
-  0x58, 0xb0, 0x80, 0x44, 0x1b, 0xb0, 0x40, 0x44, 0x59, 0x1b, 0x21, 0x21,
-  0x20, 0x45, 0xb0, 0xc0, 0x50, 0x58, 0xb0, 0xc0, 0x44, 0x1b, 0x21, 0x59,
-  0x59, 0x2d, 0xb8, 0x00, 0x2e, 0x2c, 0x20, 0x20, 0x45, 0x69, 0x44, 0xb0,
-  0x01, 0x60, 0x20, 0x20, 0x45, 0x7d, 0x69, 0x18, 0x44, 0xb0, 0x01, 0x60,
-  0x2d, 0xb8, 0x00, 0x2f, 0x2c, 0xb8, 0x00, 0x2e, 0x2a, 0x2d, 0xb8, 0x00,
-  0x30, 0x2c, 0x4b, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0xb0, 0x40, 0x1b,
-  0xb0, 0x00, 0x59, 0x8a, 0x8a, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23,
-  0x21, 0xb0, 0x80, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03,
-  0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x00, 0xc0, 0x8a, 0x8a, 0x1b, 0x8a,
-  0x23, 0x59, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x01,
-  0x00, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03, 0x26, 0x53,
-  0x58, 0x23, 0x21, 0xb8, 0x01, 0x40, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59,
-  0x20, 0xb8, 0x00, 0x03, 0x26, 0x53, 0x58, 0xb0, 0x03, 0x25, 0x45, 0xb8,
-  0x01, 0x80, 0x50, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x80, 0x23, 0x21, 0x1b,
-  0xb0, 0x03, 0x25, 0x45, 0x23, 0x21, 0x23, 0x21, 0x59, 0x1b, 0x21, 0x59,
-  0x44, 0x2d, 0xb8, 0x00, 0x31, 0x2c, 0x4b, 0x53, 0x58, 0x45, 0x44, 0x1b,
-  0x21, 0x21, 0x59, 0x2d, 0xb8, 0x00, 0x32, 0x2c, 0x4b, 0xb8, 0x00, 0x0b,
-  0x50, 0x58, 0xb1, 0x01, 0x01, 0x8e, 0x59, 0xb8, 0x01, 0xff, 0x85, 0xb8,
-  0x00, 0x44, 0x1d, 0xb9, 0x00, 0x0b, 0x00, 0x03, 0x5f, 0x5e, 0x2d, 0xb8,
-  0x00, 0x33, 0x2c, 0x20, 0x20, 0x45, 0x69, 0x44, 0xb0, 0x01, 0x60, 0x2d,
-  0xb8, 0x00, 0x34, 0x2c, 0xb8, 0x00, 0x33, 0x2a, 0x21, 0x2d, 0xb8, 0x00,
-  0x35, 0x2c, 0x20, 0x46, 0xb0, 0x03, 0x25, 0x46, 0x52, 0x58, 0x23, 0x59,
-  0x20, 0x8a, 0x20, 0x8a, 0x49, 0x64, 0x8a, 0x20, 0x46, 0x20, 0x68, 0x61,
-  0x64, 0xb0, 0x04, 0x25, 0x46, 0x20, 0x68, 0x61, 0x64, 0x52, 0x58, 0x23,
-  0x65, 0x8a, 0x59, 0x2f, 0x20, 0xb0, 0x00, 0x53, 0x58, 0x69, 0x20, 0xb0,
-  0x00, 0x54, 0x58, 0x21, 0xb0, 0x40, 0x59, 0x1b, 0x69, 0x20, 0xb0, 0x00,
-  0x54, 0x58, 0x21, 0xb0, 0x40, 0x65, 0x59, 0x59, 0x3a, 0x2d, 0xb8, 0x00,
-  0x36, 0x2c, 0x20, 0x46, 0xb0, 0x04, 0x25, 0x46, 0x52, 0x58, 0x23, 0x8a,
-  0x59, 0x20, 0x46, 0x20, 0x6a, 0x61, 0x64, 0xb0, 0x04, 0x25, 0x46, 0x20,
-  0x6a, 0x61, 0x64, 0x52, 0x58, 0x23, 0x8a, 0x59, 0x2f, 0xfd, 0x2d, 0xb8,
-  0x00, 0x37, 0x2c, 0x4b, 0x20, 0xb0, 0x03, 0x26, 0x50, 0x58, 0x51, 0x58,
-  0xb0, 0x80, 0x44, 0x1b, 0xb0, 0x40, 0x44, 0x59, 0x1b, 0x21, 0x21, 0x20,
-  0x45, 0xb0, 0xc0, 0x50, 0x58, 0xb0, 0xc0, 0x44, 0x1b, 0x21, 0x59, 0x59,
-  0x2d, 0xb8, 0x00, 0x38, 0x2c, 0x20, 0x20, 0x45, 0x69, 0x44, 0xb0, 0x01,
-  0x60, 0x20, 0x20, 0x45, 0x7d, 0x69, 0x18, 0x44, 0xb0, 0x01, 0x60, 0x2d,
-  0xb8, 0x00, 0x39, 0x2c, 0xb8, 0x00, 0x38, 0x2a, 0x2d, 0xb8, 0x00, 0x3a,
-  0x2c, 0x4b, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0xb0, 0x40, 0x1b, 0xb0,
-  0x00, 0x59, 0x8a, 0x8a, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21,
-  0xb0, 0x80, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03, 0x26,
-  0x53, 0x58, 0x23, 0x21, 0xb8, 0x00, 0xc0, 0x8a, 0x8a, 0x1b, 0x8a, 0x23,
-  0x59, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x00,
-  0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58,
-  0x23, 0x21, 0xb8, 0x01, 0x40, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20,
-  0xb8, 0x00, 0x03, 0x26, 0x53, 0x58, 0xb0, 0x03, 0x25, 0x45, 0xb8, 0x01,
-  0x80, 0x50, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x80, 0x23, 0x21, 0x1b, 0xb0,
-  0x03, 0x25, 0x45, 0x23, 0x21, 0x23, 0x21, 0x59, 0x1b, 0x21, 0x59, 0x44,
-  0x2d, 0xb8, 0x00, 0x3b, 0x2c, 0x4b, 0x53, 0x58, 0x45, 0x44, 0x1b, 0x21,
-  0x21, 0x59, 0x2d, 0xb8, 0x00, 0x3c, 0x2c, 0x4b, 0xb8, 0x00, 0x0b, 0x50,
-  0x58, 0xb1, 0x01, 0x01, 0x8e, 0x59, 0xb8, 0x01, 0xff, 0x85, 0xb8, 0x00,
-  0x44, 0x1d, 0xb9, 0x00, 0x0b, 0x00, 0x03, 0x5f, 0x5e, 0x2d, 0xb8, 0x00,
-  0x3d, 0x2c, 0x20, 0x20, 0x45, 0x69, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb8,
-  0x00, 0x3e, 0x2c, 0xb8, 0x00, 0x3d, 0x2a, 0x21, 0x2d, 0xb8, 0x00, 0x3f,
-  0x2c, 0x20, 0x46, 0xb0, 0x03, 0x25, 0x46, 0x52, 0x58, 0x23, 0x59, 0x20,
-  0x8a, 0x20, 0x8a, 0x49, 0x64, 0x8a, 0x20, 0x46, 0x20, 0x68, 0x61, 0x64,
-  0xb0, 0x04, 0x25, 0x46, 0x20, 0x68, 0x61, 0x64, 0x52, 0x58, 0x23, 0x65,
-  0x8a, 0x59, 0x2f, 0x20, 0xb0, 0x00, 0x53, 0x58, 0x69, 0x20, 0xb0, 0x00,
-  0x54, 0x58, 0x21, 0xb0, 0x40, 0x59, 0x1b, 0x69, 0x20, 0xb0, 0x00, 0x54,
-  0x58, 0x21, 0xb0, 0x40, 0x65, 0x59, 0x59, 0x3a, 0x2d, 0xb8, 0x00, 0x40,
-  0x2c, 0x20, 0x46, 0xb0, 0x04, 0x25, 0x46, 0x52, 0x58, 0x23, 0x8a, 0x59,
-  0x20, 0x46, 0x20, 0x6a, 0x61, 0x64, 0xb0, 0x04, 0x25, 0x46, 0x20, 0x6a,
-  0x61, 0x64, 0x52, 0x58, 0x23, 0x8a, 0x59, 0x2f, 0xfd, 0x2d, 0xb8, 0x00,
-  0x41, 0x2c, 0x4b, 0x20, 0xb0, 0x03, 0x26, 0x50, 0x58, 0x51, 0x58, 0xb0,
-  0x80, 0x44, 0x1b, 0xb0, 0x40, 0x44, 0x59, 0x1b, 0x21, 0x21, 0x20, 0x45,
-  0xb0, 0xc0, 0x50, 0x58, 0xb0, 0xc0, 0x44, 0x1b, 0x21, 0x59, 0x59, 0x2d,
-  0xb8, 0x00, 0x42, 0x2c, 0x20, 0x20, 0x45, 0x69, 0x44, 0xb0, 0x01, 0x60,
-  0x20, 0x20, 0x45, 0x7d, 0x69, 0x18, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb8,
-  0x00, 0x43, 0x2c, 0xb8, 0x00, 0x42, 0x2a, 0x2d, 0xb8, 0x00, 0x44, 0x2c,
-  0x4b, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0xb0, 0x40, 0x1b, 0xb0, 0x00,
-  0x59, 0x8a, 0x8a, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb0,
-  0x80, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03, 0x26, 0x53,
-  0x58, 0x23, 0x21, 0xb8, 0x00, 0xc0, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59,
-  0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x00, 0x8a,
-  0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23,
-  0x21, 0xb8, 0x01, 0x40, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb8,
-  0x00, 0x03, 0x26, 0x53, 0x58, 0xb0, 0x03, 0x25, 0x45, 0xb8, 0x01, 0x80,
-  0x50, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x80, 0x23, 0x21, 0x1b, 0xb0, 0x03,
-  0x25, 0x45, 0x23, 0x21, 0x23, 0x21, 0x59, 0x1b, 0x21, 0x59, 0x44, 0x2d,
-  0xb8, 0x00, 0x45, 0x2c, 0x4b, 0x53, 0x58, 0x45, 0x44, 0x1b, 0x21, 0x21,
-  0x59, 0x2d, 0xb8, 0x00, 0x46, 0x2c, 0x4b, 0xb8, 0x00, 0x0b, 0x50, 0x58,
-  0xb1, 0x01, 0x01, 0x8e, 0x59, 0xb8, 0x01, 0xff, 0x85, 0xb8, 0x00, 0x44,
-  0x1d, 0xb9, 0x00, 0x0b, 0x00, 0x03, 0x5f, 0x5e, 0x2d, 0xb8, 0x00, 0x47,
-  0x2c, 0x20, 0x20, 0x45, 0x69, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb8, 0x00,
-  0x48, 0x2c, 0xb8, 0x00, 0x47, 0x2a, 0x21, 0x2d, 0xb8, 0x00, 0x49, 0x2c,
-  0x20, 0x46, 0xb0, 0x03, 0x25, 0x46, 0x52, 0x58, 0x23, 0x59, 0x20, 0x8a,
-  0x20, 0x8a, 0x49, 0x64, 0x8a, 0x20, 0x46, 0x20, 0x68, 0x61, 0x64, 0xb0,
-  0x04, 0x25, 0x46, 0x20, 0x68, 0x61, 0x64, 0x52, 0x58, 0x23, 0x65, 0x8a,
-  0x59, 0x2f, 0x20, 0xb0, 0x00, 0x53, 0x58, 0x69, 0x20, 0xb0, 0x00, 0x54,
-  0x58, 0x21, 0xb0, 0x40, 0x59, 0x1b, 0x69, 0x20, 0xb0, 0x00, 0x54, 0x58,
-  0x21, 0xb0, 0x40, 0x65, 0x59, 0x59, 0x3a, 0x2d, 0xb8, 0x00, 0x4a, 0x2c,
-  0x20, 0x46, 0xb0, 0x04, 0x25, 0x46, 0x52, 0x58, 0x23, 0x8a, 0x59, 0x20,
-  0x46, 0x20, 0x6a, 0x61, 0x64, 0xb0, 0x04, 0x25, 0x46, 0x20, 0x6a, 0x61,
-  0x64, 0x52, 0x58, 0x23, 0x8a, 0x59, 0x2f, 0xfd, 0x2d, 0xb8, 0x00, 0x4b,
-  0x2c, 0x4b, 0x20, 0xb0, 0x03, 0x26, 0x50, 0x58, 0x51, 0x58, 0xb0, 0x80,
-  0x44, 0x1b, 0xb0, 0x40, 0x44, 0x59, 0x1b, 0x21, 0x21, 0x20, 0x45, 0xb0,
-  0xc0, 0x50, 0x58, 0xb0, 0xc0, 0x44, 0x1b, 0x21, 0x59, 0x59, 0x2d, 0xb8,
-  0x00, 0x4c, 0x2c, 0x20, 0x20, 0x45, 0x69, 0x44, 0xb0, 0x01, 0x60, 0x20,
-  0x20, 0x45, 0x7d, 0x69, 0x18, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb8, 0x00,
-  0x4d, 0x2c, 0xb8, 0x00, 0x4c, 0x2a, 0x2d, 0xb8, 0x00, 0x4e, 0x2c, 0x4b,
-  0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0xb0, 0x40, 0x1b, 0xb0, 0x00, 0x59,
-  0x8a, 0x8a, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb0, 0x80,
-  0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58,
-  0x23, 0x21, 0xb8, 0x00, 0xc0, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20,
-  0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x00, 0x8a, 0x8a,
-  0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21,
-  0xb8, 0x01, 0x40, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb8, 0x00,
-  0x03, 0x26, 0x53, 0x58, 0xb0, 0x03, 0x25, 0x45, 0xb8, 0x01, 0x80, 0x50,
-  0x58, 0x23, 0x21, 0xb8, 0x01, 0x80, 0x23, 0x21, 0x1b, 0xb0, 0x03, 0x25,
-  0x45, 0x23, 0x21, 0x23, 0x21, 0x59, 0x1b, 0x21, 0x59, 0x44, 0x2d, 0xb8,
-  0x00, 0x4f, 0x2c, 0x4b, 0x53, 0x58, 0x45, 0x44, 0x1b, 0x21, 0x21, 0x59,
-  0x2d, 0xb8, 0x00, 0x50, 0x2c, 0x4b, 0xb8, 0x00, 0x0b, 0x50, 0x58, 0xb1,
-  0x01, 0x01, 0x8e, 0x59, 0xb8, 0x01, 0xff, 0x85, 0xb8, 0x00, 0x44, 0x1d,
-  0xb9, 0x00, 0x0b, 0x00, 0x03, 0x5f, 0x5e, 0x2d, 0xb8, 0x00, 0x51, 0x2c,
-  0x20, 0x20, 0x45, 0x69, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb8, 0x00, 0x52,
-  0x2c, 0xb8, 0x00, 0x51, 0x2a, 0x21, 0x2d, 0xb8, 0x00, 0x53, 0x2c, 0x20,
-  0x46, 0xb0, 0x03, 0x25, 0x46, 0x52, 0x58, 0x23, 0x59, 0x20, 0x8a, 0x20,
-  0x8a, 0x49, 0x64, 0x8a, 0x20, 0x46, 0x20, 0x68, 0x61, 0x64, 0xb0, 0x04,
-  0x25, 0x46, 0x20, 0x68, 0x61, 0x64, 0x52, 0x58, 0x23, 0x65, 0x8a, 0x59,
-  0x2f, 0x20, 0xb0, 0x00, 0x53, 0x58, 0x69, 0x20, 0xb0, 0x00, 0x54, 0x58,
-  0x21, 0xb0, 0x40, 0x59, 0x1b, 0x69, 0x20, 0xb0, 0x00, 0x54, 0x58, 0x21,
-  0xb0, 0x40, 0x65, 0x59, 0x59, 0x3a, 0x2d, 0xb8, 0x00, 0x54, 0x2c, 0x20,
-  0x46, 0xb0, 0x04, 0x25, 0x46, 0x52, 0x58, 0x23, 0x8a, 0x59, 0x20, 0x46,
-  0x20, 0x6a, 0x61, 0x64, 0xb0, 0x04, 0x25, 0x46, 0x20, 0x6a, 0x61, 0x64,
-  0x52, 0x58, 0x23, 0x8a, 0x59, 0x2f, 0xfd, 0x2d, 0xb8, 0x00, 0x55, 0x2c,
-  0x4b, 0x20, 0xb0, 0x03, 0x26, 0x50, 0x58, 0x51, 0x58, 0xb0, 0x80, 0x44,
-  0x1b, 0xb0, 0x40, 0x44, 0x59, 0x1b, 0x21, 0x21, 0x20, 0x45, 0xb0, 0xc0,
-  0x50, 0x58, 0xb0, 0xc0, 0x44, 0x1b, 0x21, 0x59, 0x59, 0x2d, 0xb8, 0x00,
-  0x56, 0x2c, 0x20, 0x20, 0x45, 0x69, 0x44, 0xb0, 0x01, 0x60, 0x20, 0x20,
-  0x45, 0x7d, 0x69, 0x18, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb8, 0x00, 0x57,
-  0x2c, 0xb8, 0x00, 0x56, 0x2a, 0x2d, 0xb8, 0x00, 0x58, 0x2c, 0x4b, 0x20,
-  0xb0, 0x03, 0x26, 0x53, 0x58, 0xb0, 0x40, 0x1b, 0xb0, 0x00, 0x59, 0x8a,
-  0x8a, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb0, 0x80, 0x8a,
-  0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23,
-  0x21, 0xb8, 0x00, 0xc0, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0,
-  0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x00, 0x8a, 0x8a, 0x1b,
-  0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8,
-  0x01, 0x40, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb8, 0x00, 0x03,
-  0x26, 0x53, 0x58, 0xb0, 0x03, 0x25, 0x45, 0xb8, 0x01, 0x80, 0x50, 0x58,
-  0x23, 0x21, 0xb8, 0x01, 0x80, 0x23, 0x21, 0x1b, 0xb0, 0x03, 0x25, 0x45,
-  0x23, 0x21, 0x23, 0x21, 0x59, 0x1b, 0x21, 0x59, 0x44, 0x2d, 0xb8, 0x00,
-  0x59, 0x2c, 0x4b, 0x53, 0x58, 0x45, 0x44, 0x1b, 0x21, 0x21, 0x59, 0x2d,
-  0xb8, 0x00, 0x5a, 0x2c, 0x4b, 0xb8, 0x00, 0x0b, 0x50, 0x58, 0xb1, 0x01,
-  0x01, 0x8e, 0x59, 0xb8, 0x01, 0xff, 0x85, 0xb8, 0x00, 0x44, 0x1d, 0xb9,
-  0x00, 0x0b, 0x00, 0x03, 0x5f, 0x5e, 0x2d, 0xb8, 0x00, 0x5b, 0x2c, 0x20,
-  0x20, 0x45, 0x69, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb8, 0x00, 0x5c, 0x2c,
-  0xb8, 0x00, 0x5b, 0x2a, 0x21, 0x2d, 0xb8, 0x00, 0x5d, 0x2c, 0x20, 0x46,
-  0xb0, 0x03, 0x25, 0x46, 0x52, 0x58, 0x23, 0x59, 0x20, 0x8a, 0x20, 0x8a,
-  0x49, 0x64, 0x8a, 0x20, 0x46, 0x20, 0x68, 0x61, 0x64, 0xb0, 0x04, 0x25,
-  0x46, 0x20, 0x68, 0x61, 0x64, 0x52, 0x58, 0x23, 0x65, 0x8a, 0x59, 0x2f,
-  0x20, 0xb0, 0x00, 0x53, 0x58, 0x69, 0x20, 0xb0, 0x00, 0x54, 0x58, 0x21,
-  0xb0, 0x40, 0x59, 0x1b, 0x69, 0x20, 0xb0, 0x00, 0x54, 0x58, 0x21, 0xb0,
-  0x40, 0x65, 0x59, 0x59, 0x3a, 0x2d, 0xb8, 0x00, 0x5e, 0x2c, 0x20, 0x46,
-  0xb0, 0x04, 0x25, 0x46, 0x52, 0x58, 0x23, 0x8a, 0x59, 0x20, 0x46, 0x20,
-  0x6a, 0x61, 0x64, 0xb0, 0x04, 0x25, 0x46, 0x20, 0x6a, 0x61, 0x64, 0x52,
-  0x58, 0x23, 0x8a, 0x59, 0x2f, 0xfd, 0x2d, 0xb8, 0x00, 0x5f, 0x2c, 0x4b,
-  0x20, 0xb0, 0x03, 0x26, 0x50, 0x58, 0x51, 0x58, 0xb0, 0x80, 0x44, 0x1b,
-  0xb0, 0x40, 0x44, 0x59, 0x1b, 0x21, 0x21, 0x20, 0x45, 0xb0, 0xc0, 0x50,
-  0x58, 0xb0, 0xc0, 0x44, 0x1b, 0x21, 0x59, 0x59, 0x2d, 0xb8, 0x00, 0x60,
-  0x2c, 0x20, 0x20, 0x45, 0x69, 0x44, 0xb0, 0x01, 0x60, 0x20, 0x20, 0x45,
-  0x7d, 0x69, 0x18, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb8, 0x00, 0x61, 0x2c,
-  0xb8, 0x00, 0x60, 0x2a, 0x2d, 0xb8, 0x00, 0x62, 0x2c, 0x4b, 0x20, 0xb0,
-  0x03, 0x26, 0x53, 0x58, 0xb0, 0x40, 0x1b, 0xb0, 0x00, 0x59, 0x8a, 0x8a,
-  0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb0, 0x80, 0x8a, 0x8a,
-  0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21,
-  0xb8, 0x00, 0xc0, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03,
-  0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x00, 0x8a, 0x8a, 0x1b, 0x8a,
-  0x23, 0x59, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x01,
-  0x40, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb8, 0x00, 0x03, 0x26,
-  0x53, 0x58, 0xb0, 0x03, 0x25, 0x45, 0xb8, 0x01, 0x80, 0x50, 0x58, 0x23,
-  0x21, 0xb8, 0x01, 0x80, 0x23, 0x21, 0x1b, 0xb0, 0x03, 0x25, 0x45, 0x23,
-  0x21, 0x23, 0x21, 0x59, 0x1b, 0x21, 0x59, 0x44, 0x2d, 0xb8, 0x00, 0x63,
-  0x2c, 0x4b, 0x53, 0x58, 0x45, 0x44, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0xb8,
-  0x00, 0x64, 0x2c, 0x4b, 0xb8, 0x00, 0x0b, 0x50, 0x58, 0xb1, 0x01, 0x01,
-  0x8e, 0x59, 0xb8, 0x01, 0xff, 0x85, 0xb8, 0x00, 0x44, 0x1d, 0xb9, 0x00,
-  0x0b, 0x00, 0x03, 0x5f, 0x5e, 0x2d, 0xb8, 0x00, 0x65, 0x2c, 0x20, 0x20,
-  0x45, 0x69, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb8, 0x00, 0x66, 0x2c, 0xb8,
-  0x00, 0x65, 0x2a, 0x21, 0x2d, 0xb8, 0x00, 0x67, 0x2c, 0x20, 0x46, 0xb0,
-  0x03, 0x25, 0x46, 0x52, 0x58, 0x23, 0x59, 0x20, 0x8a, 0x20, 0x8a, 0x49,
-  0x64, 0x8a, 0x20, 0x46, 0x20, 0x68, 0x61, 0x64, 0xb0, 0x04, 0x25, 0x46,
-  0x20, 0x68, 0x61, 0x64, 0x52, 0x58, 0x23, 0x65, 0x8a, 0x59, 0x2f, 0x20,
-  0xb0, 0x00, 0x53, 0x58, 0x69, 0x20, 0xb0, 0x00, 0x54, 0x58, 0x21, 0xb0,
-  0x40, 0x59, 0x1b, 0x69, 0x20, 0xb0, 0x00, 0x54, 0x58, 0x21, 0xb0, 0x40,
-  0x65, 0x59, 0x59, 0x3a, 0x2d, 0xb8, 0x00, 0x68, 0x2c, 0x20, 0x46, 0xb0,
-  0x04, 0x25, 0x46, 0x52, 0x58, 0x23, 0x8a, 0x59, 0x20, 0x46, 0x20, 0x6a,
-  0x61, 0x64, 0xb0, 0x04, 0x25, 0x46, 0x20, 0x6a, 0x61, 0x64, 0x52, 0x58,
-  0x23, 0x8a, 0x59, 0x2f, 0xfd, 0x2d, 0xb8, 0x00, 0x69, 0x2c, 0x4b, 0x20,
-  0xb0, 0x03, 0x26, 0x50, 0x58, 0x51, 0x58, 0xb0, 0x80, 0x44, 0x1b, 0xb0,
-  0x40, 0x44, 0x59, 0x1b, 0x21, 0x21, 0x20, 0x45, 0xb0, 0xc0, 0x50, 0x58,
-  0xb0, 0xc0, 0x44, 0x1b, 0x21, 0x59, 0x59, 0x2d, 0xb8, 0x00, 0x6a, 0x2c,
-  0x20, 0x20, 0x45, 0x69, 0x44, 0xb0, 0x01, 0x60, 0x20, 0x20, 0x45, 0x7d,
-  0x69, 0x18, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb8, 0x00, 0x6b, 0x2c, 0xb8,
-  0x00, 0x6a, 0x2a, 0x2d, 0xb8, 0x00, 0x6c, 0x2c, 0x4b, 0x20, 0xb0, 0x03,
-  0x26, 0x53, 0x58, 0xb0, 0x40, 0x1b, 0xb0, 0x00, 0x59, 0x8a, 0x8a, 0x20,
-  0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb0, 0x80, 0x8a, 0x8a, 0x1b,
-  0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8,
-  0x00, 0xc0, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03, 0x26,
-  0x53, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x00, 0x8a, 0x8a, 0x1b, 0x8a, 0x23,
-  0x59, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x40,
-  0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb8, 0x00, 0x03, 0x26, 0x53,
-  0x58, 0xb0, 0x03, 0x25, 0x45, 0xb8, 0x01, 0x80, 0x50, 0x58, 0x23, 0x21,
-  0xb8, 0x01, 0x80, 0x23, 0x21, 0x1b, 0xb0, 0x03, 0x25, 0x45, 0x23, 0x21,
-  0x23, 0x21, 0x59, 0x1b, 0x21, 0x59, 0x44, 0x2d, 0xb8, 0x00, 0x6d, 0x2c,
-  0x4b, 0x53, 0x58, 0x45, 0x44, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0xb8, 0x00,
-  0x6e, 0x2c, 0x4b, 0xb8, 0x00, 0x0b, 0x50, 0x58, 0xb1, 0x01, 0x01, 0x8e,
-  0x59, 0xb8, 0x01, 0xff, 0x85, 0xb8, 0x00, 0x44, 0x1d, 0xb9, 0x00, 0x0b,
-  0x00, 0x03, 0x5f, 0x5e, 0x2d, 0xb8, 0x00, 0x6f, 0x2c, 0x20, 0x20, 0x45,
-  0x69, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb8, 0x00, 0x70, 0x2c, 0xb8, 0x00,
-  0x6f, 0x2a, 0x21, 0x2d, 0xb8, 0x00, 0x71, 0x2c, 0x20, 0x46, 0xb0, 0x03,
-  0x25, 0x46, 0x52, 0x58, 0x23, 0x59, 0x20, 0x8a, 0x20, 0x8a, 0x49, 0x64,
-  0x8a, 0x20, 0x46, 0x20, 0x68, 0x61, 0x64, 0xb0, 0x04, 0x25, 0x46, 0x20,
-  0x68, 0x61, 0x64, 0x52, 0x58, 0x23, 0x65, 0x8a, 0x59, 0x2f, 0x20, 0xb0,
-  0x00, 0x53, 0x58, 0x69, 0x20, 0xb0, 0x00, 0x54, 0x58, 0x21, 0xb0, 0x40,
-  0x59, 0x1b, 0x69, 0x20, 0xb0, 0x00, 0x54, 0x58, 0x21, 0xb0, 0x40, 0x65,
-  0x59, 0x59, 0x3a, 0x2d, 0xb8, 0x00, 0x72, 0x2c, 0x20, 0x46, 0xb0, 0x04,
-  0x25, 0x46, 0x52, 0x58, 0x23, 0x8a, 0x59, 0x20, 0x46, 0x20, 0x6a, 0x61,
-  0x64, 0xb0, 0x04, 0x25, 0x46, 0x20, 0x6a, 0x61, 0x64, 0x52, 0x58, 0x23,
-  0x8a, 0x59, 0x2f, 0xfd, 0x2d, 0xb8, 0x00, 0x73, 0x2c, 0x4b, 0x20, 0xb0,
-  0x03, 0x26, 0x50, 0x58, 0x51, 0x58, 0xb0, 0x80, 0x44, 0x1b, 0xb0, 0x40,
-  0x44, 0x59, 0x1b, 0x21, 0x21, 0x20, 0x45, 0xb0, 0xc0, 0x50, 0x58, 0xb0,
-  0xc0, 0x44, 0x1b, 0x21, 0x59, 0x59, 0x2d, 0xb8, 0x00, 0x74, 0x2c, 0x20,
-  0x20, 0x45, 0x69, 0x44, 0xb0, 0x01, 0x60, 0x20, 0x20, 0x45, 0x7d, 0x69,
-  0x18, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb8, 0x00, 0x75, 0x2c, 0xb8, 0x00,
-  0x74, 0x2a, 0x2d, 0xb8, 0x00, 0x76, 0x2c, 0x4b, 0x20, 0xb0, 0x03, 0x26,
-  0x53, 0x58, 0xb0, 0x40, 0x1b, 0xb0, 0x00, 0x59, 0x8a, 0x8a, 0x20, 0xb0,
-  0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb0, 0x80, 0x8a, 0x8a, 0x1b, 0x8a,
-  0x23, 0x59, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x00,
-  0xc0, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03, 0x26, 0x53,
-  0x58, 0x23, 0x21, 0xb8, 0x01, 0x00, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59,
-  0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x40, 0x8a,
-  0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb8, 0x00, 0x03, 0x26, 0x53, 0x58,
-  0xb0, 0x03, 0x25, 0x45, 0xb8, 0x01, 0x80, 0x50, 0x58, 0x23, 0x21, 0xb8,
-  0x01, 0x80, 0x23, 0x21, 0x1b, 0xb0, 0x03, 0x25, 0x45, 0x23, 0x21, 0x23,
-  0x21, 0x59, 0x1b, 0x21, 0x59, 0x44, 0x2d, 0xb8, 0x00, 0x77, 0x2c, 0x4b,
-  0x53, 0x58, 0x45, 0x44, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0xb8, 0x00, 0x78,
-  0x2c, 0x4b, 0xb8, 0x00, 0x0b, 0x50, 0x58, 0xb1, 0x01, 0x01, 0x8e, 0x59,
-  0xb8, 0x01, 0xff, 0x85, 0xb8, 0x00, 0x44, 0x1d, 0xb9, 0x00, 0x0b, 0x00,
-  0x03, 0x5f, 0x5e, 0x2d, 0xb8, 0x00, 0x79, 0x2c, 0x20, 0x20, 0x45, 0x69,
-  0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb8, 0x00, 0x7a, 0x2c, 0xb8, 0x00, 0x79,
-  0x2a, 0x21, 0x2d, 0xb8, 0x00, 0x7b, 0x2c, 0x20, 0x46, 0xb0, 0x03, 0x25,
-  0x46, 0x52, 0x58, 0x23, 0x59, 0x20, 0x8a, 0x20, 0x8a, 0x49, 0x64, 0x8a,
-  0x20, 0x46, 0x20, 0x68, 0x61, 0x64, 0xb0, 0x04, 0x25, 0x46, 0x20, 0x68,
-  0x61, 0x64, 0x52, 0x58, 0x23, 0x65, 0x8a, 0x59, 0x2f, 0x20, 0xb0, 0x00,
-  0x53, 0x58, 0x69, 0x20, 0xb0, 0x00, 0x54, 0x58, 0x21, 0xb0, 0x40, 0x59,
-  0x1b, 0x69, 0x20, 0xb0, 0x00, 0x54, 0x58, 0x21, 0xb0, 0x40, 0x65, 0x59,
-  0x59, 0x3a, 0x2d, 0xb8, 0x00, 0x7c, 0x2c, 0x20, 0x46, 0xb0, 0x04, 0x25,
-  0x46, 0x52, 0x58, 0x23, 0x8a, 0x59, 0x20, 0x46, 0x20, 0x6a, 0x61, 0x64,
-  0xb0, 0x04, 0x25, 0x46, 0x20, 0x6a, 0x61, 0x64, 0x52, 0x58, 0x23, 0x8a,
-  0x59, 0x2f, 0xfd, 0x2d, 0xb8, 0x00, 0x7d, 0x2c, 0x4b, 0x20, 0xb0, 0x03,
-  0x26, 0x50, 0x58, 0x51, 0x58, 0xb0, 0x80, 0x44, 0x1b, 0xb0, 0x40, 0x44,
-  0x59, 0x1b, 0x21, 0x21, 0x20, 0x45, 0xb0, 0xc0, 0x50, 0x58, 0xb0, 0xc0,
-  0x44, 0x1b, 0x21, 0x59, 0x59, 0x2d, 0xb8, 0x00, 0x7e, 0x2c, 0x20, 0x20,
-  0x45, 0x69, 0x44, 0xb0, 0x01, 0x60, 0x20, 0x20, 0x45, 0x7d, 0x69, 0x18,
-  0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb8, 0x00, 0x7f, 0x2c, 0xb8, 0x00, 0x7e,
-  0x2a, 0x2d, 0xb8, 0x00, 0x80, 0x2c, 0x4b, 0x20, 0xb0, 0x03, 0x26, 0x53,
-  0x58, 0xb0, 0x40, 0x1b, 0xb0, 0x00, 0x59, 0x8a, 0x8a, 0x20, 0xb0, 0x03,
-  0x26, 0x53, 0x58, 0x23, 0x21, 0xb0, 0x80, 0x8a, 0x8a, 0x1b, 0x8a, 0x23,
-  0x59, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x00, 0xc0,
-  0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58,
-  0x23, 0x21, 0xb8, 0x01, 0x00, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20,
-  0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x40, 0x8a, 0x8a,
-  0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb8, 0x00, 0x03, 0x26, 0x53, 0x58, 0xb0,
-  0x03, 0x25, 0x45, 0xb8, 0x01, 0x80, 0x50, 0x58, 0x23, 0x21, 0xb8, 0x01,
-  0x80, 0x23, 0x21, 0x1b, 0xb0, 0x03, 0x25, 0x45, 0x23, 0x21, 0x23, 0x21,
-  0x59, 0x1b, 0x21, 0x59, 0x44, 0x2d, 0xb8, 0x00, 0x81, 0x2c, 0x4b, 0x53,
-  0x58, 0x45, 0x44, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0xb8, 0x00, 0x82, 0x2c,
-  0x4b, 0xb8, 0x00, 0x0b, 0x50, 0x58, 0xb1, 0x01, 0x01, 0x8e, 0x59, 0xb8,
-  0x01, 0xff, 0x85, 0xb8, 0x00, 0x44, 0x1d, 0xb9, 0x00, 0x0b, 0x00, 0x03,
-  0x5f, 0x5e, 0x2d, 0xb8, 0x00, 0x83, 0x2c, 0x20, 0x20, 0x45, 0x69, 0x44,
-  0xb0, 0x01, 0x60, 0x2d, 0xb8, 0x00, 0x84, 0x2c, 0xb8, 0x00, 0x83, 0x2a,
-  0x21, 0x2d, 0xb8, 0x00, 0x85, 0x2c, 0x20, 0x46, 0xb0, 0x03, 0x25, 0x46,
-  0x52, 0x58, 0x23, 0x59, 0x20, 0x8a, 0x20, 0x8a, 0x49, 0x64, 0x8a, 0x20,
-  0x46, 0x20, 0x68, 0x61, 0x64, 0xb0, 0x04, 0x25, 0x46, 0x20, 0x68, 0x61,
-  0x64, 0x52, 0x58, 0x23, 0x65, 0x8a, 0x59, 0x2f, 0x20, 0xb0, 0x00, 0x53,
-  0x58, 0x69, 0x20, 0xb0, 0x00, 0x54, 0x58, 0x21, 0xb0, 0x40, 0x59, 0x1b,
-  0x69, 0x20, 0xb0, 0x00, 0x54, 0x58, 0x21, 0xb0, 0x40, 0x65, 0x59, 0x59,
-  0x3a, 0x2d, 0xb8, 0x00, 0x86, 0x2c, 0x20, 0x46, 0xb0, 0x04, 0x25, 0x46,
-  0x52, 0x58, 0x23, 0x8a, 0x59, 0x20, 0x46, 0x20, 0x6a, 0x61, 0x64, 0xb0,
-  0x04, 0x25, 0x46, 0x20, 0x6a, 0x61, 0x64, 0x52, 0x58, 0x23, 0x8a, 0x59,
-  0x2f, 0xfd, 0x2d, 0xb8, 0x00, 0x87, 0x2c, 0x4b, 0x20, 0xb0, 0x03, 0x26,
-  0x50, 0x58, 0x51, 0x58, 0xb0, 0x80, 0x44, 0x1b, 0xb0, 0x40, 0x44, 0x59,
-  0x1b, 0x21, 0x21, 0x20, 0x45, 0xb0, 0xc0, 0x50, 0x58, 0xb0, 0xc0, 0x44,
-  0x1b, 0x21, 0x59, 0x59, 0x2d, 0xb8, 0x00, 0x88, 0x2c, 0x20, 0x20, 0x45,
-  0x69, 0x44, 0xb0, 0x01, 0x60, 0x20, 0x20, 0x45, 0x7d, 0x69, 0x18, 0x44,
-  0xb0, 0x01, 0x60, 0x2d, 0xb8, 0x00, 0x89, 0x2c, 0xb8, 0x00, 0x88, 0x2a,
-  0x2d, 0xb8, 0x00, 0x8a, 0x2c, 0x4b, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58,
-  0xb0, 0x40, 0x1b, 0xb0, 0x00, 0x59, 0x8a, 0x8a, 0x20, 0xb0, 0x03, 0x26,
-  0x53, 0x58, 0x23, 0x21, 0xb0, 0x80, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59,
-  0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x00, 0xc0, 0x8a,
-  0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23,
-  0x21, 0xb8, 0x01, 0x00, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0,
-  0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x40, 0x8a, 0x8a, 0x1b,
-  0x8a, 0x23, 0x59, 0x20, 0xb8, 0x00, 0x03, 0x26, 0x53, 0x58, 0xb0, 0x03,
-  0x25, 0x45, 0xb8, 0x01, 0x80, 0x50, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x80,
-  0x23, 0x21, 0x1b, 0xb0, 0x03, 0x25, 0x45, 0x23, 0x21, 0x23, 0x21, 0x59,
-  0x1b, 0x21, 0x59, 0x44, 0x2d, 0xb8, 0x00, 0x8b, 0x2c, 0x4b, 0x53, 0x58,
-  0x45, 0x44, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0x00, 0xb8, 0x00, 0x82, 0x2b,
-  0xb8, 0x00, 0x78, 0x2b, 0xb8, 0x00, 0x6e, 0x2b, 0xb8, 0x00, 0x64, 0x2b,
-  0xb8, 0x00, 0x5a, 0x2b, 0xb8, 0x00, 0x50, 0x2b, 0xb8, 0x00, 0x46, 0x2b,
-  0xb8, 0x00, 0x3c, 0x2b, 0xb8, 0x00, 0x32, 0x2b, 0xb8, 0x00, 0x28, 0x2b,
-  0xb8, 0x00, 0x1e, 0x2b, 0xb8, 0x00, 0x14, 0x2b, 0xb8, 0x00, 0x0a, 0x2b,
-  0x40, 0x0e, 0x1b, 0x1b, 0x1a, 0x1a, 0x0b, 0x0b, 0x01, 0x01, 0x00, 0x00,
-  0x0f, 0x0f, 0x45, 0x01, 0x8d, 0xb8, 0x01, 0xff, 0x85, 0x76, 0x45, 0x68,
-  0x44, 0x18, 0xb3, 0x02, 0x0b, 0x46, 0x00, 0x2b, 0xb3, 0x03, 0x00, 0x46,
-  0x00, 0x2b, 0xb3, 0x04, 0x01, 0x46, 0x00, 0x2b, 0xb3, 0x05, 0x0b, 0x46,
-  0x00, 0x2b, 0xb3, 0x06, 0x00, 0x46, 0x00, 0x2b, 0xb3, 0x07, 0x01, 0x46,
-  0x00, 0x2b, 0xb3, 0x08, 0x0f, 0x46, 0x00, 0x2b, 0xb3, 0x09, 0x01, 0x46,
-  0x00, 0x2b, 0xb3, 0x0a, 0x00, 0x46, 0x00, 0x2b, 0xb3, 0x0c, 0x01, 0x46,
-  0x00, 0x2b, 0xb3, 0x0d, 0x0b, 0x46, 0x00, 0x2b, 0xb3, 0x0e, 0x01, 0x46,
-  0x00, 0x2b, 0xb3, 0x10, 0x0f, 0x46, 0x00, 0x2b, 0xb3, 0x11, 0x0f, 0x46,
-  0x00, 0x2b, 0xb3, 0x12, 0x0b, 0x46, 0x00, 0x2b, 0xb3, 0x13, 0x0b, 0x46,
-  0x00, 0x2b, 0xb3, 0x14, 0x01, 0x46, 0x00, 0x2b, 0xb3, 0x15, 0x01, 0x46,
-  0x00, 0x2b, 0xb3, 0x16, 0x0f, 0x46, 0x00, 0x2b, 0xb3, 0x17, 0x01, 0x46,
-  0x00, 0x2b, 0xb3, 0x18, 0x01, 0x46, 0x00, 0x2b, 0xb3, 0x19, 0x0b, 0x46,
-  0x00, 0x2b, 0x45, 0x68, 0x44, 0x45, 0x68, 0x44, 0x45, 0x68, 0x44, 0x45,
-  0x68, 0x44, 0x45, 0x68, 0x44, 0x00, 0x00, 0x00, 0x02, 0xbb, 0x01, 0x83,
-  0x00, 0x4b, 0x02, 0x46, 0x02, 0x06, 0x00, 0x00, 0x03, 0x51, 0x01, 0xce,
-  0xff, 0x90, 0x01, 0x9d, 0x02, 0x30, 0x00, 0x00, 0x02, 0x15, 0x00, 0x0e,
-  0x01, 0x39, 0xff, 0x8c, 0xff, 0x45, 0xff, 0xa7, 0x00, 0xb6, 0x00, 0x71,
-  0x01, 0xd5, 0x01, 0x50, 0xff, 0x6b, 0x01, 0x04, 0x00, 0xee, 0x00, 0x8c,
-  0x00, 0x4b, 0x00, 0x4b, 0x00, 0x9e, 0x00, 0x83, 0x00, 0xac, 0x00, 0x82,
-  0x00, 0x1c, 0x00, 0x4b, 0x00, 0x61, 0x00, 0x0e, 0x00, 0x33, 0x00, 0x4a,
-  0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16,
-  0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16,
-  0x00, 0x16, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe0,
-  0x02, 0xd0, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x8f,
-  0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x18, 0x2f, 0xb8, 0x00, 0x13, 0x2f,
-  0xb8, 0x00, 0x10, 0xdc, 0xba, 0x00, 0x00, 0x00, 0x13, 0x00, 0x10, 0x11,
-  0x12, 0x39, 0xb8, 0x00, 0x18, 0x10, 0xb8, 0x00, 0x0d, 0xd0, 0xb8, 0x00,
-  0x0d, 0x2f, 0xb8, 0x00, 0x04, 0xdc, 0xb8, 0x00, 0x07, 0xd0, 0xb8, 0x00,
-  0x07, 0x2f, 0xb8, 0x00, 0x0d, 0x10, 0xb8, 0x00, 0x08, 0xd0, 0xb8, 0x00,
-  0x08, 0x2f, 0xba, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x10, 0x11, 0x12, 0x39,
-  0xb8, 0x00, 0x04, 0x10, 0xb8, 0x00, 0x0f, 0xd0, 0xb8, 0x00, 0x10, 0x10,
-  0xb8, 0x00, 0x19, 0xdc, 0x00, 0xba, 0x00, 0x13, 0x00, 0x00, 0x00, 0x67,
-  0x2b, 0xba, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x13,
-  0x10, 0xb8, 0x00, 0x04, 0xd0, 0xb8, 0x00, 0x14, 0x10, 0xb8, 0x00, 0x07,
-  0xd0, 0xba, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x13, 0x11, 0x12, 0x39, 0xba,
-  0x00, 0x0e, 0x00, 0x14, 0x00, 0x0b, 0x11, 0x12, 0x39, 0x30, 0x31, 0x29,
-  0x01, 0x26, 0x27, 0x37, 0x21, 0x11, 0x21, 0x27, 0x36, 0x37, 0x21, 0x01,
-  0x07, 0x11, 0x17, 0x01, 0x06, 0x07, 0x27, 0x11, 0x37, 0x16, 0x17, 0x01,
-  0x9a, 0xfe, 0x98, 0x28, 0x0a, 0x50, 0x01, 0x2c, 0xfe, 0xd5, 0x50, 0x0a,
-  0x28, 0x01, 0x67, 0xfe, 0xb6, 0x50, 0x50, 0x01, 0x90, 0x0a, 0x28, 0x1e,
-  0x1e, 0x28, 0x0a, 0x0a, 0x28, 0x1e, 0x02, 0x30, 0x1e, 0x28, 0x0a, 0xfd,
-  0x94, 0x1e, 0x02, 0x44, 0x1e, 0xfd, 0xc6, 0x28, 0x0a, 0x50, 0x02, 0x30,
-  0x50, 0x0a, 0x28, 0x00, 0x00, 0x03, 0x00, 0xd2, 0x00, 0x00, 0x01, 0x22,
-  0x02, 0xd0, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x43, 0xb8, 0x00,
-  0x64, 0x2b, 0xba, 0x00, 0x02, 0x00, 0x03, 0x00, 0x67, 0x2b, 0xb8, 0x00,
-  0x03, 0x10, 0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00,
-  0x09, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x0c, 0xd0, 0xb8, 0x00,
-  0x03, 0x10, 0xb8, 0x00, 0x0d, 0xd0, 0x00, 0xb8, 0x00, 0x07, 0x2f, 0xba,
-  0x00, 0x0f, 0x00, 0x0c, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x0f, 0x10, 0xb8,
-  0x00, 0x03, 0xdc, 0x30, 0x31, 0x01, 0x17, 0x15, 0x23, 0x3d, 0x02, 0x37,
-  0x16, 0x17, 0x11, 0x07, 0x13, 0x23, 0x35, 0x33, 0x01, 0x0e, 0x14, 0x50,
-  0x1e, 0x28, 0x0a, 0x14, 0x14, 0x50, 0x50, 0x01, 0x5e, 0x14, 0xaa, 0x82,
-  0x8c, 0xd2, 0x50, 0x0a, 0x28, 0xfe, 0xe8, 0x14, 0xfe, 0x8e, 0x50, 0x00,
-  0x00, 0x02, 0x00, 0x8c, 0x02, 0x08, 0x01, 0x7d, 0x02, 0xd1, 0x00, 0x04,
-  0x00, 0x09, 0x00, 0x3b, 0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x0a, 0x2f,
-  0xb8, 0x00, 0x07, 0x2f, 0xb8, 0x00, 0x0a, 0x10, 0xb8, 0x00, 0x02, 0xd0,
-  0xb8, 0x00, 0x02, 0x2f, 0xb8, 0x00, 0x00, 0xdc, 0xb8, 0x00, 0x07, 0x10,
-  0xb8, 0x00, 0x05, 0xdc, 0xb8, 0x00, 0x0b, 0xdc, 0x00, 0xb8, 0x00, 0x03,
-  0x2f, 0xb8, 0x00, 0x08, 0x2f, 0xb8, 0x00, 0x01, 0x2f, 0xb8, 0x00, 0x06,
-  0x2f, 0x30, 0x31, 0x13, 0x07, 0x27, 0x35, 0x33, 0x17, 0x07, 0x27, 0x35,
-  0x33, 0xdc, 0x28, 0x28, 0x50, 0xa1, 0x28, 0x28, 0x50, 0x02, 0x30, 0x28,
-  0x28, 0xa0, 0x9f, 0x28, 0x28, 0xa0, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1e,
-  0x00, 0x77, 0x01, 0xd6, 0x02, 0x58, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x11,
-  0x00, 0x17, 0x00, 0x1d, 0x00, 0x23, 0x00, 0x29, 0x00, 0x2f, 0x00, 0x35,
-  0x00, 0x3b, 0x00, 0x41, 0x00, 0x47, 0x00, 0xe7, 0xb8, 0x00, 0x64, 0x2b,
-  0xb8, 0x00, 0x48, 0x2f, 0xb8, 0x00, 0x12, 0x2f, 0xb8, 0x00, 0x48, 0x10,
-  0xb8, 0x00, 0x0c, 0xd0, 0xb8, 0x00, 0x0c, 0x2f, 0xb8, 0x00, 0x0e, 0xdc,
-  0xb8, 0x00, 0x12, 0x10, 0xb8, 0x00, 0x14, 0xdc, 0xb8, 0x00, 0x0c, 0x10,
-  0xb8, 0x00, 0x18, 0xd0, 0xb8, 0x00, 0x0e, 0x10, 0xb8, 0x00, 0x1a, 0xd0,
-  0xb8, 0x00, 0x12, 0x10, 0xb8, 0x00, 0x1e, 0xd0, 0xb8, 0x00, 0x14, 0x10,
-  0xb8, 0x00, 0x20, 0xd0, 0xb8, 0x00, 0x12, 0x10, 0xb8, 0x00, 0x24, 0xd0,
-  0xb8, 0x00, 0x14, 0x10, 0xb8, 0x00, 0x26, 0xd0, 0xb8, 0x00, 0x0c, 0x10,
-  0xb8, 0x00, 0x2a, 0xd0, 0xb8, 0x00, 0x0e, 0x10, 0xb8, 0x00, 0x2c, 0xd0,
-  0x00, 0xb8, 0x00, 0x19, 0x2f, 0xb8, 0x00, 0x1f, 0x2f, 0xb8, 0x00, 0x28,
-  0x2f, 0xb8, 0x00, 0x2e, 0x2f, 0xba, 0x00, 0x36, 0x00, 0x38, 0x00, 0x67,
-  0x2b, 0xba, 0x00, 0x42, 0x00, 0x44, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x42,
-  0x10, 0xb8, 0x00, 0x00, 0xd0, 0xb8, 0x00, 0x00, 0x2f, 0xb8, 0x00, 0x44,
-  0x10, 0xb8, 0x00, 0x02, 0xd0, 0xb8, 0x00, 0x02, 0x2f, 0xb8, 0x00, 0x36,
-  0x10, 0xb8, 0x00, 0x06, 0xd0, 0xb8, 0x00, 0x06, 0x2f, 0xb8, 0x00, 0x38,
-  0x10, 0xb8, 0x00, 0x08, 0xd0, 0xb8, 0x00, 0x08, 0x2f, 0xb8, 0x00, 0x36,
-  0x10, 0xb8, 0x00, 0x30, 0xd0, 0xb8, 0x00, 0x30, 0x2f, 0xb8, 0x00, 0x38,
-  0x10, 0xb8, 0x00, 0x32, 0xd0, 0xb8, 0x00, 0x32, 0x2f, 0xb8, 0x00, 0x42,
-  0x10, 0xb8, 0x00, 0x3c, 0xd0, 0xb8, 0x00, 0x3c, 0x2f, 0xb8, 0x00, 0x44,
-  0x10, 0xb8, 0x00, 0x3e, 0xd0, 0xb8, 0x00, 0x3e, 0x2f, 0x30, 0x31, 0x01,
-  0x17, 0x07, 0x23, 0x27, 0x37, 0x1f, 0x01, 0x07, 0x23, 0x27, 0x37, 0x27,
-  0x37, 0x17, 0x15, 0x07, 0x27, 0x3f, 0x01, 0x17, 0x15, 0x07, 0x2f, 0x01,
-  0x37, 0x17, 0x15, 0x07, 0x27, 0x3f, 0x01, 0x17, 0x15, 0x07, 0x27, 0x11,
-  0x37, 0x17, 0x15, 0x07, 0x2f, 0x01, 0x37, 0x17, 0x15, 0x07, 0x2f, 0x01,
-  0x17, 0x07, 0x23, 0x27, 0x37, 0x05, 0x17, 0x07, 0x23, 0x27, 0x3f, 0x01,
-  0x17, 0x07, 0x23, 0x27, 0x37, 0x05, 0x17, 0x07, 0x23, 0x27, 0x37, 0x01,
-  0x0e, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-  0x64, 0x28, 0x28, 0x28, 0x28, 0xa0, 0x28, 0x28, 0x28, 0x28, 0xa0, 0x28,
-  0x28, 0x28, 0x28, 0xa0, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-  0xa0, 0x28, 0x28, 0x28, 0x28, 0x14, 0x28, 0x28, 0x28, 0x28, 0x28, 0x01,
-  0x68, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-  0xfe, 0xe8, 0x28, 0x28, 0x28, 0x28, 0x28, 0x01, 0xe0, 0x28, 0x28, 0x28,
-  0x28, 0xa0, 0x28, 0x28, 0x28, 0x28, 0x3c, 0x28, 0x28, 0x28, 0x28, 0x28,
-  0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xdc, 0x28, 0x28, 0x3c, 0x28, 0x28,
-  0x3c, 0x28, 0x28, 0x3c, 0x28, 0x28, 0xfe, 0xe9, 0x28, 0x28, 0x3d, 0x28,
-  0x28, 0x3c, 0x28, 0x28, 0x3d, 0x28, 0x28, 0xa1, 0x28, 0x28, 0x28, 0x28,
-  0x01, 0x28, 0x28, 0x28, 0x28, 0xa1, 0x28, 0x28, 0x28, 0x28, 0x01, 0x28,
-  0x28, 0x28, 0x28, 0x00, 0x00, 0x09, 0x00, 0x28, 0xff, 0x88, 0x01, 0xcc,
-  0x03, 0x48, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x17, 0x00, 0x1f,
-  0x00, 0x24, 0x00, 0x28, 0x00, 0x2c, 0x00, 0x31, 0x00, 0xc3, 0xb8, 0x00,
-  0x64, 0x2b, 0xba, 0x00, 0x11, 0x00, 0x10, 0x00, 0x67, 0x2b, 0xba, 0x00,
-  0x24, 0x00, 0x20, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x07, 0x00, 0x02, 0x00,
-  0x67, 0x2b, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0xba, 0x00,
-  0x0d, 0x00, 0x02, 0x00, 0x07, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x11, 0x10,
-  0xb8, 0x00, 0x13, 0xd0, 0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00, 0x16, 0xd0,
-  0xb8, 0x00, 0x20, 0x10, 0xb8, 0x00, 0x25, 0xd0, 0xb8, 0x00, 0x24, 0x10,
-  0xb8, 0x00, 0x27, 0xd0, 0xb8, 0x00, 0x20, 0x10, 0xb8, 0x00, 0x29, 0xd0,
-  0xb8, 0x00, 0x24, 0x10, 0xb8, 0x00, 0x2b, 0xd0, 0xb8, 0x00, 0x24, 0x10,
-  0xb8, 0x00, 0x2d, 0xd0, 0xb8, 0x00, 0x20, 0x10, 0xb8, 0x00, 0x30, 0xd0,
-  0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00, 0x33, 0xdc, 0x00, 0xb8, 0x00, 0x22,
-  0x2f, 0xb8, 0x00, 0x2f, 0x2f, 0xba, 0x00, 0x0d, 0x00, 0x2d, 0x00, 0x67,
-  0x2b, 0xba, 0x00, 0x20, 0x00, 0x1b, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x2c,
-  0x00, 0x12, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x18, 0x00, 0x26, 0x00, 0x67,
-  0x2b, 0xba, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x28,
-  0x00, 0x00, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x17, 0x00, 0x2f, 0x00, 0x22,
-  0x11, 0x12, 0x39, 0xb8, 0x00, 0x0c, 0x10, 0xb8, 0x00, 0x2a, 0xd0, 0x30,
-  0x31, 0x01, 0x17, 0x07, 0x21, 0x27, 0x37, 0x05, 0x17, 0x11, 0x06, 0x07,
-  0x27, 0x35, 0x13, 0x21, 0x26, 0x27, 0x37, 0x33, 0x03, 0x15, 0x07, 0x27,
-  0x11, 0x17, 0x27, 0x36, 0x37, 0x21, 0x16, 0x17, 0x07, 0x27, 0x35, 0x37,
-  0x17, 0x15, 0x03, 0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x1d, 0x02, 0x07,
-  0x27, 0x35, 0x01, 0x7c, 0x28, 0x28, 0xfe, 0xfc, 0x28, 0x28, 0x01, 0x40,
-  0x14, 0x0a, 0x28, 0x1e, 0x0a, 0xfe, 0xd4, 0x28, 0x0a, 0x50, 0xf0, 0xf0,
-  0x3c, 0x14, 0x51, 0x50, 0x0a, 0x28, 0x01, 0x3f, 0x28, 0x0a, 0x50, 0xa0,
-  0x28, 0x28, 0x50, 0x50, 0x50, 0x50, 0x28, 0x28, 0x01, 0x90, 0x28, 0x28,
-  0x28, 0x28, 0x32, 0x14, 0xfe, 0xe8, 0x28, 0x0a, 0x50, 0xd2, 0xfe, 0xde,
-  0x0a, 0x28, 0x1e, 0x02, 0x1c, 0xbe, 0x3c, 0x14, 0x01, 0x04, 0x0a, 0x1e,
-  0x28, 0x0a, 0x0a, 0x28, 0x1e, 0x6e, 0x32, 0x28, 0x28, 0x32, 0xfe, 0xc0,
-  0xb4, 0xb4, 0xfe, 0xc0, 0xb4, 0xb4, 0x8c, 0x32, 0x28, 0x28, 0x32, 0x00,
-  0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xd0, 0x00, 0x05,
-  0x00, 0x0b, 0x00, 0x11, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x23, 0x00, 0x29,
-  0x00, 0x2f, 0x00, 0x35, 0x00, 0x3b, 0x00, 0xe9, 0xb8, 0x00, 0x64, 0x2b,
-  0xb8, 0x00, 0x3c, 0x2f, 0xb8, 0x00, 0x2c, 0x2f, 0xb8, 0x00, 0x00, 0xd0,
-  0xb8, 0x00, 0x00, 0x2f, 0xb8, 0x00, 0x3c, 0x10, 0xb8, 0x00, 0x0e, 0xd0,
-  0xb8, 0x00, 0x0e, 0x2f, 0xb8, 0x00, 0x22, 0xdc, 0xb8, 0x00, 0x06, 0xd0,
-  0xb8, 0x00, 0x06, 0x2f, 0xba, 0x00, 0x11, 0x00, 0x0e, 0x00, 0x22, 0x11,
-  0x12, 0x39, 0xb8, 0x00, 0x0e, 0x10, 0xb8, 0x00, 0x16, 0xd0, 0xb8, 0x00,
-  0x22, 0x10, 0xb8, 0x00, 0x1a, 0xd0, 0xba, 0x00, 0x1d, 0x00, 0x0e, 0x00,
-  0x22, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x2c, 0x10, 0xb8, 0x00, 0x28, 0xdc,
-  0xba, 0x00, 0x2f, 0x00, 0x2c, 0x00, 0x28, 0x11, 0x12, 0x39, 0xb8, 0x00,
-  0x2c, 0x10, 0xb8, 0x00, 0x34, 0xd0, 0xba, 0x00, 0x35, 0x00, 0x0e, 0x00,
-  0x28, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x28, 0x10, 0xb8, 0x00, 0x38, 0xd0,
-  0xba, 0x00, 0x3b, 0x00, 0x2c, 0x00, 0x28, 0x11, 0x12, 0x39, 0xb8, 0x00,
-  0x28, 0x10, 0xb8, 0x00, 0x3d, 0xdc, 0x00, 0xba, 0x00, 0x2e, 0x00, 0x32,
-  0x00, 0x67, 0x2b, 0xba, 0x00, 0x10, 0x00, 0x14, 0x00, 0x67, 0x2b, 0xb8,
-  0x00, 0x10, 0x10, 0xb8, 0x00, 0x01, 0xd0, 0xb8, 0x00, 0x32, 0x10, 0xb8,
-  0x00, 0x07, 0xd0, 0xba, 0x00, 0x17, 0x00, 0x14, 0x00, 0x10, 0x11, 0x12,
-  0x39, 0xb8, 0x00, 0x14, 0x10, 0xb8, 0x00, 0x1c, 0xd0, 0xba, 0x00, 0x23,
-  0x00, 0x14, 0x00, 0x10, 0x11, 0x12, 0x39, 0xba, 0x00, 0x29, 0x00, 0x32,
-  0x00, 0x2e, 0x11, 0x12, 0x39, 0xba, 0x00, 0x35, 0x00, 0x32, 0x00, 0x2e,
-  0x11, 0x12, 0x39, 0xb8, 0x00, 0x32, 0x10, 0xb8, 0x00, 0x3a, 0xd0, 0x30,
-  0x31, 0x01, 0x37, 0x32, 0x17, 0x03, 0x23, 0x0f, 0x01, 0x22, 0x27, 0x13,
-  0x33, 0x03, 0x23, 0x27, 0x36, 0x37, 0x33, 0x07, 0x15, 0x07, 0x26, 0x27,
-  0x35, 0x17, 0x33, 0x17, 0x06, 0x07, 0x23, 0x37, 0x35, 0x37, 0x16, 0x17,
-  0x15, 0x13, 0x35, 0x37, 0x16, 0x17, 0x15, 0x27, 0x23, 0x27, 0x36, 0x37,
-  0x33, 0x07, 0x15, 0x07, 0x26, 0x27, 0x35, 0x17, 0x33, 0x17, 0x06, 0x07,
-  0x23, 0x01, 0x05, 0x77, 0x3c, 0x14, 0x9a, 0x2d, 0x16, 0x77, 0x3c, 0x14,
-  0x9a, 0x2d, 0x63, 0x3c, 0x50, 0x0a, 0x28, 0x78, 0x5a, 0x1e, 0x28, 0x0a,
-  0x64, 0x3c, 0x50, 0x0a, 0x28, 0x78, 0x5a, 0x1e, 0x28, 0x0a, 0xb4, 0x1e,
-  0x28, 0x0a, 0x64, 0x3c, 0x50, 0x0a, 0x28, 0x78, 0x5a, 0x1e, 0x28, 0x0a,
-  0x64, 0x3c, 0x50, 0x0a, 0x28, 0x78, 0x01, 0xde, 0xf2, 0x28, 0xfe, 0xca,
-  0x80, 0xf2, 0x28, 0x01, 0x36, 0x01, 0x22, 0x1e, 0x28, 0x0a, 0x64, 0x3c,
-  0x50, 0x0a, 0x28, 0x78, 0x5a, 0x1e, 0x28, 0x0a, 0x64, 0x3c, 0x50, 0x0a,
-  0x28, 0x78, 0xfe, 0x3e, 0x3c, 0x50, 0x0a, 0x28, 0x78, 0x5a, 0x1e, 0x28,
-  0x0a, 0x64, 0x3c, 0x50, 0x0a, 0x28, 0x78, 0x5a, 0x1e, 0x28, 0x0a, 0x00,
-  0x00, 0x08, 0x00, 0x28, 0xff, 0xa6, 0x01, 0xf4, 0x02, 0xa8, 0x00, 0x05,
-  0x00, 0x0b, 0x00, 0x12, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x22, 0x00, 0x29,
-  0x00, 0x2e, 0x00, 0xaf, 0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00, 0x10, 0x00,
-  0x13, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x28, 0x00, 0x23, 0x00, 0x67, 0x2b,
-  0xba, 0x00, 0x02, 0x00, 0x23, 0x00, 0x28, 0x11, 0x12, 0x39, 0xb8, 0x00,
-  0x02, 0x2f, 0xb8, 0x00, 0x07, 0xdc, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00,
-  0x0a, 0xd0, 0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00, 0x16, 0xd0, 0xba, 0x00,
-  0x1d, 0x00, 0x23, 0x00, 0x28, 0x11, 0x12, 0x39, 0xba, 0x00, 0x21, 0x00,
-  0x13, 0x00, 0x10, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x21, 0x2f, 0xb8, 0x00,
-  0x1f, 0xdc, 0xba, 0x00, 0x22, 0x00, 0x13, 0x00, 0x10, 0x11, 0x12, 0x39,
-  0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00, 0x2a, 0xd0, 0xb8, 0x00, 0x02, 0x10,
-  0xb8, 0x00, 0x2d, 0xd0, 0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00, 0x30, 0xdc,
-  0x00, 0xb8, 0x00, 0x2c, 0x2f, 0xba, 0x00, 0x1d, 0x00, 0x24, 0x00, 0x67,
-  0x2b, 0xba, 0x00, 0x11, 0x00, 0x0c, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x13, 0x00, 0x0c, 0x00, 0x11,
-  0x11, 0x12, 0x39, 0xb8, 0x00, 0x24, 0x10, 0xb8, 0x00, 0x19, 0xd0, 0xba,
-  0x00, 0x22, 0x00, 0x24, 0x00, 0x1d, 0x11, 0x12, 0x39, 0x30, 0x31, 0x01,
-  0x17, 0x07, 0x21, 0x27, 0x37, 0x05, 0x17, 0x15, 0x23, 0x27, 0x35, 0x13,
-  0x21, 0x26, 0x27, 0x37, 0x21, 0x17, 0x25, 0x11, 0x37, 0x17, 0x15, 0x13,
-  0x23, 0x27, 0x36, 0x37, 0x33, 0x07, 0x15, 0x07, 0x27, 0x35, 0x05, 0x35,
-  0x37, 0x16, 0x17, 0x15, 0x07, 0x13, 0x15, 0x07, 0x27, 0x35, 0x01, 0x7c,
-  0x28, 0x28, 0xfe, 0xfc, 0x28, 0x28, 0x01, 0x40, 0x14, 0x32, 0x1e, 0x64,
-  0xfe, 0x7a, 0x28, 0x0a, 0x50, 0x01, 0x40, 0x3c, 0xfe, 0x34, 0x14, 0x3c,
-  0xc8, 0xa0, 0x50, 0x0a, 0x28, 0xdc, 0xbe, 0x3c, 0x14, 0x01, 0x04, 0x1e,
-  0x28, 0x0a, 0x14, 0x3c, 0x14, 0x3c, 0x01, 0x90, 0x28, 0x28, 0x28, 0x28,
-  0x32, 0x14, 0xe6, 0x1e, 0xa0, 0xfe, 0xde, 0x0a, 0x28, 0x1e, 0x3c, 0x32,
-  0x01, 0x04, 0x14, 0x3c, 0xbe, 0x01, 0xf4, 0x1e, 0x28, 0x0a, 0x64, 0x6e,
-  0x3c, 0x14, 0xb4, 0x8c, 0x82, 0x50, 0x0a, 0x28, 0xc8, 0x14, 0xfe, 0x52,
-  0x32, 0x14, 0x3c, 0x0a, 0x00, 0x01, 0x00, 0xdc, 0x02, 0x08, 0x01, 0x2c,
-  0x02, 0xd0, 0x00, 0x04, 0x00, 0x17, 0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x67, 0x2b, 0x00, 0xb8, 0x00, 0x01, 0x2f, 0xb8,
-  0x00, 0x03, 0x2f, 0x30, 0x31, 0x01, 0x07, 0x27, 0x35, 0x33, 0x01, 0x2c,
-  0x28, 0x28, 0x50, 0x02, 0x30, 0x28, 0x28, 0xa0, 0x00, 0x04, 0x00, 0x28,
-  0x00, 0x00, 0x01, 0x22, 0x02, 0xd0, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x11,
-  0x00, 0x17, 0x00, 0x2f, 0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00, 0x0b, 0x00,
-  0x07, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x0b, 0x10, 0xb8, 0x00, 0x12, 0xd0,
-  0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00, 0x15, 0xd0, 0x00, 0xba, 0x00, 0x11,
-  0x00, 0x0d, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x04, 0x00, 0x00, 0x00, 0x67,
-  0x2b, 0x30, 0x31, 0x13, 0x23, 0x27, 0x37, 0x33, 0x17, 0x03, 0x27, 0x35,
-  0x37, 0x17, 0x15, 0x13, 0x07, 0x23, 0x27, 0x37, 0x33, 0x27, 0x15, 0x07,
-  0x27, 0x35, 0x37, 0xfa, 0x6e, 0x28, 0x28, 0x6e, 0x28, 0xe6, 0x14, 0x32,
-  0x1e, 0xaa, 0x28, 0x6e, 0x28, 0x28, 0x6e, 0x82, 0x1e, 0x32, 0x14, 0x02,
-  0x80, 0x28, 0x28, 0x28, 0xfe, 0xca, 0x14, 0xe6, 0x32, 0x1e, 0xd2, 0xfe,
-  0x7a, 0x28, 0x28, 0x28, 0xd2, 0xd2, 0x1e, 0x32, 0xe6, 0x14, 0x00, 0x00,
-  0x00, 0x04, 0x00, 0xbe, 0x00, 0x00, 0x01, 0xb8, 0x02, 0xd0, 0x00, 0x05,
-  0x00, 0x0b, 0x00, 0x11, 0x00, 0x17, 0x00, 0x37, 0xb8, 0x00, 0x64, 0x2b,
-  0xba, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x0a, 0x10,
-  0xb8, 0x00, 0x12, 0xd0, 0xb8, 0x00, 0x08, 0x10, 0xb8, 0x00, 0x15, 0xd0,
-  0xb8, 0x00, 0x08, 0x10, 0xb8, 0x00, 0x19, 0xdc, 0x00, 0xba, 0x00, 0x01,
-  0x00, 0x03, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x0e, 0x00, 0x10, 0x00, 0x67,
-  0x2b, 0x30, 0x31, 0x37, 0x33, 0x17, 0x07, 0x23, 0x27, 0x13, 0x17, 0x15,
-  0x07, 0x27, 0x35, 0x03, 0x37, 0x33, 0x17, 0x07, 0x23, 0x17, 0x35, 0x37,
-  0x17, 0x15, 0x07, 0xe6, 0x6e, 0x28, 0x28, 0x6e, 0x28, 0xe6, 0x14, 0x32,
-  0x1e, 0xaa, 0x28, 0x6e, 0x28, 0x28, 0x6e, 0x82, 0x1e, 0x32, 0x14, 0x50,
-  0x28, 0x28, 0x28, 0x01, 0x36, 0x14, 0xe6, 0x32, 0x1e, 0xd2, 0x01, 0x86,
-  0x28, 0x28, 0x28, 0xd2, 0xd2, 0x1e, 0x32, 0xe6, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x55, 0x00, 0xaa, 0x01, 0x9f, 0x02, 0x26, 0x00, 0x17,
-  0x00, 0x63, 0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x67, 0x2b, 0xb8, 0x00, 0x04, 0x10, 0xb8, 0x00, 0x0c, 0xd0, 0xb8, 0x00,
-  0x00, 0x10, 0xb8, 0x00, 0x0f, 0xd0, 0x00, 0xb8, 0x00, 0x02, 0x2f, 0xb8,
-  0x00, 0x0e, 0x2f, 0xba, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x02, 0x11, 0x12,
-  0x39, 0xba, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x02, 0x11, 0x12, 0x39, 0xba,
-  0x00, 0x08, 0x00, 0x0e, 0x00, 0x02, 0x11, 0x12, 0x39, 0xba, 0x00, 0x0c,
-  0x00, 0x0e, 0x00, 0x02, 0x11, 0x12, 0x39, 0xba, 0x00, 0x10, 0x00, 0x0e,
-  0x00, 0x02, 0x11, 0x12, 0x39, 0xba, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x02,
-  0x11, 0x12, 0x39, 0x30, 0x31, 0x13, 0x35, 0x37, 0x17, 0x15, 0x37, 0x17,
-  0x0f, 0x01, 0x1f, 0x01, 0x07, 0x27, 0x15, 0x07, 0x27, 0x35, 0x07, 0x27,
-  0x3f, 0x01, 0x2f, 0x01, 0x37, 0xd2, 0x28, 0x28, 0x46, 0x37, 0x0f, 0x45,
-  0x45, 0x0f, 0x37, 0x46, 0x28, 0x28, 0x46, 0x37, 0x0f, 0x45, 0x45, 0x0f,
-  0x37, 0x01, 0xae, 0x50, 0x28, 0x28, 0x50, 0x28, 0x0f, 0x37, 0x28, 0x28,
-  0x37, 0x0f, 0x28, 0x50, 0x28, 0x28, 0x50, 0x28, 0x0f, 0x37, 0x28, 0x28,
-  0x37, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0xbe, 0x01, 0xa4,
-  0x02, 0x12, 0x00, 0x0f, 0x00, 0x3f, 0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x04, 0x10, 0xb8, 0x00,
-  0x08, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0x00, 0xb8,
-  0x00, 0x0a, 0x2f, 0xb8, 0x00, 0x02, 0x2f, 0xba, 0x00, 0x05, 0x00, 0x07,
-  0x00, 0x67, 0x2b, 0xb8, 0x00, 0x05, 0x10, 0xb8, 0x00, 0x00, 0xd0, 0xb8,
-  0x00, 0x07, 0x10, 0xb8, 0x00, 0x0c, 0xd0, 0x30, 0x31, 0x13, 0x35, 0x37,
-  0x17, 0x15, 0x33, 0x17, 0x07, 0x23, 0x15, 0x07, 0x27, 0x35, 0x23, 0x27,
-  0x37, 0xd2, 0x28, 0x28, 0x5a, 0x28, 0x28, 0x5a, 0x28, 0x28, 0x5a, 0x28,
-  0x28, 0x01, 0x90, 0x5a, 0x28, 0x28, 0x5a, 0x28, 0x28, 0x5a, 0x28, 0x28,
-  0x5a, 0x28, 0x28, 0x00, 0x00, 0x01, 0x00, 0xd2, 0xff, 0x88, 0x01, 0x22,
-  0x00, 0x50, 0x00, 0x04, 0x00, 0x17, 0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x67, 0x2b, 0x00, 0xb8, 0x00, 0x01, 0x2f, 0xb8,
-  0x00, 0x03, 0x2f, 0x30, 0x31, 0x05, 0x07, 0x27, 0x35, 0x33, 0x01, 0x22,
-  0x28, 0x28, 0x50, 0x50, 0x28, 0x28, 0xa0, 0x00, 0x00, 0x01, 0x00, 0x50,
-  0x01, 0x40, 0x01, 0xa4, 0x01, 0x90, 0x00, 0x05, 0x00, 0x0f, 0xb8, 0x00,
-  0x64, 0x2b, 0x00, 0xba, 0x00, 0x00, 0x00, 0x02, 0x00, 0x67, 0x2b, 0x30,
-  0x31, 0x01, 0x17, 0x07, 0x21, 0x27, 0x37, 0x01, 0x7c, 0x28, 0x28, 0xfe,
-  0xfc, 0x28, 0x28, 0x01, 0x90, 0x28, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0xd2, 0x00, 0x00, 0x01, 0x22, 0x00, 0x50, 0x00, 0x03,
-  0x00, 0x17, 0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x67, 0x2b, 0x00, 0xba, 0x00, 0x03, 0x00, 0x00, 0x00, 0x67, 0x2b, 0x30,
-  0x31, 0x21, 0x23, 0x35, 0x33, 0x01, 0x22, 0x50, 0x50, 0x50, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05,
-  0x00, 0x0b, 0x00, 0x0f, 0xb8, 0x00, 0x64, 0x2b, 0x00, 0xb8, 0x00, 0x01,
-  0x2f, 0xb8, 0x00, 0x07, 0x2f, 0x30, 0x31, 0x01, 0x37, 0x32, 0x17, 0x03,
-  0x23, 0x0f, 0x01, 0x22, 0x27, 0x13, 0x33, 0x01, 0x05, 0x77, 0x3c, 0x14,
-  0x9a, 0x2d, 0x16, 0x77, 0x3c, 0x14, 0x9a, 0x2d, 0x01, 0xde, 0xf2, 0x28,
-  0xfe, 0xca, 0x80, 0xf2, 0x28, 0x01, 0x36, 0x00, 0x00, 0x06, 0x00, 0x28,
-  0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x11,
-  0x00, 0x17, 0x00, 0x1c, 0x00, 0x23, 0x00, 0xaf, 0xb8, 0x00, 0x64, 0x2b,
-  0xb8, 0x00, 0x24, 0x2f, 0xb8, 0x00, 0x05, 0x2f, 0xb8, 0x00, 0x02, 0xdc,
-  0xba, 0x00, 0x07, 0x00, 0x05, 0x00, 0x02, 0x11, 0x12, 0x39, 0xb8, 0x00,
-  0x24, 0x10, 0xb8, 0x00, 0x0d, 0xd0, 0xb8, 0x00, 0x0d, 0x2f, 0xb8, 0x00,
-  0x0b, 0xdc, 0xb8, 0x00, 0x10, 0xd0, 0xb8, 0x00, 0x0b, 0x10, 0xb8, 0x00,
-  0x13, 0xd0, 0xb8, 0x00, 0x13, 0x2f, 0xb8, 0x00, 0x0d, 0x10, 0xb8, 0x00,
-  0x14, 0xd0, 0xb8, 0x00, 0x14, 0x2f, 0xba, 0x00, 0x17, 0x00, 0x05, 0x00,
-  0x02, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x0b, 0x10, 0xb8, 0x00, 0x18, 0xd0,
-  0xb8, 0x00, 0x0d, 0x10, 0xb8, 0x00, 0x1b, 0xd0, 0xb8, 0x00, 0x05, 0x10,
-  0xb8, 0x00, 0x1d, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x21, 0xd0,
-  0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x25, 0xdc, 0x00, 0xba, 0x00, 0x05,
-  0x00, 0x07, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x17, 0x00, 0x1e, 0x00, 0x67,
-  0x2b, 0xb8, 0x00, 0x05, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0xba, 0x00, 0x0d,
-  0x00, 0x07, 0x00, 0x05, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x1e, 0x10, 0xb8,
-  0x00, 0x13, 0xd0, 0xba, 0x00, 0x1c, 0x00, 0x1e, 0x00, 0x17, 0x11, 0x12,
-  0x39, 0x30, 0x31, 0x01, 0x17, 0x11, 0x06, 0x07, 0x27, 0x35, 0x13, 0x21,
-  0x26, 0x27, 0x37, 0x33, 0x05, 0x11, 0x37, 0x17, 0x15, 0x13, 0x23, 0x27,
-  0x36, 0x37, 0x21, 0x05, 0x15, 0x07, 0x27, 0x11, 0x05, 0x35, 0x37, 0x16,
-  0x17, 0x11, 0x07, 0x01, 0xb8, 0x14, 0x0a, 0x28, 0x1e, 0x0a, 0xfe, 0xd4,
-  0x28, 0x0a, 0x50, 0xf0, 0xfe, 0xc0, 0x14, 0x3c, 0xf0, 0xef, 0x50, 0x0a,
-  0x28, 0x01, 0x2b, 0xfe, 0xf2, 0x3c, 0x14, 0x01, 0x54, 0x1e, 0x28, 0x0a,
-  0x14, 0x01, 0x5e, 0x14, 0xfe, 0xe8, 0x28, 0x0a, 0x50, 0xd2, 0xfe, 0xde,
-  0x0a, 0x28, 0x1e, 0x0a, 0x01, 0x04, 0x14, 0x3c, 0xbe, 0x02, 0x1c, 0x1e,
-  0x28, 0x0a, 0x64, 0xbe, 0x3c, 0x14, 0x01, 0x04, 0xdc, 0xd2, 0x50, 0x0a,
-  0x28, 0xfe, 0xe8, 0x14, 0x00, 0x02, 0x01, 0x7c, 0x00, 0x00, 0x01, 0xcc,
-  0x02, 0xd0, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x2f, 0xb8, 0x00, 0x5a, 0x2b,
-  0xba, 0x00, 0x02, 0x00, 0x05, 0x00, 0x5d, 0x2b, 0xb8, 0x00, 0x05, 0x10,
-  0xb8, 0x00, 0x07, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x0b, 0xd0,
-  0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x0f, 0xdc, 0x00, 0xb8, 0x00, 0x04,
-  0x2f, 0xb8, 0x00, 0x09, 0x2f, 0x30, 0x31, 0x01, 0x17, 0x11, 0x06, 0x07,
-  0x27, 0x3d, 0x02, 0x37, 0x16, 0x17, 0x11, 0x07, 0x01, 0xb8, 0x14, 0x0a,
-  0x28, 0x1e, 0x1e, 0x28, 0x0a, 0x14, 0x01, 0x5e, 0x14, 0xfe, 0xe8, 0x28,
-  0x0a, 0x50, 0xd2, 0x8c, 0xd2, 0x50, 0x0a, 0x28, 0xfe, 0xe8, 0x14, 0x00,
-  0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05,
-  0x00, 0x0b, 0x00, 0x10, 0x00, 0x16, 0x00, 0x1d, 0x00, 0xa5, 0xb8, 0x00,
-  0x64, 0x2b, 0xb8, 0x00, 0x1e, 0x2f, 0xb8, 0x00, 0x00, 0x2f, 0xb8, 0x00,
-  0x02, 0xd0, 0xb8, 0x00, 0x1e, 0x10, 0xb8, 0x00, 0x0c, 0xd0, 0xb8, 0x00,
-  0x0c, 0x2f, 0xb8, 0x00, 0x0a, 0xdc, 0xb8, 0x00, 0x03, 0xd0, 0xb8, 0x00,
-  0x0a, 0x10, 0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00,
-  0x1c, 0xdc, 0xba, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1c, 0x11, 0x12, 0x39,
-  0xb8, 0x00, 0x0a, 0x10, 0xb8, 0x00, 0x0f, 0xd0, 0xb8, 0x00, 0x0a, 0x10,
-  0xb8, 0x00, 0x12, 0xd0, 0xb8, 0x00, 0x12, 0x2f, 0xb8, 0x00, 0x0c, 0x10,
-  0xb8, 0x00, 0x13, 0xd0, 0xb8, 0x00, 0x13, 0x2f, 0xba, 0x00, 0x16, 0x00,
-  0x00, 0x00, 0x1c, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00,
-  0x17, 0xd0, 0xb8, 0x00, 0x1c, 0x10, 0xb8, 0x00, 0x1f, 0xdc, 0x00, 0xba,
-  0x00, 0x0b, 0x00, 0x06, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x16, 0x00, 0x18,
-  0x00, 0x67, 0x2b, 0xba, 0x00, 0x00, 0x00, 0x02, 0x00, 0x67, 0x2b, 0xba,
-  0x00, 0x0c, 0x00, 0x06, 0x00, 0x0b, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x18,
-  0x10, 0xb8, 0x00, 0x12, 0xd0, 0x30, 0x31, 0x01, 0x17, 0x07, 0x21, 0x27,
-  0x37, 0x01, 0x21, 0x26, 0x27, 0x37, 0x21, 0x05, 0x11, 0x37, 0x17, 0x15,
-  0x13, 0x23, 0x27, 0x36, 0x37, 0x21, 0x03, 0x35, 0x37, 0x16, 0x17, 0x11,
-  0x07, 0x01, 0x7c, 0x28, 0x28, 0xfe, 0xfc, 0x28, 0x28, 0x01, 0x2c, 0xfe,
-  0xb6, 0x28, 0x0a, 0x50, 0x01, 0x0e, 0xfe, 0xa2, 0x14, 0x3c, 0xf0, 0xef,
-  0x50, 0x0a, 0x28, 0x01, 0x2b, 0x0a, 0x1e, 0x28, 0x0a, 0x14, 0x01, 0x90,
-  0x28, 0x28, 0x28, 0x28, 0xfe, 0x70, 0x0a, 0x28, 0x1e, 0x0a, 0x01, 0x04,
-  0x14, 0x3c, 0xbe, 0x02, 0x1c, 0x1e, 0x28, 0x0a, 0xfe, 0xde, 0xd2, 0x50,
-  0x0a, 0x28, 0xfe, 0xe8, 0x14, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x28,
-  0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x12,
-  0x00, 0x18, 0x00, 0x1f, 0x00, 0x6b, 0xb8, 0x00, 0x5a, 0x2b, 0xba, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x5d, 0x2b, 0xb8, 0x00, 0x1e, 0x10, 0xb8, 0x00,
-  0x07, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0xba, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x1e, 0x11, 0x12, 0x39, 0xba, 0x00, 0x18, 0x00,
-  0x00, 0x00, 0x1e, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00,
-  0x19, 0xd0, 0xb8, 0x00, 0x1e, 0x10, 0xb8, 0x00, 0x21, 0xdc, 0x00, 0xba,
-  0x00, 0x0b, 0x00, 0x0d, 0x00, 0x5d, 0x2b, 0xba, 0x00, 0x18, 0x00, 0x1a,
-  0x00, 0x5d, 0x2b, 0xba, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5d, 0x2b, 0xb8,
-  0x00, 0x0b, 0x10, 0xb8, 0x00, 0x11, 0xd0, 0xb8, 0x00, 0x1a, 0x10, 0xb8,
-  0x00, 0x14, 0xd0, 0x30, 0x31, 0x01, 0x17, 0x07, 0x21, 0x27, 0x37, 0x05,
-  0x17, 0x11, 0x06, 0x07, 0x27, 0x35, 0x13, 0x21, 0x26, 0x27, 0x37, 0x33,
-  0x11, 0x23, 0x27, 0x36, 0x37, 0x21, 0x03, 0x35, 0x37, 0x16, 0x17, 0x11,
-  0x07, 0x01, 0x7c, 0x28, 0x28, 0xfe, 0xfc, 0x28, 0x28, 0x01, 0x40, 0x14,
-  0x0a, 0x28, 0x1e, 0x0a, 0xfe, 0xd4, 0x28, 0x0a, 0x50, 0xf0, 0xef, 0x50,
-  0x0a, 0x28, 0x01, 0x2b, 0x0a, 0x1e, 0x28, 0x0a, 0x14, 0x01, 0x90, 0x28,
-  0x28, 0x28, 0x28, 0x32, 0x14, 0xfe, 0xe8, 0x28, 0x0a, 0x50, 0xd2, 0xfe,
-  0xde, 0x0a, 0x28, 0x1e, 0x02, 0x30, 0x1e, 0x28, 0x0a, 0xfe, 0xde, 0xd2,
-  0x50, 0x0a, 0x28, 0xfe, 0xe8, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x28,
-  0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x11,
-  0x00, 0x18, 0x00, 0x6d, 0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x19, 0x2f,
-  0xb8, 0x00, 0x00, 0x2f, 0xb8, 0x00, 0x02, 0xd0, 0xb8, 0x00, 0x19, 0x10,
-  0xb8, 0x00, 0x10, 0xd0, 0xb8, 0x00, 0x10, 0x2f, 0xb8, 0x00, 0x05, 0xdc,
-  0xb8, 0x00, 0x03, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x17, 0xdc,
-  0xb8, 0x00, 0x07, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x0b, 0xd0,
-  0xb8, 0x00, 0x05, 0x10, 0xb8, 0x00, 0x0d, 0xd0, 0xb8, 0x00, 0x00, 0x10,
-  0xb8, 0x00, 0x12, 0xd0, 0xb8, 0x00, 0x17, 0x10, 0xb8, 0x00, 0x1a, 0xdc,
-  0x00, 0xb8, 0x00, 0x14, 0x2f, 0xb8, 0x00, 0x0a, 0x2f, 0xba, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x11, 0x00, 0x0a, 0x00, 0x14,
-  0x11, 0x12, 0x39, 0x30, 0x31, 0x01, 0x17, 0x07, 0x21, 0x27, 0x37, 0x05,
-  0x17, 0x11, 0x06, 0x07, 0x27, 0x35, 0x01, 0x15, 0x07, 0x27, 0x11, 0x05,
-  0x35, 0x37, 0x16, 0x17, 0x11, 0x07, 0x01, 0x7c, 0x28, 0x28, 0xfe, 0xfc,
-  0x28, 0x28, 0x01, 0x40, 0x14, 0x0a, 0x28, 0x1e, 0xfe, 0xfc, 0x3c, 0x14,
-  0x01, 0x54, 0x1e, 0x28, 0x0a, 0x14, 0x01, 0x90, 0x28, 0x28, 0x28, 0x28,
-  0x32, 0x14, 0xfe, 0xe8, 0x28, 0x0a, 0x50, 0xd2, 0x01, 0x68, 0xdc, 0x3c,
-  0x14, 0x01, 0x22, 0xfa, 0xd2, 0x50, 0x0a, 0x28, 0xfe, 0xe8, 0x14, 0x00,
-  0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05,
-  0x00, 0x0c, 0x00, 0x12, 0x00, 0x18, 0x00, 0x1d, 0x00, 0xad, 0xb8, 0x00,
-  0x64, 0x2b, 0xb8, 0x00, 0x1e, 0x2f, 0xb8, 0x00, 0x02, 0x2f, 0xb8, 0x00,
-  0x00, 0xd0, 0xb8, 0x00, 0x1e, 0x10, 0xb8, 0x00, 0x10, 0xd0, 0xb8, 0x00,
-  0x10, 0x2f, 0xb8, 0x00, 0x11, 0xdc, 0xb8, 0x00, 0x03, 0xd0, 0xb8, 0x00,
-  0x11, 0x10, 0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00,
-  0x07, 0xdc, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0xba, 0x00,
-  0x0d, 0x00, 0x02, 0x00, 0x07, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x11, 0x10,
-  0xb8, 0x00, 0x14, 0xd0, 0xb8, 0x00, 0x14, 0x2f, 0xb8, 0x00, 0x10, 0x10,
-  0xb8, 0x00, 0x15, 0xd0, 0xb8, 0x00, 0x15, 0x2f, 0xba, 0x00, 0x18, 0x00,
-  0x02, 0x00, 0x07, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x11, 0x10, 0xb8, 0x00,
-  0x19, 0xd0, 0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00, 0x1c, 0xd0, 0xb8, 0x00,
-  0x07, 0x10, 0xb8, 0x00, 0x1f, 0xdc, 0x00, 0xba, 0x00, 0x0b, 0x00, 0x0d,
-  0x00, 0x67, 0x2b, 0xba, 0x00, 0x18, 0x00, 0x13, 0x00, 0x67, 0x2b, 0xba,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x0b, 0x10, 0xb8,
-  0x00, 0x11, 0xd0, 0xba, 0x00, 0x1d, 0x00, 0x13, 0x00, 0x18, 0x11, 0x12,
-  0x39, 0x30, 0x31, 0x01, 0x17, 0x07, 0x21, 0x27, 0x37, 0x05, 0x17, 0x11,
-  0x06, 0x07, 0x27, 0x35, 0x13, 0x21, 0x26, 0x27, 0x37, 0x33, 0x13, 0x21,
-  0x27, 0x36, 0x37, 0x21, 0x05, 0x15, 0x07, 0x27, 0x11, 0x01, 0x7c, 0x28,
-  0x28, 0xfe, 0xfc, 0x28, 0x28, 0x01, 0x40, 0x14, 0x0a, 0x28, 0x1e, 0x0a,
-  0xfe, 0xd4, 0x28, 0x0a, 0x50, 0xf0, 0x1e, 0xfe, 0xf3, 0x50, 0x0a, 0x28,
-  0x01, 0x49, 0xfe, 0xd4, 0x3c, 0x14, 0x01, 0x90, 0x28, 0x28, 0x28, 0x28,
-  0x32, 0x14, 0xfe, 0xe8, 0x28, 0x0a, 0x50, 0xd2, 0xfe, 0xde, 0x0a, 0x28,
-  0x1e, 0x02, 0x30, 0x1e, 0x28, 0x0a, 0x64, 0xbe, 0x3c, 0x14, 0x01, 0x04,
-  0x00, 0x06, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05,
-  0x00, 0x0c, 0x00, 0x12, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x22, 0x00, 0xbf,
-  0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x23, 0x2f, 0xb8, 0x00, 0x02, 0x2f,
-  0xb8, 0x00, 0x00, 0xd0, 0xb8, 0x00, 0x23, 0x10, 0xb8, 0x00, 0x13, 0xd0,
-  0xb8, 0x00, 0x13, 0x2f, 0xb8, 0x00, 0x11, 0xdc, 0xb8, 0x00, 0x03, 0xd0,
-  0xb8, 0x00, 0x11, 0x10, 0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00, 0x02, 0x10,
-  0xb8, 0x00, 0x07, 0xdc, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x0b, 0xd0,
-  0xba, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x07, 0x11, 0x12, 0x39, 0xb8, 0x00,
-  0x11, 0x10, 0xb8, 0x00, 0x16, 0xd0, 0xb8, 0x00, 0x11, 0x10, 0xb8, 0x00,
-  0x19, 0xd0, 0xb8, 0x00, 0x19, 0x2f, 0xb8, 0x00, 0x13, 0x10, 0xb8, 0x00,
-  0x1a, 0xd0, 0xb8, 0x00, 0x1a, 0x2f, 0xba, 0x00, 0x1d, 0x00, 0x02, 0x00,
-  0x07, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x11, 0x10, 0xb8, 0x00, 0x1e, 0xd0,
-  0xb8, 0x00, 0x13, 0x10, 0xb8, 0x00, 0x21, 0xd0, 0xb8, 0x00, 0x07, 0x10,
-  0xb8, 0x00, 0x24, 0xdc, 0x00, 0xba, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x67,
-  0x2b, 0xba, 0x00, 0x1d, 0x00, 0x18, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x0b, 0x10, 0xb8, 0x00, 0x11,
-  0xd0, 0xba, 0x00, 0x13, 0x00, 0x0d, 0x00, 0x0b, 0x11, 0x12, 0x39, 0xba,
-  0x00, 0x22, 0x00, 0x18, 0x00, 0x1d, 0x11, 0x12, 0x39, 0x30, 0x31, 0x01,
-  0x17, 0x07, 0x21, 0x27, 0x37, 0x05, 0x17, 0x11, 0x06, 0x07, 0x27, 0x35,
-  0x13, 0x21, 0x26, 0x27, 0x37, 0x33, 0x05, 0x11, 0x37, 0x17, 0x15, 0x01,
-  0x21, 0x27, 0x36, 0x37, 0x21, 0x05, 0x15, 0x07, 0x27, 0x11, 0x01, 0x7c,
-  0x28, 0x28, 0xfe, 0xfc, 0x28, 0x28, 0x01, 0x40, 0x14, 0x0a, 0x28, 0x1e,
-  0x0a, 0xfe, 0xd4, 0x28, 0x0a, 0x50, 0xf0, 0xfe, 0xc0, 0x14, 0x3c, 0x01,
-  0x0e, 0xfe, 0xf3, 0x50, 0x0a, 0x28, 0x01, 0x49, 0xfe, 0xd4, 0x3c, 0x14,
-  0x01, 0x90, 0x28, 0x28, 0x28, 0x28, 0x32, 0x14, 0xfe, 0xe8, 0x28, 0x0a,
-  0x50, 0xd2, 0xfe, 0xde, 0x0a, 0x28, 0x1e, 0x0a, 0x01, 0x04, 0x14, 0x3c,
-  0xbe, 0x02, 0x1c, 0x1e, 0x28, 0x0a, 0x64, 0xbe, 0x3c, 0x14, 0x01, 0x04,
-  0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x06,
-  0x00, 0x0c, 0x00, 0x11, 0x00, 0x18, 0x00, 0x77, 0xb8, 0x00, 0x5a, 0x2b,
-  0xb8, 0x00, 0x19, 0x2f, 0xb8, 0x00, 0x05, 0x2f, 0xb8, 0x00, 0x02, 0xdc,
-  0xb8, 0x00, 0x19, 0x10, 0xb8, 0x00, 0x10, 0xd0, 0xb8, 0x00, 0x10, 0x2f,
-  0xb8, 0x00, 0x0e, 0xdc, 0xb8, 0x00, 0x08, 0xd0, 0xb8, 0x00, 0x08, 0x2f,
-  0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00, 0x09, 0xd0, 0xb8, 0x00, 0x09, 0x2f,
-  0xba, 0x00, 0x0c, 0x00, 0x05, 0x00, 0x02, 0x11, 0x12, 0x39, 0xb8, 0x00,
-  0x05, 0x10, 0xb8, 0x00, 0x12, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00,
-  0x16, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x1a, 0xdc, 0x00, 0xb8,
-  0x00, 0x04, 0x2f, 0xba, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x5d, 0x2b, 0xb8,
-  0x00, 0x13, 0x10, 0xb8, 0x00, 0x08, 0xd0, 0xba, 0x00, 0x11, 0x00, 0x13,
-  0x00, 0x0c, 0x11, 0x12, 0x39, 0x30, 0x31, 0x01, 0x17, 0x11, 0x06, 0x07,
-  0x27, 0x35, 0x03, 0x23, 0x27, 0x36, 0x37, 0x21, 0x05, 0x15, 0x07, 0x27,
-  0x11, 0x05, 0x35, 0x37, 0x16, 0x17, 0x11, 0x07, 0x01, 0xb8, 0x14, 0x0a,
-  0x28, 0x1e, 0x14, 0xef, 0x50, 0x0a, 0x28, 0x01, 0x2b, 0xfe, 0xf2, 0x3c,
-  0x14, 0x01, 0x54, 0x1e, 0x28, 0x0a, 0x14, 0x01, 0x5e, 0x14, 0xfe, 0xe8,
-  0x28, 0x0a, 0x50, 0xd2, 0x01, 0x5e, 0x1e, 0x28, 0x0a, 0x64, 0xbe, 0x3c,
-  0x14, 0x01, 0x04, 0xdc, 0xd2, 0x50, 0x0a, 0x28, 0xfe, 0xe8, 0x14, 0x00,
-  0x00, 0x07, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05,
-  0x00, 0x0c, 0x00, 0x12, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x22, 0x00, 0x29,
-  0x00, 0xd3, 0xb8, 0x00, 0x5a, 0x2b, 0xb8, 0x00, 0x2a, 0x2f, 0xb8, 0x00,
-  0x00, 0x2f, 0xb8, 0x00, 0x02, 0xd0, 0xb8, 0x00, 0x2a, 0x10, 0xb8, 0x00,
-  0x13, 0xd0, 0xb8, 0x00, 0x13, 0x2f, 0xb8, 0x00, 0x11, 0xdc, 0xb8, 0x00,
-  0x03, 0xd0, 0xb8, 0x00, 0x11, 0x10, 0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00,
-  0x00, 0x10, 0xb8, 0x00, 0x28, 0xdc, 0xb8, 0x00, 0x07, 0xd0, 0xb8, 0x00,
-  0x00, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0xba, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0x28, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x11, 0x10, 0xb8, 0x00, 0x16, 0xd0,
-  0xb8, 0x00, 0x11, 0x10, 0xb8, 0x00, 0x19, 0xd0, 0xb8, 0x00, 0x19, 0x2f,
-  0xb8, 0x00, 0x13, 0x10, 0xb8, 0x00, 0x1a, 0xd0, 0xb8, 0x00, 0x1a, 0x2f,
-  0xba, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x28, 0x11, 0x12, 0x39, 0xb8, 0x00,
-  0x11, 0x10, 0xb8, 0x00, 0x1e, 0xd0, 0xb8, 0x00, 0x13, 0x10, 0xb8, 0x00,
-  0x21, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x23, 0xd0, 0xb8, 0x00,
-  0x28, 0x10, 0xb8, 0x00, 0x2b, 0xdc, 0x00, 0xba, 0x00, 0x0b, 0x00, 0x0d,
-  0x00, 0x5d, 0x2b, 0xba, 0x00, 0x1d, 0x00, 0x24, 0x00, 0x5d, 0x2b, 0xba,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x5d, 0x2b, 0xb8, 0x00, 0x0b, 0x10, 0xb8,
-  0x00, 0x11, 0xd0, 0xba, 0x00, 0x13, 0x00, 0x0d, 0x00, 0x0b, 0x11, 0x12,
-  0x39, 0xb8, 0x00, 0x24, 0x10, 0xb8, 0x00, 0x19, 0xd0, 0xba, 0x00, 0x22,
-  0x00, 0x24, 0x00, 0x1d, 0x11, 0x12, 0x39, 0x30, 0x31, 0x01, 0x17, 0x07,
-  0x21, 0x27, 0x37, 0x05, 0x17, 0x11, 0x06, 0x07, 0x27, 0x35, 0x13, 0x21,
-  0x26, 0x27, 0x37, 0x33, 0x05, 0x11, 0x37, 0x17, 0x15, 0x13, 0x23, 0x27,
-  0x36, 0x37, 0x21, 0x05, 0x15, 0x07, 0x27, 0x11, 0x05, 0x35, 0x37, 0x16,
-  0x17, 0x11, 0x07, 0x01, 0x7c, 0x28, 0x28, 0xfe, 0xfc, 0x28, 0x28, 0x01,
-  0x40, 0x14, 0x0a, 0x28, 0x1e, 0x0a, 0xfe, 0xd4, 0x28, 0x0a, 0x50, 0xf0,
-  0xfe, 0xc0, 0x14, 0x3c, 0xf0, 0xef, 0x50, 0x0a, 0x28, 0x01, 0x2b, 0xfe,
-  0xf2, 0x3c, 0x14, 0x01, 0x54, 0x1e, 0x28, 0x0a, 0x14, 0x01, 0x90, 0x28,
-  0x28, 0x28, 0x28, 0x32, 0x14, 0xfe, 0xe8, 0x28, 0x0a, 0x50, 0xd2, 0xfe,
-  0xde, 0x0a, 0x28, 0x1e, 0x0a, 0x01, 0x04, 0x14, 0x3c, 0xbe, 0x02, 0x1c,
-  0x1e, 0x28, 0x0a, 0x64, 0xbe, 0x3c, 0x14, 0x01, 0x04, 0xdc, 0xd2, 0x50,
-  0x0a, 0x28, 0xfe, 0xe8, 0x14, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x28,
-  0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x12,
-  0x00, 0x18, 0x00, 0x1d, 0x00, 0x24, 0x00, 0xc1, 0xb8, 0x00, 0x5a, 0x2b,
-  0xb8, 0x00, 0x25, 0x2f, 0xb8, 0x00, 0x00, 0x2f, 0xb8, 0x00, 0x02, 0xd0,
-  0xb8, 0x00, 0x25, 0x10, 0xb8, 0x00, 0x10, 0xd0, 0xb8, 0x00, 0x10, 0x2f,
-  0xb8, 0x00, 0x11, 0xdc, 0xb8, 0x00, 0x03, 0xd0, 0xb8, 0x00, 0x11, 0x10,
-  0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x23, 0xdc,
-  0xb8, 0x00, 0x07, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x0b, 0xd0,
-  0xba, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x23, 0x11, 0x12, 0x39, 0xb8, 0x00,
-  0x11, 0x10, 0xb8, 0x00, 0x14, 0xd0, 0xb8, 0x00, 0x14, 0x2f, 0xb8, 0x00,
-  0x10, 0x10, 0xb8, 0x00, 0x15, 0xd0, 0xb8, 0x00, 0x15, 0x2f, 0xba, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x23, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x11, 0x10,
-  0xb8, 0x00, 0x19, 0xd0, 0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00, 0x1c, 0xd0,
-  0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x1e, 0xd0, 0xb8, 0x00, 0x23, 0x10,
-  0xb8, 0x00, 0x26, 0xdc, 0x00, 0xba, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x5d,
-  0x2b, 0xba, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x5d, 0x2b, 0xba, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x5d, 0x2b, 0xb8, 0x00, 0x0b, 0x10, 0xb8, 0x00, 0x11,
-  0xd0, 0xb8, 0x00, 0x1f, 0x10, 0xb8, 0x00, 0x14, 0xd0, 0xba, 0x00, 0x1d,
-  0x00, 0x1f, 0x00, 0x18, 0x11, 0x12, 0x39, 0x30, 0x31, 0x01, 0x17, 0x07,
-  0x21, 0x27, 0x37, 0x05, 0x17, 0x11, 0x06, 0x07, 0x27, 0x35, 0x13, 0x21,
-  0x26, 0x27, 0x37, 0x33, 0x11, 0x23, 0x27, 0x36, 0x37, 0x21, 0x05, 0x15,
-  0x07, 0x27, 0x11, 0x05, 0x35, 0x37, 0x16, 0x17, 0x11, 0x07, 0x01, 0x7c,
-  0x28, 0x28, 0xfe, 0xfc, 0x28, 0x28, 0x01, 0x40, 0x14, 0x0a, 0x28, 0x1e,
-  0x0a, 0xfe, 0xd4, 0x28, 0x0a, 0x50, 0xf0, 0xef, 0x50, 0x0a, 0x28, 0x01,
-  0x2b, 0xfe, 0xf2, 0x3c, 0x14, 0x01, 0x54, 0x1e, 0x28, 0x0a, 0x14, 0x01,
-  0x90, 0x28, 0x28, 0x28, 0x28, 0x32, 0x14, 0xfe, 0xe8, 0x28, 0x0a, 0x50,
-  0xd2, 0xfe, 0xde, 0x0a, 0x28, 0x1e, 0x02, 0x30, 0x1e, 0x28, 0x0a, 0x64,
-  0xbe, 0x3c, 0x14, 0x01, 0x04, 0xdc, 0xd2, 0x50, 0x0a, 0x28, 0xfe, 0xe8,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xd2, 0x00, 0xa0, 0x01, 0x22,
-  0x02, 0x30, 0x00, 0x03, 0x00, 0x07, 0x00, 0x2f, 0xb8, 0x00, 0x82, 0x2b,
-  0xba, 0x00, 0x00, 0x00, 0x01, 0x00, 0x85, 0x2b, 0xb8, 0x00, 0x00, 0x10,
-  0xb8, 0x00, 0x04, 0xd0, 0xb8, 0x00, 0x01, 0x10, 0xb8, 0x00, 0x05, 0xd0,
-  0x00, 0xba, 0x00, 0x03, 0x00, 0x00, 0x00, 0x85, 0x2b, 0xba, 0x00, 0x07,
-  0x00, 0x04, 0x00, 0x85, 0x2b, 0x30, 0x31, 0x25, 0x23, 0x35, 0x33, 0x35,
-  0x23, 0x35, 0x33, 0x01, 0x22, 0x50, 0x50, 0x50, 0x50, 0xa0, 0x50, 0xf0,
-  0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xd2, 0xff, 0x88, 0x01, 0x22,
-  0x02, 0x30, 0x00, 0x03, 0x00, 0x08, 0x00, 0x2b, 0xb8, 0x00, 0x64, 0x2b,
-  0xba, 0x00, 0x00, 0x00, 0x01, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x00, 0x10,
-  0xb8, 0x00, 0x04, 0xd0, 0xb8, 0x00, 0x01, 0x10, 0xb8, 0x00, 0x06, 0xd0,
-  0x00, 0xb8, 0x00, 0x05, 0x2f, 0xba, 0x00, 0x03, 0x00, 0x00, 0x00, 0x67,
-  0x2b, 0x30, 0x31, 0x01, 0x23, 0x35, 0x33, 0x11, 0x07, 0x27, 0x35, 0x33,
-  0x01, 0x22, 0x50, 0x50, 0x28, 0x28, 0x50, 0x01, 0xe0, 0x50, 0xfd, 0x80,
-  0x28, 0x28, 0xa0, 0x00, 0x00, 0x02, 0x00, 0x64, 0x00, 0x96, 0x01, 0x72,
-  0x02, 0x3a, 0x00, 0x04, 0x00, 0x09, 0x00, 0x23, 0xb8, 0x00, 0x64, 0x2b,
-  0x00, 0xb8, 0x00, 0x02, 0x2f, 0xb8, 0x00, 0x06, 0x2f, 0xba, 0x00, 0x01,
-  0x00, 0x06, 0x00, 0x02, 0x11, 0x12, 0x39, 0xba, 0x00, 0x08, 0x00, 0x06,
-  0x00, 0x02, 0x11, 0x12, 0x39, 0x30, 0x31, 0x13, 0x23, 0x37, 0x33, 0x17,
-  0x11, 0x07, 0x23, 0x27, 0x33, 0xd2, 0x6e, 0xc8, 0x28, 0x1e, 0x1e, 0x28,
-  0xc8, 0x6e, 0x01, 0x72, 0xc8, 0x27, 0xfe, 0xaa, 0x27, 0xc8, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x50, 0x00, 0xef, 0x01, 0xa4, 0x01, 0xe0, 0x00, 0x05,
-  0x00, 0x0b, 0x00, 0x17, 0xb8, 0x00, 0x64, 0x2b, 0x00, 0xba, 0x00, 0x06,
-  0x00, 0x08, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x00, 0x00, 0x02, 0x00, 0x67,
-  0x2b, 0x30, 0x31, 0x01, 0x17, 0x07, 0x21, 0x27, 0x37, 0x05, 0x17, 0x07,
-  0x21, 0x27, 0x37, 0x01, 0x7c, 0x28, 0x28, 0xfe, 0xfc, 0x28, 0x28, 0x01,
-  0x04, 0x28, 0x28, 0xfe, 0xfc, 0x28, 0x28, 0x01, 0xe0, 0x28, 0x28, 0x28,
-  0x28, 0xa1, 0x28, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x02, 0x00, 0x64,
-  0x00, 0x96, 0x01, 0x72, 0x02, 0x3a, 0x00, 0x04, 0x00, 0x09, 0x00, 0x23,
-  0xb8, 0x00, 0x64, 0x2b, 0x00, 0xb8, 0x00, 0x01, 0x2f, 0xb8, 0x00, 0x07,
-  0x2f, 0xba, 0x00, 0x03, 0x00, 0x07, 0x00, 0x01, 0x11, 0x12, 0x39, 0xba,
-  0x00, 0x06, 0x00, 0x07, 0x00, 0x01, 0x11, 0x12, 0x39, 0x30, 0x31, 0x13,
-  0x37, 0x33, 0x17, 0x23, 0x15, 0x33, 0x07, 0x23, 0x27, 0x64, 0x1e, 0x28,
-  0xc8, 0x6e, 0x6e, 0xc8, 0x28, 0x1e, 0x02, 0x13, 0x27, 0xc8, 0x14, 0xc8,
-  0x27, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc,
-  0x02, 0xd0, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x17, 0x00, 0x1b,
-  0x00, 0x99, 0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x1c, 0x2f, 0xb8, 0x00,
-  0x00, 0x2f, 0xb8, 0x00, 0x02, 0xd0, 0xb8, 0x00, 0x1c, 0x10, 0xb8, 0x00,
-  0x06, 0xd0, 0xb8, 0x00, 0x06, 0x2f, 0xb8, 0x00, 0x0a, 0xdc, 0xb8, 0x00,
-  0x03, 0xd0, 0xb8, 0x00, 0x0a, 0x10, 0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00,
-  0x0a, 0x10, 0xb8, 0x00, 0x0c, 0xd0, 0xb8, 0x00, 0x0c, 0x2f, 0xb8, 0x00,
-  0x06, 0x10, 0xb8, 0x00, 0x0d, 0xd0, 0xb8, 0x00, 0x0d, 0x2f, 0xb8, 0x00,
-  0x00, 0x10, 0xb8, 0x00, 0x16, 0xdc, 0xba, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x16, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x11, 0xd0,
-  0xb8, 0x00, 0x0a, 0x10, 0xb8, 0x00, 0x18, 0xd0, 0xb8, 0x00, 0x06, 0x10,
-  0xb8, 0x00, 0x19, 0xd0, 0xb8, 0x00, 0x16, 0x10, 0xb8, 0x00, 0x1d, 0xdc,
-  0x00, 0xba, 0x00, 0x1b, 0x00, 0x18, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x10,
-  0x00, 0x12, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x00, 0x00, 0x02, 0x00, 0x67,
-  0x2b, 0xb8, 0x00, 0x12, 0x10, 0xb8, 0x00, 0x0c, 0xd0, 0x30, 0x31, 0x01,
-  0x17, 0x07, 0x21, 0x27, 0x37, 0x07, 0x35, 0x37, 0x17, 0x15, 0x13, 0x23,
-  0x27, 0x36, 0x37, 0x21, 0x03, 0x35, 0x37, 0x16, 0x17, 0x11, 0x07, 0x01,
-  0x23, 0x35, 0x33, 0x01, 0x7c, 0x28, 0x28, 0xfe, 0xfc, 0x28, 0x28, 0x50,
-  0x14, 0x3c, 0xf0, 0xef, 0x50, 0x0a, 0x28, 0x01, 0x2b, 0x0a, 0x1e, 0x28,
-  0x0a, 0x14, 0xfe, 0xc0, 0x50, 0x50, 0x01, 0x90, 0x28, 0x28, 0x28, 0x28,
-  0xf0, 0xaa, 0x14, 0x3c, 0x82, 0x01, 0xe0, 0x1e, 0x28, 0x0a, 0xfe, 0xde,
-  0xd2, 0x50, 0x0a, 0x28, 0xfe, 0xe8, 0x14, 0xfe, 0x8e, 0x50, 0x00, 0x00,
-  0x00, 0x0a, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x06,
-  0x00, 0x0c, 0x00, 0x11, 0x00, 0x17, 0x00, 0x1c, 0x00, 0x23, 0x00, 0x29,
-  0x00, 0x2e, 0x00, 0x33, 0x00, 0x39, 0x00, 0xcd, 0xb8, 0x00, 0x64, 0x2b,
-  0xba, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x29, 0x00,
-  0x2a, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x02, 0x00, 0x05, 0x00, 0x67, 0x2b,
-  0xba, 0x00, 0x07, 0x00, 0x05, 0x00, 0x02, 0x11, 0x12, 0x39, 0xb8, 0x00,
-  0x0b, 0x10, 0xb8, 0x00, 0x10, 0xd0, 0xba, 0x00, 0x17, 0x00, 0x05, 0x00,
-  0x02, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x0b, 0x10, 0xb8, 0x00, 0x18, 0xd0,
-  0xb8, 0x00, 0x0d, 0x10, 0xb8, 0x00, 0x1b, 0xd0, 0xb8, 0x00, 0x05, 0x10,
-  0xb8, 0x00, 0x1d, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x21, 0xd0,
-  0xb8, 0x00, 0x2a, 0x10, 0xb8, 0x00, 0x32, 0xd0, 0xba, 0x00, 0x33, 0x00,
-  0x0d, 0x00, 0x02, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x29, 0x10, 0xb8, 0x00,
-  0x34, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x3b, 0xdc, 0x00, 0xba,
-  0x00, 0x0c, 0x00, 0x07, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x17, 0x00, 0x1e,
-  0x00, 0x67, 0x2b, 0xba, 0x00, 0x28, 0x00, 0x25, 0x00, 0x67, 0x2b, 0xba,
-  0x00, 0x39, 0x00, 0x34, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x0d, 0x00, 0x07,
-  0x00, 0x0c, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x1e, 0x10, 0xb8, 0x00, 0x13,
-  0xd0, 0xba, 0x00, 0x1c, 0x00, 0x1e, 0x00, 0x17, 0x11, 0x12, 0x39, 0xba,
-  0x00, 0x2a, 0x00, 0x25, 0x00, 0x28, 0x11, 0x12, 0x39, 0xba, 0x00, 0x33,
-  0x00, 0x34, 0x00, 0x39, 0x11, 0x12, 0x39, 0x30, 0x31, 0x01, 0x17, 0x15,
-  0x06, 0x07, 0x27, 0x35, 0x13, 0x21, 0x26, 0x27, 0x37, 0x33, 0x05, 0x11,
-  0x37, 0x17, 0x15, 0x13, 0x23, 0x27, 0x36, 0x37, 0x21, 0x05, 0x15, 0x07,
-  0x27, 0x11, 0x05, 0x35, 0x37, 0x16, 0x17, 0x11, 0x0f, 0x02, 0x26, 0x27,
-  0x37, 0x33, 0x07, 0x35, 0x37, 0x17, 0x15, 0x35, 0x15, 0x07, 0x27, 0x35,
-  0x17, 0x23, 0x27, 0x36, 0x37, 0x17, 0x01, 0xb8, 0x14, 0x0a, 0x28, 0x1e,
-  0x0a, 0xfe, 0xd4, 0x28, 0x0a, 0x50, 0xf0, 0xfe, 0xc0, 0x14, 0x3c, 0xf0,
-  0xef, 0x50, 0x0a, 0x28, 0x01, 0x2b, 0xfe, 0xf2, 0x3c, 0x14, 0x01, 0x54,
-  0x1e, 0x28, 0x0a, 0x14, 0x32, 0x8c, 0x28, 0x0a, 0x50, 0x50, 0xa0, 0x14,
-  0x3c, 0x3c, 0x14, 0xa0, 0x50, 0x50, 0x0a, 0x28, 0x6e, 0x01, 0x5e, 0x14,
-  0x78, 0x28, 0x0a, 0x50, 0x32, 0xfe, 0xde, 0x0a, 0x28, 0x1e, 0x0a, 0x01,
-  0x04, 0x14, 0x3c, 0xbe, 0x02, 0x1c, 0x1e, 0x28, 0x0a, 0x64, 0xbe, 0x3c,
-  0x14, 0x01, 0x04, 0xdc, 0xd2, 0x50, 0x0a, 0x28, 0xfe, 0xe8, 0x14, 0xd2,
-  0x01, 0x0a, 0x28, 0x1f, 0x0a, 0x64, 0x14, 0x3c, 0x1e, 0xc8, 0x1e, 0x3c,
-  0x14, 0x64, 0x0a, 0x1f, 0x28, 0x0a, 0x01, 0x00, 0x00, 0x06, 0x00, 0x28,
-  0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x12,
-  0x00, 0x17, 0x00, 0x1e, 0x00, 0x25, 0x00, 0xaf, 0xb8, 0x00, 0x64, 0x2b,
-  0xb8, 0x00, 0x26, 0x2f, 0xb8, 0x00, 0x00, 0x2f, 0xb8, 0x00, 0x02, 0xd0,
-  0xb8, 0x00, 0x26, 0x10, 0xb8, 0x00, 0x16, 0xd0, 0xb8, 0x00, 0x16, 0x2f,
-  0xb8, 0x00, 0x05, 0xdc, 0xb8, 0x00, 0x03, 0xd0, 0xb8, 0x00, 0x00, 0x10,
-  0xb8, 0x00, 0x1d, 0xdc, 0xb8, 0x00, 0x07, 0xd0, 0xb8, 0x00, 0x00, 0x10,
-  0xb8, 0x00, 0x0b, 0xd0, 0xb8, 0x00, 0x05, 0x10, 0xb8, 0x00, 0x0e, 0xd0,
-  0xb8, 0x00, 0x0e, 0x2f, 0xb8, 0x00, 0x16, 0x10, 0xb8, 0x00, 0x0f, 0xd0,
-  0xb8, 0x00, 0x0f, 0x2f, 0xba, 0x00, 0x12, 0x00, 0x00, 0x00, 0x1d, 0x11,
-  0x12, 0x39, 0xb8, 0x00, 0x05, 0x10, 0xb8, 0x00, 0x13, 0xd0, 0xb8, 0x00,
-  0x00, 0x10, 0xb8, 0x00, 0x18, 0xd0, 0xb8, 0x00, 0x05, 0x10, 0xb8, 0x00,
-  0x1f, 0xd0, 0xb8, 0x00, 0x16, 0x10, 0xb8, 0x00, 0x23, 0xd0, 0xb8, 0x00,
-  0x1d, 0x10, 0xb8, 0x00, 0x27, 0xdc, 0x00, 0xb8, 0x00, 0x0a, 0x2f, 0xb8,
-  0x00, 0x21, 0x2f, 0xba, 0x00, 0x12, 0x00, 0x19, 0x00, 0x67, 0x2b, 0xba,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x19, 0x10, 0xb8,
-  0x00, 0x0e, 0xd0, 0xba, 0x00, 0x17, 0x00, 0x19, 0x00, 0x12, 0x11, 0x12,
-  0x39, 0x30, 0x31, 0x01, 0x17, 0x07, 0x21, 0x27, 0x37, 0x05, 0x17, 0x11,
-  0x06, 0x07, 0x27, 0x35, 0x03, 0x23, 0x27, 0x36, 0x37, 0x21, 0x05, 0x15,
-  0x07, 0x27, 0x11, 0x05, 0x35, 0x37, 0x16, 0x17, 0x11, 0x07, 0x05, 0x15,
-  0x07, 0x26, 0x27, 0x11, 0x37, 0x01, 0x7c, 0x28, 0x28, 0xfe, 0xfc, 0x28,
-  0x28, 0x01, 0x40, 0x14, 0x0a, 0x28, 0x1e, 0x14, 0xef, 0x50, 0x0a, 0x28,
-  0x01, 0x2b, 0xfe, 0xf2, 0x3c, 0x14, 0x01, 0x54, 0x1e, 0x28, 0x0a, 0x14,
-  0xfe, 0xc0, 0x1e, 0x28, 0x0a, 0x14, 0x01, 0x90, 0x28, 0x28, 0x28, 0x28,
-  0x32, 0x14, 0xfe, 0xe8, 0x28, 0x0a, 0x50, 0xd2, 0x01, 0x5e, 0x1e, 0x28,
-  0x0a, 0x64, 0xbe, 0x3c, 0x14, 0x01, 0x04, 0xdc, 0xd2, 0x50, 0x0a, 0x28,
-  0xfe, 0xe8, 0x14, 0x50, 0xd2, 0x50, 0x0a, 0x28, 0x01, 0x18, 0x14, 0x00,
-  0x00, 0x07, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05,
-  0x00, 0x0a, 0x00, 0x10, 0x00, 0x15, 0x00, 0x1b, 0x00, 0x21, 0x00, 0x27,
-  0x00, 0xaf, 0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x28, 0x2f, 0xb8, 0x00,
-  0x00, 0x2f, 0xb8, 0x00, 0x02, 0xd0, 0xb8, 0x00, 0x28, 0x10, 0xb8, 0x00,
-  0x06, 0xd0, 0xb8, 0x00, 0x06, 0x2f, 0xb8, 0x00, 0x26, 0xdc, 0xb8, 0x00,
-  0x03, 0xd0, 0xb8, 0x00, 0x26, 0x10, 0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00,
-  0x26, 0x10, 0xb8, 0x00, 0x09, 0xd0, 0xb8, 0x00, 0x26, 0x10, 0xb8, 0x00,
-  0x0c, 0xd0, 0xb8, 0x00, 0x06, 0x10, 0xb8, 0x00, 0x0d, 0xd0, 0xb8, 0x00,
-  0x26, 0x10, 0xb8, 0x00, 0x11, 0xd0, 0xb8, 0x00, 0x06, 0x10, 0xb8, 0x00,
-  0x14, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x16, 0xd0, 0xb8, 0x00,
-  0x00, 0x10, 0xb8, 0x00, 0x1a, 0xdc, 0xb8, 0x00, 0x1d, 0xd0, 0xb8, 0x00,
-  0x00, 0x10, 0xb8, 0x00, 0x20, 0xd0, 0xb8, 0x00, 0x06, 0x10, 0xb8, 0x00,
-  0x24, 0xd0, 0xb8, 0x00, 0x1a, 0x10, 0xb8, 0x00, 0x29, 0xdc, 0x00, 0xba,
-  0x00, 0x27, 0x00, 0x23, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x0f, 0x00, 0x0b,
-  0x00, 0x67, 0x2b, 0xba, 0x00, 0x00, 0x00, 0x02, 0x00, 0x67, 0x2b, 0xba,
-  0x00, 0x06, 0x00, 0x23, 0x00, 0x27, 0x11, 0x12, 0x39, 0xba, 0x00, 0x15,
-  0x00, 0x0b, 0x00, 0x0f, 0x11, 0x12, 0x39, 0x30, 0x31, 0x01, 0x17, 0x07,
-  0x21, 0x27, 0x37, 0x03, 0x11, 0x37, 0x17, 0x15, 0x13, 0x23, 0x27, 0x35,
-  0x21, 0x17, 0x05, 0x15, 0x07, 0x27, 0x11, 0x05, 0x35, 0x37, 0x17, 0x15,
-  0x07, 0x15, 0x17, 0x15, 0x07, 0x27, 0x35, 0x17, 0x07, 0x21, 0x35, 0x37,
-  0x33, 0x01, 0x7c, 0x28, 0x28, 0xfe, 0xfc, 0x28, 0x28, 0x50, 0x14, 0x3c,
-  0xf0, 0xf0, 0x50, 0x01, 0x40, 0x28, 0xfe, 0xe8, 0x3c, 0x14, 0x01, 0x54,
-  0x1e, 0x32, 0x14, 0x14, 0x32, 0x1e, 0x13, 0x28, 0xfe, 0xc1, 0x50, 0xef,
-  0x01, 0x90, 0x28, 0x28, 0x28, 0x28, 0xfe, 0xb6, 0x01, 0x04, 0x14, 0x3c,
-  0xbe, 0x02, 0x1c, 0x1e, 0x32, 0x28, 0x3c, 0xbe, 0x3c, 0x14, 0x01, 0x04,
-  0xdc, 0xd2, 0x1e, 0x32, 0xe6, 0x14, 0x14, 0x14, 0xe6, 0x32, 0x1e, 0xd2,
-  0xfa, 0x28, 0x32, 0x1e, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x01, 0xa4,
-  0x02, 0xd0, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x15, 0x00, 0x4b,
-  0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00, 0x04, 0x00, 0x06, 0x00, 0x67, 0x2b,
-  0xb8, 0x00, 0x04, 0x10, 0xb8, 0x00, 0x09, 0xd0, 0xb8, 0x00, 0x04, 0x10,
-  0xb8, 0x00, 0x11, 0xd0, 0xb8, 0x00, 0x06, 0x10, 0xb8, 0x00, 0x14, 0xd0,
-  0x00, 0xba, 0x00, 0x05, 0x00, 0x00, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x10,
-  0x00, 0x0b, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-  0x11, 0x12, 0x39, 0xba, 0x00, 0x15, 0x00, 0x0b, 0x00, 0x10, 0x11, 0x12,
-  0x39, 0x30, 0x31, 0x29, 0x01, 0x26, 0x27, 0x37, 0x21, 0x05, 0x11, 0x37,
-  0x17, 0x15, 0x01, 0x21, 0x27, 0x36, 0x37, 0x21, 0x05, 0x15, 0x07, 0x27,
-  0x11, 0x01, 0xa4, 0xfe, 0xb6, 0x28, 0x0a, 0x50, 0x01, 0x0e, 0xfe, 0xa2,
-  0x14, 0x3c, 0x01, 0x0e, 0xfe, 0xf3, 0x50, 0x0a, 0x28, 0x01, 0x49, 0xfe,
-  0xd4, 0x3c, 0x14, 0x0a, 0x28, 0x1e, 0x0a, 0x01, 0x04, 0x14, 0x3c, 0xbe,
-  0x02, 0x1c, 0x1e, 0x28, 0x0a, 0x64, 0xbe, 0x3c, 0x14, 0x01, 0x04, 0x00,
-  0x00, 0x06, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x04,
-  0x00, 0x0a, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x1b, 0x00, 0x21, 0x00, 0x8b,
-  0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x22, 0x2f, 0xb8, 0x00, 0x10, 0x2f,
-  0xb8, 0x00, 0x22, 0x10, 0xb8, 0x00, 0x00, 0xd0, 0xb8, 0x00, 0x00, 0x2f,
-  0xb8, 0x00, 0x20, 0xdc, 0xb8, 0x00, 0x03, 0xd0, 0xb8, 0x00, 0x20, 0x10,
-  0xb8, 0x00, 0x06, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x07, 0xd0,
-  0xb8, 0x00, 0x20, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0xb8, 0x00, 0x00, 0x10,
-  0xb8, 0x00, 0x0e, 0xd0, 0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00, 0x14, 0xdc,
-  0xb8, 0x00, 0x17, 0xd0, 0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00, 0x1a, 0xd0,
-  0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x1e, 0xd0, 0xb8, 0x00, 0x14, 0x10,
-  0xb8, 0x00, 0x23, 0xdc, 0x00, 0xba, 0x00, 0x21, 0x00, 0x1d, 0x00, 0x67,
-  0x2b, 0xba, 0x00, 0x09, 0x00, 0x05, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x00,
-  0x00, 0x1d, 0x00, 0x21, 0x11, 0x12, 0x39, 0xba, 0x00, 0x0f, 0x00, 0x05,
-  0x00, 0x09, 0x11, 0x12, 0x39, 0x30, 0x31, 0x37, 0x11, 0x37, 0x17, 0x15,
-  0x13, 0x23, 0x27, 0x35, 0x21, 0x17, 0x05, 0x15, 0x07, 0x27, 0x11, 0x05,
-  0x35, 0x37, 0x17, 0x15, 0x07, 0x15, 0x17, 0x15, 0x07, 0x27, 0x35, 0x17,
-  0x07, 0x21, 0x35, 0x37, 0x33, 0x28, 0x14, 0x3c, 0xf0, 0xf0, 0x50, 0x01,
-  0x40, 0x28, 0xfe, 0xe8, 0x3c, 0x14, 0x01, 0x54, 0x1e, 0x32, 0x14, 0x14,
-  0x32, 0x1e, 0x13, 0x28, 0xfe, 0xc1, 0x50, 0xef, 0x46, 0x01, 0x04, 0x14,
-  0x3c, 0xbe, 0x02, 0x1c, 0x1e, 0x32, 0x28, 0x3c, 0xbe, 0x3c, 0x14, 0x01,
-  0x04, 0xdc, 0xd2, 0x1e, 0x32, 0xe6, 0x14, 0x14, 0x14, 0xe6, 0x32, 0x1e,
-  0xd2, 0xfa, 0x28, 0x32, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x28,
-  0x00, 0x00, 0x01, 0xa4, 0x02, 0xd0, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x10,
-  0x00, 0x16, 0x00, 0x1b, 0x00, 0x53, 0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00,
-  0x0a, 0x00, 0x0c, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x0a, 0x10, 0xb8, 0x00,
-  0x0f, 0xd0, 0xb8, 0x00, 0x0a, 0x10, 0xb8, 0x00, 0x17, 0xd0, 0xb8, 0x00,
-  0x0c, 0x10, 0xb8, 0x00, 0x1a, 0xd0, 0x00, 0xba, 0x00, 0x0b, 0x00, 0x06,
-  0x00, 0x67, 0x2b, 0xba, 0x00, 0x16, 0x00, 0x11, 0x00, 0x67, 0x2b, 0xba,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x0c, 0x00, 0x06,
-  0x00, 0x0b, 0x11, 0x12, 0x39, 0xba, 0x00, 0x1b, 0x00, 0x11, 0x00, 0x16,
-  0x11, 0x12, 0x39, 0x30, 0x31, 0x01, 0x17, 0x07, 0x21, 0x27, 0x37, 0x01,
-  0x21, 0x26, 0x27, 0x37, 0x21, 0x05, 0x11, 0x37, 0x17, 0x15, 0x01, 0x21,
-  0x27, 0x36, 0x37, 0x21, 0x05, 0x15, 0x07, 0x27, 0x11, 0x01, 0x7c, 0x28,
-  0x28, 0xfe, 0xfc, 0x28, 0x28, 0x01, 0x2c, 0xfe, 0xb6, 0x28, 0x0a, 0x50,
-  0x01, 0x0e, 0xfe, 0xa2, 0x14, 0x3c, 0x01, 0x0e, 0xfe, 0xf3, 0x50, 0x0a,
-  0x28, 0x01, 0x49, 0xfe, 0xd4, 0x3c, 0x14, 0x01, 0x90, 0x28, 0x28, 0x28,
-  0x28, 0xfe, 0x70, 0x0a, 0x28, 0x1e, 0x0a, 0x01, 0x04, 0x14, 0x3c, 0xbe,
-  0x02, 0x1c, 0x1e, 0x28, 0x0a, 0x64, 0xbe, 0x3c, 0x14, 0x01, 0x04, 0x00,
-  0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x01, 0xa4, 0x02, 0xd0, 0x00, 0x05,
-  0x00, 0x0b, 0x00, 0x10, 0x00, 0x17, 0x00, 0x45, 0xb8, 0x00, 0x64, 0x2b,
-  0xba, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x05, 0x10,
-  0xb8, 0x00, 0x0c, 0xd0, 0xb8, 0x00, 0x05, 0x10, 0xb8, 0x00, 0x11, 0xd0,
-  0xb8, 0x00, 0x0f, 0x10, 0xb8, 0x00, 0x15, 0xd0, 0x00, 0xb8, 0x00, 0x13,
-  0x2f, 0xba, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x10, 0x00, 0x06, 0x00, 0x0b,
-  0x11, 0x12, 0x39, 0x30, 0x31, 0x01, 0x17, 0x07, 0x21, 0x27, 0x37, 0x25,
-  0x21, 0x27, 0x36, 0x37, 0x21, 0x05, 0x15, 0x07, 0x27, 0x11, 0x13, 0x15,
-  0x07, 0x26, 0x27, 0x11, 0x37, 0x01, 0x7c, 0x28, 0x28, 0xfe, 0xfc, 0x28,
-  0x28, 0x01, 0x0e, 0xfe, 0xf3, 0x50, 0x0a, 0x28, 0x01, 0x49, 0xfe, 0xd4,
-  0x3c, 0x14, 0x50, 0x1e, 0x28, 0x0a, 0x14, 0x01, 0x90, 0x28, 0x28, 0x28,
-  0x28, 0xf0, 0x1e, 0x28, 0x0a, 0x64, 0xbe, 0x3c, 0x14, 0x01, 0x04, 0xfe,
-  0x98, 0xd2, 0x50, 0x0a, 0x28, 0x01, 0x18, 0x14, 0x00, 0x06, 0x00, 0x28,
-  0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x12,
-  0x00, 0x17, 0x00, 0x1d, 0x00, 0x22, 0x00, 0xaf, 0xb8, 0x00, 0x64, 0x2b,
-  0xb8, 0x00, 0x23, 0x2f, 0xb8, 0x00, 0x02, 0x2f, 0xb8, 0x00, 0x00, 0xd0,
-  0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x07, 0xdc, 0xb8, 0x00, 0x02, 0x10,
-  0xb8, 0x00, 0x0b, 0xd0, 0xba, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x07, 0x11,
-  0x12, 0x39, 0xb8, 0x00, 0x23, 0x10, 0xb8, 0x00, 0x13, 0xd0, 0xb8, 0x00,
-  0x13, 0x2f, 0xb8, 0x00, 0x11, 0xdc, 0xb8, 0x00, 0x16, 0xd0, 0xb8, 0x00,
-  0x11, 0x10, 0xb8, 0x00, 0x19, 0xd0, 0xb8, 0x00, 0x19, 0x2f, 0xb8, 0x00,
-  0x13, 0x10, 0xb8, 0x00, 0x1a, 0xd0, 0xb8, 0x00, 0x1a, 0x2f, 0xba, 0x00,
-  0x1d, 0x00, 0x02, 0x00, 0x07, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x11, 0x10,
-  0xb8, 0x00, 0x1e, 0xd0, 0xb8, 0x00, 0x13, 0x10, 0xb8, 0x00, 0x21, 0xd0,
-  0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00, 0x24, 0xdc, 0x00, 0xba, 0x00, 0x0b,
-  0x00, 0x0d, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x1d, 0x00, 0x18, 0x00, 0x67,
-  0x2b, 0xba, 0x00, 0x00, 0x00, 0x02, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x0b,
-  0x10, 0xb8, 0x00, 0x11, 0xd0, 0xba, 0x00, 0x13, 0x00, 0x0d, 0x00, 0x0b,
-  0x11, 0x12, 0x39, 0xba, 0x00, 0x22, 0x00, 0x18, 0x00, 0x1d, 0x11, 0x12,
-  0x39, 0x30, 0x31, 0x01, 0x17, 0x07, 0x23, 0x27, 0x37, 0x1f, 0x01, 0x11,
-  0x06, 0x07, 0x27, 0x35, 0x13, 0x21, 0x26, 0x27, 0x37, 0x33, 0x05, 0x11,
-  0x37, 0x17, 0x15, 0x01, 0x21, 0x27, 0x36, 0x37, 0x21, 0x05, 0x15, 0x07,
-  0x27, 0x11, 0x01, 0x7c, 0x28, 0x28, 0x5a, 0x28, 0x28, 0x96, 0x14, 0x0a,
-  0x28, 0x1e, 0x0a, 0xfe, 0xd4, 0x28, 0x0a, 0x50, 0xf0, 0xfe, 0xc0, 0x14,
-  0x3c, 0x01, 0x0e, 0xfe, 0xf3, 0x50, 0x0a, 0x28, 0x01, 0x49, 0xfe, 0xd4,
-  0x3c, 0x14, 0x01, 0x90, 0x28, 0x28, 0x28, 0x28, 0x32, 0x14, 0xfe, 0xe8,
-  0x28, 0x0a, 0x50, 0xd2, 0xfe, 0xde, 0x0a, 0x28, 0x1e, 0x0a, 0x01, 0x04,
-  0x14, 0x3c, 0xbe, 0x02, 0x1c, 0x1e, 0x28, 0x0a, 0x64, 0xbe, 0x3c, 0x14,
-  0x01, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc,
-  0x02, 0xd0, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x1a, 0x00, 0x21,
-  0x00, 0x77, 0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x22, 0x2f, 0xb8, 0x00,
-  0x00, 0x2f, 0xb8, 0x00, 0x02, 0xd0, 0xb8, 0x00, 0x22, 0x10, 0xb8, 0x00,
-  0x18, 0xd0, 0xb8, 0x00, 0x18, 0x2f, 0xb8, 0x00, 0x15, 0xdc, 0xb8, 0x00,
-  0x03, 0xd0, 0xb8, 0x00, 0x15, 0x10, 0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00,
-  0x00, 0x10, 0xb8, 0x00, 0x12, 0xdc, 0xb8, 0x00, 0x07, 0xd0, 0xb8, 0x00,
-  0x00, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00,
-  0x0d, 0xd0, 0xb8, 0x00, 0x18, 0x10, 0xb8, 0x00, 0x1c, 0xd0, 0xb8, 0x00,
-  0x15, 0x10, 0xb8, 0x00, 0x20, 0xd0, 0xb8, 0x00, 0x12, 0x10, 0xb8, 0x00,
-  0x23, 0xdc, 0x00, 0xb8, 0x00, 0x0a, 0x2f, 0xb8, 0x00, 0x16, 0x2f, 0xb8,
-  0x00, 0x0f, 0x2f, 0xba, 0x00, 0x00, 0x00, 0x02, 0x00, 0x67, 0x2b, 0x30,
-  0x31, 0x01, 0x17, 0x07, 0x21, 0x27, 0x37, 0x05, 0x17, 0x11, 0x06, 0x07,
-  0x27, 0x3d, 0x02, 0x37, 0x16, 0x17, 0x11, 0x07, 0x05, 0x15, 0x07, 0x26,
-  0x27, 0x11, 0x37, 0x35, 0x27, 0x11, 0x36, 0x37, 0x17, 0x15, 0x01, 0x7c,
-  0x28, 0x28, 0xfe, 0xfc, 0x28, 0x28, 0x01, 0x40, 0x14, 0x0a, 0x28, 0x1e,
-  0x1e, 0x28, 0x0a, 0x14, 0xfe, 0xc0, 0x1e, 0x28, 0x0a, 0x14, 0x14, 0x0a,
-  0x28, 0x1e, 0x01, 0x90, 0x28, 0x28, 0x28, 0x28, 0x32, 0x14, 0xfe, 0xe8,
-  0x28, 0x0a, 0x50, 0xd2, 0x8c, 0xd2, 0x50, 0x0a, 0x28, 0xfe, 0xe8, 0x14,
-  0x50, 0xd2, 0x50, 0x0a, 0x28, 0x01, 0x18, 0x14, 0x0a, 0x14, 0x01, 0x18,
-  0x28, 0x0a, 0x50, 0xd2, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x0a, 0x01, 0x18,
-  0x02, 0xd0, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x27, 0xb8, 0x00, 0x78, 0x2b,
-  0xba, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7b, 0x2b, 0xb8, 0x00, 0x05, 0x10,
-  0xb8, 0x00, 0x08, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x0c, 0xd0,
-  0x00, 0xb8, 0x00, 0x02, 0x2f, 0xb8, 0x00, 0x0b, 0x2f, 0x30, 0x31, 0x13,
-  0x35, 0x37, 0x16, 0x17, 0x11, 0x07, 0x15, 0x17, 0x11, 0x06, 0x07, 0x27,
-  0x35, 0xc8, 0x1e, 0x28, 0x0a, 0x14, 0x14, 0x0a, 0x28, 0x1e, 0x01, 0xae,
-  0xd2, 0x50, 0x0a, 0x28, 0xfe, 0xe8, 0x14, 0x0a, 0x14, 0xfe, 0xe8, 0x28,
-  0x0a, 0x50, 0xd2, 0x00, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc,
-  0x02, 0xd0, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x11, 0x00, 0x18, 0x00, 0x67,
-  0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x19, 0x2f, 0xb8, 0x00, 0x05, 0x2f,
-  0xb8, 0x00, 0x02, 0xdc, 0xba, 0x00, 0x07, 0x00, 0x05, 0x00, 0x02, 0x11,
-  0x12, 0x39, 0xb8, 0x00, 0x19, 0x10, 0xb8, 0x00, 0x0d, 0xd0, 0xb8, 0x00,
-  0x0d, 0x2f, 0xb8, 0x00, 0x0b, 0xdc, 0xb8, 0x00, 0x10, 0xd0, 0xb8, 0x00,
-  0x05, 0x10, 0xb8, 0x00, 0x12, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00,
-  0x16, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x1a, 0xdc, 0x00, 0xb8,
-  0x00, 0x14, 0x2f, 0xba, 0x00, 0x05, 0x00, 0x07, 0x00, 0x67, 0x2b, 0xb8,
-  0x00, 0x05, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0xba, 0x00, 0x0d, 0x00, 0x07,
-  0x00, 0x05, 0x11, 0x12, 0x39, 0x30, 0x31, 0x01, 0x17, 0x11, 0x06, 0x07,
-  0x27, 0x35, 0x13, 0x21, 0x26, 0x27, 0x37, 0x33, 0x05, 0x11, 0x37, 0x17,
-  0x15, 0x01, 0x35, 0x37, 0x16, 0x17, 0x11, 0x07, 0x01, 0xb8, 0x14, 0x0a,
-  0x28, 0x1e, 0x0a, 0xfe, 0xd4, 0x28, 0x0a, 0x50, 0xf0, 0xfe, 0xc0, 0x14,
-  0x3c, 0x01, 0x04, 0x1e, 0x28, 0x0a, 0x14, 0x01, 0x5e, 0x14, 0xfe, 0xe8,
-  0x28, 0x0a, 0x50, 0xd2, 0xfe, 0xde, 0x0a, 0x28, 0x1e, 0x0a, 0x01, 0x04,
-  0x14, 0x3c, 0xbe, 0x01, 0x4a, 0xd2, 0x50, 0x0a, 0x28, 0xfe, 0xe8, 0x14,
-  0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05,
-  0x00, 0x0c, 0x00, 0x12, 0x00, 0x19, 0x00, 0x20, 0x00, 0x7f, 0xb8, 0x00,
-  0x64, 0x2b, 0xb8, 0x00, 0x21, 0x2f, 0xb8, 0x00, 0x02, 0x2f, 0xb8, 0x00,
-  0x00, 0xd0, 0xb8, 0x00, 0x21, 0x10, 0xb8, 0x00, 0x17, 0xd0, 0xb8, 0x00,
-  0x17, 0x2f, 0xb8, 0x00, 0x14, 0xdc, 0xb8, 0x00, 0x03, 0xd0, 0xb8, 0x00,
-  0x14, 0x10, 0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00,
-  0x07, 0xdc, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0xb8, 0x00,
-  0x02, 0x10, 0xb8, 0x00, 0x0e, 0xd0, 0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00,
-  0x10, 0xd0, 0xb8, 0x00, 0x17, 0x10, 0xb8, 0x00, 0x1b, 0xd0, 0xb8, 0x00,
-  0x14, 0x10, 0xb8, 0x00, 0x1f, 0xd0, 0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00,
-  0x22, 0xdc, 0x00, 0xb8, 0x00, 0x0e, 0x2f, 0xb8, 0x00, 0x1e, 0x2f, 0xb8,
-  0x00, 0x0a, 0x2f, 0xb8, 0x00, 0x15, 0x2f, 0xba, 0x00, 0x00, 0x00, 0x02,
-  0x00, 0x67, 0x2b, 0x30, 0x31, 0x01, 0x17, 0x07, 0x21, 0x27, 0x37, 0x05,
-  0x17, 0x11, 0x06, 0x07, 0x27, 0x35, 0x27, 0x37, 0x32, 0x17, 0x01, 0x23,
-  0x07, 0x15, 0x07, 0x26, 0x27, 0x11, 0x37, 0x35, 0x27, 0x11, 0x36, 0x37,
-  0x17, 0x15, 0x01, 0x7c, 0x28, 0x28, 0xfe, 0xfc, 0x28, 0x28, 0x01, 0x40,
-  0x14, 0x0a, 0x28, 0x1e, 0xf0, 0xf0, 0x3c, 0x14, 0xfe, 0xfc, 0x3c, 0x14,
-  0x1e, 0x28, 0x0a, 0x14, 0x14, 0x0a, 0x28, 0x1e, 0x01, 0x90, 0x28, 0x28,
-  0x28, 0x28, 0x32, 0x14, 0xfe, 0xe8, 0x28, 0x0a, 0x50, 0xd2, 0xbe, 0xf0,
-  0x28, 0xfe, 0xfc, 0x82, 0xd2, 0x50, 0x0a, 0x28, 0x01, 0x18, 0x14, 0x14,
-  0x14, 0x01, 0x18, 0x28, 0x0a, 0x50, 0xd2, 0x00, 0x00, 0x03, 0x00, 0x28,
-  0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x13,
-  0x00, 0x3d, 0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00, 0x01, 0x00, 0x04, 0x00,
-  0x67, 0x2b, 0xba, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x01, 0x11, 0x12, 0x39,
-  0xb8, 0x00, 0x04, 0x10, 0xb8, 0x00, 0x0e, 0xd0, 0xb8, 0x00, 0x01, 0x10,
-  0xb8, 0x00, 0x12, 0xd0, 0x00, 0xb8, 0x00, 0x11, 0x2f, 0xba, 0x00, 0x01,
-  0x00, 0x0c, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x01, 0x10, 0xb8, 0x00, 0x08,
-  0xd0, 0x30, 0x31, 0x13, 0x15, 0x07, 0x26, 0x27, 0x11, 0x37, 0x13, 0x33,
-  0x17, 0x06, 0x07, 0x21, 0x03, 0x27, 0x11, 0x36, 0x37, 0x17, 0x15, 0x78,
-  0x1e, 0x28, 0x0a, 0x14, 0x50, 0xf0, 0x50, 0x0a, 0x28, 0xfe, 0xd4, 0x32,
-  0x14, 0x0a, 0x28, 0x1e, 0x01, 0x22, 0xd2, 0x50, 0x0a, 0x28, 0x01, 0x18,
-  0x14, 0xfe, 0xf2, 0x1e, 0x28, 0x0a, 0x01, 0x72, 0x14, 0x01, 0x18, 0x28,
-  0x0a, 0x50, 0xd2, 0x00, 0x00, 0x06, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc,
-  0x02, 0xd0, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x16, 0x00, 0x1d,
-  0x00, 0x24, 0x00, 0xbb, 0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x25, 0x2f,
-  0xb8, 0x00, 0x15, 0xd0, 0xb8, 0x00, 0x15, 0x2f, 0xb8, 0x00, 0x02, 0xdc,
-  0x41, 0x03, 0x00, 0x60, 0x00, 0x02, 0x00, 0x01, 0x5d, 0x41, 0x03, 0x00,
-  0xc0, 0x00, 0x02, 0x00, 0x01, 0x5d, 0xb8, 0x00, 0x00, 0xdc, 0xb8, 0x00,
-  0x02, 0x10, 0xb8, 0x00, 0x0a, 0xdc, 0x41, 0x03, 0x00, 0xc0, 0x00, 0x0a,
-  0x00, 0x01, 0x5d, 0x41, 0x03, 0x00, 0x60, 0x00, 0x0a, 0x00, 0x01, 0x5d,
-  0xb8, 0x00, 0x07, 0xdc, 0xb8, 0x00, 0x15, 0x10, 0xb8, 0x00, 0x13, 0xdc,
-  0xb8, 0x00, 0x0d, 0xd0, 0xb8, 0x00, 0x0d, 0x2f, 0xb8, 0x00, 0x15, 0x10,
-  0xb8, 0x00, 0x0e, 0xd0, 0xb8, 0x00, 0x0e, 0x2f, 0xba, 0x00, 0x11, 0x00,
-  0x0a, 0x00, 0x07, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x0a, 0x10, 0xb8, 0x00,
-  0x17, 0xd0, 0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00, 0x1b, 0xd0, 0xb8, 0x00,
-  0x13, 0x10, 0xb8, 0x00, 0x1e, 0xd0, 0xb8, 0x00, 0x15, 0x10, 0xb8, 0x00,
-  0x22, 0xd0, 0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00, 0x26, 0xdc, 0x00, 0xb8,
-  0x00, 0x09, 0x2f, 0xb8, 0x00, 0x20, 0x2f, 0xba, 0x00, 0x11, 0x00, 0x18,
-  0x00, 0x67, 0x2b, 0xb8, 0x00, 0x18, 0x10, 0xb8, 0x00, 0x0d, 0xd0, 0xba,
-  0x00, 0x16, 0x00, 0x18, 0x00, 0x11, 0x11, 0x12, 0x39, 0x30, 0x31, 0x01,
-  0x07, 0x27, 0x35, 0x33, 0x13, 0x17, 0x11, 0x06, 0x07, 0x27, 0x35, 0x03,
-  0x23, 0x27, 0x36, 0x37, 0x21, 0x05, 0x15, 0x07, 0x27, 0x11, 0x05, 0x35,
-  0x37, 0x16, 0x17, 0x11, 0x07, 0x05, 0x15, 0x07, 0x26, 0x27, 0x11, 0x37,
-  0x01, 0x22, 0x28, 0x28, 0x50, 0x96, 0x14, 0x0a, 0x28, 0x1e, 0x14, 0xef,
-  0x50, 0x0a, 0x28, 0x01, 0x2b, 0xfe, 0xf2, 0x3c, 0x14, 0x01, 0x54, 0x1e,
-  0x28, 0x0a, 0x14, 0xfe, 0xc0, 0x1e, 0x28, 0x0a, 0x14, 0x01, 0x86, 0x28,
-  0x28, 0xe6, 0xfe, 0xf2, 0x14, 0xfe, 0xe8, 0x28, 0x0a, 0x50, 0xd2, 0x01,
-  0x5e, 0x1e, 0x28, 0x0a, 0x64, 0xbe, 0x3c, 0x14, 0x01, 0x04, 0xdc, 0xd2,
-  0x50, 0x0a, 0x28, 0xfe, 0xe8, 0x14, 0x50, 0xd2, 0x50, 0x0a, 0x28, 0x01,
-  0x18, 0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc,
-  0x02, 0xc6, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x1a, 0x00, 0x21,
-  0x00, 0x5f, 0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x22, 0x2f, 0xb8, 0x00,
-  0x12, 0x2f, 0xb8, 0x00, 0x22, 0x10, 0xb8, 0x00, 0x04, 0xd0, 0xb8, 0x00,
-  0x04, 0x2f, 0xb8, 0x00, 0x01, 0xdc, 0xb8, 0x00, 0x12, 0x10, 0xb8, 0x00,
-  0x0f, 0xdc, 0xb8, 0x00, 0x12, 0x10, 0xb8, 0x00, 0x14, 0xd0, 0xb8, 0x00,
-  0x0f, 0x10, 0xb8, 0x00, 0x18, 0xd0, 0xb8, 0x00, 0x04, 0x10, 0xb8, 0x00,
-  0x1c, 0xd0, 0xb8, 0x00, 0x01, 0x10, 0xb8, 0x00, 0x20, 0xd0, 0xb8, 0x00,
-  0x0f, 0x10, 0xb8, 0x00, 0x23, 0xdc, 0x00, 0xb8, 0x00, 0x02, 0x2f, 0xb8,
-  0x00, 0x11, 0x2f, 0xb8, 0x00, 0x16, 0x2f, 0xb8, 0x00, 0x1f, 0x2f, 0x30,
-  0x31, 0x13, 0x15, 0x07, 0x26, 0x27, 0x11, 0x37, 0x25, 0x23, 0x27, 0x35,
-  0x33, 0x1f, 0x02, 0x11, 0x06, 0x07, 0x27, 0x3d, 0x02, 0x37, 0x16, 0x17,
-  0x11, 0x07, 0x21, 0x27, 0x11, 0x36, 0x37, 0x17, 0x15, 0x78, 0x1e, 0x28,
-  0x0a, 0x14, 0x01, 0x2c, 0x46, 0x96, 0x3c, 0xa0, 0x50, 0x14, 0x0a, 0x28,
-  0x1e, 0x1e, 0x28, 0x0a, 0x14, 0xfe, 0x84, 0x14, 0x0a, 0x28, 0x1e, 0x01,
-  0x22, 0xd2, 0x50, 0x0a, 0x28, 0x01, 0x18, 0x14, 0x46, 0x96, 0x3c, 0xa0,
-  0x78, 0x14, 0xfe, 0xe8, 0x28, 0x0a, 0x50, 0xd2, 0x82, 0xd2, 0x50, 0x0a,
-  0x28, 0xfe, 0xe8, 0x14, 0x14, 0x01, 0x18, 0x28, 0x0a, 0x50, 0xd2, 0x00,
-  0x00, 0x06, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05,
-  0x00, 0x0b, 0x00, 0x11, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x23, 0x00, 0x53,
-  0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x24, 0x2f, 0xb8, 0x00, 0x06, 0x2f,
-  0xb8, 0x00, 0x0a, 0xdc, 0xb8, 0x00, 0x0d, 0xd0, 0xb8, 0x00, 0x06, 0x10,
-  0xb8, 0x00, 0x10, 0xd0, 0xb8, 0x00, 0x24, 0x10, 0xb8, 0x00, 0x13, 0xd0,
-  0xb8, 0x00, 0x13, 0x2f, 0xb8, 0x00, 0x17, 0xdc, 0xb8, 0x00, 0x1e, 0xd0,
-  0xb8, 0x00, 0x13, 0x10, 0xb8, 0x00, 0x21, 0xd0, 0xb8, 0x00, 0x0a, 0x10,
-  0xb8, 0x00, 0x25, 0xdc, 0x00, 0xba, 0x00, 0x1d, 0x00, 0x19, 0x00, 0x67,
-  0x2b, 0xba, 0x00, 0x04, 0x00, 0x00, 0x00, 0x67, 0x2b, 0x30, 0x31, 0x01,
-  0x23, 0x27, 0x37, 0x33, 0x17, 0x07, 0x35, 0x37, 0x17, 0x15, 0x07, 0x15,
-  0x17, 0x15, 0x07, 0x27, 0x35, 0x25, 0x27, 0x35, 0x37, 0x17, 0x15, 0x01,
-  0x07, 0x23, 0x27, 0x37, 0x33, 0x27, 0x15, 0x07, 0x27, 0x35, 0x37, 0x01,
-  0x68, 0xdc, 0x28, 0x28, 0xdc, 0x28, 0x14, 0x1e, 0x32, 0x14, 0x14, 0x32,
-  0x1e, 0xfe, 0xc0, 0x14, 0x32, 0x1e, 0x01, 0x18, 0x28, 0xdc, 0x28, 0x28,
-  0xdc, 0xf0, 0x1e, 0x32, 0x14, 0x02, 0x80, 0x28, 0x28, 0x28, 0xfa, 0xd2,
-  0x1e, 0x32, 0xe6, 0x14, 0x14, 0x14, 0xe6, 0x32, 0x1e, 0xd2, 0x50, 0x14,
-  0xe6, 0x32, 0x1e, 0xd2, 0xfe, 0x7a, 0x28, 0x28, 0x28, 0xd2, 0xd2, 0x1e,
-  0x32, 0xe6, 0x14, 0x00, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc,
-  0x02, 0xd0, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x10, 0x00, 0x16, 0x00, 0x1d,
-  0x00, 0x85, 0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x1e, 0x2f, 0xb8, 0x00,
-  0x00, 0x2f, 0xb8, 0x00, 0x02, 0xd0, 0xb8, 0x00, 0x1e, 0x10, 0xb8, 0x00,
-  0x10, 0xd0, 0xb8, 0x00, 0x10, 0x2f, 0xb8, 0x00, 0x07, 0xdc, 0xb8, 0x00,
-  0x03, 0xd0, 0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00,
-  0x10, 0x10, 0xb8, 0x00, 0x09, 0xd0, 0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00,
-  0x0d, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x11, 0xd0, 0xb8, 0x00,
-  0x00, 0x10, 0xb8, 0x00, 0x15, 0xdc, 0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00,
-  0x17, 0xd0, 0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00, 0x1b, 0xd0, 0xb8, 0x00,
-  0x15, 0x10, 0xb8, 0x00, 0x1f, 0xdc, 0x00, 0xb8, 0x00, 0x19, 0x2f, 0xba,
-  0x00, 0x0a, 0x00, 0x06, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x00, 0x00, 0x02,
-  0x00, 0x67, 0x2b, 0xba, 0x00, 0x10, 0x00, 0x06, 0x00, 0x0a, 0x11, 0x12,
-  0x39, 0x30, 0x31, 0x01, 0x17, 0x07, 0x21, 0x27, 0x3f, 0x01, 0x23, 0x27,
-  0x35, 0x21, 0x17, 0x05, 0x15, 0x07, 0x27, 0x11, 0x05, 0x35, 0x37, 0x17,
-  0x15, 0x07, 0x05, 0x15, 0x07, 0x26, 0x27, 0x11, 0x37, 0x01, 0x7c, 0x28,
-  0x28, 0xfe, 0xfc, 0x28, 0x28, 0xf0, 0xf0, 0x50, 0x01, 0x40, 0x28, 0xfe,
-  0xe8, 0x3c, 0x14, 0x01, 0x54, 0x1e, 0x32, 0x14, 0xfe, 0xc0, 0x1e, 0x28,
-  0x0a, 0x14, 0x01, 0x90, 0x28, 0x28, 0x28, 0x28, 0xf0, 0x1e, 0x32, 0x28,
-  0x3c, 0xbe, 0x3c, 0x14, 0x01, 0x04, 0xdc, 0xd2, 0x1e, 0x32, 0xe6, 0x14,
-  0x50, 0xd2, 0x50, 0x0a, 0x28, 0x01, 0x18, 0x14, 0x00, 0x07, 0x00, 0x28,
-  0xff, 0xf6, 0x01, 0xd6, 0x02, 0xd0, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x0f,
-  0x00, 0x15, 0x00, 0x1a, 0x00, 0x21, 0x00, 0x27, 0x00, 0xab, 0xb8, 0x00,
-  0x64, 0x2b, 0xb8, 0x00, 0x28, 0x2f, 0xb8, 0x00, 0x03, 0x2f, 0xb8, 0x00,
-  0x02, 0xdc, 0xb8, 0x00, 0x28, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0xb8, 0x00,
-  0x0b, 0x2f, 0xba, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x02, 0x11, 0x12, 0x39,
-  0xb8, 0x00, 0x09, 0xdc, 0xb8, 0x00, 0x0e, 0xd0, 0xb8, 0x00, 0x09, 0x10,
-  0xb8, 0x00, 0x11, 0xd0, 0xb8, 0x00, 0x11, 0x2f, 0xb8, 0x00, 0x0b, 0x10,
-  0xb8, 0x00, 0x12, 0xd0, 0xb8, 0x00, 0x12, 0x2f, 0xba, 0x00, 0x15, 0x00,
-  0x03, 0x00, 0x02, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x09, 0x10, 0xb8, 0x00,
-  0x16, 0xd0, 0xb8, 0x00, 0x0b, 0x10, 0xb8, 0x00, 0x19, 0xd0, 0xb8, 0x00,
-  0x03, 0x10, 0xb8, 0x00, 0x1b, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00,
-  0x1f, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x29, 0xdc, 0x00, 0xb8,
-  0x00, 0x25, 0x2f, 0xba, 0x00, 0x0a, 0x00, 0x05, 0x00, 0x67, 0x2b, 0xba,
-  0x00, 0x15, 0x00, 0x1c, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x0b, 0x00, 0x05,
-  0x00, 0x0a, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x1c, 0x10, 0xb8, 0x00, 0x11,
-  0xd0, 0xba, 0x00, 0x1a, 0x00, 0x1c, 0x00, 0x15, 0x11, 0x12, 0x39, 0x30,
-  0x31, 0x01, 0x17, 0x15, 0x27, 0x35, 0x03, 0x21, 0x26, 0x27, 0x37, 0x33,
-  0x07, 0x11, 0x37, 0x17, 0x15, 0x13, 0x23, 0x27, 0x36, 0x37, 0x21, 0x05,
-  0x15, 0x07, 0x27, 0x11, 0x05, 0x35, 0x37, 0x16, 0x17, 0x11, 0x0f, 0x01,
-  0x33, 0x17, 0x15, 0x23, 0x27, 0x01, 0xb8, 0x14, 0x50, 0x0a, 0xfe, 0xe8,
-  0x28, 0x0a, 0x50, 0xaa, 0xfa, 0x14, 0x3c, 0xf0, 0xef, 0x50, 0x0a, 0x28,
-  0x01, 0x2b, 0xfe, 0xf2, 0x3c, 0x14, 0x01, 0x54, 0x1e, 0x28, 0x0a, 0x14,
-  0xa0, 0x3c, 0x82, 0x3c, 0x82, 0x01, 0x5e, 0x14, 0xf0, 0x50, 0x78, 0xfe,
-  0xde, 0x0a, 0x28, 0x1e, 0x0a, 0x01, 0x04, 0x14, 0x3c, 0xbe, 0x02, 0x1c,
-  0x1e, 0x28, 0x0a, 0x64, 0xbe, 0x3c, 0x14, 0x01, 0x04, 0xdc, 0xd2, 0x50,
-  0x0a, 0x28, 0xfe, 0xe8, 0x14, 0xbe, 0x82, 0x3c, 0x82, 0x00, 0x00, 0x00,
-  0x00, 0x06, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05,
-  0x00, 0x0b, 0x00, 0x12, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x24, 0x00, 0xaf,
-  0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x25, 0x2f, 0xb8, 0x00, 0x00, 0x2f,
-  0xb8, 0x00, 0x02, 0xd0, 0xb8, 0x00, 0x25, 0x10, 0xb8, 0x00, 0x10, 0xd0,
-  0xb8, 0x00, 0x10, 0x2f, 0xb8, 0x00, 0x0d, 0xdc, 0xb8, 0x00, 0x03, 0xd0,
-  0xb8, 0x00, 0x0d, 0x10, 0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00, 0x00, 0x10,
-  0xb8, 0x00, 0x1e, 0xdc, 0xb8, 0x00, 0x08, 0xd0, 0xb8, 0x00, 0x00, 0x10,
-  0xb8, 0x00, 0x0a, 0xd0, 0xb8, 0x00, 0x0d, 0x10, 0xb8, 0x00, 0x14, 0xd0,
-  0xb8, 0x00, 0x14, 0x2f, 0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00, 0x15, 0xd0,
-  0xb8, 0x00, 0x15, 0x2f, 0xba, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1e, 0x11,
-  0x12, 0x39, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x19, 0xd0, 0xb8, 0x00,
-  0x0d, 0x10, 0xb8, 0x00, 0x20, 0xd0, 0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00,
-  0x23, 0xd0, 0xb8, 0x00, 0x1e, 0x10, 0xb8, 0x00, 0x26, 0xdc, 0x00, 0xb8,
-  0x00, 0x0a, 0x2f, 0xb8, 0x00, 0x0e, 0x2f, 0xba, 0x00, 0x18, 0x00, 0x1a,
-  0x00, 0x67, 0x2b, 0xba, 0x00, 0x00, 0x00, 0x02, 0x00, 0x67, 0x2b, 0xb8,
-  0x00, 0x1a, 0x10, 0xb8, 0x00, 0x14, 0xd0, 0xba, 0x00, 0x24, 0x00, 0x1a,
-  0x00, 0x18, 0x11, 0x12, 0x39, 0x30, 0x31, 0x01, 0x17, 0x07, 0x21, 0x27,
-  0x37, 0x17, 0x33, 0x01, 0x06, 0x23, 0x2f, 0x01, 0x15, 0x07, 0x26, 0x27,
-  0x11, 0x37, 0x01, 0x23, 0x27, 0x36, 0x37, 0x21, 0x03, 0x35, 0x37, 0x16,
-  0x17, 0x11, 0x07, 0x25, 0x15, 0x07, 0x27, 0x11, 0x01, 0x7c, 0x28, 0x28,
-  0xfe, 0xfc, 0x28, 0x28, 0x14, 0x3c, 0x01, 0x04, 0x14, 0x3c, 0xf0, 0x14,
-  0x1e, 0x28, 0x0a, 0x14, 0x01, 0x2c, 0xef, 0x50, 0x0a, 0x28, 0x01, 0x2b,
-  0x0a, 0x1e, 0x28, 0x0a, 0x14, 0xfe, 0xc0, 0x3c, 0x14, 0x01, 0x90, 0x28,
-  0x28, 0x28, 0x28, 0x64, 0xfe, 0xfc, 0x28, 0xf0, 0x32, 0xd2, 0x50, 0x0a,
-  0x28, 0x01, 0x18, 0x14, 0x01, 0x22, 0x1e, 0x28, 0x0a, 0xfe, 0xde, 0xd2,
-  0x50, 0x0a, 0x28, 0xfe, 0xe8, 0x14, 0xfa, 0xbe, 0x3c, 0x14, 0x01, 0x04,
-  0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05,
-  0x00, 0x0c, 0x00, 0x12, 0x00, 0x17, 0x00, 0x1f, 0x00, 0xb3, 0xb8, 0x00,
-  0x64, 0x2b, 0xb8, 0x00, 0x20, 0x2f, 0xb8, 0x00, 0x02, 0x2f, 0xb8, 0x00,
-  0x00, 0xd0, 0xb8, 0x00, 0x20, 0x10, 0xb8, 0x00, 0x10, 0xd0, 0xb8, 0x00,
-  0x10, 0x2f, 0xb8, 0x00, 0x11, 0xdc, 0xb8, 0x00, 0x03, 0xd0, 0xb8, 0x00,
-  0x11, 0x10, 0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00,
-  0x07, 0xdc, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0xba, 0x00,
-  0x0d, 0x00, 0x02, 0x00, 0x07, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x11, 0x10,
-  0xb8, 0x00, 0x13, 0xd0, 0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00, 0x16, 0xd0,
-  0xb8, 0x00, 0x11, 0x10, 0xb8, 0x00, 0x18, 0xd0, 0xb8, 0x00, 0x18, 0x2f,
-  0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00, 0x19, 0xd0, 0xb8, 0x00, 0x19, 0x2f,
-  0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00, 0x1e, 0xd0, 0xb8, 0x00, 0x02, 0x10,
-  0xb8, 0x00, 0x1f, 0xd0, 0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00, 0x21, 0xdc,
-  0x00, 0xba, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x1b,
-  0x00, 0x18, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x00, 0x00, 0x02, 0x00, 0x67,
-  0x2b, 0xb8, 0x00, 0x0b, 0x10, 0xb8, 0x00, 0x11, 0xd0, 0xba, 0x00, 0x17,
-  0x00, 0x18, 0x00, 0x1b, 0x11, 0x12, 0x39, 0x30, 0x31, 0x01, 0x17, 0x07,
-  0x21, 0x27, 0x37, 0x05, 0x17, 0x11, 0x06, 0x07, 0x27, 0x35, 0x13, 0x21,
-  0x26, 0x27, 0x37, 0x33, 0x03, 0x15, 0x07, 0x27, 0x11, 0x17, 0x27, 0x36,
-  0x37, 0x21, 0x16, 0x17, 0x07, 0x01, 0x7c, 0x28, 0x28, 0xfe, 0xfc, 0x28,
-  0x28, 0x01, 0x40, 0x14, 0x0a, 0x28, 0x1e, 0x0a, 0xfe, 0xd4, 0x28, 0x0a,
-  0x50, 0xf0, 0xf0, 0x3c, 0x14, 0x51, 0x50, 0x0a, 0x28, 0x01, 0x3f, 0x28,
-  0x0a, 0x50, 0x01, 0x90, 0x28, 0x28, 0x28, 0x28, 0x32, 0x14, 0xfe, 0xe8,
-  0x28, 0x0a, 0x50, 0xd2, 0xfe, 0xde, 0x0a, 0x28, 0x1e, 0x02, 0x1c, 0xbe,
-  0x3c, 0x14, 0x01, 0x04, 0x0a, 0x1e, 0x28, 0x0a, 0x0a, 0x28, 0x1e, 0x00,
-  0x00, 0x03, 0x00, 0x29, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x06,
-  0x00, 0x0b, 0x00, 0x13, 0x00, 0x2b, 0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00,
-  0x02, 0x00, 0x05, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x05, 0x10, 0xb8, 0x00,
-  0x07, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x09, 0xd0, 0x00, 0xb8,
-  0x00, 0x04, 0x2f, 0xba, 0x00, 0x0f, 0x00, 0x0c, 0x00, 0x67, 0x2b, 0x30,
-  0x31, 0x13, 0x17, 0x11, 0x06, 0x07, 0x27, 0x3d, 0x02, 0x33, 0x15, 0x07,
-  0x03, 0x27, 0x36, 0x37, 0x21, 0x16, 0x17, 0x07, 0xfa, 0x28, 0x0a, 0x28,
-  0x1e, 0x50, 0x28, 0x81, 0x50, 0x0a, 0x28, 0x01, 0x3f, 0x28, 0x0a, 0x50,
-  0x01, 0x5e, 0x28, 0xfe, 0xfc, 0x28, 0x0a, 0x50, 0xe6, 0x64, 0xd2, 0xd2,
-  0x28, 0x01, 0x0e, 0x1e, 0x28, 0x0a, 0x0a, 0x28, 0x1e, 0x00, 0x00, 0x00,
-  0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x06,
-  0x00, 0x0c, 0x00, 0x11, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x77, 0xb8, 0x00,
-  0x64, 0x2b, 0xb8, 0x00, 0x20, 0x2f, 0xb8, 0x00, 0x05, 0x2f, 0xb8, 0x00,
-  0x02, 0xdc, 0xba, 0x00, 0x07, 0x00, 0x05, 0x00, 0x02, 0x11, 0x12, 0x39,
-  0xb8, 0x00, 0x20, 0x10, 0xb8, 0x00, 0x0d, 0xd0, 0xb8, 0x00, 0x0d, 0x2f,
-  0xb8, 0x00, 0x0b, 0xdc, 0xb8, 0x00, 0x10, 0xd0, 0xb8, 0x00, 0x05, 0x10,
-  0xb8, 0x00, 0x12, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x16, 0xd0,
-  0xb8, 0x00, 0x0d, 0x10, 0xb8, 0x00, 0x1a, 0xd0, 0xb8, 0x00, 0x0b, 0x10,
-  0xb8, 0x00, 0x1e, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x21, 0xdc,
-  0x00, 0xb8, 0x00, 0x14, 0x2f, 0xba, 0x00, 0x05, 0x00, 0x07, 0x00, 0x67,
-  0x2b, 0xb8, 0x00, 0x05, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0xba, 0x00, 0x0d,
-  0x00, 0x07, 0x00, 0x05, 0x11, 0x12, 0x39, 0x30, 0x31, 0x01, 0x17, 0x11,
-  0x06, 0x07, 0x27, 0x35, 0x13, 0x21, 0x26, 0x27, 0x37, 0x33, 0x05, 0x11,
-  0x37, 0x17, 0x15, 0x01, 0x35, 0x37, 0x16, 0x17, 0x11, 0x07, 0x05, 0x27,
-  0x11, 0x36, 0x37, 0x17, 0x15, 0x01, 0xb8, 0x14, 0x0a, 0x28, 0x1e, 0x0a,
-  0xfe, 0xd4, 0x28, 0x0a, 0x50, 0xf0, 0xfe, 0xc0, 0x14, 0x3c, 0x01, 0x04,
-  0x1e, 0x28, 0x0a, 0x14, 0xfe, 0x84, 0x14, 0x0a, 0x28, 0x1e, 0x01, 0x5e,
-  0x14, 0xfe, 0xe8, 0x28, 0x0a, 0x50, 0xd2, 0xfe, 0xde, 0x0a, 0x28, 0x1e,
-  0x0a, 0x01, 0x04, 0x14, 0x3c, 0xbe, 0x01, 0x4a, 0xd2, 0x50, 0x0a, 0x28,
-  0xfe, 0xe8, 0x14, 0x0a, 0x14, 0x01, 0x18, 0x28, 0x0a, 0x50, 0xd2, 0x00,
-  0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xc6, 0x00, 0x06,
-  0x00, 0x0d, 0x00, 0x13, 0x00, 0x19, 0x00, 0x73, 0xb8, 0x00, 0x64, 0x2b,
-  0xb8, 0x00, 0x1a, 0x2f, 0xb8, 0x00, 0x07, 0x2f, 0xb8, 0x00, 0x1a, 0x10,
-  0xb8, 0x00, 0x01, 0xd0, 0xb8, 0x00, 0x01, 0x2f, 0xb8, 0x00, 0x06, 0xdc,
-  0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00, 0x0c, 0xdc, 0xba, 0x00, 0x0f, 0x00,
-  0x01, 0x00, 0x0c, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x01, 0x10, 0xb8, 0x00,
-  0x10, 0xd0, 0xb8, 0x00, 0x06, 0x10, 0xb8, 0x00, 0x13, 0xd0, 0xb8, 0x00,
-  0x07, 0x10, 0xb8, 0x00, 0x14, 0xd0, 0xb8, 0x00, 0x0c, 0x10, 0xb8, 0x00,
-  0x16, 0xd0, 0xba, 0x00, 0x18, 0x00, 0x01, 0x00, 0x0c, 0x11, 0x12, 0x39,
-  0xb8, 0x00, 0x0c, 0x10, 0xb8, 0x00, 0x1b, 0xdc, 0x00, 0xb8, 0x00, 0x04,
-  0x2f, 0xb8, 0x00, 0x09, 0x2f, 0xb8, 0x00, 0x0f, 0x2f, 0xb8, 0x00, 0x18,
-  0x2f, 0x30, 0x31, 0x13, 0x27, 0x11, 0x36, 0x37, 0x17, 0x15, 0x21, 0x35,
-  0x37, 0x16, 0x17, 0x11, 0x0f, 0x01, 0x15, 0x03, 0x35, 0x37, 0x17, 0x21,
-  0x37, 0x17, 0x15, 0x03, 0x35, 0x3c, 0x14, 0x0a, 0x28, 0x1e, 0x01, 0x04,
-  0x1e, 0x28, 0x0a, 0x14, 0xc8, 0xc8, 0x14, 0x3c, 0x01, 0x04, 0x3c, 0x14,
-  0xc8, 0x01, 0x68, 0x14, 0x01, 0x18, 0x28, 0x0a, 0x50, 0xd2, 0xd2, 0x50,
-  0x0a, 0x28, 0xfe, 0xe8, 0x14, 0xf0, 0x78, 0x01, 0x04, 0x3c, 0x14, 0x3c,
-  0x3c, 0x14, 0x3c, 0xfe, 0xfc, 0x78, 0x00, 0x00, 0x00, 0x06, 0x00, 0x28,
-  0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x11,
-  0x00, 0x16, 0x00, 0x1d, 0x00, 0x24, 0x00, 0xbb, 0xb8, 0x00, 0x64, 0x2b,
-  0xb8, 0x00, 0x25, 0x2f, 0xb8, 0x00, 0x12, 0xd0, 0xb8, 0x00, 0x12, 0x2f,
-  0xb8, 0x00, 0x01, 0xdc, 0x41, 0x03, 0x00, 0x60, 0x00, 0x01, 0x00, 0x01,
-  0x5d, 0x41, 0x03, 0x00, 0xc0, 0x00, 0x01, 0x00, 0x01, 0x5d, 0xb8, 0x00,
-  0x00, 0xdc, 0xb8, 0x00, 0x01, 0x10, 0xb8, 0x00, 0x05, 0xdc, 0x41, 0x03,
-  0x00, 0xc0, 0x00, 0x05, 0x00, 0x01, 0x5d, 0x41, 0x03, 0x00, 0x60, 0x00,
-  0x05, 0x00, 0x01, 0x5d, 0xb8, 0x00, 0x0a, 0xdc, 0xba, 0x00, 0x0c, 0x00,
-  0x05, 0x00, 0x0a, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x12, 0x10, 0xb8, 0x00,
-  0x0f, 0xd0, 0xb8, 0x00, 0x0f, 0x2f, 0xb8, 0x00, 0x12, 0x10, 0xb8, 0x00,
-  0x16, 0xdc, 0xb8, 0x00, 0x10, 0xd0, 0xb8, 0x00, 0x10, 0x2f, 0xb8, 0x00,
-  0x0a, 0x10, 0xb8, 0x00, 0x18, 0xd0, 0xb8, 0x00, 0x05, 0x10, 0xb8, 0x00,
-  0x1c, 0xd0, 0xb8, 0x00, 0x12, 0x10, 0xb8, 0x00, 0x1f, 0xd0, 0xb8, 0x00,
-  0x16, 0x10, 0xb8, 0x00, 0x23, 0xd0, 0xb8, 0x00, 0x0a, 0x10, 0xb8, 0x00,
-  0x26, 0xdc, 0x00, 0xb8, 0x00, 0x07, 0x2f, 0xb8, 0x00, 0x22, 0x2f, 0xba,
-  0x00, 0x1c, 0x00, 0x0c, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x1c, 0x10, 0xb8,
-  0x00, 0x10, 0xd0, 0xba, 0x00, 0x12, 0x00, 0x0c, 0x00, 0x1c, 0x11, 0x12,
-  0x39, 0x30, 0x31, 0x25, 0x23, 0x35, 0x37, 0x17, 0x37, 0x35, 0x37, 0x16,
-  0x17, 0x11, 0x07, 0x03, 0x21, 0x26, 0x27, 0x37, 0x33, 0x05, 0x11, 0x37,
-  0x17, 0x15, 0x25, 0x17, 0x11, 0x06, 0x07, 0x27, 0x35, 0x25, 0x27, 0x11,
-  0x36, 0x37, 0x17, 0x15, 0x01, 0x22, 0x50, 0x28, 0x28, 0x5a, 0x1e, 0x28,
-  0x0a, 0x14, 0x32, 0xfe, 0xd5, 0x28, 0x0a, 0x50, 0xef, 0xfe, 0xc0, 0x14,
-  0x3c, 0x01, 0x40, 0x14, 0x0a, 0x28, 0x1e, 0xfe, 0xc0, 0x14, 0x0a, 0x28,
-  0x1e, 0x64, 0xe6, 0x28, 0x28, 0x64, 0xd2, 0x50, 0x0a, 0x28, 0xfe, 0xe8,
-  0x14, 0xfe, 0x8e, 0x0a, 0x28, 0x1e, 0x0a, 0x01, 0x04, 0x14, 0x3c, 0xbe,
-  0xfa, 0x14, 0xfe, 0xe8, 0x28, 0x0a, 0x50, 0xd2, 0x50, 0x14, 0x01, 0x18,
-  0x28, 0x0a, 0x50, 0xd2, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc,
-  0x02, 0xd0, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x17, 0x00, 0x37,
-  0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x67, 0x2b,
-  0xb8, 0x00, 0x0b, 0x10, 0xb8, 0x00, 0x00, 0xd0, 0xb8, 0x00, 0x00, 0x2f,
-  0xb8, 0x00, 0x11, 0x10, 0xb8, 0x00, 0x12, 0xd0, 0xb8, 0x00, 0x12, 0x2f,
-  0x00, 0xb8, 0x00, 0x04, 0x2f, 0xb8, 0x00, 0x0d, 0x2f, 0xb8, 0x00, 0x07,
-  0x2f, 0xb8, 0x00, 0x16, 0x2f, 0x30, 0x31, 0x01, 0x33, 0x13, 0x06, 0x23,
-  0x27, 0x3f, 0x01, 0x32, 0x17, 0x03, 0x23, 0x0f, 0x01, 0x22, 0x27, 0x13,
-  0x33, 0x37, 0x23, 0x03, 0x36, 0x33, 0x17, 0x01, 0x04, 0x2d, 0x9a, 0x14,
-  0x3c, 0x77, 0x01, 0x77, 0x3c, 0x14, 0x9a, 0x2d, 0x16, 0x77, 0x3c, 0x14,
-  0x9a, 0x2d, 0x01, 0x2d, 0x9a, 0x14, 0x3c, 0x77, 0x01, 0x5e, 0xfe, 0xca,
-  0x28, 0xf2, 0xec, 0xf2, 0x28, 0xfe, 0xca, 0x80, 0xf2, 0x28, 0x01, 0x36,
-  0x14, 0x01, 0x36, 0x28, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x28,
-  0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x12,
-  0x00, 0x17, 0x00, 0x1e, 0x00, 0x89, 0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00,
-  0x1f, 0x2f, 0xb8, 0x00, 0x00, 0x2f, 0xb8, 0x00, 0x02, 0xd0, 0xb8, 0x00,
-  0x1f, 0x10, 0xb8, 0x00, 0x10, 0xd0, 0xb8, 0x00, 0x10, 0x2f, 0xb8, 0x00,
-  0x11, 0xdc, 0xb8, 0x00, 0x03, 0xd0, 0xb8, 0x00, 0x11, 0x10, 0xb8, 0x00,
-  0x05, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x1d, 0xdc, 0xb8, 0x00,
-  0x07, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0xba, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x1d, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x11, 0x10,
-  0xb8, 0x00, 0x13, 0xd0, 0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00, 0x16, 0xd0,
-  0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x18, 0xd0, 0xb8, 0x00, 0x1d, 0x10,
-  0xb8, 0x00, 0x20, 0xdc, 0x00, 0xb8, 0x00, 0x1a, 0x2f, 0xba, 0x00, 0x0b,
-  0x00, 0x0d, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x00, 0x00, 0x02, 0x00, 0x67,
-  0x2b, 0xb8, 0x00, 0x0b, 0x10, 0xb8, 0x00, 0x11, 0xd0, 0x30, 0x31, 0x01,
-  0x17, 0x07, 0x21, 0x27, 0x37, 0x05, 0x17, 0x11, 0x06, 0x07, 0x27, 0x35,
-  0x13, 0x21, 0x26, 0x27, 0x37, 0x33, 0x03, 0x15, 0x07, 0x27, 0x11, 0x05,
-  0x35, 0x37, 0x16, 0x17, 0x11, 0x07, 0x01, 0x7c, 0x28, 0x28, 0xfe, 0xfc,
-  0x28, 0x28, 0x01, 0x40, 0x14, 0x0a, 0x28, 0x1e, 0x0a, 0xfe, 0xd4, 0x28,
-  0x0a, 0x50, 0xf0, 0xf0, 0x3c, 0x14, 0x01, 0x54, 0x1e, 0x28, 0x0a, 0x14,
-  0x01, 0x90, 0x28, 0x28, 0x28, 0x28, 0x32, 0x14, 0xfe, 0xe8, 0x28, 0x0a,
-  0x50, 0xd2, 0xfe, 0xde, 0x0a, 0x28, 0x1e, 0x02, 0x3a, 0xdc, 0x3c, 0x14,
-  0x01, 0x22, 0xfa, 0xd2, 0x50, 0x0a, 0x28, 0xfe, 0xe8, 0x14, 0x00, 0x00,
-  0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x03,
-  0x00, 0x09, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x27, 0xb8, 0x00, 0x64, 0x2b,
-  0x00, 0xba, 0x00, 0x03, 0x00, 0x00, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x09,
-  0x00, 0x04, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x09, 0x10, 0xb8, 0x00, 0x0b,
-  0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x11, 0xd0, 0x30, 0x31, 0x29,
-  0x01, 0x37, 0x33, 0x03, 0x23, 0x27, 0x36, 0x37, 0x21, 0x03, 0x13, 0x32,
-  0x17, 0x03, 0x23, 0x17, 0x03, 0x22, 0x27, 0x13, 0x33, 0x01, 0xa4, 0xfe,
-  0xe8, 0x28, 0xd2, 0x46, 0xc7, 0x50, 0x0a, 0x28, 0x01, 0x0d, 0x6e, 0x82,
-  0x3c, 0x14, 0x96, 0x3c, 0x0a, 0x8c, 0x3c, 0x14, 0xa0, 0x3c, 0x50, 0x02,
-  0x30, 0x1e, 0x28, 0x0a, 0xfe, 0xde, 0x01, 0x22, 0x28, 0xfe, 0xca, 0x50,
-  0xfe, 0xde, 0x28, 0x01, 0x36, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x28,
-  0x00, 0x00, 0x00, 0xfa, 0x02, 0xd0, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x10,
-  0x00, 0x17, 0x00, 0x43, 0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00, 0x04, 0x00,
-  0x00, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x04, 0x10, 0xb8, 0x00, 0x0c, 0xd0,
-  0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x0f, 0xd0, 0x00, 0xba, 0x00, 0x17,
-  0x00, 0x12, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x0a, 0x00, 0x05, 0x00, 0x67,
-  0x2b, 0xba, 0x00, 0x00, 0x00, 0x12, 0x00, 0x17, 0x11, 0x12, 0x39, 0xba,
-  0x00, 0x10, 0x00, 0x05, 0x00, 0x0a, 0x11, 0x12, 0x39, 0x30, 0x31, 0x37,
-  0x11, 0x37, 0x17, 0x15, 0x13, 0x23, 0x27, 0x36, 0x37, 0x33, 0x17, 0x07,
-  0x15, 0x07, 0x27, 0x11, 0x13, 0x07, 0x23, 0x26, 0x27, 0x37, 0x33, 0x28,
-  0x14, 0x3c, 0x46, 0x45, 0x50, 0x0a, 0x28, 0x8b, 0x14, 0x82, 0x3c, 0x14,
-  0xd2, 0x14, 0x8b, 0x28, 0x0a, 0x50, 0x45, 0x46, 0x01, 0x04, 0x14, 0x3c,
-  0xbe, 0x02, 0x1c, 0x1e, 0x28, 0x0a, 0x14, 0x50, 0xbe, 0x3c, 0x14, 0x01,
-  0x04, 0xfd, 0x8a, 0x14, 0x0a, 0x28, 0x1e, 0x00, 0x00, 0x02, 0x00, 0x29,
-  0x00, 0x00, 0x01, 0xcb, 0x02, 0xd0, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x0f,
-  0xb8, 0x00, 0x64, 0x2b, 0x00, 0xb8, 0x00, 0x04, 0x2f, 0xb8, 0x00, 0x0a,
-  0x2f, 0x30, 0x31, 0x01, 0x33, 0x13, 0x06, 0x23, 0x2f, 0x01, 0x23, 0x03,
-  0x36, 0x33, 0x17, 0x01, 0x04, 0x2d, 0x9a, 0x14, 0x3c, 0x77, 0x14, 0x2d,
-  0x9a, 0x14, 0x3c, 0x77, 0x01, 0x5e, 0xfe, 0xca, 0x28, 0xf2, 0x80, 0x01,
-  0x36, 0x28, 0xf3, 0x00, 0x00, 0x04, 0x00, 0xfa, 0x00, 0x00, 0x01, 0xcc,
-  0x02, 0xd0, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x12, 0x00, 0x17, 0x00, 0x4b,
-  0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00, 0x02, 0x00, 0x05, 0x00, 0x67, 0x2b,
-  0xba, 0x00, 0x0b, 0x00, 0x05, 0x00, 0x02, 0x11, 0x12, 0x39, 0xb8, 0x00,
-  0x05, 0x10, 0xb8, 0x00, 0x0c, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00,
-  0x10, 0xd0, 0xba, 0x00, 0x13, 0x00, 0x05, 0x00, 0x02, 0x11, 0x12, 0x39,
-  0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x19, 0xdc, 0x00, 0xb8, 0x00, 0x0a,
-  0x2f, 0xb8, 0x00, 0x0e, 0x2f, 0xb8, 0x00, 0x04, 0x2f, 0xb8, 0x00, 0x13,
-  0x2f, 0x30, 0x31, 0x01, 0x17, 0x11, 0x06, 0x07, 0x27, 0x35, 0x03, 0x23,
-  0x27, 0x37, 0x33, 0x03, 0x35, 0x37, 0x16, 0x17, 0x11, 0x07, 0x03, 0x23,
-  0x27, 0x37, 0x33, 0x01, 0xb8, 0x14, 0x0a, 0x28, 0x1e, 0x14, 0x32, 0x3c,
-  0x14, 0x78, 0x0a, 0x1e, 0x28, 0x0a, 0x14, 0x32, 0x78, 0x14, 0x3c, 0x32,
-  0x01, 0x5e, 0x14, 0xfe, 0xe8, 0x28, 0x0a, 0x50, 0xd2, 0x01, 0x5e, 0x3c,
-  0x14, 0xfe, 0xde, 0xd2, 0x50, 0x0a, 0x28, 0xfe, 0xe8, 0x14, 0xfe, 0x8e,
-  0x14, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x28, 0x01, 0xc2, 0x01, 0xcb,
-  0x02, 0xd0, 0x00, 0x04, 0x00, 0x09, 0x00, 0x17, 0xb8, 0x00, 0x64, 0x2b,
-  0x00, 0xb8, 0x00, 0x04, 0x2f, 0xb8, 0x00, 0x05, 0x2f, 0xb8, 0x00, 0x01,
-  0x2f, 0xb8, 0x00, 0x08, 0x2f, 0x30, 0x31, 0x01, 0x35, 0x17, 0x15, 0x07,
-  0x21, 0x27, 0x35, 0x37, 0x07, 0x01, 0x03, 0xc8, 0x27, 0xfe, 0xab, 0x27,
-  0xc8, 0x01, 0x02, 0x62, 0x6e, 0xc8, 0x28, 0x1e, 0x1e, 0x28, 0xc8, 0x6e,
-  0x00, 0x01, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcb, 0x00, 0x50, 0x00, 0x07,
-  0x00, 0x0f, 0xb8, 0x00, 0x64, 0x2b, 0x00, 0xba, 0x00, 0x00, 0x00, 0x03,
-  0x00, 0x67, 0x2b, 0x30, 0x31, 0x25, 0x17, 0x06, 0x07, 0x21, 0x26, 0x27,
-  0x37, 0x01, 0x7b, 0x50, 0x0a, 0x28, 0xfe, 0xc1, 0x28, 0x0a, 0x50, 0x50,
-  0x1e, 0x28, 0x0a, 0x0a, 0x28, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa0,
-  0x02, 0x30, 0x01, 0x54, 0x02, 0xe4, 0x00, 0x05, 0x00, 0x0f, 0xb8, 0x00,
-  0x64, 0x2b, 0x00, 0xb8, 0x00, 0x02, 0x2f, 0xb8, 0x00, 0x04, 0x2f, 0x30,
-  0x31, 0x01, 0x15, 0x07, 0x27, 0x37, 0x33, 0x01, 0x54, 0x28, 0x8c, 0x0a,
-  0x28, 0x02, 0x62, 0x28, 0x0a, 0x8c, 0x28, 0x00, 0x00, 0x06, 0x00, 0x28,
-  0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x12,
-  0x00, 0x17, 0x00, 0x1e, 0x00, 0x25, 0x00, 0xaf, 0xb8, 0x00, 0x64, 0x2b,
-  0xb8, 0x00, 0x26, 0x2f, 0xb8, 0x00, 0x00, 0x2f, 0xb8, 0x00, 0x02, 0xd0,
-  0xb8, 0x00, 0x26, 0x10, 0xb8, 0x00, 0x16, 0xd0, 0xb8, 0x00, 0x16, 0x2f,
-  0xb8, 0x00, 0x05, 0xdc, 0xb8, 0x00, 0x03, 0xd0, 0xb8, 0x00, 0x00, 0x10,
-  0xb8, 0x00, 0x1d, 0xdc, 0xb8, 0x00, 0x07, 0xd0, 0xb8, 0x00, 0x00, 0x10,
-  0xb8, 0x00, 0x0b, 0xd0, 0xb8, 0x00, 0x05, 0x10, 0xb8, 0x00, 0x0e, 0xd0,
-  0xb8, 0x00, 0x0e, 0x2f, 0xb8, 0x00, 0x16, 0x10, 0xb8, 0x00, 0x0f, 0xd0,
-  0xb8, 0x00, 0x0f, 0x2f, 0xba, 0x00, 0x12, 0x00, 0x00, 0x00, 0x1d, 0x11,
-  0x12, 0x39, 0xb8, 0x00, 0x05, 0x10, 0xb8, 0x00, 0x13, 0xd0, 0xb8, 0x00,
-  0x00, 0x10, 0xb8, 0x00, 0x18, 0xd0, 0xb8, 0x00, 0x05, 0x10, 0xb8, 0x00,
-  0x1f, 0xd0, 0xb8, 0x00, 0x16, 0x10, 0xb8, 0x00, 0x23, 0xd0, 0xb8, 0x00,
-  0x1d, 0x10, 0xb8, 0x00, 0x27, 0xdc, 0x00, 0xb8, 0x00, 0x0a, 0x2f, 0xb8,
-  0x00, 0x21, 0x2f, 0xba, 0x00, 0x12, 0x00, 0x19, 0x00, 0x67, 0x2b, 0xba,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x19, 0x10, 0xb8,
-  0x00, 0x0e, 0xd0, 0xba, 0x00, 0x17, 0x00, 0x19, 0x00, 0x12, 0x11, 0x12,
-  0x39, 0x30, 0x31, 0x01, 0x17, 0x07, 0x21, 0x27, 0x37, 0x05, 0x17, 0x11,
-  0x06, 0x07, 0x27, 0x35, 0x03, 0x23, 0x27, 0x36, 0x37, 0x21, 0x05, 0x15,
-  0x07, 0x27, 0x11, 0x05, 0x35, 0x37, 0x16, 0x17, 0x11, 0x07, 0x05, 0x15,
-  0x07, 0x26, 0x27, 0x11, 0x37, 0x01, 0x7c, 0x28, 0x28, 0xfe, 0xfc, 0x28,
-  0x28, 0x01, 0x40, 0x14, 0x0a, 0x28, 0x1e, 0x14, 0xef, 0x50, 0x0a, 0x28,
-  0x01, 0x2b, 0xfe, 0xf2, 0x3c, 0x14, 0x01, 0x54, 0x1e, 0x28, 0x0a, 0x14,
-  0xfe, 0xc0, 0x1e, 0x28, 0x0a, 0x14, 0x01, 0x90, 0x28, 0x28, 0x28, 0x28,
-  0x32, 0x14, 0xfe, 0xe8, 0x28, 0x0a, 0x50, 0xd2, 0x01, 0x5e, 0x1e, 0x28,
-  0x0a, 0x64, 0xbe, 0x3c, 0x14, 0x01, 0x04, 0xdc, 0xd2, 0x50, 0x0a, 0x28,
-  0xfe, 0xe8, 0x14, 0x50, 0xd2, 0x50, 0x0a, 0x28, 0x01, 0x18, 0x14, 0x00,
-  0x00, 0x07, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05,
-  0x00, 0x0a, 0x00, 0x10, 0x00, 0x15, 0x00, 0x1b, 0x00, 0x21, 0x00, 0x27,
-  0x00, 0xaf, 0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x28, 0x2f, 0xb8, 0x00,
-  0x00, 0x2f, 0xb8, 0x00, 0x02, 0xd0, 0xb8, 0x00, 0x28, 0x10, 0xb8, 0x00,
-  0x06, 0xd0, 0xb8, 0x00, 0x06, 0x2f, 0xb8, 0x00, 0x26, 0xdc, 0xb8, 0x00,
-  0x03, 0xd0, 0xb8, 0x00, 0x26, 0x10, 0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00,
-  0x26, 0x10, 0xb8, 0x00, 0x09, 0xd0, 0xb8, 0x00, 0x26, 0x10, 0xb8, 0x00,
-  0x0c, 0xd0, 0xb8, 0x00, 0x06, 0x10, 0xb8, 0x00, 0x0d, 0xd0, 0xb8, 0x00,
-  0x26, 0x10, 0xb8, 0x00, 0x11, 0xd0, 0xb8, 0x00, 0x06, 0x10, 0xb8, 0x00,
-  0x14, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x16, 0xd0, 0xb8, 0x00,
-  0x00, 0x10, 0xb8, 0x00, 0x1a, 0xdc, 0xb8, 0x00, 0x1d, 0xd0, 0xb8, 0x00,
-  0x00, 0x10, 0xb8, 0x00, 0x20, 0xd0, 0xb8, 0x00, 0x06, 0x10, 0xb8, 0x00,
-  0x24, 0xd0, 0xb8, 0x00, 0x1a, 0x10, 0xb8, 0x00, 0x29, 0xdc, 0x00, 0xba,
-  0x00, 0x27, 0x00, 0x23, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x0f, 0x00, 0x0b,
-  0x00, 0x67, 0x2b, 0xba, 0x00, 0x00, 0x00, 0x02, 0x00, 0x67, 0x2b, 0xba,
-  0x00, 0x06, 0x00, 0x23, 0x00, 0x27, 0x11, 0x12, 0x39, 0xba, 0x00, 0x15,
-  0x00, 0x0b, 0x00, 0x0f, 0x11, 0x12, 0x39, 0x30, 0x31, 0x01, 0x17, 0x07,
-  0x21, 0x27, 0x37, 0x03, 0x11, 0x37, 0x17, 0x15, 0x13, 0x23, 0x27, 0x35,
-  0x21, 0x17, 0x05, 0x15, 0x07, 0x27, 0x11, 0x05, 0x35, 0x37, 0x17, 0x15,
-  0x07, 0x15, 0x17, 0x15, 0x07, 0x27, 0x35, 0x17, 0x07, 0x21, 0x35, 0x37,
-  0x33, 0x01, 0x7c, 0x28, 0x28, 0xfe, 0xfc, 0x28, 0x28, 0x50, 0x14, 0x3c,
-  0xf0, 0xf0, 0x50, 0x01, 0x40, 0x28, 0xfe, 0xe8, 0x3c, 0x14, 0x01, 0x54,
-  0x1e, 0x32, 0x14, 0x14, 0x32, 0x1e, 0x13, 0x28, 0xfe, 0xc1, 0x50, 0xef,
-  0x01, 0x90, 0x28, 0x28, 0x28, 0x28, 0xfe, 0xb6, 0x01, 0x04, 0x14, 0x3c,
-  0xbe, 0x02, 0x1c, 0x1e, 0x32, 0x28, 0x3c, 0xbe, 0x3c, 0x14, 0x01, 0x04,
-  0xdc, 0xd2, 0x1e, 0x32, 0xe6, 0x14, 0x14, 0x14, 0xe6, 0x32, 0x1e, 0xd2,
-  0xfa, 0x28, 0x32, 0x1e, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x01, 0xa4,
-  0x02, 0xd0, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x15, 0x00, 0x4b,
-  0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00, 0x04, 0x00, 0x06, 0x00, 0x67, 0x2b,
-  0xb8, 0x00, 0x04, 0x10, 0xb8, 0x00, 0x09, 0xd0, 0xb8, 0x00, 0x04, 0x10,
-  0xb8, 0x00, 0x11, 0xd0, 0xb8, 0x00, 0x06, 0x10, 0xb8, 0x00, 0x14, 0xd0,
-  0x00, 0xba, 0x00, 0x05, 0x00, 0x00, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x10,
-  0x00, 0x0b, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-  0x11, 0x12, 0x39, 0xba, 0x00, 0x15, 0x00, 0x0b, 0x00, 0x10, 0x11, 0x12,
-  0x39, 0x30, 0x31, 0x29, 0x01, 0x26, 0x27, 0x37, 0x21, 0x05, 0x11, 0x37,
-  0x17, 0x15, 0x01, 0x21, 0x27, 0x36, 0x37, 0x21, 0x05, 0x15, 0x07, 0x27,
-  0x11, 0x01, 0xa4, 0xfe, 0xb6, 0x28, 0x0a, 0x50, 0x01, 0x0e, 0xfe, 0xa2,
-  0x14, 0x3c, 0x01, 0x0e, 0xfe, 0xf3, 0x50, 0x0a, 0x28, 0x01, 0x49, 0xfe,
-  0xd4, 0x3c, 0x14, 0x0a, 0x28, 0x1e, 0x0a, 0x01, 0x04, 0x14, 0x3c, 0xbe,
-  0x02, 0x1c, 0x1e, 0x28, 0x0a, 0x64, 0xbe, 0x3c, 0x14, 0x01, 0x04, 0x00,
-  0x00, 0x06, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x04,
-  0x00, 0x0a, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x1b, 0x00, 0x21, 0x00, 0x8b,
-  0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x22, 0x2f, 0xb8, 0x00, 0x10, 0x2f,
-  0xb8, 0x00, 0x22, 0x10, 0xb8, 0x00, 0x00, 0xd0, 0xb8, 0x00, 0x00, 0x2f,
-  0xb8, 0x00, 0x20, 0xdc, 0xb8, 0x00, 0x03, 0xd0, 0xb8, 0x00, 0x20, 0x10,
-  0xb8, 0x00, 0x06, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x07, 0xd0,
-  0xb8, 0x00, 0x20, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0xb8, 0x00, 0x00, 0x10,
-  0xb8, 0x00, 0x0e, 0xd0, 0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00, 0x14, 0xdc,
-  0xb8, 0x00, 0x17, 0xd0, 0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00, 0x1a, 0xd0,
-  0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x1e, 0xd0, 0xb8, 0x00, 0x14, 0x10,
-  0xb8, 0x00, 0x23, 0xdc, 0x00, 0xba, 0x00, 0x21, 0x00, 0x1d, 0x00, 0x67,
-  0x2b, 0xba, 0x00, 0x09, 0x00, 0x05, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x00,
-  0x00, 0x1d, 0x00, 0x21, 0x11, 0x12, 0x39, 0xba, 0x00, 0x0f, 0x00, 0x05,
-  0x00, 0x09, 0x11, 0x12, 0x39, 0x30, 0x31, 0x37, 0x11, 0x37, 0x17, 0x15,
-  0x13, 0x23, 0x27, 0x35, 0x21, 0x17, 0x05, 0x15, 0x07, 0x27, 0x11, 0x05,
-  0x35, 0x37, 0x17, 0x15, 0x07, 0x15, 0x17, 0x15, 0x07, 0x27, 0x35, 0x17,
-  0x07, 0x21, 0x35, 0x37, 0x33, 0x28, 0x14, 0x3c, 0xf0, 0xf0, 0x50, 0x01,
-  0x40, 0x28, 0xfe, 0xe8, 0x3c, 0x14, 0x01, 0x54, 0x1e, 0x32, 0x14, 0x14,
-  0x32, 0x1e, 0x13, 0x28, 0xfe, 0xc1, 0x50, 0xef, 0x46, 0x01, 0x04, 0x14,
-  0x3c, 0xbe, 0x02, 0x1c, 0x1e, 0x32, 0x28, 0x3c, 0xbe, 0x3c, 0x14, 0x01,
-  0x04, 0xdc, 0xd2, 0x1e, 0x32, 0xe6, 0x14, 0x14, 0x14, 0xe6, 0x32, 0x1e,
-  0xd2, 0xfa, 0x28, 0x32, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x28,
-  0x00, 0x00, 0x01, 0xa4, 0x02, 0xd0, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x10,
-  0x00, 0x16, 0x00, 0x1b, 0x00, 0x53, 0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00,
-  0x0a, 0x00, 0x0c, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x0a, 0x10, 0xb8, 0x00,
-  0x0f, 0xd0, 0xb8, 0x00, 0x0a, 0x10, 0xb8, 0x00, 0x17, 0xd0, 0xb8, 0x00,
-  0x0c, 0x10, 0xb8, 0x00, 0x1a, 0xd0, 0x00, 0xba, 0x00, 0x0b, 0x00, 0x06,
-  0x00, 0x67, 0x2b, 0xba, 0x00, 0x16, 0x00, 0x11, 0x00, 0x67, 0x2b, 0xba,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x0c, 0x00, 0x06,
-  0x00, 0x0b, 0x11, 0x12, 0x39, 0xba, 0x00, 0x1b, 0x00, 0x11, 0x00, 0x16,
-  0x11, 0x12, 0x39, 0x30, 0x31, 0x01, 0x17, 0x07, 0x21, 0x27, 0x37, 0x01,
-  0x21, 0x26, 0x27, 0x37, 0x21, 0x05, 0x11, 0x37, 0x17, 0x15, 0x01, 0x21,
-  0x27, 0x36, 0x37, 0x21, 0x05, 0x15, 0x07, 0x27, 0x11, 0x01, 0x7c, 0x28,
-  0x28, 0xfe, 0xfc, 0x28, 0x28, 0x01, 0x2c, 0xfe, 0xb6, 0x28, 0x0a, 0x50,
-  0x01, 0x0e, 0xfe, 0xa2, 0x14, 0x3c, 0x01, 0x0e, 0xfe, 0xf3, 0x50, 0x0a,
-  0x28, 0x01, 0x49, 0xfe, 0xd4, 0x3c, 0x14, 0x01, 0x90, 0x28, 0x28, 0x28,
-  0x28, 0xfe, 0x70, 0x0a, 0x28, 0x1e, 0x0a, 0x01, 0x04, 0x14, 0x3c, 0xbe,
-  0x02, 0x1c, 0x1e, 0x28, 0x0a, 0x64, 0xbe, 0x3c, 0x14, 0x01, 0x04, 0x00,
-  0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x01, 0xa4, 0x02, 0xd0, 0x00, 0x05,
-  0x00, 0x0b, 0x00, 0x10, 0x00, 0x17, 0x00, 0x45, 0xb8, 0x00, 0x64, 0x2b,
-  0xba, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x05, 0x10,
-  0xb8, 0x00, 0x0c, 0xd0, 0xb8, 0x00, 0x05, 0x10, 0xb8, 0x00, 0x11, 0xd0,
-  0xb8, 0x00, 0x0f, 0x10, 0xb8, 0x00, 0x15, 0xd0, 0x00, 0xb8, 0x00, 0x13,
-  0x2f, 0xba, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x10, 0x00, 0x06, 0x00, 0x0b,
-  0x11, 0x12, 0x39, 0x30, 0x31, 0x01, 0x17, 0x07, 0x21, 0x27, 0x37, 0x25,
-  0x21, 0x27, 0x36, 0x37, 0x21, 0x05, 0x15, 0x07, 0x27, 0x11, 0x13, 0x15,
-  0x07, 0x26, 0x27, 0x11, 0x37, 0x01, 0x7c, 0x28, 0x28, 0xfe, 0xfc, 0x28,
-  0x28, 0x01, 0x0e, 0xfe, 0xf3, 0x50, 0x0a, 0x28, 0x01, 0x49, 0xfe, 0xd4,
-  0x3c, 0x14, 0x50, 0x1e, 0x28, 0x0a, 0x14, 0x01, 0x90, 0x28, 0x28, 0x28,
-  0x28, 0xf0, 0x1e, 0x28, 0x0a, 0x64, 0xbe, 0x3c, 0x14, 0x01, 0x04, 0xfe,
-  0x98, 0xd2, 0x50, 0x0a, 0x28, 0x01, 0x18, 0x14, 0x00, 0x06, 0x00, 0x28,
-  0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x12,
-  0x00, 0x17, 0x00, 0x1d, 0x00, 0x22, 0x00, 0xaf, 0xb8, 0x00, 0x64, 0x2b,
-  0xb8, 0x00, 0x23, 0x2f, 0xb8, 0x00, 0x02, 0x2f, 0xb8, 0x00, 0x00, 0xd0,
-  0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x07, 0xdc, 0xb8, 0x00, 0x02, 0x10,
-  0xb8, 0x00, 0x0b, 0xd0, 0xba, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x07, 0x11,
-  0x12, 0x39, 0xb8, 0x00, 0x23, 0x10, 0xb8, 0x00, 0x13, 0xd0, 0xb8, 0x00,
-  0x13, 0x2f, 0xb8, 0x00, 0x11, 0xdc, 0xb8, 0x00, 0x16, 0xd0, 0xb8, 0x00,
-  0x11, 0x10, 0xb8, 0x00, 0x19, 0xd0, 0xb8, 0x00, 0x19, 0x2f, 0xb8, 0x00,
-  0x13, 0x10, 0xb8, 0x00, 0x1a, 0xd0, 0xb8, 0x00, 0x1a, 0x2f, 0xba, 0x00,
-  0x1d, 0x00, 0x02, 0x00, 0x07, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x11, 0x10,
-  0xb8, 0x00, 0x1e, 0xd0, 0xb8, 0x00, 0x13, 0x10, 0xb8, 0x00, 0x21, 0xd0,
-  0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00, 0x24, 0xdc, 0x00, 0xba, 0x00, 0x0b,
-  0x00, 0x0d, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x1d, 0x00, 0x18, 0x00, 0x67,
-  0x2b, 0xba, 0x00, 0x00, 0x00, 0x02, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x0b,
-  0x10, 0xb8, 0x00, 0x11, 0xd0, 0xba, 0x00, 0x13, 0x00, 0x0d, 0x00, 0x0b,
-  0x11, 0x12, 0x39, 0xba, 0x00, 0x22, 0x00, 0x18, 0x00, 0x1d, 0x11, 0x12,
-  0x39, 0x30, 0x31, 0x01, 0x17, 0x07, 0x23, 0x27, 0x37, 0x1f, 0x01, 0x11,
-  0x06, 0x07, 0x27, 0x35, 0x13, 0x21, 0x26, 0x27, 0x37, 0x33, 0x05, 0x11,
-  0x37, 0x17, 0x15, 0x01, 0x21, 0x27, 0x36, 0x37, 0x21, 0x05, 0x15, 0x07,
-  0x27, 0x11, 0x01, 0x7c, 0x28, 0x28, 0x5a, 0x28, 0x28, 0x96, 0x14, 0x0a,
-  0x28, 0x1e, 0x0a, 0xfe, 0xd4, 0x28, 0x0a, 0x50, 0xf0, 0xfe, 0xc0, 0x14,
-  0x3c, 0x01, 0x0e, 0xfe, 0xf3, 0x50, 0x0a, 0x28, 0x01, 0x49, 0xfe, 0xd4,
-  0x3c, 0x14, 0x01, 0x90, 0x28, 0x28, 0x28, 0x28, 0x32, 0x14, 0xfe, 0xe8,
-  0x28, 0x0a, 0x50, 0xd2, 0xfe, 0xde, 0x0a, 0x28, 0x1e, 0x0a, 0x01, 0x04,
-  0x14, 0x3c, 0xbe, 0x02, 0x1c, 0x1e, 0x28, 0x0a, 0x64, 0xbe, 0x3c, 0x14,
-  0x01, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc,
-  0x02, 0xd0, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x1a, 0x00, 0x21,
-  0x00, 0x77, 0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x22, 0x2f, 0xb8, 0x00,
-  0x00, 0x2f, 0xb8, 0x00, 0x02, 0xd0, 0xb8, 0x00, 0x22, 0x10, 0xb8, 0x00,
-  0x18, 0xd0, 0xb8, 0x00, 0x18, 0x2f, 0xb8, 0x00, 0x15, 0xdc, 0xb8, 0x00,
-  0x03, 0xd0, 0xb8, 0x00, 0x15, 0x10, 0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00,
-  0x00, 0x10, 0xb8, 0x00, 0x12, 0xdc, 0xb8, 0x00, 0x07, 0xd0, 0xb8, 0x00,
-  0x00, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00,
-  0x0d, 0xd0, 0xb8, 0x00, 0x18, 0x10, 0xb8, 0x00, 0x1c, 0xd0, 0xb8, 0x00,
-  0x15, 0x10, 0xb8, 0x00, 0x20, 0xd0, 0xb8, 0x00, 0x12, 0x10, 0xb8, 0x00,
-  0x23, 0xdc, 0x00, 0xb8, 0x00, 0x0a, 0x2f, 0xb8, 0x00, 0x16, 0x2f, 0xb8,
-  0x00, 0x0f, 0x2f, 0xba, 0x00, 0x00, 0x00, 0x02, 0x00, 0x67, 0x2b, 0x30,
-  0x31, 0x01, 0x17, 0x07, 0x21, 0x27, 0x37, 0x05, 0x17, 0x11, 0x06, 0x07,
-  0x27, 0x3d, 0x02, 0x37, 0x16, 0x17, 0x11, 0x07, 0x05, 0x15, 0x07, 0x26,
-  0x27, 0x11, 0x37, 0x35, 0x27, 0x11, 0x36, 0x37, 0x17, 0x15, 0x01, 0x7c,
-  0x28, 0x28, 0xfe, 0xfc, 0x28, 0x28, 0x01, 0x40, 0x14, 0x0a, 0x28, 0x1e,
-  0x1e, 0x28, 0x0a, 0x14, 0xfe, 0xc0, 0x1e, 0x28, 0x0a, 0x14, 0x14, 0x0a,
-  0x28, 0x1e, 0x01, 0x90, 0x28, 0x28, 0x28, 0x28, 0x32, 0x14, 0xfe, 0xe8,
-  0x28, 0x0a, 0x50, 0xd2, 0x8c, 0xd2, 0x50, 0x0a, 0x28, 0xfe, 0xe8, 0x14,
-  0x50, 0xd2, 0x50, 0x0a, 0x28, 0x01, 0x18, 0x14, 0x0a, 0x14, 0x01, 0x18,
-  0x28, 0x0a, 0x50, 0xd2, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x0a, 0x01, 0x18,
-  0x02, 0xd0, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x27, 0xb8, 0x00, 0x78, 0x2b,
-  0xba, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7b, 0x2b, 0xb8, 0x00, 0x05, 0x10,
-  0xb8, 0x00, 0x08, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x0c, 0xd0,
-  0x00, 0xb8, 0x00, 0x02, 0x2f, 0xb8, 0x00, 0x0b, 0x2f, 0x30, 0x31, 0x13,
-  0x35, 0x37, 0x16, 0x17, 0x11, 0x07, 0x15, 0x17, 0x11, 0x06, 0x07, 0x27,
-  0x35, 0xc8, 0x1e, 0x28, 0x0a, 0x14, 0x14, 0x0a, 0x28, 0x1e, 0x01, 0xae,
-  0xd2, 0x50, 0x0a, 0x28, 0xfe, 0xe8, 0x14, 0x0a, 0x14, 0xfe, 0xe8, 0x28,
-  0x0a, 0x50, 0xd2, 0x00, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc,
-  0x02, 0xd0, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x11, 0x00, 0x18, 0x00, 0x67,
-  0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x19, 0x2f, 0xb8, 0x00, 0x05, 0x2f,
-  0xb8, 0x00, 0x02, 0xdc, 0xba, 0x00, 0x07, 0x00, 0x05, 0x00, 0x02, 0x11,
-  0x12, 0x39, 0xb8, 0x00, 0x19, 0x10, 0xb8, 0x00, 0x0d, 0xd0, 0xb8, 0x00,
-  0x0d, 0x2f, 0xb8, 0x00, 0x0b, 0xdc, 0xb8, 0x00, 0x10, 0xd0, 0xb8, 0x00,
-  0x05, 0x10, 0xb8, 0x00, 0x12, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00,
-  0x16, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x1a, 0xdc, 0x00, 0xb8,
-  0x00, 0x14, 0x2f, 0xba, 0x00, 0x05, 0x00, 0x07, 0x00, 0x67, 0x2b, 0xb8,
-  0x00, 0x05, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0xba, 0x00, 0x0d, 0x00, 0x07,
-  0x00, 0x05, 0x11, 0x12, 0x39, 0x30, 0x31, 0x01, 0x17, 0x11, 0x06, 0x07,
-  0x27, 0x35, 0x13, 0x21, 0x26, 0x27, 0x37, 0x33, 0x05, 0x11, 0x37, 0x17,
-  0x15, 0x01, 0x35, 0x37, 0x16, 0x17, 0x11, 0x07, 0x01, 0xb8, 0x14, 0x0a,
-  0x28, 0x1e, 0x0a, 0xfe, 0xd4, 0x28, 0x0a, 0x50, 0xf0, 0xfe, 0xc0, 0x14,
-  0x3c, 0x01, 0x04, 0x1e, 0x28, 0x0a, 0x14, 0x01, 0x5e, 0x14, 0xfe, 0xe8,
-  0x28, 0x0a, 0x50, 0xd2, 0xfe, 0xde, 0x0a, 0x28, 0x1e, 0x0a, 0x01, 0x04,
-  0x14, 0x3c, 0xbe, 0x01, 0x4a, 0xd2, 0x50, 0x0a, 0x28, 0xfe, 0xe8, 0x14,
-  0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05,
-  0x00, 0x0c, 0x00, 0x12, 0x00, 0x19, 0x00, 0x20, 0x00, 0x7f, 0xb8, 0x00,
-  0x64, 0x2b, 0xb8, 0x00, 0x21, 0x2f, 0xb8, 0x00, 0x02, 0x2f, 0xb8, 0x00,
-  0x00, 0xd0, 0xb8, 0x00, 0x21, 0x10, 0xb8, 0x00, 0x17, 0xd0, 0xb8, 0x00,
-  0x17, 0x2f, 0xb8, 0x00, 0x14, 0xdc, 0xb8, 0x00, 0x03, 0xd0, 0xb8, 0x00,
-  0x14, 0x10, 0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00,
-  0x07, 0xdc, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0xb8, 0x00,
-  0x02, 0x10, 0xb8, 0x00, 0x0e, 0xd0, 0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00,
-  0x10, 0xd0, 0xb8, 0x00, 0x17, 0x10, 0xb8, 0x00, 0x1b, 0xd0, 0xb8, 0x00,
-  0x14, 0x10, 0xb8, 0x00, 0x1f, 0xd0, 0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00,
-  0x22, 0xdc, 0x00, 0xb8, 0x00, 0x0e, 0x2f, 0xb8, 0x00, 0x1e, 0x2f, 0xb8,
-  0x00, 0x0a, 0x2f, 0xb8, 0x00, 0x15, 0x2f, 0xba, 0x00, 0x00, 0x00, 0x02,
-  0x00, 0x67, 0x2b, 0x30, 0x31, 0x01, 0x17, 0x07, 0x21, 0x27, 0x37, 0x05,
-  0x17, 0x11, 0x06, 0x07, 0x27, 0x35, 0x27, 0x37, 0x32, 0x17, 0x01, 0x23,
-  0x07, 0x15, 0x07, 0x26, 0x27, 0x11, 0x37, 0x35, 0x27, 0x11, 0x36, 0x37,
-  0x17, 0x15, 0x01, 0x7c, 0x28, 0x28, 0xfe, 0xfc, 0x28, 0x28, 0x01, 0x40,
-  0x14, 0x0a, 0x28, 0x1e, 0xf0, 0xf0, 0x3c, 0x14, 0xfe, 0xfc, 0x3c, 0x14,
-  0x1e, 0x28, 0x0a, 0x14, 0x14, 0x0a, 0x28, 0x1e, 0x01, 0x90, 0x28, 0x28,
-  0x28, 0x28, 0x32, 0x14, 0xfe, 0xe8, 0x28, 0x0a, 0x50, 0xd2, 0xbe, 0xf0,
-  0x28, 0xfe, 0xfc, 0x82, 0xd2, 0x50, 0x0a, 0x28, 0x01, 0x18, 0x14, 0x14,
-  0x14, 0x01, 0x18, 0x28, 0x0a, 0x50, 0xd2, 0x00, 0x00, 0x03, 0x00, 0x28,
-  0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x13,
-  0x00, 0x3d, 0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00, 0x01, 0x00, 0x04, 0x00,
-  0x67, 0x2b, 0xba, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x01, 0x11, 0x12, 0x39,
-  0xb8, 0x00, 0x04, 0x10, 0xb8, 0x00, 0x0e, 0xd0, 0xb8, 0x00, 0x01, 0x10,
-  0xb8, 0x00, 0x12, 0xd0, 0x00, 0xb8, 0x00, 0x11, 0x2f, 0xba, 0x00, 0x01,
-  0x00, 0x0c, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x01, 0x10, 0xb8, 0x00, 0x08,
-  0xd0, 0x30, 0x31, 0x13, 0x15, 0x07, 0x26, 0x27, 0x11, 0x37, 0x13, 0x33,
-  0x17, 0x06, 0x07, 0x21, 0x03, 0x27, 0x11, 0x36, 0x37, 0x17, 0x15, 0x78,
-  0x1e, 0x28, 0x0a, 0x14, 0x50, 0xf0, 0x50, 0x0a, 0x28, 0xfe, 0xd4, 0x32,
-  0x14, 0x0a, 0x28, 0x1e, 0x01, 0x22, 0xd2, 0x50, 0x0a, 0x28, 0x01, 0x18,
-  0x14, 0xfe, 0xf2, 0x1e, 0x28, 0x0a, 0x01, 0x72, 0x14, 0x01, 0x18, 0x28,
-  0x0a, 0x50, 0xd2, 0x00, 0x00, 0x06, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc,
-  0x02, 0xd0, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x16, 0x00, 0x1d,
-  0x00, 0x24, 0x00, 0xbb, 0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x25, 0x2f,
-  0xb8, 0x00, 0x15, 0xd0, 0xb8, 0x00, 0x15, 0x2f, 0xb8, 0x00, 0x02, 0xdc,
-  0x41, 0x03, 0x00, 0x60, 0x00, 0x02, 0x00, 0x01, 0x5d, 0x41, 0x03, 0x00,
-  0xc0, 0x00, 0x02, 0x00, 0x01, 0x5d, 0xb8, 0x00, 0x00, 0xdc, 0xb8, 0x00,
-  0x02, 0x10, 0xb8, 0x00, 0x0a, 0xdc, 0x41, 0x03, 0x00, 0xc0, 0x00, 0x0a,
-  0x00, 0x01, 0x5d, 0x41, 0x03, 0x00, 0x60, 0x00, 0x0a, 0x00, 0x01, 0x5d,
-  0xb8, 0x00, 0x07, 0xdc, 0xb8, 0x00, 0x15, 0x10, 0xb8, 0x00, 0x13, 0xdc,
-  0xb8, 0x00, 0x0d, 0xd0, 0xb8, 0x00, 0x0d, 0x2f, 0xb8, 0x00, 0x15, 0x10,
-  0xb8, 0x00, 0x0e, 0xd0, 0xb8, 0x00, 0x0e, 0x2f, 0xba, 0x00, 0x11, 0x00,
-  0x0a, 0x00, 0x07, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x0a, 0x10, 0xb8, 0x00,
-  0x17, 0xd0, 0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00, 0x1b, 0xd0, 0xb8, 0x00,
-  0x13, 0x10, 0xb8, 0x00, 0x1e, 0xd0, 0xb8, 0x00, 0x15, 0x10, 0xb8, 0x00,
-  0x22, 0xd0, 0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00, 0x26, 0xdc, 0x00, 0xb8,
-  0x00, 0x09, 0x2f, 0xb8, 0x00, 0x20, 0x2f, 0xba, 0x00, 0x11, 0x00, 0x18,
-  0x00, 0x67, 0x2b, 0xb8, 0x00, 0x18, 0x10, 0xb8, 0x00, 0x0d, 0xd0, 0xba,
-  0x00, 0x16, 0x00, 0x18, 0x00, 0x11, 0x11, 0x12, 0x39, 0x30, 0x31, 0x01,
-  0x07, 0x27, 0x35, 0x33, 0x13, 0x17, 0x11, 0x06, 0x07, 0x27, 0x35, 0x03,
-  0x23, 0x27, 0x36, 0x37, 0x21, 0x05, 0x15, 0x07, 0x27, 0x11, 0x05, 0x35,
-  0x37, 0x16, 0x17, 0x11, 0x07, 0x05, 0x15, 0x07, 0x26, 0x27, 0x11, 0x37,
-  0x01, 0x22, 0x28, 0x28, 0x50, 0x96, 0x14, 0x0a, 0x28, 0x1e, 0x14, 0xef,
-  0x50, 0x0a, 0x28, 0x01, 0x2b, 0xfe, 0xf2, 0x3c, 0x14, 0x01, 0x54, 0x1e,
-  0x28, 0x0a, 0x14, 0xfe, 0xc0, 0x1e, 0x28, 0x0a, 0x14, 0x01, 0x86, 0x28,
-  0x28, 0xe6, 0xfe, 0xf2, 0x14, 0xfe, 0xe8, 0x28, 0x0a, 0x50, 0xd2, 0x01,
-  0x5e, 0x1e, 0x28, 0x0a, 0x64, 0xbe, 0x3c, 0x14, 0x01, 0x04, 0xdc, 0xd2,
-  0x50, 0x0a, 0x28, 0xfe, 0xe8, 0x14, 0x50, 0xd2, 0x50, 0x0a, 0x28, 0x01,
-  0x18, 0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc,
-  0x02, 0xc6, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x1a, 0x00, 0x21,
-  0x00, 0x5f, 0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x22, 0x2f, 0xb8, 0x00,
-  0x12, 0x2f, 0xb8, 0x00, 0x22, 0x10, 0xb8, 0x00, 0x04, 0xd0, 0xb8, 0x00,
-  0x04, 0x2f, 0xb8, 0x00, 0x01, 0xdc, 0xb8, 0x00, 0x12, 0x10, 0xb8, 0x00,
-  0x0f, 0xdc, 0xb8, 0x00, 0x12, 0x10, 0xb8, 0x00, 0x14, 0xd0, 0xb8, 0x00,
-  0x0f, 0x10, 0xb8, 0x00, 0x18, 0xd0, 0xb8, 0x00, 0x04, 0x10, 0xb8, 0x00,
-  0x1c, 0xd0, 0xb8, 0x00, 0x01, 0x10, 0xb8, 0x00, 0x20, 0xd0, 0xb8, 0x00,
-  0x0f, 0x10, 0xb8, 0x00, 0x23, 0xdc, 0x00, 0xb8, 0x00, 0x02, 0x2f, 0xb8,
-  0x00, 0x11, 0x2f, 0xb8, 0x00, 0x16, 0x2f, 0xb8, 0x00, 0x1f, 0x2f, 0x30,
-  0x31, 0x13, 0x15, 0x07, 0x26, 0x27, 0x11, 0x37, 0x25, 0x23, 0x27, 0x35,
-  0x33, 0x1f, 0x02, 0x11, 0x06, 0x07, 0x27, 0x3d, 0x02, 0x37, 0x16, 0x17,
-  0x11, 0x07, 0x21, 0x27, 0x11, 0x36, 0x37, 0x17, 0x15, 0x78, 0x1e, 0x28,
-  0x0a, 0x14, 0x01, 0x2c, 0x46, 0x96, 0x3c, 0xa0, 0x50, 0x14, 0x0a, 0x28,
-  0x1e, 0x1e, 0x28, 0x0a, 0x14, 0xfe, 0x84, 0x14, 0x0a, 0x28, 0x1e, 0x01,
-  0x22, 0xd2, 0x50, 0x0a, 0x28, 0x01, 0x18, 0x14, 0x46, 0x96, 0x3c, 0xa0,
-  0x78, 0x14, 0xfe, 0xe8, 0x28, 0x0a, 0x50, 0xd2, 0x82, 0xd2, 0x50, 0x0a,
-  0x28, 0xfe, 0xe8, 0x14, 0x14, 0x01, 0x18, 0x28, 0x0a, 0x50, 0xd2, 0x00,
-  0x00, 0x06, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05,
-  0x00, 0x0b, 0x00, 0x11, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x23, 0x00, 0x53,
-  0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x24, 0x2f, 0xb8, 0x00, 0x06, 0x2f,
-  0xb8, 0x00, 0x0a, 0xdc, 0xb8, 0x00, 0x0d, 0xd0, 0xb8, 0x00, 0x06, 0x10,
-  0xb8, 0x00, 0x10, 0xd0, 0xb8, 0x00, 0x24, 0x10, 0xb8, 0x00, 0x13, 0xd0,
-  0xb8, 0x00, 0x13, 0x2f, 0xb8, 0x00, 0x17, 0xdc, 0xb8, 0x00, 0x1e, 0xd0,
-  0xb8, 0x00, 0x13, 0x10, 0xb8, 0x00, 0x21, 0xd0, 0xb8, 0x00, 0x0a, 0x10,
-  0xb8, 0x00, 0x25, 0xdc, 0x00, 0xba, 0x00, 0x1d, 0x00, 0x19, 0x00, 0x67,
-  0x2b, 0xba, 0x00, 0x04, 0x00, 0x00, 0x00, 0x67, 0x2b, 0x30, 0x31, 0x01,
-  0x23, 0x27, 0x37, 0x33, 0x17, 0x07, 0x35, 0x37, 0x17, 0x15, 0x07, 0x15,
-  0x17, 0x15, 0x07, 0x27, 0x35, 0x25, 0x27, 0x35, 0x37, 0x17, 0x15, 0x01,
-  0x07, 0x23, 0x27, 0x37, 0x33, 0x27, 0x15, 0x07, 0x27, 0x35, 0x37, 0x01,
-  0x68, 0xdc, 0x28, 0x28, 0xdc, 0x28, 0x14, 0x1e, 0x32, 0x14, 0x14, 0x32,
-  0x1e, 0xfe, 0xc0, 0x14, 0x32, 0x1e, 0x01, 0x18, 0x28, 0xdc, 0x28, 0x28,
-  0xdc, 0xf0, 0x1e, 0x32, 0x14, 0x02, 0x80, 0x28, 0x28, 0x28, 0xfa, 0xd2,
-  0x1e, 0x32, 0xe6, 0x14, 0x14, 0x14, 0xe6, 0x32, 0x1e, 0xd2, 0x50, 0x14,
-  0xe6, 0x32, 0x1e, 0xd2, 0xfe, 0x7a, 0x28, 0x28, 0x28, 0xd2, 0xd2, 0x1e,
-  0x32, 0xe6, 0x14, 0x00, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc,
-  0x02, 0xd0, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x10, 0x00, 0x16, 0x00, 0x1d,
-  0x00, 0x85, 0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x1e, 0x2f, 0xb8, 0x00,
-  0x00, 0x2f, 0xb8, 0x00, 0x02, 0xd0, 0xb8, 0x00, 0x1e, 0x10, 0xb8, 0x00,
-  0x10, 0xd0, 0xb8, 0x00, 0x10, 0x2f, 0xb8, 0x00, 0x07, 0xdc, 0xb8, 0x00,
-  0x03, 0xd0, 0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00,
-  0x10, 0x10, 0xb8, 0x00, 0x09, 0xd0, 0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00,
-  0x0d, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x11, 0xd0, 0xb8, 0x00,
-  0x00, 0x10, 0xb8, 0x00, 0x15, 0xdc, 0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00,
-  0x17, 0xd0, 0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00, 0x1b, 0xd0, 0xb8, 0x00,
-  0x15, 0x10, 0xb8, 0x00, 0x1f, 0xdc, 0x00, 0xb8, 0x00, 0x19, 0x2f, 0xba,
-  0x00, 0x0a, 0x00, 0x06, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x00, 0x00, 0x02,
-  0x00, 0x67, 0x2b, 0xba, 0x00, 0x10, 0x00, 0x06, 0x00, 0x0a, 0x11, 0x12,
-  0x39, 0x30, 0x31, 0x01, 0x17, 0x07, 0x21, 0x27, 0x3f, 0x01, 0x23, 0x27,
-  0x35, 0x21, 0x17, 0x05, 0x15, 0x07, 0x27, 0x11, 0x05, 0x35, 0x37, 0x17,
-  0x15, 0x07, 0x05, 0x15, 0x07, 0x26, 0x27, 0x11, 0x37, 0x01, 0x7c, 0x28,
-  0x28, 0xfe, 0xfc, 0x28, 0x28, 0xf0, 0xf0, 0x50, 0x01, 0x40, 0x28, 0xfe,
-  0xe8, 0x3c, 0x14, 0x01, 0x54, 0x1e, 0x32, 0x14, 0xfe, 0xc0, 0x1e, 0x28,
-  0x0a, 0x14, 0x01, 0x90, 0x28, 0x28, 0x28, 0x28, 0xf0, 0x1e, 0x32, 0x28,
-  0x3c, 0xbe, 0x3c, 0x14, 0x01, 0x04, 0xdc, 0xd2, 0x1e, 0x32, 0xe6, 0x14,
-  0x50, 0xd2, 0x50, 0x0a, 0x28, 0x01, 0x18, 0x14, 0x00, 0x07, 0x00, 0x28,
-  0xff, 0xf6, 0x01, 0xd6, 0x02, 0xd0, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x0f,
-  0x00, 0x15, 0x00, 0x1a, 0x00, 0x21, 0x00, 0x27, 0x00, 0xab, 0xb8, 0x00,
-  0x64, 0x2b, 0xb8, 0x00, 0x28, 0x2f, 0xb8, 0x00, 0x03, 0x2f, 0xb8, 0x00,
-  0x02, 0xdc, 0xb8, 0x00, 0x28, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0xb8, 0x00,
-  0x0b, 0x2f, 0xba, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x02, 0x11, 0x12, 0x39,
-  0xb8, 0x00, 0x09, 0xdc, 0xb8, 0x00, 0x0e, 0xd0, 0xb8, 0x00, 0x09, 0x10,
-  0xb8, 0x00, 0x11, 0xd0, 0xb8, 0x00, 0x11, 0x2f, 0xb8, 0x00, 0x0b, 0x10,
-  0xb8, 0x00, 0x12, 0xd0, 0xb8, 0x00, 0x12, 0x2f, 0xba, 0x00, 0x15, 0x00,
-  0x03, 0x00, 0x02, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x09, 0x10, 0xb8, 0x00,
-  0x16, 0xd0, 0xb8, 0x00, 0x0b, 0x10, 0xb8, 0x00, 0x19, 0xd0, 0xb8, 0x00,
-  0x03, 0x10, 0xb8, 0x00, 0x1b, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00,
-  0x1f, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x29, 0xdc, 0x00, 0xb8,
-  0x00, 0x25, 0x2f, 0xba, 0x00, 0x0a, 0x00, 0x05, 0x00, 0x67, 0x2b, 0xba,
-  0x00, 0x15, 0x00, 0x1c, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x0b, 0x00, 0x05,
-  0x00, 0x0a, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x1c, 0x10, 0xb8, 0x00, 0x11,
-  0xd0, 0xba, 0x00, 0x1a, 0x00, 0x1c, 0x00, 0x15, 0x11, 0x12, 0x39, 0x30,
-  0x31, 0x01, 0x17, 0x15, 0x27, 0x35, 0x03, 0x21, 0x26, 0x27, 0x37, 0x33,
-  0x07, 0x11, 0x37, 0x17, 0x15, 0x13, 0x23, 0x27, 0x36, 0x37, 0x21, 0x05,
-  0x15, 0x07, 0x27, 0x11, 0x05, 0x35, 0x37, 0x16, 0x17, 0x11, 0x0f, 0x01,
-  0x33, 0x17, 0x15, 0x23, 0x27, 0x01, 0xb8, 0x14, 0x50, 0x0a, 0xfe, 0xe8,
-  0x28, 0x0a, 0x50, 0xaa, 0xfa, 0x14, 0x3c, 0xf0, 0xef, 0x50, 0x0a, 0x28,
-  0x01, 0x2b, 0xfe, 0xf2, 0x3c, 0x14, 0x01, 0x54, 0x1e, 0x28, 0x0a, 0x14,
-  0xa0, 0x3c, 0x82, 0x3c, 0x82, 0x01, 0x5e, 0x14, 0xf0, 0x50, 0x78, 0xfe,
-  0xde, 0x0a, 0x28, 0x1e, 0x0a, 0x01, 0x04, 0x14, 0x3c, 0xbe, 0x02, 0x1c,
-  0x1e, 0x28, 0x0a, 0x64, 0xbe, 0x3c, 0x14, 0x01, 0x04, 0xdc, 0xd2, 0x50,
-  0x0a, 0x28, 0xfe, 0xe8, 0x14, 0xbe, 0x82, 0x3c, 0x82, 0x00, 0x00, 0x00,
-  0x00, 0x06, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05,
-  0x00, 0x0b, 0x00, 0x12, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x24, 0x00, 0xaf,
-  0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x25, 0x2f, 0xb8, 0x00, 0x00, 0x2f,
-  0xb8, 0x00, 0x02, 0xd0, 0xb8, 0x00, 0x25, 0x10, 0xb8, 0x00, 0x10, 0xd0,
-  0xb8, 0x00, 0x10, 0x2f, 0xb8, 0x00, 0x0d, 0xdc, 0xb8, 0x00, 0x03, 0xd0,
-  0xb8, 0x00, 0x0d, 0x10, 0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00, 0x00, 0x10,
-  0xb8, 0x00, 0x1e, 0xdc, 0xb8, 0x00, 0x08, 0xd0, 0xb8, 0x00, 0x00, 0x10,
-  0xb8, 0x00, 0x0a, 0xd0, 0xb8, 0x00, 0x0d, 0x10, 0xb8, 0x00, 0x14, 0xd0,
-  0xb8, 0x00, 0x14, 0x2f, 0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00, 0x15, 0xd0,
-  0xb8, 0x00, 0x15, 0x2f, 0xba, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1e, 0x11,
-  0x12, 0x39, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x19, 0xd0, 0xb8, 0x00,
-  0x0d, 0x10, 0xb8, 0x00, 0x20, 0xd0, 0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00,
-  0x23, 0xd0, 0xb8, 0x00, 0x1e, 0x10, 0xb8, 0x00, 0x26, 0xdc, 0x00, 0xb8,
-  0x00, 0x0a, 0x2f, 0xb8, 0x00, 0x0e, 0x2f, 0xba, 0x00, 0x18, 0x00, 0x1a,
-  0x00, 0x67, 0x2b, 0xba, 0x00, 0x00, 0x00, 0x02, 0x00, 0x67, 0x2b, 0xb8,
-  0x00, 0x1a, 0x10, 0xb8, 0x00, 0x14, 0xd0, 0xba, 0x00, 0x24, 0x00, 0x1a,
-  0x00, 0x18, 0x11, 0x12, 0x39, 0x30, 0x31, 0x01, 0x17, 0x07, 0x21, 0x27,
-  0x37, 0x17, 0x33, 0x01, 0x06, 0x23, 0x2f, 0x01, 0x15, 0x07, 0x26, 0x27,
-  0x11, 0x37, 0x01, 0x23, 0x27, 0x36, 0x37, 0x21, 0x03, 0x35, 0x37, 0x16,
-  0x17, 0x11, 0x07, 0x25, 0x15, 0x07, 0x27, 0x11, 0x01, 0x7c, 0x28, 0x28,
-  0xfe, 0xfc, 0x28, 0x28, 0x14, 0x3c, 0x01, 0x04, 0x14, 0x3c, 0xf0, 0x14,
-  0x1e, 0x28, 0x0a, 0x14, 0x01, 0x2c, 0xef, 0x50, 0x0a, 0x28, 0x01, 0x2b,
-  0x0a, 0x1e, 0x28, 0x0a, 0x14, 0xfe, 0xc0, 0x3c, 0x14, 0x01, 0x90, 0x28,
-  0x28, 0x28, 0x28, 0x64, 0xfe, 0xfc, 0x28, 0xf0, 0x32, 0xd2, 0x50, 0x0a,
-  0x28, 0x01, 0x18, 0x14, 0x01, 0x22, 0x1e, 0x28, 0x0a, 0xfe, 0xde, 0xd2,
-  0x50, 0x0a, 0x28, 0xfe, 0xe8, 0x14, 0xfa, 0xbe, 0x3c, 0x14, 0x01, 0x04,
-  0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05,
-  0x00, 0x0c, 0x00, 0x12, 0x00, 0x17, 0x00, 0x1f, 0x00, 0xb3, 0xb8, 0x00,
-  0x64, 0x2b, 0xb8, 0x00, 0x20, 0x2f, 0xb8, 0x00, 0x02, 0x2f, 0xb8, 0x00,
-  0x00, 0xd0, 0xb8, 0x00, 0x20, 0x10, 0xb8, 0x00, 0x10, 0xd0, 0xb8, 0x00,
-  0x10, 0x2f, 0xb8, 0x00, 0x11, 0xdc, 0xb8, 0x00, 0x03, 0xd0, 0xb8, 0x00,
-  0x11, 0x10, 0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00,
-  0x07, 0xdc, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0xba, 0x00,
-  0x0d, 0x00, 0x02, 0x00, 0x07, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x11, 0x10,
-  0xb8, 0x00, 0x13, 0xd0, 0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00, 0x16, 0xd0,
-  0xb8, 0x00, 0x11, 0x10, 0xb8, 0x00, 0x18, 0xd0, 0xb8, 0x00, 0x18, 0x2f,
-  0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00, 0x19, 0xd0, 0xb8, 0x00, 0x19, 0x2f,
-  0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00, 0x1e, 0xd0, 0xb8, 0x00, 0x02, 0x10,
-  0xb8, 0x00, 0x1f, 0xd0, 0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00, 0x21, 0xdc,
-  0x00, 0xba, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x1b,
-  0x00, 0x18, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x00, 0x00, 0x02, 0x00, 0x67,
-  0x2b, 0xb8, 0x00, 0x0b, 0x10, 0xb8, 0x00, 0x11, 0xd0, 0xba, 0x00, 0x17,
-  0x00, 0x18, 0x00, 0x1b, 0x11, 0x12, 0x39, 0x30, 0x31, 0x01, 0x17, 0x07,
-  0x21, 0x27, 0x37, 0x05, 0x17, 0x11, 0x06, 0x07, 0x27, 0x35, 0x13, 0x21,
-  0x26, 0x27, 0x37, 0x33, 0x03, 0x15, 0x07, 0x27, 0x11, 0x17, 0x27, 0x36,
-  0x37, 0x21, 0x16, 0x17, 0x07, 0x01, 0x7c, 0x28, 0x28, 0xfe, 0xfc, 0x28,
-  0x28, 0x01, 0x40, 0x14, 0x0a, 0x28, 0x1e, 0x0a, 0xfe, 0xd4, 0x28, 0x0a,
-  0x50, 0xf0, 0xf0, 0x3c, 0x14, 0x51, 0x50, 0x0a, 0x28, 0x01, 0x3f, 0x28,
-  0x0a, 0x50, 0x01, 0x90, 0x28, 0x28, 0x28, 0x28, 0x32, 0x14, 0xfe, 0xe8,
-  0x28, 0x0a, 0x50, 0xd2, 0xfe, 0xde, 0x0a, 0x28, 0x1e, 0x02, 0x1c, 0xbe,
-  0x3c, 0x14, 0x01, 0x04, 0x0a, 0x1e, 0x28, 0x0a, 0x0a, 0x28, 0x1e, 0x00,
-  0x00, 0x03, 0x00, 0x29, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x06,
-  0x00, 0x0b, 0x00, 0x13, 0x00, 0x2b, 0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00,
-  0x02, 0x00, 0x05, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x05, 0x10, 0xb8, 0x00,
-  0x07, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x09, 0xd0, 0x00, 0xb8,
-  0x00, 0x04, 0x2f, 0xba, 0x00, 0x0f, 0x00, 0x0c, 0x00, 0x67, 0x2b, 0x30,
-  0x31, 0x13, 0x17, 0x11, 0x06, 0x07, 0x27, 0x3d, 0x02, 0x33, 0x15, 0x07,
-  0x03, 0x27, 0x36, 0x37, 0x21, 0x16, 0x17, 0x07, 0xfa, 0x28, 0x0a, 0x28,
-  0x1e, 0x50, 0x28, 0x81, 0x50, 0x0a, 0x28, 0x01, 0x3f, 0x28, 0x0a, 0x50,
-  0x01, 0x5e, 0x28, 0xfe, 0xfc, 0x28, 0x0a, 0x50, 0xe6, 0x64, 0xd2, 0xd2,
-  0x28, 0x01, 0x0e, 0x1e, 0x28, 0x0a, 0x0a, 0x28, 0x1e, 0x00, 0x00, 0x00,
-  0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x06,
-  0x00, 0x0c, 0x00, 0x11, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x77, 0xb8, 0x00,
-  0x64, 0x2b, 0xb8, 0x00, 0x20, 0x2f, 0xb8, 0x00, 0x05, 0x2f, 0xb8, 0x00,
-  0x02, 0xdc, 0xba, 0x00, 0x07, 0x00, 0x05, 0x00, 0x02, 0x11, 0x12, 0x39,
-  0xb8, 0x00, 0x20, 0x10, 0xb8, 0x00, 0x0d, 0xd0, 0xb8, 0x00, 0x0d, 0x2f,
-  0xb8, 0x00, 0x0b, 0xdc, 0xb8, 0x00, 0x10, 0xd0, 0xb8, 0x00, 0x05, 0x10,
-  0xb8, 0x00, 0x12, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x16, 0xd0,
-  0xb8, 0x00, 0x0d, 0x10, 0xb8, 0x00, 0x1a, 0xd0, 0xb8, 0x00, 0x0b, 0x10,
-  0xb8, 0x00, 0x1e, 0xd0, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x21, 0xdc,
-  0x00, 0xb8, 0x00, 0x14, 0x2f, 0xba, 0x00, 0x05, 0x00, 0x07, 0x00, 0x67,
-  0x2b, 0xb8, 0x00, 0x05, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0xba, 0x00, 0x0d,
-  0x00, 0x07, 0x00, 0x05, 0x11, 0x12, 0x39, 0x30, 0x31, 0x01, 0x17, 0x11,
-  0x06, 0x07, 0x27, 0x35, 0x13, 0x21, 0x26, 0x27, 0x37, 0x33, 0x05, 0x11,
-  0x37, 0x17, 0x15, 0x01, 0x35, 0x37, 0x16, 0x17, 0x11, 0x07, 0x05, 0x27,
-  0x11, 0x36, 0x37, 0x17, 0x15, 0x01, 0xb8, 0x14, 0x0a, 0x28, 0x1e, 0x0a,
-  0xfe, 0xd4, 0x28, 0x0a, 0x50, 0xf0, 0xfe, 0xc0, 0x14, 0x3c, 0x01, 0x04,
-  0x1e, 0x28, 0x0a, 0x14, 0xfe, 0x84, 0x14, 0x0a, 0x28, 0x1e, 0x01, 0x5e,
-  0x14, 0xfe, 0xe8, 0x28, 0x0a, 0x50, 0xd2, 0xfe, 0xde, 0x0a, 0x28, 0x1e,
-  0x0a, 0x01, 0x04, 0x14, 0x3c, 0xbe, 0x01, 0x4a, 0xd2, 0x50, 0x0a, 0x28,
-  0xfe, 0xe8, 0x14, 0x0a, 0x14, 0x01, 0x18, 0x28, 0x0a, 0x50, 0xd2, 0x00,
-  0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xc6, 0x00, 0x06,
-  0x00, 0x0d, 0x00, 0x13, 0x00, 0x19, 0x00, 0x73, 0xb8, 0x00, 0x64, 0x2b,
-  0xb8, 0x00, 0x1a, 0x2f, 0xb8, 0x00, 0x07, 0x2f, 0xb8, 0x00, 0x1a, 0x10,
-  0xb8, 0x00, 0x01, 0xd0, 0xb8, 0x00, 0x01, 0x2f, 0xb8, 0x00, 0x06, 0xdc,
-  0xb8, 0x00, 0x07, 0x10, 0xb8, 0x00, 0x0c, 0xdc, 0xba, 0x00, 0x0f, 0x00,
-  0x01, 0x00, 0x0c, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x01, 0x10, 0xb8, 0x00,
-  0x10, 0xd0, 0xb8, 0x00, 0x06, 0x10, 0xb8, 0x00, 0x13, 0xd0, 0xb8, 0x00,
-  0x07, 0x10, 0xb8, 0x00, 0x14, 0xd0, 0xb8, 0x00, 0x0c, 0x10, 0xb8, 0x00,
-  0x16, 0xd0, 0xba, 0x00, 0x18, 0x00, 0x01, 0x00, 0x0c, 0x11, 0x12, 0x39,
-  0xb8, 0x00, 0x0c, 0x10, 0xb8, 0x00, 0x1b, 0xdc, 0x00, 0xb8, 0x00, 0x04,
-  0x2f, 0xb8, 0x00, 0x09, 0x2f, 0xb8, 0x00, 0x0f, 0x2f, 0xb8, 0x00, 0x18,
-  0x2f, 0x30, 0x31, 0x13, 0x27, 0x11, 0x36, 0x37, 0x17, 0x15, 0x21, 0x35,
-  0x37, 0x16, 0x17, 0x11, 0x0f, 0x01, 0x15, 0x03, 0x35, 0x37, 0x17, 0x21,
-  0x37, 0x17, 0x15, 0x03, 0x35, 0x3c, 0x14, 0x0a, 0x28, 0x1e, 0x01, 0x04,
-  0x1e, 0x28, 0x0a, 0x14, 0xc8, 0xc8, 0x14, 0x3c, 0x01, 0x04, 0x3c, 0x14,
-  0xc8, 0x01, 0x68, 0x14, 0x01, 0x18, 0x28, 0x0a, 0x50, 0xd2, 0xd2, 0x50,
-  0x0a, 0x28, 0xfe, 0xe8, 0x14, 0xf0, 0x78, 0x01, 0x04, 0x3c, 0x14, 0x3c,
-  0x3c, 0x14, 0x3c, 0xfe, 0xfc, 0x78, 0x00, 0x00, 0x00, 0x06, 0x00, 0x28,
-  0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x11,
-  0x00, 0x16, 0x00, 0x1d, 0x00, 0x24, 0x00, 0xbb, 0xb8, 0x00, 0x64, 0x2b,
-  0xb8, 0x00, 0x25, 0x2f, 0xb8, 0x00, 0x12, 0xd0, 0xb8, 0x00, 0x12, 0x2f,
-  0xb8, 0x00, 0x01, 0xdc, 0x41, 0x03, 0x00, 0x60, 0x00, 0x01, 0x00, 0x01,
-  0x5d, 0x41, 0x03, 0x00, 0xc0, 0x00, 0x01, 0x00, 0x01, 0x5d, 0xb8, 0x00,
-  0x00, 0xdc, 0xb8, 0x00, 0x01, 0x10, 0xb8, 0x00, 0x05, 0xdc, 0x41, 0x03,
-  0x00, 0xc0, 0x00, 0x05, 0x00, 0x01, 0x5d, 0x41, 0x03, 0x00, 0x60, 0x00,
-  0x05, 0x00, 0x01, 0x5d, 0xb8, 0x00, 0x0a, 0xdc, 0xba, 0x00, 0x0c, 0x00,
-  0x05, 0x00, 0x0a, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x12, 0x10, 0xb8, 0x00,
-  0x0f, 0xd0, 0xb8, 0x00, 0x0f, 0x2f, 0xb8, 0x00, 0x12, 0x10, 0xb8, 0x00,
-  0x16, 0xdc, 0xb8, 0x00, 0x10, 0xd0, 0xb8, 0x00, 0x10, 0x2f, 0xb8, 0x00,
-  0x0a, 0x10, 0xb8, 0x00, 0x18, 0xd0, 0xb8, 0x00, 0x05, 0x10, 0xb8, 0x00,
-  0x1c, 0xd0, 0xb8, 0x00, 0x12, 0x10, 0xb8, 0x00, 0x1f, 0xd0, 0xb8, 0x00,
-  0x16, 0x10, 0xb8, 0x00, 0x23, 0xd0, 0xb8, 0x00, 0x0a, 0x10, 0xb8, 0x00,
-  0x26, 0xdc, 0x00, 0xb8, 0x00, 0x07, 0x2f, 0xb8, 0x00, 0x22, 0x2f, 0xba,
-  0x00, 0x1c, 0x00, 0x0c, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x1c, 0x10, 0xb8,
-  0x00, 0x10, 0xd0, 0xba, 0x00, 0x12, 0x00, 0x0c, 0x00, 0x1c, 0x11, 0x12,
-  0x39, 0x30, 0x31, 0x25, 0x23, 0x35, 0x37, 0x17, 0x37, 0x35, 0x37, 0x16,
-  0x17, 0x11, 0x07, 0x03, 0x21, 0x26, 0x27, 0x37, 0x33, 0x05, 0x11, 0x37,
-  0x17, 0x15, 0x25, 0x17, 0x11, 0x06, 0x07, 0x27, 0x35, 0x25, 0x27, 0x11,
-  0x36, 0x37, 0x17, 0x15, 0x01, 0x22, 0x50, 0x28, 0x28, 0x5a, 0x1e, 0x28,
-  0x0a, 0x14, 0x32, 0xfe, 0xd5, 0x28, 0x0a, 0x50, 0xef, 0xfe, 0xc0, 0x14,
-  0x3c, 0x01, 0x40, 0x14, 0x0a, 0x28, 0x1e, 0xfe, 0xc0, 0x14, 0x0a, 0x28,
-  0x1e, 0x64, 0xe6, 0x28, 0x28, 0x64, 0xd2, 0x50, 0x0a, 0x28, 0xfe, 0xe8,
-  0x14, 0xfe, 0x8e, 0x0a, 0x28, 0x1e, 0x0a, 0x01, 0x04, 0x14, 0x3c, 0xbe,
-  0xfa, 0x14, 0xfe, 0xe8, 0x28, 0x0a, 0x50, 0xd2, 0x50, 0x14, 0x01, 0x18,
-  0x28, 0x0a, 0x50, 0xd2, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc,
-  0x02, 0xd0, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x17, 0x00, 0x37,
-  0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x67, 0x2b,
-  0xb8, 0x00, 0x0b, 0x10, 0xb8, 0x00, 0x00, 0xd0, 0xb8, 0x00, 0x00, 0x2f,
-  0xb8, 0x00, 0x11, 0x10, 0xb8, 0x00, 0x12, 0xd0, 0xb8, 0x00, 0x12, 0x2f,
-  0x00, 0xb8, 0x00, 0x04, 0x2f, 0xb8, 0x00, 0x0d, 0x2f, 0xb8, 0x00, 0x07,
-  0x2f, 0xb8, 0x00, 0x16, 0x2f, 0x30, 0x31, 0x01, 0x33, 0x13, 0x06, 0x23,
-  0x27, 0x3f, 0x01, 0x32, 0x17, 0x03, 0x23, 0x0f, 0x01, 0x22, 0x27, 0x13,
-  0x33, 0x37, 0x23, 0x03, 0x36, 0x33, 0x17, 0x01, 0x04, 0x2d, 0x9a, 0x14,
-  0x3c, 0x77, 0x01, 0x77, 0x3c, 0x14, 0x9a, 0x2d, 0x16, 0x77, 0x3c, 0x14,
-  0x9a, 0x2d, 0x01, 0x2d, 0x9a, 0x14, 0x3c, 0x77, 0x01, 0x5e, 0xfe, 0xca,
-  0x28, 0xf2, 0xec, 0xf2, 0x28, 0xfe, 0xca, 0x80, 0xf2, 0x28, 0x01, 0x36,
-  0x14, 0x01, 0x36, 0x28, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x28,
-  0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x12,
-  0x00, 0x17, 0x00, 0x1e, 0x00, 0x89, 0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00,
-  0x1f, 0x2f, 0xb8, 0x00, 0x00, 0x2f, 0xb8, 0x00, 0x02, 0xd0, 0xb8, 0x00,
-  0x1f, 0x10, 0xb8, 0x00, 0x10, 0xd0, 0xb8, 0x00, 0x10, 0x2f, 0xb8, 0x00,
-  0x11, 0xdc, 0xb8, 0x00, 0x03, 0xd0, 0xb8, 0x00, 0x11, 0x10, 0xb8, 0x00,
-  0x05, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x1d, 0xdc, 0xb8, 0x00,
-  0x07, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x0b, 0xd0, 0xba, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x1d, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x11, 0x10,
-  0xb8, 0x00, 0x13, 0xd0, 0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00, 0x16, 0xd0,
-  0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x18, 0xd0, 0xb8, 0x00, 0x1d, 0x10,
-  0xb8, 0x00, 0x20, 0xdc, 0x00, 0xb8, 0x00, 0x1a, 0x2f, 0xba, 0x00, 0x0b,
-  0x00, 0x0d, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x00, 0x00, 0x02, 0x00, 0x67,
-  0x2b, 0xb8, 0x00, 0x0b, 0x10, 0xb8, 0x00, 0x11, 0xd0, 0x30, 0x31, 0x01,
-  0x17, 0x07, 0x21, 0x27, 0x37, 0x05, 0x17, 0x11, 0x06, 0x07, 0x27, 0x35,
-  0x13, 0x21, 0x26, 0x27, 0x37, 0x33, 0x03, 0x15, 0x07, 0x27, 0x11, 0x05,
-  0x35, 0x37, 0x16, 0x17, 0x11, 0x07, 0x01, 0x7c, 0x28, 0x28, 0xfe, 0xfc,
-  0x28, 0x28, 0x01, 0x40, 0x14, 0x0a, 0x28, 0x1e, 0x0a, 0xfe, 0xd4, 0x28,
-  0x0a, 0x50, 0xf0, 0xf0, 0x3c, 0x14, 0x01, 0x54, 0x1e, 0x28, 0x0a, 0x14,
-  0x01, 0x90, 0x28, 0x28, 0x28, 0x28, 0x32, 0x14, 0xfe, 0xe8, 0x28, 0x0a,
-  0x50, 0xd2, 0xfe, 0xde, 0x0a, 0x28, 0x1e, 0x02, 0x3a, 0xdc, 0x3c, 0x14,
-  0x01, 0x22, 0xfa, 0xd2, 0x50, 0x0a, 0x28, 0xfe, 0xe8, 0x14, 0x00, 0x00,
-  0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x01, 0xcc, 0x02, 0xd0, 0x00, 0x03,
-  0x00, 0x09, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x27, 0xb8, 0x00, 0x64, 0x2b,
-  0x00, 0xba, 0x00, 0x03, 0x00, 0x00, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x09,
-  0x00, 0x04, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x09, 0x10, 0xb8, 0x00, 0x0b,
-  0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x11, 0xd0, 0x30, 0x31, 0x29,
-  0x01, 0x37, 0x33, 0x03, 0x23, 0x27, 0x36, 0x37, 0x21, 0x03, 0x13, 0x32,
-  0x17, 0x03, 0x23, 0x17, 0x03, 0x22, 0x27, 0x13, 0x33, 0x01, 0xa4, 0xfe,
-  0xe8, 0x28, 0xd2, 0x46, 0xc7, 0x50, 0x0a, 0x28, 0x01, 0x0d, 0x6e, 0x82,
-  0x3c, 0x14, 0x96, 0x3c, 0x0a, 0x8c, 0x3c, 0x14, 0xa0, 0x3c, 0x50, 0x02,
-  0x30, 0x1e, 0x28, 0x0a, 0xfe, 0xde, 0x01, 0x22, 0x28, 0xfe, 0xca, 0x50,
-  0xfe, 0xde, 0x28, 0x01, 0x36, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1e,
-  0x00, 0x00, 0x01, 0x68, 0x02, 0xd0, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x10,
-  0x00, 0x17, 0x00, 0x1d, 0x00, 0x4b, 0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x67, 0x2b, 0xb8, 0x00, 0x04, 0x10, 0xb8, 0x00,
-  0x0c, 0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x0f, 0xd0, 0x00, 0xba,
-  0x00, 0x17, 0x00, 0x12, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x0a, 0x00, 0x05,
-  0x00, 0x67, 0x2b, 0xba, 0x00, 0x18, 0x00, 0x1a, 0x00, 0x67, 0x2b, 0xba,
-  0x00, 0x00, 0x00, 0x12, 0x00, 0x17, 0x11, 0x12, 0x39, 0xba, 0x00, 0x10,
-  0x00, 0x05, 0x00, 0x0a, 0x11, 0x12, 0x39, 0x30, 0x31, 0x37, 0x35, 0x37,
-  0x17, 0x15, 0x13, 0x23, 0x27, 0x36, 0x37, 0x33, 0x17, 0x07, 0x15, 0x07,
-  0x27, 0x35, 0x13, 0x07, 0x23, 0x26, 0x27, 0x37, 0x33, 0x03, 0x17, 0x07,
-  0x23, 0x27, 0x37, 0x96, 0x3c, 0x14, 0x46, 0x45, 0x50, 0x0a, 0x28, 0x8b,
-  0x14, 0x82, 0x14, 0x3c, 0xd2, 0x14, 0x8b, 0x28, 0x0a, 0x50, 0x45, 0xa0,
-  0x28, 0x28, 0x46, 0x28, 0x28, 0x46, 0xdc, 0x3c, 0x14, 0xe6, 0x02, 0x1c,
-  0x1e, 0x28, 0x0a, 0x14, 0x50, 0xe6, 0x14, 0x3c, 0xdc, 0xfd, 0x8a, 0x14,
-  0x0a, 0x28, 0x1e, 0x01, 0x40, 0x28, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x28, 0x00, 0x00, 0x00, 0x78, 0x02, 0xd0, 0x00, 0x07,
-  0x00, 0x17, 0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00, 0x00, 0x00, 0x03, 0x00,
-  0x67, 0x2b, 0x00, 0xb8, 0x00, 0x02, 0x2f, 0xb8, 0x00, 0x05, 0x2f, 0x30,
-  0x31, 0x37, 0x06, 0x07, 0x27, 0x11, 0x37, 0x16, 0x17, 0x78, 0x0a, 0x28,
-  0x1e, 0x1e, 0x28, 0x0a, 0x32, 0x28, 0x0a, 0x50, 0x02, 0x30, 0x50, 0x0a,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x50, 0x00, 0x00, 0x01, 0x9a,
-  0x02, 0xd0, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x10, 0x00, 0x17, 0x00, 0x1d,
-  0x00, 0x4b, 0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x67, 0x2b, 0xb8, 0x00, 0x04, 0x10, 0xb8, 0x00, 0x0c, 0xd0, 0xb8, 0x00,
-  0x00, 0x10, 0xb8, 0x00, 0x0f, 0xd0, 0x00, 0xba, 0x00, 0x12, 0x00, 0x15,
-  0x00, 0x67, 0x2b, 0xba, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x67, 0x2b, 0xba,
-  0x00, 0x18, 0x00, 0x1a, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x04, 0x00, 0x15,
-  0x00, 0x12, 0x11, 0x12, 0x39, 0xba, 0x00, 0x0c, 0x00, 0x0a, 0x00, 0x07,
-  0x11, 0x12, 0x39, 0x30, 0x31, 0x37, 0x35, 0x37, 0x17, 0x15, 0x03, 0x37,
-  0x33, 0x16, 0x17, 0x07, 0x23, 0x37, 0x15, 0x07, 0x27, 0x35, 0x03, 0x33,
-  0x17, 0x06, 0x07, 0x23, 0x27, 0x01, 0x17, 0x07, 0x23, 0x27, 0x37, 0xd2,
-  0x14, 0x3c, 0xd2, 0x14, 0x8b, 0x28, 0x0a, 0x50, 0x45, 0x96, 0x3c, 0x14,
-  0x46, 0x45, 0x50, 0x0a, 0x28, 0x8b, 0x14, 0x01, 0x22, 0x28, 0x28, 0x46,
-  0x28, 0x28, 0x64, 0xe6, 0x14, 0x3c, 0xdc, 0x02, 0x76, 0x14, 0x0a, 0x28,
-  0x1e, 0x0a, 0xdc, 0x3c, 0x14, 0xe6, 0xfd, 0xe4, 0x1e, 0x28, 0x0a, 0x14,
-  0x01, 0x7c, 0x28, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1e,
-  0x01, 0x4a, 0x01, 0xd6, 0x02, 0x1c, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x11,
-  0x00, 0x17, 0x00, 0x1d, 0x00, 0x3f, 0xb8, 0x00, 0x64, 0x2b, 0x00, 0xb8,
-  0x00, 0x1a, 0x2f, 0xb8, 0x00, 0x12, 0x2f, 0xba, 0x00, 0x00, 0x00, 0x02,
-  0x00, 0x67, 0x2b, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x06, 0xd0, 0xb8,
-  0x00, 0x06, 0x2f, 0xb8, 0x00, 0x02, 0x10, 0xb8, 0x00, 0x08, 0xd0, 0xb8,
-  0x00, 0x08, 0x2f, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x0c, 0xd0, 0xb8,
-  0x00, 0x02, 0x10, 0xb8, 0x00, 0x0e, 0xd0, 0x30, 0x31, 0x01, 0x17, 0x07,
-  0x23, 0x27, 0x37, 0x07, 0x17, 0x07, 0x23, 0x27, 0x37, 0x25, 0x17, 0x07,
-  0x23, 0x27, 0x37, 0x27, 0x17, 0x07, 0x23, 0x27, 0x37, 0x1f, 0x01, 0x07,
-  0x23, 0x27, 0x37, 0x01, 0x0e, 0x28, 0x28, 0x28, 0x28, 0x28, 0x78, 0x28,
-  0x28, 0x28, 0x28, 0x28, 0x01, 0x68, 0x28, 0x28, 0x28, 0x28, 0x28, 0xc8,
-  0x28, 0x28, 0x28, 0x28, 0x28, 0xc8, 0x28, 0x28, 0x28, 0x28, 0x28, 0x01,
-  0xe0, 0x28, 0x28, 0x28, 0x28, 0x01, 0x28, 0x28, 0x28, 0x28, 0x01, 0x28,
-  0x28, 0x28, 0x28, 0x3c, 0x28, 0x28, 0x28, 0x28, 0x82, 0x28, 0x28, 0x28,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0xff, 0xff, 0x01, 0xea,
-  0x02, 0xd0, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x17, 0x00, 0x1d,
-  0x00, 0x23, 0x00, 0x29, 0x00, 0x2f, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x41,
-  0x00, 0x47, 0x00, 0x4d, 0x00, 0x53, 0x01, 0x29, 0xb8, 0x00, 0x64, 0x2b,
-  0xba, 0x00, 0x1c, 0x00, 0x08, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x2c, 0x00,
-  0x28, 0x00, 0x67, 0x2b, 0xba, 0x00, 0x0b, 0x00, 0x08, 0x00, 0x1c, 0x11,
-  0x12, 0x39, 0xb8, 0x00, 0x08, 0x10, 0xb8, 0x00, 0x10, 0xd0, 0xba, 0x00,
-  0x17, 0x00, 0x08, 0x00, 0x1c, 0x11, 0x12, 0x39, 0xba, 0x00, 0x23, 0x00,
-  0x28, 0x00, 0x2c, 0x11, 0x12, 0x39, 0xba, 0x00, 0x2f, 0x00, 0x28, 0x00,
-  0x2c, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x2c, 0x10, 0xb8, 0x00, 0x34, 0xd0,
-  0xba, 0x00, 0x4a, 0x00, 0x08, 0x00, 0x1c, 0x11, 0x12, 0x39, 0xb8, 0x00,
-  0x4a, 0x2f, 0xb8, 0x00, 0x3a, 0xdc, 0xba, 0x00, 0x41, 0x00, 0x08, 0x00,
-  0x1c, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x4a, 0x10, 0xb8, 0x00, 0x46, 0xd0,
-  0xba, 0x00, 0x47, 0x00, 0x08, 0x00, 0x1c, 0x11, 0x12, 0x39, 0xba, 0x00,
-  0x4d, 0x00, 0x4a, 0x00, 0x3a, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x2c, 0x10,
-  0xb8, 0x00, 0x55, 0xdc, 0x00, 0xb8, 0x00, 0x0a, 0x2f, 0xb8, 0x00, 0x1a,
-  0x2f, 0xb8, 0x00, 0x26, 0x2f, 0xb8, 0x00, 0x2e, 0x2f, 0xb8, 0x00, 0x40,
-  0x2f, 0xb8, 0x00, 0x44, 0x2f, 0xb8, 0x00, 0x40, 0x10, 0xb8, 0x00, 0x38,
-  0xdc, 0xb8, 0x00, 0x01, 0xd0, 0xba, 0x00, 0x11, 0x00, 0x40, 0x00, 0x0a,
-  0x11, 0x12, 0x39, 0xba, 0x00, 0x17, 0x00, 0x40, 0x00, 0x0a, 0x11, 0x12,
-  0x39, 0xba, 0x00, 0x1d, 0x00, 0x40, 0x00, 0x0a, 0x11, 0x12, 0x39, 0xb8,
-  0x00, 0x38, 0x10, 0xb8, 0x00, 0x22, 0xd0, 0xba, 0x00, 0x23, 0x00, 0x40,
-  0x00, 0x0a, 0x11, 0x12, 0x39, 0xba, 0x00, 0x29, 0x00, 0x40, 0x00, 0x38,
-  0x11, 0x12, 0x39, 0xb8, 0x00, 0x40, 0x10, 0xb8, 0x00, 0x2f, 0xd0, 0xb8,
-  0x00, 0x2f, 0x2f, 0xba, 0x00, 0x35, 0x00, 0x40, 0x00, 0x38, 0x11, 0x12,
-  0x39, 0xba, 0x00, 0x3b, 0x00, 0x40, 0x00, 0x38, 0x11, 0x12, 0x39, 0xba,
-  0x00, 0x47, 0x00, 0x40, 0x00, 0x38, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x38,
-  0x10, 0xb8, 0x00, 0x4c, 0xd0, 0xba, 0x00, 0x4d, 0x00, 0x40, 0x00, 0x0a,
-  0x11, 0x12, 0x39, 0x30, 0x31, 0x13, 0x07, 0x06, 0x3f, 0x01, 0x33, 0x27,
-  0x23, 0x27, 0x36, 0x37, 0x33, 0x07, 0x15, 0x07, 0x26, 0x27, 0x35, 0x17,
-  0x33, 0x17, 0x06, 0x07, 0x23, 0x37, 0x35, 0x37, 0x16, 0x17, 0x15, 0x13,
-  0x23, 0x27, 0x36, 0x37, 0x33, 0x07, 0x15, 0x07, 0x26, 0x27, 0x35, 0x17,
-  0x33, 0x17, 0x06, 0x07, 0x23, 0x37, 0x35, 0x37, 0x16, 0x17, 0x15, 0x25,
-  0x35, 0x37, 0x16, 0x17, 0x15, 0x27, 0x33, 0x17, 0x06, 0x07, 0x23, 0x37,
-  0x15, 0x07, 0x26, 0x27, 0x35, 0x17, 0x23, 0x27, 0x36, 0x37, 0x33, 0x13,
-  0x37, 0x36, 0x0f, 0x01, 0x27, 0xe5, 0xa0, 0x3c, 0x01, 0xbd, 0x1e, 0x8b,
-  0x0a, 0x50, 0x0a, 0x28, 0x46, 0x28, 0x1e, 0x28, 0x0a, 0x64, 0x0a, 0x50,
-  0x0a, 0x28, 0x46, 0x28, 0x1e, 0x28, 0x0a, 0xc8, 0x0a, 0x50, 0x0a, 0x28,
-  0x46, 0x27, 0x1e, 0x28, 0x0a, 0x63, 0x0a, 0x50, 0x0a, 0x28, 0x46, 0x28,
-  0x1e, 0x28, 0x0a, 0xfe, 0xca, 0x1e, 0x28, 0x0a, 0x5a, 0x0a, 0x50, 0x0a,
-  0x28, 0x46, 0x0a, 0x1e, 0x28, 0x0a, 0x5a, 0x0a, 0x50, 0x0a, 0x28, 0x46,
-  0x32, 0xa0, 0x3c, 0x01, 0xbd, 0x1e, 0x01, 0x8f, 0x9f, 0x01, 0x3c, 0xbe,
-  0x97, 0x1e, 0x28, 0x0a, 0x64, 0x3c, 0x50, 0x0a, 0x28, 0x78, 0x5a, 0x1e,
-  0x28, 0x0a, 0x64, 0x3c, 0x50, 0x0a, 0x28, 0x78, 0xfe, 0x7a, 0x1e, 0x28,
-  0x0a, 0x64, 0x3c, 0x50, 0x0a, 0x28, 0x78, 0x5a, 0x1e, 0x28, 0x0a, 0x64,
-  0x3c, 0x50, 0x0a, 0x28, 0x78, 0x1e, 0x3c, 0x50, 0x0a, 0x28, 0x78, 0x09,
-  0x1e, 0x28, 0x0a, 0x8d, 0x3c, 0x50, 0x0a, 0x28, 0x78, 0x0a, 0x1e, 0x28,
-  0x0a, 0x01, 0x23, 0x9f, 0x01, 0x3c, 0xbf, 0x01, 0x00, 0x01, 0x00, 0xdc,
-  0x02, 0x08, 0x01, 0x2c, 0x02, 0xd0, 0x00, 0x04, 0x00, 0x17, 0xb8, 0x00,
-  0x64, 0x2b, 0xba, 0x00, 0x00, 0x00, 0x01, 0x00, 0x67, 0x2b, 0x00, 0xb8,
-  0x00, 0x00, 0x2f, 0xb8, 0x00, 0x03, 0x2f, 0x30, 0x31, 0x01, 0x23, 0x35,
-  0x37, 0x17, 0x01, 0x2c, 0x50, 0x28, 0x28, 0x02, 0x08, 0xa0, 0x28, 0x28,
-  0x00, 0x01, 0x00, 0xdc, 0x02, 0x08, 0x01, 0x2c, 0x02, 0xd0, 0x00, 0x04,
-  0x00, 0x17, 0xb8, 0x00, 0x64, 0x2b, 0xba, 0x00, 0x00, 0x00, 0x02, 0x00,
-  0x67, 0x2b, 0x00, 0xb8, 0x00, 0x01, 0x2f, 0xb8, 0x00, 0x03, 0x2f, 0x30,
-  0x31, 0x01, 0x07, 0x27, 0x35, 0x33, 0x01, 0x2c, 0x28, 0x28, 0x50, 0x02,
-  0x30, 0x28, 0x28, 0xa0, 0x00, 0x02, 0x00, 0x8c, 0x02, 0x08, 0x01, 0x7c,
-  0x02, 0xd1, 0x00, 0x04, 0x00, 0x09, 0x00, 0x3b, 0xb8, 0x00, 0x64, 0x2b,
-  0xb8, 0x00, 0x0a, 0x2f, 0xb8, 0x00, 0x06, 0x2f, 0xb8, 0x00, 0x0a, 0x10,
-  0xb8, 0x00, 0x01, 0xd0, 0xb8, 0x00, 0x01, 0x2f, 0xb8, 0x00, 0x00, 0xdc,
-  0xb8, 0x00, 0x06, 0x10, 0xb8, 0x00, 0x05, 0xdc, 0xb8, 0x00, 0x0b, 0xdc,
-  0x00, 0xb8, 0x00, 0x03, 0x2f, 0xb8, 0x00, 0x08, 0x2f, 0xb8, 0x00, 0x00,
-  0x2f, 0xb8, 0x00, 0x05, 0x2f, 0x30, 0x31, 0x13, 0x23, 0x35, 0x37, 0x1f,
-  0x01, 0x23, 0x35, 0x37, 0x17, 0xdc, 0x50, 0x28, 0x28, 0xa0, 0x50, 0x28,
-  0x28, 0x02, 0x09, 0xa0, 0x28, 0x28, 0xa1, 0xa0, 0x28, 0x28, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x8c, 0x02, 0x08, 0x01, 0x7d, 0x02, 0xd1, 0x00, 0x04,
-  0x00, 0x09, 0x00, 0x3b, 0xb8, 0x00, 0x64, 0x2b, 0xb8, 0x00, 0x0a, 0x2f,
-  0xb8, 0x00, 0x07, 0x2f, 0xb8, 0x00, 0x0a, 0x10, 0xb8, 0x00, 0x02, 0xd0,
-  0xb8, 0x00, 0x02, 0x2f, 0xb8, 0x00, 0x00, 0xdc, 0xb8, 0x00, 0x07, 0x10,
-  0xb8, 0x00, 0x05, 0xdc, 0xb8, 0x00, 0x0b, 0xdc, 0x00, 0xb8, 0x00, 0x03,
-  0x2f, 0xb8, 0x00, 0x08, 0x2f, 0xb8, 0x00, 0x01, 0x2f, 0xb8, 0x00, 0x06,
-  0x2f, 0x30, 0x31, 0x13, 0x07, 0x27, 0x35, 0x33, 0x17, 0x07, 0x27, 0x35,
-  0x33, 0xdc, 0x28, 0x28, 0x50, 0xa1, 0x28, 0x28, 0x50, 0x02, 0x30, 0x28,
-  0x28, 0xa0, 0x9f, 0x28, 0x28, 0xa0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x64,
-  0x00, 0xdc, 0x01, 0x86, 0x01, 0xfe, 0x00, 0x0b, 0x00, 0x0f, 0xb8, 0x00,
-  0x64, 0x2b, 0x00, 0xb8, 0x00, 0x06, 0x2f, 0xb8, 0x00, 0x00, 0x2f, 0x30,
-  0x31, 0x37, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
-  0x06, 0xf5, 0x3c, 0x55, 0x55, 0x3c, 0x3c, 0x55, 0x55, 0xdc, 0x55, 0x3c,
-  0x3c, 0x55, 0x55, 0x3c, 0x3c, 0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1e,
-  0x01, 0x40, 0x01, 0xd6, 0x01, 0x90, 0x00, 0x05, 0x00, 0x0f, 0xb8, 0x00,
-  0x64, 0x2b, 0x00, 0xba, 0x00, 0x00, 0x00, 0x02, 0x00, 0x67, 0x2b, 0x30,
-  0x31, 0x01, 0x17, 0x07, 0x21, 0x27, 0x37, 0x01, 0xae, 0x28, 0x28, 0xfe,
-  0x98, 0x28, 0x28, 0x01, 0x90, 0x28, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x0a, 0x01, 0x40, 0x01, 0xea, 0x01, 0x90, 0x00, 0x05,
-  0x00, 0x0f, 0xb8, 0x00, 0x64, 0x2b, 0x00, 0xba, 0x00, 0x00, 0x00, 0x02,
-  0x00, 0x67, 0x2b, 0x30, 0x31, 0x01, 0x17, 0x07, 0x21, 0x27, 0x37, 0x01,
-  0xc2, 0x28, 0x28, 0xfe, 0x70, 0x28, 0x28, 0x01, 0x90, 0x28, 0x28, 0x28,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe0,
-  0x02, 0xd0, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x1d,
-  0x00, 0x23, 0x00, 0x29, 0x00, 0xa5, 0xb8, 0x00, 0x6e, 0x2b, 0xba, 0x00,
-  0x04, 0x00, 0x0d, 0x00, 0x71, 0x2b, 0xba, 0x00, 0x19, 0x00, 0x23, 0x00,
-  0x71, 0x2b, 0xba, 0x00, 0x10, 0x00, 0x13, 0x00, 0x71, 0x2b, 0xba, 0x00,
-  0x00, 0x00, 0x13, 0x00, 0x10, 0x11, 0x12, 0x39, 0xba, 0x00, 0x0b, 0x00,
-  0x13, 0x00, 0x10, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x04, 0x10, 0xb8, 0x00,
-  0x0f, 0xd0, 0xba, 0x00, 0x1d, 0x00, 0x0d, 0x00, 0x10, 0x11, 0x12, 0x39,
-  0xb8, 0x00, 0x19, 0x10, 0xb8, 0x00, 0x1f, 0xd0, 0xba, 0x00, 0x29, 0x00,
-  0x23, 0x00, 0x19, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00,
-  0x2b, 0xdc, 0x00, 0xba, 0x00, 0x13, 0x00, 0x00, 0x00, 0x71, 0x2b, 0xba,
-  0x00, 0x0b, 0x00, 0x14, 0x00, 0x71, 0x2b, 0xba, 0x00, 0x1d, 0x00, 0x18,
-  0x00, 0x71, 0x2b, 0xb8, 0x00, 0x13, 0x10, 0xb8, 0x00, 0x04, 0xd0, 0xb8,
-  0x00, 0x14, 0x10, 0xb8, 0x00, 0x07, 0xd0, 0xba, 0x00, 0x0d, 0x00, 0x00,
-  0x00, 0x13, 0x11, 0x12, 0x39, 0xba, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x0b,
-  0x11, 0x12, 0x39, 0xba, 0x00, 0x23, 0x00, 0x18, 0x00, 0x1d, 0x11, 0x12,
-  0x39, 0x30, 0x31, 0x29, 0x01, 0x26, 0x27, 0x37, 0x21, 0x11, 0x21, 0x27,
-  0x36, 0x37, 0x21, 0x01, 0x07, 0x11, 0x17, 0x01, 0x06, 0x07, 0x27, 0x11,
-  0x37, 0x16, 0x17, 0x07, 0x23, 0x27, 0x36, 0x37, 0x33, 0x07, 0x15, 0x07,
-  0x26, 0x27, 0x11, 0x17, 0x33, 0x17, 0x06, 0x07, 0x23, 0x01, 0x9a, 0xfe,
-  0x98, 0x28, 0x0a, 0x50, 0x01, 0x2c, 0xfe, 0xd5, 0x50, 0x0a, 0x28, 0x01,
-  0x67, 0xfe, 0xb6, 0x50, 0x50, 0x01, 0x90, 0x0a, 0x28, 0x1e, 0x1e, 0x28,
-  0x0a, 0x96, 0x82, 0x50, 0x0a, 0x28, 0xbe, 0xa0, 0x1e, 0x28, 0x0a, 0x64,
-  0x3c, 0x50, 0x0a, 0x28, 0x78, 0x0a, 0x28, 0x1e, 0x02, 0x30, 0x1e, 0x28,
-  0x0a, 0xfd, 0x94, 0x1e, 0x02, 0x44, 0x1e, 0xfd, 0xc6, 0x28, 0x0a, 0x50,
-  0x02, 0x30, 0x50, 0x0a, 0x28, 0xbe, 0x1e, 0x28, 0x0a, 0x64, 0xdc, 0x50,
-  0x0a, 0x28, 0x01, 0x18, 0xfa, 0x1e, 0x28, 0x0a, 0x00, 0x00, 0x00, 0x78,
-  0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0xb8, 0x00, 0xec, 0x01, 0xda,
-  0x02, 0x92, 0x03, 0x6a, 0x04, 0x14, 0x04, 0x2e, 0x04, 0x72, 0x04, 0xba,
-  0x05, 0x16, 0x05, 0x52, 0x05, 0x6c, 0x05, 0x86, 0x05, 0x9e, 0x05, 0xc0,
-  0x06, 0x5a, 0x06, 0x8e, 0x07, 0x1c, 0x07, 0x8e, 0x07, 0xf6, 0x08, 0x86,
-  0x09, 0x28, 0x09, 0x94, 0x0a, 0x4c, 0x0a, 0xf2, 0x0b, 0x1c, 0x0b, 0x46,
-  0x0b, 0x6e, 0x0b, 0x96, 0x0b, 0xbe, 0x0c, 0x40, 0x0d, 0x0a, 0x0d, 0xa8,
-  0x0e, 0x46, 0x0e, 0x98, 0x0f, 0x1a, 0x0f, 0x7c, 0x0f, 0xce, 0x10, 0x68,
-  0x10, 0xe0, 0x11, 0x10, 0x11, 0x74, 0x11, 0xf0, 0x12, 0x36, 0x12, 0xd8,
-  0x13, 0x42, 0x13, 0xaa, 0x14, 0x24, 0x14, 0xc2, 0x15, 0x5e, 0x15, 0xf4,
-  0x16, 0x30, 0x16, 0xa8, 0x17, 0x12, 0x17, 0xb2, 0x17, 0xfc, 0x18, 0x7c,
-  0x18, 0xbc, 0x19, 0x0a, 0x19, 0x2c, 0x19, 0x80, 0x19, 0xa2, 0x19, 0xbe,
-  0x19, 0xd6, 0x1a, 0x74, 0x1b, 0x12, 0x1b, 0x64, 0x1b, 0xe6, 0x1c, 0x48,
-  0x1c, 0x9a, 0x1d, 0x34, 0x1d, 0xac, 0x1d, 0xdc, 0x1e, 0x40, 0x1e, 0xbc,
-  0x1f, 0x02, 0x1f, 0xa4, 0x20, 0x0e, 0x20, 0x76, 0x20, 0xf0, 0x21, 0x8e,
-  0x22, 0x2a, 0x22, 0xc0, 0x22, 0xfc, 0x23, 0x74, 0x23, 0xde, 0x24, 0x7e,
-  0x24, 0xc8, 0x25, 0x48, 0x25, 0x88, 0x25, 0xe4, 0x26, 0x04, 0x26, 0x60,
-  0x26, 0xb8, 0x27, 0xd4, 0x27, 0xee, 0x28, 0x08, 0x28, 0x3c, 0x28, 0x70,
-  0x28, 0x8e, 0x28, 0xa8, 0x28, 0xc2, 0x29, 0x60, 0x00, 0x00, 0x00, 0x20,
-  0x01, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-  0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x08,
-  0x00, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x12,
-  0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12,
-  0x00, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x36,
-  0x00, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x32,
-  0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x14,
-  0x01, 0x2a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c,
-  0x01, 0x3e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0e,
-  0x01, 0x9a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04,
-  0x01, 0xa8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0e,
-  0x01, 0xac, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e,
-  0x01, 0xba, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x19,
-  0x01, 0xc8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0d,
-  0x01, 0xe1, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1e,
-  0x01, 0xee, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11,
-  0x02, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x19,
-  0x02, 0x1d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x41,
-  0x02, 0x36, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x0a,
-  0x02, 0x77, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x00, 0x00, 0xb8,
-  0x02, 0x81, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x1c,
-  0x03, 0x39, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x02, 0x00, 0x08,
-  0x03, 0x55, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x1c,
-  0x03, 0x5d, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x04, 0x00, 0x1c,
-  0x03, 0x79, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x32,
-  0x03, 0x95, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x1a,
-  0x03, 0xc7, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x08, 0x00, 0x3c,
-  0x03, 0xe1, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x09, 0x00, 0x22,
-  0x04, 0x1d, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0c, 0x00, 0x32,
-  0x04, 0x3f, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0d, 0x00, 0x82,
-  0x04, 0x71, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x13, 0x00, 0x14,
-  0x04, 0xf3, 0x00, 0x43, 0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x74,
-  0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20,
-  0x00, 0x53, 0x00, 0x69, 0x00, 0x7a, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x6b,
-  0x00, 0x6f, 0x00, 0x20, 0x00, 0x41, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x78,
-  0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x2e,
-  0x00, 0x20, 0x00, 0xa9, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x30,
-  0x00, 0x38, 0x00, 0x20, 0x00, 0x53, 0x00, 0x74, 0x00, 0x79, 0x00, 0x6c,
-  0x00, 0x65, 0x00, 0x2d, 0x00, 0x37, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x41,
-  0x00, 0x6c, 0x00, 0x6c, 0x00, 0x20, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67,
-  0x00, 0x68, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x72, 0x00, 0x65,
-  0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x76, 0x00, 0x65, 0x00, 0x64,
-  0x00, 0x2e, 0x00, 0x44, 0x00, 0x69, 0x00, 0x67, 0x00, 0x69, 0x00, 0x74,
-  0x00, 0x61, 0x00, 0x6c, 0x00, 0x2d, 0x00, 0x37, 0x00, 0x4d, 0x00, 0x6f,
-  0x00, 0x6e, 0x00, 0x6f, 0x00, 0x44, 0x00, 0x69, 0x00, 0x67, 0x00, 0x69,
-  0x00, 0x74, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x2d, 0x00, 0x37, 0x00, 0x44,
-  0x00, 0x69, 0x00, 0x67, 0x00, 0x69, 0x00, 0x74, 0x00, 0x61, 0x00, 0x6c,
-  0x00, 0x2d, 0x00, 0x37, 0x00, 0x56, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2e,
-  0x00, 0x30, 0x00, 0x30, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x63, 0x00, 0x74,
-  0x00, 0x20, 0x00, 0x30, 0x00, 0x32, 0x00, 0x20, 0x00, 0x31, 0x00, 0x33,
-  0x00, 0x3a, 0x00, 0x32, 0x00, 0x34, 0x00, 0x3a, 0x00, 0x30, 0x00, 0x30,
-  0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38, 0x00, 0x68,
-  0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f,
-  0x00, 0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x2e, 0x00, 0x73, 0x00, 0x74,
-  0x00, 0x79, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x73, 0x00, 0x65, 0x00, 0x76,
-  0x00, 0x65, 0x00, 0x6e, 0x00, 0x2e, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d,
-  0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35,
-  0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x43, 0x72, 0x65, 0x61,
-  0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x53, 0x69, 0x7a, 0x65, 0x6e,
-  0x6b, 0x6f, 0x20, 0x41, 0x6c, 0x65, 0x78, 0x61, 0x6e, 0x64, 0x65, 0x72,
-  0x2e, 0x20, 0xa9, 0x20, 0x32, 0x30, 0x30, 0x38, 0x20, 0x53, 0x74, 0x79,
-  0x6c, 0x65, 0x2d, 0x37, 0x2e, 0x20, 0x41, 0x6c, 0x6c, 0x20, 0x72, 0x69,
-  0x67, 0x68, 0x74, 0x73, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65,
-  0x64, 0x2e, 0x20, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
-  0x77, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x65, 0x76, 0x65, 0x6e,
-  0x2e, 0x63, 0x6f, 0x6d, 0x44, 0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x2d,
-  0x37, 0x20, 0x4d, 0x6f, 0x6e, 0x6f, 0x4d, 0x6f, 0x6e, 0x6f, 0x44, 0x69,
-  0x67, 0x69, 0x74, 0x61, 0x6c, 0x2d, 0x37, 0x20, 0x4d, 0x6f, 0x6e, 0x6f,
-  0x44, 0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x2d, 0x37, 0x20, 0x4d, 0x6f,
-  0x6e, 0x6f, 0x31, 0x2e, 0x30, 0x32, 0x20, 0x41, 0x70, 0x72, 0x20, 0x30,
-  0x37, 0x20, 0x31, 0x32, 0x3a, 0x31, 0x35, 0x3a, 0x30, 0x30, 0x20, 0x32,
-  0x30, 0x31, 0x31, 0x44, 0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x2d, 0x37,
-  0x4d, 0x6f, 0x6e, 0x6f, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20,
-  0x62, 0x79, 0x20, 0x53, 0x69, 0x7a, 0x65, 0x6e, 0x6b, 0x6f, 0x20, 0x41,
-  0x6c, 0x65, 0x78, 0x61, 0x6e, 0x64, 0x65, 0x72, 0x2e, 0x20, 0x53, 0x69,
-  0x7a, 0x65, 0x6e, 0x6b, 0x6f, 0x20, 0x41, 0x6c, 0x65, 0x78, 0x61, 0x6e,
-  0x64, 0x65, 0x72, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
-  0x77, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x65, 0x76, 0x65, 0x6e,
-  0x2e, 0x63, 0x6f, 0x6d, 0x46, 0x72, 0x65, 0x65, 0x77, 0x61, 0x72, 0x65,
-  0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x65, 0x72, 0x73, 0x6f, 0x6e, 0x61,
-  0x6c, 0x20, 0x75, 0x73, 0x65, 0x2e, 0x0d, 0x0a, 0x46, 0x6f, 0x72, 0x20,
-  0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x72, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x75,
-  0x73, 0x65, 0x20, 0x70, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x63, 0x6f,
-  0x6e, 0x74, 0x75, 0x63, 0x74, 0x20, 0x75, 0x73, 0x2e, 0x30, 0x31, 0x32,
-  0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x00, 0x43, 0x00, 0x72, 0x00,
-  0x65, 0x00, 0x61, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00,
-  0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x53, 0x00, 0x69, 0x00, 0x7a, 0x00,
-  0x65, 0x00, 0x6e, 0x00, 0x6b, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x41, 0x00,
-  0x6c, 0x00, 0x65, 0x00, 0x78, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00,
-  0x65, 0x00, 0x72, 0x00, 0x2e, 0x00, 0x20, 0x00, 0xa9, 0x00, 0x20, 0x00,
-  0x32, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38, 0x00, 0x20, 0x00, 0x53, 0x00,
-  0x74, 0x00, 0x79, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x2d, 0x00, 0x37, 0x00,
-  0x2e, 0x00, 0x20, 0x00, 0x41, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x20, 0x00,
-  0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x73, 0x00,
-  0x20, 0x00, 0x72, 0x00, 0x65, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00,
-  0x76, 0x00, 0x65, 0x00, 0x64, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x68, 0x00,
-  0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00,
-  0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x2e, 0x00, 0x73, 0x00, 0x74, 0x00,
-  0x79, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x73, 0x00, 0x65, 0x00, 0x76, 0x00,
-  0x65, 0x00, 0x6e, 0x00, 0x2e, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00,
-  0x44, 0x00, 0x69, 0x00, 0x67, 0x00, 0x69, 0x00, 0x74, 0x00, 0x61, 0x00,
-  0x6c, 0x00, 0x2d, 0x00, 0x37, 0x00, 0x20, 0x00, 0x4d, 0x00, 0x6f, 0x00,
-  0x6e, 0x00, 0x6f, 0x00, 0x4d, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x6f, 0x00,
-  0x44, 0x00, 0x69, 0x00, 0x67, 0x00, 0x69, 0x00, 0x74, 0x00, 0x61, 0x00,
-  0x6c, 0x00, 0x2d, 0x00, 0x37, 0x00, 0x20, 0x00, 0x4d, 0x00, 0x6f, 0x00,
-  0x6e, 0x00, 0x6f, 0x00, 0x44, 0x00, 0x69, 0x00, 0x67, 0x00, 0x69, 0x00,
-  0x74, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x2d, 0x00, 0x37, 0x00, 0x20, 0x00,
-  0x4d, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x31, 0x00, 0x2e, 0x00,
-  0x30, 0x00, 0x32, 0x00, 0x20, 0x00, 0x41, 0x00, 0x70, 0x00, 0x72, 0x00,
-  0x20, 0x00, 0x30, 0x00, 0x37, 0x00, 0x20, 0x00, 0x31, 0x00, 0x32, 0x00,
-  0x3a, 0x00, 0x31, 0x00, 0x35, 0x00, 0x3a, 0x00, 0x30, 0x00, 0x30, 0x00,
-  0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x31, 0x00, 0x44, 0x00,
-  0x69, 0x00, 0x67, 0x00, 0x69, 0x00, 0x74, 0x00, 0x61, 0x00, 0x6c, 0x00,
-  0x2d, 0x00, 0x37, 0x00, 0x4d, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x6f, 0x00,
-  0x43, 0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x74, 0x00, 0x65, 0x00,
-  0x64, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x53, 0x00,
-  0x69, 0x00, 0x7a, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x6b, 0x00, 0x6f, 0x00,
-  0x20, 0x00, 0x41, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x78, 0x00, 0x61, 0x00,
-  0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x2e, 0x00, 0x20, 0x00,
-  0x53, 0x00, 0x69, 0x00, 0x7a, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x6b, 0x00,
-  0x6f, 0x00, 0x20, 0x00, 0x41, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x78, 0x00,
-  0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x68, 0x00,
-  0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00,
-  0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x2e, 0x00, 0x73, 0x00, 0x74, 0x00,
-  0x79, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x73, 0x00, 0x65, 0x00, 0x76, 0x00,
-  0x65, 0x00, 0x6e, 0x00, 0x2e, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00,
-  0x46, 0x00, 0x72, 0x00, 0x65, 0x00, 0x65, 0x00, 0x77, 0x00, 0x61, 0x00,
-  0x72, 0x00, 0x65, 0x00, 0x20, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x72, 0x00,
-  0x20, 0x00, 0x70, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x6f, 0x00,
-  0x6e, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x20, 0x00, 0x75, 0x00, 0x73, 0x00,
-  0x65, 0x00, 0x2e, 0x00, 0x0d, 0x00, 0x0a, 0x00, 0x46, 0x00, 0x6f, 0x00,
-  0x72, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x6d, 0x00,
-  0x65, 0x00, 0x72, 0x00, 0x63, 0x00, 0x69, 0x00, 0x61, 0x00, 0x6c, 0x00,
-  0x20, 0x00, 0x75, 0x00, 0x73, 0x00, 0x65, 0x00, 0x20, 0x00, 0x70, 0x00,
-  0x6c, 0x00, 0x65, 0x00, 0x61, 0x00, 0x73, 0x00, 0x65, 0x00, 0x20, 0x00,
-  0x63, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x75, 0x00, 0x63, 0x00,
-  0x74, 0x00, 0x20, 0x00, 0x75, 0x00, 0x73, 0x00, 0x2e, 0x00, 0x30, 0x00,
-  0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00,
-  0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x88, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x01, 0x02, 0x00, 0x02,
-  0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08,
-  0x00, 0x09, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0e,
-  0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14,
-  0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a,
-  0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x20,
-  0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26,
-  0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c,
-  0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32,
-  0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38,
-  0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e,
-  0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44,
-  0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4a,
-  0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50,
-  0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56,
-  0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5c,
-  0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x61, 0x00, 0xc6,
-  0x00, 0xb6, 0x00, 0xb7, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0x87, 0x00, 0xb2,
-  0x00, 0xb3, 0x00, 0x8b, 0x04, 0x4e, 0x55, 0x4c, 0x4c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x08, 0x00, 0x02, 0x00, 0x10, 0x00, 0x01,
-  0xff, 0xff, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x04, 0x02, 0xbc, 0x00, 0x00, 0x6f, 0x1c, 0x02, 0xbc, 0x01, 0x35,
-  0x44, 0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x2d, 0x37, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x44, 0x69, 0x67, 0x69, 0x74, 0x61, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00
-};
-unsigned int digital_7_mono_font_size = 34404;
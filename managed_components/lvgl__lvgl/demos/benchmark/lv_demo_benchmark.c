@@ -75,18 +75,18 @@ static uint32_t disp_ori_timer_period;
 static uint32_t anim_ori_timer_period;
 
 #if LV_DEMO_BENCHMARK_RGB565A8 && LV_COLOR_DEPTH == 16
-    LV_IMG_DECLARE(img_benchmark_cogwheel_rgb565a8);
+    LV_IMG_DECLARE(img_benchmark_cogwheel_rgb565a8)
 #else
-    LV_IMG_DECLARE(img_benchmark_cogwheel_argb);
+    LV_IMG_DECLARE(img_benchmark_cogwheel_argb)
 #endif
-LV_IMG_DECLARE(img_benchmark_cogwheel_rgb);
-LV_IMG_DECLARE(img_benchmark_cogwheel_chroma_keyed);
-LV_IMG_DECLARE(img_benchmark_cogwheel_indexed16);
-LV_IMG_DECLARE(img_benchmark_cogwheel_alpha16);
+LV_IMG_DECLARE(img_benchmark_cogwheel_rgb)
+LV_IMG_DECLARE(img_benchmark_cogwheel_chroma_keyed)
+LV_IMG_DECLARE(img_benchmark_cogwheel_indexed16)
+LV_IMG_DECLARE(img_benchmark_cogwheel_alpha16)
 
-LV_FONT_DECLARE(lv_font_benchmark_montserrat_12_compr_az);
-LV_FONT_DECLARE(lv_font_benchmark_montserrat_16_compr_az);
-LV_FONT_DECLARE(lv_font_benchmark_montserrat_28_compr_az);
+LV_FONT_DECLARE(lv_font_benchmark_montserrat_12_compr_az)
+LV_FONT_DECLARE(lv_font_benchmark_montserrat_16_compr_az)
+LV_FONT_DECLARE(lv_font_benchmark_montserrat_28_compr_az)
 
 static void monitor_cb(lv_disp_drv_t * drv, uint32_t time, uint32_t px);
 static void next_scene_timer_cb(lv_timer_t * timer);
@@ -718,7 +718,7 @@ void lv_demo_benchmark_run_scene(int_fast16_t scene_no)
 {
     benchmark_init();
 
-    if(((scene_no >> 1) >= dimof(scenes))) {
+    if(scene_no < 0 || (size_t)(scene_no >> 1) >= dimof(scenes)) {
         /* invalid scene number */
         return ;
     }
@@ -944,6 +944,8 @@ static void generate_report(void)
 
 static void report_cb(lv_timer_t * timer)
 {
+    LV_UNUSED(timer);
+
     if(NULL != benchmark_finished_cb) {
         (*benchmark_finished_cb)();
     }
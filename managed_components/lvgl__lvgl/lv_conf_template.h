@@ -59,6 +59,11 @@
         #undef LV_MEM_POOL_ALLOC
     #endif
 
+    /*Memory reserved from `LV_MEM_SIZE` for slab pools which serve the small (<= 128 bytes) allocations in bytes (0: disable).
+     *Allocating from them is faster and the many small, short lived objects don't fragment the heap.
+     *The memory is reserved even if the blocks are not used, so enable it only if it helps, e.g. 8 * 1024 on a 64 kB heap*/
+    #define LV_MEM_SLAB_SIZE 0
+
 #else       /*LV_MEM_CUSTOM*/
     #define LV_MEM_CUSTOM_INCLUDE <stdlib.h>   /*Header for the dynamic memory function*/
     #define LV_MEM_CUSTOM_ALLOC   malloc
@@ -113,14 +118,21 @@
 
     /*Allow buffering some shadow calculation.
     *LV_SHADOW_CACHE_SIZE is the max. shadow size to buffer, where shadow size is `shadow_width + radius`
-    *Caching has LV_SHADOW_CACHE_SIZE^2 RAM cost*/
+    *The cached corners use at most LV_SHADOW_CACHE_SIZE^2 bytes of the heap by default*/
     #define LV_SHADOW_CACHE_SIZE 0
 
+    /*Number of shadow corners to cache. The least recently used one is dropped first*/
+    #define LV_SHADOW_CACHE_CNT 4
+
     /* Set number of maximally cached circle data.
     * The circumference of 1/4 circle are saved for anti-aliasing
     * radius * 4 bytes are used per circle (the most often used radiuses are saved)
     * 0: to disable caching */
     #define LV_CIRCLE_CACHE_SIZE 4
+
+    /*Bytes of circle data to keep between refreshes (the most used circles are kept)
+     *0: free them after every refresh*/
+    #define LV_CIRCLE_CACHE_BUDGET 4096
 #endif /*LV_DRAW_COMPLEX*/
 
 /**
@@ -139,6 +151,11 @@
 #define LV_LAYER_SIMPLE_BUF_SIZE          (24 * 1024)
 #define LV_LAYER_SIMPLE_FALLBACK_BUF_SIZE (3 * 1024)
 
+/*1: Cache the rendering of the objects with `LV_OBJ_FLAG_STATIC_LAYER`.
+ *They are rendered once with their children into a buffer of their size (from LVGL's heap)
+ *and only this buffer is copied until the object or its children change.*/
+#define LV_USE_STATIC_LAYER 0
+
 /*Default image cache size. Image caching keeps the images opened.
  *If only the built-in image formats are used there is no real advantage of caching. (I.e. if no new image decoder is added)
  *With complex image decoders (e.g. PNG or JPG) caching can save the continuous open/decode of images.
@@ -146,6 +163,11 @@
  *0: to disable caching*/
 #define LV_IMG_CACHE_DEF_SIZE 0
 
+/*Max. number of bytes the decoded images can use in the image cache.
+ *If it's exceeded the images which were used long ago and are fast to open are closed first.
+ *0: no limit, only the number of entries matters*/
+#define LV_IMG_CACHE_DEF_BUDGET 0
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #define LV_GRADIENT_MAX_STOPS 2
@@ -172,6 +194,10 @@
  *Only used if software rotation is enabled in the display driver.*/
 #define LV_DISP_ROT_MAX_BUF (10*1024)
 
+/*Use SIMD (SSE2 or NEON) kernels for the most common RGB565 blend operations if the compiler targets such a CPU.
+ *The plain C kernels are used otherwise. Both give the same result as `lv_color_mix()`*/
+#define LV_USE_DRAW_SW_SIMD 1
+
 /*-------------
  * GPU
  *-----------*/
@@ -419,6 +445,10 @@
 /*Enable drawing placeholders when glyph dsc is not found*/
 #define LV_USE_FONT_PLACEHOLDER 1
 
+/*Look up the ASCII and Latin-1 letters (0..255) in a table built on first use to measure and draw texts faster.
+ *Needs 512 bytes per built-in font and about 3 kB per Tiny TTF font.*/
+#define LV_USE_FONT_LATIN1_CACHE 0
+
 /*=================
  *  TEXT SETTINGS
  *=================*/
@@ -491,6 +521,7 @@
 #if LV_USE_LABEL
     #define LV_LABEL_TEXT_SELECTION 1 /*Enable selecting text of the label*/
     #define LV_LABEL_LONG_TXT_HINT 1  /*Store some extra info in labels to speed up drawing of very long texts*/
+    #define LV_LABEL_LINE_CACHE 0     /*Store the start and width of the lines of labels to not break the text on every draw*/
 #endif
 
 #define LV_USE_LINE       1
@@ -713,11 +744,22 @@
 /*1: Enable lv_obj fragment*/
 #define LV_USE_FRAGMENT 0
 
+/*1: Enable a pool which keeps built screens to switch between them without deleting and recreating them*/
+#define LV_USE_SCR_POOL 0
+
 /*1: Support using images as font in label or span widgets */
 #define LV_USE_IMGFONT 0
 
 /*1: Enable a published subscriber based messaging system */
 #define LV_USE_MSG 0
+#if LV_USE_MSG
+    /*Number of different message IDs which can be posted from other threads or interrupts with `lv_msg_post()`.
+     *Requires C11 atomics. 0: disable `lv_msg_post()`*/
+    #define LV_MSG_POST_SLOT_CNT 16
+
+    /*Max. size of the payload of a posted message in bytes*/
+    #define LV_MSG_POST_PAYLOAD_SIZE 16
+#endif
 
 /*1: Enable Pinyin input method*/
 /*Requires: lv_keyboard*/
@@ -277,6 +277,10 @@ void lv_obj_clear_flag(lv_obj_t * obj, lv_obj_flag_t f)
 
     obj->flags &= (~f);
 
+#if LV_USE_STATIC_LAYER
+    if(f & LV_OBJ_FLAG_STATIC_LAYER) _lv_refr_static_layer_free(obj);
+#endif
+
     if(f & LV_OBJ_FLAG_HIDDEN) {
         lv_obj_invalidate(obj);
         if(lv_obj_is_layout_positioned(obj)) {
@@ -470,6 +474,9 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
             lv_mem_free(obj->spec_attr->children);
             obj->spec_attr->children = NULL;
         }
+#if LV_USE_STATIC_LAYER
+        _lv_refr_static_layer_free(obj);
+#endif
         if(obj->spec_attr->event_dsc) {
             lv_mem_free(obj->spec_attr->event_dsc);
             obj->spec_attr->event_dsc = NULL;
@@ -858,7 +865,13 @@ static void lv_obj_event(const lv_obj_class_t * class_p, lv_event_t * e)
         lv_coord_t align = lv_obj_get_style_align(obj, LV_PART_MAIN);
         uint16_t layout = lv_obj_get_style_layout(obj, LV_PART_MAIN);
         if(layout || align || w == LV_SIZE_CONTENT || h == LV_SIZE_CONTENT) {
+            /*If only the size of a child changed and it doesn't change the size of this object
+             *the layout can keep its cached data and update only the changed child*/
+            bool cache_inv = obj->layout_cache_inv;
             lv_obj_mark_layout_as_dirty(obj);
+            if(lv_event_get_param(e) && w != LV_SIZE_CONTENT && h != LV_SIZE_CONTENT) {
+                obj->layout_cache_inv = cache_inv;
+            }
         }
     }
     else if(code == LV_EVENT_CHILD_DELETED) {
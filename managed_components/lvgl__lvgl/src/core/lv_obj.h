@@ -108,6 +108,7 @@ enum {
     LV_OBJ_FLAG_IGNORE_LAYOUT   = (1L << 17), /**< Make the object position-able by the layouts*/
     LV_OBJ_FLAG_FLOATING        = (1L << 18), /**< Do not scroll the object when the parent scrolls and ignore layout*/
     LV_OBJ_FLAG_OVERFLOW_VISIBLE = (1L << 19), /**< Do not clip the children's content to the parent's boundary*/
+    LV_OBJ_FLAG_STATIC_LAYER    = (1L << 20), /**< Cache the rendering of the object and its children (needs `LV_USE_STATIC_LAYER`)*/
 
     LV_OBJ_FLAG_LAYOUT_1        = (1L << 23), /**< Custom flag, free to use by layouts*/
     LV_OBJ_FLAG_LAYOUT_2        = (1L << 24), /**< Custom flag, free to use by layouts*/
@@ -168,6 +169,10 @@ typedef struct {
     lv_dir_t scroll_dir : 4;                /**< The allowed scroll direction(s)*/
     uint8_t event_dsc_cnt : 6;              /**< Number of event callbacks stored in `event_dsc` array*/
     uint8_t layer_type : 2;    /**< Cache the layer type here. Element of @lv_intermediate_layer_type_t */
+
+#if LV_USE_STATIC_LAYER
+    struct _lv_static_layer_t * static_layer;   /**< The cached rendering with `LV_OBJ_FLAG_STATIC_LAYER`*/
+#endif
 } _lv_obj_spec_attr_t;
 
 typedef struct _lv_obj_t {
@@ -189,6 +194,7 @@ typedef struct _lv_obj_t {
     uint16_t h_layout   : 1;
     uint16_t w_layout   : 1;
     uint16_t being_deleted   : 1;
+    uint16_t layout_cache_inv : 1;  /**< The layout can't reuse its cached data, e.g. not only the size of a child changed*/
 } lv_obj_t;
 
 /**********************
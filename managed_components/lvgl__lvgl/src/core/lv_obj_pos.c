@@ -288,6 +288,7 @@ bool lv_obj_is_layout_positioned(const lv_obj_t * obj)
 void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 {
     obj->layout_inv = 1;
+    obj->layout_cache_inv = 1;
 
     /*Mark the screen as dirty too to mark that there is something to do on this screen*/
     lv_obj_t * scr = lv_obj_get_screen(obj);
@@ -835,6 +836,11 @@ void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+#if LV_USE_STATIC_LAYER
+    /*Even if it's not visible now, the cached rendering of the static parents is outdated*/
+    _lv_refr_static_layer_invalidate(obj);
+#endif
+
     lv_disp_t * disp   = lv_obj_get_disp(obj);
     if(!lv_disp_is_invalidation_enabled(disp)) return;
 
@@ -1132,8 +1138,11 @@ static void layout_update_core(lv_obj_t * obj)
 
     if(obj->layout_inv) {
         obj->layout_inv = 0;
-        lv_obj_refr_size(obj);
-        lv_obj_refr_pos(obj);
+        /*If only the size of some children changed the size and position of the object remain the same*/
+        if(obj->layout_cache_inv) {
+            lv_obj_refr_size(obj);
+            lv_obj_refr_pos(obj);
+        }
 
         if(child_cnt > 0) {
             uint32_t layout_id = lv_obj_get_style_layout(obj, LV_PART_MAIN);
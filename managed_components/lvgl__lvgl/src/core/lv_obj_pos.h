@@ -142,6 +142,7 @@ bool lv_obj_is_layout_positioned(const struct _lv_obj_t * obj);
 
 /**
  * Mark the object for layout update.
+ * The layout will recalculate everything, its cached data (if any) is invalidated.
  * @param obj      pointer to an object whose children needs to be updated
  */
 void lv_obj_mark_layout_as_dirty(struct _lv_obj_t * obj);
@@ -48,6 +48,16 @@ typedef struct {
 #endif
 } mem_monitor_t;
 
+#if LV_USE_STATIC_LAYER
+typedef struct _lv_static_layer_t {
+    lv_color_t * buf;           /*The rendering of the object and its children*/
+    lv_area_t area;             /*The area of `buf` on the display*/
+    lv_area_t obj_coords;       /*The coordinates of the object when it was rendered*/
+    uint8_t valid : 1;          /*0: the object or a child has changed since then*/
+    uint8_t alloc_failed : 1;   /*`buf` couldn't be allocated for `area`, don't try again until it changes*/
+} lv_static_layer_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -59,6 +69,10 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj);
 static void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
+#if LV_USE_STATIC_LAYER
+    static lv_res_t refr_static_layer(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
+    static lv_static_layer_t * static_layer_render(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj, const lv_area_t * layer_area);
+#endif
 static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h);
 static void draw_buf_flush(lv_disp_t * disp);
 static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
@@ -279,6 +293,25 @@ void _lv_refr_set_disp_refreshing(lv_disp_t * disp)
     disp_refr = disp;
 }
 
+#if LV_USE_STATIC_LAYER
+void _lv_refr_static_layer_invalidate(const lv_obj_t * obj)
+{
+    while(obj) {
+        if(obj->spec_attr && obj->spec_attr->static_layer) obj->spec_attr->static_layer->valid = 0;
+        obj = obj->parent;
+    }
+}
+
+void _lv_refr_static_layer_free(lv_obj_t * obj)
+{
+    if(obj->spec_attr == NULL || obj->spec_attr->static_layer == NULL) return;
+
+    lv_mem_free(obj->spec_attr->static_layer->buf);
+    lv_mem_free(obj->spec_attr->static_layer);
+    obj->spec_attr->static_layer = NULL;
+}
+#endif
+
 /**
  * Called periodically to handle the refreshing
  * @param tmr pointer to the timer itself
@@ -817,6 +850,11 @@ static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj)
     lv_event_send(obj, LV_EVENT_COVER_CHECK, &info);
     if(info.res == LV_COVER_RES_MASKED) return NULL;
 
+#if LV_USE_STATIC_LAYER
+    /*Start from the static object to copy its cached rendering instead of drawing a child directly*/
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_STATIC_LAYER)) return info.res == LV_COVER_RES_COVER ? obj : NULL;
+#endif
+
     int32_t i;
     int32_t child_cnt = lv_obj_get_child_cnt(obj);
     for(i = child_cnt - 1; i >= 0; i--) {
@@ -967,6 +1005,9 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
     lv_layer_type_t layer_type = _lv_obj_get_layer_type(obj);
     if(layer_type == LV_LAYER_TYPE_NONE) {
+#if LV_USE_STATIC_LAYER
+        if(lv_obj_has_flag(obj, LV_OBJ_FLAG_STATIC_LAYER) && refr_static_layer(draw_ctx, obj) == LV_RES_OK) return;
+#endif
         lv_obj_redraw(draw_ctx, obj);
     }
     else {
@@ -1046,6 +1087,117 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
     }
 }
 
+#if LV_USE_STATIC_LAYER
+/**
+ * Copy the cached rendering of a static object to the draw buffer. Render it first if it's outdated.
+ * @param draw_ctx  pointer to the current draw context
+ * @param obj       pointer to an object with `LV_OBJ_FLAG_STATIC_LAYER`
+ * @return          LV_RES_INV: the object can't be cached and it should be drawn normally
+ */
+static lv_res_t refr_static_layer(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
+{
+    /*The buffer has no alpha channel, so only the objects which are opaque on their whole area can be cached.
+     *The masks of the parents (e.g. rounded corners) would also be baked into the buffer.*/
+    if(draw_ctx->buffer_copy == NULL) return LV_RES_INV;
+    if(disp_refr->driver->set_px_cb || disp_refr->driver->screen_transp) return LV_RES_INV;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return LV_RES_INV;
+    if(_lv_obj_get_ext_draw_size(obj) > 0) return LV_RES_INV;
+    if(lv_draw_mask_is_any(&obj->coords)) return LV_RES_INV;
+
+    lv_area_t clip_area;
+    if(!_lv_area_intersect(&clip_area, draw_ctx->clip_area, &obj->coords)) return LV_RES_OK;
+
+    lv_cover_check_info_t info;
+    info.res = LV_COVER_RES_COVER;
+    info.area = &obj->coords;
+    lv_event_send(obj, LV_EVENT_COVER_CHECK, &info);
+    if(info.res != LV_COVER_RES_COVER) return LV_RES_INV;
+
+    /*Cache only the part of the object which is on its display (`disp_refr` might be a snapshot)*/
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    lv_area_t disp_area;
+    lv_area_t layer_area;
+    lv_area_set(&disp_area, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
+    if(!_lv_area_intersect(&layer_area, &obj->coords, &disp_area)) return LV_RES_OK;
+
+    lv_static_layer_t * layer = obj->spec_attr ? obj->spec_attr->static_layer : NULL;
+    if(layer == NULL || !layer->valid || !_lv_area_is_equal(&layer->area, &layer_area) ||
+       !_lv_area_is_equal(&layer->obj_coords, &obj->coords)) {
+        layer = static_layer_render(draw_ctx, obj, &layer_area);
+        if(layer == NULL) return LV_RES_INV;
+    }
+
+    /*Everything drawn before is covered by the object, so it's only a copy*/
+    lv_area_t dest_area = clip_area;
+    lv_area_move(&dest_area, -draw_ctx->buf_area->x1, -draw_ctx->buf_area->y1);
+    lv_area_t src_area = clip_area;
+    lv_area_move(&src_area, -layer->area.x1, -layer->area.y1);
+
+    lv_draw_wait_for_finish(draw_ctx);
+    draw_ctx->buffer_copy(draw_ctx, draw_ctx->buf, lv_area_get_width(draw_ctx->buf_area), &dest_area,
+                          layer->buf, lv_area_get_width(&layer->area), &src_area);
+
+    return LV_RES_OK;
+}
+
+/**
+ * Render a static object and its children into its cache buffer
+ * @param draw_ctx      pointer to the current draw context
+ * @param obj           pointer to an object with `LV_OBJ_FLAG_STATIC_LAYER`
+ * @param layer_area    the area to render, the visible part of the object
+ * @return              pointer to the static layer, or NULL if the buffer couldn't be allocated
+ */
+static lv_static_layer_t * static_layer_render(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj, const lv_area_t * layer_area)
+{
+    lv_obj_allocate_spec_attr(obj);
+    if(obj->spec_attr == NULL) return NULL;
+
+    lv_static_layer_t * layer = obj->spec_attr->static_layer;
+    if(layer == NULL) {
+        layer = lv_mem_alloc(sizeof(lv_static_layer_t));
+        LV_ASSERT_MALLOC(layer);
+        if(layer == NULL) return NULL;
+        lv_memset_00(layer, sizeof(lv_static_layer_t));
+        obj->spec_attr->static_layer = layer;
+    }
+
+    if(layer->buf == NULL || lv_area_get_size(&layer->area) != lv_area_get_size(layer_area)) {
+        if(layer->alloc_failed && _lv_area_is_equal(&layer->area, layer_area)) return NULL;
+
+        lv_mem_free(layer->buf);
+        layer->buf = lv_mem_alloc(lv_area_get_size(layer_area) * sizeof(lv_color_t));
+        layer->area = *layer_area;
+        layer->alloc_failed = layer->buf == NULL;
+        if(layer->buf == NULL) {
+            LV_LOG_WARN("Couldn't allocate the buffer of a static layer, drawing the object directly");
+            return NULL;
+        }
+    }
+
+    lv_draw_wait_for_finish(draw_ctx);
+    void * buf_ori = draw_ctx->buf;
+    lv_area_t * buf_area_ori = draw_ctx->buf_area;
+    const lv_area_t * clip_area_ori = draw_ctx->clip_area;
+
+    layer->area = *layer_area;
+    draw_ctx->buf = layer->buf;
+    draw_ctx->buf_area = &layer->area;
+    draw_ctx->clip_area = &layer->area;
+
+    lv_obj_redraw(draw_ctx, obj);
+    lv_draw_wait_for_finish(draw_ctx);
+
+    draw_ctx->buf = buf_ori;
+    draw_ctx->buf_area = buf_area_ori;
+    draw_ctx->clip_area = clip_area_ori;
+
+    layer->obj_coords = obj->coords;
+    layer->valid = 1;
+
+    return layer;
+}
+#endif
+
 static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h)
 {
     int32_t max_row = (uint32_t)disp->driver->draw_buf->size / area_w;
@@ -85,6 +85,21 @@ lv_disp_t * _lv_refr_get_disp_refreshing(void);
  */
 void _lv_refr_set_disp_refreshing(lv_disp_t * disp);
 
+#if LV_USE_STATIC_LAYER
+/**
+ * Mark the cached rendering of `obj` and its parents with `LV_OBJ_FLAG_STATIC_LAYER` as outdated.
+ * Called by `lv_obj_invalidate_area()`, it shouldn't be used directly by the user.
+ * @param obj pointer to an object which has changed
+ */
+void _lv_refr_static_layer_invalidate(const lv_obj_t * obj);
+
+/**
+ * Free the cached rendering of an object with `LV_OBJ_FLAG_STATIC_LAYER`.
+ * @param obj pointer to an object
+ */
+void _lv_refr_static_layer_free(lv_obj_t * obj);
+#endif
+
 #if LV_USE_PERF_MONITOR
 /**
  * Reset FPS counter
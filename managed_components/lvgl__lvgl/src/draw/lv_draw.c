@@ -39,7 +39,7 @@
 
 void lv_draw_init(void)
 {
-    /*Nothing to init now*/
+    _lv_draw_sw_blend_kernel_init();
 }
 
 void lv_draw_wait_for_finish(lv_draw_ctx_t * draw_ctx)
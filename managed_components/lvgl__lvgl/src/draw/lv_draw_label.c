@@ -35,6 +35,10 @@ typedef uint8_t cmd_state_t;
  **********************/
 
 static uint8_t hex_char_to_num(char hex);
+static uint32_t get_line_end(const lv_draw_label_dsc_t * dsc, const char * txt, uint32_t line_id, uint32_t line_start,
+                             lv_coord_t max_w);
+static lv_coord_t get_line_width(const lv_draw_label_dsc_t * dsc, const char * txt, uint32_t line_id,
+                                 uint32_t line_start, uint32_t line_end);
 
 /**********************
  *  STATIC VARIABLES
@@ -110,6 +114,12 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
         /*Normally use the label's width as width*/
         w = lv_area_get_width(coords);
     }
+    else if(dsc->lines) {
+        /*The width of the longest line*/
+        uint32_t l;
+        w = 0;
+        for(l = 0; l < dsc->line_cnt; l++) w = LV_MAX(w, dsc->lines[l].width);
+    }
     else {
         /*If EXPAND is enabled then not limit the text's width to the object's width*/
         lv_point_t p;
@@ -134,8 +144,12 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
     pos.y += y_ofs;
 
     uint32_t line_start     = 0;
+    uint32_t line_id        = 0;
     int32_t last_line_start = -1;
 
+    /*The lines are known, no need for the hint*/
+    if(dsc->lines) hint = NULL;
+
     /*Check the hint to use the cached info*/
     if(hint && y_ofs == 0 && coords->y1 < 0) {
         /*If the label changed too much recalculate the hint.*/
@@ -151,13 +165,14 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
         pos.y += hint->y;
     }
 
-    uint32_t line_end = line_start + _lv_txt_get_next_line(&txt[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+    uint32_t line_end = get_line_end(dsc, txt, line_id, line_start, w);
 
     /*Go the first visible line*/
     while(pos.y + line_height_font < draw_ctx->clip_area->y1) {
         /*Go to next line*/
         line_start = line_end;
-        line_end += _lv_txt_get_next_line(&txt[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_id++;
+        line_end = get_line_end(dsc, txt, line_id, line_start, w);
         pos.y += line_height;
 
         /*Save at the threshold coordinate*/
@@ -172,14 +187,14 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
 
     /*Align to middle*/
     if(align == LV_TEXT_ALIGN_CENTER) {
-        line_width = lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+        line_width = get_line_width(dsc, txt, line_id, line_start, line_end);
 
         pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
     }
     /*Align to the right*/
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        line_width = lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+        line_width = get_line_width(dsc, txt, line_id, line_start, line_end);
         pos.x += lv_area_get_width(coords) - line_width;
     }
     uint32_t sel_start = dsc->sel_start;
@@ -334,21 +349,20 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
 #endif
         /*Go to next line*/
         line_start = line_end;
-        line_end += _lv_txt_get_next_line(&txt[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_id++;
+        line_end = get_line_end(dsc, txt, line_id, line_start, w);
 
         pos.x = coords->x1;
         /*Align to middle*/
         if(align == LV_TEXT_ALIGN_CENTER) {
-            line_width =
-                lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+            line_width = get_line_width(dsc, txt, line_id, line_start, line_end);
 
             pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
         }
         /*Align to the right*/
         else if(align == LV_TEXT_ALIGN_RIGHT) {
-            line_width =
-                lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+            line_width = get_line_width(dsc, txt, line_id, line_start, line_end);
             pos.x += lv_area_get_width(coords) - line_width;
         }
 
@@ -413,3 +427,37 @@ static uint8_t hex_char_to_num(char hex)
 
     return result;
 }
+
+/**
+ * Get the end of a line from the lines of the descriptor or by breaking the text
+ * @param dsc           pointer to draw descriptor
+ * @param txt           the text
+ * @param line_id       index of the line
+ * @param line_start    start of the line in `txt`
+ * @param max_w         max width of the lines
+ * @return              the end of the line (the start of the next line)
+ */
+static uint32_t get_line_end(const lv_draw_label_dsc_t * dsc, const char * txt, uint32_t line_id, uint32_t line_start,
+                             lv_coord_t max_w)
+{
+    if(dsc->lines) return line_id < dsc->line_cnt ? dsc->lines[line_id + 1].start : line_start;
+
+    return line_start + _lv_txt_get_next_line(&txt[line_start], dsc->font, dsc->letter_space, max_w, NULL, dsc->flag);
+}
+
+/**
+ * Get the width of a line from the lines of the descriptor or by measuring it
+ * @param dsc           pointer to draw descriptor
+ * @param txt           the text
+ * @param line_id       index of the line
+ * @param line_start    start of the line in `txt`
+ * @param line_end      end of the line in `txt`
+ * @return              width of the line
+ */
+static lv_coord_t get_line_width(const lv_draw_label_dsc_t * dsc, const char * txt, uint32_t line_id,
+                                 uint32_t line_start, uint32_t line_end)
+{
+    if(dsc->lines) return line_id < dsc->line_cnt ? dsc->lines[line_id].width : 0;
+
+    return lv_txt_get_width(&txt[line_start], line_end - line_start, dsc->font, dsc->letter_space, dsc->flag);
+}
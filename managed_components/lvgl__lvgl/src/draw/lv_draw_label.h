@@ -27,6 +27,12 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/** Start index and width of a line of a text which is already broken into lines*/
+typedef struct {
+    uint32_t start;
+    lv_coord_t width;
+} lv_draw_label_line_t;
+
 typedef struct {
     const lv_font_t * font;
     uint32_t sel_start;
@@ -44,6 +50,10 @@ typedef struct {
     lv_text_flag_t flag;
     lv_text_decor_t decor : 3;
     lv_blend_mode_t blend_mode: 3;
+    /** If not NULL, the lines of the text for this font, letter space, flags and the width of the coordinates.
+     * It has `line_cnt + 1` items, the `start` of the last one is the length of the text.*/
+    const lv_draw_label_line_t * lines;
+    uint32_t line_cnt;
 } lv_draw_label_dsc_t;
 
 /** Store some info to speed up drawing of very large texts
@@ -59,10 +59,15 @@ static void circ_calc_aa4(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t radi
 static lv_opa_t * get_next_line(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t y, lv_coord_t * len,
                                 lv_coord_t * x_start);
 static inline lv_opa_t /* LV_ATTRIBUTE_FAST_MEM */ mask_mix(lv_opa_t mask_act, lv_opa_t mask_new);
+static uint32_t circle_cache_get_used_size(void);
+static void circle_cache_trim(uint32_t size);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+static uint32_t circle_cache_budget = LV_CIRCLE_CACHE_BUDGET;
+static uint32_t circle_cache_hit_cnt;
+static uint32_t circle_cache_miss_cnt;
 
 /**********************
  *      MACROS
@@ -231,12 +236,36 @@ void lv_draw_mask_free_param(void * p)
 
 void _lv_draw_mask_cleanup(void)
 {
+    /*The masks of the refresh are removed, so no circle is used now.
+     *Halve the life of the entries to let the circles which are not drawn anymore age out.*/
     uint8_t i;
     for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
-        if(LV_GC_ROOT(_lv_circle_cache[i]).buf) {
-            lv_mem_free(LV_GC_ROOT(_lv_circle_cache[i]).buf);
-        }
-        lv_memset_00(&LV_GC_ROOT(_lv_circle_cache[i]), sizeof(LV_GC_ROOT(_lv_circle_cache[i])));
+        LV_GC_ROOT(_lv_circle_cache[i]).used_cnt = 0;
+        LV_GC_ROOT(_lv_circle_cache[i]).life /= 2;
+    }
+
+    /*Keep the most used circles for the next refreshes*/
+    circle_cache_trim(circle_cache_budget);
+}
+
+void lv_draw_mask_circle_cache_set_budget(uint32_t size)
+{
+    circle_cache_budget = size;
+    circle_cache_trim(size);
+}
+
+void lv_draw_mask_circle_cache_get_info(lv_draw_mask_circle_cache_info_t * info)
+{
+    lv_memset_00(info, sizeof(lv_draw_mask_circle_cache_info_t));
+    info->hit_cnt = circle_cache_hit_cnt;
+    info->miss_cnt = circle_cache_miss_cnt;
+    info->used_size = circle_cache_get_used_size();
+    info->total_size = circle_cache_budget;
+    info->entry_cnt = LV_CIRCLE_CACHE_SIZE;
+
+    uint32_t i;
+    for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
+        if(LV_GC_ROOT(_lv_circle_cache[i]).buf) info->used_entry_cnt++;
     }
 }
 
@@ -499,10 +528,13 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
             LV_GC_ROOT(_lv_circle_cache[i]).used_cnt++;
             CIRCLE_CACHE_AGING(LV_GC_ROOT(_lv_circle_cache[i]).life, radius);
             param->circle = &LV_GC_ROOT(_lv_circle_cache[i]);
+            circle_cache_hit_cnt++;
             return;
         }
     }
 
+    circle_cache_miss_cnt++;
+
     /*If not found find a free entry with lowest life*/
     _lv_draw_mask_radius_circle_dsc_t * entry = NULL;
     for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
@@ -1359,6 +1391,37 @@ static void circ_next(lv_point_t * c, lv_coord_t * tmp)
     c->y++;
 }
 
+static uint32_t circle_cache_get_used_size(void)
+{
+    uint32_t used_size = 0;
+    uint32_t i;
+    for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
+        if(LV_GC_ROOT(_lv_circle_cache[i]).buf) used_size += LV_GC_ROOT(_lv_circle_cache[i]).radius * 6 + 6;
+    }
+
+    return used_size;
+}
+
+/**
+ * Free the least used, not referenced circles until the cache uses at most `size` bytes
+ */
+static void circle_cache_trim(uint32_t size)
+{
+    while(circle_cache_get_used_size() > size) {
+        _lv_draw_mask_radius_circle_dsc_t * entry = NULL;
+        uint32_t i;
+        for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
+            _lv_draw_mask_radius_circle_dsc_t * e = &LV_GC_ROOT(_lv_circle_cache[i]);
+            if(e->buf == NULL || e->used_cnt) continue;
+            if(entry == NULL || e->life < entry->life) entry = e;
+        }
+        if(entry == NULL) return;
+
+        lv_mem_free(entry->buf);
+        lv_memset_00(entry, sizeof(_lv_draw_mask_radius_circle_dsc_t));
+    }
+}
+
 static void circ_calc_aa4(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t radius)
 {
     if(radius == 0) return;
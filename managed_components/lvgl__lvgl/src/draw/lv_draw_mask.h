@@ -162,6 +162,18 @@ typedef struct  {
 
 typedef _lv_draw_mask_radius_circle_dsc_t _lv_draw_mask_radius_circle_dsc_arr_t[LV_CIRCLE_CACHE_SIZE];
 
+/**
+ * Statistics of the circle cache of the radius masks.
+ */
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of radius masks which used a cached circle*/
+    uint32_t miss_cnt;      /**< Number of radius masks whose circle was calculated*/
+    uint32_t used_size;     /**< Bytes used by the cached circles*/
+    uint32_t total_size;    /**< Max. bytes the circles can keep between refreshes*/
+    uint16_t entry_cnt;     /**< Number of cache entries*/
+    uint16_t used_entry_cnt;/**< Number of entries with a circle*/
+} lv_draw_mask_circle_cache_info_t;
+
 typedef struct {
     /*The first element must be the common descriptor*/
     _lv_draw_mask_common_dsc_t dsc;
@@ -288,6 +300,20 @@ void lv_draw_mask_free_param(void * p);
  */
 void _lv_draw_mask_cleanup(void);
 
+/**
+ * Limit the memory the cached circles can keep between refreshes.
+ * The least used circles are freed right away and at the end of every refresh to keep the limit.
+ * The circles used by a refresh in progress are kept until its end.
+ * @param size      max. number of bytes. 0: free the circles after every refresh. The default is `LV_CIRCLE_CACHE_BUDGET`
+ */
+void lv_draw_mask_circle_cache_set_budget(uint32_t size);
+
+/**
+ * Get the statistics of the circle cache.
+ * @param info      store the result here
+ */
+void lv_draw_mask_circle_cache_get_info(lv_draw_mask_circle_cache_info_t * info);
+
 //! @cond Doxygen_Suppress
 
 /**
@@ -16,16 +16,16 @@
 /*********************
  *      DEFINES
  *********************/
-/*Decrement life with this value on every open*/
-#define LV_IMG_CACHE_AGING 1
-
 /*Boost life by this factor (multiply time_to_open with this value)*/
 #define LV_IMG_CACHE_LIFE_GAIN 1
 
-/*Don't let life to be greater than this limit because it would require a lot of time to
- * "die" from very high values*/
+/*Don't let life to be greater than the life of the last closed entry + this limit because it would require
+ *a lot of closed images to "die" from very high values*/
 #define LV_IMG_CACHE_LIFE_LIMIT 1000
 
+/*Marks the end of a hash bucket*/
+#define LV_IMG_CACHE_NONE 0xFFFF
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -35,6 +35,11 @@
  **********************/
 #if LV_IMG_CACHE_DEF_SIZE
     static bool lv_img_cache_match(const void * src1, const void * src2);
+    static uint32_t lv_img_cache_hash(const void * src, lv_color_t color, int32_t frame_id);
+    static _lv_img_cache_entry_t * get_free_entry(void);
+    static bool close_entry_with_least_life(const _lv_img_cache_entry_t * keep);
+    static void close_entry(_lv_img_cache_entry_t * entry);
+    static void set_life(_lv_img_cache_entry_t * entry);
 #endif
 
 /**********************
@@ -42,6 +47,13 @@
  **********************/
 #if LV_IMG_CACHE_DEF_SIZE
     static uint16_t entry_cnt;
+    static uint16_t bucket_mask;
+    static uint16_t * buckets;      /*Index of the first entry in each bucket. Allocated after the entries*/
+    static uint32_t life_base;      /*Life of the last closed entry*/
+    static uint32_t used_size;
+    static uint32_t budget = LV_IMG_CACHE_DEF_BUDGET;
+    static uint32_t hit_cnt;
+    static uint32_t miss_cnt;
 #endif
 
 /**********************
@@ -73,48 +85,25 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
 
     _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
 
-    /*Decrement all lifes. Make the entries older*/
+    uint32_t hash = lv_img_cache_hash(src, color, frame_id);
     uint16_t i;
-    for(i = 0; i < entry_cnt; i++) {
-        if(cache[i].life > INT32_MIN + LV_IMG_CACHE_AGING) {
-            cache[i].life -= LV_IMG_CACHE_AGING;
-        }
-    }
-
-    for(i = 0; i < entry_cnt; i++) {
-        if(color.full == cache[i].dec_dsc.color.full &&
+    for(i = buckets[hash & bucket_mask]; i != LV_IMG_CACHE_NONE; i = cache[i].hash_next) {
+        if(hash == cache[i].hash &&
+           color.full == cache[i].dec_dsc.color.full &&
            frame_id == cache[i].dec_dsc.frame_id &&
            lv_img_cache_match(src, cache[i].dec_dsc.src)) {
-            /*If opened increment its life.
-             *Image difficult to open should live longer to keep avoid frequent their recaching.
-             *Therefore increase `life` with `time_to_open`*/
+            /*Image difficult to open should live longer to keep avoid frequent their recaching.*/
             cached_src = &cache[i];
-            cached_src->life += cached_src->dec_dsc.time_to_open * LV_IMG_CACHE_LIFE_GAIN;
-            if(cached_src->life > LV_IMG_CACHE_LIFE_LIMIT) cached_src->life = LV_IMG_CACHE_LIFE_LIMIT;
+            set_life(cached_src);
+            hit_cnt++;
             LV_LOG_TRACE("image source found in the cache");
-            break;
+            return cached_src;
         }
     }
 
     /*The image is not cached then cache it now*/
-    if(cached_src) return cached_src;
-
-    /*Find an entry to reuse. Select the entry with the least life*/
-    cached_src = &cache[0];
-    for(i = 1; i < entry_cnt; i++) {
-        if(cache[i].life < cached_src->life) {
-            cached_src = &cache[i];
-        }
-    }
-
-    /*Close the decoder to reuse if it was opened (has a valid source)*/
-    if(cached_src->dec_dsc.src) {
-        lv_img_decoder_close(&cached_src->dec_dsc);
-        LV_LOG_INFO("image draw: cache miss, close and reuse an entry");
-    }
-    else {
-        LV_LOG_INFO("image draw: cache miss, cached to an empty entry");
-    }
+    miss_cnt++;
+    cached_src = get_free_entry();
 #else
     cached_src = &LV_GC_ROOT(_lv_img_cache_single);
 #endif
@@ -124,12 +113,9 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
     if(open_res == LV_RES_INV) {
         LV_LOG_WARN("Image draw cannot open the image resource");
         lv_memset_00(cached_src, sizeof(_lv_img_cache_entry_t));
-        cached_src->life = INT32_MIN; /*Make the empty entry very "weak" to force its us*/
         return NULL;
     }
 
-    cached_src->life = 0;
-
     /*If `time_to_open` was not set in the open function set it here*/
     if(cached_src->dec_dsc.time_to_open == 0) {
         cached_src->dec_dsc.time_to_open = lv_tick_elaps(t_start);
@@ -137,6 +123,33 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
 
     if(cached_src->dec_dsc.time_to_open == 0) cached_src->dec_dsc.time_to_open = 1;
 
+#if LV_IMG_CACHE_DEF_SIZE
+    /*Add to the hash table*/
+    cached_src->hash = hash;
+    cached_src->hash_next = buckets[hash & bucket_mask];
+    buckets[hash & bucket_mask] = (uint16_t)(cached_src - cache);
+    set_life(cached_src);
+
+    /*Only the fully decoded images use memory in the cache.
+     *Variables which are used directly (e.g. true color images in flash) don't.*/
+    const lv_img_decoder_dsc_t * dec_dsc = &cached_src->dec_dsc;
+    bool in_place = dec_dsc->src_type == LV_IMG_SRC_VARIABLE &&
+                    dec_dsc->img_data == ((const lv_img_dsc_t *)dec_dsc->src)->data;
+    if(dec_dsc->img_data && !in_place) {
+        cached_src->size = lv_img_buf_get_img_size(dec_dsc->header.w, dec_dsc->header.h, dec_dsc->header.cf);
+    }
+    used_size += cached_src->size;
+
+    if(budget) {
+        while(used_size > budget) {
+            if(!close_entry_with_least_life(cached_src)) {
+                LV_LOG_WARN("lv_img_cache_open: the image is larger than the cache budget");
+                break;
+            }
+        }
+    }
+#endif
+
     return cached_src;
 }
 
@@ -158,17 +171,73 @@ void lv_img_cache_set_size(uint16_t new_entry_cnt)
         lv_mem_free(LV_GC_ROOT(_lv_img_cache_array));
     }
 
-    /*Reallocate the cache*/
-    LV_GC_ROOT(_lv_img_cache_array) = lv_mem_alloc(sizeof(_lv_img_cache_entry_t) * new_entry_cnt);
+    if(new_entry_cnt >= LV_IMG_CACHE_NONE) new_entry_cnt = LV_IMG_CACHE_NONE - 1;
+
+    /*Use a power of 2 buckets to get the bucket with a mask*/
+    uint32_t bucket_cnt = 1;
+    while(bucket_cnt < new_entry_cnt) bucket_cnt <<= 1;
+
+    /*Reallocate the cache. The buckets are stored after the entries*/
+    LV_GC_ROOT(_lv_img_cache_array) = lv_mem_alloc(sizeof(_lv_img_cache_entry_t) * new_entry_cnt +
+                                                   sizeof(uint16_t) * bucket_cnt);
     LV_ASSERT_MALLOC(LV_GC_ROOT(_lv_img_cache_array));
     if(LV_GC_ROOT(_lv_img_cache_array) == NULL) {
         entry_cnt = 0;
         return;
     }
     entry_cnt = new_entry_cnt;
+    bucket_mask = (uint16_t)(bucket_cnt - 1);
+    buckets = (uint16_t *)&LV_GC_ROOT(_lv_img_cache_array)[entry_cnt];
 
     /*Clean the cache*/
     lv_memset_00(LV_GC_ROOT(_lv_img_cache_array), entry_cnt * sizeof(_lv_img_cache_entry_t));
+    lv_memset_ff(buckets, bucket_cnt * sizeof(uint16_t));
+    used_size = 0;
+#endif
+}
+
+/**
+ * Limit the memory used by the decoded images in the cache.
+ * If the limit is reached the images are closed by the same rule as when the cache is full.
+ * An image larger than the limit is still cached alone.
+ * @param size      max. number of bytes the decoded images can use. 0: no limit
+ */
+void lv_img_cache_set_budget(uint32_t size)
+{
+#if LV_IMG_CACHE_DEF_SIZE == 0
+    LV_UNUSED(size);
+    LV_LOG_WARN("Can't change cache budget because it's disabled by LV_IMG_CACHE_DEF_SIZE = 0");
+#else
+    budget = size;
+    if(budget == 0) return;
+
+    while(used_size > budget) {
+        if(!close_entry_with_least_life(NULL)) break;
+    }
+#endif
+}
+
+/**
+ * Get the statistics of the image cache.
+ * @param info      store the result here
+ */
+void lv_img_cache_get_info(lv_img_cache_info_t * info)
+{
+    LV_ASSERT_NULL(info);
+    lv_memset_00(info, sizeof(lv_img_cache_info_t));
+
+#if LV_IMG_CACHE_DEF_SIZE
+    info->hit_cnt = hit_cnt;
+    info->miss_cnt = miss_cnt;
+    info->used_size = used_size;
+    info->total_size = budget;
+    info->entry_cnt = entry_cnt;
+
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    uint16_t i;
+    for(i = 0; i < entry_cnt; i++) {
+        if(cache[i].dec_dsc.src) info->used_entry_cnt++;
+    }
 #endif
 }
 
@@ -185,12 +254,9 @@ void lv_img_cache_invalidate_src(const void * src)
 
     uint16_t i;
     for(i = 0; i < entry_cnt; i++) {
+        if(cache[i].dec_dsc.src == NULL) continue;
         if(src == NULL || lv_img_cache_match(src, cache[i].dec_dsc.src)) {
-            if(cache[i].dec_dsc.src != NULL) {
-                lv_img_decoder_close(&cache[i].dec_dsc);
-            }
-
-            lv_memset_00(&cache[i], sizeof(_lv_img_cache_entry_t));
+            close_entry(&cache[i]);
         }
     }
 #endif
@@ -212,4 +278,107 @@ static bool lv_img_cache_match(const void * src1, const void * src2)
         return false;
     return strcmp(src1, src2) == 0;
 }
+
+static uint32_t lv_img_cache_hash(const void * src, lv_color_t color, int32_t frame_id)
+{
+    /*FNV-1a on the path or on the address of the variable*/
+    uint32_t hash = 2166136261u;
+    if(lv_img_src_get_type(src) == LV_IMG_SRC_FILE) {
+        const uint8_t * s = src;
+        while(*s) {
+            hash = (hash ^ *s) * 16777619u;
+            s++;
+        }
+    }
+    else {
+        uintptr_t p = (uintptr_t)src;
+        uint32_t i;
+        for(i = 0; i < sizeof(p); i++) {
+            hash = (hash ^ (uint8_t)p) * 16777619u;
+            p >>= 8;
+        }
+    }
+
+    hash = (hash ^ (uint32_t)color.full) * 16777619u;
+    hash = (hash ^ (uint32_t)frame_id) * 16777619u;
+
+    /*Mix the upper bits into the lower ones as the bucket is selected by the lower bits*/
+    return hash ^ (hash >> 16);
+}
+
+/**
+ * Get an empty entry or close the entry with the least life to get one.
+ * Called only on cache miss when opening the image is anyway slow.
+ * @return an empty entry
+ */
+static _lv_img_cache_entry_t * get_free_entry(void)
+{
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    uint16_t i;
+    for(i = 0; i < entry_cnt; i++) {
+        if(cache[i].dec_dsc.src == NULL) {
+            LV_LOG_INFO("image draw: cache miss, cached to an empty entry");
+            return &cache[i];
+        }
+    }
+
+    LV_LOG_INFO("image draw: cache miss, close and reuse an entry");
+    _lv_img_cache_entry_t * entry = &cache[0];
+    for(i = 1; i < entry_cnt; i++) {
+        if(cache[i].life < entry->life) entry = &cache[i];
+    }
+
+    life_base = entry->life;
+    close_entry(entry);
+    return entry;
+}
+
+/**
+ * Close the opened entry with the least life.
+ * @param keep      don't close this entry
+ * @return          true: an entry was closed; false: there was no entry to close
+ */
+static bool close_entry_with_least_life(const _lv_img_cache_entry_t * keep)
+{
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    _lv_img_cache_entry_t * entry = NULL;
+    uint16_t i;
+    for(i = 0; i < entry_cnt; i++) {
+        if(cache[i].dec_dsc.src == NULL || &cache[i] == keep) continue;
+        if(entry == NULL || cache[i].life < entry->life) entry = &cache[i];
+    }
+
+    if(entry == NULL) return false;
+
+    life_base = entry->life;
+    close_entry(entry);
+    return true;
+}
+
+static void close_entry(_lv_img_cache_entry_t * entry)
+{
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    uint16_t id = (uint16_t)(entry - cache);
+
+    /*Remove from the hash bucket*/
+    uint16_t * link = &buckets[entry->hash & bucket_mask];
+    while(*link != LV_IMG_CACHE_NONE) {
+        if(*link == id) {
+            *link = entry->hash_next;
+            break;
+        }
+        link = &cache[*link].hash_next;
+    }
+
+    lv_img_decoder_close(&entry->dec_dsc);
+    used_size -= entry->size;
+    lv_memset_00(entry, sizeof(_lv_img_cache_entry_t));
+}
+
+static void set_life(_lv_img_cache_entry_t * entry)
+{
+    uint32_t gain = entry->dec_dsc.time_to_open * LV_IMG_CACHE_LIFE_GAIN;
+    if(gain > LV_IMG_CACHE_LIFE_LIMIT) gain = LV_IMG_CACHE_LIFE_LIMIT;
+    entry->life = life_base + gain;
+}
 #endif
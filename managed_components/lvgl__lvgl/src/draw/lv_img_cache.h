@@ -31,12 +31,28 @@ extern "C" {
 typedef struct {
     lv_img_decoder_dsc_t dec_dsc; /**< Image information*/
 
-    /** Count the cache entries's life. Add `time_to_open` to `life` when the entry is used.
-     * Decrement all lifes by one every in every ::lv_img_cache_open.
-     * If life == 0 the entry can be reused*/
-    int32_t life;
+    /** The entry with the smallest life is closed first when space is required.
+     * When the entry is used its life is set to the life of the last closed entry + `time_to_open`,
+     * so images which are hard to open and recently used images live longer.*/
+    uint32_t life;
+
+    uint32_t hash;      /**< Hash of the source, color and frame_id*/
+    uint32_t size;      /**< Size of the decoded image in bytes. 0 if the decoder doesn't decode the whole image*/
+    uint16_t hash_next; /**< Index of the next entry with the same hash bucket*/
 } _lv_img_cache_entry_t;
 
+/**
+ * Statistics of the image cache.
+ */
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of images found in the cache*/
+    uint32_t miss_cnt;      /**< Number of images which needed to be opened*/
+    uint32_t used_size;     /**< Bytes used by the decoded images in the cache*/
+    uint32_t total_size;    /**< Max. bytes the decoded images can use (0: no limit)*/
+    uint16_t entry_cnt;     /**< Number of cache entries*/
+    uint16_t used_entry_cnt;/**< Number of entries with an opened image*/
+} lv_img_cache_info_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -60,6 +76,20 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
  */
 void lv_img_cache_set_size(uint16_t new_slot_num);
 
+/**
+ * Limit the memory used by the decoded images in the cache.
+ * If the limit is reached the images are closed by the same rule as when the cache is full.
+ * An image larger than the limit is still cached alone.
+ * @param size      max. number of bytes the decoded images can use. 0: no limit
+ */
+void lv_img_cache_set_budget(uint32_t size);
+
+/**
+ * Get the statistics of the image cache.
+ * @param info      store the result here
+ */
+void lv_img_cache_get_info(lv_img_cache_info_t * info);
+
 /**
  * Invalidate an image source in the cache.
  * Useful if the image source is updated therefore it needs to be cached again.
@@ -14,6 +14,7 @@ extern "C" {
  *      INCLUDES
  *********************/
 #include "lv_draw_sw_blend.h"
+#include "lv_draw_sw_blend_kernel.h"
 #include "../lv_draw.h"
 #include "../../misc/lv_area.h"
 #include "../../misc/lv_color.h"
@@ -43,6 +44,32 @@ typedef struct {
     uint32_t has_alpha : 1;
 } lv_draw_sw_layer_ctx_t;
 
+#if LV_DRAW_COMPLEX && defined(LV_SHADOW_CACHE_SIZE) && LV_SHADOW_CACHE_SIZE > 0
+/**
+ * A blurred shadow corner in the shadow cache.
+ */
+typedef struct {
+    lv_opa_t * buf;         /**< `size * size` opacity values. NULL: the entry is free*/
+    uint32_t life;          /**< When the entry was used last time, the oldest one is dropped first*/
+    lv_coord_t size;        /**< Size of the corner: shadow width + radius*/
+    lv_coord_t radius;      /**< The radius of the shadow, clamped to its size*/
+} _lv_draw_sw_shadow_cache_entry_t;
+
+typedef _lv_draw_sw_shadow_cache_entry_t _lv_draw_sw_shadow_cache_arr_t[LV_SHADOW_CACHE_CNT];
+#endif
+
+/**
+ * Statistics of the shadow cache.
+ */
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of shadows drawn with a cached corner*/
+    uint32_t miss_cnt;      /**< Number of shadows whose corner was calculated*/
+    uint32_t used_size;     /**< Bytes used by the cached corners*/
+    uint32_t total_size;    /**< Max. bytes the cached corners can use*/
+    uint16_t entry_cnt;     /**< Number of cache entries*/
+    uint16_t used_entry_cnt;/**< Number of entries with a corner*/
+} lv_draw_sw_shadow_cache_info_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -57,6 +84,19 @@ void lv_draw_sw_arc(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, con
 
 void lv_draw_sw_rect(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords);
 
+/**
+ * Limit the memory used by the blurred corners in the shadow cache.
+ * The least recently used corners are dropped to keep the limit. Corners larger than the limit are not cached.
+ * @param size      max. number of bytes the cached corners can use. The default is `LV_SHADOW_CACHE_SIZE^2`
+ */
+void lv_draw_sw_shadow_cache_set_budget(uint32_t size);
+
+/**
+ * Get the statistics of the shadow cache.
+ * @param info      store the result here
+ */
+void lv_draw_sw_shadow_cache_get_info(lv_draw_sw_shadow_cache_info_t * info);
+
 void lv_draw_sw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords);
 void lv_draw_sw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos_p,
                        uint32_t letter);
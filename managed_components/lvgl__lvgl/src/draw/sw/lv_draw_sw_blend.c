@@ -252,10 +252,14 @@ static LV_ATTRIBUTE_FAST_MEM void fill_normal(lv_color_t * dest_buf, const lv_ar
     /*No mask*/
     if(mask == NULL) {
         if(opa >= LV_OPA_MAX) {
+#if LV_COLOR_DEPTH == 16
+            lv_draw_sw_blend_kernel_get()->fill((uint16_t *)dest_buf, dest_stride, w, h, color.full);
+#else
             for(y = 0; y < h; y++) {
                 lv_color_fill(dest_buf, color, w);
                 dest_buf += dest_stride;
             }
+#endif
         }
         /*Has opacity*/
         else {
@@ -288,11 +292,11 @@ static LV_ATTRIBUTE_FAST_MEM void fill_normal(lv_color_t * dest_buf, const lv_ar
     }
     /*Masked*/
     else {
-#if LV_COLOR_DEPTH == 16
-        uint32_t c32 = color.full + ((uint32_t)color.full << 16);
-#endif
         /*Only the mask matters*/
         if(opa >= LV_OPA_MAX) {
+#if LV_COLOR_DEPTH == 16
+            lv_draw_sw_blend_kernel_get()->fill_mask((uint16_t *)dest_buf, dest_stride, w, h, color.full, mask, mask_stride);
+#else
             int32_t x_end4 = w - 4;
             for(y = 0; y < h; y++) {
                 for(x = 0; x < w && ((lv_uintptr_t)(mask) & 0x3); x++) {
@@ -302,24 +306,10 @@ static LV_ATTRIBUTE_FAST_MEM void fill_normal(lv_color_t * dest_buf, const lv_ar
                 for(; x <= x_end4; x += 4) {
                     uint32_t mask32 = *((uint32_t *)mask);
                     if(mask32 == 0xFFFFFFFF) {
-#if LV_COLOR_DEPTH == 16
-                        if((lv_uintptr_t)dest_buf & 0x3) {
-                            *(dest_buf + 0) = color;
-                            uint32_t * d = (uint32_t *)(dest_buf + 1);
-                            *d = c32;
-                            *(dest_buf + 3) = color;
-                        }
-                        else {
-                            uint32_t * d = (uint32_t *)dest_buf;
-                            *d = c32;
-                            *(d + 1) = c32;
-                        }
-#else
                         dest_buf[0] = color;
                         dest_buf[1] = color;
                         dest_buf[2] = color;
                         dest_buf[3] = color;
-#endif
                         dest_buf += 4;
                         mask += 4;
                     }
@@ -341,6 +331,7 @@ static LV_ATTRIBUTE_FAST_MEM void fill_normal(lv_color_t * dest_buf, const lv_ar
                 dest_buf += (dest_stride - w);
                 mask += (mask_stride - w);
             }
+#endif
         }
         /*With opacity*/
         else {
@@ -660,6 +651,10 @@ static void LV_ATTRIBUTE_FAST_MEM map_normal(lv_color_t * dest_buf, const lv_are
             }
         }
         else {
+#if LV_COLOR_DEPTH == 16
+            lv_draw_sw_blend_kernel_get()->map_opa((uint16_t *)dest_buf, dest_stride, w, h,
+                                                   (const uint16_t *)src_buf, src_stride, opa);
+#else
             for(y = 0; y < h; y++) {
                 for(x = 0; x < w; x++) {
                     dest_buf[x] = lv_color_mix(src_buf[x], dest_buf[x], opa);
@@ -667,6 +662,7 @@ static void LV_ATTRIBUTE_FAST_MEM map_normal(lv_color_t * dest_buf, const lv_are
                 dest_buf += dest_stride;
                 src_buf += src_stride;
             }
+#endif
         }
     }
     /*Masked*/
@@ -0,0 +1,555 @@
+/**
+ * @file lv_draw_sw_blend_kernel.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_kernel.h"
+#include "../../misc/lv_math.h"
+
+#if LV_USE_DRAW_SW_SIMD
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define BLEND_KERNEL_SSE2 1
+        #include <emmintrin.h>
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define BLEND_KERNEL_NEON 1
+        #include <arm_neon.h>
+    #endif
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef BLEND_KERNEL_SSE2
+    #define BLEND_KERNEL_SSE2 0
+#endif
+
+#ifndef BLEND_KERNEL_NEON
+    #define BLEND_KERNEL_NEON 0
+#endif
+
+/*The green, red and blue fields of an RGB565 pixel spread out in a 32 bit word.
+ *The same trick is used by `lv_color_mix()`*/
+#define SPREAD_MASK 0x7E0F81FU
+
+#if LV_COLOR_16_SWAP
+    #define PX_SWAP(c) ((uint16_t)(((c) << 8) | ((c) >> 8)))
+#else
+    #define PX_SWAP(c) (c)
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void /* LV_ATTRIBUTE_FAST_MEM */ fill_scalar(uint16_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                                                    uint16_t color);
+static void /* LV_ATTRIBUTE_FAST_MEM */ fill_mask_scalar(uint16_t * dest_buf, lv_coord_t dest_stride, int32_t w,
+                                                         int32_t h, uint16_t color, const lv_opa_t * mask,
+                                                         lv_coord_t mask_stride);
+static void /* LV_ATTRIBUTE_FAST_MEM */ map_opa_scalar(uint16_t * dest_buf, lv_coord_t dest_stride, int32_t w,
+                                                       int32_t h, const uint16_t * src_buf, lv_coord_t src_stride,
+                                                       lv_opa_t opa);
+
+#if BLEND_KERNEL_SSE2 || BLEND_KERNEL_NEON
+static void fill_simd(uint16_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h, uint16_t color);
+static void fill_mask_simd(uint16_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h, uint16_t color,
+                           const lv_opa_t * mask, lv_coord_t mask_stride);
+static void map_opa_simd(uint16_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                         const uint16_t * src_buf, lv_coord_t src_stride, lv_opa_t opa);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const lv_draw_sw_blend_kernel_t kernel_scalar = {
+    .name = "scalar",
+    .fill = fill_scalar,
+    .fill_mask = fill_mask_scalar,
+    .map_opa = map_opa_scalar,
+};
+
+#if BLEND_KERNEL_SSE2 || BLEND_KERNEL_NEON
+static const lv_draw_sw_blend_kernel_t kernel_simd = {
+#if BLEND_KERNEL_SSE2
+    .name = "sse2",
+#else
+    .name = "neon",
+#endif
+    .fill = fill_simd,
+    .fill_mask = fill_mask_simd,
+    .map_opa = map_opa_simd,
+};
+#endif
+
+static const lv_draw_sw_blend_kernel_t * kernel_act = &kernel_scalar;
+
+/**********************
+ *      MACROS
+ **********************/
+#define FILL_MASK_PX(color)                                                 \
+    if(*mask == LV_OPA_COVER) *dest_buf = color;                            \
+    else if(*mask) *dest_buf = mix_px(color, *dest_buf, *mask);             \
+    mask++;                                                                 \
+    dest_buf++;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void _lv_draw_sw_blend_kernel_init(void)
+{
+    lv_draw_sw_blend_kernel_set(NULL);
+}
+
+const lv_draw_sw_blend_kernel_t * lv_draw_sw_blend_kernel_get(void)
+{
+    return kernel_act;
+}
+
+void lv_draw_sw_blend_kernel_set(const lv_draw_sw_blend_kernel_t * kernel)
+{
+    if(kernel == NULL) kernel = lv_draw_sw_blend_kernel_get_simd();
+    if(kernel == NULL) kernel = &kernel_scalar;
+
+    kernel_act = kernel;
+}
+
+const lv_draw_sw_blend_kernel_t * lv_draw_sw_blend_kernel_get_scalar(void)
+{
+    return &kernel_scalar;
+}
+
+const lv_draw_sw_blend_kernel_t * lv_draw_sw_blend_kernel_get_simd(void)
+{
+#if BLEND_KERNEL_SSE2 || BLEND_KERNEL_NEON
+    return &kernel_simd;
+#else
+    return NULL;
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Mix two RGB565 pixels the same way as `lv_color_mix()` with 16 bit color depth
+ */
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM mix_px(uint16_t fg, uint16_t bg, uint8_t mix)
+{
+    fg = PX_SWAP(fg);
+    bg = PX_SWAP(bg);
+
+#if LV_COLOR_MIX_ROUND_OFS == 0
+    mix = (uint32_t)((uint32_t)mix + 4) >> 3;
+    uint32_t bg32 = (uint32_t)((uint32_t)bg | ((uint32_t)bg << 16)) & SPREAD_MASK;
+    uint32_t fg32 = (uint32_t)((uint32_t)fg | ((uint32_t)fg << 16)) & SPREAD_MASK;
+    uint32_t result = ((((fg32 - bg32) * mix) >> 5) + bg32) & SPREAD_MASK;
+    uint16_t res = (uint16_t)((result >> 16) | result);
+#else
+    uint32_t mix_inv = 255 - mix;
+    uint32_t r = LV_UDIV255((uint32_t)(fg >> 11) * mix + (uint32_t)(bg >> 11) * mix_inv + LV_COLOR_MIX_ROUND_OFS);
+    uint32_t g = LV_UDIV255((uint32_t)((fg >> 5) & 0x3F) * mix + (uint32_t)((bg >> 5) & 0x3F) * mix_inv +
+                            LV_COLOR_MIX_ROUND_OFS);
+    uint32_t b = LV_UDIV255((uint32_t)(fg & 0x1F) * mix + (uint32_t)(bg & 0x1F) * mix_inv + LV_COLOR_MIX_ROUND_OFS);
+    uint16_t res = (uint16_t)((r << 11) | (g << 5) | b);
+#endif
+
+    return PX_SWAP(res);
+}
+
+static void LV_ATTRIBUTE_FAST_MEM fill_scalar(uint16_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                                              uint16_t color)
+{
+    uint32_t c32 = (uint32_t)color + ((uint32_t)color << 16);
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint16_t * d16 = dest_buf;
+        int32_t x = 0;
+        if((lv_uintptr_t)d16 & 0x3) {
+            *d16 = color;
+            d16++;
+            x++;
+        }
+
+        uint32_t * d32 = (uint32_t *)d16;
+        for(; x <= w - 8; x += 8) {
+            d32[0] = c32;
+            d32[1] = c32;
+            d32[2] = c32;
+            d32[3] = c32;
+            d32 += 4;
+        }
+
+        d16 = (uint16_t *)d32;
+        for(; x < w; x++) {
+            *d16 = color;
+            d16++;
+        }
+
+        dest_buf += dest_stride;
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM fill_mask_scalar(uint16_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                                                   uint16_t color, const lv_opa_t * mask, lv_coord_t mask_stride)
+{
+    uint32_t c32 = (uint32_t)color + ((uint32_t)color << 16);
+    int32_t x_end4 = w - 4;
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w && ((lv_uintptr_t)(mask) & 0x3); x++) {
+            FILL_MASK_PX(color)
+        }
+
+        for(; x <= x_end4; x += 4) {
+            uint32_t mask32 = *((uint32_t *)mask);
+            if(mask32 == 0xFFFFFFFF) {
+                if((lv_uintptr_t)dest_buf & 0x3) {
+                    *(dest_buf + 0) = color;
+                    uint32_t * d = (uint32_t *)(dest_buf + 1);
+                    *d = c32;
+                    *(dest_buf + 3) = color;
+                }
+                else {
+                    uint32_t * d = (uint32_t *)dest_buf;
+                    *d = c32;
+                    *(d + 1) = c32;
+                }
+                dest_buf += 4;
+                mask += 4;
+            }
+            else if(mask32) {
+                FILL_MASK_PX(color)
+                FILL_MASK_PX(color)
+                FILL_MASK_PX(color)
+                FILL_MASK_PX(color)
+            }
+            else {
+                mask += 4;
+                dest_buf += 4;
+            }
+        }
+
+        for(; x < w ; x++) {
+            FILL_MASK_PX(color)
+        }
+        dest_buf += (dest_stride - w);
+        mask += (mask_stride - w);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM map_opa_scalar(uint16_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                                                 const uint16_t * src_buf, lv_coord_t src_stride, lv_opa_t opa)
+{
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            dest_buf[x] = mix_px(src_buf[x], dest_buf[x], opa);
+        }
+        dest_buf += dest_stride;
+        src_buf += src_stride;
+    }
+}
+
+#if BLEND_KERNEL_SSE2
+
+/**
+ * Mix 8 pixels. `mix` holds the opacity of each pixel (0..255) in 16 bit lanes.
+ */
+static inline __m128i mix_px8(__m128i fg, __m128i bg, __m128i mix)
+{
+#if LV_COLOR_16_SWAP
+    fg = _mm_or_si128(_mm_slli_epi16(fg, 8), _mm_srli_epi16(fg, 8));
+    bg = _mm_or_si128(_mm_slli_epi16(bg, 8), _mm_srli_epi16(bg, 8));
+#endif
+
+#if LV_COLOR_MIX_ROUND_OFS == 0
+    /*Work on 4 pixels in 32 bit lanes to reproduce the wrap-arounds of the scalar code.
+     *Unpacking a register with itself gives `c | (c << 16)` in every lane.*/
+    const __m128i spread = _mm_set1_epi32((int32_t)SPREAD_MASK);
+    mix = _mm_srli_epi16(_mm_add_epi16(mix, _mm_set1_epi16(4)), 3);
+
+    __m128i res[2];
+    int i;
+    for(i = 0; i < 2; i++) {
+        __m128i fg32 = i == 0 ? _mm_unpacklo_epi16(fg, fg) : _mm_unpackhi_epi16(fg, fg);
+        __m128i bg32 = i == 0 ? _mm_unpacklo_epi16(bg, bg) : _mm_unpackhi_epi16(bg, bg);
+        __m128i mix32 = i == 0 ? _mm_unpacklo_epi16(mix, mix) : _mm_unpackhi_epi16(mix, mix);
+        fg32 = _mm_and_si128(fg32, spread);
+        bg32 = _mm_and_si128(bg32, spread);
+
+        /*32 bit multiplication from 16 bit halves: lo(d_lo * m) + (hi(d_lo * m) + lo(d_hi * m)) << 16*/
+        __m128i d = _mm_sub_epi32(fg32, bg32);
+        __m128i prod = _mm_add_epi32(_mm_mullo_epi16(d, mix32), _mm_slli_epi32(_mm_mulhi_epu16(d, mix32), 16));
+        __m128i r = _mm_and_si128(_mm_add_epi32(_mm_srli_epi32(prod, 5), bg32), spread);
+        r = _mm_or_si128(r, _mm_srli_epi32(r, 16));
+
+        /*Sign extend the lower half to make the saturating pack lossless*/
+        res[i] = _mm_srai_epi32(_mm_slli_epi32(r, 16), 16);
+    }
+    __m128i out = _mm_packs_epi32(res[0], res[1]);
+#else
+    const __m128i mask6 = _mm_set1_epi16(0x3F);
+    const __m128i mask5 = _mm_set1_epi16(0x1F);
+    const __m128i ofs = _mm_set1_epi16(LV_COLOR_MIX_ROUND_OFS);
+    const __m128i div255 = _mm_set1_epi16((int16_t)0x8081);
+    __m128i mix_inv = _mm_sub_epi16(_mm_set1_epi16(255), mix);
+
+    __m128i r = _mm_add_epi16(_mm_mullo_epi16(_mm_srli_epi16(fg, 11), mix),
+                              _mm_mullo_epi16(_mm_srli_epi16(bg, 11), mix_inv));
+    __m128i g = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(fg, 5), mask6), mix),
+                              _mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(bg, 5), mask6), mix_inv));
+    __m128i b = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(fg, mask5), mix),
+                              _mm_mullo_epi16(_mm_and_si128(bg, mask5), mix_inv));
+
+    /*LV_UDIV255(x) = (x * 0x8081) >> 23*/
+    r = _mm_srli_epi16(_mm_mulhi_epu16(_mm_add_epi16(r, ofs), div255), 7);
+    g = _mm_srli_epi16(_mm_mulhi_epu16(_mm_add_epi16(g, ofs), div255), 7);
+    b = _mm_srli_epi16(_mm_mulhi_epu16(_mm_add_epi16(b, ofs), div255), 7);
+
+    __m128i out = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 5)), b);
+#endif
+
+#if LV_COLOR_16_SWAP
+    out = _mm_or_si128(_mm_slli_epi16(out, 8), _mm_srli_epi16(out, 8));
+#endif
+    return out;
+}
+
+static void fill_simd(uint16_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h, uint16_t color)
+{
+    __m128i c128 = _mm_set1_epi16((int16_t)color);
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        int32_t x = 0;
+        for(; x < w && ((lv_uintptr_t)&dest_buf[x] & 0xF); x++) {
+            dest_buf[x] = color;
+        }
+
+        for(; x <= w - 16; x += 16) {
+            _mm_store_si128((__m128i *)&dest_buf[x], c128);
+            _mm_store_si128((__m128i *)&dest_buf[x + 8], c128);
+        }
+
+        for(; x <= w - 8; x += 8) {
+            _mm_store_si128((__m128i *)&dest_buf[x], c128);
+        }
+
+        for(; x < w; x++) {
+            dest_buf[x] = color;
+        }
+
+        dest_buf += dest_stride;
+    }
+}
+
+static void fill_mask_simd(uint16_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h, uint16_t color,
+                           const lv_opa_t * mask, lv_coord_t mask_stride)
+{
+    __m128i c128 = _mm_set1_epi16((int16_t)color);
+    __m128i zero = _mm_setzero_si128();
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x <= w - 8; x += 8) {
+            __m128i mask8 = _mm_loadl_epi64((const __m128i *)&mask[x]);
+            if(_mm_movemask_epi8(_mm_cmpeq_epi8(mask8, zero)) == 0xFFFF) continue;
+
+            if((_mm_movemask_epi8(_mm_cmpeq_epi8(mask8, _mm_set1_epi8((char)0xFF))) & 0xFF) == 0xFF) {
+                _mm_storeu_si128((__m128i *)&dest_buf[x], c128);
+                continue;
+            }
+
+            __m128i mix = _mm_unpacklo_epi8(mask8, zero);
+            __m128i bg = _mm_loadu_si128((const __m128i *)&dest_buf[x]);
+            _mm_storeu_si128((__m128i *)&dest_buf[x], mix_px8(c128, bg, mix));
+        }
+
+        for(; x < w; x++) {
+            if(mask[x] == LV_OPA_COVER) dest_buf[x] = color;
+            else if(mask[x]) dest_buf[x] = mix_px(color, dest_buf[x], mask[x]);
+        }
+
+        dest_buf += dest_stride;
+        mask += mask_stride;
+    }
+}
+
+static void map_opa_simd(uint16_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                         const uint16_t * src_buf, lv_coord_t src_stride, lv_opa_t opa)
+{
+    __m128i mix = _mm_set1_epi16(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x <= w - 8; x += 8) {
+            __m128i fg = _mm_loadu_si128((const __m128i *)&src_buf[x]);
+            __m128i bg = _mm_loadu_si128((const __m128i *)&dest_buf[x]);
+            _mm_storeu_si128((__m128i *)&dest_buf[x], mix_px8(fg, bg, mix));
+        }
+
+        for(; x < w; x++) {
+            dest_buf[x] = mix_px(src_buf[x], dest_buf[x], opa);
+        }
+
+        dest_buf += dest_stride;
+        src_buf += src_stride;
+    }
+}
+
+#elif BLEND_KERNEL_NEON
+
+/**
+ * Mix 8 pixels. `mix` holds the opacity of each pixel (0..255) in 16 bit lanes.
+ */
+static inline uint16x8_t mix_px8(uint16x8_t fg, uint16x8_t bg, uint16x8_t mix)
+{
+#if LV_COLOR_16_SWAP
+    fg = vreinterpretq_u16_u8(vrev16q_u8(vreinterpretq_u8_u16(fg)));
+    bg = vreinterpretq_u16_u8(vrev16q_u8(vreinterpretq_u8_u16(bg)));
+#endif
+
+#if LV_COLOR_MIX_ROUND_OFS == 0
+    /*Work on 4 pixels in 32 bit lanes to reproduce the wrap-arounds of the scalar code*/
+    const uint32x4_t spread = vdupq_n_u32(SPREAD_MASK);
+    mix = vshrq_n_u16(vaddq_u16(mix, vdupq_n_u16(4)), 3);
+
+    uint16x4_t res[2];
+    int i;
+    for(i = 0; i < 2; i++) {
+        uint32x4_t fg32 = vmovl_u16(i == 0 ? vget_low_u16(fg) : vget_high_u16(fg));
+        uint32x4_t bg32 = vmovl_u16(i == 0 ? vget_low_u16(bg) : vget_high_u16(bg));
+        uint32x4_t mix32 = vmovl_u16(i == 0 ? vget_low_u16(mix) : vget_high_u16(mix));
+        fg32 = vandq_u32(vorrq_u32(fg32, vshlq_n_u32(fg32, 16)), spread);
+        bg32 = vandq_u32(vorrq_u32(bg32, vshlq_n_u32(bg32, 16)), spread);
+
+        uint32x4_t prod = vmulq_u32(vsubq_u32(fg32, bg32), mix32);
+        uint32x4_t r = vandq_u32(vaddq_u32(vshrq_n_u32(prod, 5), bg32), spread);
+        res[i] = vmovn_u32(vorrq_u32(r, vshrq_n_u32(r, 16)));
+    }
+    uint16x8_t out = vcombine_u16(res[0], res[1]);
+#else
+    const uint16x8_t mask6 = vdupq_n_u16(0x3F);
+    const uint16x8_t mask5 = vdupq_n_u16(0x1F);
+    const uint16x8_t ofs = vdupq_n_u16(LV_COLOR_MIX_ROUND_OFS);
+    const uint16x4_t div255 = vdup_n_u16(0x8081);
+    uint16x8_t mix_inv = vsubq_u16(vdupq_n_u16(255), mix);
+
+    uint16x8_t ch[3];
+    ch[0] = vmlaq_u16(vmulq_u16(vshrq_n_u16(fg, 11), mix), vshrq_n_u16(bg, 11), mix_inv);
+    ch[1] = vmlaq_u16(vmulq_u16(vandq_u16(vshrq_n_u16(fg, 5), mask6), mix), vandq_u16(vshrq_n_u16(bg, 5), mask6), mix_inv);
+    ch[2] = vmlaq_u16(vmulq_u16(vandq_u16(fg, mask5), mix), vandq_u16(bg, mask5), mix_inv);
+
+    /*LV_UDIV255(x) = (x * 0x8081) >> 23*/
+    int i;
+    for(i = 0; i < 3; i++) {
+        uint16x8_t v = vaddq_u16(ch[i], ofs);
+        uint16x4_t lo = vshrn_n_u32(vmull_u16(vget_low_u16(v), div255), 16);
+        uint16x4_t hi = vshrn_n_u32(vmull_u16(vget_high_u16(v), div255), 16);
+        ch[i] = vshrq_n_u16(vcombine_u16(lo, hi), 7);
+    }
+
+    uint16x8_t out = vorrq_u16(vorrq_u16(vshlq_n_u16(ch[0], 11), vshlq_n_u16(ch[1], 5)), ch[2]);
+#endif
+
+#if LV_COLOR_16_SWAP
+    out = vreinterpretq_u16_u8(vrev16q_u8(vreinterpretq_u8_u16(out)));
+#endif
+    return out;
+}
+
+static void fill_simd(uint16_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h, uint16_t color)
+{
+    uint16x8_t c128 = vdupq_n_u16(color);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x <= w - 16; x += 16) {
+            vst1q_u16(&dest_buf[x], c128);
+            vst1q_u16(&dest_buf[x + 8], c128);
+        }
+
+        for(; x <= w - 8; x += 8) {
+            vst1q_u16(&dest_buf[x], c128);
+        }
+
+        for(; x < w; x++) {
+            dest_buf[x] = color;
+        }
+
+        dest_buf += dest_stride;
+    }
+}
+
+static void fill_mask_simd(uint16_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h, uint16_t color,
+                           const lv_opa_t * mask, lv_coord_t mask_stride)
+{
+    uint16x8_t c128 = vdupq_n_u16(color);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x <= w - 8; x += 8) {
+            uint8x8_t mask8 = vld1_u8(&mask[x]);
+            uint64_t mask64 = vget_lane_u64(vreinterpret_u64_u8(mask8), 0);
+            if(mask64 == 0) continue;
+
+            if(mask64 == UINT64_MAX) {
+                vst1q_u16(&dest_buf[x], c128);
+                continue;
+            }
+
+            uint16x8_t mix = vmovl_u8(mask8);
+            uint16x8_t bg = vld1q_u16(&dest_buf[x]);
+            vst1q_u16(&dest_buf[x], mix_px8(c128, bg, mix));
+        }
+
+        for(; x < w; x++) {
+            if(mask[x] == LV_OPA_COVER) dest_buf[x] = color;
+            else if(mask[x]) dest_buf[x] = mix_px(color, dest_buf[x], mask[x]);
+        }
+
+        dest_buf += dest_stride;
+        mask += mask_stride;
+    }
+}
+
+static void map_opa_simd(uint16_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                         const uint16_t * src_buf, lv_coord_t src_stride, lv_opa_t opa)
+{
+    uint16x8_t mix = vdupq_n_u16(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x <= w - 8; x += 8) {
+            uint16x8_t fg = vld1q_u16(&src_buf[x]);
+            uint16x8_t bg = vld1q_u16(&dest_buf[x]);
+            vst1q_u16(&dest_buf[x], mix_px8(fg, bg, mix));
+        }
+
+        for(; x < w; x++) {
+            dest_buf[x] = mix_px(src_buf[x], dest_buf[x], opa);
+        }
+
+        dest_buf += dest_stride;
+        src_buf += src_stride;
+    }
+}
+
+#endif /*BLEND_KERNEL_NEON*/
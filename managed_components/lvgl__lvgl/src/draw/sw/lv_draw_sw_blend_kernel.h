@@ -0,0 +1,88 @@
+/**
+ * @file lv_draw_sw_blend_kernel.h
+ *
+ */
+
+#ifndef LV_DRAW_SW_BLEND_KERNEL_H
+#define LV_DRAW_SW_BLEND_KERNEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../misc/lv_color.h"
+#include "../../misc/lv_area.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * A set of RGB565 blend kernels.
+ * The pixels are raw 16 bit values in the byte order selected by `LV_COLOR_16_SWAP`
+ * and every kernel mixes exactly like `lv_color_mix()` does with 16 bit color depth.
+ */
+typedef struct {
+    const char * name;
+
+    /** Fill `w` x `h` pixels with `color`*/
+    void (*fill)(uint16_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h, uint16_t color);
+
+    /** Mix `color` into `w` x `h` pixels using a mask as opacity*/
+    void (*fill_mask)(uint16_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h, uint16_t color,
+                      const lv_opa_t * mask, lv_coord_t mask_stride);
+
+    /** Mix `w` x `h` pixels of an image into the destination with `opa` opacity*/
+    void (*map_opa)(uint16_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                    const uint16_t * src_buf, lv_coord_t src_stride, lv_opa_t opa);
+} lv_draw_sw_blend_kernel_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Select the fastest kernels available on the current CPU. Called from `lv_draw_init()`.
+ */
+void _lv_draw_sw_blend_kernel_init(void);
+
+/**
+ * Get the kernels used by the software renderer.
+ * @return      pointer to the active kernel set
+ */
+const lv_draw_sw_blend_kernel_t * lv_draw_sw_blend_kernel_get(void);
+
+/**
+ * Change the kernels used by the software renderer.
+ * @param kernel    pointer to a kernel set (must stay valid), or NULL to select the fastest available again
+ */
+void lv_draw_sw_blend_kernel_set(const lv_draw_sw_blend_kernel_t * kernel);
+
+/**
+ * Get the plain C kernels. They are the reference the other kernels have to match bit by bit.
+ * @return      pointer to the scalar kernel set
+ */
+const lv_draw_sw_blend_kernel_t * lv_draw_sw_blend_kernel_get_scalar(void);
+
+/**
+ * Get the SIMD kernels of the current CPU.
+ * @return      pointer to the SIMD kernel set or NULL if SIMD is not available or disabled by `LV_USE_DRAW_SW_SIMD`
+ */
+const lv_draw_sw_blend_kernel_t * lv_draw_sw_blend_kernel_get_simd(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_SW_BLEND_KERNEL_H*/
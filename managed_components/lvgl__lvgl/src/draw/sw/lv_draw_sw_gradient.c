@@ -35,130 +35,111 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static lv_grad_t * next_in_cache(lv_grad_t * item);
-
-typedef lv_res_t (*op_cache_t)(lv_grad_t * c, void * ctx);
-static lv_res_t iterate_cache(op_cache_t func, void * ctx, lv_grad_t ** out);
-static size_t get_cache_item_size(lv_grad_t * c);
-static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h);
-static lv_res_t find_oldest_item_life(lv_grad_t * c, void * ctx);
-static lv_res_t kill_oldest_item(lv_grad_t * c, void * ctx);
-static lv_res_t find_item(lv_grad_t * c, void * ctx);
+static lv_grad_t * find_item(const lv_grad_dsc_t * g, lv_coord_t size, lv_coord_t w, uint32_t key);
+static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h, uint32_t key);
+static void lru_unlink(lv_grad_t * c);
+static void lru_add_first(lv_grad_t * c);
 static void free_item(lv_grad_t * c);
-static  uint32_t compute_key(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h);
+static void evict_items(uint32_t max_size);
+static bool grad_dsc_eq(const lv_grad_dsc_t * a, const lv_grad_dsc_t * b);
+static uint32_t compute_key(const lv_grad_dsc_t * g, lv_coord_t size, lv_coord_t w);
 
 /**********************
  *   STATIC VARIABLE
  **********************/
-static size_t    grad_cache_size = 0;
-static uint8_t * grad_cache_end = 0;
+static uint32_t grad_cache_hit_cnt;
+static uint32_t grad_cache_miss_cnt;
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
-union void_cast {
-    const void * ptr;
-    const uint32_t value;
-};
+#define FNV_PRIME   16777619u
+#define FNV_BASIS   2166136261u
+#define FNV_ADD(h, v) h = ((h) ^ (uint32_t)(v)) * FNV_PRIME
 
+/*FNV-1a hash of the content of the gradient (not of its address, which is usually on the stack) and its size*/
 static uint32_t compute_key(const lv_grad_dsc_t * g, lv_coord_t size, lv_coord_t w)
 {
-    union void_cast v;
-    v.ptr = g;
-    return (v.value ^ size ^ (w >> 1)); /*Yes, this is correct, it's like a hash that changes if the width changes*/
-}
-
-static size_t get_cache_item_size(lv_grad_t * c)
-{
-    size_t s = ALIGN(sizeof(*c)) + ALIGN(c->alloc_size * sizeof(lv_color_t));
-#if _DITHER_GRADIENT
-    s += ALIGN(c->size * sizeof(lv_color32_t));
-#if LV_DITHER_ERROR_DIFFUSION == 1
-    s += ALIGN(c->w * sizeof(lv_scolor24_t));
-#endif
-#endif
-    return s;
+    uint32_t h = FNV_BASIS;
+    uint8_t i;
+    for(i = 0; i < g->stops_count; i++) {
+        FNV_ADD(h, lv_color_to32(g->stops[i].color));
+        FNV_ADD(h, g->stops[i].frac);
+    }
+    FNV_ADD(h, g->stops_count);
+    FNV_ADD(h, g->dir);
+    FNV_ADD(h, g->dither);
+    FNV_ADD(h, size);
+    FNV_ADD(h, w);
+    return h;
 }
 
-static lv_grad_t * next_in_cache(lv_grad_t * item)
+static bool grad_dsc_eq(const lv_grad_dsc_t * a, const lv_grad_dsc_t * b)
 {
-    if(grad_cache_size == 0) return NULL;
+    if(a->dir != b->dir || a->dither != b->dither || a->stops_count != b->stops_count) return false;
 
-    if(item == NULL)
-        return (lv_grad_t *)LV_GC_ROOT(_lv_grad_cache_mem);
-
-    size_t s = get_cache_item_size(item);
-    /*Compute the size for this cache item*/
-    if((uint8_t *)item + s >= grad_cache_end) return NULL;
-    else return (lv_grad_t *)((uint8_t *)item + s);
+    uint8_t i;
+    for(i = 0; i < a->stops_count; i++) {
+        if(a->stops[i].color.full != b->stops[i].color.full || a->stops[i].frac != b->stops[i].frac) return false;
+    }
+    return true;
 }
 
-static lv_res_t iterate_cache(op_cache_t func, void * ctx, lv_grad_t ** out)
+static lv_grad_t * find_item(const lv_grad_dsc_t * g, lv_coord_t size, lv_coord_t w, uint32_t key)
 {
-    lv_grad_t * first = next_in_cache(NULL);
-    while(first != NULL && first->life) {
-        if((*func)(first, ctx) == LV_RES_OK) {
-            if(out != NULL) *out = first;
-            return LV_RES_OK;
-        }
-        first = next_in_cache(first);
+    lv_grad_t * c = LV_GC_ROOT(_lv_grad_cache).buckets[key & (_LV_GRAD_CACHE_BUCKET_CNT - 1)];
+    while(c) {
+        if(c->key == key && c->size == size && c->w == w && grad_dsc_eq(&c->dsc, g)) return c;
+        c = c->bucket_next;
     }
-    return LV_RES_INV;
+    return NULL;
 }
 
-static lv_res_t find_oldest_item_life(lv_grad_t * c, void * ctx)
+static void lru_unlink(lv_grad_t * c)
 {
-    uint32_t * min_life = (uint32_t *)ctx;
-    if(c->life < *min_life) *min_life = c->life;
-    return LV_RES_INV;
+    if(c->lru_prev) c->lru_prev->lru_next = c->lru_next;
+    else LV_GC_ROOT(_lv_grad_cache).lru_first = c->lru_next;
+
+    if(c->lru_next) c->lru_next->lru_prev = c->lru_prev;
+    else LV_GC_ROOT(_lv_grad_cache).lru_last = c->lru_prev;
+
+    c->lru_prev = NULL;
+    c->lru_next = NULL;
 }
 
-static void free_item(lv_grad_t * c)
+static void lru_add_first(lv_grad_t * c)
 {
-    size_t size = get_cache_item_size(c);
-    size_t next_items_size = (size_t)(grad_cache_end - (uint8_t *)c) - size;
-    grad_cache_end -= size;
-    if(next_items_size) {
-        uint8_t * old = (uint8_t *)c;
-        lv_memcpy(c, ((uint8_t *)c) + size, next_items_size);
-        /* Then need to fix all internal pointers too */
-        while((uint8_t *)c != grad_cache_end) {
-            c->map = (lv_color_t *)(((uint8_t *)c->map) - size);
-#if _DITHER_GRADIENT
-            c->hmap = (lv_color32_t *)(((uint8_t *)c->hmap) - size);
-#if LV_DITHER_ERROR_DIFFUSION == 1
-            c->error_acc = (lv_scolor24_t *)(((uint8_t *)c->error_acc) - size);
-#endif
-#endif
-            c = (lv_grad_t *)(((uint8_t *)c) + get_cache_item_size(c));
-        }
-        lv_memset_00(old + next_items_size, size);
-    }
+    c->lru_prev = NULL;
+    c->lru_next = LV_GC_ROOT(_lv_grad_cache).lru_first;
+    if(c->lru_next) c->lru_next->lru_prev = c;
+    else LV_GC_ROOT(_lv_grad_cache).lru_last = c;
+    LV_GC_ROOT(_lv_grad_cache).lru_first = c;
 }
 
-static lv_res_t kill_oldest_item(lv_grad_t * c, void * ctx)
+static void free_item(lv_grad_t * c)
 {
-    uint32_t * min_life = (uint32_t *)ctx;
-    if(c->life == *min_life) {
-        /*Found, let's kill it*/
-        free_item(c);
-        return LV_RES_OK;
-    }
-    return LV_RES_INV;
+    lv_grad_t ** p = &LV_GC_ROOT(_lv_grad_cache).buckets[c->key & (_LV_GRAD_CACHE_BUCKET_CNT - 1)];
+    while(*p != c) p = &(*p)->bucket_next;
+    *p = c->bucket_next;
+
+    lru_unlink(c);
+    LV_GC_ROOT(_lv_grad_cache).used_size -= c->mem_size;
+    lv_mem_free(c);
 }
 
-static lv_res_t find_item(lv_grad_t * c, void * ctx)
+/*Free the least recently used items until the cache uses at most `max_size` bytes*/
+static void evict_items(uint32_t max_size)
 {
-    uint32_t * k = (uint32_t *)ctx;
-    if(c->key == *k) return LV_RES_OK;
-    return LV_RES_INV;
+    while(LV_GC_ROOT(_lv_grad_cache).lru_last && LV_GC_ROOT(_lv_grad_cache).used_size > max_size) {
+        free_item(LV_GC_ROOT(_lv_grad_cache).lru_last);
+    }
 }
 
-static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h)
+static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h, uint32_t key)
 {
     lv_coord_t size = g->dir == LV_GRAD_DIR_HOR ? w : h;
-    lv_coord_t map_size = LV_MAX(w, h); /* The map is being used horizontally (width) unless
-                                           no dithering is selected where it's used vertically */
+    lv_coord_t map_size = g->dir == LV_GRAD_DIR_HOR ? w : LV_MAX(w, h); /* A vertical map is being used
+                                                                           horizontally (width) if dithering */
 
     size_t req_size = ALIGN(sizeof(lv_grad_t)) + ALIGN(map_size * sizeof(lv_color_t));
 #if _DITHER_GRADIENT
@@ -168,62 +149,41 @@ static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord
 #endif
 #endif
 
-    size_t act_size = (size_t)(grad_cache_end - LV_GC_ROOT(_lv_grad_cache_mem));
-    lv_grad_t * item = NULL;
-    if(req_size + act_size < grad_cache_size) {
-        item = (lv_grad_t *)grad_cache_end;
-        item->not_cached = 0;
-    }
-    else {
-        /*Need to evict items from cache until we find enough space to allocate this one */
-        if(req_size <= grad_cache_size) {
-            while(act_size + req_size > grad_cache_size) {
-                uint32_t oldest_life = UINT32_MAX;
-                iterate_cache(&find_oldest_item_life, &oldest_life, NULL);
-                iterate_cache(&kill_oldest_item, &oldest_life, NULL);
-                act_size = (size_t)(grad_cache_end - LV_GC_ROOT(_lv_grad_cache_mem));
-            }
-            item = (lv_grad_t *)grad_cache_end;
-            item->not_cached = 0;
-        }
-        else {
-            /*The cache is too small. Allocate the item manually and free it later.*/
-            item = lv_mem_alloc(req_size);
-            LV_ASSERT_MALLOC(item);
-            if(item == NULL) return NULL;
-            item->not_cached = 1;
-        }
-    }
+    /*Make room for the item. If the cache is too small allocate the item manually and free it after drawing*/
+    bool cached = req_size <= LV_GC_ROOT(_lv_grad_cache).max_size;
+    if(cached) evict_items(LV_GC_ROOT(_lv_grad_cache).max_size - req_size);
 
-    item->key = compute_key(g, size, w);
-    item->life = 1;
-    item->filled = 0;
+    lv_grad_t * item = lv_mem_alloc(req_size);
+    LV_ASSERT_MALLOC(item);
+    if(item == NULL) return NULL;
+
+    lv_memset_00(item, sizeof(lv_grad_t));
+    item->key = key;
+    item->not_cached = cached ? 0 : 1;
+    item->dsc = *g;
+    item->mem_size = req_size;
     item->alloc_size = map_size;
     item->size = size;
-    if(item->not_cached) {
-        uint8_t * p = (uint8_t *)item;
-        item->map = (lv_color_t *)(p + ALIGN(sizeof(*item)));
-#if _DITHER_GRADIENT
-        item->hmap = (lv_color32_t *)(p + ALIGN(sizeof(*item)) + ALIGN(map_size * sizeof(lv_color_t)));
-#if LV_DITHER_ERROR_DIFFUSION == 1
-        item->error_acc = (lv_scolor24_t *)(p + ALIGN(sizeof(*item)) + ALIGN(size * sizeof(lv_grad_color_t)) +
-                                            ALIGN(map_size * sizeof(lv_color_t)));
-        item->w = w;
-#endif
-#endif
-    }
-    else {
-        item->map = (lv_color_t *)(grad_cache_end + ALIGN(sizeof(*item)));
+    item->w = w;
+
+    uint8_t * p = (uint8_t *)item;
+    item->map = (lv_color_t *)(p + ALIGN(sizeof(*item)));
 #if _DITHER_GRADIENT
-        item->hmap = (lv_color32_t *)(grad_cache_end + ALIGN(sizeof(*item)) + ALIGN(map_size * sizeof(lv_color_t)));
+    item->hmap = (lv_color32_t *)(p + ALIGN(sizeof(*item)) + ALIGN(map_size * sizeof(lv_color_t)));
 #if LV_DITHER_ERROR_DIFFUSION == 1
-        item->error_acc = (lv_scolor24_t *)(grad_cache_end + ALIGN(sizeof(*item)) + ALIGN(size * sizeof(lv_grad_color_t)) +
-                                            ALIGN(map_size * sizeof(lv_color_t)));
-        item->w = w;
+    item->error_acc = (lv_scolor24_t *)(p + ALIGN(sizeof(*item)) + ALIGN(size * sizeof(lv_grad_color_t)) +
+                                        ALIGN(map_size * sizeof(lv_color_t)));
 #endif
 #endif
-        grad_cache_end += req_size;
+
+    if(cached) {
+        lv_grad_t ** bucket = &LV_GC_ROOT(_lv_grad_cache).buckets[key & (_LV_GRAD_CACHE_BUCKET_CNT - 1)];
+        item->bucket_next = *bucket;
+        *bucket = item;
+        lru_add_first(item);
+        LV_GC_ROOT(_lv_grad_cache).used_size += req_size;
     }
+
     return item;
 }
 
@@ -232,18 +192,28 @@ static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord
  **********************/
 void lv_gradient_free_cache(void)
 {
-    lv_mem_free(LV_GC_ROOT(_lv_grad_cache_mem));
-    LV_GC_ROOT(_lv_grad_cache_mem) = grad_cache_end = NULL;
-    grad_cache_size = 0;
+    evict_items(0);
+    LV_GC_ROOT(_lv_grad_cache).max_size = 0;
+    LV_GC_ROOT(_lv_grad_cache).inited = 1;
 }
 
 void lv_gradient_set_cache_size(size_t max_bytes)
 {
-    lv_mem_free(LV_GC_ROOT(_lv_grad_cache_mem));
-    grad_cache_end = LV_GC_ROOT(_lv_grad_cache_mem) = lv_mem_alloc(max_bytes);
-    LV_ASSERT_MALLOC(LV_GC_ROOT(_lv_grad_cache_mem));
-    lv_memset_00(LV_GC_ROOT(_lv_grad_cache_mem), max_bytes);
-    grad_cache_size = max_bytes;
+    LV_GC_ROOT(_lv_grad_cache).max_size = max_bytes;
+    LV_GC_ROOT(_lv_grad_cache).inited = 1;
+    evict_items(max_bytes);
+}
+
+void lv_gradient_get_cache_info(lv_grad_cache_info_t * info)
+{
+    lv_memset_00(info, sizeof(lv_grad_cache_info_t));
+    info->hit_cnt = grad_cache_hit_cnt;
+    info->miss_cnt = grad_cache_miss_cnt;
+    info->used_size = LV_GC_ROOT(_lv_grad_cache).used_size;
+    info->total_size = LV_GC_ROOT(_lv_grad_cache).max_size;
+
+    lv_grad_t * c;
+    for(c = LV_GC_ROOT(_lv_grad_cache).lru_first; c; c = c->lru_next) info->entry_cnt++;
 }
 
 lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h)
@@ -251,26 +221,28 @@ lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h)
     /* No gradient, no cache */
     if(g->dir == LV_GRAD_DIR_NONE) return NULL;
 
-    /* Step 0: Check if the cache exist (else create it) */
-    static bool inited = false;
-    if(!inited) {
+    /* Step 0: Set the default size of the cache */
+    if(!LV_GC_ROOT(_lv_grad_cache).inited) {
         lv_gradient_set_cache_size(LV_GRAD_CACHE_DEF_SIZE);
-        inited = true;
     }
 
-    /* Step 1: Search cache for the given key */
+    /* Step 1: Search cache for the given gradient */
     lv_coord_t size = g->dir == LV_GRAD_DIR_HOR ? w : h;
     uint32_t key = compute_key(g, size, w);
-    lv_grad_t * item = NULL;
-    if(iterate_cache(&find_item, &key, &item) == LV_RES_OK) {
-        item->life++; /* Don't forget to bump the counter */
+    lv_grad_t * item = find_item(g, size, w, key);
+    if(item != NULL) {
+        /* Don't forget to mark it as the most recently used */
+        lru_unlink(item);
+        lru_add_first(item);
+        grad_cache_hit_cnt++;
         return item;
     }
 
     /* Step 2: Need to allocate an item for it */
-    item = allocate_item(g, w, h);
+    grad_cache_miss_cnt++;
+    item = allocate_item(g, w, h, key);
     if(item == NULL) {
-        LV_LOG_WARN("Faild to allcoate item for teh gradient");
+        LV_LOG_WARN("Failed to allocate item for the gradient");
         return item;
     }
 
@@ -24,6 +24,9 @@ extern "C" {
 #error LVGL needs at least 2 stops for gradients. Please increase the LV_GRADIENT_MAX_STOPS
 #endif
 
+/*Number of hash buckets in the gradient cache. Must be a power of 2*/
+#define _LV_GRAD_CACHE_BUCKET_CNT   16
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -37,27 +40,51 @@ typedef lv_color_t lv_grad_color_t;
  *  it's possible to cache the computation in this structure instance.
  *  Whenever possible, this structure is reused instead of recomputing the gradient map */
 typedef struct _lv_gradient_cache_t {
-    uint32_t        key;          /**< A discriminating key that's built from the drawing operation.
-                                   * If the key does not match, the cache item is not used */
-    uint32_t        life : 30;    /**< A life counter that's incremented on usage. Higher counter is
-                                   * less likely to be evicted from the cache */
+    uint32_t        key;          /**< A hash of the gradient and its size, selects the bucket of the item */
     uint32_t        filled : 1;   /**< Used to skip dithering in it if already done */
     uint32_t        not_cached: 1; /**< The cache was too small so this item is not managed by the cache*/
-    lv_color_t   *  map;          /**< The computed gradient low bitdepth color map, points into the
-                                   * cache's buffer, no free needed */
+    lv_grad_dsc_t   dsc;          /**< The gradient of the item. Compared on lookup as different gradients can have the same key*/
+    struct _lv_gradient_cache_t * bucket_next;  /**< The next item in the same bucket*/
+    struct _lv_gradient_cache_t * lru_prev;     /**< The item used more recently*/
+    struct _lv_gradient_cache_t * lru_next;     /**< The item used less recently*/
+    uint32_t        mem_size;     /**< Bytes allocated for the item and its maps*/
+    lv_color_t   *  map;          /**< The computed gradient low bitdepth color map, allocated with the item,
+                                   * no free needed */
     lv_coord_t      alloc_size;   /**< The map allocated size in colors */
     lv_coord_t      size;         /**< The computed gradient color map size, in colors */
+    lv_coord_t      w;            /**< The width of the area the gradient was computed for */
 #if _DITHER_GRADIENT
     lv_color32_t  * hmap;         /**< If dithering, we need to store the current, high bitdepth gradient
-                                   * map too, points to the cache's buffer, no free needed */
+                                   * map too, allocated with the item, no free needed */
 #if LV_DITHER_ERROR_DIFFUSION == 1
     lv_scolor24_t * error_acc;    /**< Error diffusion dithering algorithm requires storing the last error
-                                   * drawn, points to the cache's buffer, no free needed  */
-    lv_coord_t      w;            /**< The error array width in pixels */
+                                   * drawn, allocated with the item, no free needed  */
 #endif
 #endif
 } lv_grad_t;
 
+/** The gradient cache. The items are found by their key in the buckets
+ *  and the least recently used ones are evicted first to keep the size limit. */
+typedef struct {
+    lv_grad_t * buckets[_LV_GRAD_CACHE_BUCKET_CNT];
+    lv_grad_t * lru_first;        /**< The most recently used item*/
+    lv_grad_t * lru_last;         /**< The least recently used item*/
+    uint32_t    used_size;        /**< Bytes used by the cached items*/
+    uint32_t    max_size;         /**< Max. bytes the cached items can use*/
+    uint32_t    inited : 1;       /**< The default size is set*/
+} _lv_grad_cache_t;
+
+/**
+ * Statistics of the gradient cache.
+ */
+typedef struct {
+    uint32_t hit_cnt;             /**< Number of gradients found in the cache*/
+    uint32_t miss_cnt;            /**< Number of gradients which were calculated*/
+    uint32_t used_size;           /**< Bytes used by the cached items*/
+    uint32_t total_size;          /**< Max. bytes the cached items can use*/
+    uint32_t entry_cnt;           /**< Number of cached items*/
+} lv_grad_cache_info_t;
+
 /**********************
  *      PROTOTYPES
  **********************/
@@ -71,14 +98,20 @@ lv_grad_color_t /* LV_ATTRIBUTE_FAST_MEM */ lv_gradient_calculate(const lv_grad_
                                                                   lv_coord_t frac);
 
 /**
- * Set the gradient cache size
- * @param max_bytes Max cahce size
+ * Set the gradient cache size. The least recently used items are freed to keep the new size.
+ * @param max_bytes Max cache size
  */
 void lv_gradient_set_cache_size(size_t max_bytes);
 
 /** Free the gradient cache */
 void lv_gradient_free_cache(void);
 
+/**
+ * Get the statistics of the gradient cache
+ * @param info      store the result here
+ */
+void lv_gradient_get_cache_info(lv_grad_cache_info_t * info);
+
 /** Get a gradient cache from the given parameters */
 lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * gradient, lv_coord_t w, lv_coord_t h);
 
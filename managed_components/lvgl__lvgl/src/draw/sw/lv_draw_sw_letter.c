@@ -29,6 +29,14 @@
 
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_letter_normal(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
                                                            const lv_point_t * pos, lv_font_glyph_dsc_t * g, const uint8_t * map_p);
+static bool draw_letter_a8(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos,
+                           lv_font_glyph_dsc_t * g, const uint8_t * map_p);
+static void draw_letter_rle(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos,
+                            lv_font_glyph_dsc_t * g, const uint8_t * map_p);
+static bool can_use_bitmap_as_mask(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                                   const lv_area_t * letter_area);
+static const uint8_t * rle_skip_row(const uint8_t * rle, int32_t w);
+static void rle_decode(uint8_t * dest, const uint8_t * rle, uint32_t size);
 
 #if LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX
 static void draw_letter_subpx(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos,
@@ -191,6 +199,13 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_normal(lv_draw_ctx_t * draw_ctx, c
     }
 #endif
 
+    if(bpp == 8 && draw_letter_a8(draw_ctx, dsc, pos, g, map_p)) return;
+
+    if(bpp == LV_FONT_RLE_A8_BPP) {
+        draw_letter_rle(draw_ctx, dsc, pos, g, map_p);
+        return;
+    }
+
     switch(bpp) {
         case 1:
             bpp_opa_table_p = _lv_bpp1_opa_table;
@@ -350,6 +365,180 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_normal(lv_draw_ctx_t * draw_ctx, c
     lv_mem_buf_release(mask_buf);
 }
 
+/**
+ * Blend an 8 bpp glyph directly from its bitmap. As the bitmap already contains
+ * the final opacity values it can be used as the mask of the whole glyph,
+ * so no mask buffer has to be allocated and filled line by line.
+ * @return      false if the glyph can't be drawn this way and the generic path should be used
+ */
+static bool LV_ATTRIBUTE_FAST_MEM draw_letter_a8(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                                                 const lv_point_t * pos, lv_font_glyph_dsc_t * g, const uint8_t * map_p)
+{
+    lv_area_t letter_area;
+    letter_area.x1 = pos->x;
+    letter_area.y1 = pos->y;
+    letter_area.x2 = pos->x + g->box_w - 1;
+    letter_area.y2 = pos->y + g->box_h - 1;
+
+    if(!can_use_bitmap_as_mask(draw_ctx, dsc, &letter_area)) return false;
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memset_00(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = dsc->color;
+    blend_dsc.opa = dsc->opa;
+    blend_dsc.blend_mode = dsc->blend_mode;
+    blend_dsc.blend_area = &letter_area;
+    blend_dsc.mask_area = &letter_area;
+    blend_dsc.mask_buf = (lv_opa_t *)map_p;
+    blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+    lv_draw_sw_blend(draw_ctx, &blend_dsc);
+
+    return true;
+}
+
+/**
+ * Draw a run-length encoded 8 bpp glyph. The runs are blended straight into the draw buffer,
+ * transparent runs are skipped and cover runs are simple fills.
+ * If that's not possible the glyph is decoded and drawn as a normal 8 bpp glyph.
+ */
+static void LV_ATTRIBUTE_FAST_MEM draw_letter_rle(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                                                  const lv_point_t * pos, lv_font_glyph_dsc_t * g, const uint8_t * map_p)
+{
+    lv_area_t letter_area;
+    letter_area.x1 = pos->x;
+    letter_area.y1 = pos->y;
+    letter_area.x2 = pos->x + g->box_w - 1;
+    letter_area.y2 = pos->y + g->box_h - 1;
+
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    if(!can_use_bitmap_as_mask(draw_ctx, dsc, &letter_area) ||
+       disp->driver->set_px_cb || disp->driver->screen_transp || dsc->blend_mode != LV_BLEND_MODE_NORMAL) {
+        uint32_t a8_size = (uint32_t)g->box_w * g->box_h;
+        uint8_t * a8_buf = lv_mem_buf_get(a8_size);
+        if(a8_buf == NULL) return;
+        rle_decode(a8_buf, map_p, a8_size);
+
+        lv_font_glyph_dsc_t g_a8 = *g;
+        g_a8.bpp = 8;
+        draw_letter_normal(draw_ctx, dsc, pos, &g_a8, a8_buf);
+        lv_mem_buf_release(a8_buf);
+        return;
+    }
+
+    lv_area_t draw_area;
+    if(!_lv_area_intersect(&draw_area, &letter_area, draw_ctx->clip_area)) return;
+
+    if(draw_ctx->wait_for_finish) draw_ctx->wait_for_finish(draw_ctx);
+
+    lv_coord_t dest_stride = lv_area_get_width(draw_ctx->buf_area);
+    lv_color_t * dest_buf = draw_ctx->buf;
+    dest_buf += dest_stride * (draw_area.y1 - draw_ctx->buf_area->y1) + (draw_area.x1 - draw_ctx->buf_area->x1);
+
+    lv_color_t color = dsc->color;
+#if LV_COLOR_DEPTH == 16
+    const lv_draw_sw_blend_kernel_t * kernel = lv_draw_sw_blend_kernel_get();
+#endif
+
+    int32_t box_w = g->box_w;
+    int32_t col_start = draw_area.x1 - pos->x;
+    int32_t col_end = draw_area.x2 - pos->x + 1;
+    int32_t row;
+    for(row = 0; row < draw_area.y1 - pos->y; row++) {
+        map_p = rle_skip_row(map_p, box_w);
+    }
+
+    for(; row <= draw_area.y2 - pos->y; row++) {
+        int32_t col = 0;
+        while(col < box_w) {
+            uint8_t type = *map_p & LV_FONT_RLE_TYPE_MASK;
+            int32_t len = (*map_p & ~LV_FONT_RLE_TYPE_MASK) + 1;
+            const uint8_t * mask = map_p + 1;
+            map_p += type == LV_FONT_RLE_LITERAL ? len + 1 : 1;
+
+            /*Clip the run*/
+            int32_t run_start = LV_MAX(col, col_start);
+            int32_t run_end = LV_MIN(col + len, col_end);
+            mask += run_start - col;
+            col += len;
+            if(run_start >= run_end || type == LV_FONT_RLE_TRANSP) continue;
+
+            lv_color_t * dest_px = dest_buf + (run_start - col_start);
+            int32_t run_len = run_end - run_start;
+#if LV_COLOR_DEPTH == 16
+            if(type == LV_FONT_RLE_COVER) kernel->fill((uint16_t *)dest_px, 0, run_len, 1, color.full);
+            else kernel->fill_mask((uint16_t *)dest_px, 0, run_len, 1, color.full, mask, 0);
+#else
+            if(type == LV_FONT_RLE_COVER) {
+                lv_color_fill(dest_px, color, run_len);
+            }
+            else {
+                int32_t i;
+                for(i = 0; i < run_len; i++) {
+                    if(mask[i] == LV_OPA_COVER) dest_px[i] = color;
+                    else if(mask[i] != LV_OPA_TRANSP) dest_px[i] = lv_color_mix(color, dest_px[i], mask[i]);
+                }
+            }
+#endif
+        }
+        dest_buf += dest_stride;
+    }
+}
+
+/**
+ * Check if a glyph bitmap can be used directly as the mask of the blending
+ * @return      true: no masks, opacity or display settings would need to modify the bitmap
+ */
+static bool can_use_bitmap_as_mask(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                                   const lv_area_t * letter_area)
+{
+    /*With opacity the mask values would need to be scaled*/
+    if(dsc->opa < LV_OPA_MAX) return false;
+
+    /*Only the basic blend is known to leave the mask untouched (the bitmap can be in the font's flash)
+     *and it rounds the mask in place if anti-aliasing is disabled*/
+    if(((lv_draw_sw_ctx_t *)draw_ctx)->blend != lv_draw_sw_blend_basic) return false;
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    if(disp->driver->antialiasing == 0) return false;
+
+#if LV_DRAW_COMPLEX
+    /*Other masks need to be applied on a writable copy*/
+    if(lv_draw_mask_is_any(letter_area)) return false;
+#else
+    LV_UNUSED(letter_area);
+#endif
+
+    return true;
+}
+
+static const uint8_t * rle_skip_row(const uint8_t * rle, int32_t w)
+{
+    int32_t col = 0;
+    while(col < w) {
+        int32_t len = (*rle & ~LV_FONT_RLE_TYPE_MASK) + 1;
+        rle += (*rle & LV_FONT_RLE_TYPE_MASK) == LV_FONT_RLE_LITERAL ? len + 1 : 1;
+        col += len;
+    }
+    return rle;
+}
+
+static void rle_decode(uint8_t * dest, const uint8_t * rle, uint32_t size)
+{
+    uint32_t i = 0;
+    while(i < size) {
+        uint8_t type = *rle & LV_FONT_RLE_TYPE_MASK;
+        uint32_t len = (*rle & ~LV_FONT_RLE_TYPE_MASK) + 1;
+        rle++;
+        if(type == LV_FONT_RLE_LITERAL) {
+            lv_memcpy_small(&dest[i], rle, len);
+            rle += len;
+        }
+        else {
+            lv_memset(&dest[i], type == LV_FONT_RLE_COVER ? LV_OPA_COVER : LV_OPA_TRANSP, len);
+        }
+        i += len;
+    }
+}
+
 #if LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX
 static void draw_letter_subpx(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos,
                               lv_font_glyph_dsc_t * g, const uint8_t * map_p)
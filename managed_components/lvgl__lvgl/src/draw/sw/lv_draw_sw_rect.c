@@ -11,6 +11,7 @@
 #include "../../misc/lv_txt_ap.h"
 #include "../../core/lv_refr.h"
 #include "../../misc/lv_assert.h"
+#include "../../misc/lv_gc.h"
 #include "lv_draw_sw_dither.h"
 
 /*********************
@@ -29,6 +30,10 @@
  **********************/
 static void draw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords);
 static void draw_bg_img(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords);
+#if LV_DRAW_COMPLEX
+static void draw_bg_ver_grad_lines(lv_draw_ctx_t * draw_ctx, lv_draw_sw_blend_dsc_t * blend_dsc, lv_grad_t * grad,
+                                   lv_coord_t grad_y1, lv_coord_t y1, lv_coord_t y2);
+#endif
 static void draw_border(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords);
 
 static void draw_outline(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords);
@@ -41,6 +46,15 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_draw_corner_buf(const lv_area_t *
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(lv_coord_t size, lv_coord_t sw, uint16_t * sh_ups_buf);
 #endif
 
+#if LV_SHADOW_CACHE_DEF
+static _lv_draw_sw_shadow_cache_entry_t * sh_cache_find(lv_coord_t size, lv_coord_t r);
+static void sh_cache_add(const lv_opa_t * sh_buf, lv_coord_t size, lv_coord_t r);
+static _lv_draw_sw_shadow_cache_entry_t * sh_cache_get_lru(void);
+static void sh_cache_drop(_lv_draw_sw_shadow_cache_entry_t * entry);
+static uint32_t sh_cache_get_used_size(void);
+static void sh_cache_trim(uint32_t size);
+#endif
+
 void draw_border_generic(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area, const lv_area_t * inner_area,
                          lv_coord_t rout, lv_coord_t rin, lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode);
 
@@ -50,10 +64,11 @@ static void draw_border_simple(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer
 /**********************
  *  STATIC VARIABLES
  **********************/
-#if defined(LV_SHADOW_CACHE_SIZE) && LV_SHADOW_CACHE_SIZE > 0
-    static uint8_t sh_cache[LV_SHADOW_CACHE_SIZE * LV_SHADOW_CACHE_SIZE];
-    static int32_t sh_cache_size = -1;
-    static int32_t sh_cache_r = -1;
+#if LV_SHADOW_CACHE_DEF
+    static uint32_t sh_cache_budget = (uint32_t)LV_SHADOW_CACHE_SIZE * LV_SHADOW_CACHE_SIZE;
+    static uint32_t sh_cache_life;
+    static uint32_t sh_cache_hit_cnt;
+    static uint32_t sh_cache_miss_cnt;
 #endif
 
 /**********************
@@ -80,6 +95,33 @@ void lv_draw_sw_rect(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, c
     LV_ASSERT_MEM_INTEGRITY();
 }
 
+void lv_draw_sw_shadow_cache_set_budget(uint32_t size)
+{
+#if LV_SHADOW_CACHE_DEF
+    sh_cache_budget = size;
+    sh_cache_trim(size);
+#else
+    LV_UNUSED(size);
+#endif
+}
+
+void lv_draw_sw_shadow_cache_get_info(lv_draw_sw_shadow_cache_info_t * info)
+{
+    lv_memset_00(info, sizeof(lv_draw_sw_shadow_cache_info_t));
+#if LV_SHADOW_CACHE_DEF
+    info->hit_cnt = sh_cache_hit_cnt;
+    info->miss_cnt = sh_cache_miss_cnt;
+    info->used_size = sh_cache_get_used_size();
+    info->total_size = sh_cache_budget;
+    info->entry_cnt = LV_SHADOW_CACHE_CNT;
+
+    uint32_t i;
+    for(i = 0; i < LV_SHADOW_CACHE_CNT; i++) {
+        if(LV_GC_ROOT(_lv_shadow_cache[i]).buf) info->used_entry_cnt++;
+    }
+#endif
+}
+
 void lv_draw_sw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords)
 {
 #if LV_COLOR_SCREEN_TRANSP && LV_COLOR_DEPTH == 32
@@ -165,6 +207,7 @@ static void draw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, co
 
     /*Get gradient if appropriate*/
     lv_grad_t * grad = lv_gradient_get(&dsc->bg_grad, coords_bg_w, coords_bg_h);
+    if(grad == NULL) grad_dir = LV_GRAD_DIR_NONE;   /*Out of memory, draw with the first color*/
     if(grad && grad_dir == LV_GRAD_DIR_HOR) {
         blend_dsc.src_buf = grad->map + clipped_coords.x1 - bg_coords.x1;
     }
@@ -289,8 +332,25 @@ static void draw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, co
     else {
         blend_dsc.opa = opa;
         blend_dsc.mask_res = LV_DRAW_MASK_RES_FULL_COVER;
-        int32_t h_end = bg_coords.y2 - rout;
-        for(h = bg_coords.y1 + rout; h <= h_end; h++) {
+        int32_t h_start = LV_MAX(bg_coords.y1 + rout, clipped_coords.y1);
+        int32_t h_end = LV_MIN(bg_coords.y2 - rout, clipped_coords.y2);
+
+        /*Without masks and dithering the lines of a gradient can be drawn faster*/
+#if _DITHER_GRADIENT
+        bool dithered = dither_mode != LV_DITHER_NONE;
+        if(!dithered && dither_func) dither_func(grad, blend_area.x1, 0, grad_size);  /*Just fills the map*/
+#else
+        bool dithered = false;
+#endif
+        if(!mask_any_center && !dithered && grad_dir == LV_GRAD_DIR_VER) {
+            draw_bg_ver_grad_lines(draw_ctx, &blend_dsc, grad, bg_coords.y1, h_start, h_end);
+            h = h_end + 1;
+        }
+        else {
+            h = h_start;
+        }
+
+        for(; h <= h_end; h++) {
             /*If there is no other mask do not apply mask as in the center there is no radius to mask*/
             if(mask_any_center) {
                 lv_memset(mask_buf, opa, clipped_w);
@@ -321,6 +381,34 @@ bg_clean_up:
 #endif
 }
 
+#if LV_DRAW_COMPLEX
+/**
+ * Draw the lines of a vertical gradient without mask. They are plain fills,
+ * so the consecutive lines with the same color are filled at once.
+ * @param draw_ctx      pointer to a draw context
+ * @param blend_dsc     the blend descriptor of the background, its `blend_area` is set here
+ * @param grad          the gradient with the color of each line in `map`
+ * @param grad_y1       the y coordinate of the first line of the gradient
+ * @param y1            the first line to draw
+ * @param y2            the last line to draw
+ */
+static void draw_bg_ver_grad_lines(lv_draw_ctx_t * draw_ctx, lv_draw_sw_blend_dsc_t * blend_dsc, lv_grad_t * grad,
+                                   lv_coord_t grad_y1, lv_coord_t y1, lv_coord_t y2)
+{
+    lv_area_t * blend_area = (lv_area_t *)blend_dsc->blend_area;
+    lv_coord_t y = y1;
+    while(y <= y2) {
+        lv_color_t c = grad->map[y - grad_y1];
+        blend_area->y1 = y;
+        while(y < y2 && grad->map[y + 1 - grad_y1].full == c.full) y++;
+        blend_area->y2 = y;
+        blend_dsc->color = c;
+        lv_draw_sw_blend(draw_ctx, blend_dsc);
+        y++;
+    }
+}
+#endif
+
 static void draw_bg_img(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords)
 {
     if(dsc->bg_img_src == NULL) return;
@@ -478,23 +566,18 @@ static void LV_ATTRIBUTE_FAST_MEM draw_shadow(lv_draw_ctx_t * draw_ctx, const lv
 
     lv_opa_t * sh_buf;
 
-#if LV_SHADOW_CACHE_SIZE
-    if(sh_cache_size == corner_size && sh_cache_r == r_sh) {
-        /*Use the cache if available*/
+#if LV_SHADOW_CACHE_DEF
+    _lv_draw_sw_shadow_cache_entry_t * cached = sh_cache_find(corner_size, r_sh);
+    if(cached) {
+        /*Use the cache if available. Work on a copy because the corner is mirrored in place below*/
         sh_buf = lv_mem_buf_get(corner_size * corner_size);
-        lv_memcpy(sh_buf, sh_cache, corner_size * corner_size);
+        lv_memcpy(sh_buf, cached->buf, corner_size * corner_size);
     }
     else {
         /*A larger buffer is required for calculation*/
         sh_buf = lv_mem_buf_get(corner_size * corner_size * sizeof(uint16_t));
         shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->shadow_width, r_sh);
-
-        /*Cache the corner if it fits into the cache size*/
-        if((uint32_t)corner_size * corner_size < sizeof(sh_cache)) {
-            lv_memcpy(sh_cache, sh_buf, corner_size * corner_size);
-            sh_cache_size = corner_size;
-            sh_cache_r = r_sh;
-        }
+        sh_cache_add(sh_buf, corner_size, r_sh);
     }
 #else
     sh_buf = lv_mem_buf_get(corner_size * corner_size * sizeof(uint16_t));
@@ -1103,6 +1186,111 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_blur_corner(lv_coord_t size, lv_coord_t
 }
 #endif
 
+#if LV_SHADOW_CACHE_DEF
+/**
+ * Look for a cached corner and mark it as used
+ * @param size  size of the corner: shadow width + radius
+ * @param r     the clamped radius of the shadow
+ * @return      the cache entry or NULL if the corner is not cached
+ */
+static _lv_draw_sw_shadow_cache_entry_t * sh_cache_find(lv_coord_t size, lv_coord_t r)
+{
+    uint32_t i;
+    for(i = 0; i < LV_SHADOW_CACHE_CNT; i++) {
+        _lv_draw_sw_shadow_cache_entry_t * entry = &LV_GC_ROOT(_lv_shadow_cache[i]);
+        if(entry->buf && entry->size == size && entry->radius == r) {
+            sh_cache_life++;
+            entry->life = sh_cache_life;
+            sh_cache_hit_cnt++;
+            return entry;
+        }
+    }
+
+    sh_cache_miss_cnt++;
+    return NULL;
+}
+
+/**
+ * Save a calculated corner. The least recently used corners are dropped to keep the budget.
+ * @param sh_buf    the blurred corner, `size * size` opacity values
+ * @param size      size of the corner: shadow width + radius
+ * @param r         the clamped radius of the shadow
+ */
+static void sh_cache_add(const lv_opa_t * sh_buf, lv_coord_t size, lv_coord_t r)
+{
+    uint32_t buf_size = (uint32_t)size * size;
+    if(buf_size > sh_cache_budget) return;
+
+    sh_cache_trim(sh_cache_budget - buf_size);
+
+    _lv_draw_sw_shadow_cache_entry_t * entry = NULL;
+    uint32_t i;
+    for(i = 0; i < LV_SHADOW_CACHE_CNT; i++) {
+        if(LV_GC_ROOT(_lv_shadow_cache[i]).buf == NULL) {
+            entry = &LV_GC_ROOT(_lv_shadow_cache[i]);
+            break;
+        }
+    }
+
+    if(entry == NULL) {
+        entry = sh_cache_get_lru();
+        if(entry == NULL) return;
+        sh_cache_drop(entry);
+    }
+
+    /*Simply don't cache the corner if there is no memory for it*/
+    entry->buf = lv_mem_alloc(buf_size);
+    if(entry->buf == NULL) return;
+
+    lv_memcpy(entry->buf, sh_buf, buf_size);
+    entry->size = size;
+    entry->radius = r;
+    sh_cache_life++;
+    entry->life = sh_cache_life;
+}
+
+static _lv_draw_sw_shadow_cache_entry_t * sh_cache_get_lru(void)
+{
+    _lv_draw_sw_shadow_cache_entry_t * lru = NULL;
+    uint32_t i;
+    for(i = 0; i < LV_SHADOW_CACHE_CNT; i++) {
+        _lv_draw_sw_shadow_cache_entry_t * entry = &LV_GC_ROOT(_lv_shadow_cache[i]);
+        if(entry->buf == NULL) continue;
+        if(lru == NULL || entry->life < lru->life) lru = entry;
+    }
+
+    return lru;
+}
+
+static void sh_cache_drop(_lv_draw_sw_shadow_cache_entry_t * entry)
+{
+    lv_mem_free(entry->buf);
+    lv_memset_00(entry, sizeof(_lv_draw_sw_shadow_cache_entry_t));
+}
+
+static uint32_t sh_cache_get_used_size(void)
+{
+    uint32_t used_size = 0;
+    uint32_t i;
+    for(i = 0; i < LV_SHADOW_CACHE_CNT; i++) {
+        _lv_draw_sw_shadow_cache_entry_t * entry = &LV_GC_ROOT(_lv_shadow_cache[i]);
+        if(entry->buf) used_size += (uint32_t)entry->size * entry->size;
+    }
+
+    return used_size;
+}
+
+/**
+ * Drop the least recently used corners until the cache uses at most `size` bytes
+ */
+static void sh_cache_trim(uint32_t size)
+{
+    while(sh_cache_get_used_size() > size) {
+        sh_cache_drop(sh_cache_get_lru());
+    }
+}
+#endif /*LV_SHADOW_CACHE_DEF*/
+
 static void draw_outline(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords)
 {
     if(dsc->outline_opa <= LV_OPA_MIN) return;
@@ -40,6 +40,25 @@ typedef struct {
     lv_coord_t grid_h;
 } _lv_grid_calc_t;
 
+typedef struct {
+    lv_obj_t * obj;
+    lv_coord_t w;
+    lv_coord_t h;
+} _lv_grid_cache_item_t;
+
+/**
+ * The result of the last update of a grid container. If only the size of some children changed
+ * and they are not in CONTENT sized tracks, the tracks are the same and only those children are repositioned.
+ */
+typedef struct {
+    _lv_grid_calc_t calc;           /**< The tracks with heap allocated arrays*/
+    _lv_grid_cache_item_t * items;  /**< The children and their size after the update*/
+    uint32_t item_cnt;
+    lv_point_t grid_abs;
+    lv_coord_t cont_w;
+    lv_coord_t cont_h;
+} _lv_grid_cache_t;
+
 /**********************
  *  GLOBAL PROTOTYPES
  **********************/
@@ -56,6 +75,11 @@ static void item_repos(lv_obj_t * item, _lv_grid_calc_t * c, item_repos_hint_t *
 static lv_coord_t grid_align(lv_coord_t cont_size,  bool auto_size, uint8_t align, lv_coord_t gap, uint32_t track_num,
                              lv_coord_t * size_array, lv_coord_t * pos_array, bool reverse);
 static uint32_t count_tracks(const lv_coord_t * templ);
+static _lv_grid_cache_t * cache_get(lv_obj_t * cont);
+static bool cache_update_children(lv_obj_t * cont, _lv_grid_cache_t * cache, item_repos_hint_t * hint);
+static void cache_save(lv_obj_t * cont, _lv_grid_cache_t * cache, _lv_grid_calc_t * c, item_repos_hint_t * hint);
+static void cache_free_data(_lv_grid_cache_t * cache);
+static void cache_event_cb(lv_event_t * e);
 
 static inline const lv_coord_t * get_col_dsc(lv_obj_t * obj)
 {
@@ -343,9 +367,6 @@ static void grid_update(lv_obj_t * cont, void * user_data)
     const lv_coord_t * row_templ = get_row_dsc(cont);
     if(col_templ == NULL || row_templ == NULL) return;
 
-    _lv_grid_calc_t c;
-    calc(cont, &c);
-
     item_repos_hint_t hint;
     lv_memset_00(&hint, sizeof(hint));
 
@@ -357,12 +378,22 @@ static void grid_update(lv_obj_t * cont, void * user_data)
     hint.grid_abs.x = pad_left + cont->coords.x1 - lv_obj_get_scroll_x(cont);
     hint.grid_abs.y = pad_top + cont->coords.y1 - lv_obj_get_scroll_y(cont);
 
-    uint32_t i;
-    for(i = 0; i < cont->spec_attr->child_cnt; i++) {
-        lv_obj_t * item = cont->spec_attr->children[i];
-        item_repos(item, &c, &hint);
+    /*If only the size of some children changed try to keep the tracks*/
+    _lv_grid_cache_t * cache = cache_get(cont);
+    if(cache == NULL || cont->layout_cache_inv || !cache_update_children(cont, cache, &hint)) {
+        _lv_grid_calc_t c;
+        calc(cont, &c);
+
+        uint32_t i;
+        for(i = 0; i < cont->spec_attr->child_cnt; i++) {
+            lv_obj_t * item = cont->spec_attr->children[i];
+            item_repos(item, &c, &hint);
+        }
+
+        if(cache) cache_save(cont, cache, &c, &hint);
+        calc_free(&c);
     }
-    calc_free(&c);
+    cont->layout_cache_inv = 0;
 
     lv_coord_t w_set = lv_obj_get_style_width(cont, LV_PART_MAIN);
     lv_coord_t h_set = lv_obj_get_style_height(cont, LV_PART_MAIN);
@@ -768,4 +799,140 @@ static uint32_t count_tracks(const lv_coord_t * templ)
     return i;
 }
 
+/**
+ * Get the cache of a grid container. It's created on the first update.
+ * @param cont      pointer to a grid container
+ * @return          the cache or NULL if it couldn't be allocated
+ */
+static _lv_grid_cache_t * cache_get(lv_obj_t * cont)
+{
+    _lv_grid_cache_t * cache = lv_obj_get_event_user_data(cont, cache_event_cb);
+    if(cache) return cache;
+
+    cache = lv_mem_alloc(sizeof(_lv_grid_cache_t));
+    LV_ASSERT_MALLOC(cache);
+    if(cache == NULL) return NULL;
+    lv_memset_00(cache, sizeof(_lv_grid_cache_t));
+
+    /*It's a new cache, the tracks need to be calculated*/
+    cont->layout_cache_inv = 1;
+    lv_obj_add_event_cb(cont, cache_event_cb, LV_EVENT_DELETE, cache);
+    return cache;
+}
+
+/**
+ * Reposition only the children whose size has changed since the last update, if the tracks can remain the same.
+ * @param cont      pointer to a grid container
+ * @param cache     the cache of `cont`
+ * @param hint      the absolute position of the grid
+ * @return          false: the tracks needs to be calculated again (nothing was done)
+ */
+static bool cache_update_children(lv_obj_t * cont, _lv_grid_cache_t * cache, item_repos_hint_t * hint)
+{
+    if(cache->item_cnt != cont->spec_attr->child_cnt) return false;
+    if(cache->grid_abs.x != hint->grid_abs.x || cache->grid_abs.y != hint->grid_abs.y) return false;
+    if(cache->cont_w != lv_obj_get_content_width(cont) || cache->cont_h != lv_obj_get_content_height(cont)) return false;
+
+    const lv_coord_t * col_templ = get_col_dsc(cont);
+    const lv_coord_t * row_templ = get_row_dsc(cont);
+
+    /*Check all children first to not start repositioning if the tracks need to be changed*/
+    uint32_t i;
+    uint32_t changed_cnt = 0;
+    for(i = 0; i < cache->item_cnt; i++) {
+        lv_obj_t * item = cont->spec_attr->children[i];
+        _lv_grid_cache_item_t * ci = &cache->items[i];
+        if(ci->obj != item) return false;
+        if(ci->w == lv_obj_get_width(item) && ci->h == lv_obj_get_height(item)) continue;
+        changed_cnt++;
+        if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
+
+        /*The size of the CONTENT tracks depends on their items with span 1*/
+        uint32_t col_pos = get_col_pos(item);
+        uint32_t row_pos = get_row_pos(item);
+        if(col_pos >= cache->calc.col_num || row_pos >= cache->calc.row_num) return false;
+        if(get_col_span(item) == 1 && IS_CONTENT(col_templ[col_pos])) return false;
+        if(get_row_span(item) == 1 && IS_CONTENT(row_templ[row_pos])) return false;
+    }
+
+    if(changed_cnt == 0) return true;
+
+    for(i = 0; i < cache->item_cnt; i++) {
+        lv_obj_t * item = cont->spec_attr->children[i];
+        _lv_grid_cache_item_t * ci = &cache->items[i];
+        if(ci->w == lv_obj_get_width(item) && ci->h == lv_obj_get_height(item)) continue;
+
+        item_repos(item, &cache->calc, hint);
+        ci->w = lv_obj_get_width(item);
+        ci->h = lv_obj_get_height(item);
+    }
+
+    return true;
+}
+
+/**
+ * Save the tracks and the size of the children after a full update
+ * @param cont      pointer to a grid container
+ * @param cache     the cache of `cont`
+ * @param c         the calculated tracks
+ * @param hint      the absolute position of the grid
+ */
+static void cache_save(lv_obj_t * cont, _lv_grid_cache_t * cache, _lv_grid_calc_t * c, item_repos_hint_t * hint)
+{
+    uint32_t child_cnt = cont->spec_attr->child_cnt;
+    if(cache->calc.col_num != c->col_num || cache->calc.row_num != c->row_num || cache->item_cnt != child_cnt) {
+        cache_free_data(cache);
+        cache->calc.x = lv_mem_alloc(sizeof(lv_coord_t) * c->col_num);
+        cache->calc.w = lv_mem_alloc(sizeof(lv_coord_t) * c->col_num);
+        cache->calc.y = lv_mem_alloc(sizeof(lv_coord_t) * c->row_num);
+        cache->calc.h = lv_mem_alloc(sizeof(lv_coord_t) * c->row_num);
+        cache->items = lv_mem_alloc(sizeof(_lv_grid_cache_item_t) * child_cnt);
+        if(cache->calc.x == NULL || cache->calc.w == NULL || cache->calc.y == NULL || cache->calc.h == NULL ||
+           cache->items == NULL) {
+            /*Out of memory. Keep the cache empty so that the next update calculates everything*/
+            cache_free_data(cache);
+            return;
+        }
+    }
+
+    cache->calc.col_num = c->col_num;
+    cache->calc.row_num = c->row_num;
+    lv_memcpy(cache->calc.x, c->x, sizeof(lv_coord_t) * c->col_num);
+    lv_memcpy(cache->calc.w, c->w, sizeof(lv_coord_t) * c->col_num);
+    lv_memcpy(cache->calc.y, c->y, sizeof(lv_coord_t) * c->row_num);
+    lv_memcpy(cache->calc.h, c->h, sizeof(lv_coord_t) * c->row_num);
+    cache->calc.grid_w = c->grid_w;
+    cache->calc.grid_h = c->grid_h;
+
+    cache->item_cnt = child_cnt;
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * item = cont->spec_attr->children[i];
+        cache->items[i].obj = item;
+        cache->items[i].w = lv_obj_get_width(item);
+        cache->items[i].h = lv_obj_get_height(item);
+    }
+
+    cache->grid_abs = hint->grid_abs;
+    cache->cont_w = lv_obj_get_content_width(cont);
+    cache->cont_h = lv_obj_get_content_height(cont);
+}
+
+static void cache_free_data(_lv_grid_cache_t * cache)
+{
+    lv_mem_free(cache->calc.x);
+    lv_mem_free(cache->calc.w);
+    lv_mem_free(cache->calc.y);
+    lv_mem_free(cache->calc.h);
+    lv_mem_free(cache->items);
+    lv_memset_00(cache, sizeof(_lv_grid_cache_t));
+}
+
+static void cache_event_cb(lv_event_t * e)
+{
+    _lv_grid_cache_t * cache = lv_event_get_user_data(e);
+    cache_free_data(cache);
+    lv_mem_free(cache);
+}
+
 #endif /*LV_USE_GRID*/
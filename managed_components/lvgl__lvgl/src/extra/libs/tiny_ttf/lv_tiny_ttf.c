@@ -63,6 +63,18 @@ static void ttf_cb_stream_seek(ttf_cb_stream_t * stream, size_t position)
 #include "stb_rect_pack.h"
 #include "stb_truetype_htcw.h"
 
+#if LV_USE_FONT_LATIN1_CACHE
+/*The glyph index and the metrics of a letter in the current size*/
+typedef struct ttf_latin1_glyph {
+    uint16_t glyph;
+    uint16_t advw;      /*Not scaled, as it's added to the kerning*/
+    int16_t x1;
+    int16_t y1;
+    int16_t x2;
+    int16_t y2;
+} ttf_latin1_glyph_t;
+#endif
+
 typedef struct ttf_font_desc {
     lv_fs_file_t file;
 #if LV_TINY_TTF_FILE_SUPPORT
@@ -74,7 +86,15 @@ typedef struct ttf_font_desc {
     float scale;
     int ascent;
     int descent;
+    lv_coord_t font_size;
     lv_lru_t * bitmap_cache;
+    bool cache_rle;
+    uint32_t cache_hit_cnt;
+    uint32_t cache_miss_cnt;
+#if LV_USE_FONT_LATIN1_CACHE
+    ttf_latin1_glyph_t * latin1;    /*Allocated on first use*/
+    uint32_t latin1_known[256 / 32]; /*A bit for each looked up letter*/
+#endif
 } ttf_font_desc_t;
 
 typedef struct ttf_bitmap_cache_key {
@@ -82,6 +102,40 @@ typedef struct ttf_bitmap_cache_key {
     lv_coord_t line_height;
 } ttf_bitmap_cache_key_t;
 
+static const uint8_t * ttf_render_glyph_rle(ttf_font_desc_t * dsc, int glyph, int w, int h,
+                                            const ttf_bitmap_cache_key_t * cache_key);
+
+#if LV_USE_FONT_LATIN1_CACHE
+/*Get the glyph of a letter < 256 and look it up only once for each size*/
+static const ttf_latin1_glyph_t * ttf_get_latin1_glyph(ttf_font_desc_t * dsc, uint32_t letter)
+{
+    if(dsc->latin1 == NULL) {
+        dsc->latin1 = TTF_MALLOC(256 * sizeof(ttf_latin1_glyph_t));
+        if(dsc->latin1 == NULL) return NULL;
+        lv_memset_00(dsc->latin1_known, sizeof(dsc->latin1_known));
+    }
+
+    ttf_latin1_glyph_t * g = &dsc->latin1[letter];
+    if(dsc->latin1_known[letter >> 5] & (1UL << (letter & 0x1F))) return g;
+
+    int x1 = 0, y1 = 0, x2 = 0, y2 = 0;
+    int advw = 0, lsb;
+    int glyph = stbtt_FindGlyphIndex(&dsc->info, (int)letter);
+    if(glyph != 0) {
+        stbtt_GetGlyphBitmapBox(&dsc->info, glyph, dsc->scale, dsc->scale, &x1, &y1, &x2, &y2);
+        stbtt_GetGlyphHMetrics(&dsc->info, glyph, &advw, &lsb);
+    }
+    g->glyph = (uint16_t)glyph;
+    g->advw = (uint16_t)advw;
+    g->x1 = (int16_t)x1;
+    g->y1 = (int16_t)y1;
+    g->x2 = (int16_t)x2;
+    g->y2 = (int16_t)y2;
+    dsc->latin1_known[letter >> 5] |= 1UL << (letter & 0x1F);
+    return g;
+}
+#endif
+
 static bool ttf_get_glyph_dsc_cb(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                  uint32_t unicode_letter_next)
 {
@@ -98,23 +152,46 @@ static bool ttf_get_glyph_dsc_cb(const lv_font_t * font, lv_font_glyph_dsc_t * d
         return true;
     }
     ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
-    int g1 = stbtt_FindGlyphIndex(&dsc->info, (int)unicode_letter);
-    if(g1 == 0) {
-        /* Glyph not found */
-        return false;
-    }
+    int g1;
     int x1, y1, x2, y2;
+    int advw, lsb;
+#if LV_USE_FONT_LATIN1_CACHE
+    const ttf_latin1_glyph_t * latin1 = unicode_letter < 256 ? ttf_get_latin1_glyph(dsc, unicode_letter) : NULL;
+    if(latin1) {
+        g1 = latin1->glyph;
+        if(g1 == 0) return false;
+        x1 = latin1->x1;
+        y1 = latin1->y1;
+        x2 = latin1->x2;
+        y2 = latin1->y2;
+        advw = latin1->advw;
+    }
+    else
+#endif
+    {
+        g1 = stbtt_FindGlyphIndex(&dsc->info, (int)unicode_letter);
+        if(g1 == 0) {
+            /* Glyph not found */
+            return false;
+        }
+        stbtt_GetGlyphBitmapBox(&dsc->info, g1, dsc->scale, dsc->scale, &x1, &y1, &x2, &y2);
+        stbtt_GetGlyphHMetrics(&dsc->info, g1, &advw, &lsb);
+    }
 
-    stbtt_GetGlyphBitmapBox(&dsc->info, g1, dsc->scale, dsc->scale, &x1, &y1, &x2, &y2);
-    int g2 = 0;
-    if(unicode_letter_next != 0) {
-        g2 = stbtt_FindGlyphIndex(&dsc->info, (int)unicode_letter_next);
+    int k = 0;
+    /*Fonts without kerning tables always return 0*/
+    if(dsc->info.kern || dsc->info.gpos) {
+        int g2 = 0;
+        if(unicode_letter_next != 0) {
+#if LV_USE_FONT_LATIN1_CACHE
+            const ttf_latin1_glyph_t * next = unicode_letter_next < 256 ? ttf_get_latin1_glyph(dsc, unicode_letter_next) : NULL;
+            if(next) g2 = next->glyph;
+            else
+#endif
+                g2 = stbtt_FindGlyphIndex(&dsc->info, (int)unicode_letter_next);
+        }
+        k = stbtt_GetGlyphKernAdvance(&dsc->info, g1, g2);
     }
-    int advw, lsb;
-    stbtt_GetGlyphHMetrics(&dsc->info, g1, &advw, &lsb);
-    int k = stbtt_GetGlyphKernAdvance(&dsc->info, g1, g2);
-    dsc_out->adv_w = (uint16_t)floor((((float)advw + (float)k) * dsc->scale) +
-                                     0.5f); /*Horizontal space required by the glyph in [px]*/
 
     dsc_out->adv_w = (uint16_t)floor((((float)advw + (float)k) * dsc->scale) +
                                      0.5f); /*Horizontal space required by the glyph in [px]*/
@@ -122,7 +199,7 @@ static bool ttf_get_glyph_dsc_cb(const lv_font_t * font, lv_font_glyph_dsc_t * d
     dsc_out->box_h = (y2 - y1 + 1);         /*height of the bitmap in [px]*/
     dsc_out->ofs_x = x1;                    /*X offset of the bitmap in [pf]*/
     dsc_out->ofs_y = -y2;                   /*Y offset of the bitmap measured from the as line*/
-    dsc_out->bpp = 8;                       /*Bits per pixel: 1/2/4/8*/
+    dsc_out->bpp = dsc->cache_rle ? LV_FONT_RLE_A8_BPP : 8; /*Bits per pixel: 1/2/4/8*/
     dsc_out->is_placeholder = false;
     return true; /*true: glyph found; false: glyph was not found*/
 }
@@ -131,13 +208,28 @@ static const uint8_t * ttf_get_glyph_bitmap_cb(const lv_font_t * font, uint32_t
 {
     ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
     const stbtt_fontinfo * info = (const stbtt_fontinfo *)&dsc->info;
-    int g1 = stbtt_FindGlyphIndex(info, (int)unicode_letter);
-    if(g1 == 0) {
-        /* Glyph not found */
-        return NULL;
-    }
+    int g1;
     int x1, y1, x2, y2;
-    stbtt_GetGlyphBitmapBox(info, g1, dsc->scale, dsc->scale, &x1, &y1, &x2, &y2);
+#if LV_USE_FONT_LATIN1_CACHE
+    const ttf_latin1_glyph_t * latin1 = unicode_letter < 256 ? ttf_get_latin1_glyph(dsc, unicode_letter) : NULL;
+    if(latin1) {
+        g1 = latin1->glyph;
+        if(g1 == 0) return NULL;
+        x1 = latin1->x1;
+        y1 = latin1->y1;
+        x2 = latin1->x2;
+        y2 = latin1->y2;
+    }
+    else
+#endif
+    {
+        g1 = stbtt_FindGlyphIndex(info, (int)unicode_letter);
+        if(g1 == 0) {
+            /* Glyph not found */
+            return NULL;
+        }
+        stbtt_GetGlyphBitmapBox(info, g1, dsc->scale, dsc->scale, &x1, &y1, &x2, &y2);
+    }
     int w, h;
     w = x2 - x1 + 1;
     h = y2 - y1 + 1;
@@ -150,9 +242,14 @@ static const uint8_t * ttf_get_glyph_bitmap_cb(const lv_font_t * font, uint32_t
     uint8_t * buffer = NULL;
     lv_lru_get(dsc->bitmap_cache, &cache_key, sizeof(cache_key), (void **)&buffer);
     if(buffer) {
+        dsc->cache_hit_cnt++;
         return buffer;
     }
     LV_LOG_TRACE("cache miss for letter: %u", unicode_letter);
+    dsc->cache_miss_cnt++;
+    if(dsc->cache_rle) {
+        return ttf_render_glyph_rle(dsc, g1, w, h, &cache_key);
+    }
     /*Prepare space in cache*/
     size_t szb = h * stride;
     buffer = lv_mem_alloc(szb);
@@ -171,6 +268,37 @@ static const uint8_t * ttf_get_glyph_bitmap_cb(const lv_font_t * font, uint32_t
     return buffer;
 }
 
+static const uint8_t * ttf_render_glyph_rle(ttf_font_desc_t * dsc, int glyph, int w, int h,
+                                            const ttf_bitmap_cache_key_t * cache_key)
+{
+    /*Render into a temporary buffer and store only the encoded bitmap in the cache*/
+    size_t a8_size = h * w;
+    uint8_t * a8_buf = lv_mem_buf_get(a8_size);
+    if(!a8_buf) {
+        LV_LOG_ERROR("failed to allocate render buffer");
+        return NULL;
+    }
+    lv_memset(a8_buf, 0, a8_size);
+    stbtt_MakeGlyphBitmap(&dsc->info, a8_buf, w, h, w, dsc->scale, dsc->scale, glyph);
+
+    size_t szb = lv_font_rle_a8_encode(NULL, a8_buf, w, h);
+    uint8_t * buffer = lv_mem_alloc(szb);
+    if(!buffer) {
+        LV_LOG_ERROR("failed to allocate cache value");
+        lv_mem_buf_release(a8_buf);
+        return NULL;
+    }
+    lv_font_rle_a8_encode(buffer, a8_buf, w, h);
+    lv_mem_buf_release(a8_buf);
+
+    if(LV_LRU_OK != lv_lru_set(dsc->bitmap_cache, cache_key, sizeof(*cache_key), buffer, szb)) {
+        LV_LOG_ERROR("failed to add cache value");
+        lv_mem_free(buffer);
+        return NULL;
+    }
+    return buffer;
+}
+
 static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size_t data_size, lv_coord_t font_size,
                                       size_t cache_size)
 {
@@ -211,6 +339,13 @@ static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size
     }
 #endif
 
+    dsc->font_size = font_size;
+    dsc->cache_rle = false;
+    dsc->cache_hit_cnt = 0;
+    dsc->cache_miss_cnt = 0;
+#if LV_USE_FONT_LATIN1_CACHE
+    dsc->latin1 = NULL;
+#endif
     dsc->bitmap_cache = lv_lru_create(cache_size, font_size * font_size, lv_mem_free, lv_mem_free);
     if(dsc->bitmap_cache == NULL) {
         LV_LOG_ERROR("failed to create lru cache");
@@ -264,6 +399,42 @@ void lv_tiny_ttf_set_size(lv_font_t * font, lv_coord_t font_size)
     stbtt_GetFontVMetrics(&dsc->info, &dsc->ascent, &dsc->descent, &line_gap);
     font->line_height = (lv_coord_t)(dsc->scale * (dsc->ascent - dsc->descent + line_gap));
     font->base_line = (lv_coord_t)(dsc->scale * (line_gap - dsc->descent));
+#if LV_USE_FONT_LATIN1_CACHE
+    /*The boxes are scaled so look up the letters again*/
+    lv_memset_00(dsc->latin1_known, sizeof(dsc->latin1_known));
+#endif
+}
+void lv_tiny_ttf_set_cache_rle(lv_font_t * font, bool en)
+{
+    ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
+    if(dsc->cache_rle == en) return;
+
+    /*The cached bitmaps are in the old format. Encoded glyphs are about 8 times smaller*/
+    size_t average_length = dsc->font_size * dsc->font_size;
+    if(en) average_length = LV_MAX(average_length / 8, 1);
+    lv_lru_t * bitmap_cache = lv_lru_create(dsc->bitmap_cache->total_memory, average_length, lv_mem_free, lv_mem_free);
+    if(bitmap_cache == NULL) {
+        LV_LOG_ERROR("failed to create lru cache");
+        return;
+    }
+    lv_lru_del(dsc->bitmap_cache);
+    dsc->bitmap_cache = bitmap_cache;
+    dsc->cache_rle = en;
+}
+void lv_tiny_ttf_get_cache_info(const lv_font_t * font, lv_tiny_ttf_cache_info_t * info)
+{
+    const ttf_font_desc_t * dsc = (const ttf_font_desc_t *)font->dsc;
+    info->hit_cnt = dsc->cache_hit_cnt;
+    info->miss_cnt = dsc->cache_miss_cnt;
+    info->total_size = dsc->bitmap_cache->total_memory;
+    info->used_size = dsc->bitmap_cache->total_memory - dsc->bitmap_cache->free_memory;
+}
+void lv_tiny_ttf_flush_cache(lv_font_t * font)
+{
+    ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
+    while(dsc->bitmap_cache->free_memory < dsc->bitmap_cache->total_memory) {
+        lv_lru_remove_lru_item(dsc->bitmap_cache);
+    }
 }
 void lv_tiny_ttf_destroy(lv_font_t * font)
 {
@@ -276,6 +447,9 @@ void lv_tiny_ttf_destroy(lv_font_t * font)
             }
 #endif
             lv_lru_del(ttf->bitmap_cache);
+#if LV_USE_FONT_LATIN1_CACHE
+            if(ttf->latin1) TTF_FREE(ttf->latin1);
+#endif
             TTF_FREE(ttf);
         }
         TTF_FREE(font);
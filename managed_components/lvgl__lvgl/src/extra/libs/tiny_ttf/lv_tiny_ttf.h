@@ -25,6 +25,13 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of glyph bitmaps served from the cache*/
+    uint32_t miss_cnt;      /**< Number of glyph bitmaps which had to be rendered*/
+    size_t used_size;       /**< Bytes used by the cached bitmaps*/
+    size_t total_size;      /**< Size of the cache in bytes*/
+} lv_tiny_ttf_cache_info_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -46,6 +53,16 @@ lv_font_t * lv_tiny_ttf_create_data_ex(const void * data, size_t data_size, lv_c
 /* set the size of the font to a new font_size*/
 void lv_tiny_ttf_set_size(lv_font_t * font, lv_coord_t font_size);
 
+/* store the glyphs run-length encoded in the cache. Fonts with large solid areas (e.g. segment fonts) need
+ * much less cache this way. Only the software renderer can draw such glyphs. Clears the cache.*/
+void lv_tiny_ttf_set_cache_rle(lv_font_t * font, bool en);
+
+/* get the hit/miss counters and the memory usage of the glyph cache*/
+void lv_tiny_ttf_get_cache_info(const lv_font_t * font, lv_tiny_ttf_cache_info_t * info);
+
+/* free the cached glyph bitmaps, e.g. while the font is not shown. The font remains usable.*/
+void lv_tiny_ttf_flush_cache(lv_font_t * font);
+
 /* destroy a font previously created with lv_tiny_ttf_create_xxxx()*/
 void lv_tiny_ttf_destroy(lv_font_t * font);
 
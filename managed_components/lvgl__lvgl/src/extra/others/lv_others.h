@@ -17,6 +17,7 @@ extern "C" {
 #include "monkey/lv_monkey.h"
 #include "gridnav/lv_gridnav.h"
 #include "fragment/lv_fragment.h"
+#include "scr_pool/lv_scr_pool.h"
 #include "imgfont/lv_imgfont.h"
 #include "msg/lv_msg.h"
 #include "ime/lv_ime_pinyin.h"
@@ -12,21 +12,65 @@
 #include "../../../misc/lv_assert.h"
 #include "../../../misc/lv_ll.h"
 
+#if LV_MSG_POST_SLOT_CNT > 0
+    #include <stdatomic.h>
+#endif
+
 /*********************
  *      DEFINES
  *********************/
+/*The subscribers are found by `msg_id & (SUB_BUCKET_CNT - 1)`*/
+#define SUB_BUCKET_CNT  16
+
+#if LV_MSG_POST_SLOT_CNT > 0
+    #if LV_MSG_POST_SLOT_CNT > 255
+        #error "LV_MSG_POST_SLOT_CNT should be max. 255"
+    #endif
+
+    /*Power of 2 to select the cells with a mask. As a slot is queued max. once it never gets full*/
+    #if LV_MSG_POST_SLOT_CNT <= 8
+        #define POST_QUEUE_SIZE 8
+    #elif LV_MSG_POST_SLOT_CNT <= 32
+        #define POST_QUEUE_SIZE 32
+    #else
+        #define POST_QUEUE_SIZE 256
+    #endif
+#endif
 
 /**********************
  *      TYPEDEFS
  **********************/
 
-typedef struct {
+typedef struct _sub_dsc_t {
     uint32_t msg_id;
     lv_msg_subscribe_cb_t callback;
     void * user_data;
     void * _priv_data;      /*Internal: used only store 'obj' in lv_obj_subscribe*/
+    struct _sub_dsc_t * bucket_next;    /*Next subscriber in the same bucket*/
+    uint8_t removed : 1;    /*Unsubscribed during a notification, freed when it's done*/
 } sub_dsc_t;
 
+#if LV_MSG_POST_SLOT_CNT > 0
+/*The latest payload posted with an ID*/
+typedef struct {
+    atomic_uint msg_id;     /*LV_MSG_ID_ANY if the slot is not used yet*/
+    atomic_uint seq;        /*Odd while the payload is being written*/
+    atomic_uint pending;    /*1 if the slot is in the queue*/
+    uint32_t size;
+    union {
+        uint8_t data[LV_MSG_POST_PAYLOAD_SIZE];
+        void * align_ptr;
+        uint64_t align_u64;
+    } payload;
+} post_slot_t;
+
+/*Cell of the bounded multi producer queue*/
+typedef struct {
+    atomic_uint seq;
+    uint8_t slot_id;
+} post_cell_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -34,11 +78,27 @@ typedef struct {
 static void notify(lv_msg_t * m);
 static void obj_notify_cb(void * s, lv_msg_t * m);
 static void obj_delete_event_cb(lv_event_t * e);
+static void free_removed_subs(void);
+#if LV_MSG_POST_SLOT_CNT > 0
+    static post_slot_t * get_post_slot(uint32_t msg_id);
+    static void post_queue_push(uint8_t slot_id);
+    static bool post_queue_pop(uint8_t * slot_id);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static lv_ll_t subs_ll;
+static sub_dsc_t * sub_buckets[SUB_BUCKET_CNT];
+static uint32_t notify_depth;      /*>0 while the subscribers are notified, also in nested sends*/
+static bool removed_pending;
+
+#if LV_MSG_POST_SLOT_CNT > 0
+    static post_slot_t post_slots[LV_MSG_POST_SLOT_CNT];
+    static post_cell_t post_queue[POST_QUEUE_SIZE];
+    static atomic_uint post_queue_head;     /*Written by the producers*/
+    static uint32_t post_queue_tail;        /*Used only by the LVGL thread*/
+#endif
 
 /**********************
  *  GLOBAL VARIABLES
@@ -57,6 +117,21 @@ void lv_msg_init(void)
 {
     LV_EVENT_MSG_RECEIVED = lv_event_register_id();
     _lv_ll_init(&subs_ll, sizeof(sub_dsc_t));
+    lv_memset_00(sub_buckets, sizeof(sub_buckets));
+    notify_depth = 0;
+    removed_pending = false;
+
+#if LV_MSG_POST_SLOT_CNT > 0
+    uint32_t i;
+    for(i = 0; i < LV_MSG_POST_SLOT_CNT; i++) {
+        atomic_init(&post_slots[i].msg_id, LV_MSG_ID_ANY);
+        atomic_init(&post_slots[i].seq, 0);
+        atomic_init(&post_slots[i].pending, 0);
+    }
+    for(i = 0; i < POST_QUEUE_SIZE; i++) atomic_init(&post_queue[i].seq, i);
+    atomic_init(&post_queue_head, 0);
+    post_queue_tail = 0;
+#endif
 }
 
 void * lv_msg_subsribe(uint32_t msg_id, lv_msg_subscribe_cb_t cb, void * user_data)
@@ -70,6 +145,12 @@ void * lv_msg_subsribe(uint32_t msg_id, lv_msg_subscribe_cb_t cb, void * user_da
     s->msg_id = msg_id;
     s->callback = cb;
     s->user_data = user_data;
+
+    /*Add to the end of the bucket to notify in the order of subscription*/
+    sub_dsc_t ** link = &sub_buckets[msg_id & (SUB_BUCKET_CNT - 1)];
+    while(*link) link = &(*link)->bucket_next;
+    *link = s;
+
     return s;
 }
 
@@ -90,6 +171,25 @@ void * lv_msg_subsribe_obj(uint32_t msg_id, lv_obj_t * obj, void * user_data)
 void lv_msg_unsubscribe(void * s)
 {
     LV_ASSERT_NULL(s);
+
+    sub_dsc_t * sub = s;
+
+    /*A running notification might continue with this subscriber, so only mark it now*/
+    if(notify_depth > 0) {
+        sub->removed = 1;
+        removed_pending = true;
+        return;
+    }
+
+    sub_dsc_t ** link = &sub_buckets[sub->msg_id & (SUB_BUCKET_CNT - 1)];
+    while(*link) {
+        if(*link == sub) {
+            *link = sub->bucket_next;
+            break;
+        }
+        link = &(*link)->bucket_next;
+    }
+
     _lv_ll_remove(&subs_ll, s);
     lv_mem_free(s);
 }
@@ -100,7 +200,7 @@ uint32_t lv_msg_unsubscribe_obj(uint32_t msg_id, lv_obj_t * obj)
     sub_dsc_t * s = _lv_ll_get_head(&subs_ll);
     while(s) {
         sub_dsc_t * s_next = _lv_ll_get_next(&subs_ll, s);
-        if(s->callback == obj_notify_cb &&
+        if(s->callback == obj_notify_cb && !s->removed &&
            (s->msg_id == LV_MSG_ID_ANY || s->msg_id == msg_id) &&
            (obj == NULL || s->_priv_data == obj)) {
             lv_msg_unsubscribe(s);
@@ -122,6 +222,68 @@ void lv_msg_send(uint32_t msg_id, const void * payload)
     notify(&m);
 }
 
+#if LV_MSG_POST_SLOT_CNT > 0
+bool lv_msg_post(uint32_t msg_id, const void * payload, size_t size)
+{
+    if(size > LV_MSG_POST_PAYLOAD_SIZE || msg_id == LV_MSG_ID_ANY) return false;
+
+    post_slot_t * slot = get_post_slot(msg_id);
+    if(slot == NULL) return false;
+
+    /*Start writing. If an other thread is writing the same slot now, give up*/
+    unsigned int seq = atomic_load_explicit(&slot->seq, memory_order_relaxed);
+    if(seq & 1) return false;
+    if(!atomic_compare_exchange_strong(&slot->seq, &seq, seq + 1)) return false;
+
+    if(size) lv_memcpy(slot->payload.data, payload, size);
+    slot->size = size;
+    atomic_store(&slot->seq, seq + 2);
+
+    /*If it's not in the queue yet, add it. Else the new payload will be sent instead of the old one*/
+    if(atomic_exchange(&slot->pending, 1) == 0) {
+        post_queue_push((uint8_t)(slot - post_slots));
+    }
+
+    return true;
+}
+
+void _lv_msg_post_handler(void)
+{
+    /*Send max. as many messages as many slots are there to not get stuck if the producers are faster*/
+    uint32_t i;
+    for(i = 0; i < LV_MSG_POST_SLOT_CNT; i++) {
+        uint8_t slot_id;
+        if(!post_queue_pop(&slot_id)) break;
+
+        /*Clear `pending` first, so a post from now on queues the slot again*/
+        post_slot_t * slot = &post_slots[slot_id];
+        atomic_store(&slot->pending, 0);
+
+        lv_msg_t m;
+        lv_memset_00(&m, sizeof(m));
+        m.id = atomic_load_explicit(&slot->msg_id, memory_order_relaxed);
+
+        /*Copy the payload as the producers can overwrite it while the subscribers use it.
+         *If it's being written now, skip it. The writer will queue it again when it's ready.*/
+        union {
+            uint8_t data[LV_MSG_POST_PAYLOAD_SIZE];
+            void * align_ptr;
+            uint64_t align_u64;
+        } payload;
+        unsigned int seq = atomic_load(&slot->seq);
+        if(seq & 1) continue;
+        uint32_t size = slot->size;
+        if(size > LV_MSG_POST_PAYLOAD_SIZE) continue;
+        lv_memcpy(payload.data, slot->payload.data, size);
+        atomic_thread_fence(memory_order_acquire);
+        if(atomic_load_explicit(&slot->seq, memory_order_relaxed) != seq) continue;
+
+        m.payload = size ? payload.data : NULL;
+        notify(&m);
+    }
+}
+#endif
+
 uint32_t lv_msg_get_id(lv_msg_t * m)
 {
     return m->id;
@@ -154,13 +316,32 @@ lv_msg_t * lv_event_get_msg(lv_event_t * e)
 
 static void notify(lv_msg_t * m)
 {
-    sub_dsc_t * s;
-    _LV_LL_READ(&subs_ll, s) {
-        if(s->msg_id == m->id && s->callback) {
+    /*The callbacks can unsubscribe any subscriber, but they are freed only when the outermost notification is done.
+     *So `s` and the next subscribers stay valid.*/
+    notify_depth++;
+    sub_dsc_t * s = sub_buckets[m->id & (SUB_BUCKET_CNT - 1)];
+    while(s) {
+        if(s->msg_id == m->id && s->callback && !s->removed) {
             m->user_data = s->user_data;
             m->_priv_data = s->_priv_data;
             s->callback(s, m);
         }
+        s = s->bucket_next;
+    }
+    notify_depth--;
+
+    if(notify_depth == 0 && removed_pending) free_removed_subs();
+}
+
+static void free_removed_subs(void)
+{
+    removed_pending = false;
+
+    sub_dsc_t * s = _lv_ll_get_head(&subs_ll);
+    while(s) {
+        sub_dsc_t * s_next = _lv_ll_get_next(&subs_ll, s);
+        if(s->removed) lv_msg_unsubscribe(s);
+        s = s_next;
     }
 }
 
@@ -186,4 +367,65 @@ static void obj_delete_event_cb(lv_event_t * e)
     }
 }
 
+#if LV_MSG_POST_SLOT_CNT > 0
+/**
+ * Find the slot of an ID or reserve a free slot for it.
+ * The slots are never released so the lookup can be lock-free.
+ */
+static post_slot_t * get_post_slot(uint32_t msg_id)
+{
+    uint32_t start = msg_id % LV_MSG_POST_SLOT_CNT;
+    uint32_t i;
+    for(i = 0; i < LV_MSG_POST_SLOT_CNT; i++) {
+        post_slot_t * slot = &post_slots[(start + i) % LV_MSG_POST_SLOT_CNT];
+        unsigned int id = atomic_load(&slot->msg_id);
+        if(id == msg_id) return slot;
+        if(id == LV_MSG_ID_ANY) {
+            if(atomic_compare_exchange_strong(&slot->msg_id, &id, msg_id)) return slot;
+            /*An other thread reserved it in the meantime, maybe for the same ID*/
+            if(id == msg_id) return slot;
+        }
+    }
+
+    LV_LOG_WARN("lv_msg_post: no free slot, increase LV_MSG_POST_SLOT_CNT");
+    return NULL;
+}
+
+static void post_queue_push(uint8_t slot_id)
+{
+    unsigned int pos = atomic_load_explicit(&post_queue_head, memory_order_relaxed);
+    post_cell_t * cell;
+    while(1) {
+        cell = &post_queue[pos & (POST_QUEUE_SIZE - 1)];
+        unsigned int seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+        int32_t diff = (int32_t)(seq - pos);
+        if(diff == 0) {
+            /*The cell is free, try to take it*/
+            if(atomic_compare_exchange_weak_explicit(&post_queue_head, &pos, pos + 1,
+                                                     memory_order_relaxed, memory_order_relaxed)) break;
+        }
+        else {
+            /*An other producer took it, try the next position.
+             *The queue is never full as every slot is queued max. once*/
+            pos = atomic_load_explicit(&post_queue_head, memory_order_relaxed);
+        }
+    }
+
+    cell->slot_id = slot_id;
+    atomic_store_explicit(&cell->seq, pos + 1, memory_order_release);
+}
+
+static bool post_queue_pop(uint8_t * slot_id)
+{
+    post_cell_t * cell = &post_queue[post_queue_tail & (POST_QUEUE_SIZE - 1)];
+    unsigned int seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+    if(seq != post_queue_tail + 1) return false;
+
+    *slot_id = cell->slot_id;
+    atomic_store_explicit(&cell->seq, post_queue_tail + POST_QUEUE_SIZE, memory_order_release);
+    post_queue_tail++;
+    return true;
+}
+#endif
+
 #endif /*LV_USE_MSG*/
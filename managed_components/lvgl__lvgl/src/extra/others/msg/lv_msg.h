@@ -87,6 +87,27 @@ uint32_t lv_msg_unsubscribe_obj(uint32_t msg_id, lv_obj_t * obj);
  */
 void lv_msg_send(uint32_t msg_id, const void * payload);
 
+#if LV_MSG_POST_SLOT_CNT > 0
+/**
+ * Post a message from any thread or interrupt.
+ * The payload is copied and sent to the subscribers in the next `lv_timer_handler()` call.
+ * If the same ID is posted again before that, the subscribers get only the latest payload.
+ * The posted messages are sent in the order they were first posted.
+ * @param msg_id        ID of the message
+ * @param payload       pointer to the data to copy. Can be NULL if `size` is 0.
+ * @param size          size of the payload in bytes. Max. `LV_MSG_POST_PAYLOAD_SIZE`
+ * @return              true: the message was posted; false: the payload is too large,
+ *                      already `LV_MSG_POST_SLOT_CNT` different IDs were posted,
+ *                      or an other thread is posting the same ID at the same moment
+ */
+bool lv_msg_post(uint32_t msg_id, const void * payload, size_t size);
+
+/**
+ * Send the posted messages to the subscribers. Called internally in every `lv_timer_handler()`.
+ */
+void _lv_msg_post_handler(void);
+#endif
+
 /**
  * Get the ID of a message object. Typically used in the subscriber callback.
  * @param m             pointer to a message object
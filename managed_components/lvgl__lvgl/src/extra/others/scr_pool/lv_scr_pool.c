@@ -0,0 +1,267 @@
+/**
+ * @file lv_scr_pool.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_scr_pool.h"
+#if LV_USE_SCR_POOL
+
+#include "../../../misc/lv_mem.h"
+#include "../../../misc/lv_assert.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_obj_t * scr;                         /*NULL if the entry is free*/
+    const lv_scr_pool_class_t * class_p;
+    void * user_data;
+    uint32_t last_use;
+} lv_scr_pool_entry_t;
+
+struct _lv_scr_pool_t {
+    lv_scr_pool_entry_t * entries;
+    uint32_t max_cnt;
+    uint32_t use_cnt;       /*Incremented on every get to order the entries by their last use*/
+    uint32_t hit_cnt;
+    uint32_t build_cnt;
+    uint32_t recycle_cnt;
+};
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_scr_pool_entry_t * find_entry(lv_scr_pool_t * pool, const lv_scr_pool_class_t * class_p,
+                                        const void * user_data);
+static lv_scr_pool_entry_t * find_victim(lv_scr_pool_t * pool, const lv_scr_pool_class_t * class_p);
+static bool build_entry(lv_scr_pool_t * pool, lv_scr_pool_entry_t * entry, const lv_scr_pool_class_t * class_p,
+                        void * user_data);
+static void delete_entry(lv_scr_pool_entry_t * entry);
+static bool is_in_use(const lv_obj_t * scr);
+static void scr_delete_event_cb(lv_event_t * e);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_scr_pool_t * lv_scr_pool_create(uint32_t max_cnt)
+{
+    LV_ASSERT(max_cnt > 0);
+
+    lv_scr_pool_t * pool = lv_mem_alloc(sizeof(lv_scr_pool_t));
+    LV_ASSERT_MALLOC(pool);
+    if(pool == NULL) return NULL;
+    lv_memset_00(pool, sizeof(lv_scr_pool_t));
+
+    pool->entries = lv_mem_alloc(sizeof(lv_scr_pool_entry_t) * max_cnt);
+    LV_ASSERT_MALLOC(pool->entries);
+    if(pool->entries == NULL) {
+        lv_mem_free(pool);
+        return NULL;
+    }
+    lv_memset_00(pool->entries, sizeof(lv_scr_pool_entry_t) * max_cnt);
+    pool->max_cnt = max_cnt;
+
+    return pool;
+}
+
+void lv_scr_pool_del(lv_scr_pool_t * pool)
+{
+    LV_ASSERT_NULL(pool);
+
+    uint32_t i;
+    for(i = 0; i < pool->max_cnt; i++) {
+        lv_scr_pool_entry_t * entry = &pool->entries[i];
+        if(entry->scr == NULL) continue;
+
+        if(is_in_use(entry->scr)) {
+            /*Leave it to the display, only forget about it*/
+            lv_obj_remove_event_cb_with_user_data(entry->scr, scr_delete_event_cb, entry);
+            entry->scr = NULL;
+        }
+        else {
+            delete_entry(entry);
+        }
+    }
+
+    lv_mem_free(pool->entries);
+    lv_mem_free(pool);
+}
+
+lv_obj_t * lv_scr_pool_get(lv_scr_pool_t * pool, const lv_scr_pool_class_t * class_p, void * user_data)
+{
+    LV_ASSERT_NULL(pool);
+    LV_ASSERT_NULL(class_p);
+
+    pool->use_cnt++;
+
+    lv_scr_pool_entry_t * entry = find_entry(pool, class_p, user_data);
+    if(entry) {
+        pool->hit_cnt++;
+        entry->last_use = pool->use_cnt;
+        return entry->scr;
+    }
+
+    entry = find_victim(pool, class_p);
+    if(entry == NULL) {
+        LV_LOG_WARN("every screen of the pool is in use");
+        return NULL;
+    }
+
+    if(entry->scr && entry->class_p == class_p) {
+        /*Same object tree: only the content needs to be changed. No allocations, styles and layouts stay resolved*/
+        if(class_p->unbind_cb) class_p->unbind_cb(entry->scr, entry->user_data);
+        entry->user_data = user_data;
+        entry->last_use = pool->use_cnt;
+        if(class_p->bind_cb) class_p->bind_cb(entry->scr, user_data);
+        pool->recycle_cnt++;
+        return entry->scr;
+    }
+
+    if(entry->scr) delete_entry(entry);
+    if(!build_entry(pool, entry, class_p, user_data)) return NULL;
+
+    return entry->scr;
+}
+
+lv_obj_t * lv_scr_pool_load(lv_scr_pool_t * pool, const lv_scr_pool_class_t * class_p, void * user_data,
+                            lv_scr_load_anim_t anim, uint32_t time, uint32_t delay)
+{
+    lv_obj_t * scr = lv_scr_pool_get(pool, class_p, user_data);
+    if(scr == NULL) return NULL;
+
+    /*Don't delete the old screen, it stays in the pool to be shown again later*/
+    if(scr != lv_scr_act()) lv_scr_load_anim(scr, anim, time, delay, false);
+
+    return scr;
+}
+
+void lv_scr_pool_remove(lv_scr_pool_t * pool, void * user_data)
+{
+    LV_ASSERT_NULL(pool);
+
+    uint32_t i;
+    for(i = 0; i < pool->max_cnt; i++) {
+        lv_scr_pool_entry_t * entry = &pool->entries[i];
+        if(entry->scr && entry->user_data == user_data && !is_in_use(entry->scr)) {
+            delete_entry(entry);
+        }
+    }
+}
+
+void lv_scr_pool_get_info(const lv_scr_pool_t * pool, lv_scr_pool_info_t * info)
+{
+    LV_ASSERT_NULL(pool);
+    LV_ASSERT_NULL(info);
+
+    info->hit_cnt = pool->hit_cnt;
+    info->build_cnt = pool->build_cnt;
+    info->recycle_cnt = pool->recycle_cnt;
+    info->scr_cnt = 0;
+
+    uint32_t i;
+    for(i = 0; i < pool->max_cnt; i++) {
+        if(pool->entries[i].scr) info->scr_cnt++;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_scr_pool_entry_t * find_entry(lv_scr_pool_t * pool, const lv_scr_pool_class_t * class_p,
+                                        const void * user_data)
+{
+    uint32_t i;
+    for(i = 0; i < pool->max_cnt; i++) {
+        lv_scr_pool_entry_t * entry = &pool->entries[i];
+        if(entry->scr && entry->class_p == class_p && entry->user_data == user_data) return entry;
+    }
+
+    return NULL;
+}
+
+/**
+ * Find an entry for a new screen: a free one, else the least recently used one of the same class,
+ * else the least recently used one. Screens shown or being animated are skipped.
+ */
+static lv_scr_pool_entry_t * find_victim(lv_scr_pool_t * pool, const lv_scr_pool_class_t * class_p)
+{
+    lv_scr_pool_entry_t * lru_same = NULL;
+    lv_scr_pool_entry_t * lru_any = NULL;
+
+    uint32_t i;
+    for(i = 0; i < pool->max_cnt; i++) {
+        lv_scr_pool_entry_t * entry = &pool->entries[i];
+        if(entry->scr == NULL) return entry;
+        if(is_in_use(entry->scr)) continue;
+
+        if(lru_any == NULL || entry->last_use < lru_any->last_use) lru_any = entry;
+        if(entry->class_p == class_p && (lru_same == NULL || entry->last_use < lru_same->last_use)) {
+            lru_same = entry;
+        }
+    }
+
+    return lru_same ? lru_same : lru_any;
+}
+
+static bool build_entry(lv_scr_pool_t * pool, lv_scr_pool_entry_t * entry, const lv_scr_pool_class_t * class_p,
+                        void * user_data)
+{
+    lv_obj_t * scr = lv_obj_create(NULL);
+    LV_ASSERT_MALLOC(scr);
+    if(scr == NULL) return false;
+
+    /*Forget the screen if it's deleted by someone else*/
+    lv_obj_add_event_cb(scr, scr_delete_event_cb, LV_EVENT_DELETE, entry);
+
+    entry->scr = scr;
+    entry->class_p = class_p;
+    entry->user_data = user_data;
+    entry->last_use = pool->use_cnt;
+
+    if(class_p->build_cb) class_p->build_cb(scr, user_data);
+    if(class_p->bind_cb) class_p->bind_cb(scr, user_data);
+    pool->build_cnt++;
+
+    return true;
+}
+
+static void delete_entry(lv_scr_pool_entry_t * entry)
+{
+    if(entry->class_p->unbind_cb) entry->class_p->unbind_cb(entry->scr, entry->user_data);
+
+    /*The delete event clears the entry*/
+    lv_obj_del(entry->scr);
+}
+
+static bool is_in_use(const lv_obj_t * scr)
+{
+    lv_disp_t * disp = lv_obj_get_disp(scr);
+    return scr == disp->act_scr || scr == disp->prev_scr || scr == disp->scr_to_load;
+}
+
+static void scr_delete_event_cb(lv_event_t * e)
+{
+    lv_scr_pool_entry_t * entry = lv_event_get_user_data(e);
+    entry->scr = NULL;
+    entry->class_p = NULL;
+    entry->user_data = NULL;
+}
+
+#endif /*LV_USE_SCR_POOL*/
@@ -0,0 +1,115 @@
+/**
+ * @file lv_scr_pool.h
+ *
+ */
+
+#ifndef LV_SCR_POOL_H
+#define LV_SCR_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../core/lv_obj.h"
+#include "../../../core/lv_disp.h"
+
+#if LV_USE_SCR_POOL
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct _lv_scr_pool_t;
+typedef struct _lv_scr_pool_t lv_scr_pool_t;
+
+typedef void (*lv_scr_pool_cb_t)(lv_obj_t * scr, void * user_data);
+
+/**
+ * Describes how to build a screen. Screens of the same class have the same object tree,
+ * so a built screen can be reused for an other `user_data` of the same class.
+ */
+typedef struct {
+    lv_scr_pool_cb_t build_cb;      /**< Create the children of a new screen*/
+    lv_scr_pool_cb_t bind_cb;       /**< Show the data of `user_data` on a built or recycled screen. Can be NULL*/
+    lv_scr_pool_cb_t unbind_cb;     /**< The screen is about to be deleted or reused for an other `user_data`. Can be NULL*/
+} lv_scr_pool_class_t;
+
+typedef struct {
+    uint32_t hit_cnt;           /**< Number of times a screen was found in the pool*/
+    uint32_t build_cnt;         /**< Number of times a screen was created and built*/
+    uint32_t recycle_cnt;       /**< Number of times a screen was reused for an other `user_data`*/
+    uint32_t scr_cnt;           /**< Number of screens in the pool*/
+} lv_scr_pool_info_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create a pool which keeps at most `max_cnt` built screens.
+ * @param max_cnt   max. number of screens kept. Should be at least 2 as the active screen is never evicted.
+ * @return          the new pool or NULL on error
+ */
+lv_scr_pool_t * lv_scr_pool_create(uint32_t max_cnt);
+
+/**
+ * Delete the pool and the screens in it. The active screen is only removed from the pool but not deleted.
+ * @param pool      pointer to a pool
+ */
+void lv_scr_pool_del(lv_scr_pool_t * pool);
+
+/**
+ * Get the screen of `user_data`. If it's not in the pool, the least recently used screen of the same class
+ * is reused, or a new screen is built. The active screen is never reused or deleted.
+ * @param pool      pointer to a pool
+ * @param class_p   describes how to build the screen
+ * @param user_data identifies the screen and passed to the callbacks of `class_p`
+ * @return          the screen or NULL if it couldn't be created
+ */
+lv_obj_t * lv_scr_pool_get(lv_scr_pool_t * pool, const lv_scr_pool_class_t * class_p, void * user_data);
+
+/**
+ * Get the screen of `user_data` like `lv_scr_pool_get()` and load it. The old screen is kept in the pool.
+ * @param pool      pointer to a pool
+ * @param class_p   describes how to build the screen
+ * @param user_data identifies the screen and passed to the callbacks of `class_p`
+ * @param anim      type of the screen load animation
+ * @param time      time of the animation
+ * @param delay     delay before the transition
+ * @return          the loaded screen or NULL if it couldn't be created
+ */
+lv_obj_t * lv_scr_pool_load(lv_scr_pool_t * pool, const lv_scr_pool_class_t * class_p, void * user_data,
+                            lv_scr_load_anim_t anim, uint32_t time, uint32_t delay);
+
+/**
+ * Delete the screen of `user_data` if it's in the pool and not active.
+ * @param pool      pointer to a pool
+ * @param user_data the screen of this data is deleted
+ */
+void lv_scr_pool_remove(lv_scr_pool_t * pool, void * user_data);
+
+/**
+ * Get the statistics of the pool
+ * @param pool      pointer to a pool
+ * @param info      store the result here
+ */
+void lv_scr_pool_get_info(const lv_scr_pool_t * pool, lv_scr_pool_info_t * info);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_SCR_POOL*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_SCR_POOL_H*/
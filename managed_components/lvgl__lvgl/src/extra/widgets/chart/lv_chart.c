@@ -20,6 +20,8 @@
 #define LV_CHART_VDIV_DEF 5
 #define LV_CHART_POINT_CNT_DEF 10
 #define LV_CHART_LABEL_MAX_TEXT_LENGTH 16
+#define LV_CHART_STREAM_SAMPLES_DEF 1
+#define LV_CHART_STREAM_GAP_DEF 4
 
 /**********************
  *      TYPEDEFS
@@ -36,10 +38,13 @@ static void draw_div_lines(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
 static void draw_series_line(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
 static void draw_series_bar(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
 static void draw_series_scatter(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
+static void draw_series_stream(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
 static void draw_cursors(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
 static void draw_axes(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
 static uint32_t get_index_from_x(lv_obj_t * obj, lv_coord_t x);
 static void invalidate_point(lv_obj_t * obj, uint16_t i);
+static void invalidate_stream_points(lv_obj_t * obj, uint16_t first, uint32_t cnt);
+static void stream_clear(lv_obj_t * obj, lv_chart_series_t * ser);
 static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t cnt, lv_coord_t ** a);
 lv_chart_tick_dsc_t * get_tick_gsc(lv_obj_t * obj, lv_chart_axis_t axis);
 
@@ -79,15 +84,16 @@ void lv_chart_set_type(lv_obj_t * obj, lv_chart_type_t type)
     lv_chart_t * chart  = (lv_chart_t *)obj;
     if(chart->type == type) return;
 
-    if(chart->type == LV_CHART_TYPE_SCATTER) {
+    if(chart->type == LV_CHART_TYPE_SCATTER || chart->type == LV_CHART_TYPE_STREAM) {
         lv_chart_series_t * ser;
         _LV_LL_READ_BACK(&chart->series_ll, ser) {
-            lv_mem_free(ser->x_points);
+            if(!ser->x_ext_buf_assigned) lv_mem_free(ser->x_points);
             ser->x_points = NULL;
+            ser->x_ext_buf_assigned = false;
         }
     }
 
-    if(type == LV_CHART_TYPE_SCATTER) {
+    if(type == LV_CHART_TYPE_SCATTER || type == LV_CHART_TYPE_STREAM) {
         lv_chart_series_t * ser;
         _LV_LL_READ_BACK(&chart->series_ll, ser) {
             ser->x_points = lv_mem_alloc(sizeof(lv_point_t) * chart->point_cnt);
@@ -98,6 +104,14 @@ void lv_chart_set_type(lv_obj_t * obj, lv_chart_type_t type)
 
     chart->type = type;
 
+    /*The min. and max. of the stream have nothing to do with the points of the other types*/
+    if(type == LV_CHART_TYPE_STREAM) {
+        lv_chart_series_t * ser;
+        _LV_LL_READ_BACK(&chart->series_ll, ser) {
+            stream_clear(obj, ser);
+        }
+    }
+
     lv_chart_refresh(obj);
 }
 
@@ -113,7 +127,7 @@ void lv_chart_set_point_count(lv_obj_t * obj, uint16_t cnt)
     if(cnt < 1) cnt = 1;
 
     _LV_LL_READ_BACK(&chart->series_ll, ser) {
-        if(chart->type == LV_CHART_TYPE_SCATTER) {
+        if(chart->type == LV_CHART_TYPE_SCATTER || chart->type == LV_CHART_TYPE_STREAM) {
             if(!ser->x_ext_buf_assigned) new_points_alloc(obj, ser, cnt, &ser->x_points);
         }
         if(!ser->y_ext_buf_assigned) new_points_alloc(obj, ser, cnt, &ser->y_points);
@@ -122,6 +136,12 @@ void lv_chart_set_point_count(lv_obj_t * obj, uint16_t cnt)
 
     chart->point_cnt = cnt;
 
+    if(chart->type == LV_CHART_TYPE_STREAM) {
+        _LV_LL_READ_BACK(&chart->series_ll, ser) {
+            stream_clear(obj, ser);
+        }
+    }
+
     lv_chart_refresh(obj);
 }
 
@@ -168,6 +188,15 @@ void lv_chart_set_update_mode(lv_obj_t * obj, lv_chart_update_mode_t update_mode
     lv_obj_invalidate(obj);
 }
 
+void lv_chart_set_stream(lv_obj_t * obj, uint16_t samples_per_point, uint16_t gap)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    chart->stream_samples = samples_per_point > 0 ? samples_per_point : 1;
+    chart->stream_gap = gap;
+}
+
 void lv_chart_set_div_line_count(lv_obj_t * obj, uint8_t hdiv, uint8_t vdiv)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -289,6 +318,9 @@ void lv_chart_get_point_pos_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint1
     else if(chart->type == LV_CHART_TYPE_SCATTER) {
         p_out->x = lv_map(ser->x_points[id], chart->xmin[ser->x_axis_sec], chart->xmax[ser->x_axis_sec], 0, w);
     }
+    else if(chart->type == LV_CHART_TYPE_STREAM) {
+        p_out->x = (w * id) / chart->point_cnt;
+    }
     else if(chart->type == LV_CHART_TYPE_BAR) {
         uint32_t ser_cnt = _lv_ll_get_len(&chart->series_ll);
         /*Gap between the column on the X tick*/
@@ -352,10 +384,11 @@ lv_chart_series_t * lv_chart_add_series(lv_obj_t * obj, lv_color_t color, lv_cha
     lv_coord_t def = LV_CHART_POINT_NONE;
 
     ser->color  = color;
+    ser->x_points = NULL;
     ser->y_points = lv_mem_alloc(sizeof(lv_coord_t) * chart->point_cnt);
     LV_ASSERT_MALLOC(ser->y_points);
 
-    if(chart->type == LV_CHART_TYPE_SCATTER) {
+    if(chart->type == LV_CHART_TYPE_SCATTER || chart->type == LV_CHART_TYPE_STREAM) {
         ser->x_points = lv_mem_alloc(sizeof(lv_coord_t) * chart->point_cnt);
         LV_ASSERT_MALLOC(ser->x_points);
     }
@@ -366,6 +399,9 @@ lv_chart_series_t * lv_chart_add_series(lv_obj_t * obj, lv_color_t color, lv_cha
     }
 
     ser->start_point = 0;
+    ser->stream_sample_cnt = 0;
+    ser->stream_last = LV_CHART_POINT_NONE;
+    ser->x_ext_buf_assigned = false;
     ser->y_ext_buf_assigned = false;
     ser->hidden = 0;
     ser->x_axis_sec = axis & LV_CHART_AXIS_SECONDARY_X ? 1 : 0;
@@ -378,6 +414,8 @@ lv_chart_series_t * lv_chart_add_series(lv_obj_t * obj, lv_color_t color, lv_cha
         p_tmp++;
     }
 
+    if(chart->type == LV_CHART_TYPE_STREAM) stream_clear(obj, ser);
+
     return ser;
 }
 
@@ -538,12 +576,72 @@ void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t
     LV_ASSERT_NULL(ser);
 
     lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(chart->type == LV_CHART_TYPE_STREAM) {
+        lv_chart_set_next_values(obj, ser, &value, 1);
+        return;
+    }
+
     ser->y_points[ser->start_point] = value;
     invalidate_point(obj, ser->start_point);
     ser->start_point = (ser->start_point + 1) % chart->point_cnt;
     invalidate_point(obj, ser->start_point);
 }
 
+void lv_chart_set_next_values(lv_obj_t * obj, lv_chart_series_t * ser, const lv_coord_t values[], uint32_t cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_NULL(ser);
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    uint32_t i;
+    if(chart->type != LV_CHART_TYPE_STREAM) {
+        for(i = 0; i < cnt; i++) {
+            lv_chart_set_next_value(obj, ser, values[i]);
+        }
+        return;
+    }
+
+    if(cnt == 0 || ser->x_points == NULL) return;
+
+    uint16_t first = ser->start_point;
+    uint32_t new_point_cnt = 0;
+    uint16_t p = ser->start_point;
+    for(i = 0; i < cnt; i++) {
+        if(ser->stream_sample_cnt >= chart->stream_samples) {
+            /*Start the next point from the last sample, so the columns are connected*/
+            p = p + 1 < chart->point_cnt ? p + 1 : 0;
+            ser->x_points[p] = ser->stream_last;
+            ser->y_points[p] = ser->stream_last;
+            ser->stream_sample_cnt = 0;
+            new_point_cnt++;
+
+            /*The point at the end of the gap is cleared, the ones before it were cleared by the earlier points*/
+            if(chart->stream_gap > 0 && chart->stream_gap < chart->point_cnt) {
+                uint32_t gap_end = ((uint32_t)p + chart->stream_gap) % chart->point_cnt;
+                ser->x_points[gap_end] = LV_CHART_POINT_NONE;
+                ser->y_points[gap_end] = LV_CHART_POINT_NONE;
+            }
+        }
+
+        lv_coord_t v = values[i];
+        if(v != LV_CHART_POINT_NONE) {
+            if(ser->y_points[p] == LV_CHART_POINT_NONE) {
+                ser->x_points[p] = v;
+                ser->y_points[p] = v;
+            }
+            else {
+                if(v < ser->x_points[p]) ser->x_points[p] = v;
+                if(v > ser->y_points[p]) ser->y_points[p] = v;
+            }
+        }
+        ser->stream_last = v;
+        ser->stream_sample_cnt++;
+    }
+    ser->start_point = p;
+
+    invalidate_stream_points(obj, first, new_point_cnt + 1 + chart->stream_gap);
+}
+
 void lv_chart_set_next_value2(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t x_value, lv_coord_t y_value)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -666,6 +764,8 @@ static void lv_chart_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     chart->update_mode = LV_CHART_UPDATE_MODE_SHIFT;
     chart->zoom_x      = LV_IMG_ZOOM_NONE;
     chart->zoom_y      = LV_IMG_ZOOM_NONE;
+    chart->stream_samples = LV_CHART_STREAM_SAMPLES_DEF;
+    chart->stream_gap  = LV_CHART_STREAM_GAP_DEF;
 
     LV_TRACE_OBJ_CREATE("finished");
 }
@@ -681,6 +781,7 @@ static void lv_chart_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
         ser = _lv_ll_get_head(&chart->series_ll);
 
         if(!ser->y_ext_buf_assigned) lv_mem_free(ser->y_points);
+        if(!ser->x_ext_buf_assigned && ser->x_points) lv_mem_free(ser->x_points);
 
         _lv_ll_remove(&chart->series_ll, ser);
         lv_mem_free(ser);
@@ -751,6 +852,7 @@ static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e)
             if(chart->type == LV_CHART_TYPE_LINE) draw_series_line(obj, draw_ctx);
             else if(chart->type == LV_CHART_TYPE_BAR) draw_series_bar(obj, draw_ctx);
             else if(chart->type == LV_CHART_TYPE_SCATTER) draw_series_scatter(obj, draw_ctx);
+            else if(chart->type == LV_CHART_TYPE_STREAM) draw_series_stream(obj, draw_ctx);
         }
 
         draw_cursors(obj, draw_ctx);
@@ -1177,6 +1279,70 @@ static void draw_series_scatter(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
     draw_ctx->clip_area = clip_area_ori;
 }
 
+/**
+ * Draw the points of stream series as columns from the min. to the max. value.
+ * Only the points under the clip area are visited, so redrawing the newest points costs as much as their width.
+ * No draw part events are sent for the points.
+ */
+static void draw_series_stream(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
+{
+    lv_area_t clip_area;
+    if(_lv_area_intersect(&clip_area, &obj->coords, draw_ctx->clip_area) == false) return;
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    lv_coord_t border_width = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    lv_coord_t pad_left = lv_obj_get_style_pad_left(obj, LV_PART_MAIN) + border_width;
+    lv_coord_t pad_top = lv_obj_get_style_pad_top(obj, LV_PART_MAIN) + border_width;
+    lv_coord_t w     = ((int32_t)lv_obj_get_content_width(obj) * chart->zoom_x) >> 8;
+    lv_coord_t h     = ((int32_t)lv_obj_get_content_height(obj) * chart->zoom_y) >> 8;
+    lv_coord_t x_ofs = obj->coords.x1 + pad_left - lv_obj_get_scroll_left(obj);
+    lv_coord_t y_ofs = obj->coords.y1 + pad_top - lv_obj_get_scroll_top(obj);
+    if(w <= 0) return;
+
+    /*The points under the clip area*/
+    int32_t first = ((int32_t)(clip_area.x1 - x_ofs) * chart->point_cnt) / w;
+    int32_t last = ((int32_t)(clip_area.x2 - x_ofs) * chart->point_cnt) / w;
+    if(first < 0) first = 0;
+    if(last >= chart->point_cnt) last = chart->point_cnt - 1;
+    if(first > last) return;
+
+    const lv_area_t * clip_area_ori = draw_ctx->clip_area;
+    draw_ctx->clip_area = &clip_area;
+
+    lv_coord_t line_width = lv_obj_get_style_line_width(obj, LV_PART_ITEMS);
+    if(line_width < 1) line_width = 1;
+
+    lv_draw_rect_dsc_t col_dsc;
+    lv_draw_rect_dsc_init(&col_dsc);
+    col_dsc.bg_opa = lv_obj_get_style_line_opa(obj, LV_PART_ITEMS);
+
+    lv_chart_series_t * ser;
+    _LV_LL_READ_BACK(&chart->series_ll, ser) {
+        if(ser->hidden) continue;
+        col_dsc.bg_color = ser->color;
+
+        /*lv_map() like the other series, it also handles an empty range*/
+        lv_coord_t ymin = chart->ymin[ser->y_axis_sec];
+        lv_coord_t ymax = chart->ymax[ser->y_axis_sec];
+
+        int32_t i;
+        for(i = first; i <= last; i++) {
+            if(ser->y_points[i] == LV_CHART_POINT_NONE) continue;
+
+            lv_area_t col_area;
+            col_area.x1 = ((int32_t)w * i) / chart->point_cnt + x_ofs;
+            col_area.x2 = ((int32_t)w * (i + 1)) / chart->point_cnt + x_ofs - 1;
+            if(col_area.x2 < col_area.x1) col_area.x2 = col_area.x1;
+            col_area.y1 = h - lv_map(ser->y_points[i], ymin, ymax, 0, h) + y_ofs - line_width / 2;
+            col_area.y2 = h - lv_map(ser->x_points[i], ymin, ymax, 0, h) + y_ofs + (line_width - 1) / 2;
+
+            lv_draw_rect(draw_ctx, &col_dsc, &col_area);
+        }
+    }
+
+    draw_ctx->clip_area = clip_area_ori;
+}
+
 static void draw_series_bar(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
 {
     lv_area_t clip_area;
@@ -1674,6 +1840,7 @@ static uint32_t get_index_from_x(lv_obj_t * obj, lv_coord_t x)
     if(x > w) return chart->point_cnt - 1;
     if(chart->type == LV_CHART_TYPE_LINE) return (x * (chart->point_cnt - 1) + w / 2) / w;
     if(chart->type == LV_CHART_TYPE_BAR) return (x * chart->point_cnt) / w;
+    if(chart->type == LV_CHART_TYPE_STREAM) return LV_MIN((x * chart->point_cnt) / w, chart->point_cnt - 1);
 
     return 0;
 }
@@ -1686,6 +1853,11 @@ static void invalidate_point(lv_obj_t * obj, uint16_t i)
     lv_coord_t w  = ((int32_t)lv_obj_get_content_width(obj) * chart->zoom_x) >> 8;
     lv_coord_t scroll_left = lv_obj_get_scroll_left(obj);
 
+    if(chart->type == LV_CHART_TYPE_STREAM) {
+        invalidate_stream_points(obj, i, 1);
+        return;
+    }
+
     /*In shift mode the whole chart changes so the whole object*/
     if(chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT) {
         lv_obj_invalidate(obj);
@@ -1740,6 +1912,67 @@ static void invalidate_point(lv_obj_t * obj, uint16_t i)
     }
 }
 
+/**
+ * Invalidate `cnt` points of a stream chart from `first`, wrapping around at the end
+ * @param obj pointer to a chart object
+ * @param first index of the first point
+ * @param cnt number of points
+ */
+static void invalidate_stream_points(lv_obj_t * obj, uint16_t first, uint32_t cnt)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(first >= chart->point_cnt) return;
+
+    if(cnt >= chart->point_cnt) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    lv_coord_t w = ((int32_t)lv_obj_get_content_width(obj) * chart->zoom_x) >> 8;
+    lv_coord_t bwidth = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    lv_coord_t pleft = lv_obj_get_style_pad_left(obj, LV_PART_MAIN);
+    lv_coord_t x_ofs = obj->coords.x1 + pleft + bwidth - lv_obj_get_scroll_left(obj);
+    lv_coord_t line_width = lv_obj_get_style_line_width(obj, LV_PART_ITEMS);
+
+    lv_area_t coords;
+    lv_area_copy(&coords, &obj->coords);
+    coords.y1 -= line_width;
+    coords.y2 += line_width;
+
+    uint32_t end = first + cnt;   /*Exclusive*/
+    if(end > chart->point_cnt) {
+        /*The part after the wrap around*/
+        coords.x1 = x_ofs;
+        coords.x2 = ((int32_t)w * (end - chart->point_cnt)) / chart->point_cnt + x_ofs;
+        lv_obj_invalidate_area(obj, &coords);
+        end = chart->point_cnt;
+    }
+
+    coords.x1 = ((int32_t)w * first) / chart->point_cnt + x_ofs;
+    coords.x2 = ((int32_t)w * end) / chart->point_cnt + x_ofs;
+    lv_obj_invalidate_area(obj, &coords);
+}
+
+/**
+ * Clear the points of a stream series and start again from the first point
+ * @param obj pointer to a chart object
+ * @param ser pointer to a series of the chart
+ */
+static void stream_clear(lv_obj_t * obj, lv_chart_series_t * ser)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(ser->x_points == NULL || ser->y_points == NULL) return;
+
+    uint16_t i;
+    for(i = 0; i < chart->point_cnt; i++) {
+        ser->x_points[i] = LV_CHART_POINT_NONE;
+        ser->y_points[i] = LV_CHART_POINT_NONE;
+    }
+    ser->start_point = 0;
+    ser->stream_sample_cnt = 0;
+    ser->stream_last = LV_CHART_POINT_NONE;
+}
+
 static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t cnt, lv_coord_t ** a)
 {
     if((*a) == NULL) return;
@@ -41,6 +41,7 @@ enum {
     LV_CHART_TYPE_LINE,     /**< Connect the points with lines*/
     LV_CHART_TYPE_BAR,      /**< Draw columns*/
     LV_CHART_TYPE_SCATTER,  /**< Draw points and lines in 2D (x,y coordinates)*/
+    LV_CHART_TYPE_STREAM,   /**< Draw the min. and max. of the samples of each point as a sweeping column*/
 };
 typedef uint8_t lv_chart_type_t;
 
@@ -69,10 +70,12 @@ typedef uint8_t lv_chart_axis_t;
  * Descriptor a chart series
  */
 typedef struct {
-    lv_coord_t * x_points;
-    lv_coord_t * y_points;
+    lv_coord_t * x_points;      /**< On `LV_CHART_TYPE_STREAM` the minimum of each point*/
+    lv_coord_t * y_points;      /**< On `LV_CHART_TYPE_STREAM` the maximum of each point*/
     lv_color_t color;
-    uint16_t start_point;
+    uint16_t start_point;       /**< On `LV_CHART_TYPE_STREAM` the point being filled*/
+    uint16_t stream_sample_cnt; /**< Samples already in the point being filled*/
+    lv_coord_t stream_last;     /**< The last sample, the next point starts from it*/
     uint8_t hidden : 1;
     uint8_t x_ext_buf_assigned : 1;
     uint8_t y_ext_buf_assigned : 1;
@@ -113,6 +116,8 @@ typedef struct {
     uint16_t point_cnt;    /**< Point number in a data line*/
     uint16_t zoom_x;
     uint16_t zoom_y;
+    uint16_t stream_samples; /**< Samples per point on `LV_CHART_TYPE_STREAM`*/
+    uint16_t stream_gap;     /**< Empty points ahead of the newest one on `LV_CHART_TYPE_STREAM`*/
     lv_chart_type_t type  : 3; /**< Line or column chart*/
     lv_chart_update_mode_t update_mode : 1;
 } lv_chart_t;
@@ -173,6 +178,15 @@ void lv_chart_set_range(lv_obj_t * obj, lv_chart_axis_t axis, lv_coord_t min, lv
  */
 void lv_chart_set_update_mode(lv_obj_t * obj, lv_chart_update_mode_t update_mode);
 
+/**
+ * Set how `LV_CHART_TYPE_STREAM` decimates and sweeps the samples.
+ * Set the point count to the width of the chart to get one point per pixel column.
+ * @param obj               pointer to a chart object
+ * @param samples_per_point number of samples whose min. and max. make one point (1 by default)
+ * @param gap               number of points cleared ahead of the newest one (4 by default)
+ */
+void lv_chart_set_stream(lv_obj_t * obj, uint16_t samples_per_point, uint16_t gap);
+
 /**
  * Set the number of horizontal and vertical division lines
  * @param obj       pointer to a chart object
@@ -373,6 +387,17 @@ void lv_chart_set_all_value(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t
  */
 void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t value);
 
+/**
+ * Add a block of values, e.g. the samples read from a ring buffer since the last frame.
+ * On `LV_CHART_TYPE_STREAM` only the points the values went into and the gap ahead of them are redrawn,
+ * on the other types it is the same as calling `lv_chart_set_next_value` for each value.
+ * @param obj       pointer to chart object
+ * @param ser       pointer to a data series on 'chart'
+ * @param values    the new values, `LV_CHART_POINT_NONE` leaves a hole in a stream
+ * @param cnt       number of values
+ */
+void lv_chart_set_next_values(lv_obj_t * obj, lv_chart_series_t * ser, const lv_coord_t values[], uint32_t cnt);
+
 /**
  * Set the next point's X and Y value according to the update mode policy.
  * @param obj       pointer to chart object
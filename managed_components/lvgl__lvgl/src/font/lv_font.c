@@ -11,6 +11,8 @@
 #include "../misc/lv_utils.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_assert.h"
+#include "../misc/lv_mem.h"
+#include "../misc/lv_color.h"
 
 /*********************
  *      DEFINES
@@ -23,6 +25,7 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static uint32_t rle_same_len(const uint8_t * src, uint32_t len);
 
 /**********************
  *  STATIC VARIABLES
@@ -141,6 +144,58 @@ uint16_t lv_font_get_glyph_width(const lv_font_t * font, uint32_t letter, uint32
     return g.adv_w;
 }
 
+uint32_t lv_font_rle_a8_encode(uint8_t * dest, const uint8_t * src, uint32_t w, uint32_t h)
+{
+    LV_ASSERT_NULL(src);
+
+    uint32_t size = 0;
+    uint32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * row = src + y * w;
+        uint32_t x = 0;
+        while(x < w) {
+            uint32_t len = rle_same_len(&row[x], w - x);
+            if(len >= 2 && (row[x] == LV_OPA_TRANSP || row[x] == LV_OPA_COVER)) {
+                if(len > LV_FONT_RLE_LEN_MAX) len = LV_FONT_RLE_LEN_MAX;
+                if(dest) dest[size] = (row[x] == LV_OPA_COVER ? LV_FONT_RLE_COVER : LV_FONT_RLE_TRANSP) | (len - 1);
+                size++;
+                x += len;
+                continue;
+            }
+
+            /*Collect the pixels until the next transparent or cover run*/
+            len = 1;
+            while(x + len < w && len < LV_FONT_RLE_LEN_MAX) {
+                const uint8_t * px = &row[x + len];
+                if((*px == LV_OPA_TRANSP || *px == LV_OPA_COVER) && rle_same_len(px, w - x - len) >= 2) break;
+                len++;
+            }
+
+            if(dest) {
+                dest[size] = LV_FONT_RLE_LITERAL | (len - 1);
+                lv_memcpy_small(&dest[size + 1], &row[x], len);
+            }
+            size += len + 1;
+            x += len;
+        }
+    }
+
+    return size;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+/**
+ * Count how many pixels have the same value as the first one
+ * @param src       pointer to the first pixel
+ * @param len       number of pixels to check at most
+ * @return          length of the run
+ */
+static uint32_t rle_same_len(const uint8_t * src, uint32_t len)
+{
+    uint32_t i;
+    for(i = 1; i < len && src[i] == src[0]; i++);
+    return i;
+}
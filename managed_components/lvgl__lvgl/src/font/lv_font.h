@@ -28,6 +28,19 @@ extern "C" {
 /* imgfont identifier */
 #define LV_IMGFONT_BPP 9
 
+/**
+ * Run-length encoded 8 bpp glyph identifier. Only the software renderer can draw such glyphs.
+ * Every row of the bitmap is a list of runs and a run never continues in the next row.
+ * A run starts with a header byte: the upper 2 bits are the type and the lower 6 bits are the length - 1.
+ */
+#define LV_FONT_RLE_A8_BPP      10
+
+#define LV_FONT_RLE_TRANSP      0x00    /**< `length` pixels with 0 opacity*/
+#define LV_FONT_RLE_COVER       0x40    /**< `length` pixels with 255 opacity*/
+#define LV_FONT_RLE_LITERAL     0x80    /**< `length` opacity bytes follow the header*/
+#define LV_FONT_RLE_TYPE_MASK   0xC0
+#define LV_FONT_RLE_LEN_MAX     64
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -116,6 +129,16 @@ bool lv_font_get_glyph_dsc(const lv_font_t * font_p, lv_font_glyph_dsc_t * dsc_o
  */
 uint16_t lv_font_get_glyph_width(const lv_font_t * font, uint32_t letter, uint32_t letter_next);
 
+/**
+ * Run-length encode an 8 bpp glyph bitmap into the `LV_FONT_RLE_A8_BPP` format
+ * @param dest      store the encoded bitmap here. NULL to get only the required size
+ * @param src       the 8 bpp bitmap
+ * @param w         width of the bitmap
+ * @param h         height of the bitmap
+ * @return          size of the encoded bitmap in bytes
+ */
+uint32_t lv_font_rle_a8_encode(uint8_t * dest, const uint8_t * src, uint32_t w, uint32_t h);
+
 /**
  * Get the line height of a font. All characters fit into this height
  * @param font_p pointer to a font
@@ -32,6 +32,10 @@ typedef enum {
  *  STATIC PROTOTYPES
  **********************/
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static uint32_t find_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+#if LV_USE_FONT_LATIN1_CACHE
+static void build_latin1_cache(const lv_font_t * font);
+#endif
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
 static int32_t unicode_list_compare(const void * ref, const void * element);
 static int32_t kern_pair_8_compare(const void * ref, const void * element);
@@ -212,9 +216,63 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
+#if LV_USE_FONT_LATIN1_CACHE
+    /*Simply index the table of the first 256 letters*/
+    if(letter < 256 && fdsc->cache) {
+        if(fdsc->cache->latin1_state == 0) build_latin1_cache(font);
+        if(fdsc->cache->latin1_state == 1) return fdsc->cache->latin1_glyph_id[letter];
+    }
+#endif
+
     /*Check the cache first*/
     if(fdsc->cache && letter == fdsc->cache->last_letter) return fdsc->cache->last_glyph_id;
 
+    uint32_t glyph_id = find_glyph_dsc_id(font, letter);
+
+    /*Update the cache*/
+    if(fdsc->cache) {
+        fdsc->cache->last_letter = letter;
+        fdsc->cache->last_glyph_id = glyph_id;
+    }
+
+    return glyph_id;
+}
+
+#if LV_USE_FONT_LATIN1_CACHE
+/**
+ * Look up the glyph id of the letters 0..255 and store them in the cache of the font
+ * @param font      pointer to a font with a glyph cache
+ */
+static void build_latin1_cache(const lv_font_t * font)
+{
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    lv_font_fmt_txt_glyph_cache_t * cache = fdsc->cache;
+
+    cache->latin1_glyph_id[0] = 0;
+    uint32_t letter;
+    for(letter = 1; letter < 256; letter++) {
+        uint32_t glyph_id = find_glyph_dsc_id(font, letter);
+        if(glyph_id > UINT16_MAX) {
+            cache->latin1_state = 2;
+            return;
+        }
+        cache->latin1_glyph_id[letter] = (uint16_t)glyph_id;
+    }
+
+    cache->latin1_state = 1;
+}
+#endif
+
+/**
+ * Find the glyph id of a letter in the character maps of a font
+ * @param font      pointer to a font
+ * @param letter    a UNICODE letter
+ * @return          the glyph id or 0 if the font doesn't contain the letter
+ */
+static uint32_t find_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
+{
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+
     uint16_t i;
     for(i = 0; i < fdsc->cmap_num; i++) {
 
@@ -251,20 +309,10 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
             }
         }
 
-        /*Update the cache*/
-        if(fdsc->cache) {
-            fdsc->cache->last_letter = letter;
-            fdsc->cache->last_glyph_id = glyph_id;
-        }
         return glyph_id;
     }
 
-    if(fdsc->cache) {
-        fdsc->cache->last_letter = letter;
-        fdsc->cache->last_glyph_id = 0;
-    }
     return 0;
-
 }
 
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right)
@@ -154,6 +154,10 @@ typedef enum {
 typedef struct {
     uint32_t last_letter;
     uint32_t last_glyph_id;
+#if LV_USE_FONT_LATIN1_CACHE
+    uint16_t latin1_glyph_id[256];  /*Glyph id of the letters 0..255*/
+    uint8_t latin1_state;           /*0: not built yet, 1: built, 2: can't be used (too large glyph ids)*/
+#endif
 } lv_font_fmt_txt_glyph_cache_t;
 
 /*Describe store additional data for fonts*/
@@ -157,6 +157,17 @@
         #endif
     #endif
 
+    /*Memory reserved from `LV_MEM_SIZE` for slab pools which serve the small (<= 128 bytes) allocations in bytes (0: disable).
+     *Allocating from them is faster and the many small, short lived objects don't fragment the heap.
+     *The memory is reserved even if the blocks are not used, so enable it only if it helps, e.g. 8 * 1024 on a 64 kB heap*/
+    #ifndef LV_MEM_SLAB_SIZE
+        #ifdef CONFIG_LV_MEM_SLAB_SIZE
+            #define LV_MEM_SLAB_SIZE CONFIG_LV_MEM_SLAB_SIZE
+        #else
+            #define LV_MEM_SLAB_SIZE 0
+        #endif
+    #endif
+
 #else       /*LV_MEM_CUSTOM*/
     #ifndef LV_MEM_CUSTOM_INCLUDE
         #ifdef CONFIG_LV_MEM_CUSTOM_INCLUDE
@@ -293,7 +304,7 @@
 
     /*Allow buffering some shadow calculation.
     *LV_SHADOW_CACHE_SIZE is the max. shadow size to buffer, where shadow size is `shadow_width + radius`
-    *Caching has LV_SHADOW_CACHE_SIZE^2 RAM cost*/
+    *The cached corners use at most LV_SHADOW_CACHE_SIZE^2 bytes of the heap by default*/
     #ifndef LV_SHADOW_CACHE_SIZE
         #ifdef CONFIG_LV_SHADOW_CACHE_SIZE
             #define LV_SHADOW_CACHE_SIZE CONFIG_LV_SHADOW_CACHE_SIZE
@@ -302,6 +313,15 @@
         #endif
     #endif
 
+    /*Number of shadow corners to cache. The least recently used one is dropped first*/
+    #ifndef LV_SHADOW_CACHE_CNT
+        #ifdef CONFIG_LV_SHADOW_CACHE_CNT
+            #define LV_SHADOW_CACHE_CNT CONFIG_LV_SHADOW_CACHE_CNT
+        #else
+            #define LV_SHADOW_CACHE_CNT 4
+        #endif
+    #endif
+
     /* Set number of maximally cached circle data.
     * The circumference of 1/4 circle are saved for anti-aliasing
     * radius * 4 bytes are used per circle (the most often used radiuses are saved)
@@ -313,6 +333,16 @@
             #define LV_CIRCLE_CACHE_SIZE 4
         #endif
     #endif
+
+    /*Bytes of circle data to keep between refreshes (the most used circles are kept)
+     *0: free them after every refresh*/
+    #ifndef LV_CIRCLE_CACHE_BUDGET
+        #ifdef CONFIG_LV_CIRCLE_CACHE_BUDGET
+            #define LV_CIRCLE_CACHE_BUDGET CONFIG_LV_CIRCLE_CACHE_BUDGET
+        #else
+            #define LV_CIRCLE_CACHE_BUDGET 4096
+        #endif
+    #endif
 #endif /*LV_DRAW_COMPLEX*/
 
 /**
@@ -343,6 +373,17 @@
     #endif
 #endif
 
+/*1: Cache the rendering of the objects with `LV_OBJ_FLAG_STATIC_LAYER`.
+ *They are rendered once with their children into a buffer of their size (from LVGL's heap)
+ *and only this buffer is copied until the object or its children change.*/
+#ifndef LV_USE_STATIC_LAYER
+    #ifdef CONFIG_LV_USE_STATIC_LAYER
+        #define LV_USE_STATIC_LAYER CONFIG_LV_USE_STATIC_LAYER
+    #else
+        #define LV_USE_STATIC_LAYER 0
+    #endif
+#endif
+
 /*Default image cache size. Image caching keeps the images opened.
  *If only the built-in image formats are used there is no real advantage of caching. (I.e. if no new image decoder is added)
  *With complex image decoders (e.g. PNG or JPG) caching can save the continuous open/decode of images.
@@ -356,6 +397,17 @@
     #endif
 #endif
 
+/*Max. number of bytes the decoded images can use in the image cache.
+ *If it's exceeded the images which were used long ago and are fast to open are closed first.
+ *0: no limit, only the number of entries matters*/
+#ifndef LV_IMG_CACHE_DEF_BUDGET
+    #ifdef CONFIG_LV_IMG_CACHE_DEF_BUDGET
+        #define LV_IMG_CACHE_DEF_BUDGET CONFIG_LV_IMG_CACHE_DEF_BUDGET
+    #else
+        #define LV_IMG_CACHE_DEF_BUDGET 0
+    #endif
+#endif
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -412,6 +464,20 @@
     #endif
 #endif
 
+/*Use SIMD (SSE2 or NEON) kernels for the most common RGB565 blend operations if the compiler targets such a CPU.
+ *The plain C kernels are used otherwise. Both give the same result as `lv_color_mix()`*/
+#ifndef LV_USE_DRAW_SW_SIMD
+    #ifdef _LV_KCONFIG_PRESENT
+        #ifdef CONFIG_LV_USE_DRAW_SW_SIMD
+            #define LV_USE_DRAW_SW_SIMD CONFIG_LV_USE_DRAW_SW_SIMD
+        #else
+            #define LV_USE_DRAW_SW_SIMD 0
+        #endif
+    #else
+        #define LV_USE_DRAW_SW_SIMD 1
+    #endif
+#endif
+
 /*-------------
  * GPU
  *-----------*/
@@ -1261,6 +1327,16 @@
     #endif
 #endif
 
+/*Look up the ASCII and Latin-1 letters (0..255) in a table built on first use to measure and draw texts faster.
+ *Needs 512 bytes per built-in font and about 3 kB per Tiny TTF font.*/
+#ifndef LV_USE_FONT_LATIN1_CACHE
+    #ifdef CONFIG_LV_USE_FONT_LATIN1_CACHE
+        #define LV_USE_FONT_LATIN1_CACHE CONFIG_LV_USE_FONT_LATIN1_CACHE
+    #else
+        #define LV_USE_FONT_LATIN1_CACHE 0
+    #endif
+#endif
+
 /*=================
  *  TEXT SETTINGS
  *=================*/
@@ -1497,6 +1573,17 @@
             #define LV_LABEL_LONG_TXT_HINT 1  /*Store some extra info in labels to speed up drawing of very long texts*/
         #endif
     #endif
+    #ifndef LV_LABEL_LINE_CACHE
+        #ifdef _LV_KCONFIG_PRESENT
+            #ifdef CONFIG_LV_LABEL_LINE_CACHE
+                #define LV_LABEL_LINE_CACHE CONFIG_LV_LABEL_LINE_CACHE
+            #else
+                #define LV_LABEL_LINE_CACHE 0
+            #endif
+        #else
+            #define LV_LABEL_LINE_CACHE 0     /*Store the start and width of the lines of labels to not break the text on every draw*/
+        #endif
+    #endif
 #endif
 
 #ifndef LV_USE_LINE
@@ -2305,6 +2392,15 @@
     #endif
 #endif
 
+/*1: Enable a pool which keeps built screens to switch between them without deleting and recreating them*/
+#ifndef LV_USE_SCR_POOL
+    #ifdef CONFIG_LV_USE_SCR_POOL
+        #define LV_USE_SCR_POOL CONFIG_LV_USE_SCR_POOL
+    #else
+        #define LV_USE_SCR_POOL 0
+    #endif
+#endif
+
 /*1: Support using images as font in label or span widgets */
 #ifndef LV_USE_IMGFONT
     #ifdef CONFIG_LV_USE_IMGFONT
@@ -2322,6 +2418,26 @@
         #define LV_USE_MSG 0
     #endif
 #endif
+#if LV_USE_MSG
+    /*Number of different message IDs which can be posted from other threads or interrupts with `lv_msg_post()`.
+     *Requires C11 atomics. 0: disable `lv_msg_post()`*/
+    #ifndef LV_MSG_POST_SLOT_CNT
+        #ifdef CONFIG_LV_MSG_POST_SLOT_CNT
+            #define LV_MSG_POST_SLOT_CNT CONFIG_LV_MSG_POST_SLOT_CNT
+        #else
+            #define LV_MSG_POST_SLOT_CNT 16
+        #endif
+    #endif
+
+    /*Max. size of the payload of a posted message in bytes*/
+    #ifndef LV_MSG_POST_PAYLOAD_SIZE
+        #ifdef CONFIG_LV_MSG_POST_PAYLOAD_SIZE
+            #define LV_MSG_POST_PAYLOAD_SIZE CONFIG_LV_MSG_POST_PAYLOAD_SIZE
+        #else
+            #define LV_MSG_POST_PAYLOAD_SIZE 16
+        #endif
+    #endif
+#endif
 
 /*1: Enable Pinyin input method*/
 /*Requires: lv_keyboard*/
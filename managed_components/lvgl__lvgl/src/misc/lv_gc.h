@@ -21,6 +21,7 @@ extern "C" {
 #include "lv_types.h"
 #include "../draw/lv_img_cache.h"
 #include "../draw/lv_draw_mask.h"
+#include "../draw/sw/lv_draw_sw.h"
 #include "../core/lv_obj_pos.h"
 
 /*********************
@@ -32,6 +33,12 @@ extern "C" {
 #    define LV_IMG_CACHE_DEF            0
 #endif
 
+#if LV_DRAW_COMPLEX && defined(LV_SHADOW_CACHE_SIZE) && LV_SHADOW_CACHE_SIZE > 0
+#    define LV_SHADOW_CACHE_DEF         1
+#else
+#    define LV_SHADOW_CACHE_DEF         0
+#endif
+
 #define LV_DISPATCH(f, t, n)            f(t, n)
 #define LV_DISPATCH_COND(f, t, n, m, v) LV_CONCAT3(LV_DISPATCH, m, v)(f, t, n)
 
@@ -56,10 +63,11 @@ extern "C" {
     LV_DISPATCH(f, lv_mem_buf_arr_t , lv_mem_buf)                                                      \
     LV_DISPATCH_COND(f, _lv_draw_mask_radius_circle_dsc_arr_t , _lv_circle_cache, LV_DRAW_COMPLEX, 1)  \
     LV_DISPATCH_COND(f, _lv_draw_mask_saved_arr_t , _lv_draw_mask_list, LV_DRAW_COMPLEX, 1)            \
+    LV_DISPATCH_COND(f, _lv_draw_sw_shadow_cache_arr_t, _lv_shadow_cache, LV_SHADOW_CACHE_DEF, 1)      \
     LV_DISPATCH(f, void * , _lv_theme_default_styles)                                                  \
     LV_DISPATCH(f, void * , _lv_theme_basic_styles)                                                  \
     LV_DISPATCH_COND(f, uint8_t *, _lv_font_decompr_buf, LV_USE_FONT_COMPRESSED, 1)                    \
-    LV_DISPATCH(f, uint8_t * , _lv_grad_cache_mem)                                                     \
+    LV_DISPATCH(f, _lv_grad_cache_t, _lv_grad_cache)                                                   \
     LV_DISPATCH(f, uint8_t * , _lv_style_custom_prop_flag_lookup_table)
 
 #define LV_DEFINE_ROOT(root_type, root_name) root_type root_name;
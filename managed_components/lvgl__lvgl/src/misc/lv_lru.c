@@ -14,21 +14,32 @@
 #include "lv_assert.h"
 #include "lv_log.h"
 
+#include <stdbool.h>
+
 /*********************
  *      DEFINES
  *********************/
 
+#define LV_LRU_NONE             UINT32_MAX
+#define LV_LRU_KEY_INLINE_SIZE  16
+#define LV_LRU_ITEM_CNT_MIN     8
+
 /**********************
  *      TYPEDEFS
  **********************/
 
 struct _lv_lru_item_t {
     void * value;
-    void * key;
+    union {
+        void * ptr;
+        uint8_t buf[LV_LRU_KEY_INLINE_SIZE];
+    } key;
     size_t value_length;
-    size_t key_length;
-    uint64_t access_count;
-    struct _lv_lru_item_t * next;
+    uint32_t key_length;
+    uint32_t hash;
+    uint32_t newer;     /*Towards the most recently used item*/
+    uint32_t older;     /*Towards the least recently used item or the next free item*/
+    bool key_inline;    /*The key is stored in `key.buf` instead of a separate allocation*/
 };
 
 /**********************
@@ -42,14 +53,26 @@ struct _lv_lru_item_t {
  */
 static uint32_t lv_lru_hash(lv_lru_t * cache, const void * key, uint32_t key_length);
 
-/** compare a key against an existing item's key */
-static int lv_lru_cmp_keys(lv_lru_item_t * item, const void * key, uint32_t key_length);
+/** find the table slot of a key or the empty slot where it should be inserted */
+static uint32_t lv_lru_find_slot(lv_lru_t * cache, const void * key, uint32_t key_length, uint32_t hash);
+
+/** find the table slot of an existing item */
+static uint32_t lv_lru_find_item_slot(lv_lru_t * cache, uint32_t id);
+
+/** remove the item of a table slot and push it to the free items */
+static void lv_lru_remove_item(lv_lru_t * cache, uint32_t slot);
 
-/** remove an item and push it to the free items queue */
-static void lv_lru_remove_item(lv_lru_t * cache, lv_lru_item_t * prev, lv_lru_item_t * item, uint32_t hash_index);
+/** pop an item from the free items, make the pool larger if there are no free items */
+static uint32_t lv_lru_pop_item(lv_lru_t * cache);
 
-/** pop an existing item off the free queue, or create a new one */
-static lv_lru_item_t * lv_lru_pop_or_create_item(lv_lru_t * cache);
+/** double the size of the item pool and the hash table */
+static bool lv_lru_grow(lv_lru_t * cache);
+
+/** unlink an item from the recency list */
+static void lv_lru_unlink(lv_lru_t * cache, uint32_t id);
+
+/** add an item as the most recently used one */
+static void lv_lru_push_mru(lv_lru_t * cache, uint32_t id);
 
 /**********************
  *  STATIC VARIABLES
@@ -66,6 +89,8 @@ static lv_lru_item_t * lv_lru_pop_or_create_item(lv_lru_t * cache);
 #define test_for_missing_value()      error_for(!value || value_length == 0, LV_LRU_MISSING_VALUE)
 #define test_for_value_too_large()    error_for(value_length > cache->total_memory, LV_LRU_VALUE_TOO_LARGE)
 
+#define item_key(item) ((item)->key_inline ? (void *)(item)->key.buf : (item)->key.ptr)
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -75,24 +100,28 @@ lv_lru_t * lv_lru_create(size_t cache_size, size_t average_length, lv_lru_free_t
 {
     // create the cache
     lv_lru_t * cache = (lv_lru_t *) lv_mem_alloc(sizeof(lv_lru_t));
-    lv_memset_00(cache, sizeof(lv_lru_t));
     if(!cache) {
         LV_LOG_WARN("LRU Cache unable to create cache object");
         return NULL;
     }
-    cache->hash_table_size = cache_size / average_length;
+    lv_memset_00(cache, sizeof(lv_lru_t));
     cache->average_item_length = average_length;
     cache->free_memory = cache_size;
     cache->total_memory = cache_size;
     cache->seed = lv_rand(1, UINT32_MAX);
     cache->value_free = value_free ? value_free : lv_mem_free;
     cache->key_free = key_free ? key_free : lv_mem_free;
-
-    // size the hash table to a guestimate of the number of slots required (assuming a perfect hash)
-    cache->items = (lv_lru_item_t **) lv_mem_alloc(sizeof(lv_lru_item_t *) * cache->hash_table_size);
-    lv_memset_00(cache->items, sizeof(lv_lru_item_t *) * cache->hash_table_size);
-    if(!cache->items) {
+    cache->free_items = LV_LRU_NONE;
+    cache->mru = LV_LRU_NONE;
+    cache->lru = LV_LRU_NONE;
+
+    // size the pool to a guestimate of the number of items, it grows if more are needed
+    uint32_t item_cnt = average_length ? cache_size / average_length : 0;
+    if(item_cnt < LV_LRU_ITEM_CNT_MIN) item_cnt = LV_LRU_ITEM_CNT_MIN;
+    cache->item_cnt = item_cnt / 2;
+    if(!lv_lru_grow(cache)) {
         LV_LOG_WARN("LRU Cache unable to create cache hash table");
+        lv_mem_free(cache->items);
         lv_mem_free(cache);
         return NULL;
     }
@@ -103,32 +132,17 @@ void lv_lru_del(lv_lru_t * cache)
 {
     LV_ASSERT_NULL(cache);
 
-    // free each of the cached items, and the hash table
-    lv_lru_item_t * item = NULL, * next = NULL;
-    uint32_t i = 0;
-    if(cache->items) {
-        for(; i < cache->hash_table_size; i++) {
-            item = cache->items[i];
-            while(item) {
-                next = (lv_lru_item_t *) item->next;
-                cache->value_free(item->value);
-                cache->key_free(item->key);
-                cache->free_memory += item->value_length;
-                lv_mem_free(item);
-                item = next;
-            }
-        }
-        lv_mem_free(cache->items);
+    // free each of the cached items, the pool and the hash table
+    uint32_t id = cache->mru;
+    while(id != LV_LRU_NONE) {
+        lv_lru_item_t * item = &cache->items[id];
+        cache->value_free(item->value);
+        if(!item->key_inline) cache->key_free(item->key.ptr);
+        id = item->older;
     }
 
-    if(cache->free_items) {
-        item = cache->free_items;
-        while(item) {
-            next = (lv_lru_item_t *) item->next;
-            lv_mem_free(item);
-            item = next;
-        }
-    }
+    lv_mem_free(cache->items);
+    lv_mem_free(cache->table);
 
     // free the cache
     lv_mem_free(cache);
@@ -142,45 +156,56 @@ lv_lru_res_t lv_lru_set(lv_lru_t * cache, const void * key, size_t key_length, v
     test_for_value_too_large();
 
     // see if the key already exists
-    uint32_t hash_index = lv_lru_hash(cache, key, key_length);
-    int required = 0;
-    lv_lru_item_t * item = NULL, * prev = NULL;
-    item = cache->items[hash_index];
-
-    while(item && lv_lru_cmp_keys(item, key, key_length)) {
-        prev = item;
-        item = (lv_lru_item_t *) item->next;
-    }
+    uint32_t hash = lv_lru_hash(cache, key, key_length);
+    uint32_t slot = lv_lru_find_slot(cache, key, key_length, hash);
+    int32_t required = 0;
+    lv_lru_item_t * item;
 
-    if(item) {
+    if(cache->table[slot] != LV_LRU_NONE) {
         // update the value and value_lengths
-        required = (int)(value_length - item->value_length);
-        cache->value_free(item->value);
+        uint32_t id = cache->table[slot];
+        item = &cache->items[id];
+        required = (int32_t)(value_length - item->value_length);
+        if(item->value != value) cache->value_free(item->value);
         item->value = value;
         item->value_length = value_length;
-
+        lv_lru_unlink(cache, id);
+        lv_lru_push_mru(cache, id);
     }
     else {
         // insert a new item
-        item = lv_lru_pop_or_create_item(cache);
+        uint32_t id = lv_lru_pop_item(cache);
+        item = &cache->items[id];
+        if(key_length <= LV_LRU_KEY_INLINE_SIZE && cache->key_free == lv_mem_free) {
+            item->key_inline = true;
+            lv_memcpy_small(item->key.buf, key, key_length);
+        }
+        else {
+            item->key_inline = false;
+            item->key.ptr = lv_mem_alloc(key_length);
+            LV_ASSERT_MALLOC(item->key.ptr);
+            if(item->key.ptr == NULL) {
+                item->older = cache->free_items;
+                cache->free_items = id;
+                return LV_LRU_MISSING_KEY;
+            }
+            lv_memcpy(item->key.ptr, key, key_length);
+        }
         item->value = value;
-        item->key = lv_mem_alloc(key_length);
-        memcpy(item->key, key, key_length);
         item->value_length = value_length;
         item->key_length = key_length;
-        required = (int) value_length;
+        item->hash = hash;
+        required = (int32_t) value_length;
 
-        if(prev)
-            prev->next = item;
-        else
-            cache->items[hash_index] = item;
+        // the table might have been changed while getting the item
+        slot = lv_lru_find_slot(cache, key, key_length, hash);
+        cache->table[slot] = id;
+        lv_lru_push_mru(cache, id);
     }
-    item->access_count = ++cache->access_count;
 
     // remove as many items as necessary to free enough space
-    if(required > 0 && (size_t) required > cache->free_memory) {
-        while(cache->free_memory < (size_t) required)
-            lv_lru_remove_lru_item(cache);
+    while(required > 0 && cache->free_memory < (size_t) required) {
+        lv_lru_remove_lru_item(cache);
     }
     cache->free_memory -= required;
     return LV_LRU_OK;
@@ -191,16 +216,15 @@ lv_lru_res_t lv_lru_get(lv_lru_t * cache, const void * key, size_t key_size, voi
     test_for_missing_cache();
     test_for_missing_key();
 
-    // loop until we find the item, or hit the end of a chain
-    uint32_t hash_index = lv_lru_hash(cache, key, key_size);
-    lv_lru_item_t * item = cache->items[hash_index];
-
-    while(item && lv_lru_cmp_keys(item, key, key_size))
-        item = (lv_lru_item_t *) item->next;
+    uint32_t hash = lv_lru_hash(cache, key, key_size);
+    uint32_t id = cache->table[lv_lru_find_slot(cache, key, key_size, hash)];
 
-    if(item) {
-        *value = item->value;
-        item->access_count = ++cache->access_count;
+    if(id != LV_LRU_NONE) {
+        *value = cache->items[id].value;
+        if(cache->mru != id) {
+            lv_lru_unlink(cache, id);
+            lv_lru_push_mru(cache, id);
+        }
     }
     else {
         *value = NULL;
@@ -214,18 +238,11 @@ lv_lru_res_t lv_lru_remove(lv_lru_t * cache, const void * key, size_t key_size)
     test_for_missing_cache();
     test_for_missing_key();
 
-    // loop until we find the item, or hit the end of a chain
-    lv_lru_item_t * item = NULL, * prev = NULL;
-    uint32_t hash_index = lv_lru_hash(cache, key, key_size);
-    item = cache->items[hash_index];
-
-    while(item && lv_lru_cmp_keys(item, key, key_size)) {
-        prev = item;
-        item = (lv_lru_item_t *) item->next;
-    }
+    uint32_t hash = lv_lru_hash(cache, key, key_size);
+    uint32_t slot = lv_lru_find_slot(cache, key, key_size, hash);
 
-    if(item) {
-        lv_lru_remove_item(cache, prev, item, hash_index);
+    if(cache->table[slot] != LV_LRU_NONE) {
+        lv_lru_remove_item(cache, slot);
     }
 
     return LV_LRU_OK;
@@ -233,30 +250,9 @@ lv_lru_res_t lv_lru_remove(lv_lru_t * cache, const void * key, size_t key_size)
 
 void lv_lru_remove_lru_item(lv_lru_t * cache)
 {
-    lv_lru_item_t * min_item = NULL, * min_prev = NULL;
-    lv_lru_item_t * item = NULL, * prev = NULL;
-    uint32_t i = 0, min_index = -1;
-    uint64_t min_access_count = -1;
-
-    for(; i < cache->hash_table_size; i++) {
-        item = cache->items[i];
-        prev = NULL;
-
-        while(item) {
-            if(item->access_count < min_access_count || (int64_t) min_access_count == -1) {
-                min_access_count = item->access_count;
-                min_item = item;
-                min_prev = prev;
-                min_index = i;
-            }
-            prev = item;
-            item = item->next;
-        }
-    }
+    if(cache->lru == LV_LRU_NONE) return;
 
-    if(min_item) {
-        lv_lru_remove_item(cache, min_prev, min_item, min_index);
-    }
+    lv_lru_remove_item(cache, lv_lru_find_item_slot(cache, cache->lru));
 }
 
 /**********************
@@ -295,52 +291,141 @@ static uint32_t lv_lru_hash(lv_lru_t * cache, const void * key, uint32_t key_len
     h ^= h >> 13;
     h *= m;
     h ^= h >> 15;
-    return h % cache->hash_table_size;
+    return h;
 }
 
-static int lv_lru_cmp_keys(lv_lru_item_t * item, const void * key, uint32_t key_length)
+static uint32_t lv_lru_find_slot(lv_lru_t * cache, const void * key, uint32_t key_length, uint32_t hash)
 {
-    if(key_length != item->key_length) {
-        return 1;
-    }
-    else {
-        return memcmp(key, item->key, key_length);
+    // linear probing, the table is at most half full so an empty slot is always found
+    uint32_t slot = hash & cache->table_mask;
+    while(1) {
+        uint32_t id = cache->table[slot];
+        if(id == LV_LRU_NONE) return slot;
+
+        lv_lru_item_t * item = &cache->items[id];
+        if(item->hash == hash && item->key_length == key_length && memcmp(item_key(item), key, key_length) == 0) {
+            return slot;
+        }
+        slot = (slot + 1) & cache->table_mask;
     }
 }
 
-static void lv_lru_remove_item(lv_lru_t * cache, lv_lru_item_t * prev, lv_lru_item_t * item, uint32_t hash_index)
+static uint32_t lv_lru_find_item_slot(lv_lru_t * cache, uint32_t id)
 {
-    if(prev) {
-        prev->next = item->next;
+    uint32_t slot = cache->items[id].hash & cache->table_mask;
+    while(cache->table[slot] != id) {
+        slot = (slot + 1) & cache->table_mask;
     }
-    else {
-        cache->items[hash_index] = (lv_lru_item_t *) item->next;
+    return slot;
+}
+
+static void lv_lru_remove_item(lv_lru_t * cache, uint32_t slot)
+{
+    uint32_t id = cache->table[slot];
+    lv_lru_item_t * item = &cache->items[id];
+
+    // close the gap in the probe sequence by moving the following items back (no tombstones are needed)
+    uint32_t mask = cache->table_mask;
+    uint32_t hole = slot;
+    uint32_t i = slot;
+    while(1) {
+        i = (i + 1) & mask;
+        uint32_t next_id = cache->table[i];
+        if(next_id == LV_LRU_NONE) break;
+
+        // the item can be moved if the hole is between its home slot and its current slot
+        uint32_t home = cache->items[next_id].hash & mask;
+        if(((i - home) & mask) >= ((i - hole) & mask)) {
+            cache->table[hole] = next_id;
+            hole = i;
+        }
     }
+    cache->table[hole] = LV_LRU_NONE;
+
+    lv_lru_unlink(cache, id);
 
     // free memory and update the free memory counter
     cache->free_memory += item->value_length;
     cache->value_free(item->value);
-    cache->key_free(item->key);
+    if(!item->key_inline) cache->key_free(item->key.ptr);
 
-    // push the item to the free items queue
-    lv_memset_00(item, sizeof(lv_lru_item_t));
-    item->next = cache->free_items;
-    cache->free_items = item;
+    // push the item to the free items
+    item->older = cache->free_items;
+    cache->free_items = id;
 }
 
-static lv_lru_item_t * lv_lru_pop_or_create_item(lv_lru_t * cache)
+static uint32_t lv_lru_pop_item(lv_lru_t * cache)
 {
-    lv_lru_item_t * item = NULL;
+    if(cache->free_items == LV_LRU_NONE && !lv_lru_grow(cache)) {
+        // out of memory: reuse the least recently used item
+        LV_LOG_WARN("LRU Cache unable to grow, evicting an item");
+        lv_lru_remove_lru_item(cache);
+    }
+
+    uint32_t id = cache->free_items;
+    cache->free_items = cache->items[id].older;
+    return id;
+}
 
-    if(cache->free_items) {
-        item = cache->free_items;
-        cache->free_items = item->next;
-        lv_memset_00(item, sizeof(lv_lru_item_t));
+static bool lv_lru_grow(lv_lru_t * cache)
+{
+    uint32_t old_cnt = cache->item_cnt;
+    uint32_t new_cnt = old_cnt * 2;
+
+    lv_lru_item_t * items = lv_mem_realloc(cache->items, sizeof(lv_lru_item_t) * new_cnt);
+    if(!items) return false;
+    cache->items = items;
+
+    // keep the table at most half full
+    uint32_t table_size = cache->table ? cache->table_mask + 1 : 0;
+    if(table_size < new_cnt * 2) {
+        uint32_t new_table_size = 1;
+        while(new_table_size < new_cnt * 2) new_table_size <<= 1;
+
+        uint32_t * table = lv_mem_alloc(sizeof(uint32_t) * new_table_size);
+        if(!table) return false;
+
+        lv_memset_ff(table, sizeof(uint32_t) * new_table_size);
+        lv_mem_free(cache->table);
+        cache->table = table;
+        cache->table_mask = new_table_size - 1;
+
+        // rehash the cached items
+        uint32_t id = cache->mru;
+        while(id != LV_LRU_NONE) {
+            uint32_t slot = cache->items[id].hash & cache->table_mask;
+            while(table[slot] != LV_LRU_NONE) slot = (slot + 1) & cache->table_mask;
+            table[slot] = id;
+            id = cache->items[id].older;
+        }
     }
-    else {
-        item = (lv_lru_item_t *) lv_mem_alloc(sizeof(lv_lru_item_t));
-        lv_memset_00(item, sizeof(lv_lru_item_t));
+
+    // add the new items to the free items
+    uint32_t i;
+    for(i = old_cnt; i < new_cnt; i++) {
+        cache->items[i].older = i + 1 < new_cnt ? i + 1 : cache->free_items;
     }
+    cache->free_items = old_cnt;
+    cache->item_cnt = new_cnt;
+    return true;
+}
+
+static void lv_lru_unlink(lv_lru_t * cache, uint32_t id)
+{
+    lv_lru_item_t * item = &cache->items[id];
+    if(item->newer != LV_LRU_NONE) cache->items[item->newer].older = item->older;
+    else cache->mru = item->older;
 
-    return item;
+    if(item->older != LV_LRU_NONE) cache->items[item->older].newer = item->newer;
+    else cache->lru = item->newer;
+}
+
+static void lv_lru_push_mru(lv_lru_t * cache, uint32_t id)
+{
+    lv_lru_item_t * item = &cache->items[id];
+    item->newer = LV_LRU_NONE;
+    item->older = cache->mru;
+    if(cache->mru != LV_LRU_NONE) cache->items[cache->mru].newer = id;
+    else cache->lru = id;
+    cache->mru = id;
 }
@@ -42,16 +42,19 @@ typedef void (lv_lru_free_t)(void * v);
 typedef struct _lv_lru_item_t lv_lru_item_t;
 
 typedef struct lv_lru_t {
-    lv_lru_item_t ** items;
-    uint64_t access_count;
+    lv_lru_item_t * items;      /**< Pool of the items. Items refer to each other by index*/
+    uint32_t * table;           /**< Open addressing hash table with item indices*/
+    uint32_t table_mask;        /**< Table size - 1. The size is a power of 2*/
+    uint32_t item_cnt;          /**< Number of items in the pool*/
+    uint32_t free_items;        /**< First unused item of the pool*/
+    uint32_t mru;               /**< Most recently used item*/
+    uint32_t lru;               /**< Least recently used item*/
     size_t free_memory;
     size_t total_memory;
     size_t average_item_length;
-    size_t hash_table_size;
     uint32_t seed;
     lv_lru_free_t * value_free;
     lv_lru_free_t * key_free;
-    lv_lru_item_t * free_items;
 } lv_lru_t;
 
 /**********************
@@ -71,8 +74,6 @@ lv_lru_res_t lv_lru_remove(lv_lru_t * cache, const void * key, size_t key_size);
 
 /**
  * remove the least recently used item
- *
- * @todo we can optimise this by finding the n lru items, where n = required_space / average_length
  */
 void lv_lru_remove_lru_item(lv_lru_t * cache);
 /**********************
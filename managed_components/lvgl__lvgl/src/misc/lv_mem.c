@@ -39,9 +39,38 @@
 
 #define ZERO_MEM_SENTINEL  0xa1b2c3d4
 
+#ifdef LV_MEM_SLAB_CLASS_CNT
+    #define SLAB_PAGE_SIZE      256
+    #define SLAB_PAGE_CNT       (LV_MEM_SLAB_SIZE / SLAB_PAGE_SIZE)
+    #define SLAB_BLOCK_SIZE_MAX 128
+    #define SLAB_NONE           0xFFFF
+
+    #if SLAB_PAGE_CNT == 0 || SLAB_PAGE_CNT >= SLAB_NONE
+        #error "LV_MEM_SLAB_SIZE should be 0 or at least 256 bytes"
+    #endif
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
+#ifdef LV_MEM_SLAB_CLASS_CNT
+typedef struct {
+    void * free_list;       /*Freed blocks of the page. The first bytes of a free block point to the next one*/
+    uint16_t init_cnt;      /*Number of blocks used at least once. The others are allocated in order*/
+    uint16_t used_cnt;
+    uint16_t prev;          /*Previous page with free blocks in the same pool*/
+    uint16_t next;          /*Next page with free blocks in the same pool or the next unused page*/
+    uint8_t class_id;
+} slab_page_t;
+
+typedef struct {
+    uint16_t partial;       /*First page with free blocks*/
+    uint16_t page_cnt;
+    uint32_t used_cnt;
+    uint32_t max_used_cnt;
+    uint32_t fallback_cnt;
+} slab_class_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -49,6 +78,15 @@
 #if LV_MEM_CUSTOM == 0
     static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
 #endif
+#ifdef LV_MEM_SLAB_CLASS_CNT
+    static void slab_init(void);
+    static void * slab_alloc(size_t size);
+    static uint32_t slab_free(void * p);
+    static uint32_t slab_get_block_size(const void * p);
+    static void slab_monitor(lv_mem_monitor_t * mon_p);
+    static void slab_partial_remove(slab_class_t * cls, uint16_t page_id);
+    static void slab_partial_add(slab_class_t * cls, uint16_t page_id);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -61,6 +99,15 @@
 
 static uint32_t zero_mem = ZERO_MEM_SENTINEL; /*Give the address of this variable if 0 byte should be allocated*/
 
+#ifdef LV_MEM_SLAB_CLASS_CNT
+    static uint8_t * slab_mem;
+    static slab_page_t slab_pages[SLAB_PAGE_CNT];
+    static slab_class_t slab_classes[LV_MEM_SLAB_CLASS_CNT];
+    static uint16_t slab_free_pages;
+    static const uint16_t slab_block_sizes[LV_MEM_SLAB_CLASS_CNT] = {16, 32, 48, 64, 96, 128};
+    static const uint8_t slab_class_of[SLAB_BLOCK_SIZE_MAX / 16] = {0, 1, 2, 3, 4, 4, 5, 5}; /*Index: (size - 1) / 16*/
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -100,6 +147,10 @@ void lv_mem_init(void)
 #endif
 #endif
 
+#ifdef LV_MEM_SLAB_CLASS_CNT
+    slab_init();
+#endif
+
 #if LV_MEM_ADD_JUNK
     LV_LOG_WARN("LV_MEM_ADD_JUNK is enabled which makes LVGL much slower");
 #endif
@@ -131,7 +182,12 @@ void * lv_mem_alloc(size_t size)
     }
 
 #if LV_MEM_CUSTOM == 0
-    void * alloc = lv_tlsf_malloc(tlsf, size);
+    void * alloc = NULL;
+#ifdef LV_MEM_SLAB_CLASS_CNT
+    if(size <= SLAB_BLOCK_SIZE_MAX) alloc = slab_alloc(size);
+    if(alloc == NULL)
+#endif
+        alloc = lv_tlsf_malloc(tlsf, size);
 #else
     void * alloc = LV_MEM_CUSTOM_ALLOC(size);
 #endif
@@ -173,10 +229,19 @@ void lv_mem_free(void * data)
     if(data == NULL) return;
 
 #if LV_MEM_CUSTOM == 0
+    size_t size;
+#ifdef LV_MEM_SLAB_CLASS_CNT
+    if(slab_get_block_size(data)) {
+        size = slab_free(data);
+    }
+    else
+#endif
+    {
 #  if LV_MEM_ADD_JUNK
-    lv_memset(data, 0xbb, lv_tlsf_block_size(data));
+        lv_memset(data, 0xbb, lv_tlsf_block_size(data));
 #  endif
-    size_t size = lv_tlsf_free(tlsf, data);
+        size = lv_tlsf_free(tlsf, data);
+    }
     if(cur_used > size) cur_used -= size;
     else cur_used = 0;
 #else
@@ -202,6 +267,23 @@ void * lv_mem_realloc(void * data_p, size_t new_size)
 
     if(data_p == &zero_mem) return lv_mem_alloc(new_size);
 
+#ifdef LV_MEM_SLAB_CLASS_CNT
+    /*Slab blocks can't grow in place, move them if they are too small*/
+    uint32_t block_size = slab_get_block_size(data_p);
+    if(block_size) {
+        if(new_size <= block_size) return data_p;
+
+        void * moved_p = lv_mem_alloc(new_size);
+        if(moved_p == NULL) {
+            LV_LOG_ERROR("couldn't allocate memory");
+            return NULL;
+        }
+        lv_memcpy(moved_p, data_p, block_size);
+        lv_mem_free(data_p);
+        return moved_p;
+    }
+#endif
+
 #if LV_MEM_CUSTOM == 0
     void * new_p = lv_tlsf_realloc(tlsf, data_p, new_size);
 #else
@@ -253,7 +335,6 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
     lv_tlsf_walk_pool(lv_tlsf_get_pool(tlsf), lv_mem_walker, mon_p);
 
     mon_p->total_size = LV_MEM_SIZE;
-    mon_p->used_pct = 100 - (100U * mon_p->free_size) / mon_p->total_size;
     if(mon_p->free_size > 0) {
         mon_p->frag_pct = mon_p->free_biggest_size * 100U / mon_p->free_size;
         mon_p->frag_pct = 100 - mon_p->frag_pct;
@@ -262,6 +343,12 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
         mon_p->frag_pct = 0; /*no fragmentation if all the RAM is used*/
     }
 
+#ifdef LV_MEM_SLAB_CLASS_CNT
+    /*The fragmentation is about the heap but the free slab blocks are free memory too*/
+    slab_monitor(mon_p);
+#endif
+    mon_p->used_pct = 100 - (100U * mon_p->free_size) / mon_p->total_size;
+
     mon_p->max_used = max_used;
 
     MEM_TRACE("finished");
@@ -563,3 +650,160 @@ static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
     }
 }
 #endif
+
+#ifdef LV_MEM_SLAB_CLASS_CNT
+static void slab_init(void)
+{
+    lv_memset_00(slab_classes, sizeof(slab_classes));
+
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) slab_classes[i].partial = SLAB_NONE;
+    for(i = 0; i < SLAB_PAGE_CNT; i++) slab_pages[i].next = i + 1 < SLAB_PAGE_CNT ? i + 1 : SLAB_NONE;
+    slab_free_pages = 0;
+
+    /*The pages are taken from the heap so they are counted as a single used block there*/
+    slab_mem = lv_tlsf_malloc(tlsf, SLAB_PAGE_CNT * SLAB_PAGE_SIZE);
+    if(slab_mem == NULL) {
+        LV_LOG_WARN("couldn't allocate the slab pages, LV_MEM_SLAB_SIZE is too large");
+        slab_free_pages = SLAB_NONE;
+    }
+}
+
+static void * slab_alloc(size_t size)
+{
+    uint8_t class_id = slab_class_of[(size - 1) >> 4];
+    slab_class_t * cls = &slab_classes[class_id];
+    uint32_t block_size = slab_block_sizes[class_id];
+    uint32_t block_per_page = SLAB_PAGE_SIZE / block_size;
+
+    uint16_t page_id = cls->partial;
+    if(page_id == SLAB_NONE) {
+        /*Take an unused page*/
+        page_id = slab_free_pages;
+        if(page_id == SLAB_NONE) {
+            cls->fallback_cnt++;
+            return NULL;
+        }
+        slab_free_pages = slab_pages[page_id].next;
+
+        slab_page_t * page = &slab_pages[page_id];
+        page->free_list = NULL;
+        page->init_cnt = 0;
+        page->used_cnt = 0;
+        page->class_id = class_id;
+        slab_partial_add(cls, page_id);
+        cls->page_cnt++;
+    }
+
+    slab_page_t * page = &slab_pages[page_id];
+    void * block;
+    if(page->free_list) {
+        block = page->free_list;
+        page->free_list = *(void **)block;
+    }
+    else {
+        block = slab_mem + page_id * SLAB_PAGE_SIZE + page->init_cnt * block_size;
+        page->init_cnt++;
+    }
+    page->used_cnt++;
+
+    /*Full pages don't need to be found anymore*/
+    if(page->free_list == NULL && page->init_cnt == block_per_page) slab_partial_remove(cls, page_id);
+
+    cls->used_cnt++;
+    if(cls->used_cnt > cls->max_used_cnt) cls->max_used_cnt = cls->used_cnt;
+
+    return block;
+}
+
+static uint32_t slab_free(void * p)
+{
+    uint16_t page_id = (uint16_t)(((uint8_t *)p - slab_mem) / SLAB_PAGE_SIZE);
+    slab_page_t * page = &slab_pages[page_id];
+    slab_class_t * cls = &slab_classes[page->class_id];
+    uint32_t block_size = slab_block_sizes[page->class_id];
+    uint32_t block_per_page = SLAB_PAGE_SIZE / block_size;
+
+#if LV_MEM_ADD_JUNK
+    lv_memset(p, 0xbb, block_size);
+#endif
+
+    bool was_full = page->free_list == NULL && page->init_cnt == block_per_page;
+    *(void **)p = page->free_list;
+    page->free_list = p;
+    page->used_cnt--;
+    cls->used_cnt--;
+
+    if(page->used_cnt == 0) {
+        /*Give back the empty page so that any pool can use it*/
+        if(!was_full) slab_partial_remove(cls, page_id);
+        page->next = slab_free_pages;
+        slab_free_pages = page_id;
+        cls->page_cnt--;
+    }
+    else if(was_full) {
+        slab_partial_add(cls, page_id);
+    }
+
+    return block_size;
+}
+
+/**
+ * Get the size of a slab block
+ * @param p     pointer to an allocated memory
+ * @return      the size of the slab block or 0 if `p` is not in a slab page
+ */
+static uint32_t slab_get_block_size(const void * p)
+{
+    const uint8_t * p8 = p;
+    if(slab_mem == NULL || p8 < slab_mem || p8 >= slab_mem + SLAB_PAGE_CNT * SLAB_PAGE_SIZE) return 0;
+
+    uint32_t page_id = (p8 - slab_mem) / SLAB_PAGE_SIZE;
+    return slab_block_sizes[slab_pages[page_id].class_id];
+}
+
+static void slab_monitor(lv_mem_monitor_t * mon_p)
+{
+    if(slab_mem == NULL) return;
+
+    /*The heap walker counted the slab pages as one used block*/
+    mon_p->used_cnt--;
+
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        slab_class_t * cls = &slab_classes[i];
+        lv_mem_slab_monitor_t * slab_mon = &mon_p->slab[i];
+        slab_mon->block_size = slab_block_sizes[i];
+        slab_mon->page_cnt = cls->page_cnt;
+        slab_mon->used_cnt = cls->used_cnt;
+        slab_mon->max_used_cnt = cls->max_used_cnt;
+        slab_mon->fallback_cnt = cls->fallback_cnt;
+
+        mon_p->used_cnt += cls->used_cnt;
+        mon_p->free_size += cls->page_cnt * SLAB_PAGE_SIZE - cls->used_cnt * slab_block_sizes[i];
+    }
+
+    uint16_t page_id;
+    for(page_id = slab_free_pages; page_id != SLAB_NONE; page_id = slab_pages[page_id].next) {
+        mon_p->slab_free_page_cnt++;
+    }
+    mon_p->free_size += mon_p->slab_free_page_cnt * SLAB_PAGE_SIZE;
+}
+
+static void slab_partial_remove(slab_class_t * cls, uint16_t page_id)
+{
+    slab_page_t * page = &slab_pages[page_id];
+    if(page->prev != SLAB_NONE) slab_pages[page->prev].next = page->next;
+    else cls->partial = page->next;
+    if(page->next != SLAB_NONE) slab_pages[page->next].prev = page->prev;
+}
+
+static void slab_partial_add(slab_class_t * cls, uint16_t page_id)
+{
+    slab_page_t * page = &slab_pages[page_id];
+    page->prev = SLAB_NONE;
+    page->next = cls->partial;
+    if(cls->partial != SLAB_NONE) slab_pages[cls->partial].prev = page_id;
+    cls->partial = page_id;
+}
+#endif
@@ -25,10 +25,29 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#if LV_MEM_CUSTOM == 0
+#if LV_MEM_SLAB_SIZE > 0
+#define LV_MEM_SLAB_CLASS_CNT   6   /*Number of slab pools (block sizes)*/
+#endif
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#ifdef LV_MEM_SLAB_CLASS_CNT
+/**
+ * Slab pool information structure.
+ */
+typedef struct {
+    uint16_t block_size;    /**< Size of the blocks in the pool*/
+    uint16_t page_cnt;      /**< Number of slab pages owned by the pool*/
+    uint32_t used_cnt;      /**< Number of blocks in use*/
+    uint32_t max_used_cnt;  /**< Max number of blocks used at the same time*/
+    uint32_t fallback_cnt;  /**< Number of allocations served by the heap because the slab pages were full*/
+} lv_mem_slab_monitor_t;
+#endif
+
 /**
  * Heap information structure.
  */
@@ -41,6 +60,10 @@ typedef struct {
     uint32_t max_used; /**< Max size of Heap memory used*/
     uint8_t used_pct; /**< Percentage used*/
     uint8_t frag_pct; /**< Amount of fragmentation*/
+#ifdef LV_MEM_SLAB_CLASS_CNT
+    lv_mem_slab_monitor_t slab[LV_MEM_SLAB_CLASS_CNT]; /**< Statistics of the slab pools*/
+    uint32_t slab_free_page_cnt; /**< Slab pages not used by any pool*/
+#endif
 } lv_mem_monitor_t;
 
 typedef struct {
@@ -10,6 +10,7 @@
 #include "lv_assert.h"
 #include "lv_mem.h"
 #include "lv_ll.h"
+#include "../extra/others/msg/lv_msg.h"
 #include "lv_gc.h"
 
 /*********************
@@ -95,6 +96,11 @@ uint32_t LV_ATTRIBUTE_TIMER_HANDLER lv_timer_handler(void)
         }
     }
 
+#if LV_USE_MSG && LV_MSG_POST_SLOT_CNT > 0
+    /*Send the messages posted by other threads*/
+    _lv_msg_post_handler();
+#endif
+
     /*Run all timer from the list*/
     lv_timer_t * next;
     do {
@@ -492,6 +492,15 @@ char * _lv_txt_set_text_vfmt(const char * fmt, va_list ap)
 
 void _lv_txt_encoded_letter_next_2(const char * txt, uint32_t * letter, uint32_t * letter_next, uint32_t * ofs)
 {
+    /*ASCII letters are the same in every encoding, no need to decode them*/
+    const uint8_t * p = (const uint8_t *)&txt[*ofs];
+    if(p[0] < 0x80 && p[0] != '\0' && p[1] < 0x80) {
+        *letter = p[0];
+        *letter_next = p[1];
+        (*ofs)++;
+        return;
+    }
+
     *letter = _lv_txt_encoded_next(txt, ofs);
     *letter_next = *letter != '\0' ? _lv_txt_encoded_next(&txt[*ofs], NULL) : 0;
 }
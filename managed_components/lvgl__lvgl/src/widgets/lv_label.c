@@ -26,6 +26,7 @@
 #define LV_LABEL_DEF_SCROLL_SPEED   (lv_disp_get_dpi(lv_obj_get_disp(obj)) / 3)
 #define LV_LABEL_SCROLL_DELAY       300
 #define LV_LABEL_DOT_END_INV 0xFFFFFFFF
+#define LV_LABEL_FIXED_WIDTH_BUF_SIZE 32 /*Texts formatted on the stack in fixed width mode*/
 #define LV_LABEL_HINT_HEIGHT_LIMIT 1024 /*Enable "hint" to buffer info about labels larger than this. (Speed up drawing)*/
 
 /**********************
@@ -42,7 +43,15 @@ static void draw_main(lv_event_t * e);
 
 static void lv_label_refr_text(lv_obj_t * obj);
 static void lv_label_revert_dots(lv_obj_t * label);
+static void get_text_size(lv_obj_t * obj, lv_point_t * size_res, const lv_font_t * font, lv_coord_t letter_space,
+                          lv_coord_t line_space, lv_coord_t max_w, lv_text_flag_t flag);
+#if LV_LABEL_LINE_CACHE
+static const lv_draw_label_line_t * get_lines(lv_obj_t * obj, const lv_font_t * font, lv_coord_t letter_space,
+                                              lv_coord_t max_w, lv_text_flag_t flag);
+static void invalidate_lines(lv_obj_t * obj);
+#endif
 
+static bool set_text_same_width(lv_obj_t * obj, const char * text);
 static bool lv_label_set_dot_tmp(lv_obj_t * label, char * data, uint32_t len);
 static char * lv_label_get_dot_tmp(lv_obj_t * label);
 static void lv_label_dot_tmp_free(lv_obj_t * label);
@@ -87,6 +96,8 @@ void lv_label_set_text(lv_obj_t * obj, const char * text)
     LV_ASSERT_OBJ(obj, MY_CLASS);
     lv_label_t * label = (lv_label_t *)obj;
 
+    if(label->fixed_width && text != NULL && text != label->text && set_text_same_width(obj, text)) return;
+
     lv_obj_invalidate(obj);
 
     /*If text is NULL then just refresh with the current text*/
@@ -149,9 +160,23 @@ void lv_label_set_text_fmt(lv_obj_t * obj, const char * fmt, ...)
     LV_ASSERT_OBJ(obj, MY_CLASS);
     LV_ASSERT_NULL(fmt);
 
-    lv_obj_invalidate(obj);
     lv_label_t * label = (lv_label_t *)obj;
 
+    /*Try to format a short text on the stack to replace the current one in place*/
+    if(label->fixed_width && fmt != NULL) {
+        char buf[LV_LABEL_FIXED_WIDTH_BUF_SIZE];
+        va_list args;
+        va_start(args, fmt);
+        int len = lv_vsnprintf(buf, sizeof(buf), fmt, args);
+        va_end(args);
+        if(len >= 0 && len < (int)sizeof(buf)) {
+            lv_label_set_text(obj, buf);
+            return;
+        }
+    }
+
+    lv_obj_invalidate(obj);
+
     /*If text is NULL then refresh*/
     if(fmt == NULL) {
         lv_label_refr_text(obj);
@@ -229,6 +254,14 @@ void lv_label_set_recolor(lv_obj_t * obj, bool en)
     lv_label_refr_text(obj);
 }
 
+void lv_label_set_fixed_width(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_label_t * label = (lv_label_t *)obj;
+    label->fixed_width = en == false ? 0 : 1;
+}
+
 void lv_label_set_text_sel_start(lv_obj_t * obj, uint32_t index)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -283,6 +316,14 @@ bool lv_label_get_recolor(const lv_obj_t * obj)
     return label->recolor == 0 ? false : true;
 }
 
+bool lv_label_get_fixed_width(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_label_t * label = (lv_label_t *)obj;
+    return label->fixed_width == 0 ? false : true;
+}
+
 void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t * pos)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -706,12 +747,19 @@ static void lv_label_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     label->hint.y          = 0;
 #endif
 
+#if LV_LABEL_LINE_CACHE
+    label->lines = NULL;
+    label->line_cnt = 0;
+    label->line_font = NULL;
+#endif
+
 #if LV_LABEL_TEXT_SELECTION
     label->sel_start = LV_DRAW_LABEL_NO_TXT_SEL;
     label->sel_end   = LV_DRAW_LABEL_NO_TXT_SEL;
 #endif
     label->dot.tmp_ptr   = NULL;
     label->dot_tmp_alloc = 0;
+    label->fixed_width   = 0;
 
     lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE);
     lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
@@ -726,6 +774,9 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_label_t * label = (lv_label_t *)obj;
 
     lv_label_dot_tmp_free(obj);
+#if LV_LABEL_LINE_CACHE
+    invalidate_lines(obj);
+#endif
     if(!label->static_txt) lv_mem_free(label->text);
     label->text = NULL;
 }
@@ -771,11 +822,11 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
         if(label->recolor != 0) flag |= LV_TEXT_FLAG_RECOLOR;
         if(label->expand != 0) flag |= LV_TEXT_FLAG_EXPAND;
 
+        /*With content width break the lines only at new line characters, as when refreshing the text*/
         lv_coord_t w = lv_obj_get_content_width(obj);
-        if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) w = LV_COORD_MAX;
-        else w = lv_obj_get_content_width(obj);
+        if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) flag |= LV_TEXT_FLAG_FIT;
 
-        lv_txt_get_size(&size, label->text, font, letter_space, line_space, w, flag);
+        get_text_size(obj, &size, font, letter_space, line_space, w, flag);
 
         lv_point_t * self_size = lv_event_get_param(e);
         self_size->x = LV_MAX(self_size->x, size.x);
@@ -822,8 +873,8 @@ static void draw_main(lv_event_t * e)
     if((label->long_mode == LV_LABEL_LONG_SCROLL || label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) &&
        (label_draw_dsc.align == LV_TEXT_ALIGN_CENTER || label_draw_dsc.align == LV_TEXT_ALIGN_RIGHT)) {
         lv_point_t size;
-        lv_txt_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                        LV_COORD_MAX, flag);
+        get_text_size(obj, &size, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
+                      LV_COORD_MAX, flag);
         if(size.x > lv_area_get_width(&txt_coords)) {
             label_draw_dsc.align = LV_TEXT_ALIGN_LEFT;
         }
@@ -842,6 +893,13 @@ static void draw_main(lv_event_t * e)
     bool is_common = _lv_area_intersect(&txt_clip, &txt_coords, draw_ctx->clip_area);
     if(!is_common) return;
 
+#if LV_LABEL_LINE_CACHE
+    /*Draw the lines of the text width. (If the size is calculated with another width they are just calculated again)*/
+    label_draw_dsc.lines = get_lines(obj, label_draw_dsc.font, label_draw_dsc.letter_space,
+                                     lv_area_get_width(&txt_coords), flag);
+    if(label_draw_dsc.lines) label_draw_dsc.line_cnt = label->line_cnt;
+#endif
+
     if(label->long_mode == LV_LABEL_LONG_WRAP) {
         lv_coord_t s = lv_obj_get_scroll_top(obj);
         lv_area_move(&txt_coords, 0, -s);
@@ -861,9 +919,10 @@ static void draw_main(lv_event_t * e)
     draw_ctx->clip_area = &txt_clip;
 
     if(label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) {
+        /*The text is expanded in this mode so the drawn lines are used*/
         lv_point_t size;
-        lv_txt_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                        LV_COORD_MAX, flag);
+        get_text_size(obj, &size, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
+                      LV_COORD_MAX, flag);
 
         /*Draw the text again on label to the original to make a circular effect */
         if(size.x > lv_area_get_width(&txt_coords)) {
@@ -897,6 +956,9 @@ static void lv_label_refr_text(lv_obj_t * obj)
 #if LV_LABEL_LONG_TXT_HINT
     label->hint.line_start = -1; /*The hint is invalid if the text changes*/
 #endif
+#if LV_LABEL_LINE_CACHE
+    invalidate_lines(obj);      /*The text might be changed*/
+#endif
 
     lv_area_t txt_coords;
     lv_obj_get_content_coords(obj, &txt_coords);
@@ -912,7 +974,7 @@ static void lv_label_refr_text(lv_obj_t * obj)
     if(label->expand != 0) flag |= LV_TEXT_FLAG_EXPAND;
     if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) flag |= LV_TEXT_FLAG_FIT;
 
-    lv_txt_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+    get_text_size(obj, &size, font, letter_space, line_space, max_w, flag);
 
     lv_obj_refresh_self_size(obj);
 
@@ -1156,6 +1218,9 @@ static void lv_label_refr_text(lv_obj_t * obj)
                 }
                 label->text[byte_id_ori + LV_LABEL_DOT_NUM] = '\0';
                 label->dot_end                              = letter_id + LV_LABEL_DOT_NUM;
+#if LV_LABEL_LINE_CACHE
+                invalidate_lines(obj);
+#endif
             }
         }
     }
@@ -1166,6 +1231,63 @@ static void lv_label_refr_text(lv_obj_t * obj)
     lv_obj_invalidate(obj);
 }
 
+/**
+ * Copy a new text to the current text of a fixed width label if it surely has the same size.
+ * The letters are compared with the current ones and only the width of the changed letters is checked.
+ * @param obj       pointer to a label object
+ * @param text      the new text
+ * @return          true: the text was replaced, false: the text needs to be set as usual
+ */
+static bool set_text_same_width(lv_obj_t * obj, const char * text)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    if(label->text == NULL || label->static_txt || label->recolor) return false;
+    if(label->long_mode != LV_LABEL_LONG_WRAP && label->long_mode != LV_LABEL_LONG_CLIP) return false;
+
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    uint32_t i_old = 0;
+    uint32_t i_new = 0;
+    uint32_t letter_old = _lv_txt_encoded_next(label->text, &i_old);
+    uint32_t letter_new = _lv_txt_encoded_next(text, &i_new);
+    bool changed = false;
+    while(letter_old != 0 || letter_new != 0) {
+        uint32_t next_old = letter_old ? _lv_txt_encoded_next(label->text, &i_old) : 0;
+        uint32_t next_new = letter_new ? _lv_txt_encoded_next(text, &i_new) : 0;
+
+#if LV_USE_ARABIC_PERSIAN_CHARS
+        /*Only ASCII texts are surely not changed by the processing*/
+        if(letter_old >= 0x80 || letter_new >= 0x80) return false;
+#endif
+
+        /*The width of a letter depends on the next letter too (kerning)*/
+        if(letter_old != letter_new || next_old != next_new) {
+            /*Changed line breaks or different length*/
+            if(letter_old == 0 || letter_old == '\n' || letter_old == '\r' || _lv_txt_is_break_char(letter_old)) return false;
+            if(letter_new == 0 || letter_new == '\n' || letter_new == '\r' || _lv_txt_is_break_char(letter_new)) return false;
+
+            if(lv_font_get_glyph_width(font, letter_old, next_old) !=
+               lv_font_get_glyph_width(font, letter_new, next_new)) return false;
+            changed = true;
+        }
+
+        letter_old = next_old;
+        letter_new = next_new;
+    }
+
+    /*The same number of bytes, so it fits into the current text*/
+    if(i_old != i_new) return false;
+
+    if(changed) {
+        lv_memcpy(label->text, text, i_new);
+#if LV_LABEL_LONG_TXT_HINT
+        label->hint.line_start = -1;
+#endif
+        lv_obj_invalidate(obj);
+    }
+
+    return true;
+}
+
 static void lv_label_revert_dots(lv_obj_t * obj)
 {
 
@@ -1187,8 +1309,142 @@ static void lv_label_revert_dots(lv_obj_t * obj)
     lv_label_dot_tmp_free(obj);
 
     label->dot_end = LV_LABEL_DOT_END_INV;
+#if LV_LABEL_LINE_CACHE
+    invalidate_lines(obj);
+#endif
 }
 
+/**
+ * Get the size of the text of a label. Use the cached lines if enabled.
+ * @param obj           pointer to a label object
+ * @param size_res      store the result here
+ * @param font          font of the text
+ * @param letter_space  letter space of the text
+ * @param line_space    line space of the text
+ * @param max_w         max width of the lines
+ * @param flag          settings for the text from ::lv_text_flag_t
+ */
+static void get_text_size(lv_obj_t * obj, lv_point_t * size_res, const lv_font_t * font, lv_coord_t letter_space,
+                          lv_coord_t line_space, lv_coord_t max_w, lv_text_flag_t flag)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+
+#if LV_LABEL_LINE_CACHE
+    const lv_draw_label_line_t * lines = get_lines(obj, font, letter_space, max_w, flag);
+    if(lines) {
+        /*The same as `lv_txt_get_size()` but from the lines*/
+        size_res->x = 0;
+        uint32_t i;
+        for(i = 0; i < label->line_cnt; i++) size_res->x = LV_MAX(size_res->x, lines[i].width);
+
+        /*Make the text one line taller if the last character is '\n' or '\r'*/
+        uint32_t line_cnt = label->line_cnt;
+        uint32_t txt_len = lines[line_cnt].start;
+        if(txt_len != 0 && (label->text[txt_len - 1] == '\n' || label->text[txt_len - 1] == '\r')) line_cnt++;
+
+        lv_coord_t letter_height = lv_font_get_line_height(font);
+        int32_t h = (int32_t)line_cnt * (letter_height + line_space) - line_space;
+        size_res->y = line_cnt == 0 ? letter_height : (lv_coord_t)LV_MIN(h, LV_COORD_MAX);
+        return;
+    }
+#endif
+
+    lv_txt_get_size(size_res, label->text, font, letter_space, line_space, max_w, flag);
+}
+
+#if LV_LABEL_LINE_CACHE
+/**
+ * Get the start and width of the lines of a label. They are calculated only if the text or the parameters changed.
+ * Single line texts are not stored as they are broken quickly anyway.
+ * @param obj           pointer to a label object
+ * @param font          font of the text
+ * @param letter_space  letter space of the text
+ * @param max_w         max width of the lines
+ * @param flag          settings for the text from ::lv_text_flag_t
+ * @return              `label->line_cnt + 1` lines or NULL if the text has only one line or there is not enough memory
+ */
+static const lv_draw_label_line_t * get_lines(lv_obj_t * obj, const lv_font_t * font, lv_coord_t letter_space,
+                                              lv_coord_t max_w, lv_text_flag_t flag)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    if(label->text == NULL || font == NULL) return NULL;
+
+    /*The width doesn't matter if the lines are broken only at the new line characters*/
+    if(flag & (LV_TEXT_FLAG_EXPAND | LV_TEXT_FLAG_FIT)) max_w = LV_COORD_MAX;
+
+    if(label->line_font == font && label->line_max_w == max_w &&
+       label->line_letter_space == letter_space && label->line_flag == flag) {
+        return label->lines;
+    }
+
+    invalidate_lines(obj);
+
+    /*Save the parameters even if the lines are not stored to not check the text again*/
+    label->line_font = font;
+    label->line_max_w = max_w;
+    label->line_letter_space = letter_space;
+    label->line_flag = flag;
+
+    const char * txt = label->text;
+    uint32_t line_start = _lv_txt_get_next_line(txt, font, letter_space, max_w, NULL, flag);
+    if(txt[line_start] == '\0') return NULL;
+
+    uint32_t line_cap = 8;
+    lv_draw_label_line_t * lines = lv_mem_alloc(line_cap * sizeof(lv_draw_label_line_t));
+    LV_ASSERT_MALLOC(lines);
+    if(lines == NULL) return NULL;
+
+    uint32_t line_cnt = 0;
+    line_start = 0;
+    while(txt[line_start] != '\0') {
+        /*Keep place for the closing item too*/
+        if(line_cnt + 2 > line_cap) {
+            line_cap *= 2;
+            lv_draw_label_line_t * lines_new = lv_mem_realloc(lines, line_cap * sizeof(lv_draw_label_line_t));
+            LV_ASSERT_MALLOC(lines_new);
+            if(lines_new == NULL) {
+                lv_mem_free(lines);
+                return NULL;
+            }
+            lines = lines_new;
+        }
+
+        uint32_t line_end = line_start + _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+        lines[line_cnt].start = line_start;
+        lines[line_cnt].width = lv_txt_get_width(&txt[line_start], line_end - line_start, font, letter_space, flag);
+        line_cnt++;
+        line_start = line_end;
+    }
+
+    lines[line_cnt].start = line_start;
+    lines[line_cnt].width = 0;
+
+    /*Free the unused items*/
+    lv_draw_label_line_t * lines_new = lv_mem_realloc(lines, (line_cnt + 1) * sizeof(lv_draw_label_line_t));
+    if(lines_new) lines = lines_new;
+
+    label->lines = lines;
+    label->line_cnt = line_cnt;
+
+    return lines;
+}
+
+/**
+ * Free the cached lines of a label and mark them as invalid
+ * @param obj       pointer to a label object
+ */
+static void invalidate_lines(lv_obj_t * obj)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    label->line_font = NULL;
+    if(label->lines == NULL) return;
+
+    lv_mem_free(label->lines);
+    label->lines = NULL;
+    label->line_cnt = 0;
+}
+#endif
+
 /**
  * Store `len` characters from `data`. Allocates space if necessary.
  *
@@ -63,6 +63,15 @@ typedef struct {
     lv_draw_label_hint_t hint;
 #endif
 
+#if LV_LABEL_LINE_CACHE
+    lv_draw_label_line_t * lines;       /*Start and width of the lines, `line_cnt + 1` items, NULL for one line*/
+    uint32_t line_cnt;
+    const lv_font_t * line_font;        /*The lines are valid with these parameters, NULL: not calculated*/
+    lv_coord_t line_max_w;
+    lv_coord_t line_letter_space;
+    lv_text_flag_t line_flag;
+#endif
+
 #if LV_LABEL_TEXT_SELECTION
     uint32_t sel_start;
     uint32_t sel_end;
@@ -74,6 +83,7 @@ typedef struct {
     uint8_t recolor : 1;                /*Enable in-line letter re-coloring*/
     uint8_t expand : 1;                 /*Ignore real width (used by the library with LV_LABEL_LONG_SCROLL)*/
     uint8_t dot_tmp_alloc : 1;         /*1: dot is allocated, 0: dot directly holds up to 4 chars*/
+    uint8_t fixed_width : 1;           /*Replace the text in place if its width doesn't change*/
 } lv_label_t;
 
 extern const lv_obj_class_t lv_label_class;
@@ -132,6 +142,19 @@ void lv_label_set_long_mode(lv_obj_t * obj, lv_label_long_mode_t long_mode);
  */
 void lv_label_set_recolor(lv_obj_t * obj, bool en);
 
+/**
+ * Enable the fixed width mode for labels whose text changes often but keeps its width,
+ * e.g. "%02d" digits with a monospace font.
+ * If a new text has the same length and the changed letters have the same width,
+ * it's copied to the current text, only the label is redrawn and the text is not measured again
+ * (no size change and no layout update). Other texts are set as usual.
+ * It's used only in `LV_LABEL_LONG_WRAP` and `LV_LABEL_LONG_CLIP` mode, without recoloring and with not static texts
+ * (and only for ASCII texts if `LV_USE_ARABIC_PERSIAN_CHARS` is enabled).
+ * @param obj           pointer to a label object
+ * @param en            true: enable the fixed width mode, false: disable
+ */
+void lv_label_set_fixed_width(lv_obj_t * obj, bool en);
+
 /**
  * Set where text selection should start
  * @param obj       pointer to a label object
@@ -171,6 +194,13 @@ lv_label_long_mode_t lv_label_get_long_mode(const lv_obj_t * obj);
  */
 bool lv_label_get_recolor(const lv_obj_t * obj);
 
+/**
+ * Get whether the fixed width mode is enabled
+ * @param obj       pointer to a label object
+ * @return          true: the fixed width mode is enabled, false: disabled
+ */
+bool lv_label_get_fixed_width(const lv_obj_t * obj);
+
 /**
  * Get the relative x and y coordinates of a letter
  * @param obj       pointer to a label object
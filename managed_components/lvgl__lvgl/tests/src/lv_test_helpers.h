@@ -17,6 +17,19 @@ static inline uint32_t lv_test_get_free_mem(void)
 }
 #endif /* LVGL_CI_USING_SYS_HEAP */
 
+#if LV_DRAW_COMPLEX
+/* A mask which changes nothing, but makes the drawing go through the mask buffer */
+static inline lv_draw_mask_res_t lv_test_full_cover_mask_cb(lv_opa_t * mask_buf, lv_coord_t abs_x, lv_coord_t abs_y,
+                                                            lv_coord_t len, void * p)
+{
+    LV_UNUSED(mask_buf);
+    LV_UNUSED(abs_x);
+    LV_UNUSED(abs_y);
+    LV_UNUSED(len);
+    LV_UNUSED(p);
+    return LV_DRAW_MASK_RES_FULL_COVER;
+}
+#endif
 
 #endif /*LV_TEST_HELPERS_H*/
 
@@ -92,6 +92,13 @@ uint32_t custom_tick_get(void)
     return time_ms;
 }
 
+uint64_t lv_test_get_time_us(void)
+{
+    struct timeval tv_now;
+    gettimeofday(&tv_now, NULL);
+    return (uint64_t)tv_now.tv_sec * 1000000 + tv_now.tv_usec;
+}
+
 void lv_test_assert_fail(void)
 {
     TEST_FAIL();
@@ -12,6 +12,12 @@ extern "C" {
 void lv_test_init(void);
 void lv_test_deinit(void);
 
+/**
+ * Get a monotonic time stamp for benchmarks.
+ * @return  the time in microseconds
+ */
+uint64_t lv_test_get_time_us(void);
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
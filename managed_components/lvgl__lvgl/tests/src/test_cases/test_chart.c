@@ -0,0 +1,222 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_init.h"
+
+#define CHART_W         240
+#define CHART_H         120
+#define BENCH_FRAMES    300
+#define BENCH_SAMPLES   4       /*Per frame, like a 100 Hz sensor at 25 fps*/
+#define BENCH_HISTORY   600     /*Samples on the chart*/
+
+static lv_obj_t * chart;
+static lv_chart_series_t * ser;
+
+void setUp(void)
+{
+    chart = lv_chart_create(lv_scr_act());
+    lv_obj_set_size(chart, CHART_W, CHART_H);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, 0, 100);
+    ser = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_RED), LV_CHART_AXIS_PRIMARY_Y);
+    lv_obj_update_layout(chart);    /*For the content width*/
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+/*A pulse with a dicrotic notch, 80 samples long*/
+static lv_coord_t ppg_sample(uint32_t i)
+{
+    int32_t phase = (i % 80) * 360 / 80;
+    return 50 + lv_trigo_sin(phase) * 30 / LV_TRIGO_SIN_MAX + lv_trigo_sin(phase * 2) * 8 / LV_TRIGO_SIN_MAX;
+}
+
+static uint32_t get_inv_size(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    uint32_t size = 0;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(!disp->inv_area_joined[i]) size += lv_area_get_size(&disp->inv_areas[i]);
+    }
+    return size;
+}
+
+#if LV_USE_SNAPSHOT
+static bool is_invalidated(lv_coord_t x, lv_coord_t y)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_point_t p = {x, y};
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(!disp->inv_area_joined[i] && _lv_area_is_point_on(&disp->inv_areas[i], &p, 0)) return true;
+    }
+    return false;
+}
+#endif
+
+void test_chart_stream_keeps_min_and_max_per_point(void)
+{
+    lv_chart_set_type(chart, LV_CHART_TYPE_STREAM);
+    lv_chart_set_point_count(chart, 10);
+    lv_chart_set_stream(chart, 3, 2);
+
+    static const lv_coord_t values[] = {10, 30, 20, 25, 5, 15, 40};
+    lv_chart_set_next_values(chart, ser, values, 7);
+
+    lv_coord_t * max = lv_chart_get_y_array(chart, ser);
+    lv_coord_t * min = lv_chart_get_x_array(chart, ser);
+    TEST_ASSERT_EQUAL(10, min[0]);
+    TEST_ASSERT_EQUAL(30, max[0]);
+    /*Starts from the last sample of the previous point*/
+    TEST_ASSERT_EQUAL(5, min[1]);
+    TEST_ASSERT_EQUAL(25, max[1]);
+    TEST_ASSERT_EQUAL(15, min[2]);
+    TEST_ASSERT_EQUAL(40, max[2]);
+    TEST_ASSERT_EQUAL(2, ser->start_point);
+
+    /*A hole in the data, the point after the last value still starts from it*/
+    lv_chart_set_next_value(chart, ser, 50);
+    lv_chart_set_next_value(chart, ser, 60);
+    uint32_t i;
+    for(i = 0; i < 6; i++) lv_chart_set_next_value(chart, ser, LV_CHART_POINT_NONE);
+    TEST_ASSERT_EQUAL(60, max[2]);
+    TEST_ASSERT_EQUAL(60, max[3]);
+    TEST_ASSERT_EQUAL(LV_CHART_POINT_NONE, max[4]);
+}
+
+void test_chart_stream_clears_the_gap(void)
+{
+    lv_chart_set_type(chart, LV_CHART_TYPE_STREAM);
+    lv_chart_set_point_count(chart, 10);
+    lv_chart_set_stream(chart, 1, 3);
+
+    uint32_t i;
+    for(i = 0; i < 25; i++) lv_chart_set_next_value(chart, ser, 50);
+
+    /*The newest point is 4, the 3 after it are empty, the rest have data*/
+    lv_coord_t * max = lv_chart_get_y_array(chart, ser);
+    TEST_ASSERT_EQUAL(4, ser->start_point);
+    for(i = 0; i < 10; i++) {
+        bool in_gap = i >= 5 && i <= 7;
+        TEST_ASSERT_EQUAL(in_gap ? LV_CHART_POINT_NONE : 50, max[i]);
+    }
+}
+
+void test_chart_stream_draws_an_empty_range(void)
+{
+    lv_chart_set_type(chart, LV_CHART_TYPE_STREAM);
+    lv_chart_set_point_count(chart, 10);
+    lv_chart_set_stream(chart, 1, 2);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, 50, 50);
+
+    /*The range is widened to 50..51 and the points are mapped like the line points, clamped to it*/
+    uint32_t i;
+    for(i = 0; i < 10; i++) lv_chart_set_next_value(chart, ser, 40 + i * 2);
+    lv_obj_invalidate(chart);
+    lv_refr_now(NULL);
+}
+
+void test_chart_set_next_values_on_line_chart(void)
+{
+    lv_chart_set_point_count(chart, 5);
+    static const lv_coord_t values[] = {1, 2, 3};
+    lv_chart_set_next_values(chart, ser, values, 3);
+
+    lv_coord_t * y = lv_chart_get_y_array(chart, ser);
+    TEST_ASSERT_EQUAL(1, y[0]);
+    TEST_ASSERT_EQUAL(3, y[2]);
+    TEST_ASSERT_EQUAL(3, ser->start_point);
+}
+
+void test_chart_stream_redraws_only_the_new_points(void)
+{
+    lv_chart_set_type(chart, LV_CHART_TYPE_STREAM);
+    lv_chart_set_point_count(chart, lv_obj_get_content_width(chart));
+    lv_chart_set_stream(chart, 2, 4);
+
+    uint32_t s = 0;
+    for(s = 0; s < 300; s++) lv_chart_set_next_value(chart, ser, ppg_sample(s));
+    lv_refr_now(NULL);
+
+#if LV_USE_SNAPSHOT
+    lv_img_dsc_t * before = lv_snapshot_take(lv_scr_act(), LV_IMG_CF_TRUE_COLOR);
+    TEST_ASSERT_NOT_NULL(before);
+#endif
+
+    lv_coord_t block[BENCH_SAMPLES];
+    uint32_t i;
+    for(i = 0; i < BENCH_SAMPLES; i++) block[i] = ppg_sample(s++);
+    lv_chart_set_next_values(chart, ser, block, BENCH_SAMPLES);
+
+    /*A stripe of a few points*/
+    uint32_t inv_size = get_inv_size();
+    TEST_ASSERT_GREATER_THAN(0, inv_size);
+    TEST_ASSERT_LESS_THAN(lv_area_get_size(&chart->coords) / 10, inv_size);
+
+#if LV_USE_SNAPSHOT
+    /*Every pixel which changed is in an invalidated area*/
+    lv_img_dsc_t * after = lv_snapshot_take(lv_scr_act(), LV_IMG_CF_TRUE_COLOR);
+    TEST_ASSERT_NOT_NULL(after);
+    const lv_color_t * px_before = (const lv_color_t *)before->data;
+    const lv_color_t * px_after = (const lv_color_t *)after->data;
+    uint32_t changed_cnt = 0;
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = 0; y < (lv_coord_t)after->header.h; y++) {
+        for(x = 0; x < (lv_coord_t)after->header.w; x++) {
+            uint32_t idx = y * after->header.w + x;
+            if(px_before[idx].full == px_after[idx].full) continue;
+            changed_cnt++;
+            TEST_ASSERT_TRUE(is_invalidated(x, y));
+        }
+    }
+    TEST_ASSERT_GREATER_THAN(0, changed_cnt);
+
+    lv_snapshot_free(before);
+    lv_snapshot_free(after);
+#endif
+    lv_refr_now(NULL);
+}
+
+static uint32_t bench_frames(bool stream)
+{
+    lv_coord_t block[BENCH_SAMPLES];
+    uint32_t s = 0;
+    uint32_t f;
+    uint32_t i;
+    uint64_t t_start = lv_test_get_time_us();
+    for(f = 0; f < BENCH_FRAMES; f++) {
+        for(i = 0; i < BENCH_SAMPLES; i++) block[i] = ppg_sample(s++);
+        if(stream) lv_chart_set_next_values(chart, ser, block, BENCH_SAMPLES);
+        else for(i = 0; i < BENCH_SAMPLES; i++) lv_chart_set_next_value(chart, ser, block[i]);
+        lv_refr_now(NULL);
+    }
+    return (uint32_t)(lv_test_get_time_us() - t_start);
+}
+
+void test_chart_stream_benchmark(void)
+{
+    lv_obj_set_style_size(chart, 0, LV_PART_INDICATOR);
+    lv_refr_now(NULL);
+
+    /*The same history as a line chart which shifts every new sample in*/
+    lv_chart_set_point_count(chart, BENCH_HISTORY);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_SHIFT);
+    uint32_t t_line = bench_frames(false);
+
+    lv_chart_set_type(chart, LV_CHART_TYPE_STREAM);
+    lv_coord_t cols = lv_obj_get_content_width(chart);
+    lv_chart_set_point_count(chart, cols);
+    lv_chart_set_stream(chart, (BENCH_HISTORY + cols - 1) / cols, 4);
+    lv_refr_now(NULL);
+    uint32_t t_stream = bench_frames(true);
+
+    TEST_PRINTF("%d frames of %d samples, %dx%d chart: line shift %u us/frame, stream %u us/frame", BENCH_FRAMES,
+                BENCH_SAMPLES, CHART_W, CHART_H, t_line / BENCH_FRAMES, t_stream / BENCH_FRAMES);
+}
+
+#endif
@@ -0,0 +1,361 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../demos/lv_demos.h"
+#include "../src/draw/sw/lv_draw_sw.h"
+
+#include "unity/unity.h"
+#include "lv_test_init.h"
+
+#define BENCH_FRAMES    20
+#define SHADOW_BUDGET   4096    /*Independent of LV_SHADOW_CACHE_SIZE, for the configs with a tiny cache*/
+
+#if LV_DRAW_COMPLEX
+
+static lv_obj_t * card_create(lv_coord_t x, lv_coord_t shadow_width, lv_coord_t radius)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_pos(obj, x, 40);
+    lv_obj_set_size(obj, 100, 60);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_radius(obj, radius, 0);
+    lv_obj_set_style_shadow_width(obj, shadow_width, 0);
+    return obj;
+}
+
+static void refr_all(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+#endif
+
+#if LV_DRAW_COMPLEX && LV_SHADOW_CACHE_SIZE > 0
+
+/*The shadow scenes of the benchmark demo, see `scenes[]` in `lv_demo_benchmark.c`*/
+static const struct {
+    const char * name;
+    int16_t scene_idx;
+} bench_scenes[] = {
+    {"Shadow small", 11},
+    {"Shadow small offset", 12},
+    {"Shadow large", 13},
+    {"Shadow large offset", 14},
+    {"Substr. shadow", 43},
+};
+
+static uint32_t bench_frames(void)
+{
+    uint32_t i;
+    uint64_t t_start = lv_test_get_time_us();
+    for(i = 0; i < BENCH_FRAMES; i++) refr_all();
+    return (uint32_t)(lv_test_get_time_us() - t_start);
+}
+
+#endif
+
+#define GRAD_BENCH_SIZE 240     /*A full screen gradient on a watch*/
+
+static void grad_init(lv_grad_dsc_t * g, lv_grad_dir_t dir, uint32_t c1, uint32_t c2)
+{
+    lv_memset_00(g, sizeof(lv_grad_dsc_t));
+    g->dir = dir;
+    g->stops_count = 2;
+    g->stops[0].color = lv_color_hex(c1);
+    g->stops[0].frac = 0;
+    g->stops[1].color = lv_color_hex(c2);
+    g->stops[1].frac = 255;
+}
+
+static lv_color_t grad_get_first_color(lv_grad_t * grad)
+{
+#if _DITHER_GRADIENT
+    return lv_color_hex(grad->hmap[0].full);
+#else
+    return grad->map[0];
+#endif
+}
+
+void setUp(void)
+{
+#if LV_DRAW_COMPLEX && LV_SHADOW_CACHE_SIZE > 0
+    /*Start with an empty shadow cache*/
+    lv_draw_sw_shadow_cache_set_budget(0);
+    lv_draw_sw_shadow_cache_set_budget(SHADOW_BUDGET);
+#endif
+}
+
+void tearDown(void)
+{
+    lv_gradient_set_cache_size(LV_GRAD_CACHE_DEF_SIZE);
+#if LV_DRAW_COMPLEX && LV_SHADOW_CACHE_SIZE > 0
+    lv_draw_sw_shadow_cache_set_budget((uint32_t)LV_SHADOW_CACHE_SIZE * LV_SHADOW_CACHE_SIZE);
+#endif
+#if LV_DRAW_COMPLEX
+    lv_draw_mask_circle_cache_set_budget(LV_CIRCLE_CACHE_BUDGET);
+    lv_obj_clean(lv_scr_act());
+#endif
+}
+
+void test_shadow_cache_keeps_more_corners(void)
+{
+#if LV_DRAW_COMPLEX && LV_SHADOW_CACHE_SIZE > 0
+    card_create(40, 20, 10);
+    card_create(200, 10, 4);
+    card_create(360, 20, 10);
+
+    lv_draw_sw_shadow_cache_info_t start;
+    lv_draw_sw_shadow_cache_get_info(&start);
+    refr_all();
+
+    lv_draw_sw_shadow_cache_info_t info;
+    lv_draw_sw_shadow_cache_get_info(&info);
+    TEST_ASSERT_EQUAL(2, info.miss_cnt - start.miss_cnt);
+    TEST_ASSERT_EQUAL(1, info.hit_cnt - start.hit_cnt);
+    TEST_ASSERT_EQUAL(30 * 30 + 14 * 14, info.used_size);
+
+    /*Both corners are reused in the next refresh*/
+    refr_all();
+    lv_draw_sw_shadow_cache_get_info(&info);
+    TEST_ASSERT_EQUAL(2, info.miss_cnt - start.miss_cnt);
+    TEST_ASSERT_EQUAL(4, info.hit_cnt - start.hit_cnt);
+#endif
+}
+
+void test_shadow_cache_budget(void)
+{
+#if LV_DRAW_COMPLEX && LV_SHADOW_CACHE_SIZE > 0
+    card_create(40, 20, 10);
+    card_create(200, 10, 4);
+    refr_all();
+
+    /*Only the recently used, smaller corner fits*/
+    lv_draw_sw_shadow_cache_set_budget(30 * 30 - 1);
+    lv_draw_sw_shadow_cache_info_t info;
+    lv_draw_sw_shadow_cache_get_info(&info);
+    TEST_ASSERT_EQUAL(14 * 14, info.used_size);
+    TEST_ASSERT_EQUAL(1, info.used_entry_cnt);
+
+    lv_draw_sw_shadow_cache_info_t start;
+    lv_draw_sw_shadow_cache_get_info(&start);
+    refr_all();
+    refr_all();
+    lv_draw_sw_shadow_cache_get_info(&info);
+    TEST_ASSERT_EQUAL(2, info.miss_cnt - start.miss_cnt);
+    TEST_ASSERT_EQUAL(2, info.hit_cnt - start.hit_cnt);
+
+    /*Nothing is cached*/
+    lv_draw_sw_shadow_cache_set_budget(0);
+    lv_draw_sw_shadow_cache_get_info(&info);
+    TEST_ASSERT_EQUAL(0, info.used_size);
+    TEST_ASSERT_EQUAL(0, info.used_entry_cnt);
+#endif
+}
+
+void test_circle_cache_is_kept_between_refreshes(void)
+{
+#if LV_DRAW_COMPLEX
+    lv_obj_t * obj = card_create(40, 0, 10);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_50, 0);
+    refr_all();
+
+    lv_draw_mask_circle_cache_info_t start;
+    lv_draw_mask_circle_cache_get_info(&start);
+    TEST_ASSERT_GREATER_THAN(0, start.used_entry_cnt);
+
+    refr_all();
+    lv_draw_mask_circle_cache_info_t info;
+    lv_draw_mask_circle_cache_get_info(&info);
+    TEST_ASSERT_EQUAL(start.miss_cnt, info.miss_cnt);
+    TEST_ASSERT_GREATER_THAN(start.hit_cnt, info.hit_cnt);
+
+    /*Freed at the end of the refreshes, so calculated again in the next one*/
+    lv_draw_mask_circle_cache_set_budget(0);
+    refr_all();
+    lv_draw_mask_circle_cache_get_info(&info);
+    TEST_ASSERT_EQUAL(0, info.used_size);
+    refr_all();
+    lv_draw_mask_circle_cache_get_info(&info);
+    TEST_ASSERT_GREATER_THAN(start.miss_cnt, info.miss_cnt);
+#endif
+}
+
+void test_shadow_cache_benchmark_demo_scenes(void)
+{
+#if LV_DRAW_COMPLEX && LV_SHADOW_CACHE_SIZE > 0 && LV_USE_DEMO_BENCHMARK
+    uint32_t i;
+    for(i = 0; i < sizeof(bench_scenes) / sizeof(bench_scenes[0]); i++) {
+        uint32_t opa;
+        for(opa = 0; opa < 2; opa++) {
+            lv_demo_benchmark_run_scene(bench_scenes[i].scene_idx * 2 + opa);
+
+            lv_draw_sw_shadow_cache_set_budget(0);
+            lv_draw_mask_circle_cache_set_budget(0);
+            uint32_t t_no_cache = bench_frames();
+
+            lv_draw_sw_shadow_cache_set_budget(SHADOW_BUDGET);
+            lv_draw_mask_circle_cache_set_budget(LV_CIRCLE_CACHE_BUDGET);
+            refr_all();
+            uint32_t t_cache = bench_frames();
+
+            TEST_PRINTF("%s%s: no cache %u us/frame, cache %u us/frame", bench_scenes[i].name, opa ? " + opa" : "",
+                        t_no_cache / BENCH_FRAMES, t_cache / BENCH_FRAMES);
+
+            lv_demo_benchmark_close();
+        }
+    }
+
+    lv_disp_get_default()->driver->monitor_cb = NULL;
+#endif
+}
+
+void test_shadow_cache_benchmark_mixed(void)
+{
+#if LV_DRAW_COMPLEX && LV_SHADOW_CACHE_SIZE > 0
+    /*Cards and buttons of a UI usually have a few different shadows*/
+    uint32_t i;
+    for(i = 0; i < 6; i++) {
+        card_create(20 + i * 120, i % 2 ? 30 : 10, i % 3 ? 12 : 6);
+    }
+
+    /*Room for only the largest corner, like the former single entry shadow cache*/
+    lv_draw_sw_shadow_cache_set_budget(42 * 42);
+    refr_all();
+    uint32_t t_one = bench_frames();
+
+    lv_draw_sw_shadow_cache_set_budget(SHADOW_BUDGET);
+    refr_all();
+    uint32_t t_all = bench_frames();
+
+    lv_draw_sw_shadow_cache_info_t info;
+    lv_draw_sw_shadow_cache_get_info(&info);
+    TEST_ASSERT_EQUAL(4, info.used_entry_cnt);
+
+    TEST_PRINTF("%d frames of 6 cards with 4 different shadows: one corner cached %u us/frame, "
+                "all corners cached %u us/frame", BENCH_FRAMES, t_one / BENCH_FRAMES, t_all / BENCH_FRAMES);
+#endif
+}
+
+void test_gradient_cache_compares_the_content(void)
+{
+    lv_gradient_set_cache_size(4096);
+
+    /*The same descriptor with other colors, like the descriptors of different objects on the stack*/
+    lv_grad_dsc_t g;
+    grad_init(&g, LV_GRAD_DIR_VER, 0xff0000, 0x0000ff);
+    lv_grad_t * a = lv_gradient_get(&g, 100, 50);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), grad_get_first_color(a));
+    lv_gradient_cleanup(a);
+
+    grad_init(&g, LV_GRAD_DIR_VER, 0x00ff00, 0x0000ff);
+    lv_grad_t * b = lv_gradient_get(&g, 100, 50);
+    TEST_ASSERT_TRUE(a != b);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), grad_get_first_color(b));
+    lv_gradient_cleanup(b);
+
+    /*Other size*/
+    lv_grad_t * c = lv_gradient_get(&g, 100, 60);
+    TEST_ASSERT_TRUE(c != b);
+    TEST_ASSERT_EQUAL(60, c->size);
+    lv_gradient_cleanup(c);
+
+    lv_grad_cache_info_t start;
+    lv_gradient_get_cache_info(&start);
+    grad_init(&g, LV_GRAD_DIR_VER, 0xff0000, 0x0000ff);
+    TEST_ASSERT_EQUAL_PTR(a, lv_gradient_get(&g, 100, 50));
+    lv_gradient_cleanup(a);
+
+    lv_grad_cache_info_t info;
+    lv_gradient_get_cache_info(&info);
+    TEST_ASSERT_EQUAL(3, info.entry_cnt);
+    TEST_ASSERT_EQUAL(start.hit_cnt + 1, info.hit_cnt);
+    TEST_ASSERT_EQUAL(a->mem_size + b->mem_size + c->mem_size, info.used_size);
+}
+
+void test_gradient_cache_evicts_the_least_recently_used(void)
+{
+    lv_grad_dsc_t g1;
+    lv_grad_dsc_t g2;
+    lv_grad_dsc_t g3;
+    grad_init(&g1, LV_GRAD_DIR_HOR, 0xff0000, 0x0000ff);
+    grad_init(&g2, LV_GRAD_DIR_HOR, 0x00ff00, 0x0000ff);
+    grad_init(&g3, LV_GRAD_DIR_HOR, 0x0000ff, 0xffffff);
+
+    /*Room for 2 items*/
+    lv_gradient_set_cache_size(0);
+    lv_gradient_set_cache_size(4096);
+    lv_grad_t * grad = lv_gradient_get(&g1, 200, 10);
+    lv_gradient_set_cache_size(grad->mem_size * 2);
+
+    lv_gradient_cleanup(lv_gradient_get(&g2, 200, 10));
+    lv_gradient_cleanup(lv_gradient_get(&g1, 200, 10));
+    lv_gradient_cleanup(lv_gradient_get(&g3, 200, 10));
+
+    lv_grad_cache_info_t start;
+    lv_gradient_get_cache_info(&start);
+    TEST_ASSERT_EQUAL(2, start.entry_cnt);
+    TEST_ASSERT_EQUAL(grad->mem_size * 2, start.used_size);
+
+    lv_gradient_cleanup(lv_gradient_get(&g1, 200, 10));
+    lv_gradient_cleanup(lv_gradient_get(&g3, 200, 10));
+    lv_grad_cache_info_t info;
+    lv_gradient_get_cache_info(&info);
+    TEST_ASSERT_EQUAL(start.hit_cnt + 2, info.hit_cnt);
+    TEST_ASSERT_EQUAL(start.miss_cnt, info.miss_cnt);
+
+    /*g2 was evicted*/
+    lv_gradient_cleanup(lv_gradient_get(&g2, 200, 10));
+    lv_gradient_get_cache_info(&info);
+    TEST_ASSERT_EQUAL(start.miss_cnt + 1, info.miss_cnt);
+
+    /*Larger than the cache*/
+    grad = lv_gradient_get(&g1, 1000, 10);
+    TEST_ASSERT_TRUE(grad->not_cached);
+    lv_gradient_cleanup(grad);
+    lv_gradient_get_cache_info(&info);
+    TEST_ASSERT_EQUAL(2, info.entry_cnt);
+}
+
+static uint32_t grad_bench(lv_grad_dir_t dir, bool radius)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, GRAD_BENCH_SIZE, GRAD_BENCH_SIZE);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x102040), 0);
+    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0x60a0e0), 0);
+    lv_obj_set_style_bg_grad_dir(obj, dir, 0);
+    if(radius) lv_obj_set_style_radius(obj, LV_RADIUS_CIRCLE, 0);
+    lv_refr_now(NULL);
+
+    /*Take the best of a few rounds to be less sensitive to the load of the host*/
+    uint32_t t_min = UINT32_MAX;
+    uint32_t r;
+    for(r = 0; r < 5; r++) {
+        uint32_t i;
+        uint64_t t_start = lv_test_get_time_us();
+        for(i = 0; i < BENCH_FRAMES; i++) {
+            lv_obj_invalidate(obj);
+            lv_refr_now(NULL);
+        }
+        t_min = LV_MIN(t_min, (uint32_t)(lv_test_get_time_us() - t_start));
+    }
+
+    lv_obj_del(obj);
+    return t_min / BENCH_FRAMES;
+}
+
+void test_gradient_benchmark(void)
+{
+    uint32_t cache_size;
+    for(cache_size = 0; cache_size <= 8192; cache_size += 8192) {
+        lv_gradient_set_cache_size(cache_size);
+        TEST_PRINTF("%dx%d gradient, cache %u bytes: vertical %u us/frame, horizontal %u us/frame, "
+                    "round vertical %u us/frame, round horizontal %u us/frame", GRAD_BENCH_SIZE, GRAD_BENCH_SIZE,
+                    cache_size, grad_bench(LV_GRAD_DIR_VER, false), grad_bench(LV_GRAD_DIR_HOR, false),
+                    grad_bench(LV_GRAD_DIR_VER, true), grad_bench(LV_GRAD_DIR_HOR, true));
+    }
+}
+
+#endif
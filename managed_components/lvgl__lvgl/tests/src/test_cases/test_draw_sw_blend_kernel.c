@@ -0,0 +1,198 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../src/draw/sw/lv_draw_sw.h"
+
+#include "unity/unity.h"
+#include "lv_test_init.h"
+
+#define BUF_W   240
+#define BUF_H   240
+#define BENCH_ROUNDS 20
+
+static uint16_t dest_ref[BUF_W * BUF_H];
+static uint16_t dest_act[BUF_W * BUF_H];
+static uint16_t src_buf[BUF_W * BUF_H];
+static lv_opa_t mask_buf[BUF_W * BUF_H];
+
+static uint32_t rnd_state;
+
+static uint32_t rnd(void)
+{
+    /*xorshift32 to get the same pixels on every run*/
+    rnd_state ^= rnd_state << 13;
+    rnd_state ^= rnd_state >> 17;
+    rnd_state ^= rnd_state << 5;
+    return rnd_state;
+}
+
+static void fill_random(void)
+{
+    uint32_t i;
+    for(i = 0; i < BUF_W * BUF_H; i++) {
+        dest_ref[i] = (uint16_t)rnd();
+        src_buf[i] = (uint16_t)rnd();
+    }
+    lv_memcpy(dest_act, dest_ref, sizeof(dest_ref));
+
+    /*Glyph-like mask: long transparent and opaque runs with anti-aliased edges*/
+    lv_opa_t opa = LV_OPA_TRANSP;
+    for(i = 0; i < BUF_W * BUF_H; i++) {
+        uint32_t r = rnd() % 16;
+        if(r == 0) opa = LV_OPA_COVER;
+        else if(r == 1) opa = LV_OPA_TRANSP;
+        else if(r < 5) opa = (lv_opa_t)rnd();
+        mask_buf[i] = opa;
+    }
+}
+
+void setUp(void)
+{
+    rnd_state = 0x12345678;
+    fill_random();
+}
+
+void tearDown(void)
+{
+    lv_draw_sw_blend_kernel_set(NULL);
+}
+
+static const lv_draw_sw_blend_kernel_t * get_simd_or_skip(void)
+{
+    const lv_draw_sw_blend_kernel_t * simd = lv_draw_sw_blend_kernel_get_simd();
+    if(simd == NULL) TEST_IGNORE_MESSAGE("No SIMD kernels on this CPU");
+    return simd;
+}
+
+void test_blend_kernel_default_is_the_fastest(void)
+{
+    const lv_draw_sw_blend_kernel_t * simd = lv_draw_sw_blend_kernel_get_simd();
+    if(simd) TEST_ASSERT_EQUAL_PTR(simd, lv_draw_sw_blend_kernel_get());
+    else TEST_ASSERT_EQUAL_PTR(lv_draw_sw_blend_kernel_get_scalar(), lv_draw_sw_blend_kernel_get());
+
+    lv_draw_sw_blend_kernel_set(lv_draw_sw_blend_kernel_get_scalar());
+    TEST_ASSERT_EQUAL_PTR(lv_draw_sw_blend_kernel_get_scalar(), lv_draw_sw_blend_kernel_get());
+}
+
+void test_blend_kernel_scalar_matches_color_mix(void)
+{
+    const lv_draw_sw_blend_kernel_t * scalar = lv_draw_sw_blend_kernel_get_scalar();
+    uint32_t opa;
+    for(opa = 0; opa <= 255; opa++) {
+        scalar->map_opa(dest_act, BUF_W, BUF_W, 1, src_buf, BUF_W, (lv_opa_t)opa);
+
+        uint32_t x;
+        for(x = 0; x < BUF_W; x++) {
+#if LV_COLOR_DEPTH == 16
+            lv_color_t fg = {.full = src_buf[x]};
+            lv_color_t bg = {.full = dest_ref[x]};
+            TEST_ASSERT_EQUAL_HEX16(lv_color_mix(fg, bg, (uint8_t)opa).full, dest_act[x]);
+#else
+            if(opa == LV_OPA_COVER) TEST_ASSERT_EQUAL_HEX16(src_buf[x], dest_act[x]);
+            if(opa == LV_OPA_TRANSP) TEST_ASSERT_EQUAL_HEX16(dest_ref[x], dest_act[x]);
+#endif
+        }
+        lv_memcpy(dest_act, dest_ref, BUF_W * sizeof(uint16_t));
+    }
+}
+
+void test_blend_kernel_fill_is_bit_exact(void)
+{
+    const lv_draw_sw_blend_kernel_t * simd = get_simd_or_skip();
+    const lv_draw_sw_blend_kernel_t * scalar = lv_draw_sw_blend_kernel_get_scalar();
+
+    /*Every width and start offset to hit all the head/body/tail combinations*/
+    int32_t w;
+    for(w = 1; w < 40; w++) {
+        int32_t ofs;
+        for(ofs = 0; ofs < 9; ofs++) {
+            uint16_t color = (uint16_t)rnd();
+            scalar->fill(dest_ref + ofs, BUF_W, w, 3, color);
+            simd->fill(dest_act + ofs, BUF_W, w, 3, color);
+            TEST_ASSERT_EQUAL_MEMORY(dest_ref, dest_act, BUF_W * 4 * sizeof(uint16_t));
+        }
+    }
+}
+
+void test_blend_kernel_fill_mask_is_bit_exact(void)
+{
+    const lv_draw_sw_blend_kernel_t * simd = get_simd_or_skip();
+    const lv_draw_sw_blend_kernel_t * scalar = lv_draw_sw_blend_kernel_get_scalar();
+
+    int32_t w;
+    for(w = 1; w < 40; w++) {
+        int32_t ofs;
+        for(ofs = 0; ofs < 9; ofs++) {
+            uint16_t color = (uint16_t)rnd();
+            scalar->fill_mask(dest_ref + ofs, BUF_W, w, 3, color, mask_buf + w * ofs, w + ofs);
+            simd->fill_mask(dest_act + ofs, BUF_W, w, 3, color, mask_buf + w * ofs, w + ofs);
+            TEST_ASSERT_EQUAL_MEMORY(dest_ref, dest_act, BUF_W * 4 * sizeof(uint16_t));
+        }
+    }
+
+    /*Every mask value*/
+    uint32_t i;
+    for(i = 0; i < 256; i++) mask_buf[i] = (lv_opa_t)i;
+    scalar->fill_mask(dest_ref, 256, 256, 1, 0xF81F, mask_buf, 256);
+    simd->fill_mask(dest_act, 256, 256, 1, 0xF81F, mask_buf, 256);
+    TEST_ASSERT_EQUAL_MEMORY(dest_ref, dest_act, 256 * sizeof(uint16_t));
+}
+
+void test_blend_kernel_map_opa_is_bit_exact(void)
+{
+    const lv_draw_sw_blend_kernel_t * simd = get_simd_or_skip();
+    const lv_draw_sw_blend_kernel_t * scalar = lv_draw_sw_blend_kernel_get_scalar();
+
+    uint32_t opa;
+    for(opa = 0; opa <= 255; opa++) {
+        int32_t w = (int32_t)(opa % 37) + 1;
+        int32_t ofs = (int32_t)(opa % 7);
+        scalar->map_opa(dest_ref + ofs, BUF_W, w, 4, src_buf + opa, w + 3, (lv_opa_t)opa);
+        simd->map_opa(dest_act + ofs, BUF_W, w, 4, src_buf + opa, w + 3, (lv_opa_t)opa);
+        TEST_ASSERT_EQUAL_MEMORY(dest_ref, dest_act, BUF_W * 5 * sizeof(uint16_t));
+    }
+}
+
+static uint32_t bench_mpx_per_sec(const lv_draw_sw_blend_kernel_t * kernel, uint32_t op)
+{
+    uint64_t t_start = lv_test_get_time_us();
+    uint32_t i;
+    for(i = 0; i < BENCH_ROUNDS; i++) {
+        switch(op) {
+            case 0:
+                kernel->fill(dest_act, BUF_W, BUF_W, BUF_H, (uint16_t)i);
+                break;
+            case 1:
+                kernel->fill_mask(dest_act, BUF_W, BUF_W, BUF_H, (uint16_t)i, mask_buf, BUF_W);
+                break;
+            default:
+                kernel->map_opa(dest_act, BUF_W, BUF_W, BUF_H, src_buf, BUF_W, LV_OPA_50);
+                break;
+        }
+    }
+    uint64_t t_elaps = lv_test_get_time_us() - t_start;
+    if(t_elaps == 0) t_elaps = 1;
+
+    /*Pixels per microsecond is Mpx/s*/
+    return (uint32_t)(((uint64_t)BENCH_ROUNDS * BUF_W * BUF_H) / t_elaps);
+}
+
+void test_blend_kernel_benchmark(void)
+{
+    static const char * op_names[] = {"fill", "fill_mask", "map_opa"};
+
+    const lv_draw_sw_blend_kernel_t * kernels[2];
+    kernels[0] = lv_draw_sw_blend_kernel_get_scalar();
+    kernels[1] = lv_draw_sw_blend_kernel_get_simd();
+
+    uint32_t op;
+    for(op = 0; op < 3; op++) {
+        uint32_t k;
+        for(k = 0; k < 2; k++) {
+            if(kernels[k] == NULL) continue;
+            uint32_t mpx = bench_mpx_per_sec(kernels[k], op);
+            TEST_PRINTF("%s %s: %u Mpx/s", kernels[k]->name, op_names[op], mpx);
+        }
+    }
+}
+
+#endif
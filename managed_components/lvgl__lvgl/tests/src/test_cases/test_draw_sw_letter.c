@@ -0,0 +1,106 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_init.h"
+#include "lv_test_helpers.h"
+
+#define DIGITS_FONT_SIZE    70
+#define BENCH_GLYPHS        1000
+
+#if LV_DRAW_COMPLEX
+extern lv_color_t test_fb[];
+static lv_color_t fb_a8[800 * 480];
+#endif
+
+static lv_font_t * font;
+static lv_obj_t * label;
+
+void setUp(void)
+{
+    extern const uint8_t ubuntu_font[];
+    extern size_t ubuntu_font_size;
+    font = lv_tiny_ttf_create_data_ex(ubuntu_font, ubuntu_font_size, DIGITS_FONT_SIZE, 128 * 1024);
+
+    label = lv_label_create(lv_scr_act());
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_obj_set_style_text_color(label, lv_color_hex(0x30c0f0), 0);
+    lv_label_set_text(label, "0123456789\n"
+                      "12:34:56\n"
+                      "98765");
+    lv_obj_set_pos(label, 13, 7);
+}
+
+void tearDown(void)
+{
+    lv_obj_del(label);
+    lv_tiny_ttf_destroy(font);
+}
+
+static uint32_t count_glyphs(const char * txt)
+{
+    uint32_t cnt = 0;
+    for(; *txt; txt++) {
+        if(*txt != '\n') cnt++;
+    }
+    return cnt;
+}
+
+void test_draw_letter_a8_matches_generic_path(void)
+{
+#if LV_DRAW_COMPLEX
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    uint32_t fb_size = lv_disp_get_hor_res(NULL) * lv_disp_get_ver_res(NULL) * sizeof(lv_color_t);
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(fb_a8), fb_size);
+    lv_memcpy(fb_a8, test_fb, fb_size);
+
+    /*A mask which changes nothing but forces the generic, mask buffer based path*/
+    _lv_draw_mask_common_dsc_t mask_dsc;
+    lv_memset_00(&mask_dsc, sizeof(mask_dsc));
+    mask_dsc.cb = lv_test_full_cover_mask_cb;
+    mask_dsc.type = LV_DRAW_MASK_TYPE_FADE;
+    int16_t mask_id = lv_draw_mask_add(&mask_dsc, NULL);
+
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    lv_draw_mask_remove_id(mask_id);
+
+    TEST_ASSERT_EQUAL_MEMORY(fb_a8, test_fb, fb_size);
+#else
+    TEST_PASS();
+#endif
+}
+
+static uint32_t bench_glyphs_us(void)
+{
+    uint32_t glyphs_per_refr = count_glyphs(lv_label_get_text(label));
+
+    /*Warm up the glyph cache of Tiny TTF*/
+    lv_obj_invalidate(label);
+    lv_refr_now(NULL);
+
+    uint32_t glyphs = 0;
+    uint64_t t_start = lv_test_get_time_us();
+    while(glyphs < BENCH_GLYPHS) {
+        lv_obj_invalidate(label);
+        lv_refr_now(NULL);
+        glyphs += glyphs_per_refr;
+    }
+    return (uint32_t)(lv_test_get_time_us() - t_start);
+}
+
+void test_draw_letter_a8_benchmark(void)
+{
+    uint32_t t_a8 = bench_glyphs_us();
+
+    /*An opacity below LV_OPA_MAX makes the glyphs go through the mask buffer*/
+    lv_obj_set_style_text_opa(label, LV_OPA_90, 0);
+    uint32_t t_generic = bench_glyphs_us();
+
+    TEST_PRINTF("%d glyphs of %d px: %u us with the A8 path, %u us with the mask buffer path",
+                BENCH_GLYPHS, DIGITS_FONT_SIZE, t_a8, t_generic);
+}
+
+#endif
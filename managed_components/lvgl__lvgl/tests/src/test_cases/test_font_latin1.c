@@ -0,0 +1,131 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_init.h"
+
+#define BENCH_ROUNDS    5
+#define BENCH_MEASURES  50
+
+/*Like a settings menu or a notification*/
+static const char * menu_txt =
+    "Display\nBrightness: 80%\nScreen timeout: 30 s\nWatch face: Digital\n"
+    "Notifications\nDo not disturb: Off\nVibration: Short\n"
+    "Time & date\nFormat: 24 h\nTime zone: UTC+01:00 (Berlin, Paris, Wien)\n"
+    "About\nFirmware version: 1.4.2\nBattery: 73%, about 2 days left\n"
+    "Caf\xC3\xA9 na\xC3\xAFve \xC3\xA9l\xC3\xA8ve \xC3\x85ngstr\xC3\xB6m Stra\xC3\x9F" "e";
+
+static uint32_t bench_measure(const lv_font_t * font)
+{
+    uint32_t t_min = UINT32_MAX;
+    uint32_t r;
+    for(r = 0; r < BENCH_ROUNDS; r++) {
+        uint32_t i;
+        lv_point_t size;
+        uint64_t t_start = lv_test_get_time_us();
+        for(i = 0; i < BENCH_MEASURES; i++) {
+            lv_txt_get_size(&size, menu_txt, font, 0, 0, 120, LV_TEXT_FLAG_NONE);
+        }
+        t_min = LV_MIN(t_min, (uint32_t)(lv_test_get_time_us() - t_start));
+    }
+    return t_min;
+}
+
+static uint32_t glyph_checksum(const lv_font_t * font)
+{
+    static const uint32_t nexts[] = {0, 'A', 'V', 'o', 0xE9, 0x4E2D};
+    uint32_t sum = 0;
+    uint32_t c;
+    for(c = 0; c < 300; c++) {
+        uint32_t n;
+        for(n = 0; n < sizeof(nexts) / sizeof(nexts[0]); n++) {
+            lv_font_glyph_dsc_t g;
+            bool found = lv_font_get_glyph_dsc(font, &g, c, nexts[n]);
+            sum = sum * 31 + found + g.adv_w * 3 + g.box_w * 5 + g.box_h * 7 + g.ofs_x * 11 + g.ofs_y * 13 + g.bpp;
+        }
+    }
+    return sum;
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_font_latin1_same_size_as_without_table(void)
+{
+    /*The values were measured by looking up each glyph in the character maps*/
+    lv_point_t size;
+    lv_txt_get_size(&size, menu_txt, &lv_font_montserrat_14, 0, 0, 120, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_EQUAL(120, size.x);
+    TEST_ASSERT_EQUAL(400, size.y);
+
+    lv_txt_get_size(&size, menu_txt, &lv_font_montserrat_14, 1, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_EQUAL(341, size.x);
+    TEST_ASSERT_EQUAL(224, size.y);
+
+    /*Kerning*/
+    TEST_ASSERT_EQUAL(20, lv_txt_get_width("AV", 2, &lv_font_montserrat_14, 0, LV_TEXT_FLAG_NONE));
+    TEST_ASSERT_EQUAL(16, lv_txt_get_width("To", 2, &lv_font_montserrat_14, 0, LV_TEXT_FLAG_NONE));
+
+    TEST_ASSERT_EQUAL_UINT32(2648671854u, glyph_checksum(&lv_font_montserrat_14));
+}
+
+void test_font_latin1_tiny_ttf(void)
+{
+#if LV_USE_TINY_TTF
+    extern const uint8_t ubuntu_font[];
+    extern size_t ubuntu_font_size;
+    lv_font_t * font = lv_tiny_ttf_create_data(ubuntu_font, ubuntu_font_size, 20);
+
+    lv_point_t size;
+    lv_txt_get_size(&size, menu_txt, font, 0, 0, 120, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_EQUAL(120, size.x);
+    TEST_ASSERT_EQUAL(620, size.y);
+    TEST_ASSERT_EQUAL(20, lv_txt_get_width("AV", 2, font, 0, LV_TEXT_FLAG_NONE));
+    TEST_ASSERT_EQUAL(20, lv_txt_get_width("To", 2, font, 0, LV_TEXT_FLAG_NONE));
+
+    /*The glyphs are scaled to the new size*/
+    lv_tiny_ttf_set_size(font, 32);
+    lv_txt_get_size(&size, menu_txt, font, 0, 0, 120, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_EQUAL(112, size.x);
+    TEST_ASSERT_EQUAL(1472, size.y);
+    lv_txt_get_size(&size, menu_txt, font, 1, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_EQUAL(713, size.x);
+    TEST_ASSERT_EQUAL(448, size.y);
+    TEST_ASSERT_EQUAL_UINT32(1357815552u, glyph_checksum(font));
+
+    lv_tiny_ttf_set_size(font, 20);
+    TEST_ASSERT_EQUAL_UINT32(4003453376u, glyph_checksum(font));
+
+    /*Draw with the table too*/
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_label_set_text(label, menu_txt);
+    lv_refr_now(NULL);
+    lv_obj_del(label);
+
+    lv_tiny_ttf_destroy(font);
+#endif
+}
+
+void test_font_latin1_benchmark(void)
+{
+    uint32_t t_builtin = bench_measure(&lv_font_montserrat_14);
+#if LV_USE_TINY_TTF
+    extern const uint8_t ubuntu_font[];
+    extern size_t ubuntu_font_size;
+    lv_font_t * font = lv_tiny_ttf_create_data(ubuntu_font, ubuntu_font_size, 20);
+    uint32_t t_ttf = bench_measure(font);
+    lv_tiny_ttf_destroy(font);
+#else
+    uint32_t t_ttf = 0;
+#endif
+    TEST_PRINTF("%d measures of a 14 line text: montserrat %u us, tiny_ttf %u us",
+                BENCH_MEASURES, t_builtin, t_ttf);
+}
+
+#endif
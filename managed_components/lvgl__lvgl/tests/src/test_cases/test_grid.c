@@ -0,0 +1,170 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_init.h"
+
+#define BENCH_UPDATES   60      /*One second of updates at 60 FPS*/
+#define BENCH_ROUNDS    100
+
+static lv_obj_t * grid;
+static lv_obj_t * labels[4];
+static uint32_t layout_cnt;
+
+static void layout_changed_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    layout_cnt++;
+}
+
+/*Like the clock: a column with hours, minutes, seconds and the date*/
+static void create_clock_grid(const lv_coord_t * col_dsc, const lv_coord_t * row_dsc)
+{
+    grid = lv_obj_create(lv_scr_act());
+    lv_obj_set_grid_dsc_array(grid, col_dsc, row_dsc);
+    lv_obj_set_size(grid, 240, 240);
+    lv_obj_center(grid);
+    lv_obj_add_event_cb(grid, layout_changed_cb, LV_EVENT_LAYOUT_CHANGED, NULL);
+
+    static const char * texts[] = {"12", "34", "56", "Mon 01 Jan"};
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        labels[i] = lv_label_create(grid);
+        lv_label_set_text(labels[i], texts[i]);
+        lv_obj_set_grid_cell(labels[i], LV_GRID_ALIGN_CENTER, 0, 1, LV_GRID_ALIGN_CENTER, i, 1);
+    }
+
+    lv_obj_update_layout(grid);
+    layout_cnt = 0;
+}
+
+/*Recalculate everything and check that the children stayed in place*/
+static void assert_same_as_full_layout(void)
+{
+    lv_area_t coords[4];
+    uint32_t i;
+    for(i = 0; i < 4; i++) lv_area_copy(&coords[i], &labels[i]->coords);
+
+    lv_obj_mark_layout_as_dirty(grid);
+    lv_obj_update_layout(grid);
+
+    for(i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL(coords[i].x1, labels[i]->coords.x1);
+        TEST_ASSERT_EQUAL(coords[i].y1, labels[i]->coords.y1);
+        TEST_ASSERT_EQUAL(coords[i].x2, labels[i]->coords.x2);
+        TEST_ASSERT_EQUAL(coords[i].y2, labels[i]->coords.y2);
+    }
+}
+
+void setUp(void)
+{
+    layout_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_grid_repositions_the_changed_cell(void)
+{
+    static const lv_coord_t col_dsc[] = {LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+    static const lv_coord_t row_dsc[] = {LV_GRID_FR(3), LV_GRID_FR(3), LV_GRID_FR(2), LV_GRID_FR(2), LV_GRID_TEMPLATE_LAST};
+    create_clock_grid(col_dsc, row_dsc);
+
+    lv_coord_t hours_x = labels[0]->coords.x1;
+    lv_coord_t seconds_w = lv_obj_get_width(labels[2]);
+
+    lv_label_set_text(labels[2], "56789");
+    lv_obj_update_layout(grid);
+    TEST_ASSERT_GREATER_THAN(seconds_w, lv_obj_get_width(labels[2]));
+    TEST_ASSERT_GREATER_THAN(0, layout_cnt);
+    TEST_ASSERT_EQUAL(hours_x, labels[0]->coords.x1);
+
+    /*Still centered*/
+    lv_coord_t center = grid->coords.x1 + lv_obj_get_width(grid) / 2;
+    TEST_ASSERT_INT_WITHIN(2, center, (labels[2]->coords.x1 + labels[2]->coords.x2) / 2);
+    assert_same_as_full_layout();
+}
+
+void test_grid_recalculates_content_tracks(void)
+{
+    static const lv_coord_t col_dsc[] = {LV_GRID_CONTENT, LV_GRID_TEMPLATE_LAST};
+    static const lv_coord_t row_dsc[] = {LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT,
+                                         LV_GRID_TEMPLATE_LAST
+                                        };
+    create_clock_grid(col_dsc, row_dsc);
+    lv_obj_set_grid_align(grid, LV_GRID_ALIGN_START, LV_GRID_ALIGN_START);
+    lv_obj_update_layout(grid);
+
+    /*The date is the widest, its column and row grow, so the items below move*/
+    lv_coord_t seconds_y = labels[2]->coords.y1;
+    lv_label_set_text(labels[0], "12345678901234567890\n12");
+    lv_obj_update_layout(grid);
+    TEST_ASSERT_GREATER_THAN(seconds_y, labels[2]->coords.y1);
+    assert_same_as_full_layout();
+
+    /*A child with a new cell*/
+    lv_obj_set_grid_cell(labels[3], LV_GRID_ALIGN_END, 0, 1, LV_GRID_ALIGN_START, 0, 1);
+    lv_obj_update_layout(grid);
+    TEST_ASSERT_EQUAL(labels[0]->coords.y1, labels[3]->coords.y1);
+    assert_same_as_full_layout();
+}
+
+void test_grid_handles_new_and_deleted_children(void)
+{
+    static const lv_coord_t col_dsc[] = {LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+    static const lv_coord_t row_dsc[] = {LV_GRID_FR(3), LV_GRID_FR(3), LV_GRID_FR(2), LV_GRID_FR(2), LV_GRID_TEMPLATE_LAST};
+    create_clock_grid(col_dsc, row_dsc);
+
+    lv_obj_t * extra = lv_label_create(grid);
+    lv_label_set_text(extra, "x");
+    lv_obj_set_grid_cell(extra, LV_GRID_ALIGN_END, 0, 1, LV_GRID_ALIGN_END, 3, 1);
+    lv_obj_update_layout(grid);
+    TEST_ASSERT_GREATER_THAN(labels[3]->coords.x2, extra->coords.x2);
+
+    lv_obj_del(labels[1]);
+    labels[1] = lv_label_create(grid);
+    lv_label_set_text(labels[1], "34");
+    lv_obj_set_grid_cell(labels[1], LV_GRID_ALIGN_START, 0, 1, LV_GRID_ALIGN_CENTER, 1, 1);
+    lv_obj_update_layout(grid);
+    TEST_ASSERT_LESS_THAN(labels[0]->coords.x1, labels[1]->coords.x1);
+
+    lv_label_set_text(labels[2], "5");
+    lv_obj_update_layout(grid);
+    assert_same_as_full_layout();
+}
+
+static uint32_t bench_updates(bool full)
+{
+    /*Measure only the layout, not setting the text*/
+    uint32_t t_min = UINT32_MAX;
+    uint32_t r;
+    for(r = 0; r < BENCH_ROUNDS; r++) {
+        uint32_t i;
+        uint32_t t = 0;
+        for(i = 0; i < BENCH_UPDATES; i++) {
+            lv_label_set_text_fmt(labels[2], "%d", (int)(i % 2 ? 1 : 10));
+            if(full) lv_obj_mark_layout_as_dirty(grid);     /*Like before the tracks were cached*/
+            uint64_t t_start = lv_test_get_time_us();
+            lv_obj_update_layout(grid);
+            t += (uint32_t)(lv_test_get_time_us() - t_start);
+        }
+        t_min = LV_MIN(t_min, t);
+    }
+    return t_min;
+}
+
+void test_grid_benchmark(void)
+{
+    static const lv_coord_t col_dsc[] = {LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+    static const lv_coord_t row_dsc[] = {LV_GRID_FR(3), LV_GRID_FR(3), LV_GRID_FR(2), LV_GRID_FR(2), LV_GRID_TEMPLATE_LAST};
+    create_clock_grid(col_dsc, row_dsc);
+
+    uint32_t t_full = bench_updates(true);
+    uint32_t t_cached = bench_updates(false);
+    TEST_PRINTF("%d updates of the seconds in a 4 row grid: full layout %u us, cached tracks %u us",
+                BENCH_UPDATES, t_full, t_cached);
+}
+
+#endif
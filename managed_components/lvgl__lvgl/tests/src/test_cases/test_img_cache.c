@@ -0,0 +1,261 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_init.h"
+
+#define IMG_CNT     48
+#define IMG_W       16
+#define IMG_H       16
+#define BENCH_OPS   100000
+
+static lv_img_decoder_t * decoder;
+static lv_img_dsc_t imgs[IMG_CNT];
+static uint32_t open_times[IMG_CNT];
+static uint32_t open_cnt;
+
+static lv_res_t fake_info_cb(lv_img_decoder_t * dec, const void * src, lv_img_header_t * header)
+{
+    LV_UNUSED(dec);
+    if(lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) return LV_RES_INV;
+
+    const lv_img_dsc_t * img = src;
+    if(img->header.cf != LV_IMG_CF_USER_ENCODED_0) return LV_RES_INV;
+
+    *header = img->header;
+    header->cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    return LV_RES_OK;
+}
+
+static lv_res_t fake_open_cb(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(dec);
+
+    /*Decode to a new buffer like PNG and take as long as set in `open_times`*/
+    const lv_img_dsc_t * img = dsc->src;
+    dsc->img_data = lv_mem_alloc(lv_img_buf_get_img_size(img->header.w, img->header.h, LV_IMG_CF_TRUE_COLOR_ALPHA));
+    dsc->time_to_open = *(const uint32_t *)img->data;
+    open_cnt++;
+    return LV_RES_OK;
+}
+
+static void fake_close_cb(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(dec);
+    lv_mem_free((void *)dsc->img_data);
+}
+
+void setUp(void)
+{
+    decoder = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(decoder, fake_info_cb);
+    lv_img_decoder_set_open_cb(decoder, fake_open_cb);
+    lv_img_decoder_set_close_cb(decoder, fake_close_cb);
+
+    uint32_t i;
+    for(i = 0; i < IMG_CNT; i++) {
+        open_times[i] = 1;
+        imgs[i].header.cf = LV_IMG_CF_USER_ENCODED_0;
+        imgs[i].header.w = IMG_W;
+        imgs[i].header.h = IMG_H;
+        imgs[i].data = (const uint8_t *)&open_times[i];
+        imgs[i].data_size = sizeof(uint32_t);
+    }
+    open_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_img_cache_invalidate_src(NULL);
+    lv_img_cache_set_budget(0);
+    lv_img_cache_set_size(LV_IMG_CACHE_DEF_SIZE);
+    lv_img_decoder_delete(decoder);
+    lv_obj_clean(lv_scr_act());
+}
+
+#if LV_IMG_CACHE_DEF_SIZE
+static bool is_cached(uint32_t id)
+{
+    uint32_t cnt = open_cnt;
+    _lv_img_cache_open(&imgs[id], lv_color_black(), 0);
+    if(cnt == open_cnt) return true;
+
+    /*It was opened now, remove it to leave the cache as it was*/
+    lv_img_cache_invalidate_src(&imgs[id]);
+    return false;
+}
+#endif
+
+void test_img_cache_hit_and_miss(void)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    lv_img_cache_info_t info_start;
+    lv_img_cache_get_info(&info_start);
+
+    uint32_t i;
+    for(i = 0; i < LV_IMG_CACHE_DEF_SIZE; i++) {
+        TEST_ASSERT_NOT_NULL(_lv_img_cache_open(&imgs[i], lv_color_black(), 0));
+    }
+    for(i = 0; i < LV_IMG_CACHE_DEF_SIZE; i++) {
+        _lv_img_cache_entry_t * entry = _lv_img_cache_open(&imgs[i], lv_color_black(), 0);
+        TEST_ASSERT_EQUAL_PTR(&imgs[i], entry->dec_dsc.src);
+    }
+    TEST_ASSERT_EQUAL_UINT32(LV_IMG_CACHE_DEF_SIZE, open_cnt);
+
+    /*The color and the frame are part of the key*/
+    _lv_img_cache_open(&imgs[0], lv_color_white(), 0);
+    _lv_img_cache_open(&imgs[0], lv_color_black(), 1);
+    TEST_ASSERT_EQUAL_UINT32(LV_IMG_CACHE_DEF_SIZE + 2, open_cnt);
+
+    lv_img_cache_info_t info;
+    lv_img_cache_get_info(&info);
+    TEST_ASSERT_EQUAL_UINT32(info_start.hit_cnt + LV_IMG_CACHE_DEF_SIZE, info.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(info_start.miss_cnt + LV_IMG_CACHE_DEF_SIZE + 2, info.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT16(LV_IMG_CACHE_DEF_SIZE, info.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT16(LV_IMG_CACHE_DEF_SIZE, info.used_entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_IMG_CACHE_DEF_SIZE * IMG_W * IMG_H * LV_IMG_PX_SIZE_ALPHA_BYTE, info.used_size);
+#endif
+}
+
+void test_img_cache_budget(void)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    uint32_t img_size = IMG_W * IMG_H * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    lv_img_cache_set_budget(3 * img_size);
+
+    uint32_t i;
+    for(i = 0; i < 5; i++) _lv_img_cache_open(&imgs[i], lv_color_black(), 0);
+
+    lv_img_cache_info_t info;
+    lv_img_cache_get_info(&info);
+    TEST_ASSERT_EQUAL_UINT32(3 * img_size, info.used_size);
+    TEST_ASSERT_EQUAL_UINT32(3 * img_size, info.total_size);
+    TEST_ASSERT_EQUAL_UINT16(3, info.used_entry_cnt);
+
+    /*The most recently used ones are kept*/
+    TEST_ASSERT_TRUE(is_cached(4));
+    TEST_ASSERT_TRUE(is_cached(3));
+    TEST_ASSERT_TRUE(is_cached(2));
+    TEST_ASSERT_FALSE(is_cached(0));
+
+    /*Reducing the budget closes images immediately*/
+    lv_img_cache_set_budget(img_size);
+    lv_img_cache_get_info(&info);
+    TEST_ASSERT_EQUAL_UINT16(1, info.used_entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(img_size, info.used_size);
+#endif
+}
+
+void test_img_cache_keeps_slow_images(void)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    uint32_t img_size = IMG_W * IMG_H * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    lv_img_cache_set_budget(4 * img_size);
+
+    /*Image 0 is slow to open so it survives many fast images*/
+    open_times[0] = 100;
+    _lv_img_cache_open(&imgs[0], lv_color_black(), 0);
+
+    uint32_t i;
+    for(i = 1; i < 20; i++) _lv_img_cache_open(&imgs[i], lv_color_black(), 0);
+    TEST_ASSERT_TRUE(is_cached(0));
+    TEST_ASSERT_TRUE(is_cached(19));
+    TEST_ASSERT_FALSE(is_cached(1));
+
+    /*But it's closed if it's not used for long*/
+    uint32_t round;
+    for(round = 0; round < 20; round++) {
+        for(i = 1; i < IMG_CNT; i++) _lv_img_cache_open(&imgs[i], lv_color_black(), 0);
+    }
+    TEST_ASSERT_FALSE(is_cached(0));
+#endif
+}
+
+void test_img_cache_invalidate(void)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    _lv_img_cache_open(&imgs[0], lv_color_black(), 0);
+    _lv_img_cache_open(&imgs[0], lv_color_black(), 1);
+    _lv_img_cache_open(&imgs[1], lv_color_black(), 0);
+
+    /*Every frame and color of the source is removed*/
+    lv_img_cache_invalidate_src(&imgs[0]);
+    lv_img_cache_info_t info;
+    lv_img_cache_get_info(&info);
+    TEST_ASSERT_EQUAL_UINT16(1, info.used_entry_cnt);
+    TEST_ASSERT_TRUE(is_cached(1));
+    TEST_ASSERT_FALSE(is_cached(0));
+
+    lv_img_cache_invalidate_src(NULL);
+    lv_img_cache_get_info(&info);
+    TEST_ASSERT_EQUAL_UINT16(0, info.used_entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, info.used_size);
+#endif
+}
+
+#if LV_IMG_CACHE_DEF_SIZE && (LV_USE_PNG || (LV_USE_BMP && LV_COLOR_DEPTH == 32))
+static void draw_file(const char * path)
+{
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_img_set_src(img, path);
+
+    lv_img_cache_info_t info_start;
+    lv_img_cache_get_info(&info_start);
+
+    lv_obj_invalidate(img);
+    lv_refr_now(NULL);
+    lv_obj_invalidate(img);
+    lv_refr_now(NULL);
+
+    /*Opened once, drawn from the cache afterwards*/
+    lv_img_cache_info_t info;
+    lv_img_cache_get_info(&info);
+    TEST_ASSERT_EQUAL_UINT32(info_start.miss_cnt + 1, info.miss_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(info_start.hit_cnt, info.hit_cnt);
+}
+#endif
+
+void test_img_cache_png(void)
+{
+#if LV_IMG_CACHE_DEF_SIZE && LV_USE_PNG
+    draw_file("A:src/test_files/img_cache_test.png");
+
+    /*PNG is decoded to a buffer which is kept in the cache*/
+    lv_img_cache_info_t info;
+    lv_img_cache_get_info(&info);
+    TEST_ASSERT_EQUAL_UINT32(lv_img_buf_get_img_size(24, 24, LV_IMG_CF_TRUE_COLOR_ALPHA), info.used_size);
+#endif
+}
+
+void test_img_cache_bmp(void)
+{
+#if LV_IMG_CACHE_DEF_SIZE && LV_USE_BMP && LV_COLOR_DEPTH == 32
+    draw_file("A:src/test_files/img_cache_test.bmp");
+
+    /*BMP is read line by line so only the file is kept open*/
+    lv_img_cache_info_t info;
+    lv_img_cache_get_info(&info);
+    TEST_ASSERT_EQUAL_UINT32(0, info.used_size);
+    TEST_ASSERT_EQUAL_UINT16(1, info.used_entry_cnt);
+#endif
+}
+
+void test_img_cache_benchmark(void)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    uint32_t i;
+    for(i = 0; i < LV_IMG_CACHE_DEF_SIZE; i++) _lv_img_cache_open(&imgs[i], lv_color_black(), 0);
+
+    /*Like a watch face with many icons: every open is a hit*/
+    uint64_t t_start = lv_test_get_time_us();
+    for(i = 0; i < BENCH_OPS; i++) {
+        _lv_img_cache_open(&imgs[(i * 7) % LV_IMG_CACHE_DEF_SIZE], lv_color_black(), 0);
+    }
+    uint32_t t_elaps = (uint32_t)(lv_test_get_time_us() - t_start);
+
+    TEST_PRINTF("%d cached images, %d opens: %u us", LV_IMG_CACHE_DEF_SIZE, BENCH_OPS, t_elaps);
+    TEST_ASSERT_EQUAL_UINT32(LV_IMG_CACHE_DEF_SIZE, open_cnt);
+#endif
+}
+
+#endif
@@ -0,0 +1,256 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_init.h"
+
+#define BENCH_UPDATES   60      /*One minute of seconds*/
+#define BENCH_ROUNDS    100
+
+static lv_obj_t * grid;
+static lv_obj_t * labels[3];
+
+/*Like the clock: a column with hours, minutes and seconds in a monospace font*/
+static void create_clock_grid(void)
+{
+    static const lv_coord_t col_dsc[] = {LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+    static const lv_coord_t row_dsc[] = {LV_GRID_FR(3), LV_GRID_FR(3), LV_GRID_FR(2), LV_GRID_TEMPLATE_LAST};
+
+    grid = lv_obj_create(lv_scr_act());
+    lv_obj_set_grid_dsc_array(grid, col_dsc, row_dsc);
+    lv_obj_set_size(grid, 240, 240);
+    lv_obj_center(grid);
+    lv_obj_set_style_text_font(grid, &lv_font_unscii_8, 0);
+
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        labels[i] = lv_label_create(grid);
+        lv_label_set_text(labels[i], "00");
+        lv_obj_set_grid_cell(labels[i], LV_GRID_ALIGN_CENTER, 0, 1, LV_GRID_ALIGN_CENTER, i, 1);
+    }
+
+    lv_obj_update_layout(grid);
+}
+
+void setUp(void)
+{
+    create_clock_grid();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_label_fixed_width_replaces_the_text_in_place(void)
+{
+    lv_obj_t * label = labels[2];
+    lv_label_set_fixed_width(label, true);
+    TEST_ASSERT_TRUE(lv_label_get_fixed_width(label));
+
+    char * txt = lv_label_get_text(label);
+    lv_area_t coords;
+    lv_area_copy(&coords, &label->coords);
+
+    lv_label_set_text(label, "42");
+    TEST_ASSERT_EQUAL_STRING("42", lv_label_get_text(label));
+    TEST_ASSERT_EQUAL_PTR(txt, lv_label_get_text(label));
+    TEST_ASSERT_FALSE(label->layout_inv);
+    TEST_ASSERT_FALSE(lv_scr_act()->scr_layout_inv);
+
+    lv_label_set_text_fmt(label, "%02d", 7);
+    TEST_ASSERT_EQUAL_STRING("07", lv_label_get_text(label));
+    TEST_ASSERT_EQUAL_PTR(txt, lv_label_get_text(label));
+    TEST_ASSERT_FALSE(lv_scr_act()->scr_layout_inv);
+
+    lv_obj_update_layout(grid);
+    TEST_ASSERT_EQUAL(coords.x1, label->coords.x1);
+    TEST_ASSERT_EQUAL(coords.x2, label->coords.x2);
+    TEST_ASSERT_EQUAL(coords.y2, label->coords.y2);
+}
+
+void test_label_fixed_width_falls_back_if_the_size_changes(void)
+{
+    lv_obj_t * label = labels[2];
+    lv_label_set_fixed_width(label, true);
+    lv_coord_t w = lv_obj_get_width(label);
+    lv_coord_t h = lv_obj_get_height(label);
+
+    lv_label_set_text(label, "123");
+    lv_obj_update_layout(grid);
+    TEST_ASSERT_EQUAL_STRING("123", lv_label_get_text(label));
+    TEST_ASSERT_GREATER_THAN(w, lv_obj_get_width(label));
+
+    lv_label_set_text(label, "1\n2");
+    lv_obj_update_layout(grid);
+    TEST_ASSERT_GREATER_THAN(h, lv_obj_get_height(label));
+
+    lv_label_set_text_fmt(label, "%02d", 5);
+    lv_obj_update_layout(grid);
+    TEST_ASSERT_EQUAL_STRING("05", lv_label_get_text(label));
+    TEST_ASSERT_EQUAL(w, lv_obj_get_width(label));
+    TEST_ASSERT_EQUAL(h, lv_obj_get_height(label));
+
+    /*A space can change how the text is wrapped*/
+    lv_label_set_text(label, "0 ");
+    TEST_ASSERT_TRUE(lv_scr_act()->scr_layout_inv);
+    lv_obj_update_layout(grid);
+
+    /*Proportional font*/
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_14, 0);
+    lv_label_set_text(label, "11");
+    lv_obj_update_layout(grid);
+    w = lv_obj_get_width(label);
+    lv_label_set_text(label, "00");
+    lv_obj_update_layout(grid);
+    TEST_ASSERT_NOT_EQUAL(w, lv_obj_get_width(label));
+}
+
+void test_label_fixed_width_long_text_fmt(void)
+{
+    lv_obj_t * label = labels[2];
+    lv_label_set_fixed_width(label, true);
+
+    lv_label_set_text_fmt(label, "%s %s", "this text doesn't fit to the stack buffer",
+                          "so it's allocated as usual");
+    TEST_ASSERT_EQUAL_STRING("this text doesn't fit to the stack buffer so it's allocated as usual",
+                             lv_label_get_text(label));
+}
+
+static lv_obj_t * create_long_label(lv_obj_t * parent)
+{
+    static char txt[2048];
+    uint32_t len = 0;
+    uint32_t i;
+    for(i = 0; i < 30; i++) {
+        len += lv_snprintf(&txt[len], sizeof(txt) - len, "Notification %d: the meeting starts in %d minutes\n",
+                           (int)i, (int)i * 5);
+    }
+
+    lv_obj_t * label = lv_label_create(parent);
+    lv_label_set_text_static(label, txt);
+    lv_obj_set_width(label, 200);
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
+    return label;
+}
+
+void test_label_line_cache_matches_the_text_size(void)
+{
+    lv_obj_t * label = create_long_label(lv_scr_act());
+    lv_obj_update_layout(label);
+
+    const lv_font_t * font = lv_obj_get_style_text_font(label, LV_PART_MAIN);
+    lv_point_t size;
+    lv_txt_get_size(&size, lv_label_get_text(label), font, 0, 0, 200, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_EQUAL(size.y, lv_obj_get_height(label));
+
+    lv_obj_set_width(label, LV_SIZE_CONTENT);
+    lv_obj_update_layout(label);
+    lv_txt_get_size(&size, lv_label_get_text(label), font, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_EQUAL(size.x, lv_obj_get_width(label));
+    TEST_ASSERT_EQUAL(size.y, lv_obj_get_height(label));
+
+    /*The new line at the end adds a line*/
+    lv_label_set_text(label, "a\nb\n");
+    lv_obj_update_layout(label);
+    lv_txt_get_size(&size, "a\nb\n", font, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_EQUAL(size.y, lv_obj_get_height(label));
+
+    lv_label_set_text(label, "");
+    lv_obj_update_layout(label);
+    TEST_ASSERT_EQUAL(lv_font_get_line_height(font), lv_obj_get_height(label));
+}
+
+void test_label_line_cache_is_kept_while_scrolling(void)
+{
+#if LV_LABEL_LINE_CACHE
+    lv_obj_t * label = create_long_label(grid);
+    lv_obj_add_flag(label, LV_OBJ_FLAG_IGNORE_LAYOUT);
+    lv_refr_now(NULL);
+
+    lv_label_t * l = (lv_label_t *)label;
+    const lv_draw_label_line_t * lines = l->lines;
+    TEST_ASSERT_NOT_NULL(lines);
+    TEST_ASSERT_GREATER_THAN(30, l->line_cnt);
+    TEST_ASSERT_EQUAL(strlen(lv_label_get_text(label)), lines[l->line_cnt].start);
+
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_obj_scroll_by(grid, 0, -10, LV_ANIM_OFF);
+        lv_refr_now(NULL);
+    }
+    TEST_ASSERT_EQUAL_PTR(lines, l->lines);
+
+    /*Recalculated for a new text and width*/
+    lv_label_set_text(label, "short\ntext");
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(2, l->line_cnt);
+
+    /*Single lines are not stored*/
+    lv_label_set_text(label, "a longer text which is wrapped");
+    lv_obj_set_width(label, 300);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NULL(l->lines);
+    lv_obj_set_width(label, 60);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_NULL(l->lines);
+    TEST_ASSERT_GREATER_THAN(2, l->line_cnt);
+#endif
+}
+
+static uint32_t bench_updates(void)
+{
+    uint32_t t_min = UINT32_MAX;
+    uint32_t r;
+    for(r = 0; r < BENCH_ROUNDS; r++) {
+        uint32_t i;
+        uint64_t t_start = lv_test_get_time_us();
+        for(i = 0; i < BENCH_UPDATES; i++) {
+            lv_label_set_text_fmt(labels[2], "%02d", (int)i);
+            lv_obj_update_layout(grid);
+        }
+        t_min = LV_MIN(t_min, (uint32_t)(lv_test_get_time_us() - t_start));
+    }
+    return t_min;
+}
+
+static uint32_t bench_scroll(lv_obj_t * cont)
+{
+    uint32_t t_min = UINT32_MAX;
+    uint32_t r;
+    for(r = 0; r < 5; r++) {
+        lv_obj_scroll_to_y(cont, 0, LV_ANIM_OFF);
+        lv_refr_now(NULL);
+        uint32_t i;
+        uint64_t t_start = lv_test_get_time_us();
+        for(i = 0; i < BENCH_UPDATES; i++) {
+            lv_obj_scroll_by(cont, 0, -4, LV_ANIM_OFF);
+            lv_refr_now(NULL);
+        }
+        t_min = LV_MIN(t_min, (uint32_t)(lv_test_get_time_us() - t_start));
+    }
+    return t_min;
+}
+
+void test_label_scroll_benchmark(void)
+{
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, 240, 240);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    create_long_label(cont);
+    create_long_label(cont);
+
+    uint32_t t = bench_scroll(cont);
+    TEST_PRINTF("%d frames scrolling two 30 line labels: %u us/frame", BENCH_UPDATES, t / BENCH_UPDATES);
+}
+
+void test_label_benchmark(void)
+{
+    uint32_t t_normal = bench_updates();
+    lv_label_set_fixed_width(labels[2], true);
+    uint32_t t_fixed = bench_updates();
+    TEST_PRINTF("%d updates of the seconds in a 3 row grid: normal %u us, fixed width %u us",
+                BENCH_UPDATES, t_normal, t_fixed);
+}
+
+#endif
@@ -0,0 +1,229 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../src/misc/lv_lru.h"
+
+#include "unity/unity.h"
+#include "lv_test_init.h"
+
+#define VALUE_CNT       1024
+#define SMALL_ITEM_CNT  256
+#define BENCH_ITEMS     256
+#define BENCH_OPS       200000
+
+static lv_lru_t * lru;
+static uint32_t values[VALUE_CNT];
+static uint32_t freed_cnt;
+static void * last_freed;
+
+static void value_free_cb(void * v)
+{
+    freed_cnt++;
+    last_freed = v;
+}
+
+void setUp(void)
+{
+    freed_cnt = 0;
+    last_freed = NULL;
+    lru = NULL;
+}
+
+void tearDown(void)
+{
+    if(lru) lv_lru_del(lru);
+}
+
+static void * get(uint32_t key)
+{
+    void * value = NULL;
+    TEST_ASSERT_EQUAL(LV_LRU_OK, lv_lru_get(lru, &key, sizeof(key), &value));
+    return value;
+}
+
+static void set(uint32_t key, size_t len)
+{
+    TEST_ASSERT_EQUAL(LV_LRU_OK, lv_lru_set(lru, &key, sizeof(key), &values[key], len));
+}
+
+void test_lru_set_and_get(void)
+{
+    lru = lv_lru_create(100, 10, value_free_cb, NULL);
+    TEST_ASSERT_NOT_NULL(lru);
+
+    set(1, 10);
+    set(2, 10);
+    set(3, 10);
+    TEST_ASSERT_EQUAL_PTR(&values[1], get(1));
+    TEST_ASSERT_EQUAL_PTR(&values[2], get(2));
+    TEST_ASSERT_EQUAL_PTR(&values[3], get(3));
+    TEST_ASSERT_NULL(get(4));
+    TEST_ASSERT_EQUAL_UINT32(70, lru->free_memory);
+    TEST_ASSERT_EQUAL_UINT32(0, freed_cnt);
+}
+
+void test_lru_evicts_least_recently_used(void)
+{
+    lru = lv_lru_create(100, 30, value_free_cb, NULL);
+
+    set(1, 30);
+    set(2, 30);
+    set(3, 30);
+
+    /*Make 2 the least recently used one*/
+    get(1);
+    get(3);
+
+    set(4, 30);
+    TEST_ASSERT_EQUAL_UINT32(1, freed_cnt);
+    TEST_ASSERT_EQUAL_PTR(&values[2], last_freed);
+    TEST_ASSERT_NULL(get(2));
+    TEST_ASSERT_NOT_NULL(get(1));
+
+    /*Needs the space of two items*/
+    set(5, 60);
+    TEST_ASSERT_EQUAL_UINT32(3, freed_cnt);
+    TEST_ASSERT_NULL(get(3));
+    TEST_ASSERT_NULL(get(4));
+    TEST_ASSERT_NOT_NULL(get(1));
+    TEST_ASSERT_NOT_NULL(get(5));
+    TEST_ASSERT_EQUAL_UINT32(10, lru->free_memory);
+}
+
+void test_lru_update_value(void)
+{
+    lru = lv_lru_create(100, 10, value_free_cb, NULL);
+
+    uint32_t key = 7;
+    set(key, 10);
+    TEST_ASSERT_EQUAL(LV_LRU_OK, lv_lru_set(lru, &key, sizeof(key), &values[8], 40));
+    TEST_ASSERT_EQUAL_UINT32(1, freed_cnt);
+    TEST_ASSERT_EQUAL_PTR(&values[7], last_freed);
+    TEST_ASSERT_EQUAL_PTR(&values[8], get(key));
+    TEST_ASSERT_EQUAL_UINT32(60, lru->free_memory);
+}
+
+void test_lru_remove(void)
+{
+    lru = lv_lru_create(100, 10, value_free_cb, NULL);
+
+    uint32_t i;
+    for(i = 0; i < 10; i++) set(i, 10);
+
+    for(i = 0; i < 10; i += 2) {
+        TEST_ASSERT_EQUAL(LV_LRU_OK, lv_lru_remove(lru, &i, sizeof(i)));
+    }
+    TEST_ASSERT_EQUAL_UINT32(5, freed_cnt);
+    TEST_ASSERT_EQUAL_UINT32(50, lru->free_memory);
+
+    for(i = 0; i < 10; i++) {
+        if(i % 2) TEST_ASSERT_EQUAL_PTR(&values[i], get(i));
+        else TEST_ASSERT_NULL(get(i));
+    }
+
+    /*Removing a missing key is not an error*/
+    i = 100;
+    TEST_ASSERT_EQUAL(LV_LRU_OK, lv_lru_remove(lru, &i, sizeof(i)));
+}
+
+void test_lru_remove_lru_item(void)
+{
+    lru = lv_lru_create(100, 10, value_free_cb, NULL);
+
+    set(1, 10);
+    set(2, 10);
+    get(1);
+    lv_lru_remove_lru_item(lru);
+    TEST_ASSERT_EQUAL_PTR(&values[2], last_freed);
+    lv_lru_remove_lru_item(lru);
+    TEST_ASSERT_EQUAL_PTR(&values[1], last_freed);
+
+    /*Empty cache*/
+    lv_lru_remove_lru_item(lru);
+    TEST_ASSERT_EQUAL_UINT32(2, freed_cnt);
+    TEST_ASSERT_EQUAL_UINT32(100, lru->free_memory);
+}
+
+void test_lru_errors(void)
+{
+    lru = lv_lru_create(100, 10, value_free_cb, NULL);
+
+    uint32_t key = 1;
+    TEST_ASSERT_EQUAL(LV_LRU_VALUE_TOO_LARGE, lv_lru_set(lru, &key, sizeof(key), &values[1], 101));
+    TEST_ASSERT_EQUAL(LV_LRU_MISSING_VALUE, lv_lru_set(lru, &key, sizeof(key), NULL, 10));
+    TEST_ASSERT_EQUAL(LV_LRU_MISSING_KEY, lv_lru_set(lru, NULL, sizeof(key), &values[1], 10));
+    TEST_ASSERT_EQUAL(LV_LRU_MISSING_CACHE, lv_lru_set(NULL, &key, sizeof(key), &values[1], 10));
+}
+
+void test_lru_many_small_items(void)
+{
+    /*Much more items than the average length suggests*/
+    lru = lv_lru_create(SMALL_ITEM_CNT, 64, value_free_cb, NULL);
+
+    uint32_t i;
+    for(i = 0; i < SMALL_ITEM_CNT; i++) set(i, 1);
+    for(i = 0; i < SMALL_ITEM_CNT; i++) TEST_ASSERT_EQUAL_PTR(&values[i], get(i));
+    TEST_ASSERT_EQUAL_UINT32(0, freed_cnt);
+
+    /*Evicts the oldest one*/
+    uint32_t key = SMALL_ITEM_CNT;
+    TEST_ASSERT_EQUAL(LV_LRU_OK, lv_lru_set(lru, &key, sizeof(key), &values[0], 1));
+    TEST_ASSERT_EQUAL_UINT32(1, freed_cnt);
+    TEST_ASSERT_NULL(get(0));
+}
+
+void test_lru_long_keys(void)
+{
+    lru = lv_lru_create(1000, 10, value_free_cb, NULL);
+
+    char key[64];
+    uint32_t i;
+    for(i = 0; i < 50; i++) {
+        lv_memset(key, 'a' + i % 26, sizeof(key));
+        key[0] = (char)i;
+        TEST_ASSERT_EQUAL(LV_LRU_OK, lv_lru_set(lru, key, sizeof(key), &values[i], 10));
+    }
+
+    for(i = 0; i < 50; i++) {
+        lv_memset(key, 'a' + i % 26, sizeof(key));
+        key[0] = (char)i;
+        void * value;
+        lv_lru_get(lru, key, sizeof(key), &value);
+        TEST_ASSERT_EQUAL_PTR(&values[i], value);
+
+        /*Same prefix, different length*/
+        lv_lru_get(lru, key, sizeof(key) - 1, &value);
+        TEST_ASSERT_NULL(value);
+    }
+}
+
+void test_lru_benchmark(void)
+{
+    lru = lv_lru_create(BENCH_ITEMS * 16, 16, value_free_cb, NULL);
+
+    uint32_t i;
+    for(i = 0; i < BENCH_ITEMS; i++) set(i, 16);
+
+    /*Hits only*/
+    uint32_t rnd = 1;
+    uint64_t t_start = lv_test_get_time_us();
+    for(i = 0; i < BENCH_OPS; i++) {
+        rnd = rnd * 1103515245 + 12345;
+        uint32_t key = (rnd >> 16) % BENCH_ITEMS;
+        void * value;
+        lv_lru_get(lru, &key, sizeof(key), &value);
+    }
+    uint32_t t_get = (uint32_t)(lv_test_get_time_us() - t_start);
+
+    /*Every set evicts an item*/
+    t_start = lv_test_get_time_us();
+    for(i = 0; i < BENCH_OPS; i++) {
+        uint32_t key = BENCH_ITEMS + i;
+        lv_lru_set(lru, &key, sizeof(key), &values[i % VALUE_CNT], 16);
+    }
+    uint32_t t_set = (uint32_t)(lv_test_get_time_us() - t_start);
+
+    TEST_PRINTF("%d items, %d ops: get %u us, set with eviction %u us", BENCH_ITEMS, BENCH_OPS, t_get, t_set);
+    TEST_ASSERT_EQUAL_UINT32(BENCH_OPS, freed_cnt);
+}
+
+#endif
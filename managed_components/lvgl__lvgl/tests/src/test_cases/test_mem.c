@@ -2,6 +2,9 @@
 #include "../lvgl.h"
 
 #include "unity/unity.h"
+#include "lv_test_init.h"
+
+#define BENCH_SCREENS   200
 
 void setUp(void)
 {
@@ -23,4 +26,149 @@ void test_mem_buf_realloc(void)
 #endif
 }
 
+#ifdef LV_MEM_SLAB_CLASS_CNT
+static uint32_t slab_used_cnt(uint32_t block_size)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        if(mon.slab[i].block_size == block_size) return mon.slab[i].used_cnt;
+    }
+    return 0;
+}
+#endif
+
+void test_mem_slab_alloc_free(void)
+{
+#ifdef LV_MEM_SLAB_CLASS_CNT
+    uint32_t used_16 = slab_used_cnt(16);
+    uint32_t used_96 = slab_used_cnt(96);
+
+    void * p1 = lv_mem_alloc(5);
+    void * p2 = lv_mem_alloc(16);
+    void * p3 = lv_mem_alloc(80);
+    TEST_ASSERT_EQUAL_UINT32(used_16 + 2, slab_used_cnt(16));
+    TEST_ASSERT_EQUAL_UINT32(used_96 + 1, slab_used_cnt(96));
+
+    lv_memset(p1, 0x11, 5);
+    lv_memset(p2, 0x22, 16);
+    lv_memset(p3, 0x33, 80);
+    TEST_ASSERT_EACH_EQUAL_HEX8(0x11, p1, 5);
+    TEST_ASSERT_EACH_EQUAL_HEX8(0x22, p2, 16);
+
+    /*The freed block is reused*/
+    lv_mem_free(p2);
+    void * p4 = lv_mem_alloc(10);
+    TEST_ASSERT_EQUAL_PTR(p2, p4);
+
+    lv_mem_free(p1);
+    lv_mem_free(p3);
+    lv_mem_free(p4);
+    TEST_ASSERT_EQUAL_UINT32(used_16, slab_used_cnt(16));
+    TEST_ASSERT_EQUAL_UINT32(used_96, slab_used_cnt(96));
+#endif
+}
+
+void test_mem_slab_realloc(void)
+{
+#ifdef LV_MEM_SLAB_CLASS_CNT
+    uint8_t * p = lv_mem_alloc(20);
+    uint32_t i;
+    for(i = 0; i < 20; i++) p[i] = (uint8_t)i;
+
+    /*Fits into the same 32 byte block*/
+    TEST_ASSERT_EQUAL_PTR(p, lv_mem_realloc(p, 30));
+
+    /*Moves to a larger class and then out of the slabs*/
+    p = lv_mem_realloc(p, 100);
+    for(i = 0; i < 20; i++) TEST_ASSERT_EQUAL_UINT8(i, p[i]);
+    p = lv_mem_realloc(p, 1000);
+    for(i = 0; i < 20; i++) TEST_ASSERT_EQUAL_UINT8(i, p[i]);
+
+    lv_mem_free(p);
+#endif
+}
+
+void test_mem_slab_fallback_when_full(void)
+{
+#ifdef LV_MEM_SLAB_CLASS_CNT
+    static void * ptrs[LV_MEM_SLAB_SIZE / 128 + 8];
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    uint32_t fallback_cnt = mon.slab[LV_MEM_SLAB_CLASS_CNT - 1].fallback_cnt;
+    uint32_t page_cnt = mon.slab[LV_MEM_SLAB_CLASS_CNT - 1].page_cnt;
+
+    /*More 128 byte blocks than the slab area can hold*/
+    uint32_t i;
+    for(i = 0; i < sizeof(ptrs) / sizeof(ptrs[0]); i++) {
+        ptrs[i] = lv_mem_alloc(128);
+        TEST_ASSERT_NOT_NULL(ptrs[i]);
+        lv_memset(ptrs[i], 0xaa, 128);
+    }
+
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.slab_free_page_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(fallback_cnt + 8, mon.slab[LV_MEM_SLAB_CLASS_CNT - 1].fallback_cnt);
+
+    for(i = 0; i < sizeof(ptrs) / sizeof(ptrs[0]); i++) lv_mem_free(ptrs[i]);
+
+    /*The empty pages can be used by the other classes again*/
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT16(page_cnt, mon.slab[LV_MEM_SLAB_CLASS_CNT - 1].page_cnt);
+    TEST_ASSERT_NOT_EQUAL(0, mon.slab_free_page_cnt);
+#endif
+}
+
+void test_mem_screen_create_delete_benchmark(void)
+{
+    lv_mem_monitor_t mon;
+    uint32_t max_frag_pct = 0;
+    uint32_t max_used = 0;
+
+    uint64_t t_start = lv_test_get_time_us();
+    uint32_t i;
+    lv_obj_t * prev_scr = NULL;
+    for(i = 0; i < BENCH_SCREENS; i++) {
+        /*A typical watch face: a few labels, a bar, buttons and an arc*/
+        lv_obj_t * scr = lv_obj_create(NULL);
+        uint32_t j;
+        for(j = 0; j < 4; j++) {
+            lv_obj_t * label = lv_label_create(scr);
+            lv_label_set_text_fmt(label, "%d:%02d", (int)i, (int)j);
+            lv_obj_set_style_text_color(label, lv_color_hex(0x30c0f0), 0);
+        }
+        lv_obj_t * bar = lv_bar_create(scr);
+        lv_bar_set_value(bar, (int32_t)(i % 100), LV_ANIM_OFF);
+        for(j = 0; j < 3; j++) {
+            lv_obj_t * btn = lv_btn_create(scr);
+            lv_obj_set_style_bg_color(btn, lv_color_hex(0x202020), 0);
+            lv_label_create(btn);
+        }
+        lv_arc_create(scr);
+
+        lv_mem_monitor(&mon);
+        if(mon.frag_pct > max_frag_pct) max_frag_pct = mon.frag_pct;
+        if(mon.total_size - mon.free_size > max_used) max_used = mon.total_size - mon.free_size;
+
+        /*Like on a screen switch the old screen is deleted after the new one is created*/
+        if(prev_scr) lv_obj_del(prev_scr);
+        prev_scr = scr;
+    }
+    lv_obj_del(prev_scr);
+    uint32_t t_elaps = (uint32_t)(lv_test_get_time_us() - t_start);
+
+    lv_mem_monitor(&mon);
+    TEST_PRINTF("%d screens: %u us, peak fragmentation %u pct, peak used %u bytes",
+                BENCH_SCREENS, t_elaps, max_frag_pct, max_used);
+#ifdef LV_MEM_SLAB_CLASS_CNT
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        TEST_PRINTF("slab %u: max used %u, fallback %u", mon.slab[i].block_size, mon.slab[i].max_used_cnt,
+                    mon.slab[i].fallback_cnt);
+    }
+#endif
+}
+
 #endif
@@ -0,0 +1,321 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_init.h"
+
+#if LV_USE_MSG && LV_MSG_POST_SLOT_CNT > 0
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+#define PRODUCER_CNT    4
+#define PRODUCER_POSTS  20000
+#define BENCH_IDS       64
+#define BENCH_SENDS     100000
+
+#if LV_USE_MSG
+typedef struct {
+    uint32_t value;
+    uint32_t check;     /*~value to detect torn payloads*/
+} sample_t;
+
+static uint32_t recv_cnt;
+static uint32_t recv_ids[16];
+static uint32_t last_value;
+
+static void recv_cb(void * s, lv_msg_t * m)
+{
+    LV_UNUSED(s);
+    if(recv_cnt < 16) recv_ids[recv_cnt] = lv_msg_get_id(m);
+    recv_cnt++;
+    const uint32_t * v = lv_msg_get_payload(m);
+    if(v) last_value = *v;
+}
+
+static void unsubscribe_cb(void * s, lv_msg_t * m)
+{
+    LV_UNUSED(m);
+    lv_msg_unsubscribe(s);
+    recv_cnt++;
+}
+
+static void unsubscribe_other_cb(void * s, lv_msg_t * m)
+{
+    LV_UNUSED(s);
+    /*The subscriber to remove is in the user data*/
+    void ** other = lv_msg_get_user_data(m);
+    if(*other) {
+        lv_msg_unsubscribe(*other);
+        *other = NULL;
+    }
+    recv_cnt++;
+}
+
+static void send_nested_cb(void * s, lv_msg_t * m)
+{
+    LV_UNUSED(s);
+    lv_msg_send((uint32_t)(uintptr_t)lv_msg_get_user_data(m), NULL);
+    recv_cnt++;
+}
+#endif
+
+void setUp(void)
+{
+#if LV_USE_MSG
+    recv_cnt = 0;
+    last_value = 0;
+    lv_memset_00(recv_ids, sizeof(recv_ids));
+#endif
+}
+
+void tearDown(void)
+{
+}
+
+void test_msg_send_indexed_by_id(void)
+{
+#if LV_USE_MSG
+    /*Same bucket, different IDs*/
+    void * s1 = lv_msg_subscribe(1, recv_cb, NULL);
+    void * s2 = lv_msg_subscribe(17, recv_cb, NULL);
+    void * s3 = lv_msg_subscribe(1, recv_cb, NULL);
+
+    uint32_t v = 5;
+    lv_msg_send(1, &v);
+    TEST_ASSERT_EQUAL_UINT32(2, recv_cnt);
+    TEST_ASSERT_EQUAL_UINT32(5, last_value);
+
+    lv_msg_send(17, NULL);
+    TEST_ASSERT_EQUAL_UINT32(3, recv_cnt);
+
+    lv_msg_unsubscribe(s1);
+    lv_msg_send(1, &v);
+    TEST_ASSERT_EQUAL_UINT32(4, recv_cnt);
+
+    lv_msg_unsubscribe(s2);
+    lv_msg_unsubscribe(s3);
+    lv_msg_send(1, &v);
+    lv_msg_send(17, &v);
+    TEST_ASSERT_EQUAL_UINT32(4, recv_cnt);
+#endif
+}
+
+void test_msg_unsubscribe_in_callback(void)
+{
+#if LV_USE_MSG
+    lv_msg_subscribe(2, unsubscribe_cb, NULL);
+    lv_msg_subscribe(2, unsubscribe_cb, NULL);
+    lv_msg_send(2, NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, recv_cnt);
+
+    lv_msg_send(2, NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, recv_cnt);
+#endif
+}
+
+void test_msg_unsubscribe_other_in_callback(void)
+{
+#if LV_USE_MSG
+    /*The first subscriber removes the next one, which is already the next node of the loop*/
+    void * s2 = NULL;
+    lv_msg_subscribe(4, unsubscribe_other_cb, &s2);
+    s2 = lv_msg_subscribe(4, recv_cb, NULL);
+    void * s3 = lv_msg_subscribe(4, recv_cb, NULL);
+    lv_msg_send(4, NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, recv_cnt);
+    TEST_ASSERT_NULL(s2);
+
+    lv_msg_send(4, NULL);
+    TEST_ASSERT_EQUAL_UINT32(4, recv_cnt);
+
+    /*A nested send removes the next subscriber of the outer one*/
+    void * s5 = NULL;
+    lv_msg_subscribe(5, send_nested_cb, (void *)21);
+    s5 = lv_msg_subscribe(5, recv_cb, NULL);
+    lv_msg_subscribe(21, unsubscribe_other_cb, &s5);
+    recv_cnt = 0;
+    lv_msg_send(5, NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, recv_cnt);
+    TEST_ASSERT_NULL(s5);
+    lv_msg_unsubscribe(s3);
+#endif
+}
+
+void test_msg_obj_subscribe(void)
+{
+#if LV_USE_MSG
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_msg_subscribe_obj(3, label, NULL);
+    lv_msg_subscribe(3, recv_cb, NULL);
+
+    lv_obj_del(label);
+    lv_msg_send(3, NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, recv_cnt);
+#endif
+}
+
+void test_msg_post_coalesces(void)
+{
+#if LV_USE_MSG && LV_MSG_POST_SLOT_CNT > 0
+    void * s = lv_msg_subscribe(10, recv_cb, NULL);
+
+    uint32_t v;
+    for(v = 1; v <= 3; v++) TEST_ASSERT_TRUE(lv_msg_post(10, &v, sizeof(v)));
+
+    /*Nothing is sent until the timer handler runs*/
+    TEST_ASSERT_EQUAL_UINT32(0, recv_cnt);
+
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, recv_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, last_value);
+
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, recv_cnt);
+
+    lv_msg_unsubscribe(s);
+#endif
+}
+
+void test_msg_post_order(void)
+{
+#if LV_USE_MSG && LV_MSG_POST_SLOT_CNT > 0
+    void * s1 = lv_msg_subscribe(11, recv_cb, NULL);
+    void * s2 = lv_msg_subscribe(12, recv_cb, NULL);
+
+    uint32_t v = 1;
+    lv_msg_post(12, &v, sizeof(v));
+    lv_msg_post(11, &v, sizeof(v));
+    v = 2;
+    lv_msg_post(12, &v, sizeof(v));
+    lv_timer_handler();
+
+    /*In the order of the first post, with the latest payload*/
+    TEST_ASSERT_EQUAL_UINT32(2, recv_cnt);
+    TEST_ASSERT_EQUAL_UINT32(12, recv_ids[0]);
+    TEST_ASSERT_EQUAL_UINT32(11, recv_ids[1]);
+
+    /*Without payload*/
+    lv_msg_post(11, NULL, 0);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(3, recv_cnt);
+
+    lv_msg_unsubscribe(s1);
+    lv_msg_unsubscribe(s2);
+#endif
+}
+
+#if LV_USE_MSG && LV_MSG_POST_SLOT_CNT > 0
+static uint32_t producer_last[PRODUCER_CNT];
+static uint32_t producer_recv_cnt[PRODUCER_CNT];
+static bool producer_out_of_order;
+static bool producer_torn;
+
+static void producer_recv_cb(void * s, lv_msg_t * m)
+{
+    LV_UNUSED(s);
+    uint32_t p = lv_msg_get_id(m) - 100;
+    const sample_t * sample = lv_msg_get_payload(m);
+    if(sample->check != ~sample->value) producer_torn = true;
+    if(producer_recv_cnt[p] && sample->value <= producer_last[p]) producer_out_of_order = true;
+    producer_last[p] = sample->value;
+    producer_recv_cnt[p]++;
+}
+
+static void * producer_thread(void * param)
+{
+    uint32_t p = (uint32_t)(uintptr_t)param;
+    sample_t sample;
+    for(sample.value = 1; sample.value <= PRODUCER_POSTS; sample.value++) {
+        sample.check = ~sample.value;
+        while(!lv_msg_post(100 + p, &sample, sizeof(sample))) {}
+        if(sample.value % 16 == 0) sched_yield();
+    }
+    return NULL;
+}
+#endif
+
+void test_msg_post_from_threads(void)
+{
+#if LV_USE_MSG && LV_MSG_POST_SLOT_CNT > 0
+    void * subs[PRODUCER_CNT];
+    pthread_t threads[PRODUCER_CNT];
+    uint32_t p;
+    for(p = 0; p < PRODUCER_CNT; p++) {
+        subs[p] = lv_msg_subscribe(100 + p, producer_recv_cb, NULL);
+        producer_last[p] = 0;
+        producer_recv_cnt[p] = 0;
+    }
+    producer_out_of_order = false;
+    producer_torn = false;
+
+    for(p = 0; p < PRODUCER_CNT; p++) {
+        pthread_create(&threads[p], NULL, producer_thread, (void *)(uintptr_t)p);
+    }
+
+    /*The LVGL thread drains the queue meanwhile*/
+    bool done = false;
+    while(!done) {
+        lv_timer_handler();
+        done = true;
+        for(p = 0; p < PRODUCER_CNT; p++) {
+            if(producer_last[p] != PRODUCER_POSTS) done = false;
+        }
+    }
+
+    for(p = 0; p < PRODUCER_CNT; p++) pthread_join(threads[p], NULL);
+
+    uint32_t sum = 0;
+    for(p = 0; p < PRODUCER_CNT; p++) {
+        lv_msg_unsubscribe(subs[p]);
+        sum += producer_recv_cnt[p];
+    }
+
+    TEST_ASSERT_FALSE(producer_torn);
+    TEST_ASSERT_FALSE(producer_out_of_order);
+    TEST_PRINTF("%d threads posted %d messages, %u were sent after coalescing",
+                PRODUCER_CNT, PRODUCER_CNT * PRODUCER_POSTS, sum);
+#endif
+}
+
+void test_msg_post_limits(void)
+{
+#if LV_USE_MSG && LV_MSG_POST_SLOT_CNT > 0
+    uint8_t big[LV_MSG_POST_PAYLOAD_SIZE + 1] = {0};
+    TEST_ASSERT_FALSE(lv_msg_post(20, big, sizeof(big)));
+    TEST_ASSERT_FALSE(lv_msg_post(LV_MSG_ID_ANY, NULL, 0));
+
+    /*The slots are taken by the IDs posted earlier and these*/
+    uint32_t i;
+    uint32_t posted = 0;
+    for(i = 0; i < LV_MSG_POST_SLOT_CNT; i++) {
+        if(lv_msg_post(1000 + i, NULL, 0)) posted++;
+    }
+    TEST_ASSERT_LESS_THAN_UINT32(LV_MSG_POST_SLOT_CNT, posted);
+    TEST_ASSERT_FALSE(lv_msg_post(2000, NULL, 0));
+
+    /*The already used IDs can be still posted*/
+    TEST_ASSERT_TRUE(lv_msg_post(1000, NULL, 0));
+    lv_timer_handler();
+#endif
+}
+
+void test_msg_send_benchmark(void)
+{
+#if LV_USE_MSG
+    static void * subs[BENCH_IDS];
+    uint32_t i;
+    for(i = 0; i < BENCH_IDS; i++) subs[i] = lv_msg_subscribe(500 + i, recv_cb, NULL);
+
+    uint64_t t_start = lv_test_get_time_us();
+    for(i = 0; i < BENCH_SENDS; i++) lv_msg_send(500 + (i % BENCH_IDS), &i);
+    uint32_t t_elaps = (uint32_t)(lv_test_get_time_us() - t_start);
+
+    for(i = 0; i < BENCH_IDS; i++) lv_msg_unsubscribe(subs[i]);
+
+    TEST_ASSERT_EQUAL_UINT32(BENCH_SENDS, recv_cnt);
+    TEST_PRINTF("%d subscribers, %d sends: %u us", BENCH_IDS, BENCH_SENDS, t_elaps);
+#endif
+}
+
+#endif
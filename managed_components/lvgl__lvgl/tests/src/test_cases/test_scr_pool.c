@@ -0,0 +1,291 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_init.h"
+
+#define PAGE_CNT        8
+#define BENCH_POOL_SIZE 4
+#define BENCH_SWITCHES  200
+
+#if LV_USE_SCR_POOL
+typedef struct {
+    char name[16];
+    int32_t value;
+} page_t;
+
+static page_t pages[PAGE_CNT];
+static lv_obj_t * default_scr;
+static lv_scr_pool_t * pool;
+static uint32_t build_cnt;
+static uint32_t bind_cnt;
+static uint32_t unbind_cnt;
+
+/*A watch page: a grid with a title, a value, a bar and a few labels*/
+static void page_build_cb(lv_obj_t * scr, void * user_data)
+{
+    LV_UNUSED(user_data);
+    static lv_coord_t col_dsc[] = {LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+    static lv_coord_t row_dsc[] = {LV_GRID_FR(2), LV_GRID_FR(3), LV_GRID_FR(1), LV_GRID_FR(1), LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+
+    lv_obj_t * grid = lv_obj_create(scr);
+    lv_obj_set_size(grid, lv_pct(100), lv_pct(100));
+    lv_obj_set_grid_dsc_array(grid, col_dsc, row_dsc);
+
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_obj_t * obj = i == 2 ? lv_bar_create(grid) : lv_label_create(grid);
+        lv_obj_set_grid_cell(obj, LV_GRID_ALIGN_CENTER, 0, 1, LV_GRID_ALIGN_CENTER, i, 1);
+        lv_obj_set_style_text_color(obj, lv_color_hex(0x30c0f0), 0);
+    }
+    build_cnt++;
+}
+
+static void page_bind_cb(lv_obj_t * scr, void * user_data)
+{
+    const page_t * page = user_data;
+    lv_obj_t * grid = lv_obj_get_child(scr, 0);
+    lv_label_set_text(lv_obj_get_child(grid, 0), page->name);
+    lv_label_set_text_fmt(lv_obj_get_child(grid, 1), "%d", (int)page->value);
+    lv_bar_set_value(lv_obj_get_child(grid, 2), page->value % 100, LV_ANIM_OFF);
+    lv_label_set_text_fmt(lv_obj_get_child(grid, 3), "min %d", (int)page->value - 10);
+    lv_label_set_text_fmt(lv_obj_get_child(grid, 4), "max %d", (int)page->value + 10);
+    bind_cnt++;
+}
+
+static void page_unbind_cb(lv_obj_t * scr, void * user_data)
+{
+    LV_UNUSED(scr);
+    LV_UNUSED(user_data);
+    unbind_cnt++;
+}
+
+static void other_build_cb(lv_obj_t * scr, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_arc_create(scr);
+    build_cnt++;
+}
+
+static const lv_scr_pool_class_t page_class = {
+    .build_cb = page_build_cb,
+    .bind_cb = page_bind_cb,
+    .unbind_cb = page_unbind_cb,
+};
+
+static const lv_scr_pool_class_t other_class = {
+    .build_cb = other_build_cb,
+};
+
+static const char * get_title(lv_obj_t * scr)
+{
+    return lv_label_get_text(lv_obj_get_child(lv_obj_get_child(scr, 0), 0));
+}
+#endif
+
+void setUp(void)
+{
+#if LV_USE_SCR_POOL
+    uint32_t i;
+    for(i = 0; i < PAGE_CNT; i++) {
+        lv_snprintf(pages[i].name, sizeof(pages[i].name), "Page %d", (int)i);
+        pages[i].value = (int32_t)(i * 17);
+    }
+    default_scr = lv_scr_act();
+    pool = NULL;
+    build_cnt = 0;
+    bind_cnt = 0;
+    unbind_cnt = 0;
+#endif
+}
+
+void tearDown(void)
+{
+#if LV_USE_SCR_POOL
+    lv_scr_load(default_scr);
+    if(pool) lv_scr_pool_del(pool);
+#endif
+}
+
+void test_scr_pool_hit(void)
+{
+#if LV_USE_SCR_POOL
+    pool = lv_scr_pool_create(3);
+
+    lv_obj_t * scr0 = lv_scr_pool_get(pool, &page_class, &pages[0]);
+    lv_obj_t * scr1 = lv_scr_pool_get(pool, &page_class, &pages[1]);
+    TEST_ASSERT_NOT_NULL(scr0);
+    TEST_ASSERT_NOT_EQUAL(scr0, scr1);
+    TEST_ASSERT_EQUAL_STRING("Page 1", get_title(scr1));
+
+    TEST_ASSERT_EQUAL_PTR(scr0, lv_scr_pool_get(pool, &page_class, &pages[0]));
+
+    lv_scr_pool_info_t info;
+    lv_scr_pool_get_info(pool, &info);
+    TEST_ASSERT_EQUAL_UINT32(1, info.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, info.build_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, info.recycle_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, info.scr_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, build_cnt);
+#endif
+}
+
+void test_scr_pool_recycle_same_class(void)
+{
+#if LV_USE_SCR_POOL
+    pool = lv_scr_pool_create(2);
+
+    lv_obj_t * scr0 = lv_scr_pool_get(pool, &page_class, &pages[0]);
+    lv_scr_pool_get(pool, &page_class, &pages[1]);
+
+    /*The least recently used screen gets the new content without being rebuilt*/
+    lv_obj_t * scr2 = lv_scr_pool_get(pool, &page_class, &pages[2]);
+    TEST_ASSERT_EQUAL_PTR(scr0, scr2);
+    TEST_ASSERT_EQUAL_STRING("Page 2", get_title(scr2));
+    TEST_ASSERT_EQUAL_UINT32(2, build_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, bind_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, unbind_cnt);
+
+    lv_scr_pool_info_t info;
+    lv_scr_pool_get_info(pool, &info);
+    TEST_ASSERT_EQUAL_UINT32(1, info.recycle_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, info.scr_cnt);
+#endif
+}
+
+void test_scr_pool_rebuild_other_class(void)
+{
+#if LV_USE_SCR_POOL
+    pool = lv_scr_pool_create(2);
+
+    lv_scr_pool_get(pool, &page_class, &pages[0]);
+    lv_scr_pool_get(pool, &page_class, &pages[1]);
+
+    /*Different object tree: the least recently used screen is deleted*/
+    lv_obj_t * scr = lv_scr_pool_get(pool, &other_class, &pages[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_obj_get_child_cnt(scr));
+    TEST_ASSERT_TRUE(lv_obj_check_type(lv_obj_get_child(scr, 0), &lv_arc_class));
+    TEST_ASSERT_EQUAL_UINT32(3, build_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, unbind_cnt);
+
+    /*Same user_data with an other class is an other screen*/
+    TEST_ASSERT_EQUAL_STRING("Page 1", get_title(lv_scr_pool_get(pool, &page_class, &pages[1])));
+    TEST_ASSERT_EQUAL_UINT32(3, build_cnt);
+#endif
+}
+
+void test_scr_pool_keeps_active(void)
+{
+#if LV_USE_SCR_POOL
+    pool = lv_scr_pool_create(2);
+
+    lv_obj_t * scr0 = lv_scr_pool_load(pool, &page_class, &pages[0], LV_SCR_LOAD_ANIM_NONE, 0, 0);
+    TEST_ASSERT_EQUAL_PTR(scr0, lv_scr_act());
+    lv_obj_t * scr1 = lv_scr_pool_get(pool, &page_class, &pages[1]);
+
+    /*scr0 is older but shown*/
+    TEST_ASSERT_EQUAL_PTR(scr1, lv_scr_pool_get(pool, &page_class, &pages[2]));
+    TEST_ASSERT_EQUAL_STRING("Page 0", get_title(scr0));
+
+    /*The old screen is kept after loading an other one*/
+    lv_scr_pool_load(pool, &page_class, &pages[2], LV_SCR_LOAD_ANIM_NONE, 0, 0);
+    TEST_ASSERT_EQUAL_PTR(scr0, lv_scr_pool_get(pool, &page_class, &pages[0]));
+
+    /*Only one screen can be reused, but it's active*/
+    lv_scr_load(default_scr);
+    lv_scr_pool_del(pool);
+    pool = lv_scr_pool_create(1);
+    lv_scr_pool_load(pool, &page_class, &pages[0], LV_SCR_LOAD_ANIM_NONE, 0, 0);
+    TEST_ASSERT_NULL(lv_scr_pool_get(pool, &page_class, &pages[1]));
+#endif
+}
+
+void test_scr_pool_external_delete(void)
+{
+#if LV_USE_SCR_POOL
+    pool = lv_scr_pool_create(2);
+
+    lv_obj_t * scr0 = lv_scr_pool_get(pool, &page_class, &pages[0]);
+    lv_obj_del(scr0);
+
+    lv_scr_pool_info_t info;
+    lv_scr_pool_get_info(pool, &info);
+    TEST_ASSERT_EQUAL_UINT32(0, info.scr_cnt);
+
+    lv_scr_pool_get(pool, &page_class, &pages[0]);
+    TEST_ASSERT_EQUAL_UINT32(2, build_cnt);
+
+    lv_scr_pool_remove(pool, &pages[0]);
+    lv_scr_pool_get_info(pool, &info);
+    TEST_ASSERT_EQUAL_UINT32(0, info.scr_cnt);
+#endif
+}
+
+#if LV_USE_SCR_POOL
+/**
+ * Cycle through the pages like a user scrolling through the watch screens
+ * @param pool_p    pool to use or NULL to delete and create the screens
+ * @param max_frag  the peak fragmentation of the heap
+ * @return          the time of the switches in microseconds, without rendering
+ */
+static uint32_t cycle_pages(lv_scr_pool_t * pool_p, uint32_t * max_frag)
+{
+    lv_mem_monitor_t mon;
+    *max_frag = 0;
+
+    uint64_t t_elaps = 0;
+    uint32_t i;
+    for(i = 0; i < BENCH_SWITCHES; i++) {
+        uint64_t t_start = lv_test_get_time_us();
+        page_t * page = &pages[i % PAGE_CNT];
+        page->value++;
+        if(pool_p) {
+            lv_scr_pool_load(pool_p, &page_class, page, LV_SCR_LOAD_ANIM_NONE, 0, 0);
+        }
+        else {
+            lv_obj_t * scr = lv_obj_create(NULL);
+            page_build_cb(scr, page);
+            page_bind_cb(scr, page);
+            lv_scr_load_anim(scr, LV_SCR_LOAD_ANIM_NONE, 0, 0, lv_scr_act() != default_scr);
+        }
+        lv_obj_update_layout(lv_scr_act());
+        t_elaps += lv_test_get_time_us() - t_start;
+
+        lv_refr_now(NULL);
+
+        lv_mem_monitor(&mon);
+        if(mon.frag_pct > *max_frag) *max_frag = mon.frag_pct;
+    }
+    if(pool_p == NULL) {
+        lv_obj_t * scr = lv_scr_act();
+        lv_scr_load(default_scr);
+        lv_obj_del(scr);
+    }
+
+    return (uint32_t)t_elaps;
+}
+#endif
+
+void test_scr_pool_switch_benchmark(void)
+{
+#if LV_USE_SCR_POOL
+    uint32_t frag_del;
+    uint32_t t_del = cycle_pages(NULL, &frag_del);
+
+    /*Fewer screens than pages: screens are reused for other pages*/
+    pool = lv_scr_pool_create(BENCH_POOL_SIZE);
+    build_cnt = 0;
+    uint32_t frag_pool;
+    uint32_t t_pool = cycle_pages(pool, &frag_pool);
+
+    lv_scr_pool_info_t info;
+    lv_scr_pool_get_info(pool, &info);
+    TEST_ASSERT_EQUAL_UINT32(BENCH_POOL_SIZE, build_cnt);
+    TEST_ASSERT_EQUAL_UINT32(BENCH_SWITCHES - BENCH_POOL_SIZE, info.recycle_cnt);
+
+    TEST_PRINTF("%d switches between %d pages: delete/create %u us (peak frag. %u), pool of %d %u us (peak frag. %u)",
+                BENCH_SWITCHES, PAGE_CNT, t_del, frag_del, BENCH_POOL_SIZE, t_pool, frag_pool);
+#endif
+}
+
+#endif
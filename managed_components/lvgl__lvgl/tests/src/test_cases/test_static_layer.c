@@ -0,0 +1,233 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_init.h"
+
+#define PANEL_SIZE      120
+#define BENCH_FRAMES    200
+
+#if LV_USE_STATIC_LAYER
+
+static lv_obj_t * panel;
+static lv_obj_t * card;
+static lv_obj_t * label;
+static uint32_t card_draw_cnt;
+static lv_color_t panel_fb[PANEL_SIZE * PANEL_SIZE];
+static lv_color_t ref_buf[PANEL_SIZE * PANEL_SIZE];
+static void (*flush_cb_ori)(lv_disp_drv_t *, const lv_area_t *, lv_color_t *);
+
+/*Keep the pixels of the panel from every flushed area, so partial refreshes can be checked too*/
+static void flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2 && y < PANEL_SIZE; y++) {
+        lv_coord_t x;
+        for(x = area->x1; x <= area->x2 && x < PANEL_SIZE; x++) {
+            panel_fb[y * PANEL_SIZE + x] = color_p[(y - area->y1) * w + x - area->x1];
+        }
+    }
+
+    lv_disp_flush_ready(disp_drv);
+}
+
+static void card_draw_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    card_draw_cnt++;
+}
+
+/*A watch face: a gradient dial with a rounded, shadowed card on it and a label on top which changes*/
+static void create_face(void)
+{
+    lv_disp_drv_t * drv = lv_disp_get_default()->driver;
+    flush_cb_ori = drv->flush_cb;
+    drv->flush_cb = flush_cb;
+
+    panel = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(panel);
+    lv_obj_set_size(panel, PANEL_SIZE, PANEL_SIZE);
+    lv_obj_set_style_bg_opa(panel, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(panel, lv_color_hex(0x102040), 0);
+    lv_obj_set_style_bg_grad_color(panel, lv_color_hex(0x60a0e0), 0);
+    lv_obj_set_style_bg_grad_dir(panel, LV_GRAD_DIR_VER, 0);
+    lv_obj_set_style_border_width(panel, 4, 0);
+    lv_obj_set_style_border_color(panel, lv_color_hex(0xf0c040), 0);
+
+    card = lv_obj_create(panel);
+    lv_obj_set_size(card, 80, 50);
+    lv_obj_center(card);
+    lv_obj_set_style_radius(card, 16, 0);
+    lv_obj_set_style_shadow_width(card, 30, 0);
+    lv_obj_set_style_shadow_ofs_y(card, 8, 0);
+    lv_obj_add_event_cb(card, card_draw_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    label = lv_label_create(lv_scr_act());
+    lv_label_set_text(label, "12:00:00");
+    lv_obj_align(label, LV_ALIGN_TOP_LEFT, 30, 78);
+
+    card_draw_cnt = 0;
+}
+
+static void delete_face(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_disp_get_default()->driver->flush_cb = flush_cb_ori;
+}
+
+static void refr_all(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+static void save_panel(void)
+{
+    lv_memcpy(ref_buf, panel_fb, sizeof(ref_buf));
+}
+
+static void assert_panel_eq_ref(void)
+{
+    TEST_ASSERT_EQUAL_MEMORY(ref_buf, panel_fb, sizeof(ref_buf));
+}
+
+static uint32_t bench_frames(void)
+{
+    uint32_t i;
+    uint64_t t_start = lv_test_get_time_us();
+    for(i = 0; i < BENCH_FRAMES; i++) {
+        lv_label_set_text_fmt(label, "12:%02d:%02d", (int)(i / 60), (int)(i % 60));
+        lv_refr_now(NULL);
+    }
+    return (uint32_t)(lv_test_get_time_us() - t_start);
+}
+
+#endif
+
+void setUp(void)
+{
+#if LV_USE_STATIC_LAYER
+    create_face();
+#endif
+}
+
+void tearDown(void)
+{
+#if LV_USE_STATIC_LAYER
+    delete_face();
+#endif
+}
+
+void test_static_layer_renders_the_same(void)
+{
+#if LV_USE_STATIC_LAYER
+    refr_all();
+    lv_label_set_text(label, "12:00:01");
+    lv_refr_now(NULL);
+    save_panel();
+
+    lv_label_set_text(label, "12:00:00");
+    lv_obj_add_flag(panel, LV_OBJ_FLAG_STATIC_LAYER);
+    card_draw_cnt = 0;
+    refr_all();
+    TEST_ASSERT_EQUAL(1, card_draw_cnt);
+
+    /*Only the area of the label is redrawn, on the cached panel*/
+    lv_label_set_text(label, "12:00:01");
+    lv_refr_now(NULL);
+    assert_panel_eq_ref();
+
+    refr_all();
+    assert_panel_eq_ref();
+    TEST_ASSERT_EQUAL(1, card_draw_cnt);
+#endif
+}
+
+void test_static_layer_is_kept_while_a_sibling_changes(void)
+{
+#if LV_USE_STATIC_LAYER
+    lv_obj_add_flag(panel, LV_OBJ_FLAG_STATIC_LAYER);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, card_draw_cnt);
+
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_label_set_text_fmt(label, "12:00:%02d", (int)i);
+        lv_refr_now(NULL);
+    }
+    TEST_ASSERT_EQUAL(1, card_draw_cnt);
+#endif
+}
+
+void test_static_layer_is_updated_when_a_child_changes(void)
+{
+#if LV_USE_STATIC_LAYER
+    lv_obj_add_flag(panel, LV_OBJ_FLAG_STATIC_LAYER);
+    lv_refr_now(NULL);
+
+    lv_obj_set_style_bg_color(card, lv_color_hex(0xc02020), 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(2, card_draw_cnt);
+
+    refr_all();
+    TEST_ASSERT_EQUAL(2, card_draw_cnt);
+    save_panel();
+
+    lv_obj_clear_flag(panel, LV_OBJ_FLAG_STATIC_LAYER);
+    refr_all();
+    assert_panel_eq_ref();
+
+    /*A new child and the style of the object itself*/
+    lv_obj_add_flag(panel, LV_OBJ_FLAG_STATIC_LAYER);
+    lv_refr_now(NULL);
+    card_draw_cnt = 0;
+    lv_obj_t * child = lv_label_create(card);
+    lv_label_set_text(child, "new");
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, card_draw_cnt);
+    lv_obj_set_style_bg_grad_dir(panel, LV_GRAD_DIR_HOR, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(2, card_draw_cnt);
+
+    /*Moved*/
+    lv_obj_set_x(panel, 20);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(3, card_draw_cnt);
+#endif
+}
+
+void test_static_layer_falls_back_if_not_opaque(void)
+{
+#if LV_USE_STATIC_LAYER
+    /*The rounded corners can't be cached without alpha*/
+    lv_obj_set_style_radius(panel, 20, 0);
+    refr_all();
+    save_panel();
+
+    lv_obj_add_flag(panel, LV_OBJ_FLAG_STATIC_LAYER);
+    card_draw_cnt = 0;
+    refr_all();
+    refr_all();
+    TEST_ASSERT_EQUAL(2, card_draw_cnt);
+    assert_panel_eq_ref();
+#endif
+}
+
+void test_static_layer_benchmark(void)
+{
+#if LV_USE_STATIC_LAYER
+    lv_refr_now(NULL);
+    uint32_t t_normal = bench_frames();
+
+    lv_obj_add_flag(panel, LV_OBJ_FLAG_STATIC_LAYER);
+    lv_refr_now(NULL);
+    uint32_t t_static = bench_frames();
+
+    TEST_PRINTF("%d frames of a label on a %dx%d gradient panel with a shadowed card: normal %u us/frame, "
+                "static layer %u us/frame", BENCH_FRAMES, PANEL_SIZE, PANEL_SIZE, t_normal / BENCH_FRAMES,
+                t_static / BENCH_FRAMES);
+#endif
+}
+
+#endif
@@ -2,6 +2,19 @@
 #include "../lvgl.h"
 
 #include "unity/unity.h"
+#include "lv_test_init.h"
+#include "lv_test_helpers.h"
+
+#if LV_USE_TINY_TTF
+#define DIGITS_FONT_SIZE    70
+#define DIGITS_CACHE_SIZE   6144
+#define DIGITS_REFR_CNT     20
+
+extern lv_color_t test_fb[];
+static lv_color_t fb_ref[800 * 480];
+
+static uint32_t refr_digits(lv_obj_t * label, const lv_font_t * font, lv_tiny_ttf_cache_info_t * info);
+#endif
 
 void setUp(void)
 {
@@ -46,4 +59,132 @@ void test_tiny_ttf_rendering_test(void)
 #endif
 }
 
+void test_tiny_ttf_rle_cache(void)
+{
+#if LV_USE_TINY_TTF
+    extern const uint8_t ubuntu_font[];
+    extern size_t ubuntu_font_size;
+    lv_font_t * font_a8 = lv_tiny_ttf_create_data_ex(ubuntu_font, ubuntu_font_size, DIGITS_FONT_SIZE, DIGITS_CACHE_SIZE);
+    lv_font_t * font_rle = lv_tiny_ttf_create_data_ex(ubuntu_font, ubuntu_font_size, DIGITS_FONT_SIZE, DIGITS_CACHE_SIZE);
+    lv_tiny_ttf_set_cache_rle(font_rle, true);
+
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_obj_set_style_text_color(label, lv_color_hex(0x30c0f0), 0);
+    lv_label_set_text(label, "0123456789\n12:34:56");
+    lv_obj_set_pos(label, 11, 5);
+    uint32_t fb_size = lv_disp_get_hor_res(NULL) * lv_disp_get_ver_res(NULL) * sizeof(lv_color_t);
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(fb_ref), fb_size);
+
+    /*The encoded glyphs should look exactly the same*/
+    lv_obj_set_style_text_font(label, font_a8, 0);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    lv_memcpy(fb_ref, test_fb, fb_size);
+
+    lv_obj_set_style_text_font(label, font_rle, 0);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_MEMORY(fb_ref, test_fb, fb_size);
+
+#if LV_DRAW_COMPLEX
+    /*Also when they are decoded because of a mask*/
+    _lv_draw_mask_common_dsc_t mask_dsc;
+    lv_memset_00(&mask_dsc, sizeof(mask_dsc));
+    mask_dsc.cb = lv_test_full_cover_mask_cb;
+    mask_dsc.type = LV_DRAW_MASK_TYPE_FADE;
+    int16_t mask_id = lv_draw_mask_add(&mask_dsc, NULL);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    lv_draw_mask_remove_id(mask_id);
+    TEST_ASSERT_EQUAL_MEMORY(fb_ref, test_fb, fb_size);
+#endif
+
+    /*Redraw a clock like text with a cache which fits only a few raw glyphs*/
+    lv_tiny_ttf_cache_info_t info_a8;
+    lv_tiny_ttf_cache_info_t info_rle;
+    lv_obj_set_style_text_font(label, font_a8, 0);
+    uint32_t t_a8 = refr_digits(label, font_a8, &info_a8);
+    lv_obj_set_style_text_font(label, font_rle, 0);
+    uint32_t t_rle = refr_digits(label, font_rle, &info_rle);
+
+    TEST_PRINTF("raw cache: %u hits, %u misses, %u/%u bytes, %u us", info_a8.hit_cnt, info_a8.miss_cnt,
+                (uint32_t)info_a8.used_size, (uint32_t)info_a8.total_size, t_a8);
+    TEST_PRINTF("rle cache: %u hits, %u misses, %u/%u bytes, %u us", info_rle.hit_cnt, info_rle.miss_cnt,
+                (uint32_t)info_rle.used_size, (uint32_t)info_rle.total_size, t_rle);
+
+    /*All the digits fit into the cache*/
+    TEST_ASSERT_EQUAL_UINT32(0, info_rle.miss_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(info_rle.hit_cnt, info_a8.hit_cnt);
+
+    lv_obj_del(label);
+    lv_tiny_ttf_destroy(font_a8);
+    lv_tiny_ttf_destroy(font_rle);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_tiny_ttf_flush_cache(void)
+{
+#if LV_USE_TINY_TTF
+    extern const uint8_t ubuntu_font[];
+    extern size_t ubuntu_font_size;
+    lv_font_t * font = lv_tiny_ttf_create_data_ex(ubuntu_font, ubuntu_font_size, DIGITS_FONT_SIZE, DIGITS_CACHE_SIZE);
+    lv_tiny_ttf_set_cache_rle(font, true);
+
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_label_set_text(label, "12:34");
+    lv_refr_now(NULL);
+
+    lv_tiny_ttf_cache_info_t info;
+    lv_tiny_ttf_get_cache_info(font, &info);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, info.used_size);
+    uint32_t miss_cnt = info.miss_cnt;
+
+    lv_tiny_ttf_flush_cache(font);
+    lv_tiny_ttf_get_cache_info(font, &info);
+    TEST_ASSERT_EQUAL_UINT32(0, info.used_size);
+
+    /*The glyphs are rendered again when needed*/
+    lv_obj_invalidate(label);
+    lv_refr_now(NULL);
+    lv_tiny_ttf_get_cache_info(font, &info);
+    TEST_ASSERT_EQUAL_UINT32(2 * miss_cnt, info.miss_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, info.used_size);
+
+    lv_obj_del(label);
+    lv_tiny_ttf_destroy(font);
+#else
+    TEST_PASS();
+#endif
+}
+
+#if LV_USE_TINY_TTF
+/**
+ * Redraw the label with changing times like a clock does
+ * @return      the time of the refreshes in microseconds
+ */
+static uint32_t refr_digits(lv_obj_t * label, const lv_font_t * font, lv_tiny_ttf_cache_info_t * info)
+{
+    static const char * times[] = {"12:34:56", "07:08:09", "20:19:58"};
+
+    lv_tiny_ttf_cache_info_t info_start;
+    lv_tiny_ttf_get_cache_info(font, &info_start);
+
+    uint64_t t_start = lv_test_get_time_us();
+    uint32_t i;
+    for(i = 0; i < DIGITS_REFR_CNT; i++) {
+        lv_label_set_text_static(label, times[i % 3]);
+        lv_refr_now(NULL);
+    }
+    uint32_t t_elaps = (uint32_t)(lv_test_get_time_us() - t_start);
+
+    lv_tiny_ttf_get_cache_info(font, info);
+    info->hit_cnt -= info_start.hit_cnt;
+    info->miss_cnt -= info_start.miss_cnt;
+    return t_elaps;
+}
+#endif
+
 #endif
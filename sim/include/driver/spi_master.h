@@ -0,0 +1,45 @@
+/*Host stand-in for driver/spi_master.h. The bus only exists to be passed to the LCD panel IO*/
+#ifndef DRIVER_SPI_MASTER_H
+#define DRIVER_SPI_MASTER_H
+
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "driver/gpio.h"
+
+typedef enum
+{
+    SPI1_HOST = 0,
+    SPI2_HOST = 1,
+    SPI3_HOST = 2,
+    SPI_HOST_MAX,
+} spi_host_device_t;
+
+typedef enum
+{
+    SPI_DMA_DISABLED = 0,
+    SPI_DMA_CH_AUTO = 3,
+} spi_common_dma_t;
+
+typedef spi_common_dma_t spi_dma_chan_t;
+
+typedef struct
+{
+    int mosi_io_num;
+    int miso_io_num;
+    int sclk_io_num;
+    int quadwp_io_num;
+    int quadhd_io_num;
+    int data4_io_num;
+    int data5_io_num;
+    int data6_io_num;
+    int data7_io_num;
+    int max_transfer_sz;
+    uint32_t flags;
+    int intr_flags;
+} spi_bus_config_t;
+
+esp_err_t spi_bus_initialize(spi_host_device_t host_id, const spi_bus_config_t* bus_config, spi_dma_chan_t dma_chan);
+esp_err_t spi_bus_free(spi_host_device_t host_id);
+
+#endif // DRIVER_SPI_MASTER_H
@@ -0,0 +1,10 @@
+/*Host stand-in: memory placement attributes have no meaning on the host*/
+#ifndef ESP_ATTR_H
+#define ESP_ATTR_H
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_DATA_ATTR
+#define EXT_RAM_BSS_ATTR
+
+#endif // ESP_ATTR_H
@@ -0,0 +1,29 @@
+/*Host stand-in for esp_lcd_types.h*/
+#ifndef ESP_LCD_TYPES_H
+#define ESP_LCD_TYPES_H
+
+#include <stdint.h>
+
+typedef struct esp_lcd_panel_io_t* esp_lcd_panel_io_handle_t;
+typedef struct esp_lcd_panel_t* esp_lcd_panel_handle_t;
+
+typedef enum
+{
+    LCD_RGB_ELEMENT_ORDER_RGB,
+    LCD_RGB_ELEMENT_ORDER_BGR,
+} lcd_rgb_element_order_t;
+
+typedef enum
+{
+    LCD_RGB_DATA_ENDIAN_BIG = 0,
+    LCD_RGB_DATA_ENDIAN_LITTLE,
+} lcd_rgb_data_endian_t;
+
+typedef enum
+{
+    ESP_LCD_COLOR_SPACE_RGB,
+    ESP_LCD_COLOR_SPACE_BGR,
+    ESP_LCD_COLOR_SPACE_MONOCHROME,
+} esp_lcd_color_space_t;
+
+#endif // ESP_LCD_TYPES_H
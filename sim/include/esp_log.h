@@ -0,0 +1,42 @@
+/*Host stand-in for esp_log.h. Prints in the same "I (ms) tag: message" format as the target*/
+#ifndef ESP_LOG_H
+#define ESP_LOG_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdarg.h>
+
+#include "esp_err.h"
+
+typedef enum
+{
+    ESP_LOG_NONE,
+    ESP_LOG_ERROR,
+    ESP_LOG_WARN,
+    ESP_LOG_INFO,
+    ESP_LOG_DEBUG,
+    ESP_LOG_VERBOSE,
+} esp_log_level_t;
+
+void esp_log_level_set(const char* tag, esp_log_level_t level);
+uint32_t esp_log_timestamp(void);
+void esp_log_write(esp_log_level_t level, const char* tag, const char* format, ...) __attribute__((format(printf, 3, 4)));
+
+#define ESP_LOG_FORMAT(letter, format)  #letter " (%u) %s: " format "\n"
+
+#define ESP_LOG_LEVEL(level, letter, tag, format, ...) \
+    esp_log_write(level, tag, ESP_LOG_FORMAT(letter, format), (unsigned)esp_log_timestamp(), tag, ##__VA_ARGS__)
+
+#define ESP_LOGE(tag, format, ...)  ESP_LOG_LEVEL(ESP_LOG_ERROR, E, tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...)  ESP_LOG_LEVEL(ESP_LOG_WARN, W, tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...)  ESP_LOG_LEVEL(ESP_LOG_INFO, I, tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...)  ESP_LOG_LEVEL(ESP_LOG_DEBUG, D, tag, format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...)  ESP_LOG_LEVEL(ESP_LOG_VERBOSE, V, tag, format, ##__VA_ARGS__)
+
+#define ESP_EARLY_LOGE  ESP_LOGE
+#define ESP_EARLY_LOGW  ESP_LOGW
+#define ESP_EARLY_LOGI  ESP_LOGI
+#define ESP_EARLY_LOGD  ESP_LOGD
+#define ESP_EARLY_LOGV  ESP_LOGV
+
+#endif // ESP_LOG_H
@@ -0,0 +1,82 @@
+/*Host stand-in for the esp_lvgl_port component (LVGL 8 API). Same configuration structures,
+the LVGL task and the display flush are reimplemented for the simulator, see src/lvgl_port_sim.c*/
+#ifndef ESP_LVGL_PORT_H
+#define ESP_LVGL_PORT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "esp_err.h"
+#include "esp_lcd_types.h"
+#include "lvgl.h"
+
+typedef enum
+{
+    LVGL_PORT_EVENT_DISPLAY = 1,
+    LVGL_PORT_EVENT_TOUCH   = 2,
+    LVGL_PORT_EVENT_USER    = 99,
+} lvgl_port_event_type_t;
+
+typedef struct
+{
+    int task_priority;
+    int task_stack;
+    int task_affinity;
+    int task_max_sleep_ms;
+    int timer_period_ms;
+} lvgl_port_cfg_t;
+
+#define ESP_LVGL_PORT_INIT_CONFIG() \
+    {                               \
+        .task_priority = 4,         \
+        .task_stack = 6144,         \
+        .task_affinity = -1,        \
+        .task_max_sleep_ms = 500,   \
+        .timer_period_ms = 5,       \
+    }
+
+typedef struct
+{
+    bool swap_xy;
+    bool mirror_x;
+    bool mirror_y;
+} lvgl_port_rotation_cfg_t;
+
+typedef struct
+{
+    esp_lcd_panel_io_handle_t io_handle;
+    esp_lcd_panel_handle_t panel_handle;
+    esp_lcd_panel_handle_t control_handle;
+
+    uint32_t buffer_size;
+    bool double_buffer;
+    uint32_t trans_size;
+
+    uint32_t hres;
+    uint32_t vres;
+
+    bool monochrome;
+
+    lvgl_port_rotation_cfg_t rotation;
+    struct
+    {
+        unsigned int buff_dma: 1;
+        unsigned int buff_spiram: 1;
+        unsigned int sw_rotate: 1;
+        unsigned int full_refresh: 1;
+        unsigned int direct_mode: 1;
+    } flags;
+} lvgl_port_display_cfg_t;
+
+esp_err_t lvgl_port_init(const lvgl_port_cfg_t* cfg);
+esp_err_t lvgl_port_deinit(void);
+bool lvgl_port_lock(uint32_t timeout_ms);
+void lvgl_port_unlock(void);
+lv_disp_t* lvgl_port_add_disp(const lvgl_port_display_cfg_t* disp_cfg);
+esp_err_t lvgl_port_remove_disp(lv_disp_t* disp);
+void lvgl_port_flush_ready(lv_disp_t* disp);
+esp_err_t lvgl_port_stop(void);
+esp_err_t lvgl_port_resume(void);
+esp_err_t lvgl_port_task_wake(lvgl_port_event_type_t event, void* param);
+
+#endif // ESP_LVGL_PORT_H
@@ -0,0 +1,53 @@
+/*Host stand-in for esp_partition.h. The data partitions are files, see sim_partition_set_file() in src/sim.h*/
+#ifndef ESP_PARTITION_H
+#define ESP_PARTITION_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "esp_err.h"
+
+typedef enum
+{
+    ESP_PARTITION_TYPE_APP = 0x00,
+    ESP_PARTITION_TYPE_DATA = 0x01,
+    ESP_PARTITION_TYPE_ANY = 0xff,
+} esp_partition_type_t;
+
+typedef enum
+{
+    ESP_PARTITION_SUBTYPE_DATA_UNDEFINED = 0x06,
+    ESP_PARTITION_SUBTYPE_ANY = 0xff,
+} esp_partition_subtype_t;
+
+typedef enum
+{
+    ESP_PARTITION_MMAP_DATA,
+    ESP_PARTITION_MMAP_INST,
+} esp_partition_mmap_memory_t;
+
+typedef uint32_t esp_partition_mmap_handle_t;
+
+typedef struct
+{
+    esp_partition_type_t type;
+    esp_partition_subtype_t subtype;
+    uint32_t address;
+    uint32_t size;
+    char label[17];
+    bool encrypted;
+    bool readonly;
+} esp_partition_t;
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char* label);
+esp_err_t esp_partition_read(const esp_partition_t* partition, size_t src_offset, void* dst, size_t size);
+
+/*Maps the file read-only with mmap(), like the flash cache maps the partition on the target*/
+esp_err_t esp_partition_mmap(const esp_partition_t* partition, size_t offset, size_t size,
+                             esp_partition_mmap_memory_t memory, const void** out_ptr,
+                             esp_partition_mmap_handle_t* out_handle);
+void esp_partition_munmap(esp_partition_mmap_handle_t handle);
+
+#endif // ESP_PARTITION_H
@@ -0,0 +1,14 @@
+/*Host stand-in for esp_system.h*/
+#ifndef ESP_SYSTEM_H
+#define ESP_SYSTEM_H
+
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "esp_attr.h"
+
+void esp_restart(void) __attribute__((noreturn));
+uint32_t esp_get_free_heap_size(void);
+uint32_t esp_get_minimum_free_heap_size(void);
+
+#endif // ESP_SYSTEM_H
@@ -0,0 +1,9 @@
+/*Host stand-in for esp_timer.h*/
+#ifndef ESP_TIMER_H
+#define ESP_TIMER_H
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time(void); // Microseconds since the start of the simulator
+
+#endif // ESP_TIMER_H
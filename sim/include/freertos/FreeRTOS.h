@@ -0,0 +1,47 @@
+/*Host stand-in for FreeRTOS. Tasks run as POSIX threads, see src/freertos_sim.c*/
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <assert.h>
+#include <sched.h>
+
+#include "esp_attr.h"
+#include "esp_err.h"
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint32_t StackType_t;
+
+#define pdFALSE     ((BaseType_t)0)
+#define pdTRUE      ((BaseType_t)1)
+#define pdPASS      pdTRUE
+#define pdFAIL      pdFALSE
+#define errQUEUE_EMPTY  ((BaseType_t)0)
+#define errQUEUE_FULL   ((BaseType_t)0)
+
+#define configTICK_RATE_HZ      100 // CONFIG_FREERTOS_HZ default of ESP-IDF
+#define configMAX_PRIORITIES    25
+#define configASSERT(x)         assert(x)
+
+#define portMAX_DELAY           ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS      ((TickType_t)1000 / configTICK_RATE_HZ)
+#define portNUM_PROCESSORS      2
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(((TickType_t)(ms) * (TickType_t)configTICK_RATE_HZ) / (TickType_t)1000U))
+#define pdTICKS_TO_MS(ticks)    ((TickType_t)(((uint64_t)(ticks) * 1000U) / configTICK_RATE_HZ))
+
+/*ISRs of the simulator run on the thread which changes the pin level, a yield is not needed*/
+#define portYIELD_FROM_ISR(...) ((void)0)
+#define portYIELD()             sched_yield()
+#define tskNO_AFFINITY          ((BaseType_t)0x7fffffff)
+#define tskIDLE_PRIORITY        ((UBaseType_t)0U)
+
+/*ESP-IDF's FreeRTOS.h pulls these in through idf_additions.h, the firmware relies on it*/
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+#endif // FREERTOS_H
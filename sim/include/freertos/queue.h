@@ -0,0 +1,25 @@
+/*Host stand-in for freertos/queue.h*/
+#ifndef FREERTOS_QUEUE_H
+#define FREERTOS_QUEUE_H
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct sim_queue* QueueHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size);
+void vQueueDelete(QueueHandle_t queue);
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks_to_wait);
+BaseType_t xQueueSendToFront(QueueHandle_t queue, const void* item, TickType_t ticks_to_wait);
+BaseType_t xQueueReceive(QueueHandle_t queue, void* buffer, TickType_t ticks_to_wait);
+BaseType_t xQueuePeek(QueueHandle_t queue, void* buffer, TickType_t ticks_to_wait);
+BaseType_t xQueueReset(QueueHandle_t queue);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue);
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* item, BaseType_t* higher_priority_task_woken);
+BaseType_t xQueueReceiveFromISR(QueueHandle_t queue, void* buffer, BaseType_t* higher_priority_task_woken);
+
+#define xQueueSendToBack(queue, item, ticks)        xQueueSend(queue, item, ticks)
+#define xQueueSendToBackFromISR(queue, item, woken) xQueueSendFromISR(queue, item, woken)
+
+#endif // FREERTOS_QUEUE_H
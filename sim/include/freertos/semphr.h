@@ -0,0 +1,25 @@
+/*Host stand-in for freertos/semphr.h. Semaphores are queues without payload like in FreeRTOS*/
+#ifndef FREERTOS_SEMPHR_H
+#define FREERTOS_SEMPHR_H
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+typedef QueueHandle_t SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max_count, UBaseType_t initial_count);
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(void);
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t mutex, TickType_t ticks_to_wait);
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t mutex);
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t semaphore, BaseType_t* higher_priority_task_woken);
+BaseType_t xSemaphoreTakeFromISR(SemaphoreHandle_t semaphore, BaseType_t* higher_priority_task_woken);
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t semaphore);
+
+#define vSemaphoreDelete(semaphore) vQueueDelete(semaphore)
+
+#endif // FREERTOS_SEMPHR_H
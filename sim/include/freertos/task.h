@@ -0,0 +1,28 @@
+/*Host stand-in for freertos/task.h*/
+#ifndef FREERTOS_TASK_H
+#define FREERTOS_TASK_H
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct sim_task* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task_code, const char* name, uint32_t stack_depth, void* parameters,
+                                   UBaseType_t priority, TaskHandle_t* created_task, BaseType_t core_id);
+#define xTaskCreate(task_code, name, stack_depth, parameters, priority, created_task) \
+    xTaskCreatePinnedToCore(task_code, name, stack_depth, parameters, priority, created_task, tskNO_AFFINITY)
+
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+void vTaskDelayUntil(TickType_t* previous_wake_time, TickType_t time_increment);
+TickType_t xTaskGetTickCount(void);
+TickType_t xTaskGetTickCountFromISR(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+const char* pcTaskGetName(TaskHandle_t task);
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_count_on_exit, TickType_t ticks_to_wait);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higher_priority_task_woken);
+
+#endif // FREERTOS_TASK_H
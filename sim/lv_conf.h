@@ -0,0 +1,19 @@
+/*LVGL configuration of the simulator. On the target the configuration comes from Kconfig,
+so only the options the firmware needs are set here, everything else keeps the Kconfig default*/
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#define LV_COLOR_DEPTH      16
+#define LV_COLOR_16_SWAP    1   // The ST7789 takes the high byte first, like in the esp_lvgl_port examples
+
+#define LV_MEM_SIZE         (32U * 1024U)
+
+#define LV_USE_LOG          1
+#define LV_LOG_LEVEL        LV_LOG_LEVEL_WARN
+#define LV_LOG_PRINTF       1
+
+#define LV_USE_MSG          1
+#define LV_LABEL_LINE_CACHE 1   // The two line date is drawn on every refresh of the clock
+#define LV_USE_TINY_TTF     1
+
+#endif // LV_CONF_H
@@ -0,0 +1,211 @@
+/*Writes the asset packs of main/core/include/assets.h. The host and the target are both little endian, so the header
+and the entries are written as they are in memory*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sim.h"
+
+#define MANIFEST_ASSETS_MAX     64
+
+static uint32_t align(uint32_t offset)
+{
+    return (offset + ASSETS_ALIGN - 1) / ASSETS_ALIGN * ASSETS_ALIGN;
+}
+
+bool sim_assets_write(const char* path, const sim_asset_t* assets, int cnt)
+{
+    if (cnt > UINT16_MAX)
+    {
+        fprintf(stderr, "%s: too many assets\n", path);
+        return false;
+    }
+
+    assets_entry_t* entries = calloc(cnt > 0 ? cnt : 1, sizeof(assets_entry_t));
+    if (entries == NULL)
+    {
+        return false;
+    }
+
+    uint32_t offset = align(sizeof(assets_header_t) + cnt * sizeof(assets_entry_t));
+    for (int i = 0; i < cnt; i++)
+    {
+        if (strlen(assets[i].name) >= ASSETS_NAME_LENGTH)
+        {
+            fprintf(stderr, "%s: the name \"%s\" is too long\n", path, assets[i].name);
+            free(entries);
+            return false;
+        }
+        if (assets[i].type == ASSET_TYPE_IMAGE && assets[i].size < sizeof(lv_img_header_t))
+        {
+            fprintf(stderr, "%s: \"%s\" is not an LVGL image\n", path, assets[i].name);
+            free(entries);
+            return false;
+        }
+
+        strcpy(entries[i].name, assets[i].name);
+        entries[i].type = assets[i].type;
+        entries[i].offset = offset;
+        entries[i].size = (uint32_t)assets[i].size;
+        offset = align(offset + entries[i].size);
+    }
+
+    assets_header_t header =
+    {
+        .magic = ASSETS_MAGIC,
+        .version = ASSETS_VERSION,
+        .entry_cnt = (uint16_t)cnt,
+        .size = offset,
+    };
+
+    FILE* file = fopen(path, "wb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Can't create %s\n", path);
+        free(entries);
+        return false;
+    }
+
+    static const uint8_t padding[ASSETS_ALIGN] = {0};
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(entries, sizeof(assets_entry_t), cnt, file) == (size_t)cnt;
+    long position = (long)(sizeof(header) + cnt * sizeof(assets_entry_t));
+    for (int i = 0; i < cnt && ok; i++)
+    {
+        ok = fwrite(padding, 1, entries[i].offset - position, file) == entries[i].offset - position &&
+             fwrite(assets[i].data, 1, assets[i].size, file) == assets[i].size;
+        position = entries[i].offset + entries[i].size;
+    }
+    ok = ok && fwrite(padding, 1, offset - position, file) == offset - position;
+
+    if (fclose(file) != 0 || !ok)
+    {
+        fprintf(stderr, "Failed to write %s\n", path);
+        ok = false;
+    }
+
+    free(entries);
+    return ok;
+}
+
+static bool parse_type(const char* name, asset_type_t* type)
+{
+    static const char* const names[] = {"raw", "ttf", "image"}; // In the order of asset_type_t
+
+    for (int i = 0; i < (int)(sizeof(names) / sizeof(names[0])); i++)
+    {
+        if (strcmp(name, names[i]) == 0)
+        {
+            *type = (asset_type_t)i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void* read_file(const char* path, size_t* size)
+{
+    FILE* file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        return NULL;
+    }
+
+    void* data = NULL;
+    if (fseek(file, 0, SEEK_END) == 0)
+    {
+        long length = ftell(file);
+        data = length >= 0 ? malloc(length > 0 ? length : 1) : NULL;
+        if (data != NULL)
+        {
+            rewind(file);
+            if (fread(data, 1, length, file) == (size_t)length)
+            {
+                *size = (size_t)length;
+            }
+            else
+            {
+                free(data);
+                data = NULL;
+            }
+        }
+    }
+
+    fclose(file);
+    return data;
+}
+
+bool sim_assets_build(const char* manifest_path, const char* path)
+{
+    FILE* manifest = fopen(manifest_path, "r");
+    if (manifest == NULL)
+    {
+        fprintf(stderr, "Can't open %s\n", manifest_path);
+        return false;
+    }
+
+    /*Relative paths are relative to the directory of the manifest*/
+    const char* slash = strrchr(manifest_path, '/');
+    int dir_length = slash != NULL ? (int)(slash - manifest_path + 1) : 0;
+
+    static sim_asset_t assets[MANIFEST_ASSETS_MAX];
+    static char names[MANIFEST_ASSETS_MAX][ASSETS_NAME_LENGTH];
+    int cnt = 0;
+    bool ok = true;
+
+    char line[512];
+    int line_number = 0;
+    while (ok && fgets(line, sizeof(line), manifest) != NULL)
+    {
+        line_number++;
+
+        char type_name[16];
+        char name[64];
+        char file_name[256];
+        int field_cnt = sscanf(line, "%15s %63s %255s", type_name, name, file_name);
+        if (field_cnt <= 0 || line[strspn(line, " \t")] == '#')
+        {
+            continue;
+        }
+
+        asset_type_t type;
+        if (field_cnt != 3 || !parse_type(type_name, &type) || strlen(name) >= ASSETS_NAME_LENGTH)
+        {
+            fprintf(stderr, "%s:%d: expected <raw|ttf|image> <name> <file>\n", manifest_path, line_number);
+            ok = false;
+            break;
+        }
+        if (cnt == MANIFEST_ASSETS_MAX)
+        {
+            fprintf(stderr, "%s:%d: too many assets\n", manifest_path, line_number);
+            ok = false;
+            break;
+        }
+
+        char file_path[512];
+        snprintf(file_path, sizeof(file_path), "%.*s%s", file_name[0] == '/' ? 0 : dir_length, manifest_path,
+                 file_name);
+        size_t size = 0;
+        void* data = read_file(file_path, &size);
+        if (data == NULL)
+        {
+            fprintf(stderr, "%s:%d: can't read %s\n", manifest_path, line_number, file_path);
+            ok = false;
+            break;
+        }
+
+        strcpy(names[cnt], name);
+        assets[cnt] = (sim_asset_t){.name = names[cnt], .type = type, .data = data, .size = size};
+        cnt++;
+    }
+    fclose(manifest);
+
+    ok = ok && sim_assets_write(path, assets, cnt);
+
+    for (int i = 0; i < cnt; i++)
+    {
+        free((void*)assets[i].data);
+    }
+    return ok;
+}
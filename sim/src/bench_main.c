@@ -0,0 +1,229 @@
+/*Benchmark of the whole firmware on the simulator. Runs app_main() and measures four phases:
+    startup     from reset until the end of the warm-up
+    idle        the clock ticking and the PPG sensor streaming, nothing else
+    analog      the same on the analog face
+    input       the same while the encoder is turned and the button is pressed
+Every phase reports the frame cost, the pixels and bytes sent to the display, the I2C traffic, the task wakeups and
+the input latency. The results can be written to a JSON file for regression tracking*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "driver/gpio.h"
+#include "esp_log.h"
+
+#include "sim.h"
+
+#define WARM_UP_MS              1000
+#define INPUT_CYCLE_MS          1000    // Turns and a press every cycle
+#define INPUT_ENCODER_STEPS     4       // In each direction
+#define INPUT_LONG_PRESS_CYCLE  5       // Every 5th press is a long one
+
+typedef struct
+{
+    double idle_s;
+    double input_s;
+    const char* json_path;
+    esp_log_level_t log_level;
+    uint32_t i2c_byte_time_ns;
+    uint32_t uart_baud_rate;
+} bench_options_t;
+
+typedef struct
+{
+    const char* name;
+    sim_snapshot_t start;
+    sim_snapshot_t end;
+} bench_phase_t;
+
+static const char TAG[] = "bench";
+
+void app_main(void);
+
+static void print_usage(const char* name)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  --idle <s>             length of the idle phase (default 10)\n"
+            "  --input <s>            length of the input phase (default 10)\n"
+            "  --json <file>          write the results to a JSON file\n"
+            "  --i2c-byte-ns <ns>     time an I2C byte holds the bus (default 0, 22500 is 400 kHz)\n"
+            "  --uart-baud <baud>     let printing take as long as on a UART console (default 0, no delay)\n"
+            "  --log-level <level>    none, error, warn (default), info, debug or verbose\n",
+            name);
+}
+
+static bool parse_options(int argc, char** argv, bench_options_t* options)
+{
+    static const char* const log_levels[] = {"none", "error", "warn", "info", "debug", "verbose"};
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const char* option = argv[i];
+        const char* value = argv[i + 1];
+
+        if (strcmp(option, "--idle") == 0)
+        {
+            options->idle_s = atof(value);
+        }
+        else if (strcmp(option, "--input") == 0)
+        {
+            options->input_s = atof(value);
+        }
+        else if (strcmp(option, "--json") == 0)
+        {
+            options->json_path = value;
+        }
+        else if (strcmp(option, "--i2c-byte-ns") == 0)
+        {
+            options->i2c_byte_time_ns = (uint32_t)strtoul(value, NULL, 10);
+        }
+        else if (strcmp(option, "--uart-baud") == 0)
+        {
+            options->uart_baud_rate = (uint32_t)strtoul(value, NULL, 10);
+        }
+        else if (strcmp(option, "--log-level") == 0)
+        {
+            int level = 0;
+            while (level < (int)(sizeof(log_levels) / sizeof(log_levels[0])) && strcmp(value, log_levels[level]) != 0)
+            {
+                level++;
+            }
+            if (level == (int)(sizeof(log_levels) / sizeof(log_levels[0])))
+            {
+                return false;
+            }
+            options->log_level = (esp_log_level_t)level;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return argc % 2 == 1 && options->idle_s > 0 && options->input_s > 0; // Every option takes a value
+}
+
+static void run_input(double duration_s)
+{
+    uint64_t end_us = sim_time_us() + (uint64_t)(duration_s * 1000000);
+    int cycle = 0;
+
+    while (sim_time_us() < end_us)
+    {
+        uint64_t cycle_end_us = sim_time_us() + INPUT_CYCLE_MS * 1000;
+
+        for (int i = 0; i < 2 * INPUT_ENCODER_STEPS; i++)
+        {
+            sim_input_turn_encoder(i < INPUT_ENCODER_STEPS);
+        }
+        sim_input_press(++cycle % INPUT_LONG_PRESS_CYCLE == 0);
+
+        uint64_t now_us = sim_time_us();
+        if (cycle_end_us > now_us)
+        {
+            sim_sleep_us(cycle_end_us - now_us);
+        }
+    }
+}
+
+static bool write_json(const char* path, const bench_phase_t* phases, int phase_cnt)
+{
+    FILE* file = fopen(path, "w");
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    fprintf(file, "{\"benchmark\": \"watch\", \"phases\": [\n");
+    for (int i = 0; i < phase_cnt; i++)
+    {
+        sim_report_write_json(file, phases[i].name, &phases[i].start, &phases[i].end);
+        fprintf(file, "%s\n", i + 1 < phase_cnt ? "," : "");
+    }
+    fprintf(file, "]}\n");
+
+    return fclose(file) == 0;
+}
+
+int main(int argc, char** argv)
+{
+    bench_options_t options =
+    {
+        .idle_s = 10,
+        .input_s = 10,
+        .log_level = ESP_LOG_WARN,
+    };
+
+    if (!parse_options(argc, argv, &options))
+    {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    esp_log_level_set("*", options.log_level);
+    sim_i2c_set_byte_time_ns(options.i2c_byte_time_ns);
+    sim_log_set_baud_rate(options.uart_baud_rate);
+
+    sim_gpio_init();
+    sim_ds3231_init();
+    sim_max30102_init(GPIO_NUM_4);
+
+    bench_phase_t phases[] =
+    {
+        {.name = "startup"}, // Starts from 0
+        {.name = "idle"},
+        {.name = "analog"},
+        {.name = "input"},
+    };
+
+    app_main();
+
+    /*The encoder ISR only takes the reference level on its first edge, don't count that as a missed event*/
+    sim_input_turn_encoder(true);
+    sim_sleep_us(WARM_UP_MS * 1000);
+    sim_snapshot_take(&phases[0].end);
+
+    sim_snapshot_take(&phases[1].start);
+    sim_sleep_us((uint64_t)(options.idle_s * 1000000));
+    sim_snapshot_take(&phases[1].end);
+
+    /*A long press switches to the next widget, the analog face. Its first frame draws the whole screen*/
+    sim_input_press(true);
+    sim_sleep_us(WARM_UP_MS * 1000);
+    sim_snapshot_take(&phases[2].start);
+    sim_sleep_us((uint64_t)(options.idle_s * 1000000));
+    sim_snapshot_take(&phases[2].end);
+    sim_input_press(true); // Back to the clock
+
+    sim_snapshot_take(&phases[3].start);
+    run_input(options.input_s);
+    sim_snapshot_take(&phases[3].end);
+
+    int phase_cnt = (int)(sizeof(phases) / sizeof(phases[0]));
+    for (int i = 0; i < phase_cnt; i++)
+    {
+        sim_report_print(phases[i].name, &phases[i].start, &phases[i].end);
+    }
+
+    int status = EXIT_SUCCESS;
+    if (options.json_path != NULL && !write_json(options.json_path, phases, phase_cnt))
+    {
+        ESP_LOGE(TAG, "Failed to write %s", options.json_path);
+        status = EXIT_FAILURE;
+    }
+
+    if (phases[1].end.render.frame_cnt == phases[1].start.render.frame_cnt)
+    {
+        ESP_LOGE(TAG, "The clock wasn't redrawn while idle");
+        status = 2;
+    }
+
+    if (phases[2].end.render.frame_cnt == phases[2].start.render.frame_cnt)
+    {
+        ESP_LOGE(TAG, "The analog face wasn't redrawn");
+        status = 2;
+    }
+
+    fflush(stdout);
+    exit(status);
+}
@@ -0,0 +1,120 @@
+/*DS3231 RTC model. The time registers follow the host clock from the time last written to them*/
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+#include "sim.h"
+
+#define DS3231_ADDRESS      0x68
+#define REGISTER_COUNT      0x13
+#define TIME_REGISTER_COUNT 7
+
+#define CENTURY_BIT         0x80
+
+typedef struct
+{
+    pthread_mutex_t lock;
+    uint8_t registers[REGISTER_COUNT];
+    uint8_t pointer;
+    time_t time_at_set;     // RTC time (UTC) when the time was last written
+    uint64_t set_us;        // Host time of that write
+} ds3231_model_t;
+
+static ds3231_model_t ds3231;
+
+static uint8_t to_bcd(int value)
+{
+    return (uint8_t)(((value / 10) << 4) | (value % 10));
+}
+
+static int from_bcd(uint8_t bcd)
+{
+    return (bcd >> 4) * 10 + (bcd & 0x0f);
+}
+
+static void time_to_registers(ds3231_model_t* model)
+{
+    time_t now = model->time_at_set + (time_t)((sim_time_us() - model->set_us) / 1000000);
+    struct tm tm;
+    gmtime_r(&now, &tm);
+
+    model->registers[0] = to_bcd(tm.tm_sec);
+    model->registers[1] = to_bcd(tm.tm_min);
+    model->registers[2] = to_bcd(tm.tm_hour); // 24 hour mode
+    model->registers[3] = (uint8_t)(tm.tm_wday + 1);
+    model->registers[4] = to_bcd(tm.tm_mday);
+    model->registers[5] = to_bcd(tm.tm_mon + 1) | (tm.tm_year >= 200 ? CENTURY_BIT : 0);
+    model->registers[6] = to_bcd(tm.tm_year % 100);
+}
+
+static void registers_to_time(ds3231_model_t* model)
+{
+    struct tm tm = {0};
+    tm.tm_sec = from_bcd(model->registers[0] & 0x7f);
+    tm.tm_min = from_bcd(model->registers[1] & 0x7f);
+    tm.tm_hour = from_bcd(model->registers[2] & 0x3f);
+    tm.tm_mday = from_bcd(model->registers[4] & 0x3f);
+    tm.tm_mon = from_bcd(model->registers[5] & 0x1f) - 1;
+    tm.tm_year = 100 + from_bcd(model->registers[6]) + (model->registers[5] & CENTURY_BIT ? 100 : 0);
+
+    model->time_at_set = timegm(&tm);
+    model->set_us = sim_time_us();
+}
+
+static void ds3231_write(void* ctx, const uint8_t* data, size_t size)
+{
+    ds3231_model_t* model = ctx;
+
+    pthread_mutex_lock(&model->lock);
+    model->pointer = data[0] % REGISTER_COUNT;
+    time_to_registers(model);
+
+    bool time_written = false;
+    for (size_t i = 1; i < size; i++)
+    {
+        model->registers[model->pointer] = data[i];
+        time_written |= model->pointer < TIME_REGISTER_COUNT;
+        model->pointer = (model->pointer + 1) % REGISTER_COUNT;
+    }
+
+    /*Writing a time register restarts the count from the new time*/
+    if (time_written)
+    {
+        registers_to_time(model);
+    }
+    pthread_mutex_unlock(&model->lock);
+}
+
+static void ds3231_read(void* ctx, uint8_t* data, size_t size)
+{
+    ds3231_model_t* model = ctx;
+
+    pthread_mutex_lock(&model->lock);
+    time_to_registers(model); // The time is latched at the start of the read
+    for (size_t i = 0; i < size; i++)
+    {
+        data[i] = model->registers[model->pointer];
+        model->pointer = (model->pointer + 1) % REGISTER_COUNT;
+    }
+    pthread_mutex_unlock(&model->lock);
+}
+
+void sim_ds3231_init(void)
+{
+    memset(&ds3231, 0, sizeof(ds3231));
+    pthread_mutex_init(&ds3231.lock, NULL);
+
+    /*Start from the time of the host as if the coin cell had kept the RTC running*/
+    ds3231.time_at_set = time(NULL);
+    ds3231.set_us = sim_time_us();
+
+    sim_i2c_model_t model =
+    {
+        .name = "ds3231",
+        .address = DS3231_ADDRESS,
+        .write = ds3231_write,
+        .read = ds3231_read,
+        .ctx = &ds3231,
+    };
+    sim_i2c_add_model(&model);
+}
@@ -0,0 +1,158 @@
+/*Error names, logging, the time and system functions of ESP-IDF on the host*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <pthread.h>
+
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+
+#include "sim.h"
+
+#define LOG_TAG_LEVELS_MAX  8
+
+typedef struct
+{
+    char tag[32];
+    esp_log_level_t level;
+} tag_level_t;
+
+static esp_log_level_t default_log_level = ESP_LOG_INFO;
+static tag_level_t tag_levels[LOG_TAG_LEVELS_MAX];
+static int tag_level_count = 0;
+static pthread_mutex_t log_lock = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t console_baud_rate = 0;
+static uint64_t console_byte_cnt = 0;
+
+const char* esp_err_to_name(esp_err_t code)
+{
+    switch (code)
+    {
+    case ESP_OK: return "ESP_OK";
+    case ESP_FAIL: return "ESP_FAIL";
+    case ESP_ERR_NO_MEM: return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG: return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_INVALID_SIZE: return "ESP_ERR_INVALID_SIZE";
+    case ESP_ERR_NOT_FOUND: return "ESP_ERR_NOT_FOUND";
+    case ESP_ERR_NOT_SUPPORTED: return "ESP_ERR_NOT_SUPPORTED";
+    case ESP_ERR_TIMEOUT: return "ESP_ERR_TIMEOUT";
+    case ESP_ERR_INVALID_RESPONSE: return "ESP_ERR_INVALID_RESPONSE";
+    default: return "UNKNOWN ERROR";
+    }
+}
+
+void esp_log_level_set(const char* tag, esp_log_level_t level)
+{
+    pthread_mutex_lock(&log_lock);
+    if (strcmp(tag, "*") == 0)
+    {
+        default_log_level = level;
+        tag_level_count = 0; // Like on the target, "*" overrides the levels set for single tags
+    }
+    else
+    {
+        int i;
+        for (i = 0; i < tag_level_count && strcmp(tag_levels[i].tag, tag) != 0; i++)
+        {
+        }
+
+        if (i < LOG_TAG_LEVELS_MAX)
+        {
+            strncpy(tag_levels[i].tag, tag, sizeof(tag_levels[i].tag) - 1);
+            tag_levels[i].level = level;
+            if (i == tag_level_count)
+            {
+                tag_level_count++;
+            }
+        }
+    }
+    pthread_mutex_unlock(&log_lock);
+}
+
+void sim_log_set_baud_rate(uint32_t baud_rate)
+{
+    pthread_mutex_lock(&log_lock);
+    console_baud_rate = baud_rate;
+    pthread_mutex_unlock(&log_lock);
+}
+
+uint32_t sim_log_get_baud_rate(void)
+{
+    pthread_mutex_lock(&log_lock);
+    uint32_t baud_rate = console_baud_rate;
+    pthread_mutex_unlock(&log_lock);
+
+    return baud_rate;
+}
+
+uint64_t sim_log_get_byte_cnt(void)
+{
+    pthread_mutex_lock(&log_lock);
+    uint64_t byte_cnt = console_byte_cnt;
+    pthread_mutex_unlock(&log_lock);
+
+    return byte_cnt;
+}
+
+uint32_t esp_log_timestamp(void)
+{
+    return (uint32_t)(sim_time_us() / 1000);
+}
+
+void esp_log_write(esp_log_level_t level, const char* tag, const char* format, ...)
+{
+    pthread_mutex_lock(&log_lock);
+
+    esp_log_level_t tag_level = default_log_level;
+    for (int i = 0; i < tag_level_count; i++)
+    {
+        if (strcmp(tag_levels[i].tag, tag) == 0)
+        {
+            tag_level = tag_levels[i].level;
+            break;
+        }
+    }
+
+    if (level <= tag_level)
+    {
+        va_list args;
+        va_start(args, format);
+        int length = vfprintf(stdout, format, args);
+        va_end(args);
+        fflush(stdout);
+        console_byte_cnt += length > 0 ? length : 0;
+
+        /*Start and stop bit. The lock stays taken, the other tasks wait for the UART too*/
+        if (console_baud_rate > 0 && length > 0)
+        {
+            sim_sleep_us((uint64_t)length * 10 * 1000000 / console_baud_rate);
+        }
+    }
+
+    pthread_mutex_unlock(&log_lock);
+}
+
+void esp_restart(void)
+{
+    fprintf(stderr, "esp_restart() called, stopping the simulator\n");
+    exit(EXIT_FAILURE);
+}
+
+uint32_t esp_get_free_heap_size(void)
+{
+    return 0; // The host heap says nothing about the heap of the target
+}
+
+uint32_t esp_get_minimum_free_heap_size(void)
+{
+    return 0;
+}
+
+int64_t esp_timer_get_time(void)
+{
+    return (int64_t)sim_time_us();
+}
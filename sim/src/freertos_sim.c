@@ -0,0 +1,757 @@
+/*FreeRTOS on POSIX threads.
+Every task is a thread, queues and semaphores are built on a mutex and condition variables.
+Priorities and core affinity are ignored: the host schedules the threads like a multi-core CPU would*/
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+
+#include "sim.h"
+
+static const char TAG[] = "freertos_sim";
+
+struct sim_task
+{
+    pthread_t thread;
+    TaskFunction_t code;
+    void* parameters;
+    char name[16];
+    uint32_t stack_depth;
+    struct sim_task* next; // In the list of created tasks
+
+    pthread_mutex_t lock; // Protects the fields below
+    pthread_cond_t notified;
+    uint32_t notify_value;
+    uint32_t wake_cnt;
+    uint64_t probe_start_us;    // 0 when the probe isn't armed
+    uint64_t probe_latency_us;
+    bool probe_done;
+};
+
+typedef enum
+{
+    QUEUE_TYPE_QUEUE,       // Also used for binary and counting semaphores (item_size is 0)
+    QUEUE_TYPE_MUTEX,
+    QUEUE_TYPE_RECURSIVE_MUTEX,
+} queue_type_t;
+
+struct sim_queue
+{
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+    queue_type_t type;
+
+    uint8_t* storage;
+    UBaseType_t length;
+    UBaseType_t item_size;
+    UBaseType_t count;
+    UBaseType_t read_index;
+
+    TaskHandle_t holder; // Only for mutexes
+    UBaseType_t recursion;
+};
+
+static pthread_key_t current_task_key;
+static pthread_once_t current_task_key_once = PTHREAD_ONCE_INIT;
+static struct sim_task* task_list = NULL;
+static pthread_mutex_t task_list_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct timespec start_time;
+static pthread_once_t start_time_once = PTHREAD_ONCE_INIT;
+
+/*--------------------------------------------------------------------------------*/
+/*Clock*/
+
+static void init_start_time(void)
+{
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+}
+
+uint64_t sim_time_us(void)
+{
+    pthread_once(&start_time_once, init_start_time);
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)(now.tv_sec - start_time.tv_sec) * 1000000 + (now.tv_nsec - start_time.tv_nsec) / 1000;
+}
+
+void sim_sleep_us(uint64_t us)
+{
+    struct timespec ts = {.tv_sec = us / 1000000, .tv_nsec = (us % 1000000) * 1000};
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR)
+    {
+    }
+}
+
+static bool ticks_to_deadline(TickType_t ticks, struct timespec* deadline)
+{
+    /*Return false if the wait is infinite*/
+    if (ticks == portMAX_DELAY)
+    {
+        return false;
+    }
+
+    uint64_t ns = (uint64_t)pdTICKS_TO_MS(ticks) * 1000000;
+    clock_gettime(CLOCK_MONOTONIC, deadline);
+    ns += deadline->tv_nsec;
+    deadline->tv_sec += ns / 1000000000;
+    deadline->tv_nsec = ns % 1000000000;
+    return true;
+}
+
+static void init_cond(pthread_cond_t* cond)
+{
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+static bool wait_cond(pthread_cond_t* cond, pthread_mutex_t* lock, const struct timespec* deadline)
+{
+    /*Return false on timeout*/
+    if (deadline == NULL)
+    {
+        pthread_cond_wait(cond, lock);
+        return true;
+    }
+
+    return pthread_cond_timedwait(cond, lock, deadline) != ETIMEDOUT;
+}
+
+/*--------------------------------------------------------------------------------*/
+/*Tasks*/
+
+static void create_current_task_key(void)
+{
+    pthread_key_create(&current_task_key, NULL);
+}
+
+static struct sim_task* new_task(const char* name)
+{
+    struct sim_task* task = calloc(1, sizeof(struct sim_task));
+    if (task == NULL)
+    {
+        return NULL;
+    }
+
+    strncpy(task->name, name, sizeof(task->name) - 1);
+    pthread_mutex_init(&task->lock, NULL);
+    init_cond(&task->notified);
+    return task;
+}
+
+static void task_resumed(bool blocked)
+{
+    /*Called after a call which may block returned*/
+    struct sim_task* task = xTaskGetCurrentTaskHandle();
+
+    pthread_mutex_lock(&task->lock);
+    if (blocked)
+    {
+        task->wake_cnt++;
+    }
+
+    if (task->probe_start_us != 0 && !task->probe_done)
+    {
+        task->probe_latency_us = sim_time_us() - task->probe_start_us;
+        task->probe_done = true;
+    }
+    pthread_mutex_unlock(&task->lock);
+}
+
+static struct sim_task* find_task(const char* name)
+{
+    /*Task names are truncated like in FreeRTOS*/
+    pthread_mutex_lock(&task_list_lock);
+    struct sim_task* task = task_list;
+    while (task != NULL && strncmp(task->name, name, sizeof(task->name) - 1) != 0)
+    {
+        task = task->next;
+    }
+    pthread_mutex_unlock(&task_list_lock);
+
+    return task;
+}
+
+int sim_task_get_stats(sim_task_stats_t* stats, int max_cnt)
+{
+    /*The list is in reverse order of creation*/
+    int count = 0;
+    pthread_mutex_lock(&task_list_lock);
+    for (struct sim_task* task = task_list; task != NULL; task = task->next)
+    {
+        count++;
+    }
+
+    count = count < max_cnt ? count : max_cnt;
+    int i = count;
+    for (struct sim_task* task = task_list; task != NULL && i > 0; task = task->next)
+    {
+        i--;
+        memcpy(stats[i].name, task->name, sizeof(stats[i].name));
+        pthread_mutex_lock(&task->lock);
+        stats[i].wake_cnt = task->wake_cnt;
+        pthread_mutex_unlock(&task->lock);
+    }
+    pthread_mutex_unlock(&task_list_lock);
+
+    return count;
+}
+
+void sim_task_probe_arm(const char* name)
+{
+    struct sim_task* task = find_task(name);
+    if (task == NULL)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&task->lock);
+    task->probe_start_us = sim_time_us();
+    task->probe_done = false;
+    pthread_mutex_unlock(&task->lock);
+}
+
+bool sim_task_probe_read(const char* name, uint64_t* latency_us)
+{
+    struct sim_task* task = find_task(name);
+    if (task == NULL)
+    {
+        return false;
+    }
+
+    pthread_mutex_lock(&task->lock);
+    bool done = task->probe_done;
+    *latency_us = task->probe_latency_us;
+    task->probe_start_us = 0;
+    task->probe_done = false;
+    pthread_mutex_unlock(&task->lock);
+
+    return done;
+}
+
+static void* task_entry(void* arg)
+{
+    struct sim_task* task = arg;
+    pthread_setspecific(current_task_key, task);
+
+    task->code(task->parameters);
+
+    /*FreeRTOS tasks must not return*/
+    ESP_LOGE(TAG, "Task %s returned from its function", task->name);
+    return NULL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task_code, const char* name, uint32_t stack_depth, void* parameters,
+                                   UBaseType_t priority, TaskHandle_t* created_task, BaseType_t core_id)
+{
+    (void)priority;
+    (void)core_id;
+
+    pthread_once(&current_task_key_once, create_current_task_key);
+
+    struct sim_task* task = new_task(name);
+    if (task == NULL)
+    {
+        return pdFAIL;
+    }
+
+    task->code = task_code;
+    task->parameters = parameters;
+    task->stack_depth = stack_depth;
+
+    /*The handle has to be valid before the task runs, it may be notified right away*/
+    if (created_task != NULL)
+    {
+        *created_task = task;
+    }
+
+    if (pthread_create(&task->thread, NULL, task_entry, task) != 0)
+    {
+        ESP_LOGE(TAG, "Failed to start task %s", name);
+        free(task);
+        return pdFAIL;
+    }
+
+    pthread_detach(task->thread);
+    sim_heap_account(stack_depth, true); // The stack comes from the heap on the target
+
+    pthread_mutex_lock(&task_list_lock);
+    task->next = task_list;
+    task_list = task;
+    pthread_mutex_unlock(&task_list_lock);
+
+    return pdPASS;
+}
+
+static void unlist_task(struct sim_task* task)
+{
+    /*The task itself stays allocated, a handle may still be in use*/
+    pthread_mutex_lock(&task_list_lock);
+    for (struct sim_task** link = &task_list; *link != NULL; link = &(*link)->next)
+    {
+        if (*link == task)
+        {
+            *link = task->next;
+            sim_heap_account(task->stack_depth, false);
+            break;
+        }
+    }
+    pthread_mutex_unlock(&task_list_lock);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    if (task == NULL || task == xTaskGetCurrentTaskHandle())
+    {
+        unlist_task(xTaskGetCurrentTaskHandle());
+        pthread_exit(NULL);
+    }
+
+    unlist_task(task);
+    pthread_cancel(task->thread);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    sim_sleep_us((uint64_t)pdTICKS_TO_MS(ticks) * 1000);
+    task_resumed(ticks > 0);
+}
+
+void vTaskDelayUntil(TickType_t* previous_wake_time, TickType_t time_increment)
+{
+    *previous_wake_time += time_increment;
+    TickType_t now = xTaskGetTickCount();
+    vTaskDelay(*previous_wake_time > now ? *previous_wake_time - now : 0);
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)(sim_time_us() / (1000000 / configTICK_RATE_HZ));
+}
+
+TickType_t xTaskGetTickCountFromISR(void)
+{
+    return xTaskGetTickCount();
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    pthread_once(&current_task_key_once, create_current_task_key);
+
+    /*Threads not created by xTaskCreate (main, the simulator's own threads) get a handle on their first call*/
+    struct sim_task* task = pthread_getspecific(current_task_key);
+    if (task == NULL)
+    {
+        task = new_task("host");
+        task->thread = pthread_self();
+        pthread_setspecific(current_task_key, task);
+    }
+
+    return task;
+}
+
+const char* pcTaskGetName(TaskHandle_t task)
+{
+    return (task != NULL ? task : xTaskGetCurrentTaskHandle())->name;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task)
+{
+    /*Host stacks say nothing about the stacks on the target*/
+    (void)task;
+    return 0;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_count_on_exit, TickType_t ticks_to_wait)
+{
+    struct sim_task* task = xTaskGetCurrentTaskHandle();
+    struct timespec deadline;
+    bool has_deadline = ticks_to_deadline(ticks_to_wait, &deadline);
+    bool blocked = false;
+
+    pthread_mutex_lock(&task->lock);
+    while (task->notify_value == 0 && ticks_to_wait != 0)
+    {
+        blocked = true;
+        if (!wait_cond(&task->notified, &task->lock, has_deadline ? &deadline : NULL))
+        {
+            break;
+        }
+    }
+
+    uint32_t value = task->notify_value;
+    if (value != 0)
+    {
+        task->notify_value = clear_count_on_exit ? 0 : value - 1;
+    }
+    pthread_mutex_unlock(&task->lock);
+
+    if (ticks_to_wait != 0)
+    {
+        task_resumed(blocked);
+    }
+
+    return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    pthread_mutex_lock(&task->lock);
+    task->notify_value++;
+    pthread_cond_signal(&task->notified);
+    pthread_mutex_unlock(&task->lock);
+
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higher_priority_task_woken)
+{
+    xTaskNotifyGive(task);
+    if (higher_priority_task_woken != NULL)
+    {
+        *higher_priority_task_woken = pdTRUE;
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/*Queues*/
+
+static QueueHandle_t queue_create(UBaseType_t length, UBaseType_t item_size, queue_type_t type)
+{
+    struct sim_queue* queue = calloc(1, sizeof(struct sim_queue));
+    if (queue == NULL)
+    {
+        return NULL;
+    }
+
+    if (item_size > 0)
+    {
+        queue->storage = malloc((size_t)length * item_size);
+        if (queue->storage == NULL)
+        {
+            free(queue);
+            return NULL;
+        }
+    }
+
+    queue->length = length;
+    queue->item_size = item_size;
+    queue->type = type;
+    pthread_mutex_init(&queue->lock, NULL);
+    init_cond(&queue->not_empty);
+    init_cond(&queue->not_full);
+
+    return queue;
+}
+
+static void queue_write(QueueHandle_t queue, const void* item, bool to_front)
+{
+    if (queue->item_size > 0)
+    {
+        UBaseType_t index;
+        if (to_front)
+        {
+            queue->read_index = (queue->read_index + queue->length - 1) % queue->length;
+            index = queue->read_index;
+        }
+        else
+        {
+            index = (queue->read_index + queue->count) % queue->length;
+        }
+        memcpy(queue->storage + (size_t)index * queue->item_size, item, queue->item_size);
+    }
+
+    queue->count++;
+    pthread_cond_signal(&queue->not_empty);
+}
+
+static void queue_read(QueueHandle_t queue, void* buffer, bool peek)
+{
+    if (queue->item_size > 0)
+    {
+        memcpy(buffer, queue->storage + (size_t)queue->read_index * queue->item_size, queue->item_size);
+    }
+
+    if (!peek)
+    {
+        queue->read_index = (queue->read_index + 1) % queue->length;
+        queue->count--;
+        pthread_cond_signal(&queue->not_full);
+    }
+}
+
+static BaseType_t queue_send(QueueHandle_t queue, const void* item, TickType_t ticks_to_wait, bool to_front)
+{
+    struct timespec deadline;
+    bool has_deadline = ticks_to_deadline(ticks_to_wait, &deadline);
+    bool blocked = false;
+    BaseType_t result = pdPASS;
+
+    pthread_mutex_lock(&queue->lock);
+    while (queue->count == queue->length)
+    {
+        blocked = ticks_to_wait != 0;
+        if (ticks_to_wait == 0 || !wait_cond(&queue->not_full, &queue->lock, has_deadline ? &deadline : NULL))
+        {
+            result = errQUEUE_FULL;
+            break;
+        }
+    }
+
+    if (result == pdPASS)
+    {
+        queue_write(queue, item, to_front);
+    }
+    pthread_mutex_unlock(&queue->lock);
+
+    if (ticks_to_wait != 0)
+    {
+        task_resumed(blocked);
+    }
+
+    return result;
+}
+
+static BaseType_t queue_receive(QueueHandle_t queue, void* buffer, TickType_t ticks_to_wait, bool peek)
+{
+    struct timespec deadline;
+    bool has_deadline = ticks_to_deadline(ticks_to_wait, &deadline);
+    bool blocked = false;
+    BaseType_t result = pdPASS;
+
+    pthread_mutex_lock(&queue->lock);
+    while (queue->count == 0)
+    {
+        blocked = ticks_to_wait != 0;
+        if (ticks_to_wait == 0 || !wait_cond(&queue->not_empty, &queue->lock, has_deadline ? &deadline : NULL))
+        {
+            result = errQUEUE_EMPTY;
+            break;
+        }
+    }
+
+    if (result == pdPASS)
+    {
+        queue_read(queue, buffer, peek);
+    }
+    pthread_mutex_unlock(&queue->lock);
+
+    if (ticks_to_wait != 0)
+    {
+        task_resumed(blocked);
+    }
+
+    return result;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    return queue_create(length, item_size, QUEUE_TYPE_QUEUE);
+}
+
+void vQueueDelete(QueueHandle_t queue)
+{
+    pthread_mutex_destroy(&queue->lock);
+    pthread_cond_destroy(&queue->not_empty);
+    pthread_cond_destroy(&queue->not_full);
+    free(queue->storage);
+    free(queue);
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks_to_wait)
+{
+    return queue_send(queue, item, ticks_to_wait, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t queue, const void* item, TickType_t ticks_to_wait)
+{
+    return queue_send(queue, item, ticks_to_wait, true);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* buffer, TickType_t ticks_to_wait)
+{
+    return queue_receive(queue, buffer, ticks_to_wait, false);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t queue, void* buffer, TickType_t ticks_to_wait)
+{
+    return queue_receive(queue, buffer, ticks_to_wait, true);
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue)
+{
+    pthread_mutex_lock(&queue->lock);
+    queue->count = 0;
+    queue->read_index = 0;
+    pthread_cond_broadcast(&queue->not_full);
+    pthread_mutex_unlock(&queue->lock);
+
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+    pthread_mutex_lock(&queue->lock);
+    UBaseType_t count = queue->count;
+    pthread_mutex_unlock(&queue->lock);
+
+    return count;
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue)
+{
+    pthread_mutex_lock(&queue->lock);
+    UBaseType_t spaces = queue->length - queue->count;
+    pthread_mutex_unlock(&queue->lock);
+
+    return spaces;
+}
+
+static void set_woken(BaseType_t* higher_priority_task_woken, BaseType_t result)
+{
+    if (higher_priority_task_woken != NULL && result == pdPASS)
+    {
+        *higher_priority_task_woken = pdTRUE;
+    }
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* item, BaseType_t* higher_priority_task_woken)
+{
+    BaseType_t result = queue_send(queue, item, 0, false);
+    set_woken(higher_priority_task_woken, result);
+    return result;
+}
+
+BaseType_t xQueueReceiveFromISR(QueueHandle_t queue, void* buffer, BaseType_t* higher_priority_task_woken)
+{
+    BaseType_t result = queue_receive(queue, buffer, 0, false);
+    set_woken(higher_priority_task_woken, result);
+    return result;
+}
+
+/*--------------------------------------------------------------------------------*/
+/*Semaphores*/
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return queue_create(1, 0, QUEUE_TYPE_QUEUE); // Created empty like in FreeRTOS
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max_count, UBaseType_t initial_count)
+{
+    SemaphoreHandle_t semaphore = queue_create(max_count, 0, QUEUE_TYPE_QUEUE);
+    if (semaphore != NULL)
+    {
+        semaphore->count = initial_count;
+    }
+
+    return semaphore;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    SemaphoreHandle_t mutex = queue_create(1, 0, QUEUE_TYPE_MUTEX);
+    if (mutex != NULL)
+    {
+        mutex->count = 1; // Available
+    }
+
+    return mutex;
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(void)
+{
+    SemaphoreHandle_t mutex = queue_create(1, 0, QUEUE_TYPE_RECURSIVE_MUTEX);
+    if (mutex != NULL)
+    {
+        mutex->count = 1;
+    }
+
+    return mutex;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait)
+{
+    BaseType_t result = queue_receive(semaphore, NULL, ticks_to_wait, false);
+    if (result == pdPASS && semaphore->type != QUEUE_TYPE_QUEUE)
+    {
+        semaphore->holder = xTaskGetCurrentTaskHandle();
+    }
+
+    return result;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    if (semaphore->type != QUEUE_TYPE_QUEUE)
+    {
+        semaphore->holder = NULL;
+    }
+
+    return queue_send(semaphore, NULL, 0, false);
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t mutex, TickType_t ticks_to_wait)
+{
+    TaskHandle_t current = xTaskGetCurrentTaskHandle();
+    if (mutex->holder == current)
+    {
+        mutex->recursion++;
+        return pdPASS;
+    }
+
+    if (queue_receive(mutex, NULL, ticks_to_wait, false) != pdPASS)
+    {
+        return pdFAIL;
+    }
+
+    mutex->holder = current;
+    mutex->recursion = 1;
+    return pdPASS;
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t mutex)
+{
+    if (mutex->holder != xTaskGetCurrentTaskHandle())
+    {
+        return pdFAIL;
+    }
+
+    if (--mutex->recursion == 0)
+    {
+        mutex->holder = NULL;
+        queue_send(mutex, NULL, 0, false);
+    }
+
+    return pdPASS;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t semaphore, BaseType_t* higher_priority_task_woken)
+{
+    BaseType_t result = queue_send(semaphore, NULL, 0, false);
+    set_woken(higher_priority_task_woken, result);
+    return result;
+}
+
+BaseType_t xSemaphoreTakeFromISR(SemaphoreHandle_t semaphore, BaseType_t* higher_priority_task_woken)
+{
+    BaseType_t result = queue_receive(semaphore, NULL, 0, false);
+    set_woken(higher_priority_task_woken, result);
+    return result;
+}
+
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t semaphore)
+{
+    return uxQueueMessagesWaiting(semaphore);
+}
@@ -0,0 +1,274 @@
+/*GPIO with interrupts. The simulator drives the input pins, the ISRs run on the thread which changed the level*/
+#include <pthread.h>
+#include <stdbool.h>
+
+#include "driver/gpio.h"
+#include "esp_log.h"
+
+#include "sim.h"
+
+typedef struct
+{
+    int level;
+    gpio_mode_t mode;
+    gpio_int_type_t intr_type;
+    bool intr_enabled;
+    gpio_isr_t isr_handler;
+    void* isr_arg;
+} pin_t;
+
+static const char TAG[] = "gpio_sim";
+
+static pin_t pins[GPIO_NUM_MAX];
+static bool isr_service_installed = false;
+static pthread_mutex_t pin_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t isr_lock = PTHREAD_MUTEX_INITIALIZER; // ISRs don't preempt each other, like on a single interrupt level
+
+static bool is_valid_pin(gpio_num_t gpio_num)
+{
+    return gpio_num >= 0 && gpio_num < GPIO_NUM_MAX;
+}
+
+static bool is_triggered(gpio_int_type_t intr_type, int old_level, int new_level)
+{
+    switch (intr_type)
+    {
+    case GPIO_INTR_POSEDGE: return old_level == 0 && new_level == 1;
+    case GPIO_INTR_NEGEDGE: return old_level == 1 && new_level == 0;
+    case GPIO_INTR_ANYEDGE: return old_level != new_level;
+    case GPIO_INTR_LOW_LEVEL: return new_level == 0;
+    case GPIO_INTR_HIGH_LEVEL: return new_level == 1;
+    default: return false;
+    }
+}
+
+void sim_gpio_init(void)
+{
+    /*Every input of the watch has a pull-up (on the board or in the module)*/
+    pthread_mutex_lock(&pin_lock);
+    for (int i = 0; i < GPIO_NUM_MAX; i++)
+    {
+        pins[i].level = 1;
+    }
+    pthread_mutex_unlock(&pin_lock);
+}
+
+void sim_gpio_set_input_level(int gpio_num, int level)
+{
+    if (!is_valid_pin(gpio_num))
+    {
+        return;
+    }
+
+    level = level != 0;
+
+    pthread_mutex_lock(&pin_lock);
+    pin_t* pin = &pins[gpio_num];
+    int old_level = pin->level;
+    pin->level = level;
+
+    bool run_isr = isr_service_installed && pin->intr_enabled && pin->isr_handler != NULL &&
+                   is_triggered(pin->intr_type, old_level, level);
+    gpio_isr_t handler = pin->isr_handler;
+    void* arg = pin->isr_arg;
+    pthread_mutex_unlock(&pin_lock);
+
+    if (run_isr)
+    {
+        sim_isr_enter();
+        handler(arg);
+        sim_isr_exit();
+    }
+}
+
+void sim_isr_enter(void)
+{
+    pthread_mutex_lock(&isr_lock);
+}
+
+void sim_isr_exit(void)
+{
+    pthread_mutex_unlock(&isr_lock);
+}
+
+esp_err_t gpio_config(const gpio_config_t* config)
+{
+    if (config == NULL || config->pin_bit_mask == 0)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&pin_lock);
+    for (int i = 0; i < GPIO_NUM_MAX; i++)
+    {
+        if (config->pin_bit_mask & (1ULL << i))
+        {
+            pins[i].mode = config->mode;
+            pins[i].intr_type = config->intr_type;
+            pins[i].intr_enabled = config->intr_type != GPIO_INTR_DISABLE;
+        }
+    }
+    pthread_mutex_unlock(&pin_lock);
+
+    return ESP_OK;
+}
+
+esp_err_t gpio_reset_pin(gpio_num_t gpio_num)
+{
+    if (!is_valid_pin(gpio_num))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&pin_lock);
+    pins[gpio_num].mode = GPIO_MODE_INPUT;
+    pins[gpio_num].intr_type = GPIO_INTR_DISABLE;
+    pins[gpio_num].intr_enabled = false;
+    pthread_mutex_unlock(&pin_lock);
+
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_direction(gpio_num_t gpio_num, gpio_mode_t mode)
+{
+    if (!is_valid_pin(gpio_num))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&pin_lock);
+    pins[gpio_num].mode = mode;
+    pthread_mutex_unlock(&pin_lock);
+
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level)
+{
+    if (!is_valid_pin(gpio_num))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&pin_lock);
+    pins[gpio_num].level = level != 0;
+    pthread_mutex_unlock(&pin_lock);
+
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t gpio_num)
+{
+    if (!is_valid_pin(gpio_num))
+    {
+        return 0;
+    }
+
+    pthread_mutex_lock(&pin_lock);
+    int level = pins[gpio_num].level;
+    pthread_mutex_unlock(&pin_lock);
+
+    return level;
+}
+
+esp_err_t gpio_set_intr_type(gpio_num_t gpio_num, gpio_int_type_t intr_type)
+{
+    if (!is_valid_pin(gpio_num) || intr_type >= GPIO_INTR_MAX)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&pin_lock);
+    pins[gpio_num].intr_type = intr_type;
+    pthread_mutex_unlock(&pin_lock);
+
+    return ESP_OK;
+}
+
+static esp_err_t set_intr_enabled(gpio_num_t gpio_num, bool enabled)
+{
+    if (!is_valid_pin(gpio_num))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&pin_lock);
+    pins[gpio_num].intr_enabled = enabled;
+    pthread_mutex_unlock(&pin_lock);
+
+    return ESP_OK;
+}
+
+esp_err_t gpio_intr_enable(gpio_num_t gpio_num)
+{
+    return set_intr_enabled(gpio_num, true);
+}
+
+esp_err_t gpio_intr_disable(gpio_num_t gpio_num)
+{
+    return set_intr_enabled(gpio_num, false);
+}
+
+esp_err_t gpio_install_isr_service(int intr_alloc_flags)
+{
+    (void)intr_alloc_flags;
+
+    pthread_mutex_lock(&pin_lock);
+    bool was_installed = isr_service_installed;
+    isr_service_installed = true;
+    pthread_mutex_unlock(&pin_lock);
+
+    if (was_installed)
+    {
+        ESP_LOGW(TAG, "GPIO isr service already installed");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    return ESP_OK;
+}
+
+void gpio_uninstall_isr_service(void)
+{
+    pthread_mutex_lock(&pin_lock);
+    isr_service_installed = false;
+    pthread_mutex_unlock(&pin_lock);
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t gpio_num, gpio_isr_t isr_handler, void* args)
+{
+    if (!is_valid_pin(gpio_num))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&pin_lock);
+    if (!isr_service_installed)
+    {
+        pthread_mutex_unlock(&pin_lock);
+        ESP_LOGE(TAG, "GPIO isr service is not installed, call gpio_install_isr_service() first");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    /*Like on the target, adding a handler enables the interrupt of the pin*/
+    pins[gpio_num].isr_handler = isr_handler;
+    pins[gpio_num].isr_arg = args;
+    pins[gpio_num].intr_enabled = true;
+    pthread_mutex_unlock(&pin_lock);
+
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_remove(gpio_num_t gpio_num)
+{
+    if (!is_valid_pin(gpio_num))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&pin_lock);
+    pins[gpio_num].isr_handler = NULL;
+    pins[gpio_num].isr_arg = NULL;
+    pthread_mutex_unlock(&pin_lock);
+
+    return ESP_OK;
+}
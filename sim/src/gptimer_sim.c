@@ -0,0 +1,315 @@
+/*General purpose timers. Each timer has a thread which sleeps until the alarm and runs the alarm callback*/
+#include <pthread.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <time.h>
+
+#include "driver/gptimer.h"
+#include "esp_log.h"
+
+#include "sim.h"
+
+struct gptimer_t
+{
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t changed; // Signaled on every change which can move the alarm
+    bool deleted;
+
+    gptimer_count_direction_t direction;
+    uint32_t resolution_hz;
+
+    uint64_t alarm_count;
+    uint64_t reload_count;
+    bool auto_reload;
+    bool alarm_armed;       // The hardware disarms the alarm after it fired unless it reloads
+
+    gptimer_alarm_cb_t on_alarm;
+    void* user_ctx;
+
+    bool enabled;
+    bool running;
+    uint64_t count_at_start; // Count when the timer was started or the count was set
+    uint64_t start_us;
+};
+
+static const char TAG[] = "gptimer_sim";
+
+static uint64_t elapsed_ticks(const struct gptimer_t* timer, uint64_t now_us)
+{
+    return (now_us - timer->start_us) * timer->resolution_hz / 1000000;
+}
+
+static uint64_t get_count(const struct gptimer_t* timer, uint64_t now_us)
+{
+    if (!timer->running)
+    {
+        return timer->count_at_start;
+    }
+
+    uint64_t ticks = elapsed_ticks(timer, now_us);
+    return timer->direction == GPTIMER_COUNT_UP ? timer->count_at_start + ticks : timer->count_at_start - ticks;
+}
+
+static uint64_t get_alarm_time_us(const struct gptimer_t* timer)
+{
+    /*An alarm value the counter has already passed fires right away*/
+    uint64_t ticks;
+    if (timer->direction == GPTIMER_COUNT_UP)
+    {
+        ticks = timer->alarm_count > timer->count_at_start ? timer->alarm_count - timer->count_at_start : 0;
+    }
+    else
+    {
+        ticks = timer->count_at_start > timer->alarm_count ? timer->count_at_start - timer->alarm_count : 0;
+    }
+
+    return timer->start_us + ticks * 1000000 / timer->resolution_hz;
+}
+
+static void wait_until(struct gptimer_t* timer, uint64_t time_us)
+{
+    uint64_t now_us = sim_time_us();
+    if (time_us <= now_us)
+    {
+        return;
+    }
+
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+
+    uint64_t ns = (time_us - now_us) * 1000 + deadline.tv_nsec;
+    deadline.tv_sec += ns / 1000000000;
+    deadline.tv_nsec = ns % 1000000000;
+    pthread_cond_timedwait(&timer->changed, &timer->lock, &deadline);
+}
+
+static void* timer_thread(void* arg)
+{
+    struct gptimer_t* timer = arg;
+
+    pthread_mutex_lock(&timer->lock);
+    while (!timer->deleted)
+    {
+        if (!timer->enabled || !timer->running || !timer->alarm_armed)
+        {
+            pthread_cond_wait(&timer->changed, &timer->lock);
+            continue;
+        }
+
+        uint64_t alarm_us = get_alarm_time_us(timer);
+        if (sim_time_us() < alarm_us)
+        {
+            wait_until(timer, alarm_us);
+            continue; // Something might have changed, check again
+        }
+
+        gptimer_alarm_event_data_t edata =
+        {
+            .count_value = timer->alarm_count,
+            .alarm_value = timer->alarm_count,
+        };
+
+        if (timer->auto_reload)
+        {
+            timer->count_at_start = timer->reload_count;
+            timer->start_us = alarm_us;
+        }
+        else
+        {
+            timer->alarm_armed = false;
+        }
+
+        gptimer_alarm_cb_t on_alarm = timer->on_alarm;
+        void* user_ctx = timer->user_ctx;
+
+        /*The callback may call the timer functions, so don't hold the lock*/
+        pthread_mutex_unlock(&timer->lock);
+        if (on_alarm != NULL)
+        {
+            sim_isr_enter();
+            on_alarm(timer, &edata, user_ctx);
+            sim_isr_exit();
+        }
+        pthread_mutex_lock(&timer->lock);
+    }
+    pthread_mutex_unlock(&timer->lock);
+
+    return NULL;
+}
+
+esp_err_t gptimer_new_timer(const gptimer_config_t* config, gptimer_handle_t* ret_timer)
+{
+    if (config == NULL || ret_timer == NULL || config->resolution_hz == 0)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    struct gptimer_t* timer = calloc(1, sizeof(struct gptimer_t));
+    if (timer == NULL)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+
+    timer->direction = config->direction;
+    timer->resolution_hz = config->resolution_hz;
+
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&timer->changed, &attr);
+    pthread_condattr_destroy(&attr);
+    pthread_mutex_init(&timer->lock, NULL);
+
+    if (pthread_create(&timer->thread, NULL, timer_thread, timer) != 0)
+    {
+        free(timer);
+        return ESP_ERR_NO_MEM;
+    }
+
+    *ret_timer = timer;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_del_timer(gptimer_handle_t timer)
+{
+    pthread_mutex_lock(&timer->lock);
+    if (timer->enabled)
+    {
+        pthread_mutex_unlock(&timer->lock);
+        ESP_LOGE(TAG, "timer is not in init state");
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->deleted = true;
+    pthread_cond_signal(&timer->changed);
+    pthread_mutex_unlock(&timer->lock);
+
+    pthread_join(timer->thread, NULL);
+    pthread_mutex_destroy(&timer->lock);
+    pthread_cond_destroy(&timer->changed);
+    free(timer);
+
+    return ESP_OK;
+}
+
+esp_err_t gptimer_set_raw_count(gptimer_handle_t timer, uint64_t value)
+{
+    pthread_mutex_lock(&timer->lock);
+    timer->count_at_start = value;
+    timer->start_us = sim_time_us();
+    pthread_cond_signal(&timer->changed);
+    pthread_mutex_unlock(&timer->lock);
+
+    return ESP_OK;
+}
+
+esp_err_t gptimer_get_raw_count(gptimer_handle_t timer, uint64_t* value)
+{
+    pthread_mutex_lock(&timer->lock);
+    *value = get_count(timer, sim_time_us());
+    pthread_mutex_unlock(&timer->lock);
+
+    return ESP_OK;
+}
+
+esp_err_t gptimer_register_event_callbacks(gptimer_handle_t timer, const gptimer_event_callbacks_t* cbs, void* user_data)
+{
+    pthread_mutex_lock(&timer->lock);
+    if (timer->enabled)
+    {
+        pthread_mutex_unlock(&timer->lock);
+        ESP_LOGE(TAG, "timer is not in init state");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    timer->on_alarm = cbs->on_alarm;
+    timer->user_ctx = user_data;
+    pthread_mutex_unlock(&timer->lock);
+
+    return ESP_OK;
+}
+
+esp_err_t gptimer_set_alarm_action(gptimer_handle_t timer, const gptimer_alarm_config_t* config)
+{
+    pthread_mutex_lock(&timer->lock);
+    if (config != NULL)
+    {
+        timer->alarm_count = config->alarm_count;
+        timer->reload_count = config->reload_count;
+        timer->auto_reload = config->flags.auto_reload_on_alarm;
+        timer->alarm_armed = true;
+    }
+    else
+    {
+        timer->alarm_armed = false;
+    }
+    pthread_cond_signal(&timer->changed);
+    pthread_mutex_unlock(&timer->lock);
+
+    return ESP_OK;
+}
+
+static esp_err_t set_state(gptimer_handle_t timer, bool* flag, bool value, const char* error)
+{
+    pthread_mutex_lock(&timer->lock);
+    if (*flag == value)
+    {
+        pthread_mutex_unlock(&timer->lock);
+        ESP_LOGE(TAG, "%s", error);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    *flag = value;
+    pthread_cond_signal(&timer->changed);
+    pthread_mutex_unlock(&timer->lock);
+
+    return ESP_OK;
+}
+
+esp_err_t gptimer_enable(gptimer_handle_t timer)
+{
+    return set_state(timer, &timer->enabled, true, "timer is already enabled");
+}
+
+esp_err_t gptimer_disable(gptimer_handle_t timer)
+{
+    return set_state(timer, &timer->enabled, false, "timer is not enabled");
+}
+
+esp_err_t gptimer_start(gptimer_handle_t timer)
+{
+    pthread_mutex_lock(&timer->lock);
+    if (!timer->enabled || timer->running)
+    {
+        pthread_mutex_unlock(&timer->lock);
+        ESP_LOGE(TAG, "timer is not enabled yet or already running");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    /*Starting re-arms the alarm like the driver on the target does*/
+    timer->running = true;
+    timer->alarm_armed = true;
+    timer->start_us = sim_time_us();
+    pthread_cond_signal(&timer->changed);
+    pthread_mutex_unlock(&timer->lock);
+
+    return ESP_OK;
+}
+
+esp_err_t gptimer_stop(gptimer_handle_t timer)
+{
+    pthread_mutex_lock(&timer->lock);
+    if (!timer->running)
+    {
+        pthread_mutex_unlock(&timer->lock);
+        ESP_LOGE(TAG, "timer is not running");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    timer->count_at_start = get_count(timer, sim_time_us()); // Freeze the count
+    timer->running = false;
+    pthread_cond_signal(&timer->changed);
+    pthread_mutex_unlock(&timer->lock);
+
+    return ESP_OK;
+}
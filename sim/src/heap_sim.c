@@ -0,0 +1,96 @@
+/*Heap accounting. The link wraps malloc(), calloc(), realloc() and free() of the firmware, LVGL and the stand-ins,
+so the usage is what the same code would take from the heap of the target (plus the allocator overhead of the host).
+Memory allocated inside the C library isn't counted*/
+#include <malloc.h>
+#include <stdatomic.h>
+
+#include "sim.h"
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void __real_free(void* ptr);
+
+static atomic_uint_fast64_t used = 0;
+static atomic_uint_fast64_t peak = 0;
+static atomic_uint_fast64_t alloc_cnt = 0;
+
+static void add_used(size_t size)
+{
+    uint64_t now_used = atomic_fetch_add(&used, size) + size;
+    uint64_t old_peak = atomic_load(&peak);
+    while (now_used > old_peak && !atomic_compare_exchange_weak(&peak, &old_peak, now_used))
+    {
+    }
+}
+
+void sim_heap_account(size_t size, bool allocated)
+{
+    if (allocated)
+    {
+        add_used(size);
+    }
+    else
+    {
+        atomic_fetch_sub(&used, size);
+    }
+}
+
+void sim_heap_get_stats(sim_heap_stats_t* stats)
+{
+    stats->used = atomic_load(&used);
+    stats->peak = atomic_load(&peak);
+    stats->alloc_cnt = atomic_load(&alloc_cnt);
+}
+
+void* __wrap_malloc(size_t size)
+{
+    void* ptr = __real_malloc(size);
+    if (ptr != NULL)
+    {
+        atomic_fetch_add(&alloc_cnt, 1);
+        add_used(malloc_usable_size(ptr));
+    }
+
+    return ptr;
+}
+
+void* __wrap_calloc(size_t count, size_t size)
+{
+    void* ptr = __real_calloc(count, size);
+    if (ptr != NULL)
+    {
+        atomic_fetch_add(&alloc_cnt, 1);
+        add_used(malloc_usable_size(ptr));
+    }
+
+    return ptr;
+}
+
+void* __wrap_realloc(void* ptr, size_t size)
+{
+    size_t old_size = malloc_usable_size(ptr); // 0 for NULL
+    void* new_ptr = __real_realloc(ptr, size);
+    if (new_ptr == NULL && size > 0)
+    {
+        return NULL; // The old block is untouched
+    }
+
+    atomic_fetch_sub(&used, old_size);
+    if (new_ptr != NULL)
+    {
+        atomic_fetch_add(&alloc_cnt, ptr == NULL);
+        add_used(malloc_usable_size(new_ptr));
+    }
+
+    return new_ptr;
+}
+
+void __wrap_free(void* ptr)
+{
+    if (ptr != NULL)
+    {
+        atomic_fetch_sub(&used, malloc_usable_size(ptr));
+        __real_free(ptr);
+    }
+}
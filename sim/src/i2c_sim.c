@@ -0,0 +1,241 @@
+/*I2C master bus. Transactions are passed to the device models and counted per device*/
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "driver/i2c_master.h"
+#include "esp_log.h"
+
+#include "sim.h"
+
+#define MODELS_MAX  8
+#define DEVICES_MAX 8
+
+struct i2c_master_bus_t
+{
+    pthread_mutex_t lock; // One transaction at a time, like the bus lock of the driver
+    i2c_master_bus_config_t config;
+};
+
+struct i2c_master_dev_t
+{
+    struct i2c_master_bus_t* bus;
+    const sim_i2c_model_t* model; // NULL if no device answers on the address
+    uint16_t address;
+    uint32_t scl_speed_hz;
+
+    uint32_t transaction_cnt;
+    uint64_t byte_cnt;
+    uint64_t busy_us;
+};
+
+static const char TAG[] = "i2c_sim";
+
+static sim_i2c_model_t models[MODELS_MAX];
+static int model_count = 0;
+static struct i2c_master_dev_t* devices[DEVICES_MAX];
+static int device_count = 0;
+static pthread_mutex_t registry_lock = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t byte_time_ns = 0;
+
+void sim_i2c_add_model(const sim_i2c_model_t* model)
+{
+    pthread_mutex_lock(&registry_lock);
+    if (model_count < MODELS_MAX)
+    {
+        models[model_count++] = *model;
+    }
+    pthread_mutex_unlock(&registry_lock);
+}
+
+static const sim_i2c_model_t* find_model(uint16_t address)
+{
+    for (int i = 0; i < model_count; i++)
+    {
+        if (models[i].address == address)
+        {
+            return &models[i];
+        }
+    }
+
+    return NULL;
+}
+
+void sim_i2c_set_byte_time_ns(uint32_t time_ns)
+{
+    __atomic_store_n(&byte_time_ns, time_ns, __ATOMIC_RELAXED);
+}
+
+int sim_i2c_get_stats(sim_i2c_dev_stats_t* stats, int max_cnt)
+{
+    pthread_mutex_lock(&registry_lock);
+    int count = device_count < max_cnt ? device_count : max_cnt;
+    for (int i = 0; i < count; i++)
+    {
+        struct i2c_master_dev_t* dev = devices[i];
+        pthread_mutex_lock(&dev->bus->lock);
+        stats[i].name = dev->model != NULL ? dev->model->name : "(no device)";
+        stats[i].address = dev->address;
+        stats[i].transaction_cnt = dev->transaction_cnt;
+        stats[i].byte_cnt = dev->byte_cnt;
+        stats[i].busy_us = dev->busy_us;
+        pthread_mutex_unlock(&dev->bus->lock);
+    }
+    pthread_mutex_unlock(&registry_lock);
+
+    return count;
+}
+
+esp_err_t i2c_new_master_bus(const i2c_master_bus_config_t* bus_config, i2c_master_bus_handle_t* ret_bus_handle)
+{
+    if (bus_config == NULL || ret_bus_handle == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    struct i2c_master_bus_t* bus = calloc(1, sizeof(struct i2c_master_bus_t));
+    if (bus == NULL)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+
+    bus->config = *bus_config;
+    pthread_mutex_init(&bus->lock, NULL);
+
+    *ret_bus_handle = bus;
+    return ESP_OK;
+}
+
+esp_err_t i2c_del_master_bus(i2c_master_bus_handle_t bus_handle)
+{
+    pthread_mutex_destroy(&bus_handle->lock);
+    free(bus_handle);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_bus_add_device(i2c_master_bus_handle_t bus_handle, const i2c_device_config_t* dev_config,
+                                    i2c_master_dev_handle_t* ret_handle)
+{
+    if (bus_handle == NULL || dev_config == NULL || ret_handle == NULL || dev_config->scl_speed_hz == 0)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    struct i2c_master_dev_t* dev = calloc(1, sizeof(struct i2c_master_dev_t));
+    if (dev == NULL)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+
+    dev->bus = bus_handle;
+    dev->address = dev_config->device_address;
+    dev->scl_speed_hz = dev_config->scl_speed_hz;
+
+    pthread_mutex_lock(&registry_lock);
+    dev->model = find_model(dev->address);
+    if (device_count < DEVICES_MAX)
+    {
+        devices[device_count++] = dev;
+    }
+    pthread_mutex_unlock(&registry_lock);
+
+    /*Like the driver, adding a device doesn't probe it*/
+    *ret_handle = dev;
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_bus_rm_device(i2c_master_dev_handle_t handle)
+{
+    pthread_mutex_lock(&registry_lock);
+    for (int i = 0; i < device_count; i++)
+    {
+        if (devices[i] == handle)
+        {
+            devices[i] = devices[--device_count];
+            break;
+        }
+    }
+    pthread_mutex_unlock(&registry_lock);
+
+    free(handle);
+    return ESP_OK;
+}
+
+static esp_err_t transfer(i2c_master_dev_handle_t dev, const uint8_t* write_buffer, size_t write_size,
+                          uint8_t* read_buffer, size_t read_size)
+{
+    if (dev == NULL || (write_size > 0 && write_buffer == NULL) || (read_size > 0 && read_buffer == NULL))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&dev->bus->lock);
+
+    /*Count the address byte of every (repeated) start, 9 clocks per byte plus start and stop*/
+    size_t bytes = write_size + read_size + (write_size > 0) + (read_size > 0);
+    dev->transaction_cnt++;
+    dev->byte_cnt += bytes;
+    dev->busy_us += ((uint64_t)bytes * 9 + 2) * 1000000 / dev->scl_speed_hz;
+
+    /*The bus stays locked meanwhile, like the real one is busy*/
+    uint32_t time_ns = __atomic_load_n(&byte_time_ns, __ATOMIC_RELAXED);
+    if (time_ns > 0)
+    {
+        sim_sleep_us((uint64_t)bytes * time_ns / 1000);
+    }
+
+    if (dev->model == NULL)
+    {
+        pthread_mutex_unlock(&dev->bus->lock);
+        ESP_LOGE(TAG, "I2C transaction failed: no device at 0x%02x", dev->address);
+        return ESP_ERR_INVALID_STATE; // The driver's answer to a NACK
+    }
+
+    if (write_size > 0)
+    {
+        dev->model->write(dev->model->ctx, write_buffer, write_size);
+    }
+
+    if (read_size > 0)
+    {
+        dev->model->read(dev->model->ctx, read_buffer, read_size);
+    }
+
+    pthread_mutex_unlock(&dev->bus->lock);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_transmit(i2c_master_dev_handle_t i2c_dev, const uint8_t* write_buffer, size_t write_size,
+                              int xfer_timeout_ms)
+{
+    (void)xfer_timeout_ms;
+    return transfer(i2c_dev, write_buffer, write_size, NULL, 0);
+}
+
+esp_err_t i2c_master_receive(i2c_master_dev_handle_t i2c_dev, uint8_t* read_buffer, size_t read_size,
+                             int xfer_timeout_ms)
+{
+    (void)xfer_timeout_ms;
+    return transfer(i2c_dev, NULL, 0, read_buffer, read_size);
+}
+
+esp_err_t i2c_master_transmit_receive(i2c_master_dev_handle_t i2c_dev, const uint8_t* write_buffer, size_t write_size,
+                                      uint8_t* read_buffer, size_t read_size, int xfer_timeout_ms)
+{
+    (void)xfer_timeout_ms;
+    return transfer(i2c_dev, write_buffer, write_size, read_buffer, read_size);
+}
+
+esp_err_t i2c_master_probe(i2c_master_bus_handle_t bus_handle, uint16_t address, int xfer_timeout_ms)
+{
+    (void)bus_handle;
+    (void)xfer_timeout_ms;
+
+    pthread_mutex_lock(&registry_lock);
+    bool found = find_model(address) != NULL;
+    pthread_mutex_unlock(&registry_lock);
+
+    return found ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
@@ -0,0 +1,165 @@
+/*Scripted input. Turns lines like "1500 right 3" into encoder turns and button presses.
+Format: <time in ms since the start> <action> [argument]. Actions:
+    right [steps]       turn the encoder clockwise
+    left [steps]        turn the encoder counter-clockwise
+    press               short press of the button
+    long_press          hold the button for 800 ms
+    screenshot <path>   write the screen to a PPM file
+Empty lines and lines starting with # are ignored*/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "config.h"
+#include "esp_log.h"
+#include "esp_lvgl_port.h"
+
+#include "sim.h"
+
+#define SCRIPT_STEPS_MAX        256
+#define SCRIPT_ARG_MAX_LENGTH   128
+
+typedef enum
+{
+    ACTION_RIGHT,
+    ACTION_LEFT,
+    ACTION_PRESS,
+    ACTION_LONG_PRESS,
+    ACTION_SCREENSHOT,
+} action_t;
+
+typedef struct
+{
+    uint32_t time_ms;
+    action_t action;
+    int count;
+    char arg[SCRIPT_ARG_MAX_LENGTH];
+} script_step_t;
+
+static const char TAG[] = "input_script";
+
+static script_step_t steps[SCRIPT_STEPS_MAX];
+static int step_count = 0;
+
+static bool parse_action(const char* name, action_t* action)
+{
+    static const char* const names[] = {"right", "left", "press", "long_press", "screenshot"};
+
+    for (int i = 0; i < (int)(sizeof(names) / sizeof(names[0])); i++)
+    {
+        if (strcmp(name, names[i]) == 0)
+        {
+            *action = (action_t)i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool sim_input_load_script(const char* path)
+{
+    FILE* file = fopen(path, "r");
+    if (file == NULL)
+    {
+        ESP_LOGE(TAG, "Can't open %s", path);
+        return false;
+    }
+
+    char line[256];
+    int line_number = 0;
+    bool ok = true;
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        line_number++;
+
+        char name[32];
+        script_step_t step = {.count = 1};
+        int field_cnt = sscanf(line, "%u %31s %127s", &step.time_ms, name, step.arg);
+        if (field_cnt <= 0 || line[strspn(line, " \t")] == '#')
+        {
+            continue; // Empty line or comment
+        }
+
+        if (field_cnt < 2 || !parse_action(name, &step.action) || step_count == SCRIPT_STEPS_MAX ||
+            (step.action == ACTION_SCREENSHOT && field_cnt < 3))
+        {
+            ESP_LOGE(TAG, "%s:%d: invalid step", path, line_number);
+            ok = false;
+            break;
+        }
+
+        if (field_cnt == 3 && step.action != ACTION_SCREENSHOT)
+        {
+            step.count = atoi(step.arg);
+        }
+
+        steps[step_count++] = step;
+    }
+
+    fclose(file);
+    return ok;
+}
+
+static void run_step(const script_step_t* step)
+{
+    switch (step->action)
+    {
+    case ACTION_RIGHT:
+    case ACTION_LEFT:
+        for (int i = 0; i < step->count; i++)
+        {
+            sim_input_turn_encoder(step->action == ACTION_RIGHT);
+        }
+        break;
+
+    case ACTION_PRESS:
+        sim_input_press(false);
+        break;
+
+    case ACTION_LONG_PRESS:
+        sim_input_press(true);
+        break;
+
+    case ACTION_SCREENSHOT:
+        lvgl_port_lock(0); // Between two refreshes
+        if (!sim_lcd_write_ppm(step->arg, DISPLAY_SIZE_X, DISPLAY_SIZE_Y))
+        {
+            ESP_LOGE(TAG, "Failed to write %s", step->arg);
+        }
+        lvgl_port_unlock();
+        break;
+    }
+}
+
+static void* script_thread(void* arg)
+{
+    (void)arg;
+
+    for (int i = 0; i < step_count; i++)
+    {
+        uint64_t step_us = (uint64_t)steps[i].time_ms * 1000;
+        uint64_t now_us = sim_time_us();
+        if (step_us > now_us)
+        {
+            sim_sleep_us(step_us - now_us);
+        }
+
+        run_step(&steps[i]);
+    }
+
+    return NULL;
+}
+
+void sim_input_start(void)
+{
+    if (step_count == 0)
+    {
+        return;
+    }
+
+    pthread_t thread;
+    pthread_create(&thread, NULL, script_thread, NULL);
+    pthread_detach(thread);
+}
@@ -0,0 +1,101 @@
+/*Encoder and button. Sets the pin levels the way the real contacts would and measures the input latency:
+the time from the edge which should produce an input event until the input task of the firmware returns from its
+queue. The ISRs, the debounce timer and the queue in between are the ones of the firmware*/
+#include <pthread.h>
+
+#include "config.h"
+
+#include "sim.h"
+
+#define INPUT_TASK_NAME         "input_events_handler_task" // Created in app_main()
+
+#define ENCODER_EDGE_GAP_MS     2   // Between the edges of the two encoder contacts
+#define ENCODER_STEP_GAP_MS     30
+#define SHORT_PRESS_MS          80
+#define LONG_PRESS_MS           800
+#define BUTTON_SETTLE_MS        50  // Longer than the debounce time of the firmware
+
+static pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static sim_input_stats_t stats[SIM_INPUT_KIND_CNT];
+static int clk_level = 1;
+
+static void add_sample(sim_input_kind_t kind)
+{
+    uint64_t latency_us;
+    bool woke = sim_task_probe_read(INPUT_TASK_NAME, &latency_us);
+
+    pthread_mutex_lock(&stats_lock);
+    if (woke)
+    {
+        stats[kind].event_cnt++;
+        stats[kind].latency_sum_us += latency_us;
+        if (latency_us > stats[kind].latency_max_us)
+        {
+            stats[kind].latency_max_us = (uint32_t)latency_us;
+        }
+    }
+    else
+    {
+        stats[kind].missed_cnt++;
+    }
+    pthread_mutex_unlock(&stats_lock);
+}
+
+void sim_input_turn_encoder(bool clockwise)
+{
+    /*Quadrature: DT leads CLK in one direction and follows it in the other.
+    The ISR compares the levels when CLK changes, DT changing alone produces no event*/
+    int next_clk_level = !clk_level;
+    sim_gpio_set_input_level(ENCODER_DT_PIN, clockwise ? clk_level : next_clk_level);
+    sim_sleep_us(ENCODER_EDGE_GAP_MS * 1000);
+
+    sim_task_probe_arm(INPUT_TASK_NAME);
+    sim_gpio_set_input_level(ENCODER_CLK_PIN, next_clk_level);
+    clk_level = next_clk_level;
+    sim_sleep_us(ENCODER_STEP_GAP_MS * 1000);
+    add_sample(SIM_INPUT_ENCODER_STEP);
+}
+
+void sim_input_press(bool long_press)
+{
+    /*A short press is reported after the release, a long press while the button is still held*/
+    if (long_press)
+    {
+        sim_task_probe_arm(INPUT_TASK_NAME);
+    }
+    sim_gpio_set_input_level(GPIO_BUTTON_PIN, 0);
+    sim_sleep_us((long_press ? LONG_PRESS_MS : SHORT_PRESS_MS) * 1000);
+
+    if (long_press)
+    {
+        add_sample(SIM_INPUT_LONG_PRESS);
+    }
+    else
+    {
+        sim_task_probe_arm(INPUT_TASK_NAME);
+    }
+    sim_gpio_set_input_level(GPIO_BUTTON_PIN, 1);
+    sim_sleep_us(BUTTON_SETTLE_MS * 1000);
+
+    if (!long_press)
+    {
+        add_sample(SIM_INPUT_PRESS);
+    }
+}
+
+void sim_input_get_stats(sim_input_kind_t kind, sim_input_stats_t* kind_stats, bool restart_max)
+{
+    pthread_mutex_lock(&stats_lock);
+    *kind_stats = stats[kind];
+    if (restart_max)
+    {
+        stats[kind].latency_max_us = 0;
+    }
+    pthread_mutex_unlock(&stats_lock);
+}
+
+const char* sim_input_get_kind_name(sim_input_kind_t kind)
+{
+    static const char* const names[SIM_INPUT_KIND_CNT] = {"encoder_step", "press", "long_press"};
+    return names[kind];
+}
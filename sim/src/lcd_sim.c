@@ -0,0 +1,407 @@
+/*SPI LCD panel IO and ST7789 panel driver on top of a model of the ST7789.
+The panel functions send the same commands as the esp_lcd ST7789 driver, the model decodes them into its RAM.
+Every byte sent on the bus is counted*/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_vendor.h"
+#include "esp_lcd_panel_ops.h"
+#include "esp_log.h"
+
+#include "sim.h"
+
+#define ST7789_RAM_WIDTH    240
+#define ST7789_RAM_HEIGHT   320
+
+#define LCD_CMD_SWRESET     0x01
+#define LCD_CMD_SLPIN       0x10
+#define LCD_CMD_SLPOUT      0x11
+#define LCD_CMD_INVOFF      0x20
+#define LCD_CMD_INVON       0x21
+#define LCD_CMD_DISPOFF     0x28
+#define LCD_CMD_DISPON      0x29
+#define LCD_CMD_CASET       0x2A
+#define LCD_CMD_RASET       0x2B
+#define LCD_CMD_RAMWR       0x2C
+#define LCD_CMD_MADCTL      0x36
+#define LCD_CMD_COLMOD      0x3A
+#define LCD_CMD_RAMWRC      0x3C
+
+#define LCD_CMD_MX_BIT      (1 << 6)
+#define LCD_CMD_MY_BIT      (1 << 7)
+#define LCD_CMD_MV_BIT      (1 << 5)
+#define LCD_CMD_BGR_BIT     (1 << 3)
+
+struct esp_lcd_panel_io_t
+{
+    esp_lcd_panel_io_spi_config_t config;
+    esp_lcd_panel_io_color_trans_done_cb_t on_color_trans_done;
+    void* user_ctx;
+};
+
+struct esp_lcd_panel_t
+{
+    esp_lcd_panel_io_handle_t io;
+    int x_gap;
+    int y_gap;
+    uint8_t madctl;
+    uint8_t colmod;
+};
+
+typedef struct
+{
+    pthread_mutex_t lock;
+    uint16_t ram[ST7789_RAM_HEIGHT][ST7789_RAM_WIDTH]; // RGB565 in the order of the bus (MSB first)
+
+    int x_start;
+    int x_end;
+    int y_start;
+    int y_end;
+    int x;
+    int y;
+
+    uint8_t madctl;
+    bool inverted;
+    bool display_on;
+    bool sleeping;
+
+    sim_spi_stats_t stats;
+} st7789_model_t;
+
+static const char TAG[] = "lcd_sim";
+
+static st7789_model_t st7789 =
+{
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .x_end = ST7789_RAM_WIDTH - 1,
+    .y_end = ST7789_RAM_HEIGHT - 1,
+    .sleeping = true,
+};
+
+/*--------------------------------------------------------------------------------*/
+/*ST7789 model*/
+
+static void count_bytes(st7789_model_t* model, size_t size)
+{
+    model->stats.byte_cnt += size;
+    if (model->stats.pclk_hz > 0)
+    {
+        model->stats.busy_us += (uint64_t)size * 8 * 1000000 / model->stats.pclk_hz;
+    }
+}
+
+static int get_u16(const uint8_t* data)
+{
+    return data[0] << 8 | data[1];
+}
+
+static void model_command(st7789_model_t* model, int cmd, const uint8_t* param, size_t size)
+{
+    switch (cmd)
+    {
+    case LCD_CMD_SWRESET:
+        model->inverted = false;
+        model->display_on = false;
+        model->sleeping = true;
+        model->madctl = 0;
+        break;
+    case LCD_CMD_SLPIN: model->sleeping = true; break;
+    case LCD_CMD_SLPOUT: model->sleeping = false; break;
+    case LCD_CMD_INVOFF: model->inverted = false; break;
+    case LCD_CMD_INVON: model->inverted = true; break;
+    case LCD_CMD_DISPOFF: model->display_on = false; break;
+    case LCD_CMD_DISPON: model->display_on = true; break;
+    case LCD_CMD_MADCTL:
+        if (size >= 1)
+        {
+            model->madctl = param[0];
+        }
+        break;
+    case LCD_CMD_CASET:
+        if (size >= 4)
+        {
+            model->x_start = get_u16(&param[0]);
+            model->x_end = get_u16(&param[2]);
+        }
+        break;
+    case LCD_CMD_RASET:
+        if (size >= 4)
+        {
+            model->y_start = get_u16(&param[0]);
+            model->y_end = get_u16(&param[2]);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static void model_write_pixels(st7789_model_t* model, int cmd, const uint8_t* data, size_t size)
+{
+    /*The window is filled row by row. Only the default orientation of MADCTL is modeled*/
+    if (cmd == LCD_CMD_RAMWR)
+    {
+        model->x = model->x_start;
+        model->y = model->y_start;
+    }
+    else if (cmd != LCD_CMD_RAMWRC)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i + 1 < size; i += 2)
+    {
+        if (model->x < ST7789_RAM_WIDTH && model->y < ST7789_RAM_HEIGHT)
+        {
+            model->ram[model->y][model->x] = (uint16_t)get_u16(&data[i]);
+        }
+
+        if (++model->x > model->x_end)
+        {
+            model->x = model->x_start;
+            if (++model->y > model->y_end)
+            {
+                model->y = model->y_start;
+            }
+        }
+    }
+    model->stats.ramwr_cnt += cmd == LCD_CMD_RAMWR;
+}
+
+void sim_lcd_get_stats(sim_spi_stats_t* stats)
+{
+    pthread_mutex_lock(&st7789.lock);
+    *stats = st7789.stats;
+    pthread_mutex_unlock(&st7789.lock);
+}
+
+bool sim_lcd_write_ppm(const char* path, int hres, int vres)
+{
+    FILE* file = fopen(path, "wb");
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    fprintf(file, "P6\n%d %d\n255\n", hres, vres);
+
+    pthread_mutex_lock(&st7789.lock);
+    for (int y = 0; y < vres; y++)
+    {
+        for (int x = 0; x < hres; x++)
+        {
+            uint16_t px = st7789.display_on ? st7789.ram[y][x] : 0;
+            if (st7789.display_on && !st7789.inverted)
+            {
+                px = ~px; // IPS panels like the one of the watch show the RAM as it is only with inversion on
+            }
+            uint8_t rgb[3] =
+            {
+                (uint8_t)(((px >> 11) & 0x1f) * 255 / 31),
+                (uint8_t)(((px >> 5) & 0x3f) * 255 / 63),
+                (uint8_t)((px & 0x1f) * 255 / 31),
+            };
+            fwrite(rgb, 1, sizeof(rgb), file);
+        }
+    }
+    pthread_mutex_unlock(&st7789.lock);
+
+    return fclose(file) == 0;
+}
+
+/*--------------------------------------------------------------------------------*/
+/*Panel IO*/
+
+esp_err_t esp_lcd_new_panel_io_spi(esp_lcd_spi_bus_handle_t bus, const esp_lcd_panel_io_spi_config_t* io_config,
+                                   esp_lcd_panel_io_handle_t* ret_io)
+{
+    (void)bus;
+
+    if (io_config == NULL || ret_io == NULL || io_config->pclk_hz == 0)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    struct esp_lcd_panel_io_t* io = calloc(1, sizeof(struct esp_lcd_panel_io_t));
+    if (io == NULL)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+
+    io->config = *io_config;
+    io->on_color_trans_done = io_config->on_color_trans_done;
+    io->user_ctx = io_config->user_ctx;
+
+    pthread_mutex_lock(&st7789.lock);
+    st7789.stats.pclk_hz = io_config->pclk_hz;
+    pthread_mutex_unlock(&st7789.lock);
+
+    *ret_io = io;
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_io_tx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void* param, size_t param_size)
+{
+    (void)io;
+
+    pthread_mutex_lock(&st7789.lock);
+    count_bytes(&st7789, 1 + param_size);
+    model_command(&st7789, lcd_cmd, param, param_size);
+    pthread_mutex_unlock(&st7789.lock);
+
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_io_tx_color(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void* color, size_t color_size)
+{
+    pthread_mutex_lock(&st7789.lock);
+    count_bytes(&st7789, 1 + color_size);
+    model_write_pixels(&st7789, lcd_cmd, color, color_size);
+    pthread_mutex_unlock(&st7789.lock);
+
+    /*The transfer is done when the call returns, unlike on the target where the DMA finishes later*/
+    if (io->on_color_trans_done != NULL)
+    {
+        esp_lcd_panel_io_event_data_t edata = {0};
+        io->on_color_trans_done(io, &edata, io->user_ctx);
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_io_rx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, void* param, size_t param_size)
+{
+    (void)io;
+    (void)lcd_cmd;
+    (void)param;
+    (void)param_size;
+
+    ESP_LOGE(TAG, "Reading from the panel is not supported on the SPI bus");
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t esp_lcd_panel_io_register_event_callbacks(esp_lcd_panel_io_handle_t io,
+                                                    const esp_lcd_panel_io_callbacks_t* cbs, void* user_ctx)
+{
+    io->on_color_trans_done = cbs->on_color_trans_done;
+    io->user_ctx = user_ctx;
+
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_io_del(esp_lcd_panel_io_handle_t io)
+{
+    free(io);
+    return ESP_OK;
+}
+
+/*--------------------------------------------------------------------------------*/
+/*ST7789 panel*/
+
+esp_err_t esp_lcd_new_panel_st7789(const esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_config_t* panel_dev_config,
+                                   esp_lcd_panel_handle_t* ret_panel)
+{
+    if (io == NULL || panel_dev_config == NULL || ret_panel == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (panel_dev_config->bits_per_pixel != 16)
+    {
+        ESP_LOGE(TAG, "Only 16 bits per pixel are modeled");
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    struct esp_lcd_panel_t* panel = calloc(1, sizeof(struct esp_lcd_panel_t));
+    if (panel == NULL)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+
+    panel->io = io;
+    panel->madctl = panel_dev_config->rgb_ele_order == LCD_RGB_ELEMENT_ORDER_BGR ? LCD_CMD_BGR_BIT : 0;
+    panel->colmod = 0x55; // 16 bits per pixel
+
+    *ret_panel = panel;
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_reset(esp_lcd_panel_handle_t panel)
+{
+    return esp_lcd_panel_io_tx_param(panel->io, LCD_CMD_SWRESET, NULL, 0);
+}
+
+esp_err_t esp_lcd_panel_init(esp_lcd_panel_handle_t panel)
+{
+    esp_lcd_panel_io_tx_param(panel->io, LCD_CMD_SLPOUT, NULL, 0);
+    esp_lcd_panel_io_tx_param(panel->io, LCD_CMD_MADCTL, &panel->madctl, 1);
+    esp_lcd_panel_io_tx_param(panel->io, LCD_CMD_COLMOD, &panel->colmod, 1);
+
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_del(esp_lcd_panel_handle_t panel)
+{
+    free(panel);
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_draw_bitmap(esp_lcd_panel_handle_t panel, int x_start, int y_start, int x_end, int y_end,
+                                    const void* color_data)
+{
+    if (x_start >= x_end || y_start >= y_end)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    x_start += panel->x_gap;
+    x_end += panel->x_gap;
+    y_start += panel->y_gap;
+    y_end += panel->y_gap;
+
+    uint8_t caset[4] = {(x_start >> 8) & 0xff, x_start & 0xff, ((x_end - 1) >> 8) & 0xff, (x_end - 1) & 0xff};
+    uint8_t raset[4] = {(y_start >> 8) & 0xff, y_start & 0xff, ((y_end - 1) >> 8) & 0xff, (y_end - 1) & 0xff};
+    esp_lcd_panel_io_tx_param(panel->io, LCD_CMD_CASET, caset, sizeof(caset));
+    esp_lcd_panel_io_tx_param(panel->io, LCD_CMD_RASET, raset, sizeof(raset));
+
+    size_t size = (size_t)(x_end - x_start) * (y_end - y_start) * 2;
+    return esp_lcd_panel_io_tx_color(panel->io, LCD_CMD_RAMWR, color_data, size);
+}
+
+esp_err_t esp_lcd_panel_mirror(esp_lcd_panel_handle_t panel, bool mirror_x, bool mirror_y)
+{
+    panel->madctl = (panel->madctl & ~(LCD_CMD_MX_BIT | LCD_CMD_MY_BIT)) |
+                    (mirror_x ? LCD_CMD_MX_BIT : 0) | (mirror_y ? LCD_CMD_MY_BIT : 0);
+    return esp_lcd_panel_io_tx_param(panel->io, LCD_CMD_MADCTL, &panel->madctl, 1);
+}
+
+esp_err_t esp_lcd_panel_swap_xy(esp_lcd_panel_handle_t panel, bool swap_axes)
+{
+    panel->madctl = (panel->madctl & ~LCD_CMD_MV_BIT) | (swap_axes ? LCD_CMD_MV_BIT : 0);
+    return esp_lcd_panel_io_tx_param(panel->io, LCD_CMD_MADCTL, &panel->madctl, 1);
+}
+
+esp_err_t esp_lcd_panel_set_gap(esp_lcd_panel_handle_t panel, int x_gap, int y_gap)
+{
+    panel->x_gap = x_gap;
+    panel->y_gap = y_gap;
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_invert_color(esp_lcd_panel_handle_t panel, bool invert_color_data)
+{
+    return esp_lcd_panel_io_tx_param(panel->io, invert_color_data ? LCD_CMD_INVON : LCD_CMD_INVOFF, NULL, 0);
+}
+
+esp_err_t esp_lcd_panel_disp_on_off(esp_lcd_panel_handle_t panel, bool on_off)
+{
+    return esp_lcd_panel_io_tx_param(panel->io, on_off ? LCD_CMD_DISPON : LCD_CMD_DISPOFF, NULL, 0);
+}
+
+esp_err_t esp_lcd_panel_disp_sleep(esp_lcd_panel_handle_t panel, bool sleep)
+{
+    return esp_lcd_panel_io_tx_param(panel->io, sleep ? LCD_CMD_SLPIN : LCD_CMD_SLPOUT, NULL, 0);
+}
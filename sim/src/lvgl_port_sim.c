@@ -0,0 +1,314 @@
+/*esp_lvgl_port for the simulator. Works like the component: a recursive mutex guards LVGL, a task runs
+lv_timer_handler(), a periodic timer increments the tick and the display is flushed through esp_lcd_panel_draw_bitmap().
+Additionally it measures the time LVGL needs to render and flush each frame*/
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include "esp_lvgl_port.h"
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_ops.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "sim.h"
+
+typedef struct
+{
+    lv_disp_drv_t disp_drv;
+    lv_disp_draw_buf_t draw_buf;
+    esp_lcd_panel_io_handle_t io_handle;
+    esp_lcd_panel_handle_t panel_handle;
+} display_ctx_t;
+
+static const char TAG[] = "LVGL";
+
+static pthread_mutex_t lvgl_mutex;
+static TaskHandle_t lvgl_task_handle;
+static pthread_t tick_thread;
+static volatile bool running = false;
+static volatile bool ticking = false;
+static int task_max_sleep_ms;
+static int timer_period_ms;
+static sim_render_stats_t render_stats; // Written in the LVGL task, under the lock
+static uint64_t render_start_us;
+
+static void lvgl_port_task(void* arg)
+{
+    (void)arg;
+    uint32_t task_delay_ms = task_max_sleep_ms;
+
+    ESP_LOGI(TAG, "Starting LVGL task");
+    running = true;
+    while (running)
+    {
+        if (lvgl_port_lock(0))
+        {
+            task_delay_ms = lv_timer_handler();
+            lvgl_port_unlock();
+        }
+
+        if (task_delay_ms > (uint32_t)task_max_sleep_ms || task_delay_ms == 1)
+        {
+            task_delay_ms = task_max_sleep_ms;
+        }
+        else if (task_delay_ms < 1)
+        {
+            task_delay_ms = 1;
+        }
+        vTaskDelay(pdMS_TO_TICKS(task_delay_ms));
+    }
+
+    vTaskDelete(NULL);
+}
+
+static void* tick_thread_entry(void* arg)
+{
+    /*esp_timer calls lv_tick_inc() periodically. Sleep to absolute times so the tick doesn't drift*/
+    (void)arg;
+    struct timespec next;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    while (1)
+    {
+        next.tv_nsec += timer_period_ms * 1000000L;
+        while (next.tv_nsec >= 1000000000L)
+        {
+            next.tv_nsec -= 1000000000L;
+            next.tv_sec++;
+        }
+
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL) == EINTR)
+        {
+        }
+
+        if (ticking)
+        {
+            lv_tick_inc(timer_period_ms);
+        }
+    }
+
+    return NULL;
+}
+
+static bool flush_io_ready_callback(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t* edata, void* user_ctx)
+{
+    (void)panel_io;
+    (void)edata;
+
+    lv_disp_flush_ready((lv_disp_drv_t*)user_ctx);
+    return false;
+}
+
+static void flush_callback(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_map)
+{
+    display_ctx_t* ctx = drv->user_data;
+    esp_lcd_panel_draw_bitmap(ctx->panel_handle, area->x1, area->y1, area->x2 + 1, area->y2 + 1, color_map);
+}
+
+static void render_start_callback(lv_disp_drv_t* drv)
+{
+    (void)drv;
+    render_start_us = sim_time_us();
+}
+
+static void monitor_callback(lv_disp_drv_t* drv, uint32_t time, uint32_t px)
+{
+    /*The time LVGL passes is in ticks of timer_period_ms, too coarse on a host, so measure it here*/
+    (void)drv;
+    (void)time;
+
+    uint32_t time_us = (uint32_t)(sim_time_us() - render_start_us);
+    render_stats.frame_cnt++;
+    render_stats.frame_time_sum_us += time_us;
+    render_stats.px_cnt += px;
+    if (time_us > render_stats.frame_time_max_us)
+    {
+        render_stats.frame_time_max_us = time_us;
+    }
+}
+
+void sim_lvgl_port_get_stats(sim_render_stats_t* stats, bool restart_max)
+{
+    lvgl_port_lock(0);
+    *stats = render_stats;
+    if (restart_max)
+    {
+        render_stats.frame_time_max_us = 0;
+    }
+    lvgl_port_unlock();
+}
+
+esp_err_t lvgl_port_init(const lvgl_port_cfg_t* cfg)
+{
+    if (cfg == NULL || cfg->timer_period_ms <= 0)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    lv_init();
+
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&lvgl_mutex, &attr);
+    pthread_mutexattr_destroy(&attr);
+
+    timer_period_ms = cfg->timer_period_ms;
+    task_max_sleep_ms = cfg->task_max_sleep_ms > 0 ? cfg->task_max_sleep_ms : 500;
+
+    ticking = true;
+    if (pthread_create(&tick_thread, NULL, tick_thread_entry, NULL) != 0)
+    {
+        return ESP_FAIL;
+    }
+    pthread_detach(tick_thread);
+
+    if (xTaskCreate(lvgl_port_task, "LVGL task", cfg->task_stack, NULL, cfg->task_priority, &lvgl_task_handle) != pdPASS)
+    {
+        ESP_LOGE(TAG, "Create LVGL task fail!");
+        return ESP_FAIL;
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t lvgl_port_deinit(void)
+{
+    running = false;
+    ticking = false;
+    return ESP_OK;
+}
+
+bool lvgl_port_lock(uint32_t timeout_ms)
+{
+    if (timeout_ms == 0)
+    {
+        return pthread_mutex_lock(&lvgl_mutex) == 0;
+    }
+
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += timeout_ms / 1000;
+    deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_nsec -= 1000000000L;
+        deadline.tv_sec++;
+    }
+
+    return pthread_mutex_timedlock(&lvgl_mutex, &deadline) == 0;
+}
+
+void lvgl_port_unlock(void)
+{
+    pthread_mutex_unlock(&lvgl_mutex);
+}
+
+lv_disp_t* lvgl_port_add_disp(const lvgl_port_display_cfg_t* disp_cfg)
+{
+    if (disp_cfg == NULL || disp_cfg->io_handle == NULL || disp_cfg->panel_handle == NULL || disp_cfg->buffer_size == 0)
+    {
+        ESP_LOGE(TAG, "invalid argument");
+        return NULL;
+    }
+
+    if (disp_cfg->monochrome || disp_cfg->trans_size != 0)
+    {
+        ESP_LOGE(TAG, "Monochrome displays and transport buffers are not simulated");
+        return NULL;
+    }
+
+    display_ctx_t* ctx = calloc(1, sizeof(display_ctx_t));
+    lv_color_t* buf1 = malloc(disp_cfg->buffer_size * sizeof(lv_color_t));
+    lv_color_t* buf2 = disp_cfg->double_buffer ? malloc(disp_cfg->buffer_size * sizeof(lv_color_t)) : NULL;
+    if (ctx == NULL || buf1 == NULL || (disp_cfg->double_buffer && buf2 == NULL))
+    {
+        ESP_LOGE(TAG, "Not enough memory for LVGL buffer allocation!");
+        free(ctx);
+        free(buf1);
+        free(buf2);
+        return NULL;
+    }
+
+    ctx->io_handle = disp_cfg->io_handle;
+    ctx->panel_handle = disp_cfg->panel_handle;
+
+    /*The panel IO tells when the transfer is done, like with DMA on the target*/
+    const esp_lcd_panel_io_callbacks_t cbs =
+    {
+        .on_color_trans_done = flush_io_ready_callback,
+    };
+    esp_lcd_panel_io_register_event_callbacks(ctx->io_handle, &cbs, &ctx->disp_drv);
+
+    /*The component doesn't lock here, but the LVGL task already runs, so be safe*/
+    lvgl_port_lock(0);
+
+    lv_disp_draw_buf_init(&ctx->draw_buf, buf1, buf2, disp_cfg->buffer_size);
+    lv_disp_drv_init(&ctx->disp_drv);
+    ctx->disp_drv.hor_res = disp_cfg->hres;
+    ctx->disp_drv.ver_res = disp_cfg->vres;
+    ctx->disp_drv.flush_cb = flush_callback;
+    ctx->disp_drv.render_start_cb = render_start_callback;
+    ctx->disp_drv.monitor_cb = monitor_callback;
+    ctx->disp_drv.draw_buf = &ctx->draw_buf;
+    ctx->disp_drv.user_data = ctx;
+    ctx->disp_drv.sw_rotate = disp_cfg->flags.sw_rotate;
+    ctx->disp_drv.full_refresh = disp_cfg->flags.full_refresh;
+    ctx->disp_drv.direct_mode = disp_cfg->flags.direct_mode;
+
+    lv_disp_t* disp = lv_disp_drv_register(&ctx->disp_drv);
+
+    lvgl_port_unlock();
+
+    /*Apply the rotation from the configuration*/
+    esp_lcd_panel_swap_xy(ctx->panel_handle, disp_cfg->rotation.swap_xy);
+    esp_lcd_panel_mirror(ctx->panel_handle, disp_cfg->rotation.mirror_x, disp_cfg->rotation.mirror_y);
+
+    return disp;
+}
+
+esp_err_t lvgl_port_remove_disp(lv_disp_t* disp)
+{
+    display_ctx_t* ctx = disp->driver->user_data;
+
+    lvgl_port_lock(0);
+    lv_disp_remove(disp);
+    lvgl_port_unlock();
+
+    free(ctx->draw_buf.buf1);
+    free(ctx->draw_buf.buf2);
+    free(ctx);
+    return ESP_OK;
+}
+
+void lvgl_port_flush_ready(lv_disp_t* disp)
+{
+    lv_disp_flush_ready(disp->driver);
+}
+
+esp_err_t lvgl_port_stop(void)
+{
+    lv_timer_enable(false);
+    ticking = false;
+    return ESP_OK;
+}
+
+esp_err_t lvgl_port_resume(void)
+{
+    lv_timer_enable(true);
+    ticking = true;
+    return ESP_OK;
+}
+
+esp_err_t lvgl_port_task_wake(lvgl_port_event_type_t event, void* param)
+{
+    (void)event;
+    (void)param;
+
+    xTaskNotifyGive(lvgl_task_handle);
+    return ESP_OK;
+}
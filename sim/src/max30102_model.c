@@ -0,0 +1,323 @@
+/*MAX30102 pulse oximeter model.
+A thread fills the FIFO with a synthetic PPG signal at the configured sample rate and drives the (active low) INT pin.
+The register map, the FIFO pointers and the interrupt flags follow the datasheet*/
+#include <pthread.h>
+#include <string.h>
+#include <math.h>
+
+#include "sim.h"
+
+#define MAX30102_ADDRESS    0x57
+
+#define REG_INTR_STATUS_1   0x00
+#define REG_INTR_STATUS_2   0x01
+#define REG_INTR_ENABLE_1   0x02
+#define REG_INTR_ENABLE_2   0x03
+#define REG_FIFO_WR_PTR     0x04
+#define REG_OVF_COUNTER     0x05
+#define REG_FIFO_RD_PTR     0x06
+#define REG_FIFO_DATA       0x07
+#define REG_FIFO_CONFIG     0x08
+#define REG_MODE_CONFIG     0x09
+#define REG_SPO2_CONFIG     0x0A
+#define REG_SLOT_1_2        0x11
+#define REG_SLOT_3_4        0x12
+#define REG_REV_ID          0xFE
+#define REG_PART_ID         0xFF
+
+#define INTR_A_FULL         (1 << 7)
+#define INTR_PPG_RDY        (1 << 6)
+
+#define MODE_SHDN           (1 << 7)
+#define MODE_RESET          (1 << 6)
+#define MODE_HR             0x2
+#define MODE_SPO2           0x3
+#define MODE_MULTI_LED      0x7
+
+#define FIFO_DEPTH          32
+#define BYTES_PER_LED       3
+#define LEDS_MAX            2
+#define FIFO_ROLLOVER_EN    (1 << 4)
+
+#define PULSE_RATE_HZ       1.2 // 72 bpm
+
+typedef struct
+{
+    pthread_mutex_t lock;
+    uint8_t registers[256];
+    uint8_t pointer;
+
+    uint8_t fifo[FIFO_DEPTH][LEDS_MAX * BYTES_PER_LED];
+    uint8_t unread_cnt;
+    uint8_t data_byte_index;    // Next byte of the sample at the read pointer
+
+    int int_gpio_num;
+    uint64_t sample_cnt;
+    uint64_t read_cnt;
+    uint64_t lost_cnt;
+} max30102_model_t;
+
+static max30102_model_t max30102;
+
+static void reset_registers(max30102_model_t* model)
+{
+    memset(model->registers, 0, sizeof(model->registers));
+    model->registers[REG_REV_ID] = 0x00;
+    model->registers[REG_PART_ID] = 0x15;
+    model->unread_cnt = 0;
+    model->data_byte_index = 0;
+}
+
+static int get_led_count(const max30102_model_t* model)
+{
+    switch (model->registers[REG_MODE_CONFIG] & 0x7)
+    {
+    case MODE_HR: return 1;
+    case MODE_SPO2: return 2;
+    case MODE_MULTI_LED:
+    {
+        /*Only the slots up to the first disabled one are sampled*/
+        int count = 0;
+        uint8_t slots[4] =
+        {
+            model->registers[REG_SLOT_1_2] & 0x7, (model->registers[REG_SLOT_1_2] >> 4) & 0x7,
+            model->registers[REG_SLOT_3_4] & 0x7, (model->registers[REG_SLOT_3_4] >> 4) & 0x7,
+        };
+        while (count < 4 && slots[count] != 0)
+        {
+            count++;
+        }
+        return count < LEDS_MAX ? count : LEDS_MAX;
+    }
+    default: return 0;
+    }
+}
+
+static uint32_t get_sample_period_us(const max30102_model_t* model)
+{
+    static const uint32_t sample_rates[] = {50, 100, 200, 400, 800, 1000, 1600, 3200};
+    static const uint32_t averages[] = {1, 2, 4, 8, 16, 32, 32, 32};
+
+    uint32_t rate = sample_rates[(model->registers[REG_SPO2_CONFIG] >> 2) & 0x7];
+    uint32_t average = averages[model->registers[REG_FIFO_CONFIG] >> 5];
+    return 1000000 * average / rate;
+}
+
+static bool is_int_asserted(const max30102_model_t* model)
+{
+    return (model->registers[REG_INTR_STATUS_1] & model->registers[REG_INTR_ENABLE_1]) ||
+           (model->registers[REG_INTR_STATUS_2] & model->registers[REG_INTR_ENABLE_2]);
+}
+
+static void update_int_pin(const max30102_model_t* model)
+{
+    /*Called with the lock held, so the pin can't get out of sync with the flags. The ISR doesn't use the model*/
+    sim_gpio_set_input_level(model->int_gpio_num, is_int_asserted(model) ? 0 : 1);
+}
+
+static void write_led_value(uint8_t* dst, uint32_t value)
+{
+    /*18 bit value, MSB first*/
+    dst[0] = (value >> 16) & 0x03;
+    dst[1] = (value >> 8) & 0xff;
+    dst[2] = value & 0xff;
+}
+
+static void push_sample(max30102_model_t* model)
+{
+    /*Synthetic PPG: a DC level and a pulse which is stronger on the IR LED*/
+    double t = (double)model->sample_cnt * get_sample_period_us(model) / 1000000.0;
+    double pulse = sin(2 * M_PI * PULSE_RATE_HZ * t);
+    uint32_t values[LEDS_MAX] = {(uint32_t)(90000 + 1500 * pulse), (uint32_t)(110000 + 2500 * pulse)};
+    model->sample_cnt++;
+
+    uint8_t* wr_ptr = &model->registers[REG_FIFO_WR_PTR];
+    uint8_t* rd_ptr = &model->registers[REG_FIFO_RD_PTR];
+
+    if (model->unread_cnt == FIFO_DEPTH)
+    {
+        if (!(model->registers[REG_FIFO_CONFIG] & FIFO_ROLLOVER_EN))
+        {
+            if (model->registers[REG_OVF_COUNTER] < 0x1f)
+            {
+                model->registers[REG_OVF_COUNTER]++;
+            }
+            model->lost_cnt++;
+            return; // The sample is lost
+        }
+
+        *rd_ptr = (*rd_ptr + 1) % FIFO_DEPTH; // The oldest sample is overwritten
+        model->unread_cnt--;
+        model->lost_cnt++;
+        model->data_byte_index = 0;
+    }
+
+    for (int i = 0; i < LEDS_MAX; i++)
+    {
+        write_led_value(&model->fifo[*wr_ptr][i * BYTES_PER_LED], values[i]);
+    }
+    *wr_ptr = (*wr_ptr + 1) % FIFO_DEPTH;
+    model->unread_cnt++;
+
+    model->registers[REG_INTR_STATUS_1] |= INTR_PPG_RDY;
+    if (model->unread_cnt == FIFO_DEPTH - (model->registers[REG_FIFO_CONFIG] & 0x0f))
+    {
+        model->registers[REG_INTR_STATUS_1] |= INTR_A_FULL;
+    }
+}
+
+static void* sample_thread(void* arg)
+{
+    max30102_model_t* model = arg;
+
+    while (1)
+    {
+        pthread_mutex_lock(&model->lock);
+        uint32_t period_us = get_sample_period_us(model);
+        if (get_led_count(model) > 0 && !(model->registers[REG_MODE_CONFIG] & MODE_SHDN))
+        {
+            push_sample(model);
+            update_int_pin(model);
+        }
+        pthread_mutex_unlock(&model->lock);
+
+        sim_sleep_us(period_us);
+    }
+
+    return NULL;
+}
+
+static uint8_t read_fifo_byte(max30102_model_t* model)
+{
+    int sample_size = get_led_count(model) * BYTES_PER_LED;
+    uint8_t* rd_ptr = &model->registers[REG_FIFO_RD_PTR];
+
+    if (sample_size == 0 || model->unread_cnt == 0)
+    {
+        return 0;
+    }
+
+    uint8_t value = model->fifo[*rd_ptr][model->data_byte_index++];
+    if (model->data_byte_index == sample_size)
+    {
+        model->data_byte_index = 0;
+        *rd_ptr = (*rd_ptr + 1) % FIFO_DEPTH;
+        model->unread_cnt--;
+        model->read_cnt++;
+    }
+
+    return value;
+}
+
+static void update_unread_cnt(max30102_model_t* model)
+{
+    /*After writing a FIFO pointer. Equal pointers mean an empty FIFO*/
+    model->unread_cnt = (model->registers[REG_FIFO_WR_PTR] - model->registers[REG_FIFO_RD_PTR] + FIFO_DEPTH) % FIFO_DEPTH;
+    model->data_byte_index = 0;
+}
+
+static void max30102_write(void* ctx, const uint8_t* data, size_t size)
+{
+    max30102_model_t* model = ctx;
+
+    pthread_mutex_lock(&model->lock);
+    model->pointer = data[0];
+    for (size_t i = 1; i < size; i++)
+    {
+        uint8_t reg = model->pointer;
+        switch (reg)
+        {
+        case REG_INTR_STATUS_1:
+        case REG_INTR_STATUS_2:
+        case REG_FIFO_DATA:
+        case REG_REV_ID:
+        case REG_PART_ID:
+            break; // Read only
+
+        case REG_MODE_CONFIG:
+            if (data[i] & MODE_RESET)
+            {
+                reset_registers(model); // The reset bit clears itself
+            }
+            else
+            {
+                model->registers[reg] = data[i];
+            }
+            break;
+
+        case REG_FIFO_WR_PTR:
+        case REG_FIFO_RD_PTR:
+            model->registers[reg] = data[i] % FIFO_DEPTH;
+            update_unread_cnt(model);
+            break;
+
+        default:
+            model->registers[reg] = data[i];
+            break;
+        }
+
+        if (reg != REG_FIFO_DATA)
+        {
+            model->pointer++;
+        }
+    }
+    update_int_pin(model); // The interrupt enables may have changed
+    pthread_mutex_unlock(&model->lock);
+}
+
+static void max30102_read(void* ctx, uint8_t* data, size_t size)
+{
+    max30102_model_t* model = ctx;
+
+    pthread_mutex_lock(&model->lock);
+    for (size_t i = 0; i < size; i++)
+    {
+        uint8_t reg = model->pointer;
+        if (reg == REG_FIFO_DATA)
+        {
+            data[i] = read_fifo_byte(model); // The pointer stays on the FIFO data register
+            continue;
+        }
+
+        data[i] = model->registers[reg];
+        if (reg == REG_INTR_STATUS_1 || reg == REG_INTR_STATUS_2)
+        {
+            model->registers[reg] = 0; // Reading the status clears it
+        }
+        model->pointer++;
+    }
+    update_int_pin(model);
+    pthread_mutex_unlock(&model->lock);
+}
+
+void sim_max30102_get_stats(sim_ppg_stats_t* stats)
+{
+    pthread_mutex_lock(&max30102.lock);
+    stats->produced_cnt = max30102.sample_cnt;
+    stats->read_cnt = max30102.read_cnt;
+    stats->lost_cnt = max30102.lost_cnt;
+    pthread_mutex_unlock(&max30102.lock);
+}
+
+void sim_max30102_init(int int_gpio_num)
+{
+    memset(&max30102, 0, sizeof(max30102));
+    pthread_mutex_init(&max30102.lock, NULL);
+    reset_registers(&max30102);
+    max30102.int_gpio_num = int_gpio_num;
+
+    sim_i2c_model_t model =
+    {
+        .name = "max30102",
+        .address = MAX30102_ADDRESS,
+        .write = max30102_write,
+        .read = max30102_read,
+        .ctx = &max30102,
+    };
+    sim_i2c_add_model(&model);
+
+    /*The sensor is modeled as already powered, so the power ready flag isn't set*/
+    pthread_t thread;
+    pthread_create(&thread, NULL, sample_thread, &max30102);
+    pthread_detach(thread);
+}
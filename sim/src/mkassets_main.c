@@ -0,0 +1,17 @@
+/*Builds the pack of the asset partition (main/core/include/assets.h) from a manifest:
+    mkassets assets/assets.txt assets.bin
+The build runs it for the simulator, and for the firmware which flashes the pack into the "assets" partition*/
+#include <stdio.h>
+
+#include "sim.h"
+
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        fprintf(stderr, "Usage: %s <manifest> <output>\n", argv[0]);
+        return 1;
+    }
+
+    return sim_assets_build(argv[1], argv[2]) ? 0 : 1;
+}
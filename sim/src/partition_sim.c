@@ -0,0 +1,168 @@
+/*Data partitions backed by files. The "assets" partition is the pack the build made from assets/assets.txt*/
+#include <fcntl.h>
+#include <pthread.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "esp_partition.h"
+#include "esp_log.h"
+
+#include "sim.h"
+
+#define PARTITION_CNT   1
+#define MAPPINGS_MAX    8
+
+typedef struct
+{
+    esp_partition_t partition;
+    char path[256];
+} partition_file_t;
+
+typedef struct
+{
+    void* addr;
+    size_t size;
+} mapping_t;
+
+static const char TAG[] = "partition_sim";
+
+static partition_file_t partitions[PARTITION_CNT] =
+{
+    {
+        .partition = {.type = ESP_PARTITION_TYPE_DATA, .subtype = ESP_PARTITION_SUBTYPE_DATA_UNDEFINED, .label = "assets"},
+#ifdef SIM_ASSETS_FILE
+        .path = SIM_ASSETS_FILE,
+#endif
+    },
+};
+
+static mapping_t mappings[MAPPINGS_MAX]; // The handle is the index + 1
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+void sim_partition_set_file(const char* label, const char* path)
+{
+    for (int i = 0; i < PARTITION_CNT; i++)
+    {
+        if (strcmp(partitions[i].partition.label, label) == 0)
+        {
+            snprintf(partitions[i].path, sizeof(partitions[i].path), "%s", path);
+        }
+    }
+}
+
+static const partition_file_t* get_file(const esp_partition_t* partition)
+{
+    return (const partition_file_t*)((const char*)partition - offsetof(partition_file_t, partition));
+}
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char* label)
+{
+    for (int i = 0; i < PARTITION_CNT; i++)
+    {
+        esp_partition_t* partition = &partitions[i].partition;
+        if ((type != ESP_PARTITION_TYPE_ANY && type != partition->type) ||
+            (subtype != ESP_PARTITION_SUBTYPE_ANY && subtype != partition->subtype) ||
+            (label != NULL && strcmp(label, partition->label) != 0))
+        {
+            continue;
+        }
+
+        /*Like a partition which isn't in the table if there is no file*/
+        struct stat st;
+        if (partitions[i].path[0] == '\0' || stat(partitions[i].path, &st) != 0)
+        {
+            return NULL;
+        }
+        partition->size = (uint32_t)st.st_size;
+        return partition;
+    }
+
+    return NULL;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t* partition, size_t src_offset, void* dst, size_t size)
+{
+    if (src_offset > partition->size || size > partition->size - src_offset)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    int fd = open(get_file(partition)->path, O_RDONLY);
+    if (fd < 0)
+    {
+        return ESP_FAIL;
+    }
+    ssize_t read_size = pread(fd, dst, size, (off_t)src_offset);
+    close(fd);
+
+    return read_size == (ssize_t)size ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t* partition, size_t offset, size_t size,
+                             esp_partition_mmap_memory_t memory, const void** out_ptr,
+                             esp_partition_mmap_handle_t* out_handle)
+{
+    if (offset > partition->size || size > partition->size - offset)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    /*Like the MMU on the target, map whole pages*/
+    size_t page_offset = offset % (size_t)sysconf(_SC_PAGESIZE);
+
+    pthread_mutex_lock(&lock);
+
+    int index = 0;
+    while (index < MAPPINGS_MAX && mappings[index].addr != NULL)
+    {
+        index++;
+    }
+    if (index == MAPPINGS_MAX)
+    {
+        pthread_mutex_unlock(&lock);
+        return ESP_ERR_NO_MEM;
+    }
+
+    int fd = open(get_file(partition)->path, O_RDONLY);
+    if (fd < 0)
+    {
+        pthread_mutex_unlock(&lock);
+        return ESP_FAIL;
+    }
+    void* addr = mmap(NULL, size + page_offset, PROT_READ, MAP_PRIVATE, fd, (off_t)(offset - page_offset));
+    close(fd);
+    if (addr == MAP_FAILED)
+    {
+        pthread_mutex_unlock(&lock);
+        ESP_LOGE(TAG, "Failed to map %s", get_file(partition)->path);
+        return ESP_FAIL;
+    }
+
+    mappings[index].addr = addr;
+    mappings[index].size = size + page_offset;
+    pthread_mutex_unlock(&lock);
+
+    *out_ptr = (const uint8_t*)addr + page_offset;
+    *out_handle = (esp_partition_mmap_handle_t)(index + 1);
+    return ESP_OK;
+}
+
+void esp_partition_munmap(esp_partition_mmap_handle_t handle)
+{
+    if (handle == 0 || handle > MAPPINGS_MAX)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&lock);
+    mapping_t* mapping = &mappings[handle - 1];
+    if (mapping->addr != NULL)
+    {
+        munmap(mapping->addr, mapping->size);
+        mapping->addr = NULL;
+    }
+    pthread_mutex_unlock(&lock);
+}
@@ -0,0 +1,203 @@
+/*SPI bus and LEDC (backlight PWM). The SPI traffic itself is modeled by the LCD panel IO*/
+#include <pthread.h>
+#include <stdbool.h>
+
+#include "driver/spi_master.h"
+#include "driver/ledc.h"
+#include "esp_log.h"
+
+#include "sim.h"
+
+typedef struct
+{
+    bool configured;
+    uint32_t duty;
+    uint32_t fade_start_duty;   // A fade moves the duty linearly from the start to the target
+    uint32_t fade_target_duty;
+    uint64_t fade_start_us;
+    uint32_t fade_time_ms;
+} ledc_channel_state_t;
+
+static const char TAG[] = "peripherals_sim";
+
+static bool spi_bus_initialized[SPI_HOST_MAX];
+static ledc_channel_state_t ledc_channels[LEDC_CHANNEL_MAX];
+static bool ledc_fade_installed = false;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+esp_err_t spi_bus_initialize(spi_host_device_t host_id, const spi_bus_config_t* bus_config, spi_dma_chan_t dma_chan)
+{
+    (void)dma_chan;
+
+    if (host_id <= SPI1_HOST || host_id >= SPI_HOST_MAX || bus_config == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&lock);
+    bool was_initialized = spi_bus_initialized[host_id];
+    spi_bus_initialized[host_id] = true;
+    pthread_mutex_unlock(&lock);
+
+    if (was_initialized)
+    {
+        ESP_LOGE(TAG, "SPI bus already initialized");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_free(spi_host_device_t host_id)
+{
+    if (host_id >= SPI_HOST_MAX)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&lock);
+    spi_bus_initialized[host_id] = false;
+    pthread_mutex_unlock(&lock);
+
+    return ESP_OK;
+}
+
+static uint32_t get_duty(const ledc_channel_state_t* channel)
+{
+    if (channel->fade_time_ms == 0)
+    {
+        return channel->duty;
+    }
+
+    uint64_t elapsed_ms = (sim_time_us() - channel->fade_start_us) / 1000;
+    if (elapsed_ms >= channel->fade_time_ms)
+    {
+        return channel->fade_target_duty;
+    }
+
+    int64_t delta = (int64_t)channel->fade_target_duty - channel->fade_start_duty;
+    return (uint32_t)(channel->fade_start_duty + delta * (int64_t)elapsed_ms / channel->fade_time_ms);
+}
+
+esp_err_t ledc_timer_config(const ledc_timer_config_t* timer_conf)
+{
+    if (timer_conf == NULL || timer_conf->timer_num >= LEDC_TIMER_MAX || timer_conf->freq_hz == 0)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t ledc_channel_config(const ledc_channel_config_t* ledc_conf)
+{
+    if (ledc_conf == NULL || ledc_conf->channel >= LEDC_CHANNEL_MAX)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&lock);
+    ledc_channel_state_t* channel = &ledc_channels[ledc_conf->channel];
+    channel->configured = true;
+    channel->duty = ledc_conf->duty;
+    channel->fade_time_ms = 0;
+    pthread_mutex_unlock(&lock);
+
+    return ESP_OK;
+}
+
+esp_err_t ledc_set_duty(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t duty)
+{
+    (void)speed_mode;
+
+    if (channel >= LEDC_CHANNEL_MAX)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&lock);
+    ledc_channels[channel].duty = duty;
+    ledc_channels[channel].fade_time_ms = 0;
+    pthread_mutex_unlock(&lock);
+
+    return ESP_OK;
+}
+
+esp_err_t ledc_update_duty(ledc_mode_t speed_mode, ledc_channel_t channel)
+{
+    (void)speed_mode;
+    return channel < LEDC_CHANNEL_MAX ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+uint32_t ledc_get_duty(ledc_mode_t speed_mode, ledc_channel_t channel)
+{
+    (void)speed_mode;
+    return sim_ledc_get_duty(channel);
+}
+
+uint32_t sim_ledc_get_duty(int channel)
+{
+    if (channel < 0 || channel >= LEDC_CHANNEL_MAX)
+    {
+        return 0;
+    }
+
+    pthread_mutex_lock(&lock);
+    uint32_t duty = get_duty(&ledc_channels[channel]);
+    pthread_mutex_unlock(&lock);
+
+    return duty;
+}
+
+esp_err_t ledc_fade_func_install(int intr_alloc_flags)
+{
+    (void)intr_alloc_flags;
+
+    pthread_mutex_lock(&lock);
+    bool was_installed = ledc_fade_installed;
+    ledc_fade_installed = true;
+    pthread_mutex_unlock(&lock);
+
+    return was_installed ? ESP_ERR_INVALID_STATE : ESP_OK;
+}
+
+void ledc_fade_func_uninstall(void)
+{
+    pthread_mutex_lock(&lock);
+    ledc_fade_installed = false;
+    pthread_mutex_unlock(&lock);
+}
+
+esp_err_t ledc_set_fade_time_and_start(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t target_duty,
+                                       uint32_t max_fade_time_ms, ledc_fade_mode_t fade_mode)
+{
+    (void)speed_mode;
+
+    if (channel >= LEDC_CHANNEL_MAX)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&lock);
+    if (!ledc_fade_installed)
+    {
+        pthread_mutex_unlock(&lock);
+        ESP_LOGE(TAG, "Fade service not installed");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    ledc_channel_state_t* state = &ledc_channels[channel];
+    state->fade_start_duty = get_duty(state);
+    state->duty = target_duty;
+    state->fade_target_duty = target_duty;
+    state->fade_start_us = sim_time_us();
+    state->fade_time_ms = max_fade_time_ms;
+    pthread_mutex_unlock(&lock);
+
+    if (fade_mode == LEDC_FADE_WAIT_DONE)
+    {
+        sim_sleep_us((uint64_t)max_fade_time_ms * 1000);
+    }
+
+    return ESP_OK;
+}
@@ -0,0 +1,221 @@
+/*Snapshots of the counters of the stand-ins and the reports computed from them*/
+#include <string.h>
+#include <inttypes.h>
+
+#include "esp_lvgl_port.h"
+
+#include "sim.h"
+
+#define BACKLIGHT_LEDC_CHANNEL  0
+
+void sim_snapshot_take(sim_snapshot_t* snapshot)
+{
+    memset(snapshot, 0, sizeof(sim_snapshot_t));
+    snapshot->time_us = sim_time_us();
+
+    sim_lvgl_port_get_stats(&snapshot->render, true);
+    sim_lcd_get_stats(&snapshot->spi);
+    sim_max30102_get_stats(&snapshot->ppg);
+    snapshot->console_byte_cnt = sim_log_get_byte_cnt();
+#if METRICS_ENABLED
+    metrics_read(&snapshot->metrics);
+#endif
+    snapshot->i2c_cnt = sim_i2c_get_stats(snapshot->i2c, SIM_I2C_DEVICES_MAX);
+    snapshot->task_cnt = sim_task_get_stats(snapshot->tasks, SIM_TASKS_MAX);
+    for (int i = 0; i < SIM_INPUT_KIND_CNT; i++)
+    {
+        sim_input_get_stats((sim_input_kind_t)i, &snapshot->input[i], true);
+    }
+    sim_heap_get_stats(&snapshot->heap);
+
+    lv_mem_monitor_t mem;
+    lvgl_port_lock(0);
+    lv_mem_monitor(&mem);
+    lvgl_port_unlock();
+    snapshot->lvgl_mem_peak = mem.max_used;
+}
+
+static uint32_t get_start_wake_cnt(const sim_snapshot_t* start, const char* name)
+{
+    /*Tasks created after the start snapshot start from 0*/
+    for (int i = 0; i < start->task_cnt; i++)
+    {
+        if (strcmp(start->tasks[i].name, name) == 0)
+        {
+            return start->tasks[i].wake_cnt;
+        }
+    }
+
+    return 0;
+}
+
+static uint32_t get_start_transaction_cnt(const sim_snapshot_t* start, uint16_t address, uint64_t* byte_cnt,
+                                          uint64_t* busy_us)
+{
+    for (int i = 0; i < start->i2c_cnt; i++)
+    {
+        if (start->i2c[i].address == address)
+        {
+            *byte_cnt = start->i2c[i].byte_cnt;
+            *busy_us = start->i2c[i].busy_us;
+            return start->i2c[i].transaction_cnt;
+        }
+    }
+
+    *byte_cnt = 0;
+    *busy_us = 0;
+    return 0;
+}
+
+static double get_histogram_avg(const sim_snapshot_t* start, const sim_snapshot_t* end, int id, uint32_t* count)
+{
+    /*Average of the values added between the snapshots, 0 without metrics*/
+#if METRICS_ENABLED
+    *count = end->metrics.histograms[id].count - start->metrics.histograms[id].count;
+    uint32_t sum = end->metrics.histograms[id].sum - start->metrics.histograms[id].sum;
+    return *count ? (double)sum / *count : 0;
+#else
+    *count = 0;
+    return 0;
+#endif
+}
+
+void sim_report_print(const char* name, const sim_snapshot_t* start, const sim_snapshot_t* end)
+{
+    double duration_s = (end->time_us - start->time_us) / 1e6;
+    uint32_t frame_cnt = end->render.frame_cnt - start->render.frame_cnt;
+    uint64_t render_us = end->render.frame_time_sum_us - start->render.frame_time_sum_us;
+    uint64_t spi_bytes = end->spi.byte_cnt - start->spi.byte_cnt;
+    uint64_t spi_busy_us = end->spi.busy_us - start->spi.busy_us;
+
+    printf("\n--- %s: %.1f s ---\n", name, duration_s);
+    printf("frames      %" PRIu32 " (%.1f/s), render+flush avg %.2f ms, max %.2f ms\n", frame_cnt, frame_cnt / duration_s,
+           frame_cnt ? render_us / 1000.0 / frame_cnt : 0, end->render.frame_time_max_us / 1000.0);
+    printf("per second  %.2f ms rendering, %.0f px, %.0f SPI bytes (%" PRIu32 " RAMWR), bus busy %.2f %% at %.0f MHz\n",
+           render_us / 1000.0 / duration_s, (end->render.px_cnt - start->render.px_cnt) / duration_s, spi_bytes / duration_s,
+           end->spi.ramwr_cnt - start->spi.ramwr_cnt, spi_busy_us / (duration_s * 1e4), end->spi.pclk_hz / 1e6);
+
+    for (int i = 0; i < end->i2c_cnt; i++)
+    {
+        uint64_t start_bytes;
+        uint64_t start_busy_us;
+        uint32_t transaction_cnt = end->i2c[i].transaction_cnt -
+                                   get_start_transaction_cnt(start, end->i2c[i].address, &start_bytes, &start_busy_us);
+        printf("i2c 0x%02x    %-9s %.0f transactions/min, %.0f B/min, bus busy %.2f %%\n", end->i2c[i].address,
+               end->i2c[i].name, transaction_cnt * 60 / duration_s, (end->i2c[i].byte_cnt - start_bytes) * 60 / duration_s,
+               (end->i2c[i].busy_us - start_busy_us) / (duration_s * 1e4));
+    }
+
+    printf("ppg         %.1f samples/s taken, %.1f read, %.1f lost\n",
+           (end->ppg.produced_cnt - start->ppg.produced_cnt) / duration_s, (end->ppg.read_cnt - start->ppg.read_cnt) / duration_s,
+           (end->ppg.lost_cnt - start->ppg.lost_cnt) / duration_s);
+
+    uint32_t service_cnt;
+    double service_avg_us = get_histogram_avg(start, end, METRIC_PPG_SERVICE_TIME_US, &service_cnt);
+    if (service_cnt > 0)
+    {
+        printf("ppg service %.1f interrupts/s, avg %.0f us, %.1f %% of the time\n", service_cnt / duration_s, service_avg_us,
+               service_cnt * service_avg_us / (duration_s * 1e4));
+    }
+
+    double console_bytes = (end->console_byte_cnt - start->console_byte_cnt) / duration_s;
+    uint32_t baud_rate = sim_log_get_baud_rate();
+    printf("console     %.0f B/s", console_bytes);
+    if (baud_rate > 0)
+    {
+        printf(", UART busy %.1f %% at %" PRIu32 " baud", console_bytes * 10 * 100 / baud_rate, baud_rate);
+    }
+    printf("\n");
+
+    uint32_t total_wake_cnt = 0;
+    for (int i = 0; i < end->task_cnt; i++)
+    {
+        total_wake_cnt += end->tasks[i].wake_cnt - get_start_wake_cnt(start, end->tasks[i].name);
+    }
+    printf("wakeups     %.1f/s:", total_wake_cnt / duration_s);
+    for (int i = 0; i < end->task_cnt; i++)
+    {
+        printf("%s %s %.1f", i ? "," : "", end->tasks[i].name,
+               (end->tasks[i].wake_cnt - get_start_wake_cnt(start, end->tasks[i].name)) / duration_s);
+    }
+    printf("\n");
+
+    for (int i = 0; i < SIM_INPUT_KIND_CNT; i++)
+    {
+        uint32_t event_cnt = end->input[i].event_cnt - start->input[i].event_cnt;
+        uint32_t missed_cnt = end->input[i].missed_cnt - start->input[i].missed_cnt;
+        if (event_cnt + missed_cnt == 0)
+        {
+            continue;
+        }
+
+        uint64_t latency_us = end->input[i].latency_sum_us - start->input[i].latency_sum_us;
+        printf("input       %-12s %" PRIu32 " (%" PRIu32 " missed), latency avg %.2f ms, max %.2f ms\n",
+               sim_input_get_kind_name((sim_input_kind_t)i), event_cnt, missed_cnt,
+               event_cnt ? latency_us / 1000.0 / event_cnt : 0, end->input[i].latency_max_us / 1000.0);
+    }
+
+    printf("heap        peak %" PRIu64 " B, now %" PRIu64 " B, LVGL pool peak %" PRIu32 " B\n", end->heap.peak,
+           end->heap.used, end->lvgl_mem_peak);
+    printf("backlight   duty %" PRIu32 "\n", sim_ledc_get_duty(BACKLIGHT_LEDC_CHANNEL));
+}
+
+void sim_report_write_json(FILE* file, const char* name, const sim_snapshot_t* start, const sim_snapshot_t* end)
+{
+    double duration_s = (end->time_us - start->time_us) / 1e6;
+    uint32_t frame_cnt = end->render.frame_cnt - start->render.frame_cnt;
+    uint64_t render_us = end->render.frame_time_sum_us - start->render.frame_time_sum_us;
+
+    fprintf(file, "{\"name\": \"%s\", \"duration_s\": %.3f,\n", name, duration_s);
+    fprintf(file, "  \"frames\": %" PRIu32 ", \"render_us_per_s\": %.1f, \"render_us_avg\": %.1f, \"render_us_max\": %" PRIu32
+            ", \"px_per_s\": %.1f,\n", frame_cnt, render_us / duration_s, frame_cnt ? (double)render_us / frame_cnt : 0,
+            end->render.frame_time_max_us, (end->render.px_cnt - start->render.px_cnt) / duration_s);
+    fprintf(file, "  \"spi_bytes_per_s\": %.1f, \"spi_busy_pct\": %.3f, \"ramwr\": %" PRIu32 ",\n",
+            (end->spi.byte_cnt - start->spi.byte_cnt) / duration_s, (end->spi.busy_us - start->spi.busy_us) / (duration_s * 1e4),
+            end->spi.ramwr_cnt - start->spi.ramwr_cnt);
+
+    fprintf(file, "  \"ppg_samples_per_s\": %.1f, \"ppg_read_per_s\": %.1f, \"ppg_lost_per_s\": %.1f,\n",
+            (end->ppg.produced_cnt - start->ppg.produced_cnt) / duration_s, (end->ppg.read_cnt - start->ppg.read_cnt) / duration_s,
+            (end->ppg.lost_cnt - start->ppg.lost_cnt) / duration_s);
+
+    uint32_t service_cnt;
+    double service_avg_us = get_histogram_avg(start, end, METRIC_PPG_SERVICE_TIME_US, &service_cnt);
+    fprintf(file, "  \"ppg_service_per_s\": %.1f, \"ppg_service_us_avg\": %.1f, \"console_bytes_per_s\": %.1f,\n",
+            service_cnt / duration_s, service_avg_us, (end->console_byte_cnt - start->console_byte_cnt) / duration_s);
+
+    fprintf(file, "  \"i2c\": {");
+    for (int i = 0; i < end->i2c_cnt; i++)
+    {
+        uint64_t start_bytes;
+        uint64_t start_busy_us;
+        uint32_t transaction_cnt = end->i2c[i].transaction_cnt -
+                                   get_start_transaction_cnt(start, end->i2c[i].address, &start_bytes, &start_busy_us);
+        fprintf(file, "%s\"%s\": {\"transactions_per_min\": %.1f, \"bytes_per_min\": %.1f, \"busy_pct\": %.3f}", i ? ", " : "",
+                end->i2c[i].name, transaction_cnt * 60 / duration_s, (end->i2c[i].byte_cnt - start_bytes) * 60 / duration_s,
+                (end->i2c[i].busy_us - start_busy_us) / (duration_s * 1e4));
+    }
+    fprintf(file, "},\n");
+
+    fprintf(file, "  \"wakeups_per_s\": {");
+    for (int i = 0; i < end->task_cnt; i++)
+    {
+        fprintf(file, "%s\"%s\": %.2f", i ? ", " : "", end->tasks[i].name,
+                (end->tasks[i].wake_cnt - get_start_wake_cnt(start, end->tasks[i].name)) / duration_s);
+    }
+    fprintf(file, "},\n");
+
+    fprintf(file, "  \"input_latency\": {");
+    for (int i = 0; i < SIM_INPUT_KIND_CNT; i++)
+    {
+        uint32_t event_cnt = end->input[i].event_cnt - start->input[i].event_cnt;
+        uint64_t latency_us = end->input[i].latency_sum_us - start->input[i].latency_sum_us;
+        fprintf(file, "%s\"%s\": {\"events\": %" PRIu32 ", \"missed\": %" PRIu32 ", \"avg_us\": %.1f, \"max_us\": %" PRIu32 "}",
+                i ? ", " : "", sim_input_get_kind_name((sim_input_kind_t)i), event_cnt,
+                end->input[i].missed_cnt - start->input[i].missed_cnt, event_cnt ? (double)latency_us / event_cnt : 0,
+                end->input[i].latency_max_us);
+    }
+    fprintf(file, "},\n");
+
+    fprintf(file, "  \"heap_peak_bytes\": %" PRIu64 ", \"heap_used_bytes\": %" PRIu64 ", \"lvgl_mem_peak_bytes\": %" PRIu32 "}",
+            end->heap.peak, end->heap.used, end->lvgl_mem_peak);
+}
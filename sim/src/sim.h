@@ -0,0 +1,193 @@
+/*Interface between the parts of the simulator. Nothing here is visible to the firmware*/
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "metrics.h"
+#include "assets.h"
+
+/*Clock*/
+uint64_t sim_time_us(void); // Monotonic time since the start of the simulator
+void sim_sleep_us(uint64_t us);
+
+/*Tasks. A wakeup is a task continuing after it was blocked in a queue, semaphore, notification or delay*/
+typedef struct
+{
+    char name[16];
+    uint32_t wake_cnt;
+} sim_task_stats_t;
+
+/*Return the number of tasks written to `stats`, in the order they were created*/
+int sim_task_get_stats(sim_task_stats_t* stats, int max_cnt);
+
+/*Measure the time from arming until the task returns from its next blocking call*/
+void sim_task_probe_arm(const char* name);
+bool sim_task_probe_read(const char* name, uint64_t* latency_us); // False if the task didn't return since arming
+
+/*Heap: what malloc() and friends hand out, plus the task stacks which come from the heap on the target*/
+typedef struct
+{
+    uint64_t used;
+    uint64_t peak;
+    uint64_t alloc_cnt;
+} sim_heap_stats_t;
+
+void sim_heap_get_stats(sim_heap_stats_t* stats);
+void sim_heap_account(size_t size, bool allocated); // For memory the host doesn't take from malloc()
+
+/*GPIO: drive an input pin like the outside world would. Runs the ISR of the pin on the calling thread*/
+void sim_gpio_init(void);
+void sim_gpio_set_input_level(int gpio_num, int level);
+
+/*Interrupt handlers (GPIO and timer alarms) run between these, so they never preempt each other*/
+void sim_isr_enter(void);
+void sim_isr_exit(void);
+
+/*I2C device models*/
+typedef struct
+{
+    const char* name;
+    uint16_t address;
+    void (*write)(void* ctx, const uint8_t* data, size_t size);  // Bytes after the address byte of a write
+    void (*read)(void* ctx, uint8_t* data, size_t size);         // Bytes of a read
+    void* ctx;
+} sim_i2c_model_t;
+
+void sim_i2c_add_model(const sim_i2c_model_t* model);
+
+/*Make every transaction hold the bus for this long per byte (address bytes included). 0, the default, makes them
+take no time*/
+void sim_i2c_set_byte_time_ns(uint32_t byte_time_ns);
+
+void sim_ds3231_init(void);
+void sim_max30102_init(int int_gpio_num);
+
+typedef struct
+{
+    uint64_t produced_cnt;      // Samples the sensor took
+    uint64_t read_cnt;          // Samples read out of the FIFO
+    uint64_t lost_cnt;          // Samples dropped because the FIFO was full
+} sim_ppg_stats_t;
+
+void sim_max30102_get_stats(sim_ppg_stats_t* stats);
+
+/*Console: printing blocks for the time the characters take on a UART with this baud rate like on the target.
+0, the default, makes printing take no time*/
+void sim_log_set_baud_rate(uint32_t baud_rate);
+uint32_t sim_log_get_baud_rate(void);
+uint64_t sim_log_get_byte_cnt(void); // Characters printed since the start
+
+/*Display: the ST7789 model and the LVGL port*/
+typedef struct
+{
+    uint32_t frame_cnt;         // Number of LVGL refreshes which drew something
+    uint64_t frame_time_sum_us; // From the start of rendering until the last area was flushed, host time
+    uint32_t frame_time_max_us;
+    uint64_t px_cnt;            // Number of rendered pixels
+} sim_render_stats_t;
+
+typedef struct
+{
+    uint64_t byte_cnt;          // Bytes sent on the SPI bus (commands, parameters and pixels)
+    uint64_t busy_us;           // Time the bus was busy at the configured pixel clock
+    uint32_t ramwr_cnt;         // Number of RAMWR commands (flushed areas)
+    uint32_t pclk_hz;
+} sim_spi_stats_t;
+
+void sim_lcd_get_stats(sim_spi_stats_t* stats);
+bool sim_lcd_write_ppm(const char* path, int hres, int vres); // Dump the RAM of the panel as seen on the screen
+void sim_lvgl_port_get_stats(sim_render_stats_t* stats, bool restart_max);
+
+typedef struct
+{
+    const char* name;
+    uint16_t address;
+    uint32_t transaction_cnt;
+    uint64_t byte_cnt;
+    uint64_t busy_us;           // At the SCL speed of the device
+} sim_i2c_dev_stats_t;
+
+/*Return the number of devices written to `stats`*/
+int sim_i2c_get_stats(sim_i2c_dev_stats_t* stats, int max_cnt);
+
+uint32_t sim_ledc_get_duty(int channel);
+
+/*Flash partitions. A data partition is a file which esp_partition_mmap() maps with mmap(). The "assets" partition is
+the pack the build made from assets/assets.txt*/
+void sim_partition_set_file(const char* label, const char* path);
+
+/*Asset packs (main/core/include/assets.h), written by mkassets and the tests*/
+typedef struct
+{
+    const char* name;
+    asset_type_t type;
+    const void* data;
+    size_t size;
+} sim_asset_t;
+
+bool sim_assets_write(const char* path, const sim_asset_t* assets, int cnt);
+
+/*Pack the files listed in a manifest. One asset per line: `<type> <name> <file>` where the type is raw, ttf or image
+and the file is relative to the manifest. Empty lines and lines starting with # are ignored*/
+bool sim_assets_build(const char* manifest_path, const char* path);
+
+/*Input. Drives the pins of the encoder and the button and measures the time from the edge which should produce
+an input event until the input task of the firmware picks it up*/
+typedef enum
+{
+    SIM_INPUT_ENCODER_STEP,
+    SIM_INPUT_PRESS,
+    SIM_INPUT_LONG_PRESS,
+    SIM_INPUT_KIND_CNT,
+} sim_input_kind_t;
+
+typedef struct
+{
+    uint32_t event_cnt;
+    uint32_t missed_cnt;        // Inputs after which the input task didn't wake up
+    uint64_t latency_sum_us;
+    uint32_t latency_max_us;
+} sim_input_stats_t;
+
+void sim_input_turn_encoder(bool clockwise);
+void sim_input_press(bool long_press);
+void sim_input_get_stats(sim_input_kind_t kind, sim_input_stats_t* stats, bool restart_max);
+const char* sim_input_get_kind_name(sim_input_kind_t kind);
+
+/*Scripted input*/
+bool sim_input_load_script(const char* path);
+void sim_input_start(void);
+
+/*Reports. A snapshot holds all the counters, a report covers the time between two snapshots*/
+#define SIM_TASKS_MAX           16
+#define SIM_I2C_DEVICES_MAX     8
+
+typedef struct
+{
+    uint64_t time_us;
+    sim_render_stats_t render;
+    sim_spi_stats_t spi;
+    sim_ppg_stats_t ppg;
+    uint64_t console_byte_cnt;
+    sim_i2c_dev_stats_t i2c[SIM_I2C_DEVICES_MAX];
+    int i2c_cnt;
+    sim_task_stats_t tasks[SIM_TASKS_MAX];
+    int task_cnt;
+    sim_input_stats_t input[SIM_INPUT_KIND_CNT];
+    sim_heap_stats_t heap;
+    uint32_t lvgl_mem_peak;
+#if METRICS_ENABLED
+    metrics_record_t metrics;   // The counters of the firmware
+#endif
+} sim_snapshot_t;
+
+/*The maximum frame time and input latency restart with every snapshot, the heap peaks cover the whole run*/
+void sim_snapshot_take(sim_snapshot_t* snapshot);
+void sim_report_print(const char* name, const sim_snapshot_t* start, const sim_snapshot_t* end);
+void sim_report_write_json(FILE* file, const char* name, const sim_snapshot_t* start, const sim_snapshot_t* end);
+
+#endif // SIM_H
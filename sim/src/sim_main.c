@@ -0,0 +1,191 @@
+/*Entry point of the simulator: sets up the device models, runs app_main() of the firmware like the ESP-IDF startup code
+would, feeds the scripted input and prints what was measured at the end*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "config.h"
+#include "driver/gpio.h"
+#include "esp_log.h"
+#include "esp_lvgl_port.h"
+
+#include "sim.h"
+
+typedef struct
+{
+    double duration_s;
+    const char* script_path;
+    const char* screenshot_path;
+    const char* json_path;
+    esp_log_level_t log_level;
+} sim_options_t;
+
+static const char TAG[] = "sim";
+
+void app_main(void);
+
+static void print_usage(const char* name)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  --duration <s>         run time in seconds (default 10)\n"
+            "  --script <file>        scripted encoder and button input\n"
+            "  --screenshot <file>    write the screen to a PPM file at the end\n"
+            "  --json <file>          write the metrics to a JSON file\n"
+            "  --log-level <level>    none, error, warn, info (default), debug or verbose\n"
+            "  --assets <file>        asset pack mapped as the \"assets\" partition (default: the one of the build)\n",
+            name);
+}
+
+static bool parse_log_level(const char* name, esp_log_level_t* level)
+{
+    static const char* const names[] = {"none", "error", "warn", "info", "debug", "verbose"};
+
+    for (int i = 0; i < (int)(sizeof(names) / sizeof(names[0])); i++)
+    {
+        if (strcmp(name, names[i]) == 0)
+        {
+            *level = (esp_log_level_t)i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool parse_options(int argc, char** argv, sim_options_t* options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char* option = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (value == NULL)
+        {
+            return false; // Every option takes a value
+        }
+        i++;
+
+        if (strcmp(option, "--duration") == 0)
+        {
+            options->duration_s = atof(value);
+            if (options->duration_s <= 0)
+            {
+                return false;
+            }
+        }
+        else if (strcmp(option, "--script") == 0)
+        {
+            options->script_path = value;
+        }
+        else if (strcmp(option, "--screenshot") == 0)
+        {
+            options->screenshot_path = value;
+        }
+        else if (strcmp(option, "--json") == 0)
+        {
+            options->json_path = value;
+        }
+        else if (strcmp(option, "--log-level") == 0)
+        {
+            if (!parse_log_level(value, &options->log_level))
+            {
+                return false;
+            }
+        }
+        else if (strcmp(option, "--assets") == 0)
+        {
+            sim_partition_set_file("assets", value);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool write_json(const char* path, const sim_snapshot_t* start, const sim_snapshot_t* end)
+{
+    FILE* file = fopen(path, "w");
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    sim_report_write_json(file, "watch_sim", start, end);
+    fprintf(file, "\n");
+    return fclose(file) == 0;
+}
+
+int main(int argc, char** argv)
+{
+    sim_options_t options =
+    {
+        .duration_s = 10,
+        .log_level = ESP_LOG_INFO,
+    };
+
+    if (!parse_options(argc, argv, &options))
+    {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    esp_log_level_set("*", options.log_level);
+
+    /*The hardware around the ESP32*/
+    sim_gpio_init();
+    sim_ds3231_init();
+    sim_max30102_init(GPIO_NUM_4);
+
+    if (options.script_path != NULL && !sim_input_load_script(options.script_path))
+    {
+        return EXIT_FAILURE;
+    }
+
+    /*Like on the target, app_main() sets everything up and returns while the tasks keep running*/
+    app_main();
+    ESP_LOGI(TAG, "app_main() returned after %" PRIu64 " ms", sim_time_us() / 1000);
+
+    sim_input_start();
+    uint64_t end_us = (uint64_t)(options.duration_s * 1000000);
+    if (end_us > sim_time_us())
+    {
+        sim_sleep_us(end_us - sim_time_us());
+    }
+
+    sim_snapshot_t start = {0}; // Everything starts from 0
+    sim_snapshot_t end;
+    sim_snapshot_take(&end);
+    sim_report_print("watch_sim", &start, &end);
+
+    int status = EXIT_SUCCESS;
+    if (options.json_path != NULL && !write_json(options.json_path, &start, &end))
+    {
+        ESP_LOGE(TAG, "Failed to write %s", options.json_path);
+        status = EXIT_FAILURE;
+    }
+
+    if (options.screenshot_path != NULL)
+    {
+        lvgl_port_lock(0);
+        bool written = sim_lcd_write_ppm(options.screenshot_path, DISPLAY_SIZE_X, DISPLAY_SIZE_Y);
+        lvgl_port_unlock();
+        if (!written)
+        {
+            ESP_LOGE(TAG, "Failed to write %s", options.screenshot_path);
+            status = EXIT_FAILURE;
+        }
+    }
+
+    if (end.render.frame_cnt == 0)
+    {
+        ESP_LOGE(TAG, "Nothing was drawn");
+        status = 2;
+    }
+
+    /*The firmware tasks never return, so leave without joining them*/
+    fflush(stdout);
+    exit(status);
+}
@@ -0,0 +1,219 @@
+/*Tests of the asset partition (main/core/src/assets.c). The packs are written on the host like mkassets does and
+mapped through the esp_partition stand-in, which uses mmap()*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "lvgl.h"
+
+#include "assets.h"
+#include "sim.h"
+
+#define CHECK(cond) \
+    do \
+    { \
+        if (!(cond)) \
+        { \
+            printf("  FAILED: %s (line %d)\n", #cond, __LINE__); \
+            failure_cnt++; \
+        } \
+    } while (0)
+
+static int failure_cnt = 0;
+static char pack_path[] = "/tmp/assets_test_XXXXXX";
+
+static void* read_file(const char* path, size_t* size)
+{
+    FILE* file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    *size = (size_t)ftell(file);
+    rewind(file);
+    void* data = malloc(*size);
+    if (data != NULL && fread(data, 1, *size, file) != *size)
+    {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+    return data;
+}
+
+static void test_build_pack(void)
+{
+    printf("build pack\n");
+
+    /*The pack the build made from assets/assets.txt*/
+    sim_heap_stats_t heap_start;
+    sim_heap_get_stats(&heap_start);
+    CHECK(assets_init());
+    sim_heap_stats_t heap_end;
+    sim_heap_get_stats(&heap_end);
+    CHECK(heap_end.used == heap_start.used); // Mapped, not copied
+
+    size_t ttf_size;
+    void* ttf = read_file(ASSETS_DIR "/digital-7_mono.ttf", &ttf_size);
+    CHECK(ttf != NULL);
+
+    size_t size = 0;
+    const uint8_t* data = assets_get("digital_7_mono", ASSET_TYPE_TTF, &size);
+    CHECK(data != NULL && size == ttf_size && memcmp(data, ttf, size) == 0);
+    CHECK((uintptr_t)data % ASSETS_ALIGN == 0);
+    CHECK(assets_get("digital_7_mono", ASSET_TYPE_IMAGE, NULL) == NULL);
+    CHECK(assets_get("missing", ASSET_TYPE_TTF, NULL) == NULL);
+
+    /*The font from the partition draws the same as the one from RAM*/
+    lv_font_t* mapped = assets_ttf_create("digital_7_mono", 70, 4096);
+    lv_font_t* copied = lv_tiny_ttf_create_data(ttf, ttf_size, 70);
+    CHECK(mapped != NULL && copied != NULL);
+    if (mapped != NULL && copied != NULL)
+    {
+        CHECK(mapped->line_height == copied->line_height);
+        CHECK(lv_txt_get_width("12:34:56", 8, mapped, 0, LV_TEXT_FLAG_NONE) ==
+              lv_txt_get_width("12:34:56", 8, copied, 0, LV_TEXT_FLAG_NONE));
+
+        lv_font_glyph_dsc_t glyph;
+        CHECK(lv_font_get_glyph_dsc(mapped, &glyph, '8', 0));
+        const uint8_t* mapped_bitmap = lv_font_get_glyph_bitmap(mapped, '8');
+        const uint8_t* copied_bitmap = lv_font_get_glyph_bitmap(copied, '8');
+        CHECK(mapped_bitmap != NULL && copied_bitmap != NULL &&
+              memcmp(mapped_bitmap, copied_bitmap, glyph.box_w * glyph.box_h) == 0);
+    }
+    lv_tiny_ttf_destroy(mapped);
+    lv_tiny_ttf_destroy(copied);
+    free(ttf);
+
+    assets_deinit();
+    CHECK(assets_get("digital_7_mono", ASSET_TYPE_TTF, NULL) == NULL);
+}
+
+static void test_image(void)
+{
+    printf("image\n");
+
+    /*An LVGL binary image, the header and the pixels*/
+    uint8_t image[sizeof(lv_img_header_t) + 4 * 2 * sizeof(lv_color_t)];
+    lv_img_header_t header = {.cf = LV_IMG_CF_TRUE_COLOR, .w = 4, .h = 2};
+    memcpy(image, &header, sizeof(header));
+    for (size_t i = sizeof(header); i < sizeof(image); i++)
+    {
+        image[i] = (uint8_t)i;
+    }
+    static const char raw[] = "odd length";
+
+    const sim_asset_t assets[] =
+    {
+        {.name = "raw", .type = ASSET_TYPE_RAW, .data = raw, .size = sizeof(raw)},
+        {.name = "hand", .type = ASSET_TYPE_IMAGE, .data = image, .size = sizeof(image)},
+    };
+    CHECK(sim_assets_write(pack_path, assets, 2));
+    sim_partition_set_file("assets", pack_path);
+    CHECK(assets_init());
+
+    lv_img_dsc_t dsc;
+    CHECK(assets_get_image("hand", &dsc));
+    CHECK(dsc.header.cf == LV_IMG_CF_TRUE_COLOR && dsc.header.w == 4 && dsc.header.h == 2);
+    CHECK(dsc.data_size == sizeof(image) - sizeof(header));
+    CHECK(memcmp(dsc.data, image + sizeof(header), dsc.data_size) == 0);
+    CHECK(dsc.data == (const uint8_t*)assets_get("hand", ASSET_TYPE_IMAGE, NULL) + sizeof(header)); // In place
+    CHECK((uintptr_t)dsc.data % ASSETS_ALIGN == 0);
+    CHECK(!assets_get_image("raw", &dsc));
+
+    size_t size;
+    const char* data = assets_get("raw", ASSET_TYPE_RAW, &size);
+    CHECK(data != NULL && size == sizeof(raw) && strcmp(data, raw) == 0);
+
+    assets_deinit();
+}
+
+static void test_invalid(void)
+{
+    printf("invalid\n");
+
+    /*No file, like no partition*/
+    sim_partition_set_file("assets", "/nonexistent/assets.bin");
+    CHECK(!assets_init());
+
+    /*Not a pack*/
+    FILE* file = fopen(pack_path, "wb");
+    fputs("not an asset pack, just some text", file);
+    fclose(file);
+    sim_partition_set_file("assets", pack_path);
+    CHECK(!assets_init());
+    CHECK(assets_get("raw", ASSET_TYPE_RAW, NULL) == NULL);
+
+    /*An entry pointing outside of the pack*/
+    static const char raw[] = "data";
+    const sim_asset_t asset = {.name = "raw", .type = ASSET_TYPE_RAW, .data = raw, .size = sizeof(raw)};
+    CHECK(sim_assets_write(pack_path, &asset, 1));
+    size_t size;
+    uint8_t* pack = read_file(pack_path, &size);
+    assets_entry_t* entry = (assets_entry_t*)(pack + sizeof(assets_header_t));
+    entry->size = 4096;
+    file = fopen(pack_path, "wb");
+    fwrite(pack, 1, size, file);
+    fclose(file);
+    free(pack);
+    CHECK(!assets_init());
+
+    /*Too long names are refused*/
+    const sim_asset_t long_name = {.name = "a name which is too long for the table", .data = raw, .size = 1};
+    CHECK(!sim_assets_write(pack_path, &long_name, 1));
+}
+
+static void test_manifest(void)
+{
+    printf("manifest\n");
+
+    char manifest_path[] = "/tmp/assets_test_manifest_XXXXXX";
+    int fd = mkstemp(manifest_path);
+    CHECK(fd >= 0);
+    FILE* file = fdopen(fd, "w");
+    fprintf(file, "# Comment\n\nttf digits %s/digital-7_mono.ttf\n  raw   copy   %s/digital-7_mono.ttf\n",
+            ASSETS_DIR, ASSETS_DIR);
+    fclose(file);
+
+    /*The files are relative to the manifest, absolute paths work too*/
+    CHECK(sim_assets_build(manifest_path, pack_path));
+    sim_partition_set_file("assets", pack_path);
+    CHECK(assets_init());
+    size_t ttf_size = 0;
+    size_t raw_size = 0;
+    const void* ttf = assets_get("digits", ASSET_TYPE_TTF, &ttf_size);
+    const void* raw = assets_get("copy", ASSET_TYPE_RAW, &raw_size);
+    CHECK(ttf != NULL && raw != NULL && ttf_size == raw_size && memcmp(ttf, raw, ttf_size) == 0);
+    assets_deinit();
+
+    file = fopen(manifest_path, "w");
+    fprintf(file, "font digits digital-7_mono.ttf\n");
+    fclose(file);
+    CHECK(!sim_assets_build(manifest_path, pack_path));
+
+    unlink(manifest_path);
+}
+
+int main(void)
+{
+    lv_init();
+
+    int fd = mkstemp(pack_path);
+    if (fd < 0)
+    {
+        printf("Can't create a temporary file\n");
+        return EXIT_FAILURE;
+    }
+    close(fd);
+
+    test_build_pack();
+    test_image();
+    test_invalid();
+    test_manifest();
+
+    unlink(pack_path);
+    printf("%s: %d failure(s)\n", failure_cnt ? "FAILED" : "OK", failure_cnt);
+    return failure_cnt ? EXIT_FAILURE : EXIT_SUCCESS;
+}
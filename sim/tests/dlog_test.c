@@ -0,0 +1,148 @@
+/*Tests of the deferred log (main/core/src/dlog.c). dlog_init() isn't called, so the records stay in the ring and the
+test reads them itself*/
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DLOG_LOCAL_LEVEL    DLOG_LEVEL_DEBUG
+#include "dlog.h"
+
+#define WRITER_CNT          4
+#define RECORDS_PER_WRITER  20000
+
+#define CHECK(cond) \
+    do \
+    { \
+        if (!(cond)) \
+        { \
+            printf("  FAILED: %s (line %d)\n", #cond, __LINE__); \
+            failure_cnt++; \
+        } \
+    } while (0)
+
+static const char TAG[] = "test";
+
+static int failure_cnt = 0;
+static int finished_writer_cnt = 0;
+
+static void test_record(void)
+{
+    printf("record\n");
+
+    DLOGW(TAG, "no arguments");
+    DLOGD(TAG, "%d %u %x %d", -1, 2u, 0xabcd, 4);
+    DLOGV(TAG, "above the level of the module");
+
+    dlog_record_t record;
+    CHECK(dlog_read(&record));
+    CHECK(record.level == DLOG_LEVEL_WARN && record.arg_cnt == 0);
+    CHECK(record.tag == TAG && strcmp(record.format, "no arguments") == 0);
+
+    CHECK(dlog_read(&record));
+    CHECK(record.level == DLOG_LEVEL_DEBUG && record.arg_cnt == 4);
+    CHECK((int32_t)record.args[0] == -1 && record.args[1] == 2 && record.args[2] == 0xabcd && record.args[3] == 4);
+
+    CHECK(!dlog_read(&record)); // The verbose one was compiled out
+}
+
+static void test_full(void)
+{
+    printf("full\n");
+
+    uint32_t dropped_start = dlog_get_dropped_cnt();
+    for (int i = 0; i < DLOG_RING_LENGTH + 10; i++)
+    {
+        DLOGI(TAG, "%d", i);
+    }
+    CHECK(dlog_get_dropped_cnt() - dropped_start == 10);
+
+    /*The oldest ones are kept*/
+    dlog_record_t record;
+    for (int i = 0; i < DLOG_RING_LENGTH; i++)
+    {
+        CHECK(dlog_read(&record) && record.args[0] == (uint32_t)i);
+    }
+    CHECK(!dlog_read(&record));
+
+    DLOGI(TAG, "after");
+    CHECK(dlog_read(&record) && strcmp(record.format, "after") == 0);
+}
+
+static void* writer_thread(void* arg)
+{
+    uint32_t writer = (uint32_t)(uintptr_t)arg;
+    for (uint32_t i = 0; i < RECORDS_PER_WRITER; i++)
+    {
+        DLOGI(TAG, "%u %u", writer, i);
+        if (i % 16 == 0)
+        {
+            sched_yield(); // Give the reader a chance, so it reads while the writers write
+        }
+    }
+    __atomic_fetch_add(&finished_writer_cnt, 1, __ATOMIC_RELEASE);
+
+    return NULL;
+}
+
+static void test_concurrent(void)
+{
+    printf("concurrent\n");
+
+    uint32_t dropped_start = dlog_get_dropped_cnt();
+    pthread_t threads[WRITER_CNT];
+    for (int i = 0; i < WRITER_CNT; i++)
+    {
+        pthread_create(&threads[i], NULL, writer_thread, (void*)(uintptr_t)i);
+    }
+
+    /*Every record arrives once and the ones of a writer stay in order, some may be dropped*/
+    int64_t last[WRITER_CNT];
+    for (int i = 0; i < WRITER_CNT; i++)
+    {
+        last[i] = -1;
+    }
+    uint32_t read_cnt = 0;
+    bool in_order = true;
+    dlog_record_t record;
+    while (true)
+    {
+        bool done = __atomic_load_n(&finished_writer_cnt, __ATOMIC_ACQUIRE) == WRITER_CNT;
+        while (dlog_read(&record))
+        {
+            uint32_t writer = record.args[0];
+            in_order &= writer < WRITER_CNT && (int64_t)record.args[1] > last[writer];
+            if (writer < WRITER_CNT)
+            {
+                last[writer] = record.args[1];
+            }
+            read_cnt++;
+        }
+
+        if (done)
+        {
+            break; // Read once more after the last writer finished
+        }
+    }
+
+    for (int i = 0; i < WRITER_CNT; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    uint32_t dropped_cnt = dlog_get_dropped_cnt() - dropped_start;
+    printf("  %u read, %u dropped\n", read_cnt, dropped_cnt);
+    CHECK(in_order);
+    CHECK(read_cnt + dropped_cnt == WRITER_CNT * RECORDS_PER_WRITER);
+}
+
+int main(void)
+{
+    test_record();
+    test_full();
+    test_concurrent();
+
+    printf("%s: %d failure(s)\n", failure_cnt ? "FAILED" : "OK", failure_cnt);
+    return failure_cnt ? EXIT_FAILURE : EXIT_SUCCESS;
+}
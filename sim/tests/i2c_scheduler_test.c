@@ -0,0 +1,516 @@
+/*Tests of the I2C scheduler (main/core/src/i2c_scheduler.c) on the simulated bus. Devices of the test record the
+order in which the transactions reach the bus, a gate device holds the bus so the queue can be filled first*/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "driver/i2c_master.h"
+#include "esp_log.h"
+
+#include "i2c_scheduler.h"
+#include "sim.h"
+
+#define LOG_LENGTH          128
+#define GATE_ADDRESS        0x10
+#define DEVICE_A_ADDRESS    0x11
+#define DEVICE_B_ADDRESS    0x12
+#define DEVICE_C_ADDRESS    0x13
+#define MISSING_ADDRESS     0x77    // No model answers
+
+#define CHECK(cond) \
+    do \
+    { \
+        if (!(cond)) \
+        { \
+            printf("  FAILED: %s (line %d)\n", #cond, __LINE__); \
+            failure_cnt++; \
+        } \
+    } while (0)
+
+typedef struct
+{
+    char name;      // Written to the log with the first byte of every write
+} device_t;
+
+typedef struct
+{
+    char device;
+    uint8_t tag;
+} log_entry_t;
+
+static int failure_cnt = 0;
+
+static i2c_master_dev_handle_t gate_dev;
+static i2c_master_dev_handle_t dev_a;
+static i2c_master_dev_handle_t dev_b;
+static i2c_master_dev_handle_t dev_c;
+static i2c_master_dev_handle_t missing_dev;
+
+static device_t device_a = {.name = 'A'};
+static device_t device_b = {.name = 'B'};
+static device_t device_c = {.name = 'C'};
+
+static pthread_mutex_t log_lock = PTHREAD_MUTEX_INITIALIZER;
+static log_entry_t access_log[LOG_LENGTH];
+static int log_cnt = 0;
+
+static pthread_mutex_t gate_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t gate_cond = PTHREAD_COND_INITIALIZER;
+static bool gate_entered = false;
+static bool gate_open = false;
+
+static SemaphoreHandle_t done_semaphore;
+
+static void device_write(void* ctx, const uint8_t* data, size_t size)
+{
+    device_t* device = (device_t*)ctx;
+
+    pthread_mutex_lock(&log_lock);
+    if (log_cnt < LOG_LENGTH)
+    {
+        access_log[log_cnt++] = (log_entry_t){.device = device->name, .tag = data[0]};
+    }
+    pthread_mutex_unlock(&log_lock);
+}
+
+static void device_read(void* ctx, uint8_t* data, size_t size)
+{
+    memset(data, 0xa5, size);
+}
+
+static void gate_write(void* ctx, const uint8_t* data, size_t size)
+{
+    /*Holds the bus until the test opens the gate*/
+    pthread_mutex_lock(&gate_lock);
+    gate_entered = true;
+    pthread_cond_broadcast(&gate_cond);
+    while (!gate_open)
+    {
+        pthread_cond_wait(&gate_cond, &gate_lock);
+    }
+    pthread_mutex_unlock(&gate_lock);
+}
+
+static void count_done(esp_err_t result, void* arg)
+{
+    if (arg != NULL)
+    {
+        *(esp_err_t*)arg = result;
+    }
+    xSemaphoreGive(done_semaphore);
+}
+
+static void wait_done(int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        xSemaphoreTake(done_semaphore, portMAX_DELAY);
+    }
+}
+
+static void close_gate(void)
+{
+    static const uint8_t data[1] = {0};
+    i2c_sched_transaction_t transaction =
+    {
+        .dev = gate_dev,
+        .write_buffer = data,
+        .write_size = 1,
+        .priority = I2C_SCHED_PRIORITY_HIGH,
+        .callback = count_done,
+    };
+
+    pthread_mutex_lock(&gate_lock);
+    gate_entered = false;
+    gate_open = false;
+    pthread_mutex_unlock(&gate_lock);
+
+    i2c_sched_submit(&transaction, 1);
+
+    /*Wait until the scheduler runs it, from then on everything submitted queues up*/
+    pthread_mutex_lock(&gate_lock);
+    while (!gate_entered)
+    {
+        pthread_cond_wait(&gate_cond, &gate_lock);
+    }
+    pthread_mutex_unlock(&gate_lock);
+}
+
+static void open_gate(void)
+{
+    pthread_mutex_lock(&gate_lock);
+    gate_open = true;
+    pthread_cond_broadcast(&gate_cond);
+    pthread_mutex_unlock(&gate_lock);
+
+    wait_done(1);
+}
+
+static void reset_log(void)
+{
+    pthread_mutex_lock(&log_lock);
+    log_cnt = 0;
+    pthread_mutex_unlock(&log_lock);
+}
+
+static bool log_matches(const char* expected)
+{
+    /*`expected` lists device and tag pairs, e.g. "A1B2"*/
+    pthread_mutex_lock(&log_lock);
+    bool matches = log_cnt * 2 == (int)strlen(expected);
+    for (int i = 0; matches && i < log_cnt; i++)
+    {
+        matches = access_log[i].device == expected[2 * i] && access_log[i].tag == expected[2 * i + 1] - '0';
+    }
+
+    if (!matches)
+    {
+        printf("  log: ");
+        for (int i = 0; i < log_cnt; i++)
+        {
+            printf("%c%d", access_log[i].device, access_log[i].tag);
+        }
+        printf(", expected %s\n", expected);
+    }
+    pthread_mutex_unlock(&log_lock);
+
+    return matches;
+}
+
+static i2c_sched_transaction_t make_write(i2c_master_dev_handle_t dev, const uint8_t* tag,
+                                          i2c_sched_priority_t priority, uint32_t deadline_ms)
+{
+    return (i2c_sched_transaction_t)
+    {
+        .dev = dev,
+        .write_buffer = tag,
+        .write_size = 1,
+        .priority = priority,
+        .deadline_ms = deadline_ms,
+        .callback = count_done,
+    };
+}
+
+static const uint8_t tags[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+static void test_callback(void)
+{
+    printf("callback\n");
+    reset_log();
+
+    static const uint8_t reg[1] = {1};
+    uint8_t data[2] = {0};
+    esp_err_t result = ESP_FAIL;
+    i2c_sched_transaction_t transaction =
+    {
+        .dev = dev_a,
+        .write_buffer = reg,
+        .write_size = 1,
+        .read_buffer = data,
+        .read_size = 2,
+        .priority = I2C_SCHED_PRIORITY_NORMAL,
+        .callback = count_done,
+        .arg = &result,
+    };
+
+    CHECK(i2c_sched_submit(&transaction, 1) == ESP_OK);
+    wait_done(1);
+    CHECK(result == ESP_OK);
+    CHECK(data[0] == 0xa5 && data[1] == 0xa5);
+    CHECK(log_matches("A1"));
+}
+
+static void test_priority_and_deadline(void)
+{
+    printf("priority and deadline\n");
+    close_gate();
+    reset_log();
+
+    i2c_sched_transaction_t transactions[] =
+    {
+        make_write(dev_a, &tags[1], I2C_SCHED_PRIORITY_LOW, 0),
+        make_write(dev_b, &tags[2], I2C_SCHED_PRIORITY_NORMAL, 0),
+        make_write(dev_a, &tags[3], I2C_SCHED_PRIORITY_LOW, 0),
+        make_write(dev_c, &tags[4], I2C_SCHED_PRIORITY_HIGH, 0),
+        make_write(dev_c, &tags[5], I2C_SCHED_PRIORITY_NORMAL, 10000),
+    };
+    for (int i = 0; i < 5; i++)
+    {
+        CHECK(i2c_sched_submit(&transactions[i], 1) == ESP_OK);
+    }
+
+    open_gate();
+    wait_done(5);
+
+    /*High first, then the normal one with a deadline, then the rest by priority and age*/
+    CHECK(log_matches("C4C5B2A1A3"));
+}
+
+static void test_batching(void)
+{
+    printf("batching\n");
+    close_gate();
+    reset_log();
+
+    i2c_sched_transaction_t transactions[] =
+    {
+        make_write(dev_a, &tags[1], I2C_SCHED_PRIORITY_LOW, 0),
+        make_write(dev_b, &tags[2], I2C_SCHED_PRIORITY_LOW, 0),
+        make_write(dev_a, &tags[3], I2C_SCHED_PRIORITY_LOW, 0),
+        make_write(dev_b, &tags[4], I2C_SCHED_PRIORITY_LOW, 0),
+    };
+    CHECK(i2c_sched_submit(transactions, 4) == ESP_OK);
+
+    open_gate();
+    wait_done(4);
+    CHECK(log_matches("A1A3B2B4"));
+
+    /*A batch ends after I2C_SCHED_BATCH_MAX transactions*/
+    close_gate();
+    reset_log();
+
+    i2c_sched_transaction_t long_batch[I2C_SCHED_BATCH_MAX + 2];
+    long_batch[0] = make_write(dev_a, &tags[0], I2C_SCHED_PRIORITY_LOW, 0);
+    long_batch[1] = make_write(dev_b, &tags[9], I2C_SCHED_PRIORITY_LOW, 0);
+    for (int i = 2; i < I2C_SCHED_BATCH_MAX + 2; i++)
+    {
+        long_batch[i] = make_write(dev_a, &tags[i - 1], I2C_SCHED_PRIORITY_LOW, 0);
+    }
+    CHECK(i2c_sched_submit(long_batch, I2C_SCHED_BATCH_MAX + 2) == ESP_OK);
+
+    open_gate();
+    wait_done(I2C_SCHED_BATCH_MAX + 2);
+    CHECK(log_matches("A0A1A2A3A4A5A6A7B9A8"));
+}
+
+static void submit_urgent(esp_err_t result, void* arg)
+{
+    /*Arrives while a batch of A is running*/
+    static i2c_sched_transaction_t urgent;
+    urgent = make_write(dev_c, &tags[9], I2C_SCHED_PRIORITY_HIGH, 0);
+    i2c_sched_submit(&urgent, 1);
+    count_done(result, NULL);
+}
+
+static void test_batch_preempted(void)
+{
+    printf("batch preempted by a higher priority\n");
+    close_gate();
+    reset_log();
+
+    i2c_sched_transaction_t transactions[] =
+    {
+        make_write(dev_a, &tags[1], I2C_SCHED_PRIORITY_LOW, 0),
+        make_write(dev_a, &tags[2], I2C_SCHED_PRIORITY_LOW, 0),
+        make_write(dev_a, &tags[3], I2C_SCHED_PRIORITY_LOW, 0),
+    };
+    transactions[0].callback = submit_urgent;
+    CHECK(i2c_sched_submit(transactions, 3) == ESP_OK);
+
+    open_gate();
+    wait_done(4);
+    CHECK(log_matches("A1C9A2A3"));
+}
+
+static void test_expired(void)
+{
+    printf("missed deadline\n");
+    close_gate();
+    reset_log();
+
+    esp_err_t late_result = ESP_OK;
+    esp_err_t result = ESP_FAIL;
+    i2c_sched_transaction_t late = make_write(dev_a, &tags[1], I2C_SCHED_PRIORITY_HIGH, 20);
+    late.arg = &late_result;
+    i2c_sched_transaction_t in_time = make_write(dev_b, &tags[2], I2C_SCHED_PRIORITY_LOW, 0);
+    in_time.arg = &result;
+    CHECK(i2c_sched_submit(&late, 1) == ESP_OK);
+    CHECK(i2c_sched_submit(&in_time, 1) == ESP_OK);
+
+    sim_sleep_us(50000); // The bus is busy for longer than the deadline
+    open_gate();
+    wait_done(2);
+
+    CHECK(late_result == ESP_ERR_TIMEOUT);
+    CHECK(result == ESP_OK);
+    CHECK(log_matches("B2")); // The late one never reached the bus
+}
+
+static void test_slots(void)
+{
+    printf("slots\n");
+    close_gate();
+    reset_log();
+
+    i2c_sched_transaction_t low = make_write(dev_a, &tags[1], I2C_SCHED_PRIORITY_LOW, 0);
+    i2c_sched_transaction_t high = make_write(dev_b, &tags[2], I2C_SCHED_PRIORITY_HIGH, 0);
+
+    int low_cnt = 0;
+    while (low_cnt <= I2C_SCHED_QUEUE_LENGTH && i2c_sched_submit(&low, 1) == ESP_OK)
+    {
+        low_cnt++;
+    }
+    CHECK(low_cnt == I2C_SCHED_LOW_PRIO_SLOTS);
+
+    /*The slots kept free for the others*/
+    int high_cnt = 0;
+    while (high_cnt <= I2C_SCHED_QUEUE_LENGTH && i2c_sched_submit(&high, 1) == ESP_OK)
+    {
+        high_cnt++;
+    }
+    CHECK(high_cnt == I2C_SCHED_QUEUE_LENGTH - I2C_SCHED_LOW_PRIO_SLOTS);
+
+    open_gate();
+    wait_done(low_cnt + high_cnt);
+}
+
+static void test_transfer(void)
+{
+    printf("blocking transfer\n");
+    reset_log();
+
+    static const uint8_t reg[1] = {3};
+    uint8_t data[1] = {0};
+    CHECK(i2c_sched_transmit_receive(dev_a, reg, 1, data, 1, I2C_SCHED_PRIORITY_NORMAL, 0) == ESP_OK);
+    CHECK(data[0] == 0xa5);
+
+    /*The first error is returned, the other transactions still run*/
+    i2c_sched_transaction_t transactions[] =
+    {
+        make_write(dev_a, &tags[1], I2C_SCHED_PRIORITY_NORMAL, 0),
+        make_write(missing_dev, &tags[2], I2C_SCHED_PRIORITY_NORMAL, 0),
+        make_write(dev_b, &tags[3], I2C_SCHED_PRIORITY_NORMAL, 0),
+    };
+    CHECK(i2c_sched_transfer(transactions, 3) == ESP_ERR_INVALID_STATE);
+    CHECK(log_matches("A3A1B3"));
+
+    CHECK(i2c_sched_transfer(transactions, 0) == ESP_ERR_INVALID_ARG);
+}
+
+static void drain_task(void* arg)
+{
+    /*Like the PPG driver draining a full fifo: 32 samples, 3 transactions each*/
+    static const uint8_t data_reg[2] = {7, 0};
+    static const uint8_t ptr_reg[2] = {6, 0};
+    uint8_t sample[6];
+    uint8_t ptr[1];
+
+    for (int i = 0; i < 32; i++)
+    {
+        const i2c_sched_transaction_t transactions[] =
+        {
+            {.dev = dev_a, .write_buffer = data_reg, .write_size = 2, .read_buffer = sample, .read_size = 6, .priority = I2C_SCHED_PRIORITY_LOW},
+            {.dev = dev_a, .write_buffer = ptr_reg, .write_size = 2, .priority = I2C_SCHED_PRIORITY_LOW},
+            {.dev = dev_a, .write_buffer = ptr_reg, .write_size = 1, .read_buffer = ptr, .read_size = 1, .priority = I2C_SCHED_PRIORITY_LOW},
+        };
+        i2c_sched_transfer(transactions, 3);
+    }
+
+    xSemaphoreGive(done_semaphore);
+    vTaskDelete(NULL);
+}
+
+static void test_latency(void)
+{
+    /*The clock read (7 registers) while the PPG fifo is drained, with the bus at 400 kHz*/
+    printf("latency on a busy bus\n");
+    sim_i2c_set_byte_time_ns(22500);
+
+    static const uint8_t regs[7] = {0, 1, 2, 3, 4, 5, 6};
+    uint8_t data[7];
+    i2c_sched_transaction_t clock_read[7];
+    for (int i = 0; i < 7; i++)
+    {
+        clock_read[i] = (i2c_sched_transaction_t)
+        {
+            .dev = dev_b,
+            .write_buffer = &regs[i],
+            .write_size = 1,
+            .read_buffer = &data[i],
+            .read_size = 1,
+            .priority = I2C_SCHED_PRIORITY_HIGH,
+            .deadline_ms = 100,
+        };
+    }
+
+    /*Alone on the bus*/
+    uint64_t start_us = sim_time_us();
+    CHECK(i2c_sched_transfer(clock_read, 7) == ESP_OK);
+    uint64_t idle_us = sim_time_us() - start_us;
+
+    uint64_t drain_start_us = sim_time_us();
+    xTaskCreate(drain_task, "drain", 4096, NULL, 4, NULL);
+    sim_sleep_us(5000); // Well into the drain
+
+    start_us = sim_time_us();
+    CHECK(i2c_sched_transfer(clock_read, 7) == ESP_OK);
+    uint64_t busy_us = sim_time_us() - start_us;
+
+    wait_done(1);
+    uint64_t drain_us = sim_time_us() - drain_start_us;
+    sim_i2c_set_byte_time_ns(0);
+
+    printf("  clock read %.2f ms idle, %.2f ms during a %.2f ms fifo drain\n", idle_us / 1000.0, busy_us / 1000.0,
+           drain_us / 1000.0);
+
+    /*At most one PPG transaction ahead of it*/
+    CHECK(busy_us < idle_us + 2000);
+    CHECK(busy_us * 4 < drain_us);
+}
+
+static i2c_master_dev_handle_t add_device(i2c_master_bus_handle_t bus, uint16_t address)
+{
+    i2c_device_config_t config =
+    {
+        .dev_addr_length = I2C_ADDR_BIT_LEN_7,
+        .device_address = address,
+        .scl_speed_hz = 400000,
+    };
+    i2c_master_dev_handle_t dev = NULL;
+    i2c_master_bus_add_device(bus, &config, &dev);
+
+    return dev;
+}
+
+int main(void)
+{
+    esp_log_level_set("*", ESP_LOG_NONE); // The missing device logs an error
+
+    sim_i2c_add_model(&(sim_i2c_model_t){.name = "gate", .address = GATE_ADDRESS, .write = gate_write, .read = device_read});
+    sim_i2c_add_model(&(sim_i2c_model_t){.name = "a", .address = DEVICE_A_ADDRESS, .write = device_write, .read = device_read, .ctx = &device_a});
+    sim_i2c_add_model(&(sim_i2c_model_t){.name = "b", .address = DEVICE_B_ADDRESS, .write = device_write, .read = device_read, .ctx = &device_b});
+    sim_i2c_add_model(&(sim_i2c_model_t){.name = "c", .address = DEVICE_C_ADDRESS, .write = device_write, .read = device_read, .ctx = &device_c});
+
+    i2c_master_bus_config_t bus_config = {.i2c_port = 1, .clk_source = I2C_CLK_SRC_DEFAULT};
+    i2c_master_bus_handle_t bus;
+    i2c_new_master_bus(&bus_config, &bus);
+    gate_dev = add_device(bus, GATE_ADDRESS);
+    dev_a = add_device(bus, DEVICE_A_ADDRESS);
+    dev_b = add_device(bus, DEVICE_B_ADDRESS);
+    dev_c = add_device(bus, DEVICE_C_ADDRESS);
+    missing_dev = add_device(bus, MISSING_ADDRESS);
+
+    done_semaphore = xSemaphoreCreateCounting(I2C_SCHED_QUEUE_LENGTH * 2, 0);
+    if (!i2c_sched_init() || done_semaphore == NULL)
+    {
+        printf("Setup failed\n");
+        return EXIT_FAILURE;
+    }
+
+    test_callback();
+    test_priority_and_deadline();
+    test_batching();
+    test_batch_preempted();
+    test_expired();
+    test_slots();
+    test_transfer();
+    test_latency();
+
+    printf("%s: %d failure(s)\n", failure_cnt ? "FAILED" : "OK", failure_cnt);
+    fflush(stdout);
+    exit(failure_cnt ? EXIT_FAILURE : EXIT_SUCCESS);
+}
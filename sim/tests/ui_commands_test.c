@@ -0,0 +1,291 @@
+/*Tests of the UI command queue (main/core/src/ui_commands.c) against a headless LVGL display. Producer tasks fill the
+queue like the widget tasks do, the main thread plays the LVGL task and applies the commands with ui_cmd_flush()*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "lvgl.h"
+
+#include "ui_commands.h"
+#include "sim.h"
+
+#define HRES                240
+#define VRES                240
+#define PRODUCER_CNT        4
+#define UPDATE_CNT          200     // Per producer, many times the length of the queue
+#define RECORD_LENGTH       16
+
+#define CHECK(cond) \
+    do \
+    { \
+        if (!(cond)) \
+        { \
+            printf("  FAILED: %s (line %d)\n", #cond, __LINE__); \
+            failure_cnt++; \
+        } \
+    } while (0)
+
+typedef struct
+{
+    int id;
+    lv_obj_t* label;
+    int applied_cnt;        // Written by the calls, so in the LVGL task
+    int order_errors;       // Calls applied out of order or before the text sent ahead of them
+} producer_t;
+
+static int failure_cnt = 0;
+
+static producer_t producers[PRODUCER_CNT];
+static SemaphoreHandle_t done_semaphore;
+static volatile bool queue_was_full = false;
+
+static char record[RECORD_LENGTH + 1]; // Tags of the applied record_cb() calls
+static int record_cnt = 0;
+
+static void flush_cb(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_map)
+{
+    (void)area;
+    (void)color_map;
+    lv_disp_flush_ready(drv);
+}
+
+static void headless_display_create(void)
+{
+    static lv_color_t buf[HRES * 10];
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t disp_drv;
+
+    lv_disp_draw_buf_init(&draw_buf, buf, NULL, HRES * 10);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = HRES;
+    disp_drv.ver_res = VRES;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.draw_buf = &draw_buf;
+    lv_disp_drv_register(&disp_drv);
+}
+
+static void check_update_cb(void* arg)
+{
+    /*Sent right after the text of the same update, so the label must show it already*/
+    int packed = (int)(intptr_t)arg;
+    producer_t* producer = &producers[packed / UPDATE_CNT];
+    int update = packed % UPDATE_CNT;
+
+    if (update != producer->applied_cnt || atoi(lv_label_get_text(producer->label)) != update)
+    {
+        producer->order_errors++;
+    }
+    producer->applied_cnt++;
+}
+
+static void producer_task(void* arg)
+{
+    producer_t* producer = arg;
+
+    for (int i = 0; i < UPDATE_CNT; i++)
+    {
+        /*Retry when the queue is full, the LVGL task empties it in a while*/
+        while (!ui_cmd_set_text_fmt(producer->label, "%d", i))
+        {
+            queue_was_full = true;
+            vTaskDelay(1);
+        }
+        while (!ui_cmd_call(check_update_cb, (void*)(intptr_t)(producer->id * UPDATE_CNT + i)))
+        {
+            queue_was_full = true;
+            vTaskDelay(1);
+        }
+    }
+
+    xSemaphoreGive(done_semaphore);
+    vTaskDelete(NULL);
+}
+
+static void record_cb(void* arg)
+{
+    if (record_cnt < RECORD_LENGTH)
+    {
+        record[record_cnt++] = (char)(intptr_t)arg;
+        record[record_cnt] = '\0';
+    }
+}
+
+static void reset_record(void)
+{
+    record_cnt = 0;
+    record[0] = '\0';
+}
+
+static void test_producers(void)
+{
+    printf("producers\n");
+
+    for (int i = 0; i < PRODUCER_CNT; i++)
+    {
+        producers[i] = (producer_t){.id = i, .label = lv_label_create(lv_scr_act())};
+        char name[16];
+        snprintf(name, sizeof(name), "producer %d", i);
+        xTaskCreate(producer_task, name, 4096, &producers[i], 5, NULL);
+    }
+
+    /*Don't apply anything until the producers ran into the full queue*/
+    uint64_t start_us = sim_time_us();
+    while (!queue_was_full && sim_time_us() - start_us < 1000000)
+    {
+        sim_sleep_us(1000);
+    }
+    CHECK(queue_was_full);
+
+    int done_cnt = 0;
+    while (done_cnt < PRODUCER_CNT)
+    {
+        ui_cmd_flush();
+        if (xSemaphoreTake(done_semaphore, pdMS_TO_TICKS(1)) == pdTRUE)
+        {
+            done_cnt++;
+        }
+    }
+    ui_cmd_flush();
+
+    /*Every update arrived once, in the order of its producer, and the texts ahead of the calls*/
+    for (int i = 0; i < PRODUCER_CNT; i++)
+    {
+        CHECK(producers[i].applied_cnt == UPDATE_CNT);
+        CHECK(producers[i].order_errors == 0);
+
+        char expected[16];
+        snprintf(expected, sizeof(expected), "%d", UPDATE_CNT - 1);
+        CHECK(strcmp(lv_label_get_text(producers[i].label), expected) == 0);
+        lv_obj_del(producers[i].label);
+    }
+}
+
+static void test_same_object(void)
+{
+    printf("same object\n");
+
+    lv_obj_t* label = lv_label_create(lv_scr_act());
+    lv_label_set_text(label, "00");
+    lv_refr_now(NULL);
+
+    /*The last of the updates waiting for the same label wins*/
+    CHECK(ui_cmd_set_text(label, "01"));
+    CHECK(ui_cmd_set_text(label, "02"));
+    CHECK(ui_cmd_set_text_fmt(label, "%02d", 3));
+    ui_cmd_flush();
+    CHECK(strcmp(lv_label_get_text(label), "03") == 0);
+    lv_refr_now(NULL);
+
+    /*The same text doesn't invalidate the label, so nothing is redrawn*/
+    lv_disp_t* disp = lv_disp_get_default();
+    CHECK(disp->inv_p == 0);
+    CHECK(ui_cmd_set_text(label, "03"));
+    ui_cmd_flush();
+    CHECK(disp->inv_p == 0);
+
+    CHECK(ui_cmd_set_text(label, "04"));
+    ui_cmd_flush();
+    CHECK(disp->inv_p > 0);
+    lv_refr_now(NULL);
+
+    /*Too long texts are truncated to the slot*/
+    char long_text[UI_CMD_TEXT_MAX_LENGTH + 8];
+    memset(long_text, 'x', sizeof(long_text) - 1);
+    long_text[sizeof(long_text) - 1] = '\0';
+    CHECK(ui_cmd_set_text(label, long_text));
+    ui_cmd_flush();
+    CHECK(strlen(lv_label_get_text(label)) == UI_CMD_TEXT_MAX_LENGTH - 1);
+
+    lv_obj_del(label);
+}
+
+static void queue_during_flush_cb(void* arg)
+{
+    record_cb(arg);
+    ui_cmd_call(record_cb, (void*)(intptr_t)'b');
+}
+
+static void flush_objects_cb(void* arg)
+{
+    /*Like a queued widget switch, which flushes before deleting the screen of the old widget*/
+    record_cb(arg);
+    ui_cmd_flush_objects();
+    ui_cmd_call(record_cb, (void*)(intptr_t)'c');
+}
+
+static void test_calls_during_flush(void)
+{
+    printf("calls during flush\n");
+
+    /*A call queued while the queue is flushed waits for the next flush, so a flush takes a bounded time*/
+    reset_record();
+    CHECK(ui_cmd_call(queue_during_flush_cb, (void*)(intptr_t)'a'));
+    ui_cmd_flush();
+    CHECK(strcmp(record, "a") == 0);
+    ui_cmd_flush();
+    CHECK(strcmp(record, "ab") == 0);
+
+    /*Flushing only the objects applies the texts and keeps the calls in their order for the next flush*/
+    reset_record();
+    lv_obj_t* label = lv_label_create(lv_scr_act());
+    CHECK(ui_cmd_set_text(label, "1"));
+    CHECK(ui_cmd_call(record_cb, (void*)(intptr_t)'x'));
+    CHECK(ui_cmd_set_text(label, "2"));
+    CHECK(ui_cmd_call(record_cb, (void*)(intptr_t)'y'));
+    ui_cmd_flush_objects();
+    CHECK(strcmp(lv_label_get_text(label), "2") == 0);
+    CHECK(record_cnt == 0);
+    CHECK(ui_cmd_call(record_cb, (void*)(intptr_t)'z'));
+    ui_cmd_flush();
+    CHECK(strcmp(record, "xyz") == 0);
+
+    /*Not even a full queue can drop the calls which were taken out by ui_cmd_flush_objects()*/
+    reset_record();
+    CHECK(ui_cmd_call(record_cb, (void*)(intptr_t)'x'));
+    ui_cmd_flush_objects();
+    for (int i = 0; i < UI_CMD_QUEUE_LENGTH; i++)
+    {
+        CHECK(ui_cmd_set_text(label, "3"));
+    }
+    CHECK(!ui_cmd_set_text(label, "4"));
+    ui_cmd_flush();
+    CHECK(strcmp(record, "x") == 0);
+
+    /*A call which flushes the objects defers the calls behind it, and the calls queued later wait for them*/
+    reset_record();
+    CHECK(ui_cmd_call(flush_objects_cb, (void*)(intptr_t)'r'));
+    CHECK(ui_cmd_call(record_cb, (void*)(intptr_t)'w'));
+    ui_cmd_flush();
+    CHECK(strcmp(record, "r") == 0);
+    ui_cmd_flush();
+    CHECK(strcmp(record, "rwc") == 0);
+
+    lv_obj_del(label);
+}
+
+int main(void)
+{
+    esp_log_level_set("*", ESP_LOG_NONE); // The full queue logs warnings
+
+    lv_init();
+    headless_display_create();
+
+    done_semaphore = xSemaphoreCreateCounting(PRODUCER_CNT, 0);
+    if (!ui_cmd_init() || done_semaphore == NULL)
+    {
+        printf("Setup failed\n");
+        return EXIT_FAILURE;
+    }
+
+    test_producers();
+    test_same_object();
+    test_calls_during_flush();
+
+    printf("%s: %d failure(s)\n", failure_cnt ? "FAILED" : "OK", failure_cnt);
+    fflush(stdout);
+    exit(failure_cnt ? EXIT_FAILURE : EXIT_SUCCESS);
+}
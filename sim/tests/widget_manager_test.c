@@ -0,0 +1,324 @@
+/*Tests of the widget lifecycle (main/core/src/widget_manager.c) against a headless LVGL display. The test widgets
+log their hooks, e.g. "AiAa" when widget A was initialized and activated. The LVGL task of the simulated port runs
+the UI commands, so the hooks are checked with lvgl_port_lock() taken*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_log.h"
+#include "esp_lvgl_port.h"
+#include "lvgl.h"
+
+#include "input_event_types.h"
+#include "ui_commands.h"
+#include "widget_manager.h"
+#include "sim.h"
+
+#define HRES            240
+#define VRES            240
+#define LOG_LENGTH      64
+
+#define CHECK(cond) \
+    do \
+    { \
+        if (!(cond)) \
+        { \
+            printf("  FAILED: %s (line %d)\n", #cond, __LINE__); \
+            failure_cnt++; \
+        } \
+    } while (0)
+
+typedef struct
+{
+    char name;
+    bool fail_init;
+    lv_obj_t* screen;   // The screen of the last init
+    lv_obj_t* label;
+    int errors;         // Hooks called in a wrong state
+} test_widget_t;
+
+static int failure_cnt = 0;
+
+static char hook_log[LOG_LENGTH + 1];
+static int hook_log_cnt = 0;
+
+static test_widget_t widget_a = {.name = 'A'};
+static test_widget_t widget_b = {.name = 'B'};
+static test_widget_t widget_c = {.name = 'C'};
+
+static void flush_cb(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_map)
+{
+    (void)area;
+    (void)color_map;
+    lv_disp_flush_ready(drv);
+}
+
+static void headless_display_create(void)
+{
+    static lv_color_t buf[HRES * 10];
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t disp_drv;
+
+    lv_disp_draw_buf_init(&draw_buf, buf, NULL, HRES * 10);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = HRES;
+    disp_drv.ver_res = VRES;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.draw_buf = &draw_buf;
+    lv_disp_drv_register(&disp_drv);
+}
+
+static void log_hook(const test_widget_t* widget, char hook)
+{
+    if (hook_log_cnt + 2 <= LOG_LENGTH)
+    {
+        hook_log[hook_log_cnt++] = widget->name;
+        hook_log[hook_log_cnt++] = hook;
+        hook_log[hook_log_cnt] = '\0';
+    }
+}
+
+static bool log_matches(const char* expected)
+{
+    /*Call it with lvgl_port_lock() taken. Restarts the log*/
+    bool matches = strcmp(hook_log, expected) == 0;
+    if (!matches)
+    {
+        printf("  log: %s, expected %s\n", hook_log, expected);
+    }
+
+    hook_log_cnt = 0;
+    hook_log[0] = '\0';
+    return matches;
+}
+
+static bool test_init(void* ctx, lv_obj_t* screen)
+{
+    test_widget_t* widget = ctx;
+    log_hook(widget, 'i');
+    if (widget->fail_init)
+    {
+        return false;
+    }
+
+    widget->screen = screen;
+    widget->label = lv_label_create(screen);
+    lv_label_set_text(widget->label, "00:00");
+    return true;
+}
+
+static void test_activate(void* ctx)
+{
+    test_widget_t* widget = ctx;
+    log_hook(widget, 'a');
+    if (lv_scr_act() != widget->screen)
+    {
+        widget->errors++;
+    }
+}
+
+static void test_suspend(void* ctx)
+{
+    log_hook(ctx, 's');
+}
+
+static void test_destroy(void* ctx)
+{
+    test_widget_t* widget = ctx;
+    log_hook(widget, 'd');
+
+    /*The screen is deleted first, with everything created on it*/
+    if (lv_obj_is_valid(widget->screen) || lv_obj_is_valid(widget->label))
+    {
+        widget->errors++;
+    }
+}
+
+static widget_t make_widget(test_widget_t* ctx, bool keep_tree)
+{
+    return (widget_t)
+    {
+        .name = ctx->name == 'A' ? "A" : ctx->name == 'B' ? "B" : "C",
+        .keep_tree = keep_tree,
+        .init = test_init,
+        .activate = test_activate,
+        .suspend = test_suspend,
+        .destroy = test_destroy,
+        .ctx = ctx,
+    };
+}
+
+static void switch_widget(int step)
+{
+    lvgl_port_lock(0);
+    widget_manager_switch(step);
+    lvgl_port_unlock();
+}
+
+static bool wait_log_length(int length)
+{
+    /*The LVGL task applies the queued switches every UI_CMD_PERIOD_MS*/
+    uint64_t start_us = sim_time_us();
+    while (sim_time_us() - start_us < 2000000)
+    {
+        lvgl_port_lock(0);
+        bool done = hook_log_cnt >= length;
+        lvgl_port_unlock();
+        if (done)
+        {
+            return true;
+        }
+        sim_sleep_us(1000);
+    }
+    return false;
+}
+
+static void test_lazy_creation(void)
+{
+    printf("lazy creation\n");
+
+    lvgl_port_lock(0);
+    CHECK(log_matches("")); // Nothing is created on registration
+    lvgl_port_unlock();
+
+    widget_manager_start();
+
+    lvgl_port_lock(0);
+    CHECK(log_matches("AiAa"));
+    CHECK(lv_scr_act() == widget_a.screen);
+    CHECK(widget_b.screen == NULL && widget_c.screen == NULL);
+    lvgl_port_unlock();
+}
+
+static void test_lifecycle_order(void)
+{
+    printf("lifecycle order\n");
+
+    /*The next widget is created before the active one is suspended, so a failed init can keep it.
+    A doesn't keep its tree, so its screen is deleted with the label and then destroy() frees the rest*/
+    lv_obj_t* screen_a = widget_a.screen;
+    switch_widget(1);
+
+    lvgl_port_lock(0);
+    CHECK(log_matches("BiAsAdBa"));
+    CHECK(lv_scr_act() == widget_b.screen);
+    CHECK(!lv_obj_is_valid(screen_a));
+    lvgl_port_unlock();
+}
+
+static void test_failed_init(void)
+{
+    printf("failed init\n");
+
+    /*C can't be created, B stays active and isn't even suspended*/
+    widget_c.fail_init = true;
+    switch_widget(1);
+
+    lvgl_port_lock(0);
+    CHECK(log_matches("Ci"));
+    CHECK(lv_scr_act() == widget_b.screen);
+    lvgl_port_unlock();
+
+    /*It's tried again on the next switch. B keeps its tree, so it's only suspended*/
+    widget_c.fail_init = false;
+    switch_widget(1);
+
+    lvgl_port_lock(0);
+    CHECK(log_matches("CiBsCa"));
+    CHECK(lv_scr_act() == widget_c.screen);
+    CHECK(lv_obj_is_valid(widget_b.screen) && lv_obj_is_valid(widget_b.label));
+    lvgl_port_unlock();
+}
+
+static void test_reactivation(void)
+{
+    printf("reactivation\n");
+
+    /*Wraps around to A, which is created again as its tree was freed. B is activated on its kept tree*/
+    switch_widget(1);
+
+    lvgl_port_lock(0);
+    CHECK(log_matches("AiCsCdAa"));
+    lvgl_port_unlock();
+
+    switch_widget(-2);
+
+    lvgl_port_lock(0);
+    CHECK(log_matches("AsAdBa"));
+    CHECK(lv_scr_act() == widget_b.screen);
+    lvgl_port_unlock();
+}
+
+static void test_queued_switches(void)
+{
+    printf("queued switches\n");
+
+    switch_widget(1);
+    lvgl_port_lock(0);
+    CHECK(log_matches("CiBsCa"));
+    lvgl_port_unlock();
+
+    /*Two long presses queue two switches. The flush before deleting C's screen must not run the second switch
+    inside the first one, which destroyed C twice*/
+    static QueueHandle_t event_queue;
+    event_queue = xQueueCreate(4, sizeof(input_event_t));
+    xTaskCreate(input_events_handler_task, "input events", 4096, &event_queue, 5, NULL);
+
+    input_event_t event = LONG_PRESS_EVENT;
+    lvgl_port_lock(0); // Both switches wait in the queue until the LVGL task gets the lock
+    xQueueSend(event_queue, &event, 0);
+    xQueueSend(event_queue, &event, 0);
+    sim_sleep_us(50000);
+    lvgl_port_unlock();
+
+    CHECK(wait_log_length((int)strlen("AiCsCdAaAsAdBa")));
+    sim_sleep_us(50000); // Nothing more may follow
+
+    lvgl_port_lock(0);
+    CHECK(log_matches("AiCsCdAaAsAdBa"));
+    CHECK(lv_scr_act() == widget_b.screen);
+    lvgl_port_unlock();
+}
+
+int main(void)
+{
+    esp_log_level_set("*", ESP_LOG_NONE);
+
+    lvgl_port_cfg_t lvgl_cfg = ESP_LVGL_PORT_INIT_CONFIG();
+    if (lvgl_port_init(&lvgl_cfg) != ESP_OK)
+    {
+        printf("Setup failed\n");
+        return EXIT_FAILURE;
+    }
+
+    lvgl_port_lock(0);
+    headless_display_create();
+    bool ok = ui_cmd_init();
+    lvgl_port_unlock();
+
+    widget_t widgets[] = {make_widget(&widget_a, false), make_widget(&widget_b, true), make_widget(&widget_c, false)};
+    for (int i = 0; i < 3; i++)
+    {
+        ok = ok && widget_manager_register(&widgets[i]);
+    }
+    if (!ok)
+    {
+        printf("Setup failed\n");
+        return EXIT_FAILURE;
+    }
+
+    test_lazy_creation();
+    test_lifecycle_order();
+    test_failed_init();
+    test_reactivation();
+    test_queued_switches();
+
+    CHECK(widget_a.errors == 0 && widget_b.errors == 0 && widget_c.errors == 0);
+
+    printf("%s: %d failure(s)\n", failure_cnt ? "FAILED" : "OK", failure_cnt);
+    fflush(stdout);
+    exit(failure_cnt ? EXIT_FAILURE : EXIT_SUCCESS);
+}